@@ -0,0 +1,1162 @@
+/* Copyright (c) 2018 The Johns Hopkins University/Applied Physics Laboratory
+ * All Rights Reserved.
+ *
+ * This file is dual licensed under the terms of the Apache 2.0 License and
+ * the BSD 3-Clause License. See the LICENSE file in the root of this
+ * repository for more information.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "kmip.h"
+#include "kmip_memset.h"
+
+
+
+#define DEFAULT_ITERATIONS (200000)
+
+
+typedef struct benchmark_timer
+{
+    struct timespec start;
+    struct timespec stop;
+} BenchmarkTimer;
+
+
+void
+start_timer(BenchmarkTimer *timer)
+{
+    timespec_get(&timer->start, TIME_UTC);
+}
+
+void
+stop_timer(BenchmarkTimer *timer)
+{
+    timespec_get(&timer->stop, TIME_UTC);
+}
+
+double
+elapsed_nanoseconds(const BenchmarkTimer *timer)
+{
+    double seconds = (double)(timer->stop.tv_sec - timer->start.tv_sec);
+    double nanoseconds = (double)(timer->stop.tv_nsec - timer->start.tv_nsec);
+
+    return(seconds * 1e9 + nanoseconds);
+}
+
+void
+report_benchmark_result(
+    const char *function,
+    size_t payload_size,
+    size_t iterations,
+    const BenchmarkTimer *timer)
+{
+    double total = elapsed_nanoseconds(timer);
+    double per_op = total / (double)iterations;
+    double throughput = 0.0;
+    if(total > 0.0)
+    {
+        throughput = ((double)payload_size * (double)iterations) / (total / 1e9) / (1024.0 * 1024.0);
+    }
+
+    printf("%-40s %6zu B  %10.1f ns/op  %10.1f MiB/s\n",
+           function, payload_size, per_op, throughput);
+}
+
+/* Primitive Benchmarks */
+
+/* The byte-at-a-time wipe kmip_memset used before it was vectorized. */
+/* The volatile stores keep the compiler from turning it into memset. */
+void *
+bytewise_memset(void *ptr, int value, size_t size)
+{
+    volatile unsigned char *index = (volatile unsigned char *)ptr;
+    for(size_t i = 0; i < size; i++)
+    {
+        *index++ = (unsigned char)value;
+    }
+
+    return(ptr);
+}
+
+static void *
+(* volatile bench_indirect_memset)(void *, int, size_t) = bytewise_memset;
+
+int
+bench_wipe_buffer(size_t buffer_size, int bytewise, size_t iterations)
+{
+    uint8 *buffer = calloc(1, buffer_size);
+    if(buffer == NULL)
+    {
+        return(1);
+    }
+
+    BenchmarkTimer timer = {0};
+    start_timer(&timer);
+    for(size_t i = 0; i < iterations; i++)
+    {
+        buffer[i % buffer_size] = (uint8)i;
+        if(bytewise)
+        {
+            bench_indirect_memset(buffer, 0, buffer_size);
+        }
+        else
+        {
+            kmip_memset(buffer, 0, buffer_size);
+        }
+    }
+    stop_timer(&timer);
+
+    int result = !kmip_is_zero_buffer(buffer, buffer_size);
+    if(result == 0)
+    {
+        report_benchmark_result(
+            bytewise ? "bench_wipe_buffer_bytewise" : __func__,
+            buffer_size,
+            iterations,
+            &timer);
+    }
+
+    free(buffer);
+    return(result);
+}
+
+int
+bench_encode_byte_string(size_t payload_size, size_t iterations)
+{
+    uint8 *payload = calloc(1, payload_size);
+    uint8 *encoding = calloc(1, payload_size + 16);
+    if(payload == NULL || encoding == NULL)
+    {
+        free(payload);
+        free(encoding);
+        return(1);
+    }
+    for(size_t i = 0; i < payload_size; i++)
+    {
+        payload[i] = (uint8)i;
+    }
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, encoding, payload_size + 16, KMIP_1_0);
+
+    ByteString value = {0};
+    value.value = payload;
+    value.size = payload_size;
+
+    int result = KMIP_OK;
+    BenchmarkTimer timer = {0};
+    start_timer(&timer);
+    for(size_t i = 0; i < iterations && result == KMIP_OK; i++)
+    {
+        kmip_rewind(&ctx);
+        result = kmip_encode_byte_string(&ctx, KMIP_TAG_KEY_MATERIAL, &value);
+    }
+    stop_timer(&timer);
+
+    if(result == KMIP_OK)
+    {
+        report_benchmark_result(__func__, payload_size, iterations, &timer);
+    }
+
+    kmip_destroy(&ctx);
+    free(payload);
+    free(encoding);
+    return(result != KMIP_OK);
+}
+
+int
+bench_decode_byte_string(size_t payload_size, size_t iterations)
+{
+    uint8 *payload = calloc(1, payload_size);
+    uint8 *encoding = calloc(1, payload_size + 16);
+    if(payload == NULL || encoding == NULL)
+    {
+        free(payload);
+        free(encoding);
+        return(1);
+    }
+    for(size_t i = 0; i < payload_size; i++)
+    {
+        payload[i] = (uint8)i;
+    }
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, encoding, payload_size + 16, KMIP_1_0);
+
+    ByteString value = {0};
+    value.value = payload;
+    value.size = payload_size;
+
+    int result = kmip_encode_byte_string(&ctx, KMIP_TAG_KEY_MATERIAL, &value);
+
+    BenchmarkTimer timer = {0};
+    start_timer(&timer);
+    for(size_t i = 0; i < iterations && result == KMIP_OK; i++)
+    {
+        ByteString observed = {0};
+
+        kmip_rewind(&ctx);
+        result = kmip_decode_byte_string(&ctx, KMIP_TAG_KEY_MATERIAL, &observed);
+        kmip_free_byte_string(&ctx, &observed);
+    }
+    stop_timer(&timer);
+
+    if(result == KMIP_OK)
+    {
+        report_benchmark_result(__func__, payload_size, iterations, &timer);
+    }
+
+    kmip_destroy(&ctx);
+    free(payload);
+    free(encoding);
+    return(result != KMIP_OK);
+}
+
+int
+bench_encode_integer(size_t iterations)
+{
+    uint8 encoding[16 * 64] = {0};
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+
+    int result = KMIP_OK;
+    BenchmarkTimer timer = {0};
+    start_timer(&timer);
+    for(size_t i = 0; i < iterations && result == KMIP_OK; i++)
+    {
+        kmip_rewind(&ctx);
+        for(int32 j = 0; j < 64 && result == KMIP_OK; j++)
+        {
+            result = kmip_encode_integer(&ctx, KMIP_TAG_CRYPTOGRAPHIC_LENGTH, j);
+        }
+    }
+    stop_timer(&timer);
+
+    if(result == KMIP_OK)
+    {
+        report_benchmark_result(__func__, ARRAY_LENGTH(encoding), iterations, &timer);
+    }
+
+    kmip_destroy(&ctx);
+    return(result != KMIP_OK);
+}
+
+int
+bench_decode_integer(size_t iterations)
+{
+    uint8 encoding[16 * 64] = {0};
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+
+    int result = KMIP_OK;
+    for(int32 j = 0; j < 64 && result == KMIP_OK; j++)
+    {
+        result = kmip_encode_integer(&ctx, KMIP_TAG_CRYPTOGRAPHIC_LENGTH, j);
+    }
+
+    BenchmarkTimer timer = {0};
+    start_timer(&timer);
+    for(size_t i = 0; i < iterations && result == KMIP_OK; i++)
+    {
+        kmip_rewind(&ctx);
+        for(int32 j = 0; j < 64 && result == KMIP_OK; j++)
+        {
+            int32 value = 0;
+            result = kmip_decode_integer(&ctx, KMIP_TAG_CRYPTOGRAPHIC_LENGTH, &value);
+        }
+    }
+    stop_timer(&timer);
+
+    if(result == KMIP_OK)
+    {
+        report_benchmark_result(__func__, ARRAY_LENGTH(encoding), iterations, &timer);
+    }
+
+    kmip_destroy(&ctx);
+    return(result != KMIP_OK);
+}
+
+/* Structure Benchmarks */
+
+int
+bench_decode_cryptographic_parameters(size_t iterations)
+{
+    uint8 encoding[256] = {0};
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_4);
+
+    CryptographicParameters value = {0};
+    kmip_init_cryptographic_parameters(&value);
+    value.block_cipher_mode = KMIP_BLOCK_GCM;
+    value.padding_method = KMIP_PAD_OAEP;
+    value.hashing_algorithm = KMIP_HASH_SHA256;
+    value.key_role_type = KMIP_ROLE_KEK;
+    value.digital_signature_algorithm = KMIP_DIGITAL_SHA256_WITH_RSA;
+    value.cryptographic_algorithm = KMIP_CRYPTOALG_AES;
+    value.mask_generator = KMIP_MASKGEN_MGF1;
+    value.mask_generator_hashing_algorithm = KMIP_HASH_SHA256;
+
+    int result = kmip_encode_cryptographic_parameters(&ctx, &value);
+    size_t encoding_size = ctx.index - ctx.buffer;
+
+    BenchmarkTimer timer = {0};
+    start_timer(&timer);
+    for(size_t i = 0; i < iterations && result == KMIP_OK; i++)
+    {
+        CryptographicParameters observed = {0};
+
+        kmip_rewind(&ctx);
+        result = kmip_decode_cryptographic_parameters(&ctx, &observed);
+        kmip_free_cryptographic_parameters(&ctx, &observed);
+    }
+    stop_timer(&timer);
+
+    if(result == KMIP_OK)
+    {
+        report_benchmark_result(__func__, encoding_size, iterations, &timer);
+    }
+
+    kmip_destroy(&ctx);
+    return(result != KMIP_OK);
+}
+
+int
+bench_encode_create_request_payload(int pre_encoded, size_t iterations)
+{
+    uint8 encoding[256] = {0};
+    KMIP ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+
+    Attribute attributes[3] = {0};
+    for(size_t i = 0; i < ARRAY_LENGTH(attributes); i++)
+    {
+        kmip_init_attribute(&attributes[i]);
+    }
+
+    enum cryptographic_algorithm algorithm = KMIP_CRYPTOALG_AES;
+    int32 length = 256;
+    int32 mask = KMIP_CRYPTOMASK_ENCRYPT | KMIP_CRYPTOMASK_DECRYPT;
+    attributes[0].type = KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM;
+    attributes[0].value = &algorithm;
+    attributes[1].type = KMIP_ATTR_CRYPTOGRAPHIC_LENGTH;
+    attributes[1].value = &length;
+    attributes[2].type = KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK;
+    attributes[2].value = &mask;
+
+    TemplateAttribute template_attribute = {0};
+    template_attribute.attributes = attributes;
+    template_attribute.attribute_count = ARRAY_LENGTH(attributes);
+
+    KMIPFragment fragment = {0};
+    int result = KMIP_OK;
+    if(pre_encoded)
+    {
+        result = kmip_build_template_attribute_fragment(&ctx, &template_attribute, &fragment);
+        template_attribute.fragment = &fragment;
+    }
+
+    CreateRequestPayload value = {0};
+    value.object_type = KMIP_OBJTYPE_SYMMETRIC_KEY;
+    value.template_attribute = &template_attribute;
+
+    BenchmarkTimer timer = {0};
+    start_timer(&timer);
+    for(size_t i = 0; i < iterations && result == KMIP_OK; i++)
+    {
+        kmip_rewind(&ctx);
+        result = kmip_encode_create_request_payload(&ctx, &value);
+    }
+    stop_timer(&timer);
+
+    if(result == KMIP_OK)
+    {
+        report_benchmark_result(
+            pre_encoded ? "bench_encode_create_request_fragment" : __func__,
+            ctx.index - ctx.buffer,
+            iterations,
+            &timer);
+    }
+
+    kmip_free_fragment(&ctx, &fragment);
+    kmip_destroy(&ctx);
+    return(result != KMIP_OK);
+}
+
+int
+bench_encode_get_request_message(int templated, size_t iterations)
+{
+    uint8 encoding[512] = {0};
+    KMIP ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+    
+    TextString username = {"Fred", 4, KMIP_FALSE, KMIP_FALSE};
+    TextString password = {"password1", 9, KMIP_FALSE, KMIP_FALSE};
+    UsernamePasswordCredential upc = {&username, &password};
+    Credential credential = {KMIP_CRED_USERNAME_AND_PASSWORD, &upc};
+    Authentication authentication = {0};
+    authentication.credential = &credential;
+    
+    ProtocolVersion pv = {0};
+    kmip_init_protocol_version(&pv, KMIP_1_0);
+    
+    RequestHeader rh = {0};
+    kmip_init_request_header(&rh);
+    rh.protocol_version = &pv;
+    rh.authentication = &authentication;
+    rh.time_stamp = 1335514341;
+    rh.batch_count = 1;
+    
+    TextString uuid = {0};
+    uuid.value = "fb4b5b9c-6188-4c63-8142-fe9c328129fc";
+    uuid.size = 36;
+    
+    GetRequestPayload payload = {0};
+    payload.unique_identifier = &uuid;
+    
+    RequestBatchItem batch_item = {0};
+    kmip_init_request_batch_item(&batch_item);
+    batch_item.operation = KMIP_OP_GET;
+    batch_item.request_payload = &payload;
+    
+    RequestMessage value = {0};
+    value.request_header = &rh;
+    value.batch_items = &batch_item;
+    value.batch_count = 1;
+    
+    KMIPRequestTemplate template = {0};
+    int result = KMIP_OK;
+    if(templated)
+    {
+        result = kmip_init_request_template(&ctx, &template, &value);
+    }
+    
+    /* Each request differs from the last in its time stamp and key. */
+    size_t size = 0;
+    BenchmarkTimer timer = {0};
+    start_timer(&timer);
+    for(size_t i = 0; i < iterations && result == KMIP_OK; i++)
+    {
+        rh.time_stamp++;
+        if(templated)
+        {
+            result = kmip_set_template_time_stamp(&ctx, &template, rh.time_stamp);
+            if(result == KMIP_OK)
+            {
+                result = kmip_set_template_unique_identifier(&ctx, &template, &uuid);
+            }
+            size = template.size;
+        }
+        else
+        {
+            kmip_rewind(&ctx);
+            result = kmip_encode_request_message(&ctx, &value);
+            size = ctx.index - ctx.buffer;
+        }
+    }
+    stop_timer(&timer);
+    
+    if(result == KMIP_OK)
+    {
+        report_benchmark_result(
+            templated ? "bench_patch_get_request_template" : __func__,
+            size,
+            iterations,
+            &timer);
+    }
+    
+    kmip_free_request_template(&ctx, &template);
+    kmip_destroy(&ctx);
+    return(result != KMIP_OK);
+}
+
+int
+bench_decode_response_message(size_t batch_count, size_t iterations)
+{
+    ResponseBatchItem *batch_items = calloc(batch_count, sizeof(ResponseBatchItem));
+    if(batch_items == NULL)
+    {
+        return(1);
+    }
+
+    ProtocolVersion pv = {0};
+    kmip_init_protocol_version(&pv, KMIP_1_0);
+
+    ResponseHeader rh = {0};
+    kmip_init_response_header(&rh);
+    rh.protocol_version = &pv;
+    rh.time_stamp = 1335514343;
+    rh.batch_count = (int32)batch_count;
+
+    TextString uuid = {0};
+    uuid.value = "fb4b5b9c-6188-4c63-8142-fe9c328129fc";
+    uuid.size = 36;
+
+    DestroyResponsePayload payload = {0};
+    payload.unique_identifier = &uuid;
+
+    for(size_t i = 0; i < batch_count; i++)
+    {
+        batch_items[i].operation = KMIP_OP_DESTROY;
+        batch_items[i].result_status = KMIP_STATUS_SUCCESS;
+        batch_items[i].response_payload = &payload;
+    }
+
+    ResponseMessage value = {0};
+    value.response_header = &rh;
+    value.batch_items = batch_items;
+    value.batch_count = batch_count;
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+
+    int result = kmip_set_own_buffer(&ctx, 1024);
+    if(result == KMIP_OK)
+    {
+        result = kmip_encode_response_message(&ctx, &value);
+    }
+    size_t encoding_size = ctx.index - ctx.buffer;
+
+    BenchmarkTimer timer = {0};
+    start_timer(&timer);
+    for(size_t i = 0; i < iterations && result == KMIP_OK; i++)
+    {
+        ResponseMessage observed = {0};
+
+        kmip_rewind(&ctx);
+        result = kmip_decode_response_message(&ctx, &observed);
+        kmip_free_response_message(&ctx, &observed);
+    }
+    stop_timer(&timer);
+
+    if(result == KMIP_OK)
+    {
+        report_benchmark_result(__func__, encoding_size, iterations, &timer);
+    }
+
+    kmip_destroy(&ctx);
+    free(batch_items);
+    return(result != KMIP_OK);
+}
+
+int
+bench_decode_response_message_arena(size_t batch_count, size_t iterations)
+{
+    ResponseBatchItem *batch_items = calloc(batch_count, sizeof(ResponseBatchItem));
+    if(batch_items == NULL)
+    {
+        return(1);
+    }
+
+    ProtocolVersion pv = {0};
+    kmip_init_protocol_version(&pv, KMIP_1_0);
+
+    ResponseHeader rh = {0};
+    kmip_init_response_header(&rh);
+    rh.protocol_version = &pv;
+    rh.time_stamp = 1335514343;
+    rh.batch_count = (int32)batch_count;
+
+    TextString uuid = {0};
+    uuid.value = "fb4b5b9c-6188-4c63-8142-fe9c328129fc";
+    uuid.size = 36;
+
+    DestroyResponsePayload payload = {0};
+    payload.unique_identifier = &uuid;
+
+    for(size_t i = 0; i < batch_count; i++)
+    {
+        batch_items[i].operation = KMIP_OP_DESTROY;
+        batch_items[i].result_status = KMIP_STATUS_SUCCESS;
+        batch_items[i].response_payload = &payload;
+    }
+
+    ResponseMessage value = {0};
+    value.response_header = &rh;
+    value.batch_items = batch_items;
+    value.batch_count = batch_count;
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+
+    int result = kmip_set_own_buffer(&ctx, 1024);
+    if(result == KMIP_OK)
+    {
+        result = kmip_encode_response_message(&ctx, &value);
+    }
+    size_t encoding_size = ctx.index - ctx.buffer;
+
+    /* Decoded nodes come from the arena and are released in one pass. */
+    KMIPArena arena = {0};
+    kmip_init_arena(&arena, 4096);
+    kmip_set_arena(&ctx, &arena);
+
+    BenchmarkTimer timer = {0};
+    start_timer(&timer);
+    for(size_t i = 0; i < iterations && result == KMIP_OK; i++)
+    {
+        ResponseMessage observed = {0};
+
+        kmip_rewind(&ctx);
+        result = kmip_decode_response_message(&ctx, &observed);
+        kmip_reset_arena_after_response_message(&ctx, &observed);
+    }
+    stop_timer(&timer);
+
+    if(result == KMIP_OK)
+    {
+        report_benchmark_result(__func__, encoding_size, iterations, &timer);
+    }
+
+    kmip_unset_arena(&ctx);
+    kmip_destroy(&ctx);
+    kmip_free_arena(&arena);
+    free(batch_items);
+    return(result != KMIP_OK);
+}
+
+int
+bench_decode_response_message_lazy(size_t batch_count, size_t used, size_t iterations)
+{
+    ResponseBatchItem *batch_items = calloc(batch_count, sizeof(ResponseBatchItem));
+    if(batch_items == NULL)
+    {
+        return(1);
+    }
+
+    ProtocolVersion pv = {0};
+    kmip_init_protocol_version(&pv, KMIP_1_0);
+
+    ResponseHeader rh = {0};
+    kmip_init_response_header(&rh);
+    rh.protocol_version = &pv;
+    rh.time_stamp = 1335514343;
+    rh.batch_count = (int32)batch_count;
+
+    TextString uuid = {0};
+    uuid.value = "fb4b5b9c-6188-4c63-8142-fe9c328129fc";
+    uuid.size = 36;
+
+    DestroyResponsePayload payload = {0};
+    payload.unique_identifier = &uuid;
+
+    for(size_t i = 0; i < batch_count; i++)
+    {
+        batch_items[i].operation = KMIP_OP_DESTROY;
+        batch_items[i].result_status = KMIP_STATUS_SUCCESS;
+        batch_items[i].response_payload = &payload;
+    }
+
+    ResponseMessage value = {0};
+    value.response_header = &rh;
+    value.batch_items = batch_items;
+    value.batch_count = batch_count;
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+
+    int result = kmip_set_own_buffer(&ctx, 1024);
+    if(result == KMIP_OK)
+    {
+        result = kmip_encode_response_message(&ctx, &value);
+    }
+    size_t encoding_size = ctx.index - ctx.buffer;
+    ctx.lazy_payloads = KMIP_TRUE;
+
+    /* Decode every status but only the first few payloads. */
+    BenchmarkTimer timer = {0};
+    start_timer(&timer);
+    for(size_t i = 0; i < iterations && result == KMIP_OK; i++)
+    {
+        ResponseMessage observed = {0};
+
+        kmip_rewind(&ctx);
+        result = kmip_decode_response_message(&ctx, &observed);
+        for(size_t j = 0; j < used && result == KMIP_OK; j++)
+        {
+            void *decoded = NULL;
+            result = kmip_response_item_payload(&ctx, &observed, j, &decoded);
+        }
+        kmip_free_response_message(&ctx, &observed);
+    }
+    stop_timer(&timer);
+
+    if(result == KMIP_OK)
+    {
+        report_benchmark_result(__func__, encoding_size, iterations, &timer);
+    }
+
+    kmip_destroy(&ctx);
+    free(batch_items);
+    return(result != KMIP_OK);
+}
+
+int
+bench_parse_response_message(size_t batch_count, size_t chunk_size, size_t iterations)
+{
+    ResponseBatchItem *batch_items = calloc(batch_count, sizeof(ResponseBatchItem));
+    if(batch_items == NULL)
+    {
+        return(1);
+    }
+
+    ProtocolVersion pv = {0};
+    kmip_init_protocol_version(&pv, KMIP_1_0);
+
+    ResponseHeader rh = {0};
+    kmip_init_response_header(&rh);
+    rh.protocol_version = &pv;
+    rh.time_stamp = 1335514343;
+    rh.batch_count = (int32)batch_count;
+
+    TextString uuid = {0};
+    uuid.value = "fb4b5b9c-6188-4c63-8142-fe9c328129fc";
+    uuid.size = 36;
+
+    DestroyResponsePayload payload = {0};
+    payload.unique_identifier = &uuid;
+
+    for(size_t i = 0; i < batch_count; i++)
+    {
+        batch_items[i].operation = KMIP_OP_DESTROY;
+        batch_items[i].result_status = KMIP_STATUS_SUCCESS;
+        batch_items[i].response_payload = &payload;
+    }
+
+    ResponseMessage value = {0};
+    value.response_header = &rh;
+    value.batch_items = batch_items;
+    value.batch_count = batch_count;
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+
+    int result = kmip_set_own_buffer(&ctx, 1024);
+    if(result == KMIP_OK)
+    {
+        result = kmip_encode_response_message(&ctx, &value);
+    }
+    size_t encoding_size = ctx.index - ctx.buffer;
+    ctx.max_message_size = (int)encoding_size;
+
+    /* Feed the encoding in chunk_size pieces, as reads would deliver it. */
+    KMIPParser parser = {0};
+    kmip_parser_init(&parser, &ctx);
+
+    BenchmarkTimer timer = {0};
+    start_timer(&timer);
+    for(size_t i = 0; i < iterations && result == KMIP_OK; i++)
+    {
+        kmip_parser_reset(&parser);
+
+        int state = KMIP_PARSER_NEED_MORE;
+        for(size_t offset = 0; offset < encoding_size && state == KMIP_PARSER_NEED_MORE; offset += chunk_size)
+        {
+            size_t chunk = encoding_size - offset;
+            state = kmip_parser_feed(&parser, ctx.buffer + offset, (chunk < chunk_size) ? chunk : chunk_size);
+        }
+        if(state != KMIP_PARSER_COMPLETE)
+        {
+            result = (state < 0) ? state : KMIP_ERROR_BUFFER_UNDERFULL;
+        }
+    }
+    stop_timer(&timer);
+
+    if(result == KMIP_OK)
+    {
+        report_benchmark_result(__func__, encoding_size, iterations, &timer);
+    }
+
+    kmip_parser_free(&parser);
+    kmip_destroy(&ctx);
+    free(batch_items);
+    return(result != KMIP_OK);
+}
+
+/* Attribute Benchmarks */
+
+int
+bench_classify_tags(size_t iterations)
+{
+    /* A mix of attribute, enumeration, and structure tags as they would */
+    /* appear while walking a response.                                  */
+    enum tag tags[16] = {
+        KMIP_TAG_UNIQUE_IDENTIFIER,
+        KMIP_TAG_STATE,
+        KMIP_TAG_CRYPTOGRAPHIC_USAGE_MASK,
+        KMIP_TAG_ATTRIBUTES,
+        KMIP_TAG_WRAPPING_METHOD,
+        KMIP_TAG_RESULT_STATUS,
+        KMIP_TAG_OPERATION,
+        KMIP_TAG_BATCH_ITEM,
+        KMIP_TAG_OBJECT_TYPE,
+        KMIP_TAG_NAME,
+        KMIP_TAG_PROTECTION_STORAGE_MASK,
+        KMIP_TAG_KEY_FORMAT_TYPE,
+        KMIP_TAG_RESPONSE_PAYLOAD,
+        KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM,
+        KMIP_TAG_ATTESTATION_TYPE,
+        KMIP_TAG_APPLICATION_SPECIFIC_INFORMATION
+    };
+
+    volatile int sink = 0;
+    BenchmarkTimer timer = {0};
+    start_timer(&timer);
+    for(size_t i = 0; i < iterations; i++)
+    {
+        int total = 0;
+        for(size_t j = 0; j < ARRAY_LENGTH(tags); j++)
+        {
+            total += kmip_is_attribute_tag(tags[j]);
+            total += kmip_get_enum_string_index(tags[j]);
+        }
+        sink += total;
+    }
+    stop_timer(&timer);
+    (void)sink;
+
+    report_benchmark_result(__func__, sizeof(tags), iterations, &timer);
+    return(0);
+}
+
+int
+bench_decode_attributes(size_t attribute_count, int pooled, size_t iterations)
+{
+    Attribute *attributes = calloc(attribute_count, sizeof(Attribute));
+    if(attributes == NULL)
+    {
+        return(1);
+    }
+
+    TextString uuid = {0};
+    uuid.value = "fb4b5b9c-6188-4c63-8142-fe9c328129fc";
+    uuid.size = 36;
+    int32 length = 256;
+    int32 mask = KMIP_CRYPTOMASK_ENCRYPT | KMIP_CRYPTOMASK_DECRYPT;
+    enum cryptographic_algorithm algorithm = KMIP_CRYPTOALG_AES;
+    enum object_type object_type = KMIP_OBJTYPE_SYMMETRIC_KEY;
+    enum state state = KMIP_STATE_ACTIVE;
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_2_0);
+
+    Attributes value = {0};
+    int result = KMIP_OK;
+    for(size_t i = 0; i < attribute_count; i++)
+    {
+        kmip_init_attribute(&attributes[i]);
+        switch(i % 6)
+        {
+            case 0:
+            attributes[i].type = KMIP_ATTR_UNIQUE_IDENTIFIER;
+            attributes[i].value = &uuid;
+            break;
+
+            case 1:
+            attributes[i].type = KMIP_ATTR_CRYPTOGRAPHIC_LENGTH;
+            attributes[i].value = &length;
+            break;
+
+            case 2:
+            attributes[i].type = KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK;
+            attributes[i].value = &mask;
+            break;
+
+            case 3:
+            attributes[i].type = KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM;
+            attributes[i].value = &algorithm;
+            break;
+
+            case 4:
+            attributes[i].type = KMIP_ATTR_OBJECT_TYPE;
+            attributes[i].value = &object_type;
+            break;
+
+            default:
+            attributes[i].type = KMIP_ATTR_STATE;
+            attributes[i].value = &state;
+            break;
+        };
+        if(result == KMIP_OK)
+        {
+            result = kmip_vector_append(&ctx, &value.attribute_list, &attributes[i]);
+        }
+    }
+
+    size_t encoding_size = kmip_size_attributes(&ctx, &value);
+    if(result == KMIP_OK)
+    {
+        result = kmip_set_own_buffer(&ctx, encoding_size);
+    }
+    if(result == KMIP_OK)
+    {
+        result = kmip_encode_attributes(&ctx, &value);
+    }
+
+    /* The pool is installed after encoding so it only sees decode nodes. */
+    KMIPPool pool = {0};
+    kmip_init_pool(&pool);
+    if(pooled)
+    {
+        kmip_set_pool(&ctx, &pool);
+    }
+
+    BenchmarkTimer timer = {0};
+    start_timer(&timer);
+    for(size_t i = 0; i < iterations && result == KMIP_OK; i++)
+    {
+        Attributes observed = {0};
+
+        kmip_rewind(&ctx);
+        result = kmip_decode_attributes(&ctx, &observed);
+        kmip_free_attributes(&ctx, &observed);
+    }
+    stop_timer(&timer);
+
+    if(result == KMIP_OK)
+    {
+        report_benchmark_result(
+            pooled ? "bench_decode_attributes_pooled" : __func__,
+            encoding_size,
+            iterations,
+            &timer);
+    }
+
+    kmip_unset_pool(&ctx);
+    kmip_free_vector(&ctx, &value.attribute_list);
+    kmip_destroy(&ctx);
+    kmip_free_pool(&pool);
+    free(attributes);
+    return(result != KMIP_OK);
+}
+
+int
+bench_find_attribute(size_t attribute_count, int indexed, size_t iterations)
+{
+    Attribute *attributes = calloc(attribute_count, sizeof(Attribute));
+    if(attributes == NULL || attribute_count == 0)
+    {
+        free(attributes);
+        return(1);
+    }
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_2_0);
+
+    /* Only the last attribute has the type being looked up. */
+    Name name = {0};
+    int32 length = 256;
+    Attributes value = {0};
+    int result = KMIP_OK;
+    for(size_t i = 0; i < attribute_count && result == KMIP_OK; i++)
+    {
+        kmip_init_attribute(&attributes[i]);
+        attributes[i].type = KMIP_ATTR_NAME;
+        attributes[i].value = &name;
+        if(i == attribute_count - 1)
+        {
+            attributes[i].type = KMIP_ATTR_CRYPTOGRAPHIC_LENGTH;
+            attributes[i].value = &length;
+        }
+        result = kmip_vector_append(&ctx, &value.attribute_list, &attributes[i]);
+    }
+
+    if(indexed)
+    {
+        kmip_index_attributes(&value);
+    }
+
+    volatile size_t sink = 0;
+    BenchmarkTimer timer = {0};
+    start_timer(&timer);
+    for(size_t i = 0; i < iterations && result == KMIP_OK; i++)
+    {
+        const Attribute *found = kmip_find_attribute(&value, KMIP_ATTR_CRYPTOGRAPHIC_LENGTH, 0);
+        if(found == NULL)
+        {
+            result = KMIP_ERROR_ATTR_UNSUPPORTED;
+        }
+        sink += (found != NULL);
+    }
+    stop_timer(&timer);
+    (void)sink;
+
+    if(result == KMIP_OK)
+    {
+        report_benchmark_result(
+            indexed ? "bench_find_attribute_indexed" : __func__,
+            attribute_count * sizeof(Attribute),
+            iterations,
+            &timer);
+    }
+
+    kmip_free_vector(&ctx, &value.attribute_list);
+    kmip_destroy(&ctx);
+    free(attributes);
+    return(result != KMIP_OK);
+}
+
+int
+bench_hash_template_attribute(size_t attribute_count, size_t iterations)
+{
+    Attribute *attributes = calloc(attribute_count, sizeof(Attribute));
+    if(attributes == NULL || attribute_count == 0)
+    {
+        free(attributes);
+        return(1);
+    }
+
+    TextString name_value = {"example", 7, KMIP_FALSE, KMIP_FALSE};
+    Name name = {&name_value, KMIP_NAME_UNINTERPRETED_TEXT_STRING};
+    int32 length = 256;
+    for(size_t i = 0; i < attribute_count; i++)
+    {
+        kmip_init_attribute(&attributes[i]);
+        attributes[i].type = (i % 2) ? KMIP_ATTR_CRYPTOGRAPHIC_LENGTH : KMIP_ATTR_NAME;
+        attributes[i].value = (i % 2) ? (void *)&length : (void *)&name;
+    }
+
+    TemplateAttribute value = {0};
+    value.attributes = attributes;
+    value.attribute_count = attribute_count;
+
+    volatile uint64 sink = 0;
+    BenchmarkTimer timer = {0};
+    start_timer(&timer);
+    for(size_t i = 0; i < iterations; i++)
+    {
+        sink ^= kmip_hash_template_attribute(&value);
+    }
+    stop_timer(&timer);
+    (void)sink;
+
+    report_benchmark_result(
+        __func__,
+        attribute_count * sizeof(Attribute),
+        iterations,
+        &timer);
+
+    free(attributes);
+    return(0);
+}
+
+/* Benchmark Harness */
+
+int
+run_benchmarks(size_t iterations)
+{
+    int failures = 0;
+
+    printf("Benchmarks\n");
+    printf("==========\n");
+
+    printf("\nPrimitive Benchmarks\n");
+    printf("--------------------\n");
+    failures += bench_encode_byte_string(32, iterations);
+    failures += bench_encode_byte_string(4096, iterations);
+    failures += bench_decode_byte_string(32, iterations);
+    failures += bench_decode_byte_string(4096, iterations);
+    failures += bench_encode_integer(iterations);
+    failures += bench_decode_integer(iterations);
+    failures += bench_wipe_buffer(8192, KMIP_TRUE, iterations / 10);
+    failures += bench_wipe_buffer(8192, KMIP_FALSE, iterations / 10);
+
+    printf("\nStructure Benchmarks\n");
+    printf("--------------------\n");
+    failures += bench_decode_cryptographic_parameters(iterations);
+    failures += bench_encode_create_request_payload(KMIP_FALSE, iterations);
+    failures += bench_encode_create_request_payload(KMIP_TRUE, iterations);
+    failures += bench_encode_get_request_message(KMIP_FALSE, iterations);
+    failures += bench_encode_get_request_message(KMIP_TRUE, iterations);
+    failures += bench_decode_response_message(4, iterations / 10);
+    failures += bench_decode_response_message(256, iterations / 100);
+    failures += bench_decode_response_message_arena(4, iterations / 10);
+    failures += bench_decode_response_message_arena(256, iterations / 100);
+    failures += bench_decode_response_message_lazy(256, 4, iterations / 100);
+    failures += bench_parse_response_message(4, 16, iterations / 10);
+    failures += bench_parse_response_message(256, 1448, iterations / 100);
+
+    printf("\nAttribute Benchmarks\n");
+    printf("--------------------\n");
+    failures += bench_classify_tags(iterations);
+    failures += bench_decode_attributes(6, KMIP_FALSE, iterations / 10);
+    failures += bench_decode_attributes(64, KMIP_FALSE, iterations / 10);
+    failures += bench_decode_attributes(64, KMIP_TRUE, iterations / 10);
+    failures += bench_find_attribute(64, KMIP_FALSE, iterations);
+    failures += bench_find_attribute(64, KMIP_TRUE, iterations);
+    failures += bench_hash_template_attribute(8, iterations);
+
+    if(failures)
+    {
+        printf("\n%d benchmarks failed to run\n", failures);
+    }
+
+    return(failures);
+}
+
+void
+print_help(const char *app)
+{
+    printf("Usage: %s [flag] ...\n\n", app);
+    printf("Flags:\n");
+    printf("-h : print this help info\n");
+    printf("-n <count> : run each benchmark <count> times\n");
+}
+
+int
+parse_arguments(int argc,
+                char **argv,
+                int *print_usage,
+                size_t *iterations)
+{
+    for(int i = 1; i < argc; i++)
+    {
+        if(strncmp(argv[i], "-h", 2) == 0)
+        {
+            *print_usage = 1;
+        }
+        else if(strncmp(argv[i], "-n", 2) == 0 && (i + 1) < argc)
+        {
+            *iterations = strtoul(argv[++i], NULL, 10);
+        }
+        else
+        {
+            printf("Invalid option: '%s'\n", argv[i]);
+            print_help(argv[0]);
+            return(-1);
+        }
+    }
+
+    if(*iterations == 0)
+    {
+        printf("Invalid iteration count\n");
+        return(-1);
+    }
+
+    return(0);
+}
+
+int
+main(int argc, char **argv)
+{
+    int print_usage = 0;
+    size_t iterations = DEFAULT_ITERATIONS;
+
+    int error = parse_arguments(argc, argv, &print_usage, &iterations);
+    if(error)
+    {
+        return(error);
+    }
+    if(print_usage)
+    {
+        print_help(argv[0]);
+        return(0);
+    }
+
+    return(run_benchmarks(iterations));
+}
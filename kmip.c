@@ -9,6 +9,14 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
+
+#if !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
 
 #include "kmip.h"
 #include "kmip_memset.h"
@@ -125,6 +133,435 @@ kmip_linked_list_enqueue(LinkedList *list, LinkedListItem *item)
     }
 }
 
+void
+kmip_init_vector(KMIPVector *vector)
+{
+    if(vector == NULL)
+    {
+        return;
+    }
+    
+    vector->size = 0;
+    vector->capacity = KMIP_VECTOR_INLINE_CAPACITY;
+    vector->heap_items = NULL;
+    for(size_t i = 0; i < KMIP_VECTOR_INLINE_CAPACITY; i++)
+    {
+        vector->inline_items[i] = NULL;
+    }
+}
+
+/* NOTE (ph) A zeroed KMIPVector is a valid empty vector, so structures */
+/*      allocated with calloc do not need kmip_init_vector. Iterate with */
+/*      kmip_vector_begin and kmip_vector_end; both are invalidated by   */
+/*      kmip_vector_append once the items move to heap storage.          */
+
+void *const *
+kmip_vector_begin(const KMIPVector *vector)
+{
+    if(vector == NULL)
+    {
+        return(NULL);
+    }
+    
+    if(vector->heap_items != NULL)
+    {
+        return(vector->heap_items);
+    }
+    
+    return(vector->inline_items);
+}
+
+void *const *
+kmip_vector_end(const KMIPVector *vector)
+{
+    if(vector == NULL)
+    {
+        return(NULL);
+    }
+    
+    return(kmip_vector_begin(vector) + vector->size);
+}
+
+void *
+kmip_vector_get(const KMIPVector *vector, size_t index)
+{
+    if(vector == NULL || index >= vector->size)
+    {
+        return(NULL);
+    }
+    
+    return(kmip_vector_begin(vector)[index]);
+}
+
+int
+kmip_vector_append(KMIP *ctx, KMIPVector *vector, void *item)
+{
+    if(ctx == NULL || vector == NULL)
+    {
+        return(KMIP_ARG_INVALID);
+    }
+    
+    if(vector->heap_items == NULL)
+    {
+        if(vector->size < KMIP_VECTOR_INLINE_CAPACITY)
+        {
+            vector->inline_items[vector->size] = item;
+            vector->size += 1;
+            vector->capacity = KMIP_VECTOR_INLINE_CAPACITY;
+            return(KMIP_OK);
+        }
+        
+        size_t capacity = 2 * KMIP_VECTOR_INLINE_CAPACITY;
+        void **heap_items = ctx->calloc_func(ctx->state, capacity, sizeof(void *));
+        if(heap_items == NULL)
+        {
+            return(KMIP_MEMORY_ALLOC_FAILED);
+        }
+        ctx->memcpy_func(ctx->state, heap_items, vector->inline_items, sizeof(vector->inline_items));
+        
+        vector->heap_items = heap_items;
+        vector->capacity = capacity;
+    }
+    else if(vector->size == vector->capacity)
+    {
+        if(vector->capacity > ((size_t)-1 / sizeof(void *)) / 2)
+        {
+            return(KMIP_MEMORY_ALLOC_FAILED);
+        }
+        
+        size_t capacity = 2 * vector->capacity;
+        void **heap_items = ctx->realloc_func(ctx->state, vector->heap_items, capacity * sizeof(void *));
+        if(heap_items == NULL)
+        {
+            return(KMIP_MEMORY_ALLOC_FAILED);
+        }
+        
+        vector->heap_items = heap_items;
+        vector->capacity = capacity;
+    }
+    
+    vector->heap_items[vector->size] = item;
+    vector->size += 1;
+    
+    return(KMIP_OK);
+}
+
+void *
+kmip_vector_pop(KMIPVector *vector)
+{
+    if(vector == NULL || vector->size == 0)
+    {
+        return(NULL);
+    }
+    
+    vector->size -= 1;
+    void **items = (vector->heap_items != NULL) ? vector->heap_items : vector->inline_items;
+    void *item = items[vector->size];
+    items[vector->size] = NULL;
+    
+    return(item);
+}
+
+void
+kmip_free_vector(KMIP *ctx, KMIPVector *vector)
+{
+    if(vector == NULL)
+    {
+        return;
+    }
+    
+    if(ctx != NULL && vector->heap_items != NULL)
+    {
+        ctx->free_func(ctx->state, vector->heap_items);
+    }
+    
+    kmip_init_vector(vector);
+}
+
+void
+kmip_init_attribute_index(KMIPAttributeIndex *index)
+{
+    if(index == NULL)
+    {
+        return;
+    }
+    
+    index->present = 0;
+    for(size_t i = 0; i < KMIP_ATTR_TYPE_COUNT; i++)
+    {
+        index->first[i] = 0;
+    }
+    index->count = 0;
+}
+
+void
+kmip_add_to_attribute_index(KMIPAttributeIndex *index, const Attribute *attribute, size_t position)
+{
+    if(index == NULL || attribute == NULL)
+    {
+        return;
+    }
+    
+    int type = (int)attribute->type;
+    if(type < 0 || type >= KMIP_ATTR_TYPE_COUNT || position > UINT16_MAX)
+    {
+        return;
+    }
+    
+    uint64 bit = (uint64)1 << type;
+    if((index->present & bit) == 0)
+    {
+        index->present |= bit;
+        index->first[type] = (uint16)position;
+    }
+}
+
+int
+kmip_lookup_attribute_index(const KMIPAttributeIndex *index, enum attribute_type type, size_t *position)
+{
+    if(index == NULL || position == NULL)
+    {
+        return(KMIP_FALSE);
+    }
+    
+    if((int)type < 0 || (int)type >= KMIP_ATTR_TYPE_COUNT)
+    {
+        return(KMIP_FALSE);
+    }
+    
+    if((index->present & ((uint64)1 << type)) == 0)
+    {
+        return(KMIP_FALSE);
+    }
+    
+    *position = index->first[type];
+    return(KMIP_TRUE);
+}
+
+void
+kmip_index_attributes(Attributes *value)
+{
+    if(value == NULL)
+    {
+        return;
+    }
+    
+    kmip_init_attribute_index(&value->index);
+    
+    /* Positions are 16 bits wide; larger collections stay unindexed. */
+    if(value->attribute_list.size > UINT16_MAX)
+    {
+        return;
+    }
+    
+    void *const *items = kmip_vector_begin(&value->attribute_list);
+    for(size_t i = 0; i < value->attribute_list.size; i++)
+    {
+        kmip_add_to_attribute_index(&value->index, (const Attribute *)items[i], i);
+    }
+    value->index.count = value->attribute_list.size;
+}
+
+void
+kmip_index_template_attribute(TemplateAttribute *value)
+{
+    if(value == NULL)
+    {
+        return;
+    }
+    
+    kmip_init_attribute_index(&value->index);
+    
+    if(value->attributes == NULL || value->attribute_count > UINT16_MAX)
+    {
+        return;
+    }
+    
+    for(size_t i = 0; i < value->attribute_count; i++)
+    {
+        kmip_add_to_attribute_index(&value->index, &value->attributes[i], i);
+    }
+    value->index.count = value->attribute_count;
+}
+
+/* NOTE (ph) The find functions return the given occurrence, counting  */
+/*      from zero, of an attribute type. The index gives the position  */
+/*      of the first occurrence directly; later ones are found by      */
+/*      scanning on from there, which only multi-instance attributes   */
+/*      such as Name or Link need. A hit is checked against the type   */
+/*      actually stored there, and falls back to a scan from the start */
+/*      if the slot was retyped, removed or moved away. A slot that    */
+/*      still holds the type after a reorder, with an earlier one now  */
+/*      ahead of it, passes the check, and a stale miss cannot be      */
+/*      detected at all. Any change to an indexed collection therefore */
+/*      needs its kmip_index_* call again.                             */
+
+const Attribute *
+kmip_find_attribute(const Attributes *value, enum attribute_type type, size_t index)
+{
+    if(value == NULL)
+    {
+        return(NULL);
+    }
+    
+    size_t count = value->attribute_list.size;
+    size_t start = 0;
+    if(value->index.count == count && count > 0)
+    {
+        if(!kmip_lookup_attribute_index(&value->index, type, &start))
+        {
+            return(NULL);
+        }
+    }
+    
+    void *const *items = kmip_vector_begin(&value->attribute_list);
+    if(start > 0 && (items[start] == NULL || ((const Attribute *)items[start])->type != type))
+    {
+        start = 0;
+    }
+    
+    for(size_t i = start; i < count; i++)
+    {
+        const Attribute *attribute = (const Attribute *)items[i];
+        if(attribute != NULL && attribute->type == type)
+        {
+            if(index == 0)
+            {
+                return(attribute);
+            }
+            index--;
+        }
+    }
+    
+    return(NULL);
+}
+
+const Attribute *
+kmip_find_template_attribute(const TemplateAttribute *value, enum attribute_type type, size_t index)
+{
+    if(value == NULL || value->attributes == NULL)
+    {
+        return(NULL);
+    }
+    
+    size_t count = value->attribute_count;
+    size_t start = 0;
+    if(value->index.count == count && count > 0)
+    {
+        if(!kmip_lookup_attribute_index(&value->index, type, &start))
+        {
+            return(NULL);
+        }
+    }
+    
+    if(start > 0 && value->attributes[start].type != type)
+    {
+        start = 0;
+    }
+    
+    for(size_t i = start; i < count; i++)
+    {
+        if(value->attributes[i].type == type)
+        {
+            if(index == 0)
+            {
+                return(&value->attributes[i]);
+            }
+            index--;
+        }
+    }
+    
+    return(NULL);
+}
+
+/* NOTE (ph) The load/store helpers move whole words through memcpy so */
+/* they are safe on unaligned buffers; compilers lower them to single  */
+/* loads/stores plus a byte swap on little-endian hosts.               */
+
+#if defined(__GNUC__) && defined(__BYTE_ORDER__)
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define KMIP_BSWAP32(A) __builtin_bswap32(A)
+#define KMIP_BSWAP64(A) __builtin_bswap64(A)
+#elif __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define KMIP_BSWAP32(A) (A)
+#define KMIP_BSWAP64(A) (A)
+#endif
+#endif
+
+uint32
+kmip_load_uint32_be(const uint8 *source)
+{
+#if defined(KMIP_BSWAP32)
+    uint32 value = 0;
+    memcpy(&value, source, sizeof(uint32));
+    return(KMIP_BSWAP32(value));
+#else
+    return(((uint32)source[0] << 24) |
+           ((uint32)source[1] << 16) |
+           ((uint32)source[2] << 8) |
+           ((uint32)source[3] << 0));
+#endif
+}
+
+uint64
+kmip_load_uint64_be(const uint8 *source)
+{
+#if defined(KMIP_BSWAP64)
+    uint64 value = 0;
+    memcpy(&value, source, sizeof(uint64));
+    return(KMIP_BSWAP64(value));
+#else
+    return(((uint64)kmip_load_uint32_be(source) << 32) |
+           ((uint64)kmip_load_uint32_be(source + 4) << 0));
+#endif
+}
+
+void
+kmip_store_uint32_be(uint8 *destination, uint32 value)
+{
+#if defined(KMIP_BSWAP32)
+    value = KMIP_BSWAP32(value);
+    memcpy(destination, &value, sizeof(uint32));
+#else
+    destination[0] = (uint8)(value >> 24);
+    destination[1] = (uint8)(value >> 16);
+    destination[2] = (uint8)(value >> 8);
+    destination[3] = (uint8)(value >> 0);
+#endif
+}
+
+void
+kmip_store_uint64_be(uint8 *destination, uint64 value)
+{
+#if defined(KMIP_BSWAP64)
+    value = KMIP_BSWAP64(value);
+    memcpy(destination, &value, sizeof(uint64));
+#else
+    kmip_store_uint32_be(destination, (uint32)(value >> 32));
+    kmip_store_uint32_be(destination + 4, (uint32)value);
+#endif
+}
+
+int
+kmip_is_zero_buffer(const uint8 *buffer, size_t size)
+{
+    uint64 accumulator = 0;
+    size_t i = 0;
+
+    for(; i + sizeof(uint64) <= size; i += sizeof(uint64))
+    {
+        uint64 word = 0;
+        memcpy(&word, buffer + i, sizeof(uint64));
+        accumulator |= word;
+    }
+    for(; i < size; i++)
+    {
+        accumulator |= buffer[i];
+    }
+
+    return(accumulator == 0 ? KMIP_TRUE : KMIP_FALSE);
+}
+
 /*
 Memory Handlers
 */
@@ -159,1728 +596,2993 @@ kmip_memcpy(void *state, void *destination, const void *source, size_t size)
     return(memcpy(destination, source, size));
 }
 
-/*
-Enumeration Utilities
-*/
+/* NOTE (ph) The arena hands out zeroed memory from large chunks and */
+/*      releases it all at once, wiping each chunk before it is      */
+/*      reused or freed. Each allocation is preceded by its rounded  */
+/*      size so it can be resized. Frees of arena memory do nothing; */
+/*      frees and reallocs of memory the arena does not own go to    */
+/*      the backing allocator, so a context can safely release       */
+/*      memory it allocated before the arena was installed.          */
 
-static const char *kmip_attribute_names[26] = {
-    "Attestation Type",
-    "BatchErrorContinuation Option",
-    "BlockCipher Mode",
-    "Credential Type",
-    "Cryptographic Algorithm",
-    "Cryptographic Usage Mask",
-    "DigitalSignature Algorithm",
-    "Encoding Option",
-    "Hashing Algorithm",
-    "Key Compression Type",
-    "Key Format Type",
-    "Key Role Type",
-    "Key Wrap Type",
-    "Mask Generator",
-    "Name Type",
-    "Object Type",
-    "Operation",
-    "Padding Method",
-    "Protection Storage Mask",
-    "Result Reason",
-    "Result Status",
-    "State",
-    "Tag", /*?*/
-    "Type", /*?*/
-    "Wrapping Method",
-    "Unknown" /* Catch all for unsupported enumerations */
-};
+#define KMIP_ARENA_ALIGNMENT (sizeof(size_t))
+#define KMIP_ARENA_ALIGN(A) \
+    (((A) + (KMIP_ARENA_ALIGNMENT - 1)) & ~(KMIP_ARENA_ALIGNMENT - 1))
+#define KMIP_ARENA_CHUNK_DATA(A) \
+    ((uint8 *)(A) + KMIP_ARENA_ALIGN(sizeof(KMIPArenaChunk)))
 
-int
-kmip_get_enum_string_index(enum tag t)
+void
+kmip_init_arena(KMIPArena *arena, size_t chunk_size)
 {
-    switch(t)
+    if(arena == NULL)
     {
-        case KMIP_TAG_ATTESTATION_TYPE:
-        return(0);
-        break;
-        
-        case KMIP_TAG_BATCH_ERROR_CONTINUATION_OPTION:
-        return(1);
-        break;
-        
-        case KMIP_TAG_BLOCK_CIPHER_MODE:
-        return(2);
-        break;
-        
-        case KMIP_TAG_CREDENTIAL_TYPE:
-        return(3);
-        break;
-        
-        case KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM:
-        return(4);
-        break;
-        
-        case KMIP_TAG_CRYPTOGRAPHIC_USAGE_MASK:
-        return(5);
-        break;
-        
-        case KMIP_TAG_DIGITAL_SIGNATURE_ALGORITHM:
-        return(6);
-        break;
-        
-        case KMIP_TAG_ENCODING_OPTION:
-        return(7);
-        break;
-        
-        case KMIP_TAG_HASHING_ALGORITHM:
-        return(8);
-        break;
-        
-        case KMIP_TAG_KEY_COMPRESSION_TYPE:
-        return(9);
-        break;
-        
-        case KMIP_TAG_KEY_FORMAT_TYPE:
-        return(10);
-        break;
-        
-        case KMIP_TAG_KEY_ROLE_TYPE:
-        return(11);
-        break;
-        
-        case KMIP_TAG_KEY_WRAP_TYPE:
-        return(12);
-        break;
-        
-        case KMIP_TAG_MASK_GENERATOR:
-        return(13);
-        break;
-        
-        case KMIP_TAG_NAME_TYPE:
-        return(14);
-        break;
-        
-        case KMIP_TAG_OBJECT_TYPE:
-        return(15);
-        break;
-        
-        case KMIP_TAG_OPERATION:
-        return(16);
-        break;
-        
-        case KMIP_TAG_PADDING_METHOD:
-        return(17);
-        break;
+        return;
+    }
+    
+    arena->chunks = NULL;
+    arena->last = NULL;
+    arena->chunk_size = (chunk_size > 0) ? chunk_size : 4096;
+    arena->secrets = NULL;
+    
+    arena->calloc_func = &kmip_calloc;
+    arena->realloc_func = &kmip_realloc;
+    arena->free_func = &kmip_free;
+    arena->memset_func = &kmip_memset;
+    arena->state = NULL;
+}
 
-        case KMIP_TAG_PROTECTION_STORAGE_MASK:
-        return(18);
-        break;
-        
-        case KMIP_TAG_RESULT_REASON:
-        return(19);
-        break;
-        
-        case KMIP_TAG_RESULT_STATUS:
-        return(20);
-        break;
-        
-        case KMIP_TAG_STATE:
-        return(21);
-        break;
-        
-        case KMIP_TAG_TAG:
-        return(22);
-        break;
-        
-        case KMIP_TAG_TYPE:
-        return(23);
-        break;
-        
-        case KMIP_TAG_WRAPPING_METHOD:
-        return(24);
-        break;
-        
-        default:
-        return(25);
-        break;
-    };
+void
+kmip_set_arena(KMIP *ctx, KMIPArena *arena)
+{
+    if(ctx == NULL || arena == NULL || ctx->calloc_func == &kmip_arena_calloc)
+    {
+        return;
+    }
+    
+    /* The context's current allocator becomes the backing allocator. */
+    if(ctx->calloc_func != NULL)
+    {
+        arena->calloc_func = ctx->calloc_func;
+        arena->realloc_func = ctx->realloc_func;
+        arena->free_func = ctx->free_func;
+        arena->state = ctx->state;
+    }
+    if(ctx->memset_func != NULL)
+    {
+        arena->memset_func = ctx->memset_func;
+    }
+    
+    ctx->calloc_func = &kmip_arena_calloc;
+    ctx->realloc_func = &kmip_arena_realloc;
+    ctx->free_func = &kmip_arena_free;
+    ctx->state = arena;
+}
+
+void
+kmip_unset_arena(KMIP *ctx)
+{
+    if(ctx == NULL || ctx->calloc_func != &kmip_arena_calloc)
+    {
+        return;
+    }
+    
+    KMIPArena *arena = (KMIPArena *)ctx->state;
+    
+    ctx->calloc_func = arena->calloc_func;
+    ctx->realloc_func = arena->realloc_func;
+    ctx->free_func = arena->free_func;
+    ctx->state = arena->state;
 }
 
 int
-kmip_check_enum_value(enum kmip_version version, enum tag t, int value)
+kmip_arena_owns(const KMIPArena *arena, const void *ptr)
 {
-    switch(t)
+    if(arena == NULL || ptr == NULL)
+    {
+        return(KMIP_FALSE);
+    }
+    
+    for(KMIPArenaChunk *chunk = arena->chunks; chunk != NULL; chunk = chunk->next)
     {
-        case KMIP_TAG_ATTESTATION_TYPE:
-        switch(value)
+        const uint8 *data = KMIP_ARENA_CHUNK_DATA(chunk);
+        if((const uint8 *)ptr >= data && (const uint8 *)ptr < data + chunk->size)
         {
-            case KMIP_ATTEST_TPM_QUOTE:
-            case KMIP_ATTEST_TCG_INTEGRITY_REPORT:
-            case KMIP_ATTEST_SAML_ASSERTION:
-            if(version >= KMIP_1_2)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-            
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
-        };
-        break;
-        
-        case KMIP_TAG_BATCH_ERROR_CONTINUATION_OPTION:
-        switch(value)
+            return(KMIP_TRUE);
+        }
+    }
+    
+    return(KMIP_FALSE);
+}
+
+void *
+kmip_arena_calloc(void *state, size_t num, size_t size)
+{
+    KMIPArena *arena = (KMIPArena *)state;
+    if(arena == NULL || (size != 0 && num > ((size_t)-1 - 2 * KMIP_ARENA_ALIGNMENT) / size))
+    {
+        return(NULL);
+    }
+    
+    size_t total = KMIP_ARENA_ALIGN(num * size) + KMIP_ARENA_ALIGNMENT;
+    
+    KMIPArenaChunk *chunk = arena->chunks;
+    if(chunk == NULL || chunk->size - chunk->used < total)
+    {
+        /* Chunks double in size so large messages need few of them. */
+        size_t data_size = (chunk != NULL) ? (chunk->size * 2) : arena->chunk_size;
+        if(data_size < total)
         {
-            case KMIP_BATCH_CONTINUE:
-            case KMIP_BATCH_STOP:
-            case KMIP_BATCH_UNDO:
-            return(KMIP_OK);
-            break;
-            
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
-        };
-        break;
+            data_size = total;
+        }
         
-        case KMIP_TAG_BLOCK_CIPHER_MODE:
-        switch(value)
-        {
-            case KMIP_BLOCK_CBC:
-            case KMIP_BLOCK_ECB:
-            case KMIP_BLOCK_PCBC:
-            case KMIP_BLOCK_CFB:
-            case KMIP_BLOCK_OFB:
-            case KMIP_BLOCK_CTR:
-            case KMIP_BLOCK_CMAC:
-            case KMIP_BLOCK_CCM:
-            case KMIP_BLOCK_GCM:
-            case KMIP_BLOCK_CBC_MAC:
-            case KMIP_BLOCK_XTS:
-            case KMIP_BLOCK_AES_KEY_WRAP_PADDING:
-            case KMIP_BLOCK_NIST_KEY_WRAP:
-            case KMIP_BLOCK_X9102_AESKW:
-            case KMIP_BLOCK_X9102_TDKW:
-            case KMIP_BLOCK_X9102_AKW1:
-            case KMIP_BLOCK_X9102_AKW2:
-            return(KMIP_OK);
-            break;
-            
-            case KMIP_BLOCK_AEAD:
-            if(version >= KMIP_1_4)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-            
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
-        };
-        break;
+        KMIPArenaChunk *grown = arena->calloc_func(arena->state, 1, KMIP_ARENA_ALIGN(sizeof(KMIPArenaChunk)) + data_size);
+        if(grown == NULL)
+        {
+            return(NULL);
+        }
         
-        case KMIP_TAG_CREDENTIAL_TYPE:
-        switch(value)
+        grown->next = chunk;
+        grown->size = data_size;
+        grown->used = 0;
+        arena->chunks = grown;
+        chunk = grown;
+    }
+    
+    uint8 *ptr = KMIP_ARENA_CHUNK_DATA(chunk) + chunk->used + KMIP_ARENA_ALIGNMENT;
+    *(size_t *)(ptr - KMIP_ARENA_ALIGNMENT) = total - KMIP_ARENA_ALIGNMENT;
+    chunk->used += total;
+    arena->last = ptr;
+    
+    return(ptr);
+}
+
+void *
+kmip_arena_realloc(void *state, void *ptr, size_t size)
+{
+    KMIPArena *arena = (KMIPArena *)state;
+    if(arena == NULL)
+    {
+        return(NULL);
+    }
+    
+    if(ptr == NULL)
+    {
+        return(kmip_arena_calloc(state, 1, size));
+    }
+    
+    if(!kmip_arena_owns(arena, ptr))
+    {
+        return(arena->realloc_func(arena->state, ptr, size));
+    }
+    
+    if(size > (size_t)-1 - 2 * KMIP_ARENA_ALIGNMENT)
+    {
+        return(NULL);
+    }
+    
+    size_t *header = (size_t *)((uint8 *)ptr - KMIP_ARENA_ALIGNMENT);
+    size_t old_size = *header;
+    size_t new_size = KMIP_ARENA_ALIGN(size);
+    
+    /* The most recent allocation can be resized in place. */
+    KMIPArenaChunk *chunk = arena->chunks;
+    if(ptr == arena->last)
+    {
+        size_t offset = (uint8 *)ptr - KMIP_ARENA_CHUNK_DATA(chunk);
+        if(new_size <= chunk->size - offset)
         {
-            case KMIP_CRED_USERNAME_AND_PASSWORD:
-            return(KMIP_OK);
-            break;
-            
-            case KMIP_CRED_DEVICE:
-            if(version >= KMIP_1_1)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
+            if(new_size < old_size)
+            {
+                arena->memset_func((uint8 *)ptr + new_size, 0, old_size - new_size);
+            }
+            chunk->used = offset + new_size;
+            *header = new_size;
             
-            case KMIP_CRED_ATTESTATION:
-            if(version >= KMIP_1_2)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
+            return(ptr);
+        }
+    }
+    else if(new_size <= old_size)
+    {
+        return(ptr);
+    }
+    
+    uint8 *moved = kmip_arena_calloc(state, 1, size);
+    if(moved != NULL)
+    {
+        memcpy(moved, ptr, (old_size < new_size) ? old_size : new_size);
+    }
+    
+    return(moved);
+}
 
-            /* KMIP 2.0 */
-            case KMIP_CRED_ONE_TIME_PASSWORD:
-            case KMIP_CRED_HASHED_PASSWORD:
-            case KMIP_CRED_TICKET:
-            if(version >= KMIP_2_0)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-            
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
-        };
-        break;
-        
-        case KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM:
-        switch(value)
-        {
-            case KMIP_CRYPTOALG_DES:
-            case KMIP_CRYPTOALG_TRIPLE_DES:
-            case KMIP_CRYPTOALG_AES:
-            case KMIP_CRYPTOALG_RSA:
-            case KMIP_CRYPTOALG_DSA:
-            case KMIP_CRYPTOALG_ECDSA:
-            case KMIP_CRYPTOALG_HMAC_SHA1:
-            case KMIP_CRYPTOALG_HMAC_SHA224:
-            case KMIP_CRYPTOALG_HMAC_SHA256:
-            case KMIP_CRYPTOALG_HMAC_SHA384:
-            case KMIP_CRYPTOALG_HMAC_SHA512:
-            case KMIP_CRYPTOALG_HMAC_MD5:
-            case KMIP_CRYPTOALG_DH:
-            case KMIP_CRYPTOALG_ECDH:
-            case KMIP_CRYPTOALG_ECMQV:
-            case KMIP_CRYPTOALG_BLOWFISH:
-            case KMIP_CRYPTOALG_CAMELLIA:
-            case KMIP_CRYPTOALG_CAST5:
-            case KMIP_CRYPTOALG_IDEA:
-            case KMIP_CRYPTOALG_MARS:
-            case KMIP_CRYPTOALG_RC2:
-            case KMIP_CRYPTOALG_RC4:
-            case KMIP_CRYPTOALG_RC5:
-            case KMIP_CRYPTOALG_SKIPJACK:
-            case KMIP_CRYPTOALG_TWOFISH:
-            return(KMIP_OK);
-            break;
-            
-            case KMIP_CRYPTOALG_EC:
-            if(version >= KMIP_1_2)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-            
-            case KMIP_CRYPTOALG_ONE_TIME_PAD:
-            if(version >= KMIP_1_3)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-            
-            case KMIP_CRYPTOALG_CHACHA20:
-            case KMIP_CRYPTOALG_POLY1305:
-            case KMIP_CRYPTOALG_CHACHA20_POLY1305:
-            case KMIP_CRYPTOALG_SHA3_224:
-            case KMIP_CRYPTOALG_SHA3_256:
-            case KMIP_CRYPTOALG_SHA3_384:
-            case KMIP_CRYPTOALG_SHA3_512:
-            case KMIP_CRYPTOALG_HMAC_SHA3_224:
-            case KMIP_CRYPTOALG_HMAC_SHA3_256:
-            case KMIP_CRYPTOALG_HMAC_SHA3_384:
-            case KMIP_CRYPTOALG_HMAC_SHA3_512:
-            case KMIP_CRYPTOALG_SHAKE_128:
-            case KMIP_CRYPTOALG_SHAKE_256:
-            if(version >= KMIP_1_4)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
+void
+kmip_arena_free(void *state, void *ptr)
+{
+    KMIPArena *arena = (KMIPArena *)state;
+    if(arena == NULL || ptr == NULL)
+    {
+        return;
+    }
+    
+    if(!kmip_arena_owns(arena, ptr))
+    {
+        arena->free_func(arena->state, ptr);
+    }
+    
+    return;
+}
 
-            /* KMIP 2.0 */
-            case KMIP_CRYPTOALG_ARIA:
-            case KMIP_CRYPTOALG_SEED:
-            case KMIP_CRYPTOALG_SM2:
-            case KMIP_CRYPTOALG_SM3:
-            case KMIP_CRYPTOALG_SM4:
-            case KMIP_CRYPTOALG_GOST_R_34_10_2012:
-            case KMIP_CRYPTOALG_GOST_R_34_11_2012:
-            case KMIP_CRYPTOALG_GOST_R_34_13_2015:
-            case KMIP_CRYPTOALG_GOST_28147_89:
-            case KMIP_CRYPTOALG_XMSS:
-            case KMIP_CRYPTOALG_SPHINCS_256:
-            case KMIP_CRYPTOALG_MCELIECE:
-            case KMIP_CRYPTOALG_MCELIECE_6960119:
-            case KMIP_CRYPTOALG_MCELIECE_8192128:
-            case KMIP_CRYPTOALG_ED25519:
-            case KMIP_CRYPTOALG_ED448:
-            if(version >= KMIP_2_0)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
+/* NOTE (ph) Secrets go to the secure heap even while an arena is    */
+/*      installed, so resetting the arena alone would leak them. The    */
+/*      arena keeps a list of the secure heap blocks the decoder hands  */
+/*      out through its context, with the list nodes in the arena. Each */
+/*      reset, including the one in kmip_free_arena, frees just those   */
+/*      blocks instead of walking the message, so the arena has to be   */
+/*      freed before the heap. A block freed on its own is dropped from */
+/*      the list.                                                       */
 
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
-        };
-        break;
-        
-        case KMIP_TAG_CRYPTOGRAPHIC_USAGE_MASK:
-        switch(value)
-        {
-            case KMIP_CRYPTOMASK_SIGN:
-            case KMIP_CRYPTOMASK_VERIFY:
-            case KMIP_CRYPTOMASK_ENCRYPT:
-            case KMIP_CRYPTOMASK_DECRYPT:
-            case KMIP_CRYPTOMASK_WRAP_KEY:
-            case KMIP_CRYPTOMASK_UNWRAP_KEY:
-            case KMIP_CRYPTOMASK_EXPORT:
-            case KMIP_CRYPTOMASK_MAC_GENERATE:
-            case KMIP_CRYPTOMASK_MAC_VERIFY:
-            case KMIP_CRYPTOMASK_DERIVE_KEY:
-            case KMIP_CRYPTOMASK_CONTENT_COMMITMENT:
-            case KMIP_CRYPTOMASK_KEY_AGREEMENT:
-            case KMIP_CRYPTOMASK_CERTIFICATE_SIGN:
-            case KMIP_CRYPTOMASK_CRL_SIGN:
-            case KMIP_CRYPTOMASK_GENERATE_CRYPTOGRAM:
-            case KMIP_CRYPTOMASK_VALIDATE_CRYPTOGRAM:
-            case KMIP_CRYPTOMASK_TRANSLATE_ENCRYPT:
-            case KMIP_CRYPTOMASK_TRANSLATE_DECRYPT:
-            case KMIP_CRYPTOMASK_TRANSLATE_WRAP:
-            case KMIP_CRYPTOMASK_TRANSLATE_UNWRAP:
-            return(KMIP_OK);
-            break;
+int
+kmip_add_arena_secret(KMIPArena *arena, KMIPSecureHeap *heap, void *ptr)
+{
+    if(arena == NULL || heap == NULL || ptr == NULL)
+    {
+        return(KMIP_ARG_INVALID);
+    }
+    
+    KMIPArenaSecret *secret = kmip_arena_calloc(arena, 1, sizeof(KMIPArenaSecret));
+    if(secret == NULL)
+    {
+        return(KMIP_MEMORY_ALLOC_FAILED);
+    }
+    
+    secret->ptr = ptr;
+    secret->heap = heap;
+    secret->next = arena->secrets;
+    arena->secrets = secret;
+    
+    return(KMIP_OK);
+}
 
-            /* KMIP 2.0 */
-            case KMIP_CRYPTOMASK_AUTHENTICATE:
-            case KMIP_CRYPTOMASK_UNRESTRICTED:
-            case KMIP_CRYPTOMASK_FPE_ENCRYPT:
-            case KMIP_CRYPTOMASK_FPE_DECRYPT:
-            if(version >= KMIP_2_0)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-            
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
-        };
-        break;
+void
+kmip_remove_arena_secret(KMIPArena *arena, const void *ptr)
+{
+    if(arena == NULL || ptr == NULL)
+    {
+        return;
+    }
+    
+    /* Secrets are usually freed newest first, near the list head. */
+    for(KMIPArenaSecret **link = &arena->secrets; *link != NULL; link = &(*link)->next)
+    {
+        if((*link)->ptr == ptr)
+        {
+            *link = (*link)->next;
+            return;
+        }
+    }
+}
+
+void
+kmip_release_arena_secrets(KMIPArena *arena)
+{
+    if(arena == NULL)
+    {
+        return;
+    }
+    
+    for(KMIPArenaSecret *secret = arena->secrets; secret != NULL; secret = secret->next)
+    {
+        kmip_secure_heap_free(secret->heap, secret->ptr);
+    }
+    arena->secrets = NULL;
+}
+
+void
+kmip_reset_arena(KMIPArena *arena)
+{
+    if(arena == NULL || arena->chunks == NULL)
+    {
+        return;
+    }
+    
+    /* The secret list lives in the chunks, so release it first. */
+    kmip_release_arena_secrets(arena);
+    
+    /* Keep the newest (largest) chunk for the next message. */
+    KMIPArenaChunk *kept = arena->chunks;
+    KMIPArenaChunk *chunk = kept->next;
+    while(chunk != NULL)
+    {
+        KMIPArenaChunk *next = chunk->next;
+        arena->memset_func(KMIP_ARENA_CHUNK_DATA(chunk), 0, chunk->used);
+        arena->free_func(arena->state, chunk);
+        chunk = next;
+    }
+    
+    arena->memset_func(KMIP_ARENA_CHUNK_DATA(kept), 0, kept->used);
+    kept->next = NULL;
+    kept->used = 0;
+    arena->last = NULL;
+}
+
+void
+kmip_free_arena(KMIPArena *arena)
+{
+    if(arena == NULL)
+    {
+        return;
+    }
+    
+    kmip_reset_arena(arena);
+    if(arena->chunks != NULL)
+    {
+        arena->free_func(arena->state, arena->chunks);
+        arena->chunks = NULL;
+    }
+}
+
+/* NOTE (ph) Pools recycle the small fixed-size nodes the decoder builds */
+/*      (strings, list items, attributes) through per-size-class free    */
+/*      lists carved out of slabs. The hooks only see sizes, so nodes    */
+/*      are grouped by rounded size rather than by type. Freed nodes are */
+/*      wiped before reuse; anything above KMIP_POOL_MAX_SIZE, and any   */
+/*      memory the pool does not own, goes to the backing allocator.    */
+/*      Pools are per context and are not thread-safe.                   */
+
+/* The 72 byte class fits a TextString with a full inline value. */
+static const size_t kmip_pool_class_sizes[KMIP_POOL_CLASS_COUNT] = {
+    16, 24, 32, 48, 72
+};
+
+/* Indexed by (size - 1) / 8 for sizes up to KMIP_POOL_MAX_SIZE. */
+static const uint8 kmip_pool_class_indices[KMIP_POOL_MAX_SIZE / 8] = {
+    0, 0, 1, 2, 3, 3, 4, 4, 4
+};
+
+#define KMIP_POOL_SLAB_DATA(A) \
+    ((uint8 *)(A) + KMIP_ARENA_ALIGN(sizeof(KMIPPoolSlab)))
+
+void
+kmip_init_pool(KMIPPool *pool)
+{
+    if(pool == NULL)
+    {
+        return;
+    }
+    
+    for(int i = 0; i < KMIP_POOL_CLASS_COUNT; i++)
+    {
+        pool->free_lists[i] = NULL;
+        pool->slabs[i] = NULL;
+        pool->stats[i] = (KMIPPoolStats){0};
+    }
+    pool->fallbacks = 0;
+    pool->low = NULL;
+    pool->high = NULL;
+    pool->pages = NULL;
+    pool->page_count = 0;
+    pool->page_capacity = 0;
+    
+    pool->calloc_func = &kmip_calloc;
+    pool->realloc_func = &kmip_realloc;
+    pool->free_func = &kmip_free;
+    pool->memset_func = &kmip_memset;
+    pool->state = NULL;
+}
+
+void
+kmip_set_pool(KMIP *ctx, KMIPPool *pool)
+{
+    if(ctx == NULL || pool == NULL || ctx->calloc_func == &kmip_pool_calloc)
+    {
+        return;
+    }
+    
+    /* The context's current allocator becomes the backing allocator. */
+    if(ctx->calloc_func != NULL)
+    {
+        pool->calloc_func = ctx->calloc_func;
+        pool->realloc_func = ctx->realloc_func;
+        pool->free_func = ctx->free_func;
+        pool->state = ctx->state;
+    }
+    if(ctx->memset_func != NULL)
+    {
+        pool->memset_func = ctx->memset_func;
+    }
+    
+    ctx->calloc_func = &kmip_pool_calloc;
+    ctx->realloc_func = &kmip_pool_realloc;
+    ctx->free_func = &kmip_pool_free;
+    ctx->state = pool;
+}
+
+void
+kmip_unset_pool(KMIP *ctx)
+{
+    if(ctx == NULL || ctx->calloc_func != &kmip_pool_calloc)
+    {
+        return;
+    }
+    
+    KMIPPool *pool = (KMIPPool *)ctx->state;
+    
+    ctx->calloc_func = pool->calloc_func;
+    ctx->realloc_func = pool->realloc_func;
+    ctx->free_func = pool->free_func;
+    ctx->state = pool->state;
+}
+
+size_t
+kmip_get_pool_class_size(size_t size)
+{
+    if(size == 0 || size > KMIP_POOL_MAX_SIZE)
+    {
+        return(0);
+    }
+    
+    return(kmip_pool_class_sizes[kmip_pool_class_indices[(size - 1) / 8]]);
+}
+
+/* NOTE (ph) Frees find the class of a pooled pointer through a table */
+/*      keyed by page number. Each slab adds an entry for every page    */
+/*      its items overlap, so a lookup probes a few entries whatever    */
+/*      the number of slabs. A page shared by two slabs has two entries; */
+/*      the probe checks each one's range. Entries are never removed,   */
+/*      as slabs live until the pool is freed.                          */
+
+size_t
+kmip_get_pool_page_slot(const KMIPPool *pool, uintptr_t page)
+{
+    uint64 hash = (uint64)page * 0x9E3779B97F4A7C15ULL;
+    
+    return((size_t)(hash >> 32) & (pool->page_capacity - 1));
+}
+
+int
+kmip_add_pool_pages(KMIPPool *pool, uint8 *data, int index)
+{
+    size_t size = kmip_pool_class_sizes[index] * KMIP_POOL_SLAB_ITEMS;
+    uintptr_t first = (uintptr_t)data >> KMIP_POOL_PAGE_SHIFT;
+    uintptr_t last = ((uintptr_t)data + size - 1) >> KMIP_POOL_PAGE_SHIFT;
+    size_t count = (size_t)(last - first) + 1;
+    
+    /* Keep the table at most half full so probes stay short. */
+    if((pool->page_count + count) * 2 > pool->page_capacity)
+    {
+        size_t capacity = (pool->page_capacity == 0) ? 64 : pool->page_capacity;
+        while((pool->page_count + count) * 2 > capacity)
+        {
+            capacity *= 2;
+        }
+    
+        KMIPPoolPage *pages = pool->calloc_func(pool->state, capacity, sizeof(KMIPPoolPage));
+        if(pages == NULL)
+        {
+            return(KMIP_MEMORY_ALLOC_FAILED);
+        }
+    
+        KMIPPoolPage *old_pages = pool->pages;
+        size_t old_capacity = pool->page_capacity;
+        pool->pages = pages;
+        pool->page_capacity = capacity;
+    
+        for(size_t i = 0; i < old_capacity; i++)
+        {
+            if(old_pages[i].data != NULL)
+            {
+                size_t slot = kmip_get_pool_page_slot(pool, old_pages[i].page);
+                while(pool->pages[slot].data != NULL)
+                {
+                    slot = (slot + 1) & (capacity - 1);
+                }
+                pool->pages[slot] = old_pages[i];
+            }
+        }
+    
+        if(old_pages != NULL)
+        {
+            pool->free_func(pool->state, old_pages);
+        }
+    }
+    
+    for(uintptr_t page = first; page <= last; page++)
+    {
+        size_t slot = kmip_get_pool_page_slot(pool, page);
+        while(pool->pages[slot].data != NULL)
+        {
+            slot = (slot + 1) & (pool->page_capacity - 1);
+        }
+        pool->pages[slot].page = page;
+        pool->pages[slot].data = data;
+        pool->pages[slot].index = index;
+        pool->page_count++;
+    }
+    
+    return(KMIP_OK);
+}
+
+int
+kmip_get_pool_class(const KMIPPool *pool, const void *ptr)
+{
+    if(pool == NULL || ptr == NULL)
+    {
+        return(KMIP_UNSET);
+    }
+    
+    const uint8 *p = (const uint8 *)ptr;
+    if(p < pool->low || p >= pool->high || pool->page_capacity == 0)
+    {
+        return(KMIP_UNSET);
+    }
+    
+    uintptr_t page = (uintptr_t)p >> KMIP_POOL_PAGE_SHIFT;
+    size_t slot = kmip_get_pool_page_slot(pool, page);
+    for(; pool->pages[slot].data != NULL; slot = (slot + 1) & (pool->page_capacity - 1))
+    {
+        const KMIPPoolPage *entry = &pool->pages[slot];
+        if(entry->page != page)
+        {
+            continue;
+        }
+    
+        size_t size = kmip_pool_class_sizes[entry->index] * KMIP_POOL_SLAB_ITEMS;
+        if(p >= entry->data && p < entry->data + size)
+        {
+            return(entry->index);
+        }
+    }
+    
+    return(KMIP_UNSET);
+}
+
+void *
+kmip_pool_calloc(void *state, size_t num, size_t size)
+{
+    KMIPPool *pool = (KMIPPool *)state;
+    if(pool == NULL || (size != 0 && num > (size_t)-1 / size))
+    {
+        return(NULL);
+    }
+    
+    size_t total = num * size;
+    if(total == 0 || total > KMIP_POOL_MAX_SIZE)
+    {
+        pool->fallbacks++;
+        return(pool->calloc_func(pool->state, num, size));
+    }
+    
+    int index = kmip_pool_class_indices[(total - 1) / 8];
+    KMIPPoolStats *stats = &pool->stats[index];
+    
+    if(pool->free_lists[index] == NULL)
+    {
+        size_t item_size = kmip_pool_class_sizes[index];
+        KMIPPoolSlab *slab = pool->calloc_func(
+            pool->state,
+            1,
+            KMIP_ARENA_ALIGN(sizeof(KMIPPoolSlab)) + item_size * KMIP_POOL_SLAB_ITEMS);
+        if(slab == NULL)
+        {
+            return(NULL);
+        }
         
-        case KMIP_TAG_DIGITAL_SIGNATURE_ALGORITHM:
-        switch(value)
-        {
-            case KMIP_DIGITAL_MD2_WITH_RSA:
-            case KMIP_DIGITAL_MD5_WITH_RSA:
-            case KMIP_DIGITAL_SHA1_WITH_RSA:
-            case KMIP_DIGITAL_SHA224_WITH_RSA:
-            case KMIP_DIGITAL_SHA256_WITH_RSA:
-            case KMIP_DIGITAL_SHA384_WITH_RSA:
-            case KMIP_DIGITAL_SHA512_WITH_RSA:
-            case KMIP_DIGITAL_RSASSA_PSS:
-            case KMIP_DIGITAL_DSA_WITH_SHA1:
-            case KMIP_DIGITAL_DSA_WITH_SHA224:
-            case KMIP_DIGITAL_DSA_WITH_SHA256:
-            case KMIP_DIGITAL_ECDSA_WITH_SHA1:
-            case KMIP_DIGITAL_ECDSA_WITH_SHA224:
-            case KMIP_DIGITAL_ECDSA_WITH_SHA256:
-            case KMIP_DIGITAL_ECDSA_WITH_SHA384:
-            case KMIP_DIGITAL_ECDSA_WITH_SHA512:
-            if(version >= KMIP_1_1)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-            
-            case KMIP_DIGITAL_SHA3_256_WITH_RSA:
-            case KMIP_DIGITAL_SHA3_384_WITH_RSA:
-            case KMIP_DIGITAL_SHA3_512_WITH_RSA:
-            if(version >= KMIP_1_4)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-            
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
-        };
-        break;
+        uint8 *data = KMIP_POOL_SLAB_DATA(slab);
+        if(kmip_add_pool_pages(pool, data, index) != KMIP_OK)
+        {
+            pool->free_func(pool->state, slab);
+            return(NULL);
+        }
         
-        case KMIP_TAG_ENCODING_OPTION:
-        switch(value)
+        slab->next = pool->slabs[index];
+        pool->slabs[index] = slab;
+        
+        /* Thread the new items onto the free list, first item on top. */
+        for(size_t i = KMIP_POOL_SLAB_ITEMS; i > 0; i--)
         {
-            case KMIP_ENCODE_NO_ENCODING:
-            case KMIP_ENCODE_TTLV_ENCODING:
-            if(version >= KMIP_1_1)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-            
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
-        };
-        break;
-
-        case KMIP_TAG_HASHING_ALGORITHM:
-        switch(value)
-        {
-            case KMIP_HASH_MD2:
-            case KMIP_HASH_MD4:
-            case KMIP_HASH_MD5:
-            case KMIP_HASH_SHA1:
-            case KMIP_HASH_SHA224:
-            case KMIP_HASH_SHA256:
-            case KMIP_HASH_SHA384:
-            case KMIP_HASH_SHA512:
-            case KMIP_HASH_RIPEMD160:
-            case KMIP_HASH_TIGER:
-            case KMIP_HASH_WHIRLPOOL:
-            return(KMIP_OK);
-            break;
-            
-            case KMIP_HASH_SHA512_224:
-            case KMIP_HASH_SHA512_256:
-            if(version >= KMIP_1_2)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-            
-            case KMIP_HASH_SHA3_224:
-            case KMIP_HASH_SHA3_256:
-            case KMIP_HASH_SHA3_384:
-            case KMIP_HASH_SHA3_512:
-            if(version >= KMIP_1_4)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-            
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
-        };
-        break;
+            void **item = (void **)(data + (i - 1) * item_size);
+            *item = pool->free_lists[index];
+            pool->free_lists[index] = item;
+        }
         
-        case KMIP_TAG_KEY_COMPRESSION_TYPE:
-        switch(value)
+        if(pool->low == NULL || data < pool->low)
         {
-            case KMIP_KEYCOMP_EC_PUB_UNCOMPRESSED:
-            case KMIP_KEYCOMP_EC_PUB_X962_COMPRESSED_PRIME:
-            case KMIP_KEYCOMP_EC_PUB_X962_COMPRESSED_CHAR2:
-            case KMIP_KEYCOMP_EC_PUB_X962_HYBRID:
-            return(KMIP_OK);
-            break;
-            
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
-        };
-        break;
+            pool->low = data;
+        }
+        if(data + item_size * KMIP_POOL_SLAB_ITEMS > pool->high)
+        {
+            pool->high = data + item_size * KMIP_POOL_SLAB_ITEMS;
+        }
         
-        case KMIP_TAG_KEY_FORMAT_TYPE:
-        switch(value)
-        {
-            case KMIP_KEYFORMAT_RAW:
-            case KMIP_KEYFORMAT_OPAQUE:
-            case KMIP_KEYFORMAT_PKCS1:
-            case KMIP_KEYFORMAT_PKCS8:
-            case KMIP_KEYFORMAT_X509:
-            case KMIP_KEYFORMAT_EC_PRIVATE_KEY:
-            case KMIP_KEYFORMAT_TRANS_SYMMETRIC_KEY:
-            case KMIP_KEYFORMAT_TRANS_DSA_PRIVATE_KEY:
-            case KMIP_KEYFORMAT_TRANS_DSA_PUBLIC_KEY:
-            case KMIP_KEYFORMAT_TRANS_RSA_PRIVATE_KEY:
-            case KMIP_KEYFORMAT_TRANS_RSA_PUBLIC_KEY:
-            case KMIP_KEYFORMAT_TRANS_DH_PRIVATE_KEY:
-            case KMIP_KEYFORMAT_TRANS_DH_PUBLIC_KEY:
-            return(KMIP_OK);
-            break;
-            
-            /* The following set is deprecated as of KMIP 1.3 */
-            case KMIP_KEYFORMAT_TRANS_ECDSA_PRIVATE_KEY:
-            case KMIP_KEYFORMAT_TRANS_ECDSA_PUBLIC_KEY:
-            case KMIP_KEYFORMAT_TRANS_ECDH_PRIVATE_KEY:
-            case KMIP_KEYFORMAT_TRANS_ECDH_PUBLIC_KEY:
-            case KMIP_KEYFORMAT_TRANS_ECMQV_PRIVATE_KEY:
-            case KMIP_KEYFORMAT_TRANS_ECMQV_PUBLIC_KEY:
-            /* TODO (ph) What should happen if version >= 1.3? */
-            return(KMIP_OK);
-            break;
-            
-            case KMIP_KEYFORMAT_TRANS_EC_PRIVATE_KEY:
-            case KMIP_KEYFORMAT_TRANS_EC_PUBLIC_KEY:
-            if(version >= KMIP_1_3)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-            
-            case KMIP_KEYFORMAT_PKCS12:
-            if(version >= KMIP_1_4)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
+        stats->misses++;
+    }
+    else
+    {
+        stats->hits++;
+    }
+    
+    /* Free items are wiped on release; only the link needs clearing. */
+    void **item = (void **)pool->free_lists[index];
+    pool->free_lists[index] = *item;
+    *item = NULL;
+    
+    stats->in_use++;
+    if(stats->in_use > stats->peak)
+    {
+        stats->peak = stats->in_use;
+    }
+    
+    return(item);
+}
+
+void *
+kmip_pool_realloc(void *state, void *ptr, size_t size)
+{
+    KMIPPool *pool = (KMIPPool *)state;
+    if(pool == NULL)
+    {
+        return(NULL);
+    }
+    
+    if(ptr == NULL)
+    {
+        return(kmip_pool_calloc(state, 1, size));
+    }
+    
+    int index = kmip_get_pool_class(pool, ptr);
+    if(index == KMIP_UNSET)
+    {
+        return(pool->realloc_func(pool->state, ptr, size));
+    }
+    
+    size_t item_size = kmip_pool_class_sizes[index];
+    if(size != 0 && size <= item_size)
+    {
+        return(ptr);
+    }
+    
+    void *moved = kmip_pool_calloc(state, 1, size);
+    if(moved != NULL)
+    {
+        memcpy(moved, ptr, (size < item_size) ? size : item_size);
+        kmip_pool_free(state, ptr);
+    }
+    
+    return(moved);
+}
+
+void
+kmip_pool_free(void *state, void *ptr)
+{
+    KMIPPool *pool = (KMIPPool *)state;
+    if(pool == NULL || ptr == NULL)
+    {
+        return;
+    }
+    
+    int index = kmip_get_pool_class(pool, ptr);
+    if(index == KMIP_UNSET)
+    {
+        pool->free_func(pool->state, ptr);
+        return;
+    }
+    
+    pool->memset_func(ptr, 0, kmip_pool_class_sizes[index]);
+    *(void **)ptr = pool->free_lists[index];
+    pool->free_lists[index] = ptr;
+    
+    pool->stats[index].frees++;
+    pool->stats[index].in_use--;
+    
+    return;
+}
+
+void
+kmip_free_pool(KMIPPool *pool)
+{
+    if(pool == NULL)
+    {
+        return;
+    }
+    
+    for(int i = 0; i < KMIP_POOL_CLASS_COUNT; i++)
+    {
+        size_t slab_size = KMIP_ARENA_ALIGN(sizeof(KMIPPoolSlab)) + kmip_pool_class_sizes[i] * KMIP_POOL_SLAB_ITEMS;
+        KMIPPoolSlab *slab = pool->slabs[i];
+        while(slab != NULL)
+        {
+            KMIPPoolSlab *next = slab->next;
+            pool->memset_func(slab, 0, slab_size);
+            pool->free_func(pool->state, slab);
+            slab = next;
+        }
+        
+        pool->free_lists[i] = NULL;
+        pool->slabs[i] = NULL;
+    }
+    pool->low = NULL;
+    pool->high = NULL;
+    
+    if(pool->pages != NULL)
+    {
+        pool->free_func(pool->state, pool->pages);
+        pool->pages = NULL;
+    }
+    pool->page_count = 0;
+    pool->page_capacity = 0;
+}
+
+/* NOTE (ph) Secret-bearing values are allocated from the context's */
+/*      secure heap when one is set; otherwise they use the regular */
+/*      hooks. Frees are routed by address, so values allocated     */
+/*      before the heap was set are still released correctly.       */
+/*      kmip_calloc_secret is for values owned by a decoded message; */
+/*      under an arena they are recorded as its secrets.             */
+/*                                                                   */
+/*      Only sensitive values are wiped before they are released;   */
+/*      build with KMIP_WIPE_ALL defined to wipe every value.       */
+
+#if defined(KMIP_WIPE_ALL)
+#define KMIP_WIPE_ALL_VALUES (KMIP_TRUE)
+#else
+#define KMIP_WIPE_ALL_VALUES (KMIP_FALSE)
+#endif
+
+void *
+kmip_calloc_secret(KMIP *ctx, size_t num, size_t size)
+{
+    if(ctx == NULL)
+    {
+        return(NULL);
+    }
+    
+    if(ctx->secure_heap != NULL)
+    {
+        void *ptr = kmip_secure_heap_calloc(ctx->secure_heap, num, size);
+        if(ptr != NULL && ctx->free_func == &kmip_arena_free)
+        {
+            if(kmip_add_arena_secret((KMIPArena *)ctx->state, ctx->secure_heap, ptr) != KMIP_OK)
+            {
+                kmip_secure_heap_free(ctx->secure_heap, ptr);
+                return(NULL);
+            }
+        }
+        
+        return(ptr);
+    }
+    
+    return(ctx->calloc_func(ctx->state, num, size));
+}
+
+/* NOTE (ph) Values that outlive the current message, such as flat  */
+/*      clones, must not come from an installed arena or be recorded */
+/*      as its secrets, or the next reset would wipe them. They are  */
+/*      allocated from the secure heap when sensitive, and otherwise */
+/*      from the allocator the arena was installed over. They are    */
+/*      freed as usual, since the arena forwards foreign pointers.   */
+
+void *
+kmip_calloc_detached(KMIP *ctx, size_t num, size_t size, bool32 sensitive)
+{
+    if(ctx == NULL)
+    {
+        return(NULL);
+    }
+    
+    if(sensitive && ctx->secure_heap != NULL)
+    {
+        return(kmip_secure_heap_calloc(ctx->secure_heap, num, size));
+    }
+    
+    if(ctx->free_func == &kmip_arena_free)
+    {
+        KMIPArena *arena = (KMIPArena *)ctx->state;
+        return(arena->calloc_func(arena->state, num, size));
+    }
+    
+    return(ctx->calloc_func(ctx->state, num, size));
+}
+
+void
+kmip_free_memory(KMIP *ctx, void *ptr, size_t size, bool32 sensitive)
+{
+    if(ctx == NULL || ptr == NULL)
+    {
+        return;
+    }
+    
+    if(kmip_secure_heap_owns(ctx->secure_heap, ptr))
+    {
+        if(ctx->free_func == &kmip_arena_free)
+        {
+            kmip_remove_arena_secret((KMIPArena *)ctx->state, ptr);
+        }
+        kmip_secure_heap_free(ctx->secure_heap, ptr);
+        return;
+    }
+    
+    if(sensitive || KMIP_WIPE_ALL_VALUES)
+    {
+        ctx->memset_func(ptr, 0, size);
+    }
+    ctx->free_func(ctx->state, ptr);
+    
+    return;
+}
+
+void
+kmip_free_secret(KMIP *ctx, void *ptr, size_t size)
+{
+    kmip_free_memory(ctx, ptr, size, KMIP_TRUE);
+    
+    return;
+}
+
+/*
+Enumeration Utilities
+*/
+
+static const char *kmip_attribute_names[26] = {
+    "Attestation Type",
+    "BatchErrorContinuation Option",
+    "BlockCipher Mode",
+    "Credential Type",
+    "Cryptographic Algorithm",
+    "Cryptographic Usage Mask",
+    "DigitalSignature Algorithm",
+    "Encoding Option",
+    "Hashing Algorithm",
+    "Key Compression Type",
+    "Key Format Type",
+    "Key Role Type",
+    "Key Wrap Type",
+    "Mask Generator",
+    "Name Type",
+    "Object Type",
+    "Operation",
+    "Padding Method",
+    "Protection Storage Mask",
+    "Result Reason",
+    "Result Status",
+    "State",
+    "Tag", /*?*/
+    "Type", /*?*/
+    "Wrapping Method",
+    "Unknown" /* Catch all for unsupported enumerations */
+};
+
+/* NOTE (ph) KMIP tags all share the 0x42 prefix, so the classification */
+/*      tables below are indexed by the low 16 bits of the tag. Only the  */
+/*      range that holds defined tags is stored; anything outside of it   */
+/*      is not an attribute and has no enumeration name.                  */
+
+#define KMIP_TAG_TABLE_SIZE (0x0200)
+#define KMIP_TAG_TABLE_INDEX(A) ((uint32)(A) & 0xFFFF)
+#define KMIP_IS_TABLE_TAG(A) \
+    ((((uint32)(A) >> 16) == 0x42) && (KMIP_TAG_TABLE_INDEX(A) < KMIP_TAG_TABLE_SIZE))
+
+/* Entries hold the kmip_attribute_names index plus one; zero is Unknown. */
+static const uint8 kmip_enum_string_indices[KMIP_TAG_TABLE_SIZE] = {
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_ATTESTATION_TYPE)]                = 1,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_BATCH_ERROR_CONTINUATION_OPTION)] = 2,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_BLOCK_CIPHER_MODE)]               = 3,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_CREDENTIAL_TYPE)]                 = 4,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM)]         = 5,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_CRYPTOGRAPHIC_USAGE_MASK)]        = 6,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_DIGITAL_SIGNATURE_ALGORITHM)]     = 7,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_ENCODING_OPTION)]                 = 8,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_HASHING_ALGORITHM)]               = 9,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_KEY_COMPRESSION_TYPE)]            = 10,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_KEY_FORMAT_TYPE)]                 = 11,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_KEY_ROLE_TYPE)]                   = 12,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_KEY_WRAP_TYPE)]                   = 13,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_MASK_GENERATOR)]                  = 14,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_NAME_TYPE)]                       = 15,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_OBJECT_TYPE)]                     = 16,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_OPERATION)]                       = 17,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_PADDING_METHOD)]                  = 18,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_PROTECTION_STORAGE_MASK)]         = 19,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_RESULT_REASON)]                   = 20,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_RESULT_STATUS)]                   = 21,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_STATE)]                           = 22,
+    [KMIP_TAG_TABLE_INDEX(KMIP_TAG_WRAPPING_METHOD)]                 = 25
+};
+
+/* Attribute tags are kept in a bitset, one bit per tag. Add new KMIP 2.0 */
+/* attribute tags to KMIP_ATTRIBUTE_TAG_WORD; the words are built from it. */
+
+#define KMIP_TAG_WORD_BIT(A, W) \
+    ((KMIP_TAG_TABLE_INDEX(A) >> 5) == (W) ? (uint32)1 << (KMIP_TAG_TABLE_INDEX(A) & 0x1F) : 0)
+
+#define KMIP_ATTRIBUTE_TAG_WORD(W)                                 \
+    (KMIP_TAG_WORD_BIT(KMIP_TAG_UNIQUE_IDENTIFIER, W)               | \
+     KMIP_TAG_WORD_BIT(KMIP_TAG_NAME, W)                            | \
+     KMIP_TAG_WORD_BIT(KMIP_TAG_OBJECT_TYPE, W)                     | \
+     KMIP_TAG_WORD_BIT(KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM, W)         | \
+     KMIP_TAG_WORD_BIT(KMIP_TAG_CRYPTOGRAPHIC_LENGTH, W)            | \
+     KMIP_TAG_WORD_BIT(KMIP_TAG_OPERATION_POLICY_NAME, W)           | \
+     KMIP_TAG_WORD_BIT(KMIP_TAG_CRYPTOGRAPHIC_USAGE_MASK, W)        | \
+     KMIP_TAG_WORD_BIT(KMIP_TAG_STATE, W)                           | \
+     KMIP_TAG_WORD_BIT(KMIP_TAG_APPLICATION_SPECIFIC_INFORMATION, W))
+
+static const uint32 kmip_attribute_tag_bits[KMIP_TAG_TABLE_SIZE / 32] = {
+    KMIP_ATTRIBUTE_TAG_WORD(0),  KMIP_ATTRIBUTE_TAG_WORD(1),
+    KMIP_ATTRIBUTE_TAG_WORD(2),  KMIP_ATTRIBUTE_TAG_WORD(3),
+    KMIP_ATTRIBUTE_TAG_WORD(4),  KMIP_ATTRIBUTE_TAG_WORD(5),
+    KMIP_ATTRIBUTE_TAG_WORD(6),  KMIP_ATTRIBUTE_TAG_WORD(7),
+    KMIP_ATTRIBUTE_TAG_WORD(8),  KMIP_ATTRIBUTE_TAG_WORD(9),
+    KMIP_ATTRIBUTE_TAG_WORD(10), KMIP_ATTRIBUTE_TAG_WORD(11),
+    KMIP_ATTRIBUTE_TAG_WORD(12), KMIP_ATTRIBUTE_TAG_WORD(13),
+    KMIP_ATTRIBUTE_TAG_WORD(14), KMIP_ATTRIBUTE_TAG_WORD(15)
+};
+
+int
+kmip_get_enum_string_index(enum tag t)
+{
+    /* NOTE (ph) Tag and Type sit outside the 0x42 range. */
+    if(t == KMIP_TAG_TAG)
+    {
+        return(22);
+    }
+    if(t == KMIP_TAG_TYPE)
+    {
+        return(23);
+    }
+    
+    if(KMIP_IS_TABLE_TAG(t))
+    {
+        uint8 index = kmip_enum_string_indices[KMIP_TAG_TABLE_INDEX(t)];
+        if(index != 0)
+        {
+            return(index - 1);
+        }
+    }
+    
+    return(25);
+}
+
+/* NOTE (ph) Enumeration validity is table driven. Each enumeration has a */
+/*      table indexed by value holding the first KMIP version that defines */
+/*      the value plus one (zero marks an undefined value). Mask-valued    */
+/*      enumerations instead keep one bitset per KMIP version. The tables  */
+/*      are indexed in the same order as kmip_attribute_names.             */
+
+#define KMIP_SINCE(A) ((uint8)((A) + 1))
+
+static const uint8 kmip_attestation_type_versions[KMIP_ATTEST_SAML_ASSERTION + 1] = {
+    [KMIP_ATTEST_TPM_QUOTE]            = KMIP_SINCE(KMIP_1_2),
+    [KMIP_ATTEST_TCG_INTEGRITY_REPORT] = KMIP_SINCE(KMIP_1_2),
+    [KMIP_ATTEST_SAML_ASSERTION]       = KMIP_SINCE(KMIP_1_2)
+};
+
+static const uint8 kmip_batch_error_continuation_option_versions[KMIP_BATCH_UNDO + 1] = {
+    [KMIP_BATCH_CONTINUE] = KMIP_SINCE(KMIP_1_0),
+    [KMIP_BATCH_STOP]     = KMIP_SINCE(KMIP_1_0),
+    [KMIP_BATCH_UNDO]     = KMIP_SINCE(KMIP_1_0)
+};
+
+static const uint8 kmip_block_cipher_mode_versions[KMIP_BLOCK_AEAD + 1] = {
+    [KMIP_BLOCK_CBC]                  = KMIP_SINCE(KMIP_1_0),
+    [KMIP_BLOCK_ECB]                  = KMIP_SINCE(KMIP_1_0),
+    [KMIP_BLOCK_PCBC]                 = KMIP_SINCE(KMIP_1_0),
+    [KMIP_BLOCK_CFB]                  = KMIP_SINCE(KMIP_1_0),
+    [KMIP_BLOCK_OFB]                  = KMIP_SINCE(KMIP_1_0),
+    [KMIP_BLOCK_CTR]                  = KMIP_SINCE(KMIP_1_0),
+    [KMIP_BLOCK_CMAC]                 = KMIP_SINCE(KMIP_1_0),
+    [KMIP_BLOCK_CCM]                  = KMIP_SINCE(KMIP_1_0),
+    [KMIP_BLOCK_GCM]                  = KMIP_SINCE(KMIP_1_0),
+    [KMIP_BLOCK_CBC_MAC]              = KMIP_SINCE(KMIP_1_0),
+    [KMIP_BLOCK_XTS]                  = KMIP_SINCE(KMIP_1_0),
+    [KMIP_BLOCK_AES_KEY_WRAP_PADDING] = KMIP_SINCE(KMIP_1_0),
+    [KMIP_BLOCK_NIST_KEY_WRAP]        = KMIP_SINCE(KMIP_1_0),
+    [KMIP_BLOCK_X9102_AESKW]          = KMIP_SINCE(KMIP_1_0),
+    [KMIP_BLOCK_X9102_TDKW]           = KMIP_SINCE(KMIP_1_0),
+    [KMIP_BLOCK_X9102_AKW1]           = KMIP_SINCE(KMIP_1_0),
+    [KMIP_BLOCK_X9102_AKW2]           = KMIP_SINCE(KMIP_1_0),
+    [KMIP_BLOCK_AEAD]                 = KMIP_SINCE(KMIP_1_4)
+};
+
+static const uint8 kmip_credential_type_versions[KMIP_CRED_TICKET + 1] = {
+    [KMIP_CRED_USERNAME_AND_PASSWORD] = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRED_DEVICE]                = KMIP_SINCE(KMIP_1_1),
+    [KMIP_CRED_ATTESTATION]           = KMIP_SINCE(KMIP_1_2),
+    [KMIP_CRED_ONE_TIME_PASSWORD]     = KMIP_SINCE(KMIP_2_0),
+    [KMIP_CRED_HASHED_PASSWORD]       = KMIP_SINCE(KMIP_2_0),
+    [KMIP_CRED_TICKET]                = KMIP_SINCE(KMIP_2_0)
+};
+
+static const uint8 kmip_cryptographic_algorithm_versions[KMIP_CRYPTOALG_ED448 + 1] = {
+    [KMIP_CRYPTOALG_DES]               = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_TRIPLE_DES]        = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_AES]               = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_RSA]               = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_DSA]               = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_ECDSA]             = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_HMAC_SHA1]         = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_HMAC_SHA224]       = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_HMAC_SHA256]       = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_HMAC_SHA384]       = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_HMAC_SHA512]       = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_HMAC_MD5]          = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_DH]                = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_ECDH]              = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_ECMQV]             = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_BLOWFISH]          = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_CAMELLIA]          = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_CAST5]             = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_IDEA]              = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_MARS]              = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_RC2]               = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_RC4]               = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_RC5]               = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_SKIPJACK]          = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_TWOFISH]           = KMIP_SINCE(KMIP_1_0),
+    [KMIP_CRYPTOALG_EC]                = KMIP_SINCE(KMIP_1_2),
+    [KMIP_CRYPTOALG_ONE_TIME_PAD]      = KMIP_SINCE(KMIP_1_3),
+    [KMIP_CRYPTOALG_CHACHA20]          = KMIP_SINCE(KMIP_1_4),
+    [KMIP_CRYPTOALG_POLY1305]          = KMIP_SINCE(KMIP_1_4),
+    [KMIP_CRYPTOALG_CHACHA20_POLY1305] = KMIP_SINCE(KMIP_1_4),
+    [KMIP_CRYPTOALG_SHA3_224]          = KMIP_SINCE(KMIP_1_4),
+    [KMIP_CRYPTOALG_SHA3_256]          = KMIP_SINCE(KMIP_1_4),
+    [KMIP_CRYPTOALG_SHA3_384]          = KMIP_SINCE(KMIP_1_4),
+    [KMIP_CRYPTOALG_SHA3_512]          = KMIP_SINCE(KMIP_1_4),
+    [KMIP_CRYPTOALG_HMAC_SHA3_224]     = KMIP_SINCE(KMIP_1_4),
+    [KMIP_CRYPTOALG_HMAC_SHA3_256]     = KMIP_SINCE(KMIP_1_4),
+    [KMIP_CRYPTOALG_HMAC_SHA3_384]     = KMIP_SINCE(KMIP_1_4),
+    [KMIP_CRYPTOALG_HMAC_SHA3_512]     = KMIP_SINCE(KMIP_1_4),
+    [KMIP_CRYPTOALG_SHAKE_128]         = KMIP_SINCE(KMIP_1_4),
+    [KMIP_CRYPTOALG_SHAKE_256]         = KMIP_SINCE(KMIP_1_4),
+    [KMIP_CRYPTOALG_ARIA]              = KMIP_SINCE(KMIP_2_0),
+    [KMIP_CRYPTOALG_SEED]              = KMIP_SINCE(KMIP_2_0),
+    [KMIP_CRYPTOALG_SM2]               = KMIP_SINCE(KMIP_2_0),
+    [KMIP_CRYPTOALG_SM3]               = KMIP_SINCE(KMIP_2_0),
+    [KMIP_CRYPTOALG_SM4]               = KMIP_SINCE(KMIP_2_0),
+    [KMIP_CRYPTOALG_GOST_R_34_10_2012] = KMIP_SINCE(KMIP_2_0),
+    [KMIP_CRYPTOALG_GOST_R_34_11_2012] = KMIP_SINCE(KMIP_2_0),
+    [KMIP_CRYPTOALG_GOST_R_34_13_2015] = KMIP_SINCE(KMIP_2_0),
+    [KMIP_CRYPTOALG_GOST_28147_89]     = KMIP_SINCE(KMIP_2_0),
+    [KMIP_CRYPTOALG_XMSS]              = KMIP_SINCE(KMIP_2_0),
+    [KMIP_CRYPTOALG_SPHINCS_256]       = KMIP_SINCE(KMIP_2_0),
+    [KMIP_CRYPTOALG_MCELIECE]          = KMIP_SINCE(KMIP_2_0),
+    [KMIP_CRYPTOALG_MCELIECE_6960119]  = KMIP_SINCE(KMIP_2_0),
+    [KMIP_CRYPTOALG_MCELIECE_8192128]  = KMIP_SINCE(KMIP_2_0),
+    [KMIP_CRYPTOALG_ED25519]           = KMIP_SINCE(KMIP_2_0),
+    [KMIP_CRYPTOALG_ED448]             = KMIP_SINCE(KMIP_2_0)
+};
+
+static const uint8 kmip_digital_signature_algorithm_versions[KMIP_DIGITAL_SHA3_512_WITH_RSA + 1] = {
+    [KMIP_DIGITAL_MD2_WITH_RSA]      = KMIP_SINCE(KMIP_1_1),
+    [KMIP_DIGITAL_MD5_WITH_RSA]      = KMIP_SINCE(KMIP_1_1),
+    [KMIP_DIGITAL_SHA1_WITH_RSA]     = KMIP_SINCE(KMIP_1_1),
+    [KMIP_DIGITAL_SHA224_WITH_RSA]   = KMIP_SINCE(KMIP_1_1),
+    [KMIP_DIGITAL_SHA256_WITH_RSA]   = KMIP_SINCE(KMIP_1_1),
+    [KMIP_DIGITAL_SHA384_WITH_RSA]   = KMIP_SINCE(KMIP_1_1),
+    [KMIP_DIGITAL_SHA512_WITH_RSA]   = KMIP_SINCE(KMIP_1_1),
+    [KMIP_DIGITAL_RSASSA_PSS]        = KMIP_SINCE(KMIP_1_1),
+    [KMIP_DIGITAL_DSA_WITH_SHA1]     = KMIP_SINCE(KMIP_1_1),
+    [KMIP_DIGITAL_DSA_WITH_SHA224]   = KMIP_SINCE(KMIP_1_1),
+    [KMIP_DIGITAL_DSA_WITH_SHA256]   = KMIP_SINCE(KMIP_1_1),
+    [KMIP_DIGITAL_ECDSA_WITH_SHA1]   = KMIP_SINCE(KMIP_1_1),
+    [KMIP_DIGITAL_ECDSA_WITH_SHA224] = KMIP_SINCE(KMIP_1_1),
+    [KMIP_DIGITAL_ECDSA_WITH_SHA256] = KMIP_SINCE(KMIP_1_1),
+    [KMIP_DIGITAL_ECDSA_WITH_SHA384] = KMIP_SINCE(KMIP_1_1),
+    [KMIP_DIGITAL_ECDSA_WITH_SHA512] = KMIP_SINCE(KMIP_1_1),
+    [KMIP_DIGITAL_SHA3_256_WITH_RSA] = KMIP_SINCE(KMIP_1_4),
+    [KMIP_DIGITAL_SHA3_384_WITH_RSA] = KMIP_SINCE(KMIP_1_4),
+    [KMIP_DIGITAL_SHA3_512_WITH_RSA] = KMIP_SINCE(KMIP_1_4)
+};
+
+static const uint8 kmip_encoding_option_versions[KMIP_ENCODE_TTLV_ENCODING + 1] = {
+    [KMIP_ENCODE_NO_ENCODING]   = KMIP_SINCE(KMIP_1_1),
+    [KMIP_ENCODE_TTLV_ENCODING] = KMIP_SINCE(KMIP_1_1)
+};
+
+static const uint8 kmip_hashing_algorithm_versions[KMIP_HASH_SHA3_512 + 1] = {
+    [KMIP_HASH_MD2]        = KMIP_SINCE(KMIP_1_0),
+    [KMIP_HASH_MD4]        = KMIP_SINCE(KMIP_1_0),
+    [KMIP_HASH_MD5]        = KMIP_SINCE(KMIP_1_0),
+    [KMIP_HASH_SHA1]       = KMIP_SINCE(KMIP_1_0),
+    [KMIP_HASH_SHA224]     = KMIP_SINCE(KMIP_1_0),
+    [KMIP_HASH_SHA256]     = KMIP_SINCE(KMIP_1_0),
+    [KMIP_HASH_SHA384]     = KMIP_SINCE(KMIP_1_0),
+    [KMIP_HASH_SHA512]     = KMIP_SINCE(KMIP_1_0),
+    [KMIP_HASH_RIPEMD160]  = KMIP_SINCE(KMIP_1_0),
+    [KMIP_HASH_TIGER]      = KMIP_SINCE(KMIP_1_0),
+    [KMIP_HASH_WHIRLPOOL]  = KMIP_SINCE(KMIP_1_0),
+    [KMIP_HASH_SHA512_224] = KMIP_SINCE(KMIP_1_2),
+    [KMIP_HASH_SHA512_256] = KMIP_SINCE(KMIP_1_2),
+    [KMIP_HASH_SHA3_224]   = KMIP_SINCE(KMIP_1_4),
+    [KMIP_HASH_SHA3_256]   = KMIP_SINCE(KMIP_1_4),
+    [KMIP_HASH_SHA3_384]   = KMIP_SINCE(KMIP_1_4),
+    [KMIP_HASH_SHA3_512]   = KMIP_SINCE(KMIP_1_4)
+};
+
+static const uint8 kmip_key_compression_type_versions[KMIP_KEYCOMP_EC_PUB_X962_HYBRID + 1] = {
+    [KMIP_KEYCOMP_EC_PUB_UNCOMPRESSED]          = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYCOMP_EC_PUB_X962_COMPRESSED_PRIME] = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYCOMP_EC_PUB_X962_COMPRESSED_CHAR2] = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYCOMP_EC_PUB_X962_HYBRID]           = KMIP_SINCE(KMIP_1_0)
+};
+
+static const uint8 kmip_key_format_type_versions[KMIP_KEYFORMAT_PKCS10 + 1] = {
+    [KMIP_KEYFORMAT_RAW]                     = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYFORMAT_OPAQUE]                  = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYFORMAT_PKCS1]                   = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYFORMAT_PKCS8]                   = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYFORMAT_X509]                    = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYFORMAT_EC_PRIVATE_KEY]          = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYFORMAT_TRANS_SYMMETRIC_KEY]     = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYFORMAT_TRANS_DSA_PRIVATE_KEY]   = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYFORMAT_TRANS_DSA_PUBLIC_KEY]    = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYFORMAT_TRANS_RSA_PRIVATE_KEY]   = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYFORMAT_TRANS_RSA_PUBLIC_KEY]    = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYFORMAT_TRANS_DH_PRIVATE_KEY]    = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYFORMAT_TRANS_DH_PUBLIC_KEY]     = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYFORMAT_TRANS_ECDSA_PRIVATE_KEY] = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYFORMAT_TRANS_ECDSA_PUBLIC_KEY]  = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYFORMAT_TRANS_ECDH_PRIVATE_KEY]  = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYFORMAT_TRANS_ECDH_PUBLIC_KEY]   = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYFORMAT_TRANS_ECMQV_PRIVATE_KEY] = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYFORMAT_TRANS_ECMQV_PUBLIC_KEY]  = KMIP_SINCE(KMIP_1_0),
+    [KMIP_KEYFORMAT_TRANS_EC_PRIVATE_KEY]    = KMIP_SINCE(KMIP_1_3),
+    [KMIP_KEYFORMAT_TRANS_EC_PUBLIC_KEY]     = KMIP_SINCE(KMIP_1_3),
+    [KMIP_KEYFORMAT_PKCS12]                  = KMIP_SINCE(KMIP_1_4),
+    [KMIP_KEYFORMAT_PKCS10]                  = KMIP_SINCE(KMIP_2_0)
+};
+
+static const uint8 kmip_key_role_type_versions[KMIP_ROLE_TRKBK + 1] = {
+    [KMIP_ROLE_BDK]      = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_CVK]      = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_DEK]      = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_MKAC]     = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_MKSMC]    = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_MKSMI]    = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_MKDAC]    = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_MKDN]     = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_MKCP]     = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_MKOTH]    = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_KEK]      = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_MAC16609] = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_MAC97971] = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_MAC97972] = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_MAC97973] = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_MAC97974] = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_MAC97975] = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_ZPK]      = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_PVKIBM]   = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_PVKPVV]   = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_PVKOTH]   = KMIP_SINCE(KMIP_1_0),
+    [KMIP_ROLE_DUKPT]    = KMIP_SINCE(KMIP_1_4),
+    [KMIP_ROLE_IV]       = KMIP_SINCE(KMIP_1_4),
+    [KMIP_ROLE_TRKBK]    = KMIP_SINCE(KMIP_1_4)
+};
+
+static const uint8 kmip_key_wrap_type_versions[KMIP_WRAPTYPE_AS_REGISTERED + 1] = {
+    [KMIP_WRAPTYPE_NOT_WRAPPED]   = KMIP_SINCE(KMIP_1_4),
+    [KMIP_WRAPTYPE_AS_REGISTERED] = KMIP_SINCE(KMIP_1_4)
+};
+
+static const uint8 kmip_mask_generator_versions[KMIP_MASKGEN_MGF1 + 1] = {
+    [KMIP_MASKGEN_MGF1] = KMIP_SINCE(KMIP_1_4)
+};
+
+static const uint8 kmip_name_type_versions[KMIP_NAME_URI + 1] = {
+    [KMIP_NAME_UNINTERPRETED_TEXT_STRING] = KMIP_SINCE(KMIP_1_0),
+    [KMIP_NAME_URI]                       = KMIP_SINCE(KMIP_1_0)
+};
+
+static const uint8 kmip_object_type_versions[KMIP_OBJTYPE_CERTIFICATE_REQUEST + 1] = {
+    [KMIP_OBJTYPE_CERTIFICATE]         = KMIP_SINCE(KMIP_1_0),
+    [KMIP_OBJTYPE_SYMMETRIC_KEY]       = KMIP_SINCE(KMIP_1_0),
+    [KMIP_OBJTYPE_PUBLIC_KEY]          = KMIP_SINCE(KMIP_1_0),
+    [KMIP_OBJTYPE_PRIVATE_KEY]         = KMIP_SINCE(KMIP_1_0),
+    [KMIP_OBJTYPE_SPLIT_KEY]           = KMIP_SINCE(KMIP_1_0),
+    [KMIP_OBJTYPE_TEMPLATE]            = KMIP_SINCE(KMIP_1_0),
+    [KMIP_OBJTYPE_SECRET_DATA]         = KMIP_SINCE(KMIP_1_0),
+    [KMIP_OBJTYPE_OPAQUE_OBJECT]       = KMIP_SINCE(KMIP_1_0),
+    [KMIP_OBJTYPE_PGP_KEY]             = KMIP_SINCE(KMIP_1_2),
+    [KMIP_OBJTYPE_CERTIFICATE_REQUEST] = KMIP_SINCE(KMIP_2_0)
+};
+
+static const uint8 kmip_operation_versions[KMIP_OP_DESTROY + 1] = {
+    [KMIP_OP_CREATE]  = KMIP_SINCE(KMIP_1_0),
+    [KMIP_OP_GET]     = KMIP_SINCE(KMIP_1_0),
+    [KMIP_OP_DESTROY] = KMIP_SINCE(KMIP_1_0)
+};
+
+static const uint8 kmip_padding_method_versions[KMIP_PAD_PSS + 1] = {
+    [KMIP_PAD_NONE]      = KMIP_SINCE(KMIP_1_0),
+    [KMIP_PAD_OAEP]      = KMIP_SINCE(KMIP_1_0),
+    [KMIP_PAD_PKCS5]     = KMIP_SINCE(KMIP_1_0),
+    [KMIP_PAD_SSL3]      = KMIP_SINCE(KMIP_1_0),
+    [KMIP_PAD_ZEROS]     = KMIP_SINCE(KMIP_1_0),
+    [KMIP_PAD_ANSI_X923] = KMIP_SINCE(KMIP_1_0),
+    [KMIP_PAD_ISO_10126] = KMIP_SINCE(KMIP_1_0),
+    [KMIP_PAD_PKCS1v15]  = KMIP_SINCE(KMIP_1_0),
+    [KMIP_PAD_X931]      = KMIP_SINCE(KMIP_1_0),
+    [KMIP_PAD_PSS]       = KMIP_SINCE(KMIP_1_0)
+};
+
+static const uint8 kmip_result_reason_versions[KMIP_REASON_GENERAL_FAILURE + 1] = {
+    [KMIP_REASON_ITEM_NOT_FOUND]                         = KMIP_SINCE(KMIP_1_0),
+    [KMIP_REASON_RESPONSE_TOO_LARGE]                     = KMIP_SINCE(KMIP_1_0),
+    [KMIP_REASON_AUTHENTICATION_NOT_SUCCESSFUL]          = KMIP_SINCE(KMIP_1_0),
+    [KMIP_REASON_INVALID_MESSAGE]                        = KMIP_SINCE(KMIP_1_0),
+    [KMIP_REASON_OPERATION_NOT_SUPPORTED]                = KMIP_SINCE(KMIP_1_0),
+    [KMIP_REASON_MISSING_DATA]                           = KMIP_SINCE(KMIP_1_0),
+    [KMIP_REASON_INVALID_FIELD]                          = KMIP_SINCE(KMIP_1_0),
+    [KMIP_REASON_FEATURE_NOT_SUPPORTED]                  = KMIP_SINCE(KMIP_1_0),
+    [KMIP_REASON_OPERATION_CANCELED_BY_REQUESTER]        = KMIP_SINCE(KMIP_1_0),
+    [KMIP_REASON_CRYPTOGRAPHIC_FAILURE]                  = KMIP_SINCE(KMIP_1_0),
+    [KMIP_REASON_ILLEGAL_OPERATION]                      = KMIP_SINCE(KMIP_1_0),
+    [KMIP_REASON_PERMISSION_DENIED]                      = KMIP_SINCE(KMIP_1_0),
+    [KMIP_REASON_OBJECT_ARCHIVED]                        = KMIP_SINCE(KMIP_1_0),
+    [KMIP_REASON_INDEX_OUT_OF_BOUNDS]                    = KMIP_SINCE(KMIP_1_0),
+    [KMIP_REASON_APPLICATION_NAMESPACE_NOT_SUPPORTED]    = KMIP_SINCE(KMIP_1_0),
+    [KMIP_REASON_KEY_FORMAT_TYPE_NOT_SUPPORTED]          = KMIP_SINCE(KMIP_1_0),
+    [KMIP_REASON_KEY_COMPRESSION_TYPE_NOT_SUPPORTED]     = KMIP_SINCE(KMIP_1_0),
+    [KMIP_REASON_ENCODING_OPTION_FAILURE]                = KMIP_SINCE(KMIP_1_1),
+    [KMIP_REASON_KEY_VALUE_NOT_PRESENT]                  = KMIP_SINCE(KMIP_1_2),
+    [KMIP_REASON_ATTESTATION_REQUIRED]                   = KMIP_SINCE(KMIP_1_2),
+    [KMIP_REASON_ATTESTATION_FAILED]                     = KMIP_SINCE(KMIP_1_2),
+    [KMIP_REASON_SENSITIVE]                              = KMIP_SINCE(KMIP_1_4),
+    [KMIP_REASON_NOT_EXTRACTABLE]                        = KMIP_SINCE(KMIP_1_4),
+    [KMIP_REASON_OBJECT_ALREADY_EXISTS]                  = KMIP_SINCE(KMIP_1_4),
+    [KMIP_REASON_INVALID_TICKET]                         = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_USAGE_LIMIT_EXCEEDED]                   = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_NUMERIC_RANGE]                          = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_INVALID_DATA_TYPE]                      = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_READ_ONLY_ATTRIBUTE]                    = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_MULTI_VALUED_ATTRIBUTE]                 = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_UNSUPPORTED_ATTRIBUTE]                  = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_ATTRIBUTE_INSTANCE_NOT_FOUND]           = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_ATTRIBUTE_NOT_FOUND]                    = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_ATTRIBUTE_READ_ONLY]                    = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_ATTRIBUTE_SINGLE_VALUED]                = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_BAD_CRYPTOGRAPHIC_PARAMETERS]           = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_BAD_PASSWORD]                           = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_CODEC_ERROR]                            = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_ILLEGAL_OBJECT_TYPE]                    = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_INCOMPATIBLE_CRYPTOGRAPHIC_USAGE_MASK]  = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_INTERNAL_SERVER_ERROR]                  = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_INVALID_ASYNCHRONOUS_CORRELATION_VALUE] = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_INVALID_ATTRIBUTE]                      = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_INVALID_ATTRIBUTE_VALUE]                = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_INVALID_CORRELATION_VALUE]              = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_INVALID_CSR]                            = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_INVALID_OBJECT_TYPE]                    = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_KEY_WRAP_TYPE_NOT_SUPPORTED]            = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_MISSING_INITIALIZATION_VECTOR]          = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_NON_UNIQUE_NAME_ATTRIBUTE]              = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_OBJECT_DESTROYED]                       = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_OBJECT_NOT_FOUND]                       = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_NOT_AUTHORISED]                         = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_SERVER_LIMIT_EXCEEDED]                  = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_UNKNOWN_ENUMERATION]                    = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_UNKNOWN_MESSAGE_EXTENSION]              = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_UNKNOWN_TAG]                            = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_UNSUPPORTED_CRYPTOGRAPHIC_PARAMETERS]   = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_UNSUPPORTED_PROTOCOL_VERSION]           = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_WRAPPING_OBJECT_ARCHIVED]               = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_WRAPPING_OBJECT_DESTROYED]              = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_WRAPPING_OBJECT_NOT_FOUND]              = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_WRONG_KEY_LIFECYCLE_STATE]              = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_PROTECTION_STORAGE_UNAVAILABLE]         = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_PKCS11_CODEC_ERROR]                     = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_PKCS11_INVALID_FUNCTION]                = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_PKCS11_INVALID_INTERFACE]               = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_PRIVATE_PROTECTION_STORAGE_UNAVAILABLE] = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_PUBLIC_PROTECTION_STORAGE_UNAVAILABLE]  = KMIP_SINCE(KMIP_2_0),
+    [KMIP_REASON_GENERAL_FAILURE]                        = KMIP_SINCE(KMIP_1_0)
+};
+
+static const uint8 kmip_result_status_versions[KMIP_STATUS_OPERATION_UNDONE + 1] = {
+    [KMIP_STATUS_SUCCESS]           = KMIP_SINCE(KMIP_1_0),
+    [KMIP_STATUS_OPERATION_FAILED]  = KMIP_SINCE(KMIP_1_0),
+    [KMIP_STATUS_OPERATION_PENDING] = KMIP_SINCE(KMIP_1_0),
+    [KMIP_STATUS_OPERATION_UNDONE]  = KMIP_SINCE(KMIP_1_0)
+};
+
+static const uint8 kmip_state_versions[KMIP_STATE_DESTROYED_COMPROMISED + 1] = {
+    [KMIP_STATE_PRE_ACTIVE]            = KMIP_SINCE(KMIP_1_0),
+    [KMIP_STATE_ACTIVE]                = KMIP_SINCE(KMIP_1_0),
+    [KMIP_STATE_DEACTIVATED]           = KMIP_SINCE(KMIP_1_0),
+    [KMIP_STATE_COMPROMISED]           = KMIP_SINCE(KMIP_1_0),
+    [KMIP_STATE_DESTROYED]             = KMIP_SINCE(KMIP_1_0),
+    [KMIP_STATE_DESTROYED_COMPROMISED] = KMIP_SINCE(KMIP_1_0)
+};
+
+static const uint8 kmip_type_versions[KMIP_TYPE_DATE_TIME_EXTENDED + 1] = {
+    [KMIP_TYPE_STRUCTURE]          = KMIP_SINCE(KMIP_1_0),
+    [KMIP_TYPE_INTEGER]            = KMIP_SINCE(KMIP_1_0),
+    [KMIP_TYPE_LONG_INTEGER]       = KMIP_SINCE(KMIP_1_0),
+    [KMIP_TYPE_BIG_INTEGER]        = KMIP_SINCE(KMIP_1_0),
+    [KMIP_TYPE_ENUMERATION]        = KMIP_SINCE(KMIP_1_0),
+    [KMIP_TYPE_BOOLEAN]            = KMIP_SINCE(KMIP_1_0),
+    [KMIP_TYPE_TEXT_STRING]        = KMIP_SINCE(KMIP_1_0),
+    [KMIP_TYPE_BYTE_STRING]        = KMIP_SINCE(KMIP_1_0),
+    [KMIP_TYPE_DATE_TIME]          = KMIP_SINCE(KMIP_1_0),
+    [KMIP_TYPE_INTERVAL]           = KMIP_SINCE(KMIP_1_0),
+    [KMIP_TYPE_DATE_TIME_EXTENDED] = KMIP_SINCE(KMIP_2_0)
+};
+
+static const uint8 kmip_wrapping_method_versions[KMIP_WRAP_TR31 + 1] = {
+    [KMIP_WRAP_ENCRYPT]          = KMIP_SINCE(KMIP_1_0),
+    [KMIP_WRAP_MAC_SIGN]         = KMIP_SINCE(KMIP_1_0),
+    [KMIP_WRAP_ENCRYPT_MAC_SIGN] = KMIP_SINCE(KMIP_1_0),
+    [KMIP_WRAP_MAC_SIGN_ENCRYPT] = KMIP_SINCE(KMIP_1_0),
+    [KMIP_WRAP_TR31]             = KMIP_SINCE(KMIP_1_0)
+};
+#define KMIP_CRYPTOMASK_1_0_BITS           \
+    (KMIP_CRYPTOMASK_SIGN                | \
+     KMIP_CRYPTOMASK_VERIFY              | \
+     KMIP_CRYPTOMASK_ENCRYPT             | \
+     KMIP_CRYPTOMASK_DECRYPT             | \
+     KMIP_CRYPTOMASK_WRAP_KEY            | \
+     KMIP_CRYPTOMASK_UNWRAP_KEY          | \
+     KMIP_CRYPTOMASK_EXPORT              | \
+     KMIP_CRYPTOMASK_MAC_GENERATE        | \
+     KMIP_CRYPTOMASK_MAC_VERIFY          | \
+     KMIP_CRYPTOMASK_DERIVE_KEY          | \
+     KMIP_CRYPTOMASK_CONTENT_COMMITMENT  | \
+     KMIP_CRYPTOMASK_KEY_AGREEMENT       | \
+     KMIP_CRYPTOMASK_CERTIFICATE_SIGN    | \
+     KMIP_CRYPTOMASK_CRL_SIGN            | \
+     KMIP_CRYPTOMASK_GENERATE_CRYPTOGRAM | \
+     KMIP_CRYPTOMASK_VALIDATE_CRYPTOGRAM | \
+     KMIP_CRYPTOMASK_TRANSLATE_ENCRYPT   | \
+     KMIP_CRYPTOMASK_TRANSLATE_DECRYPT   | \
+     KMIP_CRYPTOMASK_TRANSLATE_WRAP      | \
+     KMIP_CRYPTOMASK_TRANSLATE_UNWRAP)
+
+#define KMIP_CRYPTOMASK_2_0_BITS    \
+    (KMIP_CRYPTOMASK_AUTHENTICATE | \
+     KMIP_CRYPTOMASK_UNRESTRICTED | \
+     KMIP_CRYPTOMASK_FPE_ENCRYPT  | \
+     KMIP_CRYPTOMASK_FPE_DECRYPT)
+
+static const uint32 kmip_cryptographic_usage_mask_versions[KMIP_2_0 + 1] = {
+    [KMIP_1_0] = KMIP_CRYPTOMASK_1_0_BITS,
+    [KMIP_1_1] = KMIP_CRYPTOMASK_1_0_BITS,
+    [KMIP_1_2] = KMIP_CRYPTOMASK_1_0_BITS,
+    [KMIP_1_3] = KMIP_CRYPTOMASK_1_0_BITS,
+    [KMIP_1_4] = KMIP_CRYPTOMASK_1_0_BITS,
+    [KMIP_2_0] = KMIP_CRYPTOMASK_1_0_BITS | KMIP_CRYPTOMASK_2_0_BITS
+};
+
+#define KMIP_PROTECT_2_0_BITS          \
+    (KMIP_PROTECT_SOFTWARE          | \
+     KMIP_PROTECT_HARDWARE          | \
+     KMIP_PROTECT_ON_PROCESSOR      | \
+     KMIP_PROTECT_ON_SYSTEM         | \
+     KMIP_PROTECT_OFF_SYSTEM        | \
+     KMIP_PROTECT_HYPERVISOR        | \
+     KMIP_PROTECT_OPERATING_SYSTEM  | \
+     KMIP_PROTECT_CONTAINER         | \
+     KMIP_PROTECT_ON_PREMISES       | \
+     KMIP_PROTECT_OFF_PREMISES      | \
+     KMIP_PROTECT_SELF_MANAGED      | \
+     KMIP_PROTECT_OUTSOURCED        | \
+     KMIP_PROTECT_VALIDATED         | \
+     KMIP_PROTECT_SAME_JURISDICTION)
+
+static const uint32 kmip_protection_storage_mask_versions[KMIP_2_0 + 1] = {
+    [KMIP_1_0] = 0,
+    [KMIP_1_1] = 0,
+    [KMIP_1_2] = 0,
+    [KMIP_1_3] = 0,
+    [KMIP_1_4] = 0,
+    [KMIP_2_0] = KMIP_PROTECT_2_0_BITS
+};
+
+static const uint8 *kmip_enum_value_versions[25] = {
+    kmip_attestation_type_versions,                /* Attestation Type */
+    kmip_batch_error_continuation_option_versions, /* Batch Error Continuation Option */
+    kmip_block_cipher_mode_versions,               /* Block Cipher Mode */
+    kmip_credential_type_versions,                 /* Credential Type */
+    kmip_cryptographic_algorithm_versions,         /* Cryptographic Algorithm */
+    NULL,                                          /* Cryptographic Usage Mask */
+    kmip_digital_signature_algorithm_versions,     /* Digital Signature Algorithm */
+    kmip_encoding_option_versions,                 /* Encoding Option */
+    kmip_hashing_algorithm_versions,               /* Hashing Algorithm */
+    kmip_key_compression_type_versions,            /* Key Compression Type */
+    kmip_key_format_type_versions,                 /* Key Format Type */
+    kmip_key_role_type_versions,                   /* Key Role Type */
+    kmip_key_wrap_type_versions,                   /* Key Wrap Type */
+    kmip_mask_generator_versions,                  /* Mask Generator */
+    kmip_name_type_versions,                       /* Name Type */
+    kmip_object_type_versions,                     /* Object Type */
+    kmip_operation_versions,                       /* Operation */
+    kmip_padding_method_versions,                  /* Padding Method */
+    NULL,                                          /* Protection Storage Mask */
+    kmip_result_reason_versions,                   /* Result Reason */
+    kmip_result_status_versions,                   /* Result Status */
+    kmip_state_versions,                           /* State */
+    NULL,                                          /* Tag */
+    kmip_type_versions,                            /* Type */
+    kmip_wrapping_method_versions                 /* Wrapping Method */
+};
+
+static const size_t kmip_enum_value_counts[25] = {
+    ARRAY_LENGTH(kmip_attestation_type_versions),                /* Attestation Type */
+    ARRAY_LENGTH(kmip_batch_error_continuation_option_versions), /* Batch Error Continuation Option */
+    ARRAY_LENGTH(kmip_block_cipher_mode_versions),               /* Block Cipher Mode */
+    ARRAY_LENGTH(kmip_credential_type_versions),                 /* Credential Type */
+    ARRAY_LENGTH(kmip_cryptographic_algorithm_versions),         /* Cryptographic Algorithm */
+    0,                                                          /* Cryptographic Usage Mask */
+    ARRAY_LENGTH(kmip_digital_signature_algorithm_versions),     /* Digital Signature Algorithm */
+    ARRAY_LENGTH(kmip_encoding_option_versions),                 /* Encoding Option */
+    ARRAY_LENGTH(kmip_hashing_algorithm_versions),               /* Hashing Algorithm */
+    ARRAY_LENGTH(kmip_key_compression_type_versions),            /* Key Compression Type */
+    ARRAY_LENGTH(kmip_key_format_type_versions),                 /* Key Format Type */
+    ARRAY_LENGTH(kmip_key_role_type_versions),                   /* Key Role Type */
+    ARRAY_LENGTH(kmip_key_wrap_type_versions),                   /* Key Wrap Type */
+    ARRAY_LENGTH(kmip_mask_generator_versions),                  /* Mask Generator */
+    ARRAY_LENGTH(kmip_name_type_versions),                       /* Name Type */
+    ARRAY_LENGTH(kmip_object_type_versions),                     /* Object Type */
+    ARRAY_LENGTH(kmip_operation_versions),                       /* Operation */
+    ARRAY_LENGTH(kmip_padding_method_versions),                  /* Padding Method */
+    0,                                                          /* Protection Storage Mask */
+    ARRAY_LENGTH(kmip_result_reason_versions),                   /* Result Reason */
+    ARRAY_LENGTH(kmip_result_status_versions),                   /* Result Status */
+    ARRAY_LENGTH(kmip_state_versions),                           /* State */
+    0,                                                          /* Tag */
+    ARRAY_LENGTH(kmip_type_versions),                            /* Type */
+    ARRAY_LENGTH(kmip_wrapping_method_versions)                 /* Wrapping Method */
+};
+
+static const uint32 *kmip_enum_mask_versions[25] = {
+    NULL,                                   /* Attestation Type */
+    NULL,                                   /* Batch Error Continuation Option */
+    NULL,                                   /* Block Cipher Mode */
+    NULL,                                   /* Credential Type */
+    NULL,                                   /* Cryptographic Algorithm */
+    kmip_cryptographic_usage_mask_versions, /* Cryptographic Usage Mask */
+    NULL,                                   /* Digital Signature Algorithm */
+    NULL,                                   /* Encoding Option */
+    NULL,                                   /* Hashing Algorithm */
+    NULL,                                   /* Key Compression Type */
+    NULL,                                   /* Key Format Type */
+    NULL,                                   /* Key Role Type */
+    NULL,                                   /* Key Wrap Type */
+    NULL,                                   /* Mask Generator */
+    NULL,                                   /* Name Type */
+    NULL,                                   /* Object Type */
+    NULL,                                   /* Operation */
+    NULL,                                   /* Padding Method */
+    kmip_protection_storage_mask_versions,  /* Protection Storage Mask */
+    NULL,                                   /* Result Reason */
+    NULL,                                   /* Result Status */
+    NULL,                                   /* State */
+    NULL,                                   /* Tag */
+    NULL,                                   /* Type */
+    NULL                                   /* Wrapping Method */
+};
+
+int
+kmip_check_enum_value(enum kmip_version version, enum tag t, int value)
+{
+    if(t == KMIP_TAG_TAG)
+    {
+        return(KMIP_OK);
+    }
+    
+    int index = kmip_get_enum_string_index(t);
+    if((size_t)index >= ARRAY_LENGTH(kmip_enum_value_versions))
+    {
+        return(KMIP_ENUM_UNSUPPORTED);
+    }
+    
+    int v = version;
+    if(v < KMIP_1_0)
+    {
+        v = KMIP_1_0;
+    }
+    else if(v > KMIP_2_0)
+    {
+        v = KMIP_2_0;
+    }
+    
+    const uint32 *masks = kmip_enum_mask_versions[index];
+    if(masks != NULL)
+    {
+        /* NOTE (ph) Mask enumerations are checked one bit at a time. */
+        uint32 bit = (uint32)value;
+        if(bit == 0 || (bit & (bit - 1)) != 0 || (bit & masks[KMIP_2_0]) == 0)
+        {
+            return(KMIP_ENUM_MISMATCH);
+        }
+        
+        return((bit & masks[v]) ? KMIP_OK : KMIP_INVALID_FOR_VERSION);
+    }
+    
+    if(value < 0 || (size_t)value >= kmip_enum_value_counts[index])
+    {
+        return(KMIP_ENUM_MISMATCH);
+    }
+    
+    uint8 since = kmip_enum_value_versions[index][value];
+    if(since == 0)
+    {
+        return(KMIP_ENUM_MISMATCH);
+    }
+    
+    return((v + 1 >= since) ? KMIP_OK : KMIP_INVALID_FOR_VERSION);
+}
+
+/* NOTE (ph) The attribute name tables below are indexed by attribute_type. */
+/*      The slot table is a perfect hash over every KMIP 1.0-1.4 attribute  */
+/*      name, keyed on the name length and its first, middle, and last      */
+/*      characters (see kmip_get_attribute_type). The middle character is   */
+/*      required to separate "Alternative Name" from "Always Sensitive".    */
+/*      Regenerate the slot table if a name is ever added.                  */
+
+static const char *kmip_attribute_type_names[50] = {
+    "Unique Identifier",
+    "Name",
+    "Object Type",
+    "Cryptographic Algorithm",
+    "Cryptographic Length",
+    "Operation Policy Name",
+    "Cryptographic Usage Mask",
+    "State",
+    "Application Specific Information",
+    "Cryptographic Parameters",
+    "Cryptographic Domain Parameters",
+    "Certificate Type",
+    "Certificate Identifier",
+    "Certificate Subject",
+    "Certificate Issuer",
+    "Digest",
+    "Lease Time",
+    "Usage Limits",
+    "Initial Date",
+    "Activation Date",
+    "Process Start Date",
+    "Protect Stop Date",
+    "Deactivation Date",
+    "Destroy Date",
+    "Compromise Occurrence Date",
+    "Compromise Date",
+    "Revocation Reason",
+    "Archive Date",
+    "Object Group",
+    "Link",
+    "Contact Information",
+    "Last Change Date",
+    "Certificate Length",
+    "X.509 Certificate Identifier",
+    "X.509 Certificate Subject",
+    "X.509 Certificate Issuer",
+    "Digital Signature Algorithm",
+    "Fresh",
+    "Alternative Name",
+    "Key Value Present",
+    "Key Value Location",
+    "Original Creation Date",
+    "Random Number Generator",
+    "PKCS#12 Friendly Name",
+    "Description",
+    "Comment",
+    "Sensitive",
+    "Always Sensitive",
+    "Extractable",
+    "Never Extractable"
+};
+
+static const uint8 kmip_attribute_type_name_lengths[50] = {
+    17,  4, 11, 23, 20, 21, 24,  5, 32, 24,
+    31, 16, 22, 19, 18,  6, 10, 12, 12, 15,
+    18, 17, 17, 12, 26, 15, 17, 12, 12,  4,
+    19, 16, 18, 28, 25, 24, 27,  5, 16, 17,
+    18, 22, 23, 21, 11,  7,  9, 16, 11, 17
+};
+
+static const uint8 kmip_attribute_value_types[50] = {
+    KMIP_TYPE_TEXT_STRING, /* Unique Identifier */
+    KMIP_TYPE_STRUCTURE,   /* Name */
+    KMIP_TYPE_ENUMERATION, /* Object Type */
+    KMIP_TYPE_ENUMERATION, /* Cryptographic Algorithm */
+    KMIP_TYPE_INTEGER,     /* Cryptographic Length */
+    KMIP_TYPE_TEXT_STRING, /* Operation Policy Name */
+    KMIP_TYPE_INTEGER,     /* Cryptographic Usage Mask */
+    KMIP_TYPE_ENUMERATION, /* State */
+    KMIP_TYPE_STRUCTURE,   /* Application Specific Information */
+    KMIP_TYPE_STRUCTURE,   /* Cryptographic Parameters */
+    KMIP_TYPE_STRUCTURE,   /* Cryptographic Domain Parameters */
+    KMIP_TYPE_ENUMERATION, /* Certificate Type */
+    KMIP_TYPE_STRUCTURE,   /* Certificate Identifier */
+    KMIP_TYPE_STRUCTURE,   /* Certificate Subject */
+    KMIP_TYPE_STRUCTURE,   /* Certificate Issuer */
+    KMIP_TYPE_STRUCTURE,   /* Digest */
+    KMIP_TYPE_INTERVAL,    /* Lease Time */
+    KMIP_TYPE_STRUCTURE,   /* Usage Limits */
+    KMIP_TYPE_DATE_TIME,   /* Initial Date */
+    KMIP_TYPE_DATE_TIME,   /* Activation Date */
+    KMIP_TYPE_DATE_TIME,   /* Process Start Date */
+    KMIP_TYPE_DATE_TIME,   /* Protect Stop Date */
+    KMIP_TYPE_DATE_TIME,   /* Deactivation Date */
+    KMIP_TYPE_DATE_TIME,   /* Destroy Date */
+    KMIP_TYPE_DATE_TIME,   /* Compromise Occurrence Date */
+    KMIP_TYPE_DATE_TIME,   /* Compromise Date */
+    KMIP_TYPE_STRUCTURE,   /* Revocation Reason */
+    KMIP_TYPE_DATE_TIME,   /* Archive Date */
+    KMIP_TYPE_TEXT_STRING, /* Object Group */
+    KMIP_TYPE_STRUCTURE,   /* Link */
+    KMIP_TYPE_TEXT_STRING, /* Contact Information */
+    KMIP_TYPE_DATE_TIME,   /* Last Change Date */
+    KMIP_TYPE_INTEGER,     /* Certificate Length */
+    KMIP_TYPE_STRUCTURE,   /* X.509 Certificate Identifier */
+    KMIP_TYPE_STRUCTURE,   /* X.509 Certificate Subject */
+    KMIP_TYPE_STRUCTURE,   /* X.509 Certificate Issuer */
+    KMIP_TYPE_ENUMERATION, /* Digital Signature Algorithm */
+    KMIP_TYPE_BOOLEAN,     /* Fresh */
+    KMIP_TYPE_STRUCTURE,   /* Alternative Name */
+    KMIP_TYPE_BOOLEAN,     /* Key Value Present */
+    KMIP_TYPE_STRUCTURE,   /* Key Value Location */
+    KMIP_TYPE_DATE_TIME,   /* Original Creation Date */
+    KMIP_TYPE_STRUCTURE,   /* Random Number Generator */
+    KMIP_TYPE_TEXT_STRING, /* PKCS#12 Friendly Name */
+    KMIP_TYPE_TEXT_STRING, /* Description */
+    KMIP_TYPE_TEXT_STRING, /* Comment */
+    KMIP_TYPE_BOOLEAN,     /* Sensitive */
+    KMIP_TYPE_BOOLEAN,     /* Always Sensitive */
+    KMIP_TYPE_BOOLEAN,     /* Extractable */
+    KMIP_TYPE_BOOLEAN      /* Never Extractable */
+};
+
+static const uint8 kmip_attribute_name_slots[128] = {
+    0xFF, 0xFF, 0x20, 0x31, 0xFF, 0x2D, 0xFF, 0x0A, 0x0B, 0xFF, 0xFF, 0xFF, 0x17, 0x15, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x23, 0xFF, 0x10, 0xFF, 0x28, 0x1A, 0xFF, 0xFF, 0xFF, 0x0D, 0xFF, 0x2C, 0xFF, 0x27,
+    0xFF, 0xFF, 0xFF, 0x25, 0xFF, 0xFF, 0xFF, 0x05, 0x06, 0x2A, 0xFF, 0xFF, 0x1B, 0xFF, 0x1F, 0xFF,
+    0x2F, 0x2E, 0x11, 0xFF, 0x1C, 0xFF, 0xFF, 0x19, 0x09, 0xFF, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0x30,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x13, 0x26, 0xFF, 0x08, 0xFF, 0x0F, 0xFF, 0xFF, 0x03,
+    0xFF, 0xFF, 0xFF, 0x16, 0xFF, 0x2B, 0x0E, 0x22, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0xFF,
+    0xFF, 0xFF, 0x0C, 0xFF, 0xFF, 0x00, 0x21, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x01, 0x24, 0x1D, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x14, 0x02, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xFF, 0xFF
+};
+
+int
+kmip_get_attribute_type(const char *name, size_t length)
+{
+    if(name == NULL || length == 0)
+    {
+        return(KMIP_UNSET);
+    }
+
+    const uint8 *n = (const uint8 *)name;
+    size_t hash = length + 120 * n[0] + 166 * n[length / 2] + 98 * n[length - 1];
+    uint8 slot = kmip_attribute_name_slots[hash & 0x7F];
+
+    if(slot == 0xFF ||
+       kmip_attribute_type_name_lengths[slot] != length ||
+       memcmp(kmip_attribute_type_names[slot], name, length) != 0)
+    {
+        return(KMIP_UNSET);
+    }
+
+    return(slot);
+}
+
+const char *
+kmip_get_attribute_name(enum attribute_type value, size_t *length)
+{
+    if((int)value < 0 || (size_t)value >= ARRAY_LENGTH(kmip_attribute_type_names))
+    {
+        if(length != NULL)
+        {
+            *length = 0;
+        }
+        return(NULL);
+    }
+
+    if(length != NULL)
+    {
+        *length = kmip_attribute_type_name_lengths[value];
+    }
+    return(kmip_attribute_type_names[value]);
+}
+
+enum type
+kmip_get_attribute_value_type(enum attribute_type value)
+{
+    if((int)value < 0 || (size_t)value >= ARRAY_LENGTH(kmip_attribute_value_types))
+    {
+        return(0);
+    }
+
+    return(kmip_attribute_value_types[value]);
+}
+
+/*
+Context Utilities
+*/
+
+void
+kmip_clear_errors(KMIP *ctx)
+{
+    if(ctx == NULL)
+    {
+        return;
+    }
+    
+    /* Frames past the count are never read, so they are left as is. */
+    ctx->error_frame_count = 0;
+    
+    if(ctx->error_message != NULL)
+    {
+        ctx->free_func(ctx->state, ctx->error_message);
+        ctx->error_message = NULL;
+    }
+}
+
+void
+kmip_init(KMIP *ctx, void *buffer, size_t buffer_size, enum kmip_version v)
+{
+    if(ctx == NULL)
+    {
+        return;
+    }
+    
+    ctx->buffer = (uint8 *)buffer;
+    ctx->index = ctx->buffer;
+    ctx->size = buffer_size;
+    ctx->version = v;
+    
+    if(ctx->calloc_func == NULL)
+    {
+        ctx->calloc_func = &kmip_calloc;
+    }
+    if(ctx->realloc_func == NULL)
+    {
+        ctx->realloc_func = &kmip_realloc;
+    }
+    if(ctx->memset_func == NULL)
+    {
+        ctx->memset_func = &kmip_memset;
+    }
+    if(ctx->free_func == NULL)
+    {
+        ctx->free_func = &kmip_free;
+    }
+    if(ctx->memcpy_func == NULL)
+        ctx->memcpy_func = &kmip_memcpy;
+    
+    ctx->max_message_size = 8192;
+    ctx->error_message_size = 200;
+    ctx->error_message = NULL;
+    
+    ctx->skipped_items = NULL;
+    ctx->skipped_count = 0;
+    ctx->skipped_capacity = 0;
+    
+    kmip_init_vector(&ctx->credential_list);
+    
+    kmip_clear_errors(ctx);
+}
+
+void
+kmip_init_error_message(KMIP *ctx)
+{
+    if(ctx == NULL)
+    {
+        return;
+    }
+    
+    if(ctx->error_message == NULL)
+    {
+        ctx->error_message = ctx->calloc_func(ctx->state, ctx->error_message_size, sizeof(char));
+    }
+}
+
+int
+kmip_add_credential(KMIP *ctx, Credential *cred)
+{
+    if(ctx == NULL || cred == NULL)
+    {
+        return(KMIP_UNSET);
+    }
+    
+    if(kmip_vector_append(ctx, &ctx->credential_list, cred) == KMIP_OK)
+    {
+        return(KMIP_OK);
+    }
+    
+    return(KMIP_UNSET);
+}
+
+void
+kmip_remove_credentials(KMIP *ctx)
+{
+    if(ctx == NULL)
+    {
+        return;
+    }
+    
+    kmip_free_vector(ctx, &ctx->credential_list);
+}
+
+void
+kmip_reset(KMIP *ctx)
+{
+    if(ctx == NULL)
+    {
+        return;
+    }
+    
+    if(ctx->buffer != NULL)
+    {
+        kmip_memset(ctx->buffer, 0, ctx->size);
+    }
+    ctx->index = ctx->buffer;
+    ctx->skipped_count = 0;
+    
+    kmip_clear_errors(ctx);
+}
+
+void
+kmip_rewind(KMIP *ctx)
+{
+    if(ctx == NULL)
+    {
+        return;
+    }
+    
+    ctx->index = ctx->buffer;
+    ctx->skipped_count = 0;
+    
+    kmip_clear_errors(ctx);
+}
+
+void
+kmip_set_buffer(KMIP *ctx, void *buffer, size_t buffer_size)
+{
+    if(ctx == NULL)
+    {
+        return;
+    }
+    
+    /* Release the previous buffer if the context allocated it. */
+    if(ctx->own_buffer == KMIP_TRUE)
+    {
+        if(ctx->buffer != NULL && ctx->buffer != buffer)
+        {
+            kmip_free_buffer(ctx, ctx->buffer, ctx->size);
+        }
+        ctx->own_buffer = KMIP_FALSE;
+    }
+    
+    ctx->buffer = (uint8 *)buffer;
+    ctx->index = ctx->buffer;
+    ctx->size = buffer_size;
+    ctx->skipped_count = 0;
+}
+
+int
+kmip_set_own_buffer(KMIP *ctx, size_t buffer_size)
+{
+    if(ctx == NULL)
+    {
+        return(KMIP_ARG_INVALID);
+    }
+    
+    /* NOTE (ph) The context owns this buffer and grows it as needed */
+    /* while encoding. It is released by kmip_set_buffer and by      */
+    /* kmip_destroy.                                                 */
+    if(buffer_size == 0)
+    {
+        buffer_size = 1024;
+    }
+    
+    uint8 *buffer = ctx->calloc_func(ctx->state, 1, buffer_size);
+    if(buffer == NULL)
+    {
+        kmip_set_alloc_error_message(ctx, buffer_size, "buffer");
+        kmip_push_error_frame(ctx, __func__, __LINE__);
+        return(KMIP_MEMORY_ALLOC_FAILED);
+    }
+    
+    kmip_set_buffer(ctx, buffer, buffer_size);
+    ctx->own_buffer = KMIP_TRUE;
+    
+    return(KMIP_OK);
+}
+
+int
+kmip_grow_buffer(KMIP *ctx, size_t minimum_space)
+{
+    if(ctx == NULL)
+    {
+        return(KMIP_ARG_INVALID);
+    }
+    
+    if(ctx->own_buffer != KMIP_TRUE)
+    {
+        return(KMIP_ERROR_BUFFER_FULL);
+    }
+    
+    /* Double the buffer until the requested space fits. The index is */
+    /* restored as an offset since realloc may move the buffer.       */
+    size_t used = ctx->index - ctx->buffer;
+    size_t new_size = ctx->size > 0 ? ctx->size : 1024;
+    while(new_size - used < minimum_space)
+    {
+        new_size *= 2;
+    }
+    
+    uint8 *buffer = ctx->realloc_func(ctx->state, ctx->buffer, new_size);
+    if(buffer == NULL)
+    {
+        kmip_set_alloc_error_message(ctx, new_size, "buffer");
+        return(KMIP_MEMORY_ALLOC_FAILED);
+    }
+    
+    ctx->memset_func(buffer + ctx->size, 0, new_size - ctx->size);
+    
+    ctx->buffer = buffer;
+    ctx->index = buffer + used;
+    ctx->size = new_size;
+    
+    return(KMIP_OK);
+}
+
+void
+kmip_destroy(KMIP *ctx)
+{
+    if(ctx == NULL)
+    {
+        return;
+    }
+    
+    kmip_reset(ctx);
+    kmip_set_buffer(ctx, NULL, 0);
+
+    kmip_remove_credentials(ctx);
+    
+    ctx->free_func(ctx->state, ctx->skipped_items);
+    ctx->skipped_items = NULL;
+    ctx->skipped_capacity = 0;
+    
+    ctx->calloc_func = NULL;
+    ctx->realloc_func = NULL;
+    ctx->memset_func = NULL;
+    ctx->free_func = NULL;
+    ctx->memcpy_func = NULL;
+    ctx->state = NULL;
+}
 
-            /* KMIP 2.0 */
-            case KMIP_KEYFORMAT_PKCS10:
-            if(version >= KMIP_2_0)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-            
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
-        };
-        break;
-        
-        case KMIP_TAG_KEY_ROLE_TYPE:
-        switch(value)
-        {
-            /* KMIP 1.0 */
-            case KMIP_ROLE_BDK:
-            case KMIP_ROLE_CVK:
-            case KMIP_ROLE_DEK:
-            case KMIP_ROLE_MKAC:
-            case KMIP_ROLE_MKSMC:
-            case KMIP_ROLE_MKSMI:
-            case KMIP_ROLE_MKDAC:
-            case KMIP_ROLE_MKDN:
-            case KMIP_ROLE_MKCP:
-            case KMIP_ROLE_MKOTH:
-            case KMIP_ROLE_KEK:
-            case KMIP_ROLE_MAC16609:
-            case KMIP_ROLE_MAC97971:
-            case KMIP_ROLE_MAC97972:
-            case KMIP_ROLE_MAC97973:
-            case KMIP_ROLE_MAC97974:
-            case KMIP_ROLE_MAC97975:
-            case KMIP_ROLE_ZPK:
-            case KMIP_ROLE_PVKIBM:
-            case KMIP_ROLE_PVKPVV:
-            case KMIP_ROLE_PVKOTH:
-            return(KMIP_OK);
-            break;
-            
-            /* KMIP 1.4 */
-            case KMIP_ROLE_DUKPT:
-            case KMIP_ROLE_IV:
-            case KMIP_ROLE_TRKBK:
-            if(version >= KMIP_1_4)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-            
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
-        };
-        break;
-        
-        case KMIP_TAG_KEY_WRAP_TYPE:
-        switch(value)
-        {
-            /* KMIP 1.4 */
-            case KMIP_WRAPTYPE_NOT_WRAPPED:
-            case KMIP_WRAPTYPE_AS_REGISTERED:
-            if(version >= KMIP_1_4)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-            
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
-        };
-        break;
-        
-        case KMIP_TAG_MASK_GENERATOR:
-        switch(value)
-        {
-            /* KMIP 1.4 */
-            case KMIP_MASKGEN_MGF1:
-            if(version >= KMIP_1_4)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-            
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
-        };
+#if defined(KMIP_NO_ERROR_TRACE)
+/* NOTE (ph) The parentheses keep the no-op macro from expanding here, */
+/*      so the symbol is still available to code built with tracing.  */
+void
+(kmip_push_error_frame)(KMIP *ctx, const char *function, const int line)
+{
+    (void)ctx;
+    (void)function;
+    (void)line;
+}
+#else
+void
+kmip_push_error_frame(KMIP *ctx, const char *function, const int line)
+{
+    if(ctx == NULL)
+    {
+        return;
+    }
+    
+    /* Frames past the first 20 are dropped. */
+    if(ctx->error_frame_count < ARRAY_LENGTH(ctx->errors))
+    {
+        ErrorFrame *frame = &ctx->errors[ctx->error_frame_count++];
+        frame->function = function;
+        frame->line = line;
+    }
+}
+#endif
+
+void
+kmip_set_enum_error_message(KMIP *ctx, enum tag t, int value, int result)
+{
+    if(ctx == NULL)
+    {
+        return;
+    }
+    
+    switch(result)
+    {
+        /* TODO (ph) Update error message for KMIP version 2.0+ */
+        case KMIP_INVALID_FOR_VERSION:
+        kmip_init_error_message(ctx);
+        snprintf(ctx->error_message, ctx->error_message_size, "KMIP 1.%d does not support %s enumeration value (%d)", ctx->version, kmip_attribute_names[kmip_get_enum_string_index(t)], value);
         break;
         
-        case KMIP_TAG_NAME_TYPE:
-        switch(value)
-        {
-            /* KMIP 1.0 */
-            case KMIP_NAME_UNINTERPRETED_TEXT_STRING:
-            case KMIP_NAME_URI:
-            return(KMIP_OK);
-            break;
-            
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
-        };
+        default: /* KMIP_ENUM_MISMATCH */
+        kmip_init_error_message(ctx);
+        snprintf(ctx->error_message, ctx->error_message_size, "Invalid %s enumeration value (%d)", kmip_attribute_names[kmip_get_enum_string_index(t)], value);
         break;
-        
-        case KMIP_TAG_OBJECT_TYPE:
-        switch(value)
+    };
+}
+
+void
+kmip_set_alloc_error_message(KMIP *ctx, size_t size, const char *type)
+{
+    if(ctx == NULL)
+    {
+        return;
+    }
+    
+    kmip_init_error_message(ctx);
+    snprintf(ctx->error_message, ctx->error_message_size, "Could not allocate %zd bytes for a %s", size, type);
+}
+
+void
+kmip_set_error_message(KMIP *ctx, const char *message)
+{
+    if(ctx == NULL)
+    {
+        return;
+    }
+    
+    kmip_init_error_message(ctx);
+    snprintf(ctx->error_message, ctx->error_message_size, "%s", message);
+}
+
+int
+kmip_is_tag_next(const KMIP *ctx, enum tag t)
+{
+    if(ctx == NULL)
+    {
+        return(KMIP_FALSE);
+    }
+    
+    uint8 *index = ctx->index;
+    
+    if((ctx->size - (index - ctx->buffer)) < 3)
+    {
+        return(KMIP_FALSE);
+    }
+    
+    uint32 tag = 0;
+    
+    tag |= ((uint32)*index++ << 16);
+    tag |= ((uint32)*index++ << 8);
+    tag |= ((uint32)*index++ << 0);
+    
+    if(tag != t)
+    {
+        return(KMIP_FALSE);
+    }
+    
+    return(KMIP_TRUE);
+}
+
+int
+kmip_is_tag_type_next(const KMIP *ctx, enum tag t, enum type s)
+{
+    if(ctx == NULL)
+    {
+        return(KMIP_FALSE);
+    }
+    
+    uint8 *index = ctx->index;
+    
+    if((ctx->size - (index - ctx->buffer)) < 4)
+    {
+        return(KMIP_FALSE);
+    }
+    
+    uint32 tag_type = kmip_load_uint32_be(index);
+    
+    if(tag_type != (uint32)TAG_TYPE(t, s))
+    {
+        return(KMIP_FALSE);
+    }
+    
+    return(KMIP_TRUE);
+}
+
+int
+kmip_get_num_items_next(KMIP *ctx, enum tag t)
+{
+    if(ctx == NULL)
+    {
+        return(0);
+    }
+    
+    int count = 0;
+    
+    uint8 *index = ctx->index;
+    uint32 length = 0;
+    
+    while((ctx->size - (ctx->index - ctx->buffer)) > 8)
+    {
+        if(kmip_is_tag_next(ctx, t))
         {
-            /* KMIP 1.0 */
-            case KMIP_OBJTYPE_CERTIFICATE:
-            case KMIP_OBJTYPE_SYMMETRIC_KEY:
-            case KMIP_OBJTYPE_PUBLIC_KEY:
-            case KMIP_OBJTYPE_PRIVATE_KEY:
-            case KMIP_OBJTYPE_SPLIT_KEY:
-            case KMIP_OBJTYPE_SECRET_DATA:
-            case KMIP_OBJTYPE_OPAQUE_OBJECT:
-            return(KMIP_OK);
-            break;
-            
-            /* The following set is deprecated as of KMIP 1.3 */
-            case KMIP_OBJTYPE_TEMPLATE:
-            /* TODO (ph) What should happen if version >= 1.3? */
-            return(KMIP_OK);
-            break;
+            ctx->index += 4;
             
-            /* KMIP 1.2 */
-            case KMIP_OBJTYPE_PGP_KEY:
-            if(version >= KMIP_1_2)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
+            length = kmip_load_uint32_be(ctx->index);
+            ctx->index += 4;
+            length += CALCULATE_PADDING(length);
             
-            /* KMIP 2.0 */
-            case KMIP_OBJTYPE_CERTIFICATE_REQUEST:
-            if(version >= KMIP_2_0)
-                return(KMIP_OK);
+            if((ctx->size - (ctx->index - ctx->buffer)) >= length)
+            {
+                ctx->index += length;
+                count++;
+            }
             else
-                return(KMIP_INVALID_FOR_VERSION);
+            {
+                break;
+            }
+        }
+        else
+        {
             break;
+        }
+    }
+    
+    ctx->index = index;
+    return(count);
+}
+
+/* NOTE (ph) Repeated fields are decoded in a single pass by appending */
+/*      into a growable array. kmip_grow_items ensures room for one more */
+/*      item, doubling the capacity and zeroing new slots so each item   */
+/*      starts out as calloc'd memory. kmip_trim_items releases unused   */
+/*      capacity once the last item has been decoded.                    */
+
+void *
+kmip_grow_items(KMIP *ctx, void *items, size_t *capacity, size_t count, size_t size)
+{
+    if(ctx == NULL || capacity == NULL || size == 0)
+    {
+        return(NULL);
+    }
+    
+    if(count < *capacity)
+    {
+        return(items);
+    }
+    
+    size_t new_capacity = (*capacity > 0) ? (*capacity * 2) : 4;
+    if(new_capacity < *capacity || new_capacity > ((size_t)-1 / size))
+    {
+        return(NULL);
+    }
+    
+    uint8 *grown = ctx->realloc_func(ctx->state, items, new_capacity * size);
+    if(grown == NULL)
+    {
+        return(NULL);
+    }
+    
+    ctx->memset_func(grown + (*capacity * size), 0, (new_capacity - *capacity) * size);
+    *capacity = new_capacity;
+    
+    return(grown);
+}
+
+void *
+kmip_trim_items(KMIP *ctx, void *items, size_t capacity, size_t count, size_t size)
+{
+    if(ctx == NULL || items == NULL || count == 0 || count >= capacity)
+    {
+        return(items);
+    }
+    
+    /* NOTE (ph) A failed shrink leaves the larger array in place. */
+    void *trimmed = ctx->realloc_func(ctx->state, items, count * size);
+    if(trimmed == NULL)
+    {
+        return(items);
+    }
+    
+    return(trimmed);
+}
+
+uint32
+kmip_peek_tag(KMIP *ctx)
+{
+    if(BUFFER_BYTES_LEFT(ctx) < 3)
+    {
+        return(0);
+    }
 
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
-        };
-        break;
-        
-        case KMIP_TAG_OPERATION:
-        switch(value)
-        {
-            /* KMIP 1.0 */
-            case KMIP_OP_CREATE:
-            case KMIP_OP_GET:
-            case KMIP_OP_DESTROY:
-            return(KMIP_OK);
-            break;
-            
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
-        };
-        break;
-        
-        case KMIP_TAG_PADDING_METHOD:
-        switch(value)
-        {
-            /* KMIP 1.0 */
-            case KMIP_PAD_NONE:
-            case KMIP_PAD_OAEP:
-            case KMIP_PAD_PKCS5:
-            case KMIP_PAD_SSL3:
-            case KMIP_PAD_ZEROS:
-            case KMIP_PAD_ANSI_X923:
-            case KMIP_PAD_ISO_10126:
-            case KMIP_PAD_PKCS1v15:
-            case KMIP_PAD_X931:
-            case KMIP_PAD_PSS:
-            return(KMIP_OK);
-            break;
-            
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
-        };
-        break;
+    uint8 *index = ctx->index;
+    uint32 tag = 0;
 
-        case KMIP_TAG_PROTECTION_STORAGE_MASK:
-        {
-            switch(value)
-            {
-                /* KMIP 2.0 */
-                case KMIP_PROTECT_SOFTWARE:
-                case KMIP_PROTECT_HARDWARE:
-                case KMIP_PROTECT_ON_PROCESSOR:
-                case KMIP_PROTECT_ON_SYSTEM:
-                case KMIP_PROTECT_OFF_SYSTEM:
-                case KMIP_PROTECT_HYPERVISOR:
-                case KMIP_PROTECT_OPERATING_SYSTEM:
-                case KMIP_PROTECT_CONTAINER:
-                case KMIP_PROTECT_ON_PREMISES:
-                case KMIP_PROTECT_OFF_PREMISES:
-                case KMIP_PROTECT_SELF_MANAGED:
-                case KMIP_PROTECT_OUTSOURCED:
-                case KMIP_PROTECT_VALIDATED:
-                case KMIP_PROTECT_SAME_JURISDICTION:
-                if(version >= KMIP_2_0)
-                    return(KMIP_OK);
-                else
-                    return(KMIP_INVALID_FOR_VERSION);
-                break;
+    tag |= ((int32)*index++ << 16);
+    tag |= ((int32)*index++ << 8);
+    tag |= ((int32)*index++ << 0);
 
-                default:
-                return(KMIP_ENUM_MISMATCH);
-                break;
-            };
-        };
-        break;
-        
-        case KMIP_TAG_RESULT_REASON:
-        switch(value)
-        {
-            /* KMIP 1.0 */
-            case KMIP_REASON_GENERAL_FAILURE:
-            case KMIP_REASON_ITEM_NOT_FOUND:
-            case KMIP_REASON_RESPONSE_TOO_LARGE:
-            case KMIP_REASON_AUTHENTICATION_NOT_SUCCESSFUL:
-            case KMIP_REASON_INVALID_MESSAGE:
-            case KMIP_REASON_OPERATION_NOT_SUPPORTED:
-            case KMIP_REASON_MISSING_DATA:
-            case KMIP_REASON_INVALID_FIELD:
-            case KMIP_REASON_FEATURE_NOT_SUPPORTED:
-            case KMIP_REASON_OPERATION_CANCELED_BY_REQUESTER:
-            case KMIP_REASON_CRYPTOGRAPHIC_FAILURE:
-            case KMIP_REASON_ILLEGAL_OPERATION:
-            case KMIP_REASON_PERMISSION_DENIED:
-            case KMIP_REASON_OBJECT_ARCHIVED:
-            case KMIP_REASON_INDEX_OUT_OF_BOUNDS:
-            case KMIP_REASON_APPLICATION_NAMESPACE_NOT_SUPPORTED:
-            case KMIP_REASON_KEY_FORMAT_TYPE_NOT_SUPPORTED:
-            case KMIP_REASON_KEY_COMPRESSION_TYPE_NOT_SUPPORTED:
-            return(KMIP_OK);
-            break;
-            
-            /* KMIP 1.1 */
-            case KMIP_REASON_ENCODING_OPTION_FAILURE:
-            if(version >= KMIP_1_1)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-            
-            /* KMIP 1.2 */
-            case KMIP_REASON_KEY_VALUE_NOT_PRESENT:
-            case KMIP_REASON_ATTESTATION_REQUIRED:
-            case KMIP_REASON_ATTESTATION_FAILED:
-            if(version >= KMIP_1_2)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-            
-            /* KMIP 1.4 */
-            case KMIP_REASON_SENSITIVE:
-            case KMIP_REASON_NOT_EXTRACTABLE:
-            case KMIP_REASON_OBJECT_ALREADY_EXISTS:
-            if(version >= KMIP_1_4)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-            
-            /* KMIP 2.0 */
-            case KMIP_REASON_INVALID_TICKET:
-            case KMIP_REASON_USAGE_LIMIT_EXCEEDED:
-            case KMIP_REASON_NUMERIC_RANGE:
-            case KMIP_REASON_INVALID_DATA_TYPE:
-            case KMIP_REASON_READ_ONLY_ATTRIBUTE:
-            case KMIP_REASON_MULTI_VALUED_ATTRIBUTE:
-            case KMIP_REASON_UNSUPPORTED_ATTRIBUTE:
-            case KMIP_REASON_ATTRIBUTE_INSTANCE_NOT_FOUND:
-            case KMIP_REASON_ATTRIBUTE_NOT_FOUND:
-            case KMIP_REASON_ATTRIBUTE_READ_ONLY:
-            case KMIP_REASON_ATTRIBUTE_SINGLE_VALUED:
-            case KMIP_REASON_BAD_CRYPTOGRAPHIC_PARAMETERS:
-            case KMIP_REASON_BAD_PASSWORD:
-            case KMIP_REASON_CODEC_ERROR:
-            case KMIP_REASON_ILLEGAL_OBJECT_TYPE:
-            case KMIP_REASON_INCOMPATIBLE_CRYPTOGRAPHIC_USAGE_MASK:
-            case KMIP_REASON_INTERNAL_SERVER_ERROR:
-            case KMIP_REASON_INVALID_ASYNCHRONOUS_CORRELATION_VALUE:
-            case KMIP_REASON_INVALID_ATTRIBUTE:
-            case KMIP_REASON_INVALID_ATTRIBUTE_VALUE:
-            case KMIP_REASON_INVALID_CORRELATION_VALUE:
-            case KMIP_REASON_INVALID_CSR:
-            case KMIP_REASON_INVALID_OBJECT_TYPE:
-            case KMIP_REASON_KEY_WRAP_TYPE_NOT_SUPPORTED:
-            case KMIP_REASON_MISSING_INITIALIZATION_VECTOR:
-            case KMIP_REASON_NON_UNIQUE_NAME_ATTRIBUTE:
-            case KMIP_REASON_OBJECT_DESTROYED:
-            case KMIP_REASON_OBJECT_NOT_FOUND:
-            case KMIP_REASON_NOT_AUTHORISED:
-            case KMIP_REASON_SERVER_LIMIT_EXCEEDED:
-            case KMIP_REASON_UNKNOWN_ENUMERATION:
-            case KMIP_REASON_UNKNOWN_MESSAGE_EXTENSION:
-            case KMIP_REASON_UNKNOWN_TAG:
-            case KMIP_REASON_UNSUPPORTED_CRYPTOGRAPHIC_PARAMETERS:
-            case KMIP_REASON_UNSUPPORTED_PROTOCOL_VERSION:
-            case KMIP_REASON_WRAPPING_OBJECT_ARCHIVED:
-            case KMIP_REASON_WRAPPING_OBJECT_DESTROYED:
-            case KMIP_REASON_WRAPPING_OBJECT_NOT_FOUND:
-            case KMIP_REASON_WRONG_KEY_LIFECYCLE_STATE:
-            case KMIP_REASON_PROTECTION_STORAGE_UNAVAILABLE:
-            case KMIP_REASON_PKCS11_CODEC_ERROR:
-            case KMIP_REASON_PKCS11_INVALID_FUNCTION:
-            case KMIP_REASON_PKCS11_INVALID_INTERFACE:
-            case KMIP_REASON_PRIVATE_PROTECTION_STORAGE_UNAVAILABLE:
-            case KMIP_REASON_PUBLIC_PROTECTION_STORAGE_UNAVAILABLE:
-            if(version >= KMIP_2_0)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
+    return(tag);
+}
 
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
+/* NOTE (ph) kmip_skip_item steps over the next TTLV item using only its */
+/*      length, recording where it was so the caller can inspect it.    */
+/*      Decoders use it to pass over unrecognized items when the        */
+/*      context is set to skip_unknown.                                 */
+
+int
+kmip_skip_item(KMIP *ctx)
+{
+    CHECK_BUFFER_FULL(ctx, 8);
+    
+    uint8 *start = ctx->index;
+    uint32 tag_type = 0;
+    uint32 length = 0;
+    
+    kmip_decode_int32_be(ctx, &tag_type);
+    kmip_decode_int32_be(ctx, &length);
+    
+    enum type type = (enum type)(tag_type & 0xFF);
+    size_t value_size = length;
+    if(type != KMIP_TYPE_STRUCTURE)
+    {
+        value_size += CALCULATE_PADDING(length);
+    }
+    CHECK_BUFFER_FULL(ctx, value_size);
+    
+    RawSpan *spans = kmip_grow_items(ctx, ctx->skipped_items, &ctx->skipped_capacity, ctx->skipped_count, sizeof(RawSpan));
+    CHECK_NEW_MEMORY(ctx, spans, (ctx->skipped_count + 1) * sizeof(RawSpan), "sequence of RawSpan structures");
+    ctx->skipped_items = spans;
+    
+    RawSpan *span = &ctx->skipped_items[ctx->skipped_count++];
+    span->tag = (enum tag)(tag_type >> 8);
+    span->type = type;
+    span->offset = start - ctx->buffer;
+    span->size = 8 + value_size;
+    
+    ctx->index += value_size;
+    
+    return(KMIP_OK);
+}
+
+int
+kmip_is_attribute_tag(uint32 value)
+{
+    if(!KMIP_IS_TABLE_TAG(value))
+    {
+        return(KMIP_FALSE);
+    }
+
+    uint32 index = KMIP_TAG_TABLE_INDEX(value);
+    if(kmip_attribute_tag_bits[index >> 5] & ((uint32)1 << (index & 0x1F)))
+    {
+        return(KMIP_TRUE);
+    }
+
+    return(KMIP_FALSE);
+}
+
+/*
+Initialization Functions
+*/
+
+void
+kmip_init_application_specific_information(ApplicationSpecificInformation *value)
+{
+    if(value == NULL)
+    {
+        return;
+    }
+
+    value->application_namespace = NULL;
+    value->application_data = NULL;
+}
+
+void
+kmip_init_protocol_version(ProtocolVersion *value, enum kmip_version kmip_version)
+{
+    if(value == NULL)
+    {
+        return;
+    }
+    
+    switch(kmip_version)
+    {
+        case KMIP_2_0:
+        {
+            value->major = 2;
+            value->minor = 0;
         };
         break;
-        
-        case KMIP_TAG_RESULT_STATUS:
-        switch(value)
+
+        case KMIP_1_4:
         {
-            /* KMIP 1.0 */
-            case KMIP_STATUS_SUCCESS:
-            case KMIP_STATUS_OPERATION_FAILED:
-            case KMIP_STATUS_OPERATION_PENDING:
-            case KMIP_STATUS_OPERATION_UNDONE:
-            return(KMIP_OK);
-            break;
-            
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
+            value->major = 1;
+            value->minor = 4;
         };
         break;
         
-        case KMIP_TAG_STATE:
-        switch(value)
-        {
-            /* KMIP 1.0 */
-            case KMIP_STATE_PRE_ACTIVE:
-            case KMIP_STATE_ACTIVE:
-            case KMIP_STATE_DEACTIVATED:
-            case KMIP_STATE_COMPROMISED:
-            case KMIP_STATE_DESTROYED:
-            case KMIP_STATE_DESTROYED_COMPROMISED:
-            return(KMIP_OK);
-            break;
-            
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
+        case KMIP_1_3:
+        {
+            value->major = 1;
+            value->minor = 3;
         };
         break;
         
-        case KMIP_TAG_TAG:
-        return(KMIP_OK);
-        break;
-        
-        case KMIP_TAG_TYPE:
-        switch(value)
+        case KMIP_1_2:
         {
-            /* KMIP 1.0 */
-            case KMIP_TYPE_STRUCTURE:
-            case KMIP_TYPE_INTEGER:
-            case KMIP_TYPE_LONG_INTEGER:
-            case KMIP_TYPE_BIG_INTEGER:
-            case KMIP_TYPE_ENUMERATION:
-            case KMIP_TYPE_BOOLEAN:
-            case KMIP_TYPE_TEXT_STRING:
-            case KMIP_TYPE_BYTE_STRING:
-            case KMIP_TYPE_DATE_TIME:
-            case KMIP_TYPE_INTERVAL:
-            return(KMIP_OK);
-            break;
-            
-            /* KMIP 2.0 */
-            case KMIP_TYPE_DATE_TIME_EXTENDED:
-            if(version >= KMIP_2_0)
-                return(KMIP_OK);
-            else
-                return(KMIP_INVALID_FOR_VERSION);
-            break;
-
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
+            value->major = 1;
+            value->minor = 2;
         };
         break;
         
-        case KMIP_TAG_WRAPPING_METHOD:
-        switch(value)
+        case KMIP_1_1:
         {
-            /* KMIP 1.0 */
-            case KMIP_WRAP_ENCRYPT:
-            case KMIP_WRAP_MAC_SIGN:
-            case KMIP_WRAP_ENCRYPT_MAC_SIGN:
-            case KMIP_WRAP_MAC_SIGN_ENCRYPT:
-            case KMIP_WRAP_TR31:
-            return(KMIP_OK);
-            break;
-            
-            default:
-            return(KMIP_ENUM_MISMATCH);
-            break;
+            value->major = 1;
+            value->minor = 1;
         };
         break;
         
+        case KMIP_1_0:
         default:
-        return(KMIP_ENUM_UNSUPPORTED);
+        {
+            value->major = 1;
+            value->minor = 0;
+        };
         break;
     };
 }
 
-/*
-Context Utilities
-*/
-
 void
-kmip_clear_errors(KMIP *ctx)
+kmip_init_attribute(Attribute *value)
 {
-    if(ctx == NULL)
+    if(value == NULL)
     {
         return;
     }
     
-    for(size_t i = 0; i < ARRAY_LENGTH(ctx->errors); i++)
-    {
-        ctx->errors[i] = (ErrorFrame){0};
-    }
-    ctx->frame_index = ctx->errors;
-    
-    if(ctx->error_message != NULL)
-    {
-        ctx->free_func(ctx->state, ctx->error_message);
-        ctx->error_message = NULL;
-    }
+    value->type = 0;
+    value->index = KMIP_UNSET;
+    value->value = NULL;
 }
 
 void
-kmip_init(KMIP *ctx, void *buffer, size_t buffer_size, enum kmip_version v)
+kmip_init_cryptographic_parameters(CryptographicParameters *value)
 {
-    if(ctx == NULL)
+    kmip_init_schema(&kmip_cryptographic_parameters_schema, value);
+}
+
+void
+kmip_init_key_block(KeyBlock *value)
+{
+    if(value == NULL)
     {
         return;
     }
     
-    ctx->buffer = (uint8 *)buffer;
-    ctx->index = ctx->buffer;
-    ctx->size = buffer_size;
-    ctx->version = v;
-    
-    if(ctx->calloc_func == NULL)
-    {
-        ctx->calloc_func = &kmip_calloc;
-    }
-    if(ctx->realloc_func == NULL)
-    {
-        ctx->realloc_func = &kmip_realloc;
-    }
-    if(ctx->memset_func == NULL)
-    {
-        ctx->memset_func = &kmip_memset;
-    }
-    if(ctx->free_func == NULL)
-    {
-        ctx->free_func = &kmip_free;
-    }
-    if(ctx->memcpy_func == NULL)
-        ctx->memcpy_func = &kmip_memcpy;
-    
-    ctx->max_message_size = 8192;
-    ctx->error_message_size = 200;
-    ctx->error_message = NULL;
-    
-    ctx->error_frame_count = 20;
-    
-    ctx->credential_list = ctx->calloc_func(ctx->state, 1, sizeof(LinkedList));
-    
-    kmip_clear_errors(ctx);
+    value->key_format_type = 0;
+    value->key_compression_type = 0;
+    value->key_value = NULL;
+    value->key_value_type = 0;
+    value->cryptographic_algorithm = 0;
+    value->cryptographic_length = KMIP_UNSET;
+    value->key_wrapping_data = NULL;
 }
 
 void
-kmip_init_error_message(KMIP *ctx)
+kmip_init_request_header(RequestHeader *value)
 {
-    if(ctx == NULL)
+    if(value == NULL)
     {
         return;
     }
     
-    if(ctx->error_message == NULL)
-    {
-        ctx->error_message = ctx->calloc_func(ctx->state, ctx->error_message_size, sizeof(char));
-    }
+    value->protocol_version = NULL;
+    value->maximum_response_size = KMIP_UNSET;
+    value->asynchronous_indicator = KMIP_UNSET;
+    value->authentication = NULL;
+    value->batch_error_continuation_option = 0;
+    value->batch_order_option = KMIP_UNSET;
+    value->time_stamp = 0;
+    value->batch_count = KMIP_UNSET;
+    
+    value->attestation_capable_indicator = KMIP_UNSET;
+    value->attestation_types = NULL;
+    value->attestation_type_count = 0;
+    
+    value->client_correlation_value = NULL;
+    value->server_correlation_value = NULL;
 }
 
-int
-kmip_add_credential(KMIP *ctx, Credential *cred)
+void
+kmip_init_response_header(ResponseHeader *value)
 {
-    if(ctx == NULL || cred == NULL)
+    if(value == NULL)
     {
-        return(KMIP_UNSET);
+        return;
     }
     
-    LinkedListItem *item = ctx->calloc_func(ctx->state, 1, sizeof(LinkedListItem));
-    if(item != NULL)
-    {
-        item->data = cred;
-        kmip_linked_list_push(ctx->credential_list, item);
-        return(KMIP_OK);
-    }
+    value->protocol_version = NULL;
+    value->time_stamp = 0;
+    value->batch_count = KMIP_UNSET;
     
-    return(KMIP_UNSET);
+    value->nonce = NULL;
+    value->attestation_types = NULL;
+    value->attestation_type_count = 0;
+    
+    value->client_correlation_value = NULL;
+    value->server_correlation_value = NULL;
+
+    value->server_hashed_password = NULL;
 }
 
 void
-kmip_remove_credentials(KMIP *ctx)
+kmip_init_request_batch_item(RequestBatchItem *value)
 {
-    if(ctx == NULL)
+    if(value == NULL)
     {
         return;
     }
-    
-    LinkedListItem *item = kmip_linked_list_pop(ctx->credential_list);
-    while(item != NULL)
-    {
-        ctx->memset_func(item, 0, sizeof(LinkedListItem));
-        ctx->free_func(ctx->state, item);
-        
-        item = kmip_linked_list_pop(ctx->credential_list);
-    }
+
+    value->operation = 0;
+    value->unique_batch_item_id = NULL;
+    value->request_payload = NULL;
+
+    value->ephemeral = KMIP_UNSET;
 }
 
+/*
+Printing Functions
+*/
+
 void
-kmip_reset(KMIP *ctx)
+kmip_print_buffer(void *buffer, int size)
 {
-    if(ctx == NULL)
+    if(buffer == NULL)
     {
         return;
     }
     
-    if(ctx->buffer != NULL)
+    uint8 *index = (uint8 *)buffer;
+    for(int i = 0; i < size; i++)
     {
-        kmip_memset(ctx->buffer, 0, ctx->size);
+        if(i % 16 == 0)
+        {
+            printf("\n0x");
+        }
+        printf("%02X", index[i]);
     }
-    ctx->index = ctx->buffer;
-    
-    kmip_clear_errors(ctx);
 }
 
 void
-kmip_rewind(KMIP *ctx)
+kmip_print_stack_trace(KMIP *ctx)
 {
     if(ctx == NULL)
     {
         return;
     }
     
-    ctx->index = ctx->buffer;
-    
-    kmip_clear_errors(ctx);
+    for(size_t i = ctx->error_frame_count; i > 0; i--)
+    {
+        ErrorFrame *frame = &ctx->errors[i - 1];
+        printf("- %s @ line: %d\n", frame->function, frame->line);
+    }
 }
 
 void
-kmip_set_buffer(KMIP *ctx, void *buffer, size_t buffer_size)
+kmip_print_error_string(int value)
 {
-    if(ctx == NULL)
+    /* TODO (ph) Move this to a static string array. */
+    switch(value)
     {
-        return;
-    }
+        case 0:
+        {
+            printf("KMIP_OK");
+        } break;
+        
+        case -1:
+        {
+            printf("KMIP_NOT_IMPLEMENTED");
+        } break;
+        
+        case -2:
+        {
+            printf("KMIP_ERROR_BUFFER_FULL");
+        } break;
+        
+        case -3:
+        {
+            printf("KMIP_ERROR_ATTR_UNSUPPORTED");
+        } break;
+        
+        case -4:
+        {
+            printf("KMIP_TAG_MISMATCH");
+        } break;
+        
+        case -5:
+        {
+            printf("KMIP_TYPE_MISMATCH");
+        } break;
+        
+        case -6:
+        {
+            printf("KMIP_LENGTH_MISMATCH");
+        } break;
+        
+        case -7:
+        {
+            printf("KMIP_PADDING_MISMATCH");
+        } break;
+        
+        case -8:
+        {
+            printf("KMIP_BOOLEAN_MISMATCH");
+        } break;
+        
+        case -9:
+        {
+            printf("KMIP_ENUM_MISMATCH");
+        } break;
+        
+        case -10:
+        {
+            printf("KMIP_ENUM_UNSUPPORTED");
+        } break;
+        
+        case -11:
+        {
+            printf("KMIP_INVALID_FOR_VERSION");
+        } break;
+        
+        case -12:
+        {
+            printf("KMIP_MEMORY_ALLOC_FAILED");
+        } break;
+
+        case -13:
+        {
+            printf("KMIP_IO_FAILURE");
+        } break;
+
+        case -14:
+        {
+            printf("KMIP_EXCEED_MAX_MESSAGE_SIZE");
+        } break;
+
+        case -15:
+        {
+            printf("KMIP_MALFORMED_RESPONSE");
+        } break;
+
+        case -16:
+        {
+            printf("KMIP_OBJECT_MISMATCH");
+        } break;
+
+        case -17:
+        {
+            printf("KMIP_ARG_INVALID");
+        } break;
+
+        case -18:
+        {
+            printf("KMIP_ERROR_BUFFER_UNDERFULL");
+        } break;
+
+        default:
+        {
+            printf("Unrecognized Error Code");
+        } break;
+    };
     
-    /* TODO (ph) Add own_buffer if buffer == NULL? */
-    ctx->buffer = (uint8 *)buffer;
-    ctx->index = ctx->buffer;
-    ctx->size = buffer_size;
+    return;
 }
 
 void
-kmip_destroy(KMIP *ctx)
+kmip_print_attestation_type_enum(enum attestation_type value)
 {
-    if(ctx == NULL)
+    if(value == 0)
     {
+        printf("-");
         return;
     }
     
-    kmip_reset(ctx);
-    kmip_set_buffer(ctx, NULL, 0);
-
-    kmip_remove_credentials(ctx);
-    ctx->memset_func(ctx->credential_list, 0, sizeof(LinkedList));
-    ctx->free_func(ctx->state, ctx->credential_list);
-    
-    ctx->calloc_func = NULL;
-    ctx->realloc_func = NULL;
-    ctx->memset_func = NULL;
-    ctx->free_func = NULL;
-    ctx->memcpy_func = NULL;
-    ctx->state = NULL;
+    switch(value)
+    {
+        case KMIP_ATTEST_TPM_QUOTE:
+        printf("TPM Quote");
+        break;
+        
+        case KMIP_ATTEST_TCG_INTEGRITY_REPORT:
+        printf("TCG Integrity Report");
+        break;
+        
+        case KMIP_ATTEST_SAML_ASSERTION:
+        printf("SAML Assertion");
+        break;
+        
+        default:
+        printf("Unknown");
+        break;
+    };
 }
 
 void
-kmip_push_error_frame(KMIP *ctx, const char *function, const int line)
+kmip_print_batch_error_continuation_option(enum batch_error_continuation_option value)
 {
-    if(ctx == NULL)
+    if(value == 0)
     {
+        printf("-");
         return;
     }
     
-    for(size_t i = 0; i < 20; i++)
+    switch(value)
     {
-        ErrorFrame *frame = &ctx->errors[i];
-        if(frame->line == 0)
-        {
-            ctx->frame_index = frame;
-            strncpy(frame->function, function, sizeof(frame->function) - 1);
-            frame->line = line;
-            break;
-        }
-    }
+        case KMIP_BATCH_CONTINUE:
+        printf("Continue");
+        break;
+        
+        case KMIP_BATCH_STOP:
+        printf("Stop");
+        break;
+        
+        case KMIP_BATCH_UNDO:
+        printf("Undo");
+        break;
+        
+        default:
+        printf("Unknown");
+        break;
+    };
 }
 
 void
-kmip_set_enum_error_message(KMIP *ctx, enum tag t, int value, int result)
+kmip_print_operation_enum(enum operation value)
 {
-    if(ctx == NULL)
+    if(value == 0)
     {
+        printf("-");
         return;
     }
     
-    switch(result)
+    switch(value)
     {
-        /* TODO (ph) Update error message for KMIP version 2.0+ */
-        case KMIP_INVALID_FOR_VERSION:
-        kmip_init_error_message(ctx);
-        snprintf(ctx->error_message, ctx->error_message_size, "KMIP 1.%d does not support %s enumeration value (%d)", ctx->version, kmip_attribute_names[kmip_get_enum_string_index(t)], value);
+        case KMIP_OP_CREATE:
+        printf("Create");
         break;
         
-        default: /* KMIP_ENUM_MISMATCH */
-        kmip_init_error_message(ctx);
-        snprintf(ctx->error_message, ctx->error_message_size, "Invalid %s enumeration value (%d)", kmip_attribute_names[kmip_get_enum_string_index(t)], value);
+        case KMIP_OP_GET:
+        printf("Get");
+        break;
+        
+        case KMIP_OP_DESTROY:
+        printf("Destroy");
+        break;
+        
+        default:
+        printf("Unknown");
         break;
     };
 }
 
 void
-kmip_set_alloc_error_message(KMIP *ctx, size_t size, const char *type)
+kmip_print_result_status_enum(enum result_status value)
 {
-    if(ctx == NULL)
+    switch(value)
     {
-        return;
-    }
-    
-    kmip_init_error_message(ctx);
-    snprintf(ctx->error_message, ctx->error_message_size, "Could not allocate %zd bytes for a %s", size, type);
+        case KMIP_STATUS_SUCCESS:
+        printf("Success");
+        break;
+        
+        case KMIP_STATUS_OPERATION_FAILED:
+        printf("Operation Failed");
+        break;
+        
+        case KMIP_STATUS_OPERATION_PENDING:
+        printf("Operation Pending");
+        break;
+        
+        case KMIP_STATUS_OPERATION_UNDONE:
+        printf("Operation Undone");
+        break;
+        
+        default:
+        printf("Unknown");
+        break;
+    };
 }
 
 void
-kmip_set_error_message(KMIP *ctx, const char *message)
+kmip_print_result_reason_enum(enum result_reason value)
 {
-    if(ctx == NULL)
+    if(value == 0)
     {
+        printf("-");
         return;
     }
     
-    kmip_init_error_message(ctx);
-    snprintf(ctx->error_message, ctx->error_message_size, "%s", message);
-}
-
-int
-kmip_is_tag_next(const KMIP *ctx, enum tag t)
-{
-    if(ctx == NULL)
-    {
-        return(KMIP_FALSE);
-    }
-    
-    uint8 *index = ctx->index;
-    
-    if((ctx->size - (index - ctx->buffer)) < 3)
-    {
-        return(KMIP_FALSE);
-    }
-    
-    uint32 tag = 0;
-    
-    tag |= ((uint32)*index++ << 16);
-    tag |= ((uint32)*index++ << 8);
-    tag |= ((uint32)*index++ << 0);
-    
-    if(tag != t)
-    {
-        return(KMIP_FALSE);
-    }
-    
-    return(KMIP_TRUE);
-}
-
-int
-kmip_is_tag_type_next(const KMIP *ctx, enum tag t, enum type s)
-{
-    if(ctx == NULL)
-    {
-        return(KMIP_FALSE);
-    }
-    
-    uint8 *index = ctx->index;
-    
-    if((ctx->size - (index - ctx->buffer)) < 4)
-    {
-        return(KMIP_FALSE);
-    }
-    
-    uint32 tag_type = 0;
-    
-    tag_type |= ((uint32)*index++ << 24);
-    tag_type |= ((uint32)*index++ << 16);
-    tag_type |= ((uint32)*index++ << 8);
-    tag_type |= ((uint32)*index++ << 0);
-    
-    if(tag_type != TAG_TYPE(t, s))
-    {
-        return(KMIP_FALSE);
-    }
-    
-    return(KMIP_TRUE);
-}
-
-int
-kmip_get_num_items_next(KMIP *ctx, enum tag t)
-{
-    if(ctx == NULL)
-    {
-        return(0);
-    }
-    
-    int count = 0;
-    
-    uint8 *index = ctx->index;
-    uint32 length = 0;
-    
-    while((ctx->size - (ctx->index - ctx->buffer)) > 8)
+    switch(value)
     {
-        if(kmip_is_tag_next(ctx, t))
-        {
-            ctx->index += 4;
-            
-            length = 0;
-            length |= ((int32)*ctx->index++ << 24);
-            length |= ((int32)*ctx->index++ << 16);
-            length |= ((int32)*ctx->index++ << 8);
-            length |= ((int32)*ctx->index++ << 0);
-            length += CALCULATE_PADDING(length);
-            
-            if((ctx->size - (ctx->index - ctx->buffer)) >= length)
-            {
-                ctx->index += length;
-                count++;
-            }
-            else
-            {
-                break;
-            }
-        }
-        else
-        {
-            break;
-        }
-    }
-    
-    ctx->index = index;
-    return(count);
-}
+        case KMIP_REASON_GENERAL_FAILURE:
+        printf("General Failure");
+        break;
+        
+        case KMIP_REASON_ITEM_NOT_FOUND:
+        printf("Item Not Found");
+        break;
+        
+        case KMIP_REASON_RESPONSE_TOO_LARGE:
+        printf("Response Too Large");
+        break;
+        
+        case KMIP_REASON_AUTHENTICATION_NOT_SUCCESSFUL:
+        printf("Authentication Not Successful");
+        break;
+        
+        case KMIP_REASON_INVALID_MESSAGE:
+        printf("Invalid Message");
+        break;
+        
+        case KMIP_REASON_OPERATION_NOT_SUPPORTED:
+        printf("Operation Not Supported");
+        break;
+        
+        case KMIP_REASON_MISSING_DATA:
+        printf("Missing Data");
+        break;
+        
+        case KMIP_REASON_INVALID_FIELD:
+        printf("Invalid Field");
+        break;
+        
+        case KMIP_REASON_FEATURE_NOT_SUPPORTED:
+        printf("Feature Not Supported");
+        break;
+        
+        case KMIP_REASON_OPERATION_CANCELED_BY_REQUESTER:
+        printf("Operation Canceled By Requester");
+        break;
+        
+        case KMIP_REASON_CRYPTOGRAPHIC_FAILURE:
+        printf("Cryptographic Failure");
+        break;
+        
+        case KMIP_REASON_ILLEGAL_OPERATION:
+        printf("Illegal Operation");
+        break;
+        
+        case KMIP_REASON_PERMISSION_DENIED:
+        printf("Permission Denied");
+        break;
+        
+        case KMIP_REASON_OBJECT_ARCHIVED:
+        printf("Object Archived");
+        break;
+        
+        case KMIP_REASON_INDEX_OUT_OF_BOUNDS:
+        printf("Index Out Of Bounds");
+        break;
+        
+        case KMIP_REASON_APPLICATION_NAMESPACE_NOT_SUPPORTED:
+        printf("Application Namespace Not Supported");
+        break;
+        
+        case KMIP_REASON_KEY_FORMAT_TYPE_NOT_SUPPORTED:
+        printf("Key Format Type Not Supported");
+        break;
+        
+        case KMIP_REASON_KEY_COMPRESSION_TYPE_NOT_SUPPORTED:
+        printf("Key Compression Type Not Supported");
+        break;
+        
+        case KMIP_REASON_ENCODING_OPTION_FAILURE:
+        printf("Encoding Option Failure");
+        break;
+        
+        case KMIP_REASON_KEY_VALUE_NOT_PRESENT:
+        printf("Key Value Not Present");
+        break;
+        
+        case KMIP_REASON_ATTESTATION_REQUIRED:
+        printf("Attestation Required");
+        break;
+        
+        case KMIP_REASON_ATTESTATION_FAILED:
+        printf("Attestation Failed");
+        break;
+        
+        case KMIP_REASON_SENSITIVE:
+        printf("Sensitive");
+        break;
+        
+        case KMIP_REASON_NOT_EXTRACTABLE:
+        printf("Not Extractable");
+        break;
+        
+        case KMIP_REASON_OBJECT_ALREADY_EXISTS:
+        printf("Object Already Exists");
+        break;
+        
+        case KMIP_REASON_INVALID_TICKET:
+        printf("Invalid Ticket");
+        break;
 
-uint32
-kmip_peek_tag(KMIP *ctx)
-{
-    if(BUFFER_BYTES_LEFT(ctx) < 3)
-    {
-        return(0);
-    }
+        case KMIP_REASON_USAGE_LIMIT_EXCEEDED:
+        printf("Usage Limit Exceeded");
+        break;
 
-    uint8 *index = ctx->index;
-    uint32 tag = 0;
+        case KMIP_REASON_NUMERIC_RANGE:
+        printf("Numeric Range");
+        break;
 
-    tag |= ((int32)*index++ << 16);
-    tag |= ((int32)*index++ << 8);
-    tag |= ((int32)*index++ << 0);
+        case KMIP_REASON_INVALID_DATA_TYPE:
+        printf("Invalid Data Type");
+        break;
 
-    return(tag);
-}
+        case KMIP_REASON_READ_ONLY_ATTRIBUTE:
+        printf("Read Only Attribute");
+        break;
 
-int
-kmip_is_attribute_tag(uint32 value)
-{
-    enum tag attribute_tags[] = {
-        KMIP_TAG_UNIQUE_IDENTIFIER,
-        KMIP_TAG_NAME,
-        KMIP_TAG_OBJECT_TYPE,
-        KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM,
-        KMIP_TAG_CRYPTOGRAPHIC_LENGTH,
-        KMIP_TAG_OPERATION_POLICY_NAME,
-        KMIP_TAG_CRYPTOGRAPHIC_USAGE_MASK,
-        KMIP_TAG_STATE
-    };
+        case KMIP_REASON_MULTI_VALUED_ATTRIBUTE:
+        printf("Multi Valued Attribute");
+        break;
 
-    for(size_t i = 0; i < ARRAY_LENGTH(attribute_tags); i++)
-    {
-        if(attribute_tags[i] == value)
-        {
-            return(KMIP_TRUE);
-        }
-    }
+        case KMIP_REASON_UNSUPPORTED_ATTRIBUTE:
+        printf("Unsupported Attribute");
+        break;
 
-    return(KMIP_FALSE);
-}
+        case KMIP_REASON_ATTRIBUTE_INSTANCE_NOT_FOUND:
+        printf("Attribute Instance Not Found");
+        break;
 
-/*
-Initialization Functions
-*/
+        case KMIP_REASON_ATTRIBUTE_NOT_FOUND:
+        printf("Attribute Not Found");
+        break;
 
-void
-kmip_init_application_specific_information(ApplicationSpecificInformation *value)
-{
-    if(value == NULL)
-    {
-        return;
-    }
+        case KMIP_REASON_ATTRIBUTE_READ_ONLY:
+        printf("Attribute Read Only");
+        break;
 
-    value->application_namespace = NULL;
-    value->application_data = NULL;
-}
+        case KMIP_REASON_ATTRIBUTE_SINGLE_VALUED:
+        printf("Attribute Single Valued");
+        break;
 
-void
-kmip_init_protocol_version(ProtocolVersion *value, enum kmip_version kmip_version)
-{
-    if(value == NULL)
-    {
-        return;
-    }
-    
-    switch(kmip_version)
-    {
-        case KMIP_2_0:
-        {
-            value->major = 2;
-            value->minor = 0;
-        };
+        case KMIP_REASON_BAD_CRYPTOGRAPHIC_PARAMETERS:
+        printf("Bad Cryptographic Parameters");
         break;
 
-        case KMIP_1_4:
-        {
-            value->major = 1;
-            value->minor = 4;
-        };
+        case KMIP_REASON_BAD_PASSWORD:
+        printf("Bad Password");
         break;
-        
-        case KMIP_1_3:
-        {
-            value->major = 1;
-            value->minor = 3;
-        };
+
+        case KMIP_REASON_CODEC_ERROR:
+        printf("Codec Error");
         break;
-        
-        case KMIP_1_2:
-        {
-            value->major = 1;
-            value->minor = 2;
-        };
+
+        case KMIP_REASON_ILLEGAL_OBJECT_TYPE:
+        printf("Illegal Object Type");
         break;
-        
-        case KMIP_1_1:
-        {
-            value->major = 1;
-            value->minor = 1;
-        };
+
+        case KMIP_REASON_INCOMPATIBLE_CRYPTOGRAPHIC_USAGE_MASK:
+        printf("Incompatible Cryptographic Usage Mask");
         break;
-        
-        case KMIP_1_0:
-        default:
-        {
-            value->major = 1;
-            value->minor = 0;
-        };
+
+        case KMIP_REASON_INTERNAL_SERVER_ERROR:
+        printf("Internal Server Error");
         break;
-    };
-}
 
-void
-kmip_init_attribute(Attribute *value)
-{
-    if(value == NULL)
-    {
-        return;
-    }
-    
-    value->type = 0;
-    value->index = KMIP_UNSET;
-    value->value = NULL;
-}
+        case KMIP_REASON_INVALID_ASYNCHRONOUS_CORRELATION_VALUE:
+        printf("Invalid Asynchronous Correlation Value");
+        break;
 
-void
-kmip_init_cryptographic_parameters(CryptographicParameters *value)
-{
-    if(value == NULL)
-    {
-        return;
-    }
-    
-    value->block_cipher_mode = 0;
-    value->padding_method = 0;
-    value->hashing_algorithm = 0;
-    value->key_role_type = 0;
-    
-    value->digital_signature_algorithm = 0;
-    value->cryptographic_algorithm = 0;
-    value->random_iv = KMIP_UNSET;
-    value->iv_length = KMIP_UNSET;
-    value->tag_length = KMIP_UNSET;
-    value->fixed_field_length = KMIP_UNSET;
-    value->invocation_field_length = KMIP_UNSET;
-    value->counter_length = KMIP_UNSET;
-    value->initial_counter_value = KMIP_UNSET;
-    
-    value->salt_length = KMIP_UNSET;
-    value->mask_generator = 0;
-    value->mask_generator_hashing_algorithm = 0;
-    value->p_source = NULL;
-    value->trailer_field = KMIP_UNSET;
-}
+        case KMIP_REASON_INVALID_ATTRIBUTE:
+        printf("Invalid Attribute");
+        break;
 
-void
-kmip_init_key_block(KeyBlock *value)
-{
-    if(value == NULL)
-    {
-        return;
-    }
-    
-    value->key_format_type = 0;
-    value->key_compression_type = 0;
-    value->key_value = NULL;
-    value->key_value_type = 0;
-    value->cryptographic_algorithm = 0;
-    value->cryptographic_length = KMIP_UNSET;
-    value->key_wrapping_data = NULL;
-}
+        case KMIP_REASON_INVALID_ATTRIBUTE_VALUE:
+        printf("Invalid Attribute Value");
+        break;
 
-void
-kmip_init_request_header(RequestHeader *value)
-{
-    if(value == NULL)
-    {
-        return;
-    }
-    
-    value->protocol_version = NULL;
-    value->maximum_response_size = KMIP_UNSET;
-    value->asynchronous_indicator = KMIP_UNSET;
-    value->authentication = NULL;
-    value->batch_error_continuation_option = 0;
-    value->batch_order_option = KMIP_UNSET;
-    value->time_stamp = 0;
-    value->batch_count = KMIP_UNSET;
-    
-    value->attestation_capable_indicator = KMIP_UNSET;
-    value->attestation_types = NULL;
-    value->attestation_type_count = 0;
-    
-    value->client_correlation_value = NULL;
-    value->server_correlation_value = NULL;
-}
+        case KMIP_REASON_INVALID_CORRELATION_VALUE:
+        printf("Invalid Correlation Value");
+        break;
 
-void
-kmip_init_response_header(ResponseHeader *value)
-{
-    if(value == NULL)
-    {
-        return;
-    }
-    
-    value->protocol_version = NULL;
-    value->time_stamp = 0;
-    value->batch_count = KMIP_UNSET;
-    
-    value->nonce = NULL;
-    value->attestation_types = NULL;
-    value->attestation_type_count = 0;
-    
-    value->client_correlation_value = NULL;
-    value->server_correlation_value = NULL;
+        case KMIP_REASON_INVALID_CSR:
+        printf("Invalid CSR");
+        break;
+
+        case KMIP_REASON_INVALID_OBJECT_TYPE:
+        printf("Invalid Object Type");
+        break;
+
+        case KMIP_REASON_KEY_WRAP_TYPE_NOT_SUPPORTED:
+        printf("Key Wrap Type Not Supported");
+        break;
+
+        case KMIP_REASON_MISSING_INITIALIZATION_VECTOR:
+        printf("Missing Initialization Vector");
+        break;
+
+        case KMIP_REASON_NON_UNIQUE_NAME_ATTRIBUTE:
+        printf("Non Unique Name Attribute");
+        break;
+
+        case KMIP_REASON_OBJECT_DESTROYED:
+        printf("Object Destroyed");
+        break;
 
-    value->server_hashed_password = NULL;
-}
+        case KMIP_REASON_OBJECT_NOT_FOUND:
+        printf("Object Not Found");
+        break;
 
-void
-kmip_init_request_batch_item(RequestBatchItem *value)
-{
-    if(value == NULL)
-    {
-        return;
-    }
+        case KMIP_REASON_NOT_AUTHORISED:
+        printf("Not Authorised");
+        break;
 
-    value->operation = 0;
-    value->unique_batch_item_id = NULL;
-    value->request_payload = NULL;
+        case KMIP_REASON_SERVER_LIMIT_EXCEEDED:
+        printf("Server Limit Exceeded");
+        break;
 
-    value->ephemeral = KMIP_UNSET;
-}
+        case KMIP_REASON_UNKNOWN_ENUMERATION:
+        printf("Unknown Enumeration");
+        break;
 
-/*
-Printing Functions
-*/
+        case KMIP_REASON_UNKNOWN_MESSAGE_EXTENSION:
+        printf("Unknown Message Extension");
+        break;
 
-void
-kmip_print_buffer(void *buffer, int size)
-{
-    if(buffer == NULL)
-    {
-        return;
-    }
-    
-    uint8 *index = (uint8 *)buffer;
-    for(int i = 0; i < size; i++)
-    {
-        if(i % 16 == 0)
-        {
-            printf("\n0x");
-        }
-        printf("%02X", index[i]);
-    }
-}
+        case KMIP_REASON_UNKNOWN_TAG:
+        printf("Unknown Tag");
+        break;
 
-void
-kmip_print_stack_trace(KMIP *ctx)
-{
-    if(ctx == NULL)
-    {
-        return;
-    }
-    
-    ErrorFrame *index = ctx->frame_index;
-    do
-    {
-        printf("- %s @ line: %d\n", index->function, index->line);
-    } while(index-- != ctx->errors);
-}
+        case KMIP_REASON_UNSUPPORTED_CRYPTOGRAPHIC_PARAMETERS:
+        printf("Unsupported Cryptographic Parameters");
+        break;
 
-void
-kmip_print_error_string(int value)
-{
-    /* TODO (ph) Move this to a static string array. */
-    switch(value)
-    {
-        case 0:
-        {
-            printf("KMIP_OK");
-        } break;
-        
-        case -1:
-        {
-            printf("KMIP_NOT_IMPLEMENTED");
-        } break;
-        
-        case -2:
-        {
-            printf("KMIP_ERROR_BUFFER_FULL");
-        } break;
-        
-        case -3:
-        {
-            printf("KMIP_ERROR_ATTR_UNSUPPORTED");
-        } break;
-        
-        case -4:
-        {
-            printf("KMIP_TAG_MISMATCH");
-        } break;
-        
-        case -5:
-        {
-            printf("KMIP_TYPE_MISMATCH");
-        } break;
-        
-        case -6:
-        {
-            printf("KMIP_LENGTH_MISMATCH");
-        } break;
-        
-        case -7:
-        {
-            printf("KMIP_PADDING_MISMATCH");
-        } break;
-        
-        case -8:
-        {
-            printf("KMIP_BOOLEAN_MISMATCH");
-        } break;
-        
-        case -9:
-        {
-            printf("KMIP_ENUM_MISMATCH");
-        } break;
-        
-        case -10:
-        {
-            printf("KMIP_ENUM_UNSUPPORTED");
-        } break;
-        
-        case -11:
-        {
-            printf("KMIP_INVALID_FOR_VERSION");
-        } break;
-        
-        case -12:
-        {
-            printf("KMIP_MEMORY_ALLOC_FAILED");
-        } break;
+        case KMIP_REASON_UNSUPPORTED_PROTOCOL_VERSION:
+        printf("Unsupported Protocol Version");
+        break;
 
-        case -13:
-        {
-            printf("KMIP_IO_FAILURE");
-        } break;
+        case KMIP_REASON_WRAPPING_OBJECT_ARCHIVED:
+        printf("Wrapping Object Archived");
+        break;
 
-        case -14:
-        {
-            printf("KMIP_EXCEED_MAX_MESSAGE_SIZE");
-        } break;
+        case KMIP_REASON_WRAPPING_OBJECT_DESTROYED:
+        printf("Wrapping Object Destroyed");
+        break;
 
-        case -15:
-        {
-            printf("KMIP_MALFORMED_RESPONSE");
-        } break;
+        case KMIP_REASON_WRAPPING_OBJECT_NOT_FOUND:
+        printf("Wrapping Object Not Found");
+        break;
 
-        case -16:
-        {
-            printf("KMIP_OBJECT_MISMATCH");
-        } break;
+        case KMIP_REASON_WRONG_KEY_LIFECYCLE_STATE:
+        printf("Wrong Key Lifecycle State");
+        break;
 
-        case -17:
-        {
-            printf("KMIP_ARG_INVALID");
-        } break;
+        case KMIP_REASON_PROTECTION_STORAGE_UNAVAILABLE:
+        printf("Protection Storage Unavailable");
+        break;
 
-        case -18:
-        {
-            printf("KMIP_ERROR_BUFFER_UNDERFULL");
-        } break;
+        case KMIP_REASON_PKCS11_CODEC_ERROR:
+        printf("PKCS#11 Codec Error");
+        break;
+
+        case KMIP_REASON_PKCS11_INVALID_FUNCTION:
+        printf("PKCS#11 Invalid Function");
+        break;
+
+        case KMIP_REASON_PKCS11_INVALID_INTERFACE:
+        printf("PKCS#11 Invalid Interface");
+        break;
+
+        case KMIP_REASON_PRIVATE_PROTECTION_STORAGE_UNAVAILABLE:
+        printf("Private Protection Storage Unavailable");
+        break;
+
+        case KMIP_REASON_PUBLIC_PROTECTION_STORAGE_UNAVAILABLE:
+        printf("Public Protection Storage Unavailable");
+        break;
 
         default:
-        {
-            printf("Unrecognized Error Code");
-        } break;
+        printf("Unknown");
+        break;
     };
-    
-    return;
 }
 
 void
-kmip_print_attestation_type_enum(enum attestation_type value)
+kmip_print_object_type_enum(enum object_type value)
 {
     if(value == 0)
     {
@@ -1890,45 +3592,44 @@ kmip_print_attestation_type_enum(enum attestation_type value)
     
     switch(value)
     {
-        case KMIP_ATTEST_TPM_QUOTE:
-        printf("TPM Quote");
+        case KMIP_OBJTYPE_CERTIFICATE:
+        printf("Certificate");
         break;
         
-        case KMIP_ATTEST_TCG_INTEGRITY_REPORT:
-        printf("TCG Integrity Report");
+        case KMIP_OBJTYPE_SYMMETRIC_KEY:
+        printf("Symmetric Key");
         break;
         
-        case KMIP_ATTEST_SAML_ASSERTION:
-        printf("SAML Assertion");
+        case KMIP_OBJTYPE_PUBLIC_KEY:
+        printf("Public Key");
         break;
         
-        default:
-        printf("Unknown");
+        case KMIP_OBJTYPE_PRIVATE_KEY:
+        printf("Private Key");
         break;
-    };
-}
-
-void
-kmip_print_batch_error_continuation_option(enum batch_error_continuation_option value)
-{
-    if(value == 0)
-    {
-        printf("-");
-        return;
-    }
-    
-    switch(value)
-    {
-        case KMIP_BATCH_CONTINUE:
-        printf("Continue");
+        
+        case KMIP_OBJTYPE_SPLIT_KEY:
+        printf("Split Key");
         break;
         
-        case KMIP_BATCH_STOP:
-        printf("Stop");
+        case KMIP_OBJTYPE_TEMPLATE:
+        printf("Template");
         break;
         
-        case KMIP_BATCH_UNDO:
-        printf("Undo");
+        case KMIP_OBJTYPE_SECRET_DATA:
+        printf("Secret Data");
+        break;
+        
+        case KMIP_OBJTYPE_OPAQUE_OBJECT:
+        printf("Opaque Object");
+        break;
+        
+        case KMIP_OBJTYPE_PGP_KEY:
+        printf("PGP Key");
+        break;
+
+        case KMIP_OBJTYPE_CERTIFICATE_REQUEST:
+        printf("Certificate Request");
         break;
         
         default:
@@ -1938,7 +3639,7 @@ kmip_print_batch_error_continuation_option(enum batch_error_continuation_option
 }
 
 void
-kmip_print_operation_enum(enum operation value)
+kmip_print_key_format_type_enum(enum key_format_type value)
 {
     if(value == 0)
     {
@@ -1948,45 +3649,98 @@ kmip_print_operation_enum(enum operation value)
     
     switch(value)
     {
-        case KMIP_OP_CREATE:
-        printf("Create");
+        case KMIP_KEYFORMAT_RAW:
+        printf("Raw");
         break;
         
-        case KMIP_OP_GET:
-        printf("Get");
+        case KMIP_KEYFORMAT_OPAQUE:
+        printf("Opaque");
         break;
         
-        case KMIP_OP_DESTROY:
-        printf("Destroy");
+        case KMIP_KEYFORMAT_PKCS1:
+        printf("PKCS1");
         break;
         
-        default:
-        printf("Unknown");
+        case KMIP_KEYFORMAT_PKCS8:
+        printf("PKCS8");
         break;
-    };
-}
-
-void
-kmip_print_result_status_enum(enum result_status value)
-{
-    switch(value)
-    {
-        case KMIP_STATUS_SUCCESS:
-        printf("Success");
+        
+        case KMIP_KEYFORMAT_X509:
+        printf("X509");
         break;
         
-        case KMIP_STATUS_OPERATION_FAILED:
-        printf("Operation Failed");
+        case KMIP_KEYFORMAT_EC_PRIVATE_KEY:
+        printf("EC Private Key");
         break;
         
-        case KMIP_STATUS_OPERATION_PENDING:
-        printf("Operation Pending");
+        case KMIP_KEYFORMAT_TRANS_SYMMETRIC_KEY:
+        printf("Transparent Symmetric Key");
         break;
         
-        case KMIP_STATUS_OPERATION_UNDONE:
-        printf("Operation Undone");
+        case KMIP_KEYFORMAT_TRANS_DSA_PRIVATE_KEY:
+        printf("Transparent DSA Private Key");
+        break;
+        
+        case KMIP_KEYFORMAT_TRANS_DSA_PUBLIC_KEY:
+        printf("Transparent DSA Public Key");
+        break;
+        
+        case KMIP_KEYFORMAT_TRANS_RSA_PRIVATE_KEY:
+        printf("Transparent RSA Private Key");
+        break;
+        
+        case KMIP_KEYFORMAT_TRANS_RSA_PUBLIC_KEY:
+        printf("Transparent RSA Public Key");
+        break;
+        
+        case KMIP_KEYFORMAT_TRANS_DH_PRIVATE_KEY:
+        printf("Transparent DH Private Key");
         break;
         
+        case KMIP_KEYFORMAT_TRANS_DH_PUBLIC_KEY:
+        printf("Transparent DH Public Key");
+        break;
+        
+        case KMIP_KEYFORMAT_TRANS_ECDSA_PRIVATE_KEY:
+        printf("Transparent ECDSA Private Key");
+        break;
+        
+        case KMIP_KEYFORMAT_TRANS_ECDSA_PUBLIC_KEY:
+        printf("Transparent ECDSA Public Key");
+        break;
+        
+        case KMIP_KEYFORMAT_TRANS_ECDH_PRIVATE_KEY:
+        printf("Transparent ECDH Private Key");
+        break;
+        
+        case KMIP_KEYFORMAT_TRANS_ECDH_PUBLIC_KEY:
+        printf("Transparent ECDH Public Key");
+        break;
+        
+        case KMIP_KEYFORMAT_TRANS_ECMQV_PRIVATE_KEY:
+        printf("Transparent ECMQV Private Key");
+        break;
+        
+        case KMIP_KEYFORMAT_TRANS_ECMQV_PUBLIC_KEY:
+        printf("Transparent ECMQV Public Key");
+        break;
+        
+        case KMIP_KEYFORMAT_TRANS_EC_PRIVATE_KEY:
+        printf("Transparent EC Private Key");
+        break;
+        
+        case KMIP_KEYFORMAT_TRANS_EC_PUBLIC_KEY:
+        printf("Transparent EC Public Key");
+        break;
+        
+        case KMIP_KEYFORMAT_PKCS12:
+        printf("PKCS#12");
+        break;
+        
+        case KMIP_KEYFORMAT_PKCS10:
+        printf("PKCS#10");
+        break;
+
         default:
         printf("Unknown");
         break;
@@ -1994,7 +3748,7 @@ kmip_print_result_status_enum(enum result_status value)
 }
 
 void
-kmip_print_result_reason_enum(enum result_reason value)
+kmip_print_key_compression_type_enum(enum key_compression_type value)
 {
     if(value == 0)
     {
@@ -2004,286 +3758,263 @@ kmip_print_result_reason_enum(enum result_reason value)
     
     switch(value)
     {
-        case KMIP_REASON_GENERAL_FAILURE:
-        printf("General Failure");
-        break;
-        
-        case KMIP_REASON_ITEM_NOT_FOUND:
-        printf("Item Not Found");
-        break;
-        
-        case KMIP_REASON_RESPONSE_TOO_LARGE:
-        printf("Response Too Large");
-        break;
-        
-        case KMIP_REASON_AUTHENTICATION_NOT_SUCCESSFUL:
-        printf("Authentication Not Successful");
+        case KMIP_KEYCOMP_EC_PUB_UNCOMPRESSED:
+        printf("EC Public Key Type Uncompressed");
         break;
         
-        case KMIP_REASON_INVALID_MESSAGE:
-        printf("Invalid Message");
+        case KMIP_KEYCOMP_EC_PUB_X962_COMPRESSED_PRIME:
+        printf("EC Public Key Type X9.62 Compressed Prime");
         break;
         
-        case KMIP_REASON_OPERATION_NOT_SUPPORTED:
-        printf("Operation Not Supported");
+        case KMIP_KEYCOMP_EC_PUB_X962_COMPRESSED_CHAR2:
+        printf("EC Public Key Type X9.62 Compressed Char2");
         break;
         
-        case KMIP_REASON_MISSING_DATA:
-        printf("Missing Data");
+        case KMIP_KEYCOMP_EC_PUB_X962_HYBRID:
+        printf("EC Public Key Type X9.62 Hybrid");
         break;
         
-        case KMIP_REASON_INVALID_FIELD:
-        printf("Invalid Field");
+        default:
+        printf("Unknown");
         break;
-        
-        case KMIP_REASON_FEATURE_NOT_SUPPORTED:
-        printf("Feature Not Supported");
+    };
+}
+
+void
+kmip_print_cryptographic_algorithm_enum(enum cryptographic_algorithm value)
+{
+    if(value == 0)
+    {
+        printf("-");
+        return;
+    }
+    
+    switch(value)
+    {
+        case KMIP_CRYPTOALG_DES:
+        printf("DES");
         break;
         
-        case KMIP_REASON_OPERATION_CANCELED_BY_REQUESTER:
-        printf("Operation Canceled By Requester");
+        case KMIP_CRYPTOALG_TRIPLE_DES:
+        printf("3DES");
         break;
         
-        case KMIP_REASON_CRYPTOGRAPHIC_FAILURE:
-        printf("Cryptographic Failure");
+        case KMIP_CRYPTOALG_AES:
+        printf("AES");
         break;
         
-        case KMIP_REASON_ILLEGAL_OPERATION:
-        printf("Illegal Operation");
+        case KMIP_CRYPTOALG_RSA:
+        printf("RSA");
         break;
         
-        case KMIP_REASON_PERMISSION_DENIED:
-        printf("Permission Denied");
+        case KMIP_CRYPTOALG_DSA:
+        printf("DSA");
         break;
         
-        case KMIP_REASON_OBJECT_ARCHIVED:
-        printf("Object Archived");
+        case KMIP_CRYPTOALG_ECDSA:
+        printf("ECDSA");
         break;
         
-        case KMIP_REASON_INDEX_OUT_OF_BOUNDS:
-        printf("Index Out Of Bounds");
+        case KMIP_CRYPTOALG_HMAC_SHA1:
+        printf("SHA1");
         break;
         
-        case KMIP_REASON_APPLICATION_NAMESPACE_NOT_SUPPORTED:
-        printf("Application Namespace Not Supported");
+        case KMIP_CRYPTOALG_HMAC_SHA224:
+        printf("SHA224");
         break;
         
-        case KMIP_REASON_KEY_FORMAT_TYPE_NOT_SUPPORTED:
-        printf("Key Format Type Not Supported");
+        case KMIP_CRYPTOALG_HMAC_SHA256:
+        printf("SHA256");
         break;
         
-        case KMIP_REASON_KEY_COMPRESSION_TYPE_NOT_SUPPORTED:
-        printf("Key Compression Type Not Supported");
+        case KMIP_CRYPTOALG_HMAC_SHA384:
+        printf("SHA384");
         break;
         
-        case KMIP_REASON_ENCODING_OPTION_FAILURE:
-        printf("Encoding Option Failure");
+        case KMIP_CRYPTOALG_HMAC_SHA512:
+        printf("SHA512");
         break;
         
-        case KMIP_REASON_KEY_VALUE_NOT_PRESENT:
-        printf("Key Value Not Present");
+        case KMIP_CRYPTOALG_HMAC_MD5:
+        printf("MD5");
         break;
         
-        case KMIP_REASON_ATTESTATION_REQUIRED:
-        printf("Attestation Required");
+        case KMIP_CRYPTOALG_DH:
+        printf("DH");
         break;
         
-        case KMIP_REASON_ATTESTATION_FAILED:
-        printf("Attestation Failed");
+        case KMIP_CRYPTOALG_ECDH:
+        printf("ECDH");
         break;
         
-        case KMIP_REASON_SENSITIVE:
-        printf("Sensitive");
+        case KMIP_CRYPTOALG_ECMQV:
+        printf("ECMQV");
         break;
         
-        case KMIP_REASON_NOT_EXTRACTABLE:
-        printf("Not Extractable");
+        case KMIP_CRYPTOALG_BLOWFISH:
+        printf("Blowfish");
         break;
         
-        case KMIP_REASON_OBJECT_ALREADY_EXISTS:
-        printf("Object Already Exists");
+        case KMIP_CRYPTOALG_CAMELLIA:
+        printf("Camellia");
         break;
         
-        case KMIP_REASON_INVALID_TICKET:
-        printf("Invalid Ticket");
-        break;
-
-        case KMIP_REASON_USAGE_LIMIT_EXCEEDED:
-        printf("Usage Limit Exceeded");
-        break;
-
-        case KMIP_REASON_NUMERIC_RANGE:
-        printf("Numeric Range");
-        break;
-
-        case KMIP_REASON_INVALID_DATA_TYPE:
-        printf("Invalid Data Type");
-        break;
-
-        case KMIP_REASON_READ_ONLY_ATTRIBUTE:
-        printf("Read Only Attribute");
-        break;
-
-        case KMIP_REASON_MULTI_VALUED_ATTRIBUTE:
-        printf("Multi Valued Attribute");
-        break;
-
-        case KMIP_REASON_UNSUPPORTED_ATTRIBUTE:
-        printf("Unsupported Attribute");
-        break;
-
-        case KMIP_REASON_ATTRIBUTE_INSTANCE_NOT_FOUND:
-        printf("Attribute Instance Not Found");
+        case KMIP_CRYPTOALG_CAST5:
+        printf("CAST5");
         break;
-
-        case KMIP_REASON_ATTRIBUTE_NOT_FOUND:
-        printf("Attribute Not Found");
+        
+        case KMIP_CRYPTOALG_IDEA:
+        printf("IDEA");
         break;
-
-        case KMIP_REASON_ATTRIBUTE_READ_ONLY:
-        printf("Attribute Read Only");
+        
+        case KMIP_CRYPTOALG_MARS:
+        printf("MARS");
         break;
-
-        case KMIP_REASON_ATTRIBUTE_SINGLE_VALUED:
-        printf("Attribute Single Valued");
+        
+        case KMIP_CRYPTOALG_RC2:
+        printf("RC2");
         break;
-
-        case KMIP_REASON_BAD_CRYPTOGRAPHIC_PARAMETERS:
-        printf("Bad Cryptographic Parameters");
+        
+        case KMIP_CRYPTOALG_RC4:
+        printf("RC4");
         break;
-
-        case KMIP_REASON_BAD_PASSWORD:
-        printf("Bad Password");
+        
+        case KMIP_CRYPTOALG_RC5:
+        printf("RC5");
         break;
-
-        case KMIP_REASON_CODEC_ERROR:
-        printf("Codec Error");
+        
+        case KMIP_CRYPTOALG_SKIPJACK:
+        printf("Skipjack");
         break;
-
-        case KMIP_REASON_ILLEGAL_OBJECT_TYPE:
-        printf("Illegal Object Type");
+        
+        case KMIP_CRYPTOALG_TWOFISH:
+        printf("Twofish");
         break;
-
-        case KMIP_REASON_INCOMPATIBLE_CRYPTOGRAPHIC_USAGE_MASK:
-        printf("Incompatible Cryptographic Usage Mask");
+        
+        case KMIP_CRYPTOALG_EC:
+        printf("EC");
         break;
-
-        case KMIP_REASON_INTERNAL_SERVER_ERROR:
-        printf("Internal Server Error");
+        
+        case KMIP_CRYPTOALG_ONE_TIME_PAD:
+        printf("One Time Pad");
         break;
-
-        case KMIP_REASON_INVALID_ASYNCHRONOUS_CORRELATION_VALUE:
-        printf("Invalid Asynchronous Correlation Value");
+        
+        case KMIP_CRYPTOALG_CHACHA20:
+        printf("ChaCha20");
         break;
-
-        case KMIP_REASON_INVALID_ATTRIBUTE:
-        printf("Invalid Attribute");
+        
+        case KMIP_CRYPTOALG_POLY1305:
+        printf("Poly1305");
         break;
-
-        case KMIP_REASON_INVALID_ATTRIBUTE_VALUE:
-        printf("Invalid Attribute Value");
+        
+        case KMIP_CRYPTOALG_CHACHA20_POLY1305:
+        printf("ChaCha20 Poly1305");
         break;
-
-        case KMIP_REASON_INVALID_CORRELATION_VALUE:
-        printf("Invalid Correlation Value");
+        
+        case KMIP_CRYPTOALG_SHA3_224:
+        printf("SHA3-224");
         break;
-
-        case KMIP_REASON_INVALID_CSR:
-        printf("Invalid CSR");
+        
+        case KMIP_CRYPTOALG_SHA3_256:
+        printf("SHA3-256");
         break;
-
-        case KMIP_REASON_INVALID_OBJECT_TYPE:
-        printf("Invalid Object Type");
+        
+        case KMIP_CRYPTOALG_SHA3_384:
+        printf("SHA3-384");
         break;
-
-        case KMIP_REASON_KEY_WRAP_TYPE_NOT_SUPPORTED:
-        printf("Key Wrap Type Not Supported");
+        
+        case KMIP_CRYPTOALG_SHA3_512:
+        printf("SHA3-512");
         break;
-
-        case KMIP_REASON_MISSING_INITIALIZATION_VECTOR:
-        printf("Missing Initialization Vector");
+        
+        case KMIP_CRYPTOALG_HMAC_SHA3_224:
+        printf("HMAC SHA3-224");
         break;
-
-        case KMIP_REASON_NON_UNIQUE_NAME_ATTRIBUTE:
-        printf("Non Unique Name Attribute");
+        
+        case KMIP_CRYPTOALG_HMAC_SHA3_256:
+        printf("HMAC SHA3-256");
         break;
-
-        case KMIP_REASON_OBJECT_DESTROYED:
-        printf("Object Destroyed");
+        
+        case KMIP_CRYPTOALG_HMAC_SHA3_384:
+        printf("HMAC SHA3-384");
         break;
-
-        case KMIP_REASON_OBJECT_NOT_FOUND:
-        printf("Object Not Found");
+        
+        case KMIP_CRYPTOALG_HMAC_SHA3_512:
+        printf("HMAC SHA3-512");
         break;
-
-        case KMIP_REASON_NOT_AUTHORISED:
-        printf("Not Authorised");
+        
+        case KMIP_CRYPTOALG_SHAKE_128:
+        printf("SHAKE-128");
         break;
-
-        case KMIP_REASON_SERVER_LIMIT_EXCEEDED:
-        printf("Server Limit Exceeded");
+        
+        case KMIP_CRYPTOALG_SHAKE_256:
+        printf("SHAKE-256");
         break;
-
-        case KMIP_REASON_UNKNOWN_ENUMERATION:
-        printf("Unknown Enumeration");
+        
+        case KMIP_CRYPTOALG_ARIA:
+        printf("ARIA");
         break;
 
-        case KMIP_REASON_UNKNOWN_MESSAGE_EXTENSION:
-        printf("Unknown Message Extension");
+        case KMIP_CRYPTOALG_SEED:
+        printf("SEED");
         break;
 
-        case KMIP_REASON_UNKNOWN_TAG:
-        printf("Unknown Tag");
+        case KMIP_CRYPTOALG_SM2:
+        printf("SM2");
         break;
 
-        case KMIP_REASON_UNSUPPORTED_CRYPTOGRAPHIC_PARAMETERS:
-        printf("Unsupported Cryptographic Parameters");
+        case KMIP_CRYPTOALG_SM3:
+        printf("SM3");
         break;
 
-        case KMIP_REASON_UNSUPPORTED_PROTOCOL_VERSION:
-        printf("Unsupported Protocol Version");
+        case KMIP_CRYPTOALG_SM4:
+        printf("SM4");
         break;
 
-        case KMIP_REASON_WRAPPING_OBJECT_ARCHIVED:
-        printf("Wrapping Object Archived");
+        case KMIP_CRYPTOALG_GOST_R_34_10_2012:
+        printf("GOST R 34.10-2012");
         break;
 
-        case KMIP_REASON_WRAPPING_OBJECT_DESTROYED:
-        printf("Wrapping Object Destroyed");
+        case KMIP_CRYPTOALG_GOST_R_34_11_2012:
+        printf("GOST R 34.11-2012");
         break;
 
-        case KMIP_REASON_WRAPPING_OBJECT_NOT_FOUND:
-        printf("Wrapping Object Not Found");
+        case KMIP_CRYPTOALG_GOST_R_34_13_2015:
+        printf("GOST R 34.13-2015");
         break;
 
-        case KMIP_REASON_WRONG_KEY_LIFECYCLE_STATE:
-        printf("Wrong Key Lifecycle State");
+        case KMIP_CRYPTOALG_GOST_28147_89:
+        printf("GOST 28147-89");
         break;
 
-        case KMIP_REASON_PROTECTION_STORAGE_UNAVAILABLE:
-        printf("Protection Storage Unavailable");
+        case KMIP_CRYPTOALG_XMSS:
+        printf("XMSS");
         break;
 
-        case KMIP_REASON_PKCS11_CODEC_ERROR:
-        printf("PKCS#11 Codec Error");
+        case KMIP_CRYPTOALG_SPHINCS_256:
+        printf("SPHINCS-256");
         break;
 
-        case KMIP_REASON_PKCS11_INVALID_FUNCTION:
-        printf("PKCS#11 Invalid Function");
+        case KMIP_CRYPTOALG_MCELIECE:
+        printf("McEliece");
         break;
 
-        case KMIP_REASON_PKCS11_INVALID_INTERFACE:
-        printf("PKCS#11 Invalid Interface");
+        case KMIP_CRYPTOALG_MCELIECE_6960119:
+        printf("McEliece 6960119");
         break;
 
-        case KMIP_REASON_PRIVATE_PROTECTION_STORAGE_UNAVAILABLE:
-        printf("Private Protection Storage Unavailable");
+        case KMIP_CRYPTOALG_MCELIECE_8192128:
+        printf("McEliece 8192128");
         break;
 
-        case KMIP_REASON_PUBLIC_PROTECTION_STORAGE_UNAVAILABLE:
-        printf("Public Protection Storage Unavailable");
+        case KMIP_CRYPTOALG_ED25519:
+        printf("Ed25519");
         break;
 
+        case KMIP_CRYPTOALG_ED448:
+        printf("Ed448");
+        break;
+        
         default:
         printf("Unknown");
         break;
@@ -2291,7 +4022,7 @@ kmip_print_result_reason_enum(enum result_reason value)
 }
 
 void
-kmip_print_object_type_enum(enum object_type value)
+kmip_print_name_type_enum(enum name_type value)
 {
     if(value == 0)
     {
@@ -2301,44 +4032,72 @@ kmip_print_object_type_enum(enum object_type value)
     
     switch(value)
     {
-        case KMIP_OBJTYPE_CERTIFICATE:
-        printf("Certificate");
-        break;
-        
-        case KMIP_OBJTYPE_SYMMETRIC_KEY:
-        printf("Symmetric Key");
+        case KMIP_NAME_UNINTERPRETED_TEXT_STRING:
+        printf("Uninterpreted Text String");
         break;
         
-        case KMIP_OBJTYPE_PUBLIC_KEY:
-        printf("Public Key");
+        case KMIP_NAME_URI:
+        printf("URI");
         break;
         
-        case KMIP_OBJTYPE_PRIVATE_KEY:
-        printf("Private Key");
+        default:
+        printf("Unknown");
         break;
-        
-        case KMIP_OBJTYPE_SPLIT_KEY:
-        printf("Split Key");
+    };
+}
+
+void
+kmip_print_attribute_type_enum(enum attribute_type value)
+{
+    if((int)value == KMIP_UNSET)
+    {
+        printf("-");
+        return;
+    }
+    
+    const char *name = kmip_get_attribute_name(value, NULL);
+    if(name == NULL)
+    {
+        printf("Unknown");
+        return;
+    }
+    
+    printf("%s", name);
+}
+
+void
+kmip_print_state_enum(enum state value)
+{
+    if(value == 0)
+    {
+        printf("-");
+        return;
+    }
+    
+    switch(value)
+    {
+        case KMIP_STATE_PRE_ACTIVE:
+        printf("Pre-Active");
         break;
         
-        case KMIP_OBJTYPE_TEMPLATE:
-        printf("Template");
+        case KMIP_STATE_ACTIVE:
+        printf("Active");
         break;
         
-        case KMIP_OBJTYPE_SECRET_DATA:
-        printf("Secret Data");
+        case KMIP_STATE_DEACTIVATED:
+        printf("Deactivated");
         break;
         
-        case KMIP_OBJTYPE_OPAQUE_OBJECT:
-        printf("Opaque Object");
+        case KMIP_STATE_COMPROMISED:
+        printf("Compromised");
         break;
         
-        case KMIP_OBJTYPE_PGP_KEY:
-        printf("PGP Key");
+        case KMIP_STATE_DESTROYED:
+        printf("Destroyed");
         break;
-
-        case KMIP_OBJTYPE_CERTIFICATE_REQUEST:
-        printf("Certificate Request");
+        
+        case KMIP_STATE_DESTROYED_COMPROMISED:
+        printf("Destroyed Compromised");
         break;
         
         default:
@@ -2348,7 +4107,7 @@ kmip_print_object_type_enum(enum object_type value)
 }
 
 void
-kmip_print_key_format_type_enum(enum key_format_type value)
+kmip_print_block_cipher_mode_enum(enum block_cipher_mode value)
 {
     if(value == 0)
     {
@@ -2358,98 +4117,78 @@ kmip_print_key_format_type_enum(enum key_format_type value)
     
     switch(value)
     {
-        case KMIP_KEYFORMAT_RAW:
-        printf("Raw");
-        break;
-        
-        case KMIP_KEYFORMAT_OPAQUE:
-        printf("Opaque");
-        break;
-        
-        case KMIP_KEYFORMAT_PKCS1:
-        printf("PKCS1");
-        break;
-        
-        case KMIP_KEYFORMAT_PKCS8:
-        printf("PKCS8");
-        break;
-        
-        case KMIP_KEYFORMAT_X509:
-        printf("X509");
+        case KMIP_BLOCK_CBC:
+        printf("CBC");
         break;
         
-        case KMIP_KEYFORMAT_EC_PRIVATE_KEY:
-        printf("EC Private Key");
+        case KMIP_BLOCK_ECB:
+        printf("ECB");
         break;
         
-        case KMIP_KEYFORMAT_TRANS_SYMMETRIC_KEY:
-        printf("Transparent Symmetric Key");
+        case KMIP_BLOCK_PCBC:
+        printf("PCBC");
         break;
         
-        case KMIP_KEYFORMAT_TRANS_DSA_PRIVATE_KEY:
-        printf("Transparent DSA Private Key");
+        case KMIP_BLOCK_CFB:
+        printf("CFB");
         break;
         
-        case KMIP_KEYFORMAT_TRANS_DSA_PUBLIC_KEY:
-        printf("Transparent DSA Public Key");
+        case KMIP_BLOCK_OFB:
+        printf("OFB");
         break;
         
-        case KMIP_KEYFORMAT_TRANS_RSA_PRIVATE_KEY:
-        printf("Transparent RSA Private Key");
+        case KMIP_BLOCK_CTR:
+        printf("CTR");
         break;
         
-        case KMIP_KEYFORMAT_TRANS_RSA_PUBLIC_KEY:
-        printf("Transparent RSA Public Key");
+        case KMIP_BLOCK_CMAC:
+        printf("CMAC");
         break;
         
-        case KMIP_KEYFORMAT_TRANS_DH_PRIVATE_KEY:
-        printf("Transparent DH Private Key");
+        case KMIP_BLOCK_CCM:
+        printf("CCM");
         break;
         
-        case KMIP_KEYFORMAT_TRANS_DH_PUBLIC_KEY:
-        printf("Transparent DH Public Key");
+        case KMIP_BLOCK_GCM:
+        printf("GCM");
         break;
         
-        case KMIP_KEYFORMAT_TRANS_ECDSA_PRIVATE_KEY:
-        printf("Transparent ECDSA Private Key");
+        case KMIP_BLOCK_CBC_MAC:
+        printf("CBC-MAC");
         break;
         
-        case KMIP_KEYFORMAT_TRANS_ECDSA_PUBLIC_KEY:
-        printf("Transparent ECDSA Public Key");
+        case KMIP_BLOCK_XTS:
+        printf("XTS");
         break;
         
-        case KMIP_KEYFORMAT_TRANS_ECDH_PRIVATE_KEY:
-        printf("Transparent ECDH Private Key");
+        case KMIP_BLOCK_AES_KEY_WRAP_PADDING:
+        printf("AESKeyWrapPadding");
         break;
         
-        case KMIP_KEYFORMAT_TRANS_ECDH_PUBLIC_KEY:
-        printf("Transparent ECDH Public Key");
+        case KMIP_BLOCK_NIST_KEY_WRAP:
+        printf("NISTKeyWrap");
         break;
         
-        case KMIP_KEYFORMAT_TRANS_ECMQV_PRIVATE_KEY:
-        printf("Transparent ECMQV Private Key");
+        case KMIP_BLOCK_X9102_AESKW:
+        printf("X9.102 AESKW");
         break;
         
-        case KMIP_KEYFORMAT_TRANS_ECMQV_PUBLIC_KEY:
-        printf("Transparent ECMQV Public Key");
+        case KMIP_BLOCK_X9102_TDKW:
+        printf("X9.102 TDKW");
         break;
         
-        case KMIP_KEYFORMAT_TRANS_EC_PRIVATE_KEY:
-        printf("Transparent EC Private Key");
+        case KMIP_BLOCK_X9102_AKW1:
+        printf("X9.102 AKW1");
         break;
         
-        case KMIP_KEYFORMAT_TRANS_EC_PUBLIC_KEY:
-        printf("Transparent EC Public Key");
+        case KMIP_BLOCK_X9102_AKW2:
+        printf("X9.102 AKW2");
         break;
         
-        case KMIP_KEYFORMAT_PKCS12:
-        printf("PKCS#12");
+        case KMIP_BLOCK_AEAD:
+        printf("AEAD");
         break;
         
-        case KMIP_KEYFORMAT_PKCS10:
-        printf("PKCS#10");
-        break;
-
         default:
         printf("Unknown");
         break;
@@ -2457,7 +4196,7 @@ kmip_print_key_format_type_enum(enum key_format_type value)
 }
 
 void
-kmip_print_key_compression_type_enum(enum key_compression_type value)
+kmip_print_padding_method_enum(enum padding_method value)
 {
     if(value == 0)
     {
@@ -2467,20 +4206,44 @@ kmip_print_key_compression_type_enum(enum key_compression_type value)
     
     switch(value)
     {
-        case KMIP_KEYCOMP_EC_PUB_UNCOMPRESSED:
-        printf("EC Public Key Type Uncompressed");
+        case KMIP_PAD_NONE:
+        printf("None");
         break;
         
-        case KMIP_KEYCOMP_EC_PUB_X962_COMPRESSED_PRIME:
-        printf("EC Public Key Type X9.62 Compressed Prime");
+        case KMIP_PAD_OAEP:
+        printf("OAEP");
         break;
         
-        case KMIP_KEYCOMP_EC_PUB_X962_COMPRESSED_CHAR2:
-        printf("EC Public Key Type X9.62 Compressed Char2");
+        case KMIP_PAD_PKCS5:
+        printf("PKCS5");
         break;
         
-        case KMIP_KEYCOMP_EC_PUB_X962_HYBRID:
-        printf("EC Public Key Type X9.62 Hybrid");
+        case KMIP_PAD_SSL3:
+        printf("SSL3");
+        break;
+        
+        case KMIP_PAD_ZEROS:
+        printf("Zeros");
+        break;
+        
+        case KMIP_PAD_ANSI_X923:
+        printf("ANSI X9.23");
+        break;
+        
+        case KMIP_PAD_ISO_10126:
+        printf("ISO 10126");
+        break;
+        
+        case KMIP_PAD_PKCS1v15:
+        printf("PKCS1 v1.5");
+        break;
+        
+        case KMIP_PAD_X931:
+        printf("X9.31");
+        break;
+        
+        case KMIP_PAD_PSS:
+        printf("PSS");
         break;
         
         default:
@@ -2490,7 +4253,7 @@ kmip_print_key_compression_type_enum(enum key_compression_type value)
 }
 
 void
-kmip_print_cryptographic_algorithm_enum(enum cryptographic_algorithm value)
+kmip_print_hashing_algorithm_enum(enum hashing_algorithm value)
 {
     if(value == 0)
     {
@@ -2500,228 +4263,336 @@ kmip_print_cryptographic_algorithm_enum(enum cryptographic_algorithm value)
     
     switch(value)
     {
-        case KMIP_CRYPTOALG_DES:
-        printf("DES");
+        case KMIP_HASH_MD2:
+        printf("MD2");
         break;
         
-        case KMIP_CRYPTOALG_TRIPLE_DES:
-        printf("3DES");
+        case KMIP_HASH_MD4:
+        printf("MD4");
         break;
         
-        case KMIP_CRYPTOALG_AES:
-        printf("AES");
+        case KMIP_HASH_MD5:
+        printf("MD5");
         break;
         
-        case KMIP_CRYPTOALG_RSA:
-        printf("RSA");
+        case KMIP_HASH_SHA1:
+        printf("SHA-1");
         break;
         
-        case KMIP_CRYPTOALG_DSA:
-        printf("DSA");
+        case KMIP_HASH_SHA224:
+        printf("SHA-224");
         break;
         
-        case KMIP_CRYPTOALG_ECDSA:
-        printf("ECDSA");
+        case KMIP_HASH_SHA256:
+        printf("SHA-256");
         break;
         
-        case KMIP_CRYPTOALG_HMAC_SHA1:
-        printf("SHA1");
+        case KMIP_HASH_SHA384:
+        printf("SHA-384");
         break;
         
-        case KMIP_CRYPTOALG_HMAC_SHA224:
-        printf("SHA224");
+        case KMIP_HASH_SHA512:
+        printf("SHA-512");
         break;
         
-        case KMIP_CRYPTOALG_HMAC_SHA256:
-        printf("SHA256");
+        case KMIP_HASH_RIPEMD160:
+        printf("RIPEMD-160");
+        break;
+        
+        case KMIP_HASH_TIGER:
+        printf("Tiger");
+        break;
+        
+        case KMIP_HASH_WHIRLPOOL:
+        printf("Whirlpool");
+        break;
+        
+        case KMIP_HASH_SHA512_224:
+        printf("SHA-512/224");
+        break;
+        
+        case KMIP_HASH_SHA512_256:
+        printf("SHA-512/256");
+        break;
+        
+        case KMIP_HASH_SHA3_224:
+        printf("SHA-3-224");
+        break;
+        
+        case KMIP_HASH_SHA3_256:
+        printf("SHA-3-256");
+        break;
+        
+        case KMIP_HASH_SHA3_384:
+        printf("SHA-3-384");
+        break;
+        
+        case KMIP_HASH_SHA3_512:
+        printf("SHA-3-512");
+        break;
+        
+        default:
+        printf("Unknown");
+        break;
+    };
+}
+
+void
+kmip_print_key_role_type_enum(enum key_role_type value)
+{
+    if(value == 0)
+    {
+        printf("-");
+        return;
+    }
+    
+    switch(value)
+    {
+        case KMIP_ROLE_BDK:
+        printf("BDK");
+        break;
+        
+        case KMIP_ROLE_CVK:
+        printf("CVK");
+        break;
+        
+        case KMIP_ROLE_DEK:
+        printf("DEK");
+        break;
+        
+        case KMIP_ROLE_MKAC:
+        printf("MKAC");
         break;
         
-        case KMIP_CRYPTOALG_HMAC_SHA384:
-        printf("SHA384");
+        case KMIP_ROLE_MKSMC:
+        printf("MKSMC");
         break;
         
-        case KMIP_CRYPTOALG_HMAC_SHA512:
-        printf("SHA512");
+        case KMIP_ROLE_MKSMI:
+        printf("MKSMI");
         break;
         
-        case KMIP_CRYPTOALG_HMAC_MD5:
-        printf("MD5");
+        case KMIP_ROLE_MKDAC:
+        printf("MKDAC");
         break;
         
-        case KMIP_CRYPTOALG_DH:
-        printf("DH");
+        case KMIP_ROLE_MKDN:
+        printf("MKDN");
         break;
         
-        case KMIP_CRYPTOALG_ECDH:
-        printf("ECDH");
+        case KMIP_ROLE_MKCP:
+        printf("MKCP");
         break;
         
-        case KMIP_CRYPTOALG_ECMQV:
-        printf("ECMQV");
+        case KMIP_ROLE_MKOTH:
+        printf("MKOTH");
         break;
         
-        case KMIP_CRYPTOALG_BLOWFISH:
-        printf("Blowfish");
+        case KMIP_ROLE_KEK:
+        printf("KEK");
         break;
         
-        case KMIP_CRYPTOALG_CAMELLIA:
-        printf("Camellia");
+        case KMIP_ROLE_MAC16609:
+        printf("MAC16609");
         break;
         
-        case KMIP_CRYPTOALG_CAST5:
-        printf("CAST5");
+        case KMIP_ROLE_MAC97971:
+        printf("MAC97971");
         break;
         
-        case KMIP_CRYPTOALG_IDEA:
-        printf("IDEA");
+        case KMIP_ROLE_MAC97972:
+        printf("MAC97972");
         break;
         
-        case KMIP_CRYPTOALG_MARS:
-        printf("MARS");
+        case KMIP_ROLE_MAC97973:
+        printf("MAC97973");
         break;
         
-        case KMIP_CRYPTOALG_RC2:
-        printf("RC2");
+        case KMIP_ROLE_MAC97974:
+        printf("MAC97974");
         break;
         
-        case KMIP_CRYPTOALG_RC4:
-        printf("RC4");
+        case KMIP_ROLE_MAC97975:
+        printf("MAC97975");
         break;
         
-        case KMIP_CRYPTOALG_RC5:
-        printf("RC5");
+        case KMIP_ROLE_ZPK:
+        printf("ZPK");
         break;
         
-        case KMIP_CRYPTOALG_SKIPJACK:
-        printf("Skipjack");
+        case KMIP_ROLE_PVKIBM:
+        printf("PVKIBM");
         break;
         
-        case KMIP_CRYPTOALG_TWOFISH:
-        printf("Twofish");
+        case KMIP_ROLE_PVKPVV:
+        printf("PVKPVV");
         break;
         
-        case KMIP_CRYPTOALG_EC:
-        printf("EC");
+        case KMIP_ROLE_PVKOTH:
+        printf("PVKOTH");
         break;
         
-        case KMIP_CRYPTOALG_ONE_TIME_PAD:
-        printf("One Time Pad");
+        case KMIP_ROLE_DUKPT:
+        printf("DUKPT");
         break;
         
-        case KMIP_CRYPTOALG_CHACHA20:
-        printf("ChaCha20");
+        case KMIP_ROLE_IV:
+        printf("IV");
         break;
         
-        case KMIP_CRYPTOALG_POLY1305:
-        printf("Poly1305");
+        case KMIP_ROLE_TRKBK:
+        printf("TRKBK");
         break;
         
-        case KMIP_CRYPTOALG_CHACHA20_POLY1305:
-        printf("ChaCha20 Poly1305");
+        default:
+        printf("Unknown");
         break;
-        
-        case KMIP_CRYPTOALG_SHA3_224:
-        printf("SHA3-224");
+    };
+}
+
+void
+kmip_print_digital_signature_algorithm_enum(enum digital_signature_algorithm value)
+{
+    if(value == 0)
+    {
+        printf("-");
+        return;
+    }
+    
+    switch(value)
+    {
+        case KMIP_DIGITAL_MD2_WITH_RSA:
+        printf("MD2 with RSA Encryption (PKCS#1 v1.5)");
         break;
         
-        case KMIP_CRYPTOALG_SHA3_256:
-        printf("SHA3-256");
+        case KMIP_DIGITAL_MD5_WITH_RSA:
+        printf("MD5 with RSA Encryption (PKCS#1 v1.5)");
         break;
         
-        case KMIP_CRYPTOALG_SHA3_384:
-        printf("SHA3-384");
+        case KMIP_DIGITAL_SHA1_WITH_RSA:
+        printf("SHA-1 with RSA Encryption (PKCS#1 v1.5)");
         break;
         
-        case KMIP_CRYPTOALG_SHA3_512:
-        printf("SHA3-512");
+        case KMIP_DIGITAL_SHA224_WITH_RSA:
+        printf("SHA-224 with RSA Encryption (PKCS#1 v1.5)");
         break;
         
-        case KMIP_CRYPTOALG_HMAC_SHA3_224:
-        printf("HMAC SHA3-224");
+        case KMIP_DIGITAL_SHA256_WITH_RSA:
+        printf("SHA-256 with RSA Encryption (PKCS#1 v1.5)");
         break;
         
-        case KMIP_CRYPTOALG_HMAC_SHA3_256:
-        printf("HMAC SHA3-256");
+        case KMIP_DIGITAL_SHA384_WITH_RSA:
+        printf("SHA-384 with RSA Encryption (PKCS#1 v1.5)");
         break;
         
-        case KMIP_CRYPTOALG_HMAC_SHA3_384:
-        printf("HMAC SHA3-384");
+        case KMIP_DIGITAL_SHA512_WITH_RSA:
+        printf("SHA-512 with RSA Encryption (PKCS#1 v1.5)");
         break;
         
-        case KMIP_CRYPTOALG_HMAC_SHA3_512:
-        printf("HMAC SHA3-512");
+        case KMIP_DIGITAL_RSASSA_PSS:
+        printf("RSASSA-PSS (PKCS#1 v2.1)");
         break;
         
-        case KMIP_CRYPTOALG_SHAKE_128:
-        printf("SHAKE-128");
+        case KMIP_DIGITAL_DSA_WITH_SHA1:
+        printf("DSA with SHA-1");
         break;
         
-        case KMIP_CRYPTOALG_SHAKE_256:
-        printf("SHAKE-256");
+        case KMIP_DIGITAL_DSA_WITH_SHA224:
+        printf("DSA with SHA224");
         break;
         
-        case KMIP_CRYPTOALG_ARIA:
-        printf("ARIA");
+        case KMIP_DIGITAL_DSA_WITH_SHA256:
+        printf("DSA with SHA256");
         break;
-
-        case KMIP_CRYPTOALG_SEED:
-        printf("SEED");
+        
+        case KMIP_DIGITAL_ECDSA_WITH_SHA1:
+        printf("ECDSA with SHA-1");
         break;
-
-        case KMIP_CRYPTOALG_SM2:
-        printf("SM2");
+        
+        case KMIP_DIGITAL_ECDSA_WITH_SHA224:
+        printf("ECDSA with SHA224");
         break;
-
-        case KMIP_CRYPTOALG_SM3:
-        printf("SM3");
+        
+        case KMIP_DIGITAL_ECDSA_WITH_SHA256:
+        printf("ECDSA with SHA256");
         break;
-
-        case KMIP_CRYPTOALG_SM4:
-        printf("SM4");
+        
+        case KMIP_DIGITAL_ECDSA_WITH_SHA384:
+        printf("ECDSA with SHA384");
         break;
-
-        case KMIP_CRYPTOALG_GOST_R_34_10_2012:
-        printf("GOST R 34.10-2012");
+        
+        case KMIP_DIGITAL_ECDSA_WITH_SHA512:
+        printf("ECDSA with SHA512");
         break;
-
-        case KMIP_CRYPTOALG_GOST_R_34_11_2012:
-        printf("GOST R 34.11-2012");
+        
+        case KMIP_DIGITAL_SHA3_256_WITH_RSA:
+        printf("SHA3-256 with RSA Encryption");
         break;
-
-        case KMIP_CRYPTOALG_GOST_R_34_13_2015:
-        printf("GOST R 34.13-2015");
+        
+        case KMIP_DIGITAL_SHA3_384_WITH_RSA:
+        printf("SHA3-384 with RSA Encryption");
         break;
-
-        case KMIP_CRYPTOALG_GOST_28147_89:
-        printf("GOST 28147-89");
+        
+        case KMIP_DIGITAL_SHA3_512_WITH_RSA:
+        printf("SHA3-512 with RSA Encryption");
         break;
-
-        case KMIP_CRYPTOALG_XMSS:
-        printf("XMSS");
+        
+        default:
+        printf("Unknown");
         break;
+    };
+}
 
-        case KMIP_CRYPTOALG_SPHINCS_256:
-        printf("SPHINCS-256");
+void
+kmip_print_mask_generator_enum(enum mask_generator value)
+{
+    if(value == 0)
+    {
+        printf("-");
+        return;
+    }
+    
+    switch(value)
+    {
+        case KMIP_MASKGEN_MGF1:
+        printf("MGF1");
         break;
-
-        case KMIP_CRYPTOALG_MCELIECE:
-        printf("McEliece");
+        
+        default:
+        printf("Unknown");
         break;
+    };
+}
 
-        case KMIP_CRYPTOALG_MCELIECE_6960119:
-        printf("McEliece 6960119");
+void
+kmip_print_wrapping_method_enum(enum wrapping_method value)
+{
+    if(value == 0)
+    {
+        printf("-");
+        return;
+    }
+    
+    switch(value)
+    {
+        case KMIP_WRAP_ENCRYPT:
+        printf("Encrypt");
         break;
-
-        case KMIP_CRYPTOALG_MCELIECE_8192128:
-        printf("McEliece 8192128");
+        
+        case KMIP_WRAP_MAC_SIGN:
+        printf("MAC/sign");
         break;
-
-        case KMIP_CRYPTOALG_ED25519:
-        printf("Ed25519");
+        
+        case KMIP_WRAP_ENCRYPT_MAC_SIGN:
+        printf("Encrypt then MAC/sign");
         break;
-
-        case KMIP_CRYPTOALG_ED448:
-        printf("Ed448");
+        
+        case KMIP_WRAP_MAC_SIGN_ENCRYPT:
+        printf("MAC/sign then encrypt");
+        break;
+        
+        case KMIP_WRAP_TR31:
+        printf("TR-31");
         break;
         
         default:
@@ -2731,7 +4602,7 @@ kmip_print_cryptographic_algorithm_enum(enum cryptographic_algorithm value)
 }
 
 void
-kmip_print_name_type_enum(enum name_type value)
+kmip_print_encoding_option_enum(enum encoding_option value)
 {
     if(value == 0)
     {
@@ -2741,12 +4612,12 @@ kmip_print_name_type_enum(enum name_type value)
     
     switch(value)
     {
-        case KMIP_NAME_UNINTERPRETED_TEXT_STRING:
-        printf("Uninterpreted Text String");
+        case KMIP_ENCODE_NO_ENCODING:
+        printf("No Encoding");
         break;
         
-        case KMIP_NAME_URI:
-        printf("URI");
+        case KMIP_ENCODE_TTLV_ENCODING:
+        printf("TTLV Encoding");
         break;
         
         default:
@@ -2756,9 +4627,9 @@ kmip_print_name_type_enum(enum name_type value)
 }
 
 void
-kmip_print_attribute_type_enum(enum attribute_type value)
+kmip_print_key_wrap_type_enum(enum key_wrap_type value)
 {
-    if((int)value == KMIP_UNSET)
+    if(value == 0)
     {
         printf("-");
         return;
@@ -2766,44 +4637,55 @@ kmip_print_attribute_type_enum(enum attribute_type value)
     
     switch(value)
     {
-        case KMIP_ATTR_APPLICATION_SPECIFIC_INFORMATION:
-        {
-            printf("Application Specific Information");
-        }
-        break;
-
-        case KMIP_ATTR_UNIQUE_IDENTIFIER:
-        printf("Unique Identifier");
+        case KMIP_WRAPTYPE_NOT_WRAPPED:
+        printf("Not Wrapped");
         break;
         
-        case KMIP_ATTR_NAME:
-        printf("Name");
+        case KMIP_WRAPTYPE_AS_REGISTERED:
+        printf("As Registered");
         break;
         
-        case KMIP_ATTR_OBJECT_TYPE:
-        printf("Object Type");
+        default:
+        printf("Unknown");
         break;
-        
-        case KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM:
-        printf("Cryptographic Algorithm");
+    };
+}
+
+void
+kmip_print_credential_type_enum(enum credential_type value)
+{
+    if(value == 0)
+    {
+        printf("-");
+        return;
+    }
+    
+    switch(value)
+    {
+        case KMIP_CRED_USERNAME_AND_PASSWORD:
+        printf("Username and Password");
         break;
         
-        case KMIP_ATTR_CRYPTOGRAPHIC_LENGTH:
-        printf("Cryptographic Length");
+        case KMIP_CRED_DEVICE:
+        printf("Device");
         break;
         
-        case KMIP_ATTR_OPERATION_POLICY_NAME:
-        printf("Operation Policy Name");
+        case KMIP_CRED_ATTESTATION:
+        printf("Attestation");
         break;
-        
-        case KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK:
-        printf("Cryptographic Usage Mask");
+
+        case KMIP_CRED_ONE_TIME_PASSWORD:
+        printf("One Time Password");
         break;
-        
-        case KMIP_ATTR_STATE:
-        printf("State");
+
+        case KMIP_CRED_HASHED_PASSWORD:
+        printf("Hashed Password");
         break;
-        
+
+        case KMIP_CRED_TICKET:
+        printf("Ticket");
+        break;
+
         default:
         printf("Unknown");
         break;
@@ -2811,3208 +4693,3875 @@ kmip_print_attribute_type_enum(enum attribute_type value)
 }
 
 void
-kmip_print_state_enum(enum state value)
+kmip_print_cryptographic_usage_mask_enums(int indent, int32 value)
 {
-    if(value == 0)
+    printf("\n");
+    
+    if((value & KMIP_CRYPTOMASK_SIGN) == KMIP_CRYPTOMASK_SIGN)
     {
-        printf("-");
-        return;
+        printf("%*sSign\n", indent, "");
     }
     
-    switch(value)
+    if((value & KMIP_CRYPTOMASK_VERIFY) == KMIP_CRYPTOMASK_VERIFY)
+    {
+        printf("%*sVerify\n", indent, "");
+    }
+    
+    if((value & KMIP_CRYPTOMASK_ENCRYPT) == KMIP_CRYPTOMASK_ENCRYPT)
+    {
+        printf("%*sEncrypt\n", indent, "");
+    }
+    
+    if((value & KMIP_CRYPTOMASK_DECRYPT) == KMIP_CRYPTOMASK_DECRYPT)
+    {
+        printf("%*sDecrypt\n", indent, "");
+    }
+    
+    if((value & KMIP_CRYPTOMASK_WRAP_KEY) == KMIP_CRYPTOMASK_WRAP_KEY)
+    {
+        printf("%*sWrap Key\n", indent, "");
+    }
+    
+    if((value & KMIP_CRYPTOMASK_UNWRAP_KEY) == KMIP_CRYPTOMASK_UNWRAP_KEY)
+    {
+        printf("%*sUnwrap Key\n", indent, "");
+    }
+    
+    if((value & KMIP_CRYPTOMASK_EXPORT) == KMIP_CRYPTOMASK_EXPORT)
+    {
+        printf("%*sExport\n", indent, "");
+    }
+    
+    if((value & KMIP_CRYPTOMASK_MAC_GENERATE) == KMIP_CRYPTOMASK_MAC_GENERATE)
+    {
+        printf("%*sMAC Generate\n", indent, "");
+    }
+    
+    if((value & KMIP_CRYPTOMASK_MAC_VERIFY) == KMIP_CRYPTOMASK_MAC_VERIFY)
+    {
+        printf("%*sMAC Verify\n", indent, "");
+    }
+    
+    if((value & KMIP_CRYPTOMASK_DERIVE_KEY) == KMIP_CRYPTOMASK_DERIVE_KEY)
+    {
+        printf("%*sDerive Key\n", indent, "");
+    }
+    
+    if((value & KMIP_CRYPTOMASK_CONTENT_COMMITMENT) == KMIP_CRYPTOMASK_CONTENT_COMMITMENT)
+    {
+        printf("%*sContent Commitment\n", indent, "");
+    }
+    
+    if((value & KMIP_CRYPTOMASK_KEY_AGREEMENT) == KMIP_CRYPTOMASK_KEY_AGREEMENT)
+    {
+        printf("%*sKey Agreement\n", indent, "");
+    }
+    
+    if((value & KMIP_CRYPTOMASK_CERTIFICATE_SIGN) == KMIP_CRYPTOMASK_CERTIFICATE_SIGN)
+    {
+        printf("%*sCertificate Sign\n", indent, "");
+    }
+    
+    if((value & KMIP_CRYPTOMASK_CRL_SIGN) == KMIP_CRYPTOMASK_CRL_SIGN)
+    {
+        printf("%*sCRL Sign\n", indent, "");
+    }
+    
+    if((value & KMIP_CRYPTOMASK_GENERATE_CRYPTOGRAM) == KMIP_CRYPTOMASK_GENERATE_CRYPTOGRAM)
+    {
+        printf("%*sGenerate Cryptogram\n", indent, "");
+    }
+    
+    if((value & KMIP_CRYPTOMASK_VALIDATE_CRYPTOGRAM) == KMIP_CRYPTOMASK_VALIDATE_CRYPTOGRAM)
+    {
+        printf("%*sValidate Cryptogram\n", indent, "");
+    }
+    
+    if((value & KMIP_CRYPTOMASK_TRANSLATE_ENCRYPT) == KMIP_CRYPTOMASK_TRANSLATE_ENCRYPT)
+    {
+        printf("%*sTranslate Encrypt\n", indent, "");
+    }
+    
+    if((value & KMIP_CRYPTOMASK_TRANSLATE_DECRYPT) == KMIP_CRYPTOMASK_TRANSLATE_DECRYPT)
+    {
+        printf("%*sTranslate Decrypt\n", indent, "");
+    }
+    
+    if((value & KMIP_CRYPTOMASK_TRANSLATE_WRAP) == KMIP_CRYPTOMASK_TRANSLATE_WRAP)
+    {
+        printf("%*sTranslate Wrap\n", indent, "");
+    }
+    
+    if((value & KMIP_CRYPTOMASK_TRANSLATE_UNWRAP) == KMIP_CRYPTOMASK_TRANSLATE_UNWRAP)
+    {
+        printf("%*sTranslate Unwrap\n", indent, "");
+    }
+
+    if((value & KMIP_CRYPTOMASK_AUTHENTICATE) == KMIP_CRYPTOMASK_AUTHENTICATE)
+    {
+        printf("%*sAuthenticate\n", indent, "");
+    }
+
+    if((value & KMIP_CRYPTOMASK_UNRESTRICTED) == KMIP_CRYPTOMASK_UNRESTRICTED)
+    {
+        printf("%*sUnrestricted\n", indent, "");
+    }
+
+    if((value & KMIP_CRYPTOMASK_FPE_ENCRYPT) == KMIP_CRYPTOMASK_FPE_ENCRYPT)
+    {
+        printf("%*sFPE Encrypt\n", indent, "");
+    }
+
+    if((value & KMIP_CRYPTOMASK_FPE_DECRYPT) == KMIP_CRYPTOMASK_FPE_DECRYPT)
+    {
+        printf("%*sFPE Decrypt\n", indent, "");
+    }
+}
+
+void
+kmip_print_protection_storage_mask_enum(int indent, int32 value)
+{
+    printf("\n");
+
+    if((value & KMIP_PROTECT_SOFTWARE) == KMIP_PROTECT_SOFTWARE)
+    {
+        printf("%*sSoftware\n", indent, "");
+    }
+
+    if((value & KMIP_PROTECT_HARDWARE) == KMIP_PROTECT_HARDWARE)
+    {
+        printf("%*sHardware\n", indent, "");
+    }
+
+    if((value & KMIP_PROTECT_ON_PROCESSOR) == KMIP_PROTECT_ON_PROCESSOR)
+    {
+        printf("%*sOn Processor\n", indent, "");
+    }
+
+    if((value & KMIP_PROTECT_ON_SYSTEM) == KMIP_PROTECT_ON_SYSTEM)
+    {
+        printf("%*sOn System\n", indent, "");
+    }
+
+    if((value & KMIP_PROTECT_OFF_SYSTEM) == KMIP_PROTECT_OFF_SYSTEM)
+    {
+        printf("%*sOff System\n", indent, "");
+    }
+
+    if((value & KMIP_PROTECT_HYPERVISOR) == KMIP_PROTECT_HYPERVISOR)
+    {
+        printf("%*sHypervisor\n", indent, "");
+    }
+
+    if((value & KMIP_PROTECT_OPERATING_SYSTEM) == KMIP_PROTECT_OPERATING_SYSTEM)
+    {
+        printf("%*sOperating System\n", indent, "");
+    }
+
+    if((value & KMIP_PROTECT_CONTAINER) == KMIP_PROTECT_CONTAINER)
+    {
+        printf("%*sContainer\n", indent, "");
+    }
+
+    if((value & KMIP_PROTECT_ON_PREMISES) == KMIP_PROTECT_ON_PREMISES)
+    {
+        printf("%*sOn Premises\n", indent, "");
+    }
+
+    if((value & KMIP_PROTECT_OFF_PREMISES) == KMIP_PROTECT_OFF_PREMISES)
+    {
+        printf("%*sOff Premises\n", indent, "");
+    }
+
+    if((value & KMIP_PROTECT_SELF_MANAGED) == KMIP_PROTECT_SELF_MANAGED)
+    {
+        printf("%*sSelf Managed\n", indent, "");
+    }
+
+    if((value & KMIP_PROTECT_OUTSOURCED) == KMIP_PROTECT_OUTSOURCED)
     {
-        case KMIP_STATE_PRE_ACTIVE:
-        printf("Pre-Active");
-        break;
-        
-        case KMIP_STATE_ACTIVE:
-        printf("Active");
-        break;
-        
-        case KMIP_STATE_DEACTIVATED:
-        printf("Deactivated");
-        break;
-        
-        case KMIP_STATE_COMPROMISED:
-        printf("Compromised");
-        break;
-        
-        case KMIP_STATE_DESTROYED:
-        printf("Destroyed");
-        break;
-        
-        case KMIP_STATE_DESTROYED_COMPROMISED:
-        printf("Destroyed Compromised");
-        break;
-        
-        default:
-        printf("Unknown");
-        break;
-    };
-}
+        printf("%*sOutsourced\n", indent, "");
+    }
 
-void
-kmip_print_block_cipher_mode_enum(enum block_cipher_mode value)
-{
-    if(value == 0)
+    if((value & KMIP_PROTECT_VALIDATED) == KMIP_PROTECT_VALIDATED)
     {
-        printf("-");
-        return;
+        printf("%*sValidated\n", indent, "");
     }
-    
-    switch(value)
+
+    if((value & KMIP_PROTECT_SAME_JURISDICTION) == KMIP_PROTECT_SAME_JURISDICTION)
     {
-        case KMIP_BLOCK_CBC:
-        printf("CBC");
-        break;
-        
-        case KMIP_BLOCK_ECB:
-        printf("ECB");
-        break;
-        
-        case KMIP_BLOCK_PCBC:
-        printf("PCBC");
-        break;
-        
-        case KMIP_BLOCK_CFB:
-        printf("CFB");
-        break;
-        
-        case KMIP_BLOCK_OFB:
-        printf("OFB");
-        break;
-        
-        case KMIP_BLOCK_CTR:
-        printf("CTR");
-        break;
-        
-        case KMIP_BLOCK_CMAC:
-        printf("CMAC");
-        break;
-        
-        case KMIP_BLOCK_CCM:
-        printf("CCM");
-        break;
-        
-        case KMIP_BLOCK_GCM:
-        printf("GCM");
-        break;
-        
-        case KMIP_BLOCK_CBC_MAC:
-        printf("CBC-MAC");
-        break;
-        
-        case KMIP_BLOCK_XTS:
-        printf("XTS");
-        break;
-        
-        case KMIP_BLOCK_AES_KEY_WRAP_PADDING:
-        printf("AESKeyWrapPadding");
-        break;
-        
-        case KMIP_BLOCK_NIST_KEY_WRAP:
-        printf("NISTKeyWrap");
-        break;
-        
-        case KMIP_BLOCK_X9102_AESKW:
-        printf("X9.102 AESKW");
-        break;
-        
-        case KMIP_BLOCK_X9102_TDKW:
-        printf("X9.102 TDKW");
-        break;
-        
-        case KMIP_BLOCK_X9102_AKW1:
-        printf("X9.102 AKW1");
-        break;
-        
-        case KMIP_BLOCK_X9102_AKW2:
-        printf("X9.102 AKW2");
-        break;
-        
-        case KMIP_BLOCK_AEAD:
-        printf("AEAD");
-        break;
-        
-        default:
-        printf("Unknown");
-        break;
-    };
+        printf("%*sSame Jurisdiction\n", indent, "");
+    }
 }
 
 void
-kmip_print_padding_method_enum(enum padding_method value)
+kmip_print_protection_storage_masks(int indent, ProtectionStorageMasks *value)
 {
-    if(value == 0)
+    printf("%*sProtection Storage Masks @ %p\n", indent, "", (void *)value);
+
+    if(value != NULL)
     {
-        printf("-");
-        return;
+        printf("%*sMasks: %zu\n", indent + 2, "", value->masks.size);
+        for(size_t i = 0; i < value->masks.size; i++)
+        {
+            printf("%*sMask: %zu", indent + 4, "", i + 1);
+            int32 mask = *(int32 *)kmip_vector_get(&value->masks, i);
+            kmip_print_protection_storage_mask_enum(indent + 6, mask);
+        }
     }
-    
-    switch(value)
-    {
-        case KMIP_PAD_NONE:
-        printf("None");
-        break;
-        
-        case KMIP_PAD_OAEP:
-        printf("OAEP");
-        break;
-        
-        case KMIP_PAD_PKCS5:
-        printf("PKCS5");
-        break;
-        
-        case KMIP_PAD_SSL3:
-        printf("SSL3");
-        break;
-        
-        case KMIP_PAD_ZEROS:
-        printf("Zeros");
-        break;
-        
-        case KMIP_PAD_ANSI_X923:
-        printf("ANSI X9.23");
-        break;
-        
-        case KMIP_PAD_ISO_10126:
-        printf("ISO 10126");
-        break;
-        
-        case KMIP_PAD_PKCS1v15:
-        printf("PKCS1 v1.5");
-        break;
-        
-        case KMIP_PAD_X931:
-        printf("X9.31");
-        break;
-        
-        case KMIP_PAD_PSS:
-        printf("PSS");
-        break;
-        
-        default:
-        printf("Unknown");
-        break;
-    };
 }
 
 void
-kmip_print_hashing_algorithm_enum(enum hashing_algorithm value)
+kmip_print_integer(int32 value)
 {
-    if(value == 0)
-    {
-        printf("-");
-        return;
-    }
-    
     switch(value)
     {
-        case KMIP_HASH_MD2:
-        printf("MD2");
-        break;
-        
-        case KMIP_HASH_MD4:
-        printf("MD4");
-        break;
-        
-        case KMIP_HASH_MD5:
-        printf("MD5");
-        break;
-        
-        case KMIP_HASH_SHA1:
-        printf("SHA-1");
-        break;
-        
-        case KMIP_HASH_SHA224:
-        printf("SHA-224");
-        break;
-        
-        case KMIP_HASH_SHA256:
-        printf("SHA-256");
-        break;
-        
-        case KMIP_HASH_SHA384:
-        printf("SHA-384");
-        break;
-        
-        case KMIP_HASH_SHA512:
-        printf("SHA-512");
-        break;
-        
-        case KMIP_HASH_RIPEMD160:
-        printf("RIPEMD-160");
-        break;
-        
-        case KMIP_HASH_TIGER:
-        printf("Tiger");
-        break;
-        
-        case KMIP_HASH_WHIRLPOOL:
-        printf("Whirlpool");
-        break;
-        
-        case KMIP_HASH_SHA512_224:
-        printf("SHA-512/224");
-        break;
-        
-        case KMIP_HASH_SHA512_256:
-        printf("SHA-512/256");
-        break;
-        
-        case KMIP_HASH_SHA3_224:
-        printf("SHA-3-224");
-        break;
-        
-        case KMIP_HASH_SHA3_256:
-        printf("SHA-3-256");
-        break;
-        
-        case KMIP_HASH_SHA3_384:
-        printf("SHA-3-384");
-        break;
-        
-        case KMIP_HASH_SHA3_512:
-        printf("SHA-3-512");
+        case KMIP_UNSET:
+        printf("-");
         break;
         
         default:
-        printf("Unknown");
+        printf("%d", value);
         break;
     };
 }
 
 void
-kmip_print_key_role_type_enum(enum key_role_type value)
+kmip_print_bool(int32 value)
 {
-    if(value == 0)
-    {
-        printf("-");
-        return;
-    }
-    
     switch(value)
     {
-        case KMIP_ROLE_BDK:
-        printf("BDK");
-        break;
-        
-        case KMIP_ROLE_CVK:
-        printf("CVK");
-        break;
-        
-        case KMIP_ROLE_DEK:
-        printf("DEK");
-        break;
-        
-        case KMIP_ROLE_MKAC:
-        printf("MKAC");
+        case KMIP_TRUE:
+        printf("True");
         break;
         
-        case KMIP_ROLE_MKSMC:
-        printf("MKSMC");
+        case KMIP_FALSE:
+        printf("False");
         break;
         
-        case KMIP_ROLE_MKSMI:
-        printf("MKSMI");
+        default:
+        printf("-");
         break;
+    };
+}
+
+void
+kmip_print_text_string(int indent, const char *name, TextString *value)
+{
+    printf("%*s%s @ %p\n", indent, "", name, (void *)value);
+    
+    if(value != NULL)
+    {
+        printf("%*sValue: %.*s\n", indent + 2, "", (int)value->size, value->value);
+    }
+    
+    return;
+}
+
+void
+kmip_print_byte_string(int indent, const char *name, ByteString *value)
+{
+    printf("%*s%s @ %p\n", indent, "", name, (void *)value);
+    
+    if(value != NULL)
+    {
+        printf("%*sValue:", indent + 2, "");
+        for(size_t i = 0; i < value->size; i++)
+        {
+            if(i % 16 == 0)
+            {
+                printf("\n%*s0x", indent + 4, "");
+            }
+            printf("%02X", value->value[i]);
+        }
+        printf("\n");
+    }
+    
+    return;
+}
+
+void
+kmip_print_protocol_version(int indent, ProtocolVersion *value)
+{
+    printf("%*sProtocol Version @ %p\n", indent, "", (void *)value);
+    
+    if(value != NULL)
+    {
+        printf("%*sMajor: %d\n", indent + 2, "", value->major);
+        printf("%*sMinor: %d\n", indent + 2, "", value->minor);
+    }
+    
+    return;
+}
+
+void
+kmip_print_name(int indent, Name *value)
+{
+    printf("%*sName @ %p\n", indent, "", (void *)value);
+    
+    if(value != NULL)
+    {
+        kmip_print_text_string(indent + 2, "Name Value", value->value);
         
-        case KMIP_ROLE_MKDAC:
-        printf("MKDAC");
-        break;
+        printf("%*sName Type: ", indent + 2, "");
+        kmip_print_name_type_enum(value->type);
+        printf("\n");
+    }
+}
+
+void
+kmip_print_nonce(int indent, Nonce *value)
+{
+    printf("%*sNonce @ %p\n", indent, "", (void *)value);
+    
+    if(value != NULL)
+    {
+        kmip_print_byte_string(indent + 2, "Nonce ID", value->nonce_id);
+        kmip_print_byte_string(indent + 2, "Nonce Value", value->nonce_value);
+    }
+    
+    return;
+}
+
+void
+kmip_print_application_specific_information(int indent, ApplicationSpecificInformation *value)
+{
+    printf("%*sApplication Specific Information @ %p\n", indent, "", (void *)value);
+
+    if(value != NULL)
+    {
+        kmip_print_text_string(indent + 2, "Application Namespace", value->application_namespace);
+        kmip_print_text_string(indent + 2, "Application Data", value->application_data);
+    }
+}
+
+void
+kmip_print_cryptographic_parameters(int indent, CryptographicParameters *value)
+{
+    printf("%*sCryptographic Parameters @ %p\n", indent, "", (void *)value);
+    
+    if(value != NULL)
+    {
+        printf("%*sBlock Cipher Mode: ", indent + 2, "");
+        kmip_print_block_cipher_mode_enum(value->block_cipher_mode);
+        printf("\n");
         
-        case KMIP_ROLE_MKDN:
-        printf("MKDN");
-        break;
+        printf("%*sPadding Method: ", indent + 2, "");
+        kmip_print_padding_method_enum(value->padding_method);
+        printf("\n");
         
-        case KMIP_ROLE_MKCP:
-        printf("MKCP");
-        break;
+        printf("%*sHashing Algorithm: ", indent + 2, "");
+        kmip_print_hashing_algorithm_enum(value->hashing_algorithm);
+        printf("\n");
         
-        case KMIP_ROLE_MKOTH:
-        printf("MKOTH");
-        break;
+        printf("%*sKey Role Type: ", indent + 2, "");
+        kmip_print_key_role_type_enum(value->key_role_type);
+        printf("\n");
         
-        case KMIP_ROLE_KEK:
-        printf("KEK");
-        break;
+        printf("%*sDigital Signature Algorithm: ", indent + 2, "");
+        kmip_print_digital_signature_algorithm_enum(value->digital_signature_algorithm);
+        printf("\n");
         
-        case KMIP_ROLE_MAC16609:
-        printf("MAC16609");
-        break;
+        printf("%*sCryptographic Algorithm: ", indent + 2, "");
+        kmip_print_cryptographic_algorithm_enum(value->cryptographic_algorithm);
+        printf("\n");
         
-        case KMIP_ROLE_MAC97971:
-        printf("MAC97971");
-        break;
+        printf("%*sRandom IV: ", indent + 2, "");
+        kmip_print_bool(value->random_iv);
+        printf("\n");
         
-        case KMIP_ROLE_MAC97972:
-        printf("MAC97972");
-        break;
+        printf("%*sIV Length: ", indent + 2, "");
+        kmip_print_integer(value->iv_length);
+        printf("\n");
         
-        case KMIP_ROLE_MAC97973:
-        printf("MAC97973");
-        break;
+        printf("%*sTag Length: ", indent + 2, "");
+        kmip_print_integer(value->tag_length);
+        printf("\n");
         
-        case KMIP_ROLE_MAC97974:
-        printf("MAC97974");
-        break;
+        printf("%*sFixed Field Length: ", indent + 2, "");
+        kmip_print_integer(value->fixed_field_length);
+        printf("\n");
         
-        case KMIP_ROLE_MAC97975:
-        printf("MAC97975");
-        break;
+        printf("%*sInvocation Field Length: ", indent + 2, "");
+        kmip_print_integer(value->invocation_field_length);
+        printf("\n");
         
-        case KMIP_ROLE_ZPK:
-        printf("ZPK");
-        break;
+        printf("%*sCounter Length: ", indent + 2, "");
+        kmip_print_integer(value->counter_length);
+        printf("\n");
         
-        case KMIP_ROLE_PVKIBM:
-        printf("PVKIBM");
-        break;
+        printf("%*sInitial Counter Value: ", indent + 2, "");
+        kmip_print_integer(value->initial_counter_value);
+        printf("\n");
         
-        case KMIP_ROLE_PVKPVV:
-        printf("PVKPVV");
-        break;
+        printf("%*sSalt Length: ", indent + 2, "");
+        kmip_print_integer(value->salt_length);
+        printf("\n");
         
-        case KMIP_ROLE_PVKOTH:
-        printf("PVKOTH");
-        break;
+        printf("%*sMask Generator: ", indent + 2, "");
+        kmip_print_mask_generator_enum(value->mask_generator);
+        printf("\n");
         
-        case KMIP_ROLE_DUKPT:
-        printf("DUKPT");
-        break;
+        printf("%*sMask Generator Hashing Algorithm: ", indent + 2, "");
+        kmip_print_hashing_algorithm_enum(value->mask_generator_hashing_algorithm);
+        printf("\n");
         
-        case KMIP_ROLE_IV:
-        printf("IV");
-        break;
+        kmip_print_byte_string(indent + 2, "P Source", value->p_source);
         
-        case KMIP_ROLE_TRKBK:
-        printf("TRKBK");
-        break;
+        printf("%*sTrailer Field: ", indent + 2, "");
+        kmip_print_integer(value->trailer_field);
+        printf("\n");
+    }
+}
+
+void
+kmip_print_encryption_key_information(int indent, EncryptionKeyInformation *value)
+{
+    printf("%*sEncryption Key Information @ %p\n", indent, "", (void *)value);
+    
+    if(value != NULL)
+    {
+        kmip_print_text_string(indent + 2, "Unique Identifier", value->unique_identifier);
         
-        default:
-        printf("Unknown");
-        break;
-    };
+        kmip_print_cryptographic_parameters(indent + 2, value->cryptographic_parameters);
+    }
 }
 
 void
-kmip_print_digital_signature_algorithm_enum(enum digital_signature_algorithm value)
+kmip_print_mac_signature_key_information(int indent, MACSignatureKeyInformation *value)
 {
-    if(value == 0)
+    printf("%*sMAC/Signature Key Information @ %p\n", indent, "", (void *)value);
+    
+    if(value != NULL)
     {
-        printf("-");
-        return;
+        kmip_print_text_string(indent + 2, "Unique Identifier", value->unique_identifier);
+        
+        kmip_print_cryptographic_parameters(indent + 2, value->cryptographic_parameters);
     }
+}
+
+void
+kmip_print_key_wrapping_data(int indent, KeyWrappingData *value)
+{
+    printf("%*sKey Wrapping Data @ %p\n", indent, "", (void *)value);
     
-    switch(value)
+    if(value != NULL)
     {
-        case KMIP_DIGITAL_MD2_WITH_RSA:
-        printf("MD2 with RSA Encryption (PKCS#1 v1.5)");
-        break;
-        
-        case KMIP_DIGITAL_MD5_WITH_RSA:
-        printf("MD5 with RSA Encryption (PKCS#1 v1.5)");
-        break;
-        
-        case KMIP_DIGITAL_SHA1_WITH_RSA:
-        printf("SHA-1 with RSA Encryption (PKCS#1 v1.5)");
-        break;
-        
-        case KMIP_DIGITAL_SHA224_WITH_RSA:
-        printf("SHA-224 with RSA Encryption (PKCS#1 v1.5)");
-        break;
-        
-        case KMIP_DIGITAL_SHA256_WITH_RSA:
-        printf("SHA-256 with RSA Encryption (PKCS#1 v1.5)");
-        break;
+        printf("%*sWrapping Method: ", indent + 2, "");
+        kmip_print_wrapping_method_enum(value->wrapping_method);
+        printf("\n");
         
-        case KMIP_DIGITAL_SHA384_WITH_RSA:
-        printf("SHA-384 with RSA Encryption (PKCS#1 v1.5)");
-        break;
+        kmip_print_encryption_key_information(indent + 2, value->encryption_key_info);
         
-        case KMIP_DIGITAL_SHA512_WITH_RSA:
-        printf("SHA-512 with RSA Encryption (PKCS#1 v1.5)");
-        break;
+        kmip_print_mac_signature_key_information(indent + 2, value->mac_signature_key_info);
         
-        case KMIP_DIGITAL_RSASSA_PSS:
-        printf("RSASSA-PSS (PKCS#1 v2.1)");
-        break;
+        kmip_print_byte_string(indent + 2, "MAC/Signature", value->mac_signature);
         
-        case KMIP_DIGITAL_DSA_WITH_SHA1:
-        printf("DSA with SHA-1");
-        break;
+        kmip_print_byte_string(indent + 2, "IV/Counter/Nonce", value->iv_counter_nonce);
         
-        case KMIP_DIGITAL_DSA_WITH_SHA224:
-        printf("DSA with SHA224");
+        printf("%*sEncoding Option: ", indent + 2, "");
+        kmip_print_encoding_option_enum(value->encoding_option);
+        printf("\n");
+    }
+    
+    return;
+}
+
+void
+kmip_print_attribute_value(int indent, enum attribute_type type, void *value)
+{
+    printf("%*sAttribute Value: ", indent, "");
+    
+    switch(type)
+    {
+        case KMIP_ATTR_APPLICATION_SPECIFIC_INFORMATION:
+        {
+            printf("\n");
+            kmip_print_application_specific_information(indent + 2, value);
+        }
         break;
-        
-        case KMIP_DIGITAL_DSA_WITH_SHA256:
-        printf("DSA with SHA256");
+
+        case KMIP_ATTR_UNIQUE_IDENTIFIER:
+        printf("\n");
+        kmip_print_text_string(indent + 2, "Unique Identifier", value);
         break;
         
-        case KMIP_DIGITAL_ECDSA_WITH_SHA1:
-        printf("ECDSA with SHA-1");
+        case KMIP_ATTR_NAME:
+        printf("\n");
+        kmip_print_name(indent + 2, value);
         break;
         
-        case KMIP_DIGITAL_ECDSA_WITH_SHA224:
-        printf("ECDSA with SHA224");
+        case KMIP_ATTR_OBJECT_TYPE:
+        kmip_print_object_type_enum(*(enum object_type *)value);
+        printf("\n");
         break;
         
-        case KMIP_DIGITAL_ECDSA_WITH_SHA256:
-        printf("ECDSA with SHA256");
+        case KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM:
+        kmip_print_cryptographic_algorithm_enum(*(enum cryptographic_algorithm *)value);
+        printf("\n");
         break;
         
-        case KMIP_DIGITAL_ECDSA_WITH_SHA384:
-        printf("ECDSA with SHA384");
+        case KMIP_ATTR_CRYPTOGRAPHIC_LENGTH:
+        printf("%d\n", *(int32 *)value);
         break;
         
-        case KMIP_DIGITAL_ECDSA_WITH_SHA512:
-        printf("ECDSA with SHA512");
+        case KMIP_ATTR_OPERATION_POLICY_NAME:
+        printf("\n");
+        kmip_print_text_string(indent + 2, "Operation Policy Name", value);
         break;
         
-        case KMIP_DIGITAL_SHA3_256_WITH_RSA:
-        printf("SHA3-256 with RSA Encryption");
+        case KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK:
+        kmip_print_cryptographic_usage_mask_enums(indent + 2, *(int32 *)value);
         break;
         
-        case KMIP_DIGITAL_SHA3_384_WITH_RSA:
-        printf("SHA3-384 with RSA Encryption");
+        case KMIP_ATTR_STATE:
+        kmip_print_state_enum(*(enum state *)value);
+        printf("\n");
         break;
         
-        case KMIP_DIGITAL_SHA3_512_WITH_RSA:
-        printf("SHA3-512 with RSA Encryption");
+        case KMIP_ATTR_DIGITAL_SIGNATURE_ALGORITHM:
+        kmip_print_digital_signature_algorithm_enum(*(enum digital_signature_algorithm *)value);
+        printf("\n");
         break;
         
         default:
-        printf("Unknown");
+        switch(kmip_get_attribute_value_type(type))
+        {
+            case KMIP_TYPE_TEXT_STRING:
+            printf("\n");
+            kmip_print_text_string(indent + 2, kmip_get_attribute_name(type, NULL), value);
+            break;
+            
+            case KMIP_TYPE_INTEGER:
+            case KMIP_TYPE_ENUMERATION:
+            printf("%d\n", *(int32 *)value);
+            break;
+            
+            case KMIP_TYPE_BOOLEAN:
+            kmip_print_bool(*(bool32 *)value);
+            printf("\n");
+            break;
+            
+            case KMIP_TYPE_DATE_TIME:
+            printf("%lu\n", *(uint64 *)value);
+            break;
+            
+            case KMIP_TYPE_INTERVAL:
+            printf("%u\n", *(uint32 *)value);
+            break;
+            
+            default:
+            printf("Unknown\n");
+            break;
+        };
         break;
     };
 }
 
 void
-kmip_print_mask_generator_enum(enum mask_generator value)
+kmip_print_attribute(int indent, Attribute *value)
 {
-    if(value == 0)
+    printf("%*sAttribute @ %p\n", indent, "", (void *)value);
+    
+    if(value != NULL)
     {
-        printf("-");
-        return;
+        printf("%*sAttribute Name: ", indent + 2, "");
+        kmip_print_attribute_type_enum(value->type);
+        printf("\n");
+        
+        printf("%*sAttribute Index: ", indent + 2, "");
+        kmip_print_integer(value->index);
+        printf("\n");
+        
+        kmip_print_attribute_value(indent + 2, value->type, value->value);
     }
     
-    switch(value)
+    return;
+}
+
+void
+kmip_print_key_material(int indent, enum key_format_type format, void *value)
+{
+    switch(format)
     {
-        case KMIP_MASKGEN_MGF1:
-        printf("MGF1");
+        case KMIP_KEYFORMAT_RAW:
+        case KMIP_KEYFORMAT_OPAQUE:
+        case KMIP_KEYFORMAT_PKCS1:
+        case KMIP_KEYFORMAT_PKCS8:
+        case KMIP_KEYFORMAT_X509:
+        case KMIP_KEYFORMAT_EC_PRIVATE_KEY:
+        kmip_print_byte_string(indent, "Key Material", (ByteString *)value);
         break;
         
         default:
-        printf("Unknown");
+        printf("%*sUnknown Key Material @ %p\n", indent, "", value);
         break;
     };
 }
 
 void
-kmip_print_wrapping_method_enum(enum wrapping_method value)
+kmip_print_key_value(int indent, enum type type, enum key_format_type format, void *value)
 {
-    if(value == 0)
-    {
-        printf("-");
-        return;
-    }
-    
-    switch(value)
+    switch(type)
     {
-        case KMIP_WRAP_ENCRYPT:
-        printf("Encrypt");
-        break;
-        
-        case KMIP_WRAP_MAC_SIGN:
-        printf("MAC/sign");
-        break;
-        
-        case KMIP_WRAP_ENCRYPT_MAC_SIGN:
-        printf("Encrypt then MAC/sign");
+        case KMIP_TYPE_BYTE_STRING:
+        kmip_print_byte_string(indent, "Key Value", (ByteString *)value);
         break;
         
-        case KMIP_WRAP_MAC_SIGN_ENCRYPT:
-        printf("MAC/sign then encrypt");
-        break;
+        case KMIP_TYPE_STRUCTURE:
+        printf("%*sKey Value @ %p\n", indent, "", value);
         
-        case KMIP_WRAP_TR31:
-        printf("TR-31");
+        if(value != NULL)
+        {
+            KeyValue key_value = *(KeyValue *)value;
+            kmip_print_key_material(indent + 2, format, key_value.key_material);
+            printf("%*sAttributes: %zu\n", indent + 2, "", key_value.attribute_count);
+            for(size_t i = 0; i < key_value.attribute_count; i++)
+            {
+                kmip_print_attribute(indent + 2, &key_value.attributes[i]);
+            }
+        }
         break;
         
         default:
-        printf("Unknown");
+        printf("%*sUnknown Key Value @ %p\n", indent, "", value);
         break;
     };
 }
 
 void
-kmip_print_encoding_option_enum(enum encoding_option value)
+kmip_print_key_block(int indent, KeyBlock *value)
 {
-    if(value == 0)
-    {
-        printf("-");
-        return;
-    }
+    printf("%*sKey Block @ %p\n", indent, "", (void *)value);
     
-    switch(value)
+    if(value != NULL)
     {
-        case KMIP_ENCODE_NO_ENCODING:
-        printf("No Encoding");
-        break;
+        printf("%*sKey Format Type: ", indent + 2, "");
+        kmip_print_key_format_type_enum(value->key_format_type);
+        printf("\n");
         
-        case KMIP_ENCODE_TTLV_ENCODING:
-        printf("TTLV Encoding");
-        break;
+        printf("%*sKey Compression Type: ", indent + 2, "");
+        kmip_print_key_compression_type_enum(value->key_compression_type);
+        printf("\n");
         
-        default:
-        printf("Unknown");
-        break;
-    };
+        kmip_print_key_value(indent + 2, value->key_value_type, value->key_format_type, value->key_value);
+        
+        printf("%*sCryptographic Algorithm: ", indent + 2, "");
+        kmip_print_cryptographic_algorithm_enum(value->cryptographic_algorithm);
+        printf("\n");
+        
+        printf("%*sCryptographic Length: %d\n", indent + 2, "", value->cryptographic_length);
+        
+        kmip_print_key_wrapping_data(indent + 2, value->key_wrapping_data);
+    }
+    
+    return;
 }
 
 void
-kmip_print_key_wrap_type_enum(enum key_wrap_type value)
+kmip_print_symmetric_key(int indent, SymmetricKey *value)
 {
-    if(value == 0)
+    printf("%*sSymmetric Key @ %p\n", indent, "", (void *)value);
+    
+    if(value != NULL)
     {
-        printf("-");
-        return;
+        kmip_print_key_block(indent + 2, value->key_block);
     }
     
-    switch(value)
+    return;
+}
+
+void
+kmip_print_object(int indent, enum object_type type, void *value)
+{
+    switch(type)
     {
-        case KMIP_WRAPTYPE_NOT_WRAPPED:
-        printf("Not Wrapped");
-        break;
-        
-        case KMIP_WRAPTYPE_AS_REGISTERED:
-        printf("As Registered");
+        case KMIP_OBJTYPE_SYMMETRIC_KEY:
+        kmip_print_symmetric_key(indent, (SymmetricKey *)value);
         break;
         
         default:
-        printf("Unknown");
+        printf("%*sUnknown Object @ %p\n", indent, "", value);
         break;
     };
 }
 
 void
-kmip_print_credential_type_enum(enum credential_type value)
+kmip_print_key_wrapping_specification(int indent, KeyWrappingSpecification *value)
 {
-    if(value == 0)
+    printf("%*sKey Wrapping Specification @ %p\n", indent, "", (void *)value);
+}
+
+void
+kmip_print_attributes(int indent, Attributes *value)
+{
+    printf("%*sAttributes @ %p\n", indent, "", (void *)value);
+
+    if(value != NULL)
     {
-        printf("-");
-        return;
+        printf("%*sAttributes: %zu\n", indent + 2, "", value->attribute_list.size);
+        void *const *end = kmip_vector_end(&value->attribute_list);
+        for(void *const *item = kmip_vector_begin(&value->attribute_list); item != end; item++)
+        {
+            kmip_print_attribute(indent + 4, (Attribute *)*item);
+        }
     }
+}
+
+void
+kmip_print_template_attribute(int indent, TemplateAttribute *value)
+{
+    printf("%*sTemplate Attribute @ %p\n", indent, "", (void *)value);
     
-    switch(value)
+    if(value != NULL)
     {
-        case KMIP_CRED_USERNAME_AND_PASSWORD:
-        printf("Username and Password");
-        break;
+        printf("%*sNames: %zu\n", indent + 2, "", value->name_count);
+        for(size_t i = 0; i < value->name_count; i++)
+        {
+            kmip_print_name(indent + 4, &value->names[i]);
+        }
         
-        case KMIP_CRED_DEVICE:
-        printf("Device");
-        break;
+        printf("%*sAttributes: %zu\n", indent + 2, "", value->attribute_count);
+        for(size_t i = 0; i< value->attribute_count; i++)
+        {
+            kmip_print_attribute(indent + 4, &value->attributes[i]);
+        }
         
-        case KMIP_CRED_ATTESTATION:
-        printf("Attestation");
-        break;
-
-        case KMIP_CRED_ONE_TIME_PASSWORD:
-        printf("One Time Password");
-        break;
-
-        case KMIP_CRED_HASHED_PASSWORD:
-        printf("Hashed Password");
-        break;
-
-        case KMIP_CRED_TICKET:
-        printf("Ticket");
-        break;
-
-        default:
-        printf("Unknown");
-        break;
-    };
+        if(value->fragment != NULL)
+        {
+            printf("%*sPre-encoded: %zu bytes\n", indent + 2, "", value->fragment->size);
+        }
+    }
 }
 
 void
-kmip_print_cryptographic_usage_mask_enums(int indent, int32 value)
+kmip_print_create_request_payload(int indent, CreateRequestPayload *value)
 {
-    printf("\n");
-    
-    if((value & KMIP_CRYPTOMASK_SIGN) == KMIP_CRYPTOMASK_SIGN)
-    {
-        printf("%*sSign\n", indent, "");
-    }
-    
-    if((value & KMIP_CRYPTOMASK_VERIFY) == KMIP_CRYPTOMASK_VERIFY)
-    {
-        printf("%*sVerify\n", indent, "");
-    }
-    
-    if((value & KMIP_CRYPTOMASK_ENCRYPT) == KMIP_CRYPTOMASK_ENCRYPT)
-    {
-        printf("%*sEncrypt\n", indent, "");
-    }
-    
-    if((value & KMIP_CRYPTOMASK_DECRYPT) == KMIP_CRYPTOMASK_DECRYPT)
-    {
-        printf("%*sDecrypt\n", indent, "");
-    }
-    
-    if((value & KMIP_CRYPTOMASK_WRAP_KEY) == KMIP_CRYPTOMASK_WRAP_KEY)
-    {
-        printf("%*sWrap Key\n", indent, "");
-    }
-    
-    if((value & KMIP_CRYPTOMASK_UNWRAP_KEY) == KMIP_CRYPTOMASK_UNWRAP_KEY)
-    {
-        printf("%*sUnwrap Key\n", indent, "");
-    }
-    
-    if((value & KMIP_CRYPTOMASK_EXPORT) == KMIP_CRYPTOMASK_EXPORT)
-    {
-        printf("%*sExport\n", indent, "");
-    }
-    
-    if((value & KMIP_CRYPTOMASK_MAC_GENERATE) == KMIP_CRYPTOMASK_MAC_GENERATE)
-    {
-        printf("%*sMAC Generate\n", indent, "");
-    }
-    
-    if((value & KMIP_CRYPTOMASK_MAC_VERIFY) == KMIP_CRYPTOMASK_MAC_VERIFY)
-    {
-        printf("%*sMAC Verify\n", indent, "");
-    }
+    printf("%*sCreate Request Payload @ %p\n", indent, "", (void *)value);
     
-    if((value & KMIP_CRYPTOMASK_DERIVE_KEY) == KMIP_CRYPTOMASK_DERIVE_KEY)
+    if(value != NULL)
     {
-        printf("%*sDerive Key\n", indent, "");
+        printf("%*sObject Type: ", indent + 2, "");
+        kmip_print_object_type_enum(value->object_type);
+        printf("\n");
+        
+        kmip_print_template_attribute(indent + 2, value->template_attribute);
+        kmip_print_attributes(indent + 2, value->attributes);
+        kmip_print_protection_storage_masks(indent + 2, value->protection_storage_masks);
     }
+}
+
+void
+kmip_print_create_response_payload(int indent, CreateResponsePayload *value)
+{
+    printf("%*sCreate Response Payload @ %p\n", indent, "", (void *)value);
     
-    if((value & KMIP_CRYPTOMASK_CONTENT_COMMITMENT) == KMIP_CRYPTOMASK_CONTENT_COMMITMENT)
+    if(value != NULL)
     {
-        printf("%*sContent Commitment\n", indent, "");
+        printf("%*sObject Type: ", indent + 2, "");
+        kmip_print_object_type_enum(value->object_type);
+        printf("\n");
+        
+        kmip_print_text_string(
+            indent + 2,
+            "Unique Identifier",
+            value->unique_identifier);
+        
+        kmip_print_template_attribute(indent + 2, value->template_attribute);
     }
+}
+
+void
+kmip_print_get_request_payload(int indent, GetRequestPayload *value)
+{
+    printf("%*sGet Request Payload @ %p\n", indent, "", (void *)value);
     
-    if((value & KMIP_CRYPTOMASK_KEY_AGREEMENT) == KMIP_CRYPTOMASK_KEY_AGREEMENT)
+    if(value != NULL)
     {
-        printf("%*sKey Agreement\n", indent, "");
+        kmip_print_text_string(
+            indent + 2,
+            "Unique Identifier",
+            value->unique_identifier);
+        
+        printf("%*sKey Format Type: ", indent + 2, "");
+        kmip_print_key_format_type_enum(value->key_format_type);
+        printf("\n");
+        
+        printf("%*sKey Wrap Type: ", indent + 2, "");
+        kmip_print_key_wrap_type_enum(value->key_wrap_type);
+        printf("\n");
+        
+        printf("%*sKey Compression Type: ", indent + 2, "");
+        kmip_print_key_compression_type_enum(value->key_compression_type);
+        printf("\n");
+        
+        kmip_print_key_wrapping_specification(indent + 2, value->key_wrapping_spec);
     }
+}
+
+void
+kmip_print_get_response_payload(int indent, GetResponsePayload *value)
+{
+    printf("%*sGet Response Payload @ %p\n", indent, "", (void *)value);
     
-    if((value & KMIP_CRYPTOMASK_CERTIFICATE_SIGN) == KMIP_CRYPTOMASK_CERTIFICATE_SIGN)
+    if(value != NULL)
     {
-        printf("%*sCertificate Sign\n", indent, "");
+        printf("%*sObject Type: ", indent + 2, "");
+        kmip_print_object_type_enum(value->object_type);
+        printf("\n");
+        
+        kmip_print_text_string(indent + 2, "Unique Identifier", value->unique_identifier);
+        kmip_print_object(indent + 2, value->object_type, value->object);
     }
     
-    if((value & KMIP_CRYPTOMASK_CRL_SIGN) == KMIP_CRYPTOMASK_CRL_SIGN)
-    {
-        printf("%*sCRL Sign\n", indent, "");
-    }
+    return;
+}
+
+void
+kmip_print_destroy_request_payload(int indent, DestroyRequestPayload *value)
+{
+    printf("%*sDestroy Request Payload @ %p\n", indent, "", (void *)value);
     
-    if((value & KMIP_CRYPTOMASK_GENERATE_CRYPTOGRAM) == KMIP_CRYPTOMASK_GENERATE_CRYPTOGRAM)
+    if(value != NULL)
     {
-        printf("%*sGenerate Cryptogram\n", indent, "");
+        kmip_print_text_string(
+            indent + 2,
+            "Unique Identifier",
+            value->unique_identifier);
     }
-    
-    if((value & KMIP_CRYPTOMASK_VALIDATE_CRYPTOGRAM) == KMIP_CRYPTOMASK_VALIDATE_CRYPTOGRAM)
+}
+
+void
+kmip_print_destroy_response_payload(int indent, DestroyResponsePayload *value)
+{
+    printf("%*sDestroy Response Payload @ %p\n", indent, "", (void *)value);
+
+    if(value != NULL)
     {
-        printf("%*sValidate Cryptogram\n", indent, "");
+        kmip_print_text_string(
+            indent + 2,
+            "Unique Identifier",
+            value->unique_identifier);
     }
-    
-    if((value & KMIP_CRYPTOMASK_TRANSLATE_ENCRYPT) == KMIP_CRYPTOMASK_TRANSLATE_ENCRYPT)
+}
+
+void
+kmip_print_request_payload(int indent, enum operation type, void *value)
+{
+    switch(type)
     {
-        printf("%*sTranslate Encrypt\n", indent, "");
-    }
-    
-    if((value & KMIP_CRYPTOMASK_TRANSLATE_DECRYPT) == KMIP_CRYPTOMASK_TRANSLATE_DECRYPT)
+        case KMIP_OP_CREATE:
+        kmip_print_create_request_payload(indent, value);
+        break;
+        
+        case KMIP_OP_GET:
+        kmip_print_get_request_payload(indent, (GetRequestPayload *)value);
+        break;
+        
+        case KMIP_OP_DESTROY:
+        kmip_print_destroy_request_payload(indent, value);
+        break;
+        
+        default:
+        printf("%*sUnknown Payload @ %p\n", indent, "", value);
+        break;
+    };
+}
+
+void
+kmip_print_response_payload(int indent, enum operation type, void *value)
+{
+    switch(type)
     {
-        printf("%*sTranslate Decrypt\n", indent, "");
-    }
+        case KMIP_OP_CREATE:
+        kmip_print_create_response_payload(indent, value);
+        break;
+        
+        case KMIP_OP_GET:
+        kmip_print_get_response_payload(indent, (GetResponsePayload *)value);
+        break;
+        
+        case KMIP_OP_DESTROY:
+        kmip_print_destroy_response_payload(indent, value);
+        break;
+        
+        default:
+        printf("%*sUnknown Payload @ %p\n", indent, "", value);
+        break;
+    };
+}
+
+void
+kmip_print_username_password_credential(int indent, UsernamePasswordCredential *value)
+{
+    printf("%*sUsername/Password Credential @ %p\n", indent, "", (void *)value);
     
-    if((value & KMIP_CRYPTOMASK_TRANSLATE_WRAP) == KMIP_CRYPTOMASK_TRANSLATE_WRAP)
+    if(value != NULL)
     {
-        printf("%*sTranslate Wrap\n", indent, "");
+        kmip_print_text_string(indent + 2, "Username", value->username);
+        kmip_print_text_string(indent + 2, "Password", value->password);
     }
-    
-    if((value & KMIP_CRYPTOMASK_TRANSLATE_UNWRAP) == KMIP_CRYPTOMASK_TRANSLATE_UNWRAP)
+}
+
+void
+kmip_print_device_credential(int indent, DeviceCredential *value)
+{
+    printf("%*sDevice Credential @ %p\n", indent, "", (void *)value);
+
+    if(value != NULL)
     {
-        printf("%*sTranslate Unwrap\n", indent, "");
+        kmip_print_text_string(indent + 2, "Device Serial Number", value->device_serial_number);
+        kmip_print_text_string(indent + 2, "Password", value->password);
+        kmip_print_text_string(indent + 2, "Device Identifier", value->device_identifier);
+        kmip_print_text_string(indent + 2, "Network Identifier", value->network_identifier);
+        kmip_print_text_string(indent + 2, "Machine Identifier", value->machine_identifier);
+        kmip_print_text_string(indent + 2, "Media Identifier", value->media_identifier);
     }
+}
 
-    if((value & KMIP_CRYPTOMASK_AUTHENTICATE) == KMIP_CRYPTOMASK_AUTHENTICATE)
+void
+kmip_print_attestation_credential(int indent, AttestationCredential *value)
+{
+    printf("%*sAttestation Credential @ %p\n", indent, "", (void *)value);
+
+    if(value != NULL)
     {
-        printf("%*sAuthenticate\n", indent, "");
+        kmip_print_nonce(indent + 2, value->nonce);
+        printf("%*sAttestation Type: ", indent + 2, "");
+        kmip_print_attestation_type_enum(value->attestation_type);
+        printf("\n");
+        kmip_print_byte_string(indent + 2, "Attestation Measurement", value->attestation_measurement);
+        kmip_print_byte_string(indent + 2, "Attestation Assertion", value->attestation_assertion);
     }
+}
 
-    if((value & KMIP_CRYPTOMASK_UNRESTRICTED) == KMIP_CRYPTOMASK_UNRESTRICTED)
+void
+kmip_print_credential_value(int indent, enum credential_type type, void *value)
+{
+    printf("%*sCredential Value @ %p\n", indent, "", value);
+    
+    if(value != NULL)
     {
-        printf("%*sUnrestricted\n", indent, "");
+        switch(type)
+        {
+            case KMIP_CRED_USERNAME_AND_PASSWORD:
+            kmip_print_username_password_credential(indent + 2, value);
+            break;
+            
+            case KMIP_CRED_DEVICE:
+            kmip_print_device_credential(indent + 2, value);
+            break;
+            
+            case KMIP_CRED_ATTESTATION:
+            kmip_print_attestation_credential(indent + 2, value);
+            break;
+            
+            default:
+            printf("%*sUnknown Credential @ %p\n", indent + 2, "", value);
+            break;
+        };
     }
+}
 
-    if((value & KMIP_CRYPTOMASK_FPE_ENCRYPT) == KMIP_CRYPTOMASK_FPE_ENCRYPT)
+void
+kmip_print_credential(int indent, Credential *value)
+{
+    printf("%*sCredential @ %p\n", indent, "", (void *)value);
+    
+    if(value != NULL)
     {
-        printf("%*sFPE Encrypt\n", indent, "");
+        printf("%*sCredential Type: ", indent + 2, "");
+        kmip_print_credential_type_enum(value->credential_type);
+        printf("\n");
+        
+        kmip_print_credential_value(
+            indent + 2,
+            value->credential_type,
+            value->credential_value);
     }
+}
 
-    if((value & KMIP_CRYPTOMASK_FPE_DECRYPT) == KMIP_CRYPTOMASK_FPE_DECRYPT)
+void
+kmip_print_authentication(int indent, Authentication *value)
+{
+    printf("%*sAuthentication @ %p\n", indent, "", (void *)value);
+    
+    if(value != NULL)
     {
-        printf("%*sFPE Decrypt\n", indent, "");
+        kmip_print_credential(indent + 2, value->credential);
+        
+        if(value->fragment != NULL)
+        {
+            printf("%*sPre-encoded: %zu bytes\n", indent + 2, "", value->fragment->size);
+        }
     }
 }
 
 void
-kmip_print_protection_storage_mask_enum(int indent, int32 value)
+kmip_print_request_batch_item(int indent, RequestBatchItem *value)
 {
-    printf("\n");
-
-    if((value & KMIP_PROTECT_SOFTWARE) == KMIP_PROTECT_SOFTWARE)
+    printf("%*sRequest Batch Item @ %p\n", indent, "", (void *)value);
+    
+    if(value != NULL)
     {
-        printf("%*sSoftware\n", indent, "");
+        printf("%*sOperation: ", indent + 2, "");
+        kmip_print_operation_enum(value->operation);
+        printf("\n");
+
+        printf("%*sEphemeral: ", indent + 2, "");
+        kmip_print_bool(value->ephemeral);
+        printf("\n");
+
+        kmip_print_byte_string(
+            indent + 2,
+            "Unique Batch Item ID",
+            value->unique_batch_item_id);
+        
+        kmip_print_request_payload(
+            indent + 2,
+            value->operation,
+            value->request_payload);
     }
+}
 
-    if((value & KMIP_PROTECT_HARDWARE) == KMIP_PROTECT_HARDWARE)
+void
+kmip_print_response_batch_item(int indent, ResponseBatchItem *value)
+{
+    printf("%*sResponse Batch Item @ %p\n", indent, "", (void *)value);
+    
+    if(value != NULL)
     {
-        printf("%*sHardware\n", indent, "");
+        printf("%*sOperation: ", indent + 2, "");
+        kmip_print_operation_enum(value->operation);
+        printf("\n");
+        
+        kmip_print_byte_string(
+            indent + 2,
+            "Unique Batch Item ID",
+            value->unique_batch_item_id);
+        
+        printf("%*sResult Status: ", indent + 2, "");
+        kmip_print_result_status_enum(value->result_status);
+        printf("\n");
+        
+        printf("%*sResult Reason: ", indent + 2, "");
+        kmip_print_result_reason_enum(value->result_reason);
+        printf("\n");
+        
+        kmip_print_text_string(indent + 2, "Result Message", value->result_message);
+        kmip_print_byte_string(
+            indent + 2,
+            "Asynchronous Correlation Value",
+            value->asynchronous_correlation_value);
+        
+        kmip_print_response_payload(
+            indent + 2,
+            value->operation,
+            value->response_payload);
     }
+    
+    return;
+}
 
-    if((value & KMIP_PROTECT_ON_PROCESSOR) == KMIP_PROTECT_ON_PROCESSOR)
+void
+kmip_print_request_header(int indent, RequestHeader *value)
+{
+    printf("%*sRequest Header @ %p\n", indent, "", (void *)value);
+    
+    if(value != NULL)
     {
-        printf("%*sOn Processor\n", indent, "");
+        kmip_print_protocol_version(indent + 2, value->protocol_version);
+        
+        printf("%*sMaximum Response Size: ", indent + 2, "");
+        kmip_print_integer(value->maximum_response_size);
+        printf("\n");
+        
+        kmip_print_text_string(
+            indent + 2,
+            "Client Correlation Value",
+            value->client_correlation_value);
+        kmip_print_text_string(
+            indent + 2,
+            "Server Correlation Value",
+            value->server_correlation_value);
+        printf("%*sAsynchronous Indicator: ", indent + 2, "");
+        kmip_print_bool(value->asynchronous_indicator);
+        printf("\n");
+        printf("%*sAttestation Capable Indicator: ", indent + 2, "");
+        kmip_print_bool(value->attestation_capable_indicator);
+        printf("\n");
+        printf(
+            "%*sAttestation Types: %zu\n",
+            indent + 2,
+            "",
+            value->attestation_type_count);
+        for(size_t i = 0; i < value->attestation_type_count; i++)
+        {
+            /* TODO (ph) Add enum value -> string functionality. */
+            printf("%*sAttestation Type: %s\n", indent + 4, "", "???");
+        }
+        kmip_print_authentication(indent + 2, value->authentication);
+        printf("%*sBatch Error Continuation Option: ", indent + 2, "");
+        kmip_print_batch_error_continuation_option(
+            value->batch_error_continuation_option);
+        printf("\n");
+        printf("%*sBatch Order Option: ", indent + 2, "");
+        kmip_print_bool(value->batch_order_option);
+        printf("\n");
+        printf("%*sTime Stamp: %lu\n", indent + 2, "", value->time_stamp);
+        printf("%*sBatch Count: %d\n", indent + 2, "", value->batch_count);
     }
+}
 
-    if((value & KMIP_PROTECT_ON_SYSTEM) == KMIP_PROTECT_ON_SYSTEM)
+void
+kmip_print_response_header(int indent, ResponseHeader *value)
+{
+    printf("%*sResponse Header @ %p\n", indent, "", (void *)value);
+    
+    if(value != NULL)
     {
-        printf("%*sOn System\n", indent, "");
-    }
+        kmip_print_protocol_version(indent + 2, value->protocol_version);
+        printf("%*sTime Stamp: %lu\n", indent + 2, "", value->time_stamp);
+        kmip_print_nonce(indent + 2, value->nonce);
 
-    if((value & KMIP_PROTECT_OFF_SYSTEM) == KMIP_PROTECT_OFF_SYSTEM)
-    {
-        printf("%*sOff System\n", indent, "");
-    }
+        kmip_print_byte_string(indent + 2, "Server Hashed Password", value->server_hashed_password);
 
-    if((value & KMIP_PROTECT_HYPERVISOR) == KMIP_PROTECT_HYPERVISOR)
-    {
-        printf("%*sHypervisor\n", indent, "");
+        printf(
+            "%*sAttestation Types: %zu\n",
+            indent + 2,
+            "",
+            value->attestation_type_count);
+        for(size_t i = 0; i < value->attestation_type_count; i++)
+        {
+            /* TODO (ph) Add enum value -> string functionality. */
+            printf("%*sAttestation Type: %s\n", indent + 4, "", "???");
+        }
+        kmip_print_text_string(
+            indent + 2,
+            "Client Correlation Value",
+            value->client_correlation_value);
+        kmip_print_text_string(
+            indent + 2,
+            "Server Correlation Value",
+            value->server_correlation_value);
+        printf("%*sBatch Count: %d\n", indent + 2, "", value->batch_count);
     }
+}
 
-    if((value & KMIP_PROTECT_OPERATING_SYSTEM) == KMIP_PROTECT_OPERATING_SYSTEM)
+void
+kmip_print_request_message(RequestMessage *value)
+{
+    printf("Request Message @ %p\n", (void *)value);
+    
+    if(value != NULL)
     {
-        printf("%*sOperating System\n", indent, "");
+        kmip_print_request_header(2, value->request_header);
+        printf("%*sBatch Items: %zu\n", 2, "", value->batch_count);
+        
+        for(size_t i = 0; i < value->batch_count; i++)
+        {
+            kmip_print_request_batch_item(4, &value->batch_items[i]);
+        }
     }
+    
+    return;
+}
 
-    if((value & KMIP_PROTECT_CONTAINER) == KMIP_PROTECT_CONTAINER)
+void
+kmip_print_response_message(ResponseMessage *value)
+{
+    printf("Response Message @ %p\n", (void *)value);
+    
+    if(value != NULL)
     {
-        printf("%*sContainer\n", indent, "");
+        kmip_print_response_header(2, value->response_header);
+        printf("  Batch Items: %zu\n", value->batch_count);
+        
+        for(size_t i = 0; i < value->batch_count; i++)
+        {
+            kmip_print_response_batch_item(4, &value->batch_items[i]);
+        }
     }
+    
+    return;
+}
 
-    if((value & KMIP_PROTECT_ON_PREMISES) == KMIP_PROTECT_ON_PREMISES)
+void
+kmip_print_pool_stats(int indent, const KMIPPool *value)
+{
+    printf("%*sPool @ %p\n", indent, "", (void *)value);
+    
+    if(value != NULL)
     {
-        printf("%*sOn Premises\n", indent, "");
+        for(int i = 0; i < KMIP_POOL_CLASS_COUNT; i++)
+        {
+            const KMIPPoolStats *stats = &value->stats[i];
+            size_t total = stats->hits + stats->misses;
+            printf(
+                "%*s%zu Byte Class: %zu hits, %zu misses (%.1f%% hit rate), %zu frees, %zu in use, %zu peak\n",
+                indent + 2,
+                "",
+                kmip_pool_class_sizes[i],
+                stats->hits,
+                stats->misses,
+                (total > 0) ? (100.0 * stats->hits / total) : 0.0,
+                stats->frees,
+                stats->in_use,
+                stats->peak);
+        }
+        printf("%*sFallbacks: %zu\n", indent + 2, "", value->fallbacks);
     }
+}
 
-    if((value & KMIP_PROTECT_OFF_PREMISES) == KMIP_PROTECT_OFF_PREMISES)
+/*
+Freeing Functions
+*/
+
+void
+kmip_free_buffer(KMIP *ctx, void *buffer, size_t size)
+{
+    if(ctx == NULL)
     {
-        printf("%*sOff Premises\n", indent, "");
+        return;
     }
+    
+    ctx->memset_func(buffer, 0, size);
+    ctx->free_func(ctx->state, buffer);
+}
 
-    if((value & KMIP_PROTECT_SELF_MANAGED) == KMIP_PROTECT_SELF_MANAGED)
+void
+kmip_free_text_string(KMIP *ctx, TextString *value)
+{
+    if(ctx == NULL)
     {
-        printf("%*sSelf Managed\n", indent, "");
+        return;
     }
-
-    if((value & KMIP_PROTECT_OUTSOURCED) == KMIP_PROTECT_OUTSOURCED)
+    
+    if(value != NULL)
     {
-        printf("%*sOutsourced\n", indent, "");
+        if(value->value != NULL)
+        {
+            /* Borrowed values belong to the decoding buffer and inlined */
+            /* values are freed along with the TextString itself.       */
+            if(value->inlined == KMIP_TRUE)
+            {
+                if(KMIP_WIPE_ALL_VALUES)
+                {
+                    ctx->memset_func(value->value, 0, value->size);
+                }
+            }
+            else if(value->borrowed != KMIP_TRUE)
+            {
+                kmip_free_memory(ctx, value->value, value->size, KMIP_FALSE);
+            }
+            
+            value->value = NULL;
+        }
+        
+        value->size = 0;
+        value->borrowed = KMIP_FALSE;
+        value->inlined = KMIP_FALSE;
     }
+    
+    return;
+}
 
-    if((value & KMIP_PROTECT_VALIDATED) == KMIP_PROTECT_VALIDATED)
+void
+kmip_free_sensitive_text_string(KMIP *ctx, TextString *value)
+{
+    if(ctx == NULL)
     {
-        printf("%*sValidated\n", indent, "");
+        return;
     }
-
-    if((value & KMIP_PROTECT_SAME_JURISDICTION) == KMIP_PROTECT_SAME_JURISDICTION)
+    
+    if(value != NULL && value->value != NULL && value->borrowed != KMIP_TRUE)
     {
-        printf("%*sSame Jurisdiction\n", indent, "");
+        if(value->inlined == KMIP_TRUE)
+        {
+            ctx->memset_func(value->value, 0, value->size);
+        }
+        else
+        {
+            kmip_free_memory(ctx, value->value, value->size, KMIP_TRUE);
+        }
+        value->value = NULL;
     }
+    
+    kmip_free_text_string(ctx, value);
+    
+    return;
 }
 
 void
-kmip_print_protection_storage_masks(int indent, ProtectionStorageMasks *value)
+kmip_free_byte_string(KMIP *ctx, ByteString *value)
 {
-    printf("%*sProtection Storage Masks @ %p\n", indent, "", (void *)value);
-
     if(value != NULL)
     {
-        printf("%*sMasks: %zu\n", indent + 2, "", value->masks->size);
-        LinkedListItem *curr = value->masks->head;
-        size_t count = 1;
-        while(curr != NULL)
+        if(value->value != NULL)
         {
-            printf("%*sMask: %zu", indent + 4, "", count);
-            int32 mask = *(int32 *)curr->data;
-            kmip_print_protection_storage_mask_enum(indent + 6, mask);
-
-            curr = curr->next;
-            count++;
+            /* Borrowed values belong to the decoding buffer. */
+            if(value->borrowed != KMIP_TRUE)
+            {
+                kmip_free_memory(ctx, value->value, value->size, KMIP_FALSE);
+            }
+            
+            value->value = NULL;
         }
+        
+        value->size = 0;
+        value->borrowed = KMIP_FALSE;
     }
+    
+    return;
 }
 
 void
-kmip_print_integer(int32 value)
+kmip_free_sensitive_byte_string(KMIP *ctx, ByteString *value)
 {
-    switch(value)
+    if(value != NULL && value->value != NULL && value->borrowed != KMIP_TRUE)
     {
-        case KMIP_UNSET:
-        printf("-");
-        break;
-        
-        default:
-        printf("%d", value);
-        break;
-    };
+        kmip_free_memory(ctx, value->value, value->size, KMIP_TRUE);
+        value->value = NULL;
+    }
+    
+    kmip_free_byte_string(ctx, value);
+    
+    return;
 }
 
 void
-kmip_print_bool(int32 value)
+kmip_free_name(KMIP *ctx, Name *value)
 {
-    switch(value)
+    kmip_free_schema(ctx, &kmip_name_schema, value);
+    
+    return;
+}
+
+void
+kmip_free_protection_storage_masks(KMIP *ctx, ProtectionStorageMasks *value)
+{
+    if(value != NULL)
     {
-        case KMIP_TRUE:
-        printf("True");
-        break;
-        
-        case KMIP_FALSE:
-        printf("False");
-        break;
-        
-        default:
-        printf("-");
-        break;
-    };
+        void *mask = kmip_vector_pop(&value->masks);
+        while(mask != NULL)
+        {
+            ctx->free_func(ctx->state, mask);
+            mask = kmip_vector_pop(&value->masks);
+        }
+        kmip_free_vector(ctx, &value->masks);
+    }
+
+    return;
 }
 
 void
-kmip_print_text_string(int indent, const char *name, TextString *value)
+kmip_free_attribute(KMIP *ctx, Attribute *value)
 {
-    printf("%*s%s @ %p\n", indent, "", name, (void *)value);
-    
     if(value != NULL)
     {
-        printf("%*sValue: %.*s\n", indent + 2, "", (int)value->size, value->value);
+        if(value->value != NULL)
+        {
+            switch(value->type)
+            {
+                case KMIP_ATTR_APPLICATION_SPECIFIC_INFORMATION:
+                {
+                    kmip_free_application_specific_information(ctx, value->value);
+                }
+                break;
+
+                case KMIP_ATTR_UNIQUE_IDENTIFIER:
+                kmip_free_text_string(ctx, value->value);
+                break;
+                
+                case KMIP_ATTR_NAME:
+                kmip_free_name(ctx, value->value);
+                break;
+                
+                case KMIP_ATTR_OBJECT_TYPE:
+                *(int32*)value->value = 0;
+                break;
+                
+                case KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM:
+                *(int32*)value->value = 0;
+                break;
+                
+                case KMIP_ATTR_CRYPTOGRAPHIC_LENGTH:
+                *(int32*)value->value = KMIP_UNSET;
+                break;
+                
+                case KMIP_ATTR_OPERATION_POLICY_NAME:
+                kmip_free_text_string(ctx, value->value);
+                break;
+                
+                case KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK:
+                *(int32*)value->value = KMIP_UNSET;
+                break;
+                
+                case KMIP_ATTR_STATE:
+                *(int32*)value->value = 0;
+                break;
+                
+                default:
+                switch(kmip_get_attribute_value_type(value->type))
+                {
+                    case KMIP_TYPE_TEXT_STRING:
+                    kmip_free_text_string(ctx, value->value);
+                    break;
+                    
+                    case KMIP_TYPE_INTEGER:
+                    case KMIP_TYPE_ENUMERATION:
+                    case KMIP_TYPE_BOOLEAN:
+                    case KMIP_TYPE_INTERVAL:
+                    *(int32*)value->value = 0;
+                    break;
+                    
+                    case KMIP_TYPE_DATE_TIME:
+                    *(uint64*)value->value = 0;
+                    break;
+                    
+                    default:
+                    /* NOTE (ph) Hitting this case means that we don't know what */
+                    /*      the actual type, size, or value of value->value is.  */
+                    /*      We can still free it but we cannot securely zero the */
+                    /*      memory. We also do not know how to free any possible */
+                    /*      substructures pointed to within value->value.        */
+                    /*                                                           */
+                    /*      Avoid hitting this case at all costs.                */
+                    break;
+                };
+                break;
+            };
+            
+            ctx->free_func(ctx->state, value->value);
+            value->value = NULL;
+        }
+        
+        value->type = 0;
+        value->index = KMIP_UNSET;
     }
     
     return;
 }
 
 void
-kmip_print_byte_string(int indent, const char *name, ByteString *value)
+kmip_free_attributes(KMIP *ctx, Attributes *value)
 {
-    printf("%*s%s @ %p\n", indent, "", name, (void *)value);
-    
     if(value != NULL)
     {
-        printf("%*sValue:", indent + 2, "");
-        for(size_t i = 0; i < value->size; i++)
+        Attribute *attribute = kmip_vector_pop(&value->attribute_list);
+        while(attribute != NULL)
         {
-            if(i % 16 == 0)
-            {
-                printf("\n%*s0x", indent + 4, "");
-            }
-            printf("%02X", value->value[i]);
+            kmip_free_attribute(ctx, attribute);
+            ctx->free_func(ctx->state, attribute);
+            attribute = kmip_vector_pop(&value->attribute_list);
         }
-        printf("\n");
+        kmip_free_vector(ctx, &value->attribute_list);
+        kmip_init_attribute_index(&value->index);
     }
-    
+
     return;
 }
 
 void
-kmip_print_protocol_version(int indent, ProtocolVersion *value)
+kmip_free_template_attribute(KMIP *ctx, TemplateAttribute *value)
 {
-    printf("%*sProtocol Version @ %p\n", indent, "", (void *)value);
-    
     if(value != NULL)
     {
-        printf("%*sMajor: %d\n", indent + 2, "", value->major);
-        printf("%*sMinor: %d\n", indent + 2, "", value->minor);
+        if(value->names != NULL)
+        {
+            for(size_t i = 0; i < value->name_count; i++)
+            {
+                kmip_free_name(ctx, &value->names[i]);
+            }
+            ctx->free_func(ctx->state, value->names);
+            
+            value->names = NULL;
+        }
+        
+        value->name_count = 0;
+        
+        if(value->attributes != NULL)
+        {
+            for(size_t i = 0; i < value->attribute_count; i++)
+            {
+                kmip_free_attribute(ctx, &value->attributes[i]);
+            }
+            ctx->free_func(ctx->state, value->attributes);
+            
+            value->attributes = NULL;
+        }
+        
+        value->attribute_count = 0;
+        kmip_init_attribute_index(&value->index);
+        value->fragment = NULL;
     }
     
     return;
 }
 
 void
-kmip_print_name(int indent, Name *value)
+kmip_free_transparent_symmetric_key(KMIP *ctx, TransparentSymmetricKey *value)
 {
-    printf("%*sName @ %p\n", indent, "", (void *)value);
+    kmip_free_schema(ctx, &kmip_transparent_symmetric_key_schema, value);
     
-    if(value != NULL)
-    {
-        kmip_print_text_string(indent + 2, "Name Value", value->value);
-        
-        printf("%*sName Type: ", indent + 2, "");
-        kmip_print_name_type_enum(value->type);
-        printf("\n");
-    }
+    return;
 }
 
 void
-kmip_print_nonce(int indent, Nonce *value)
+kmip_free_key_material(KMIP *ctx, enum key_format_type format, void **value)
 {
-    printf("%*sNonce @ %p\n", indent, "", (void *)value);
-    
     if(value != NULL)
     {
-        kmip_print_byte_string(indent + 2, "Nonce ID", value->nonce_id);
-        kmip_print_byte_string(indent + 2, "Nonce Value", value->nonce_value);
+        if(*value != NULL)
+        {
+            switch(format)
+            {
+                case KMIP_KEYFORMAT_RAW:
+                case KMIP_KEYFORMAT_OPAQUE:
+                case KMIP_KEYFORMAT_PKCS1:
+                case KMIP_KEYFORMAT_PKCS8:
+                case KMIP_KEYFORMAT_X509:
+                case KMIP_KEYFORMAT_EC_PRIVATE_KEY:
+                kmip_free_sensitive_byte_string(ctx, *value);
+                break;
+                
+                case KMIP_KEYFORMAT_TRANS_SYMMETRIC_KEY:
+                kmip_free_transparent_symmetric_key(ctx, *value);
+                break;
+                
+                default:
+                /* NOTE (ph) Hitting this case means that we don't know   */
+                /*      what the actual type, size, or value of value is. */
+                /*      We can still free it but we cannot securely zero  */
+                /*      the memory. We also do not know how to free any   */
+                /*      possible substructures pointed to within value.   */
+                /*                                                        */
+                /*      Avoid hitting this case at all costs.             */
+                break;
+            };
+            
+            ctx->free_func(ctx->state, *value);
+            *value = NULL;
+        }
     }
     
     return;
 }
 
 void
-kmip_print_application_specific_information(int indent, ApplicationSpecificInformation *value)
-{
-    printf("%*sApplication Specific Information @ %p\n", indent, "", (void *)value);
-
-    if(value != NULL)
-    {
-        kmip_print_text_string(indent + 2, "Application Namespace", value->application_namespace);
-        kmip_print_text_string(indent + 2, "Application Data", value->application_data);
-    }
-}
-
-void
-kmip_print_cryptographic_parameters(int indent, CryptographicParameters *value)
+kmip_free_key_value(KMIP *ctx, enum key_format_type format, KeyValue *value)
 {
-    printf("%*sCryptographic Parameters @ %p\n", indent, "", (void *)value);
-    
     if(value != NULL)
     {
-        printf("%*sBlock Cipher Mode: ", indent + 2, "");
-        kmip_print_block_cipher_mode_enum(value->block_cipher_mode);
-        printf("\n");
-        
-        printf("%*sPadding Method: ", indent + 2, "");
-        kmip_print_padding_method_enum(value->padding_method);
-        printf("\n");
-        
-        printf("%*sHashing Algorithm: ", indent + 2, "");
-        kmip_print_hashing_algorithm_enum(value->hashing_algorithm);
-        printf("\n");
-        
-        printf("%*sKey Role Type: ", indent + 2, "");
-        kmip_print_key_role_type_enum(value->key_role_type);
-        printf("\n");
-        
-        printf("%*sDigital Signature Algorithm: ", indent + 2, "");
-        kmip_print_digital_signature_algorithm_enum(value->digital_signature_algorithm);
-        printf("\n");
-        
-        printf("%*sCryptographic Algorithm: ", indent + 2, "");
-        kmip_print_cryptographic_algorithm_enum(value->cryptographic_algorithm);
-        printf("\n");
-        
-        printf("%*sRandom IV: ", indent + 2, "");
-        kmip_print_bool(value->random_iv);
-        printf("\n");
-        
-        printf("%*sIV Length: ", indent + 2, "");
-        kmip_print_integer(value->iv_length);
-        printf("\n");
-        
-        printf("%*sTag Length: ", indent + 2, "");
-        kmip_print_integer(value->tag_length);
-        printf("\n");
-        
-        printf("%*sFixed Field Length: ", indent + 2, "");
-        kmip_print_integer(value->fixed_field_length);
-        printf("\n");
-        
-        printf("%*sInvocation Field Length: ", indent + 2, "");
-        kmip_print_integer(value->invocation_field_length);
-        printf("\n");
-        
-        printf("%*sCounter Length: ", indent + 2, "");
-        kmip_print_integer(value->counter_length);
-        printf("\n");
-        
-        printf("%*sInitial Counter Value: ", indent + 2, "");
-        kmip_print_integer(value->initial_counter_value);
-        printf("\n");
-        
-        printf("%*sSalt Length: ", indent + 2, "");
-        kmip_print_integer(value->salt_length);
-        printf("\n");
-        
-        printf("%*sMask Generator: ", indent + 2, "");
-        kmip_print_mask_generator_enum(value->mask_generator);
-        printf("\n");
-        
-        printf("%*sMask Generator Hashing Algorithm: ", indent + 2, "");
-        kmip_print_hashing_algorithm_enum(value->mask_generator_hashing_algorithm);
-        printf("\n");
+        if(value->key_material != NULL)
+        {
+            kmip_free_key_material(ctx, format, &value->key_material);
+            value->key_material = NULL;
+        }
         
-        kmip_print_byte_string(indent + 2, "P Source", value->p_source);
+        if(value->attributes != NULL)
+        {
+            for(size_t i = 0; i < value->attribute_count; i++)
+            {
+                kmip_free_attribute(ctx, &value->attributes[i]);
+            }
+            ctx->free_func(ctx->state, value->attributes);
+            
+            value->attributes = NULL;
+        }
         
-        printf("%*sTrailer Field: ", indent + 2, "");
-        kmip_print_integer(value->trailer_field);
-        printf("\n");
+        value->attribute_count = 0;
     }
-}
-
-void
-kmip_print_encryption_key_information(int indent, EncryptionKeyInformation *value)
-{
-    printf("%*sEncryption Key Information @ %p\n", indent, "", (void *)value);
     
-    if(value != NULL)
-    {
-        kmip_print_text_string(indent + 2, "Unique Identifier", value->unique_identifier);
-        
-        kmip_print_cryptographic_parameters(indent + 2, value->cryptographic_parameters);
-    }
+    return;
 }
 
 void
-kmip_print_mac_signature_key_information(int indent, MACSignatureKeyInformation *value)
+kmip_free_application_specific_information(KMIP *ctx, ApplicationSpecificInformation *value)
 {
-    printf("%*sMAC/Signature Key Information @ %p\n", indent, "", (void *)value);
-    
     if(value != NULL)
     {
-        kmip_print_text_string(indent + 2, "Unique Identifier", value->unique_identifier);
-        
-        kmip_print_cryptographic_parameters(indent + 2, value->cryptographic_parameters);
-    }
-}
+        if(value->application_namespace != NULL)
+        {
+            kmip_free_text_string(ctx, value->application_namespace);
 
-void
-kmip_print_key_wrapping_data(int indent, KeyWrappingData *value)
-{
-    printf("%*sKey Wrapping Data @ %p\n", indent, "", (void *)value);
-    
-    if(value != NULL)
-    {
-        printf("%*sWrapping Method: ", indent + 2, "");
-        kmip_print_wrapping_method_enum(value->wrapping_method);
-        printf("\n");
-        
-        kmip_print_encryption_key_information(indent + 2, value->encryption_key_info);
-        
-        kmip_print_mac_signature_key_information(indent + 2, value->mac_signature_key_info);
-        
-        kmip_print_byte_string(indent + 2, "MAC/Signature", value->mac_signature);
-        
-        kmip_print_byte_string(indent + 2, "IV/Counter/Nonce", value->iv_counter_nonce);
-        
-        printf("%*sEncoding Option: ", indent + 2, "");
-        kmip_print_encoding_option_enum(value->encoding_option);
-        printf("\n");
+            ctx->free_func(ctx->state, value->application_namespace);
+            value->application_namespace = NULL;
+        }
+
+        if(value->application_data != NULL)
+        {
+            kmip_free_text_string(ctx, value->application_data);
+
+            ctx->free_func(ctx->state, value->application_data);
+            value->application_data = NULL;
+        }
     }
-    
+
     return;
 }
 
 void
-kmip_print_attribute_value(int indent, enum attribute_type type, void *value)
+kmip_free_cryptographic_parameters(KMIP *ctx, CryptographicParameters *value)
 {
-    printf("%*sAttribute Value: ", indent, "");
+    kmip_free_schema(ctx, &kmip_cryptographic_parameters_schema, value);
     
-    switch(type)
-    {
-        case KMIP_ATTR_APPLICATION_SPECIFIC_INFORMATION:
-        {
-            printf("\n");
-            kmip_print_application_specific_information(indent + 2, value);
-        }
-        break;
-
-        case KMIP_ATTR_UNIQUE_IDENTIFIER:
-        printf("\n");
-        kmip_print_text_string(indent + 2, "Unique Identifier", value);
-        break;
-        
-        case KMIP_ATTR_NAME:
-        printf("\n");
-        kmip_print_name(indent + 2, value);
-        break;
-        
-        case KMIP_ATTR_OBJECT_TYPE:
-        kmip_print_object_type_enum(*(enum object_type *)value);
-        printf("\n");
-        break;
-        
-        case KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM:
-        kmip_print_cryptographic_algorithm_enum(*(enum cryptographic_algorithm *)value);
-        printf("\n");
-        break;
-        
-        case KMIP_ATTR_CRYPTOGRAPHIC_LENGTH:
-        printf("%d\n", *(int32 *)value);
-        break;
-        
-        case KMIP_ATTR_OPERATION_POLICY_NAME:
-        printf("\n");
-        kmip_print_text_string(indent + 2, "Operation Policy Name", value);
-        break;
-        
-        case KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK:
-        kmip_print_cryptographic_usage_mask_enums(indent + 2, *(int32 *)value);
-        break;
-        
-        case KMIP_ATTR_STATE:
-        kmip_print_state_enum(*(enum state *)value);
-        printf("\n");
-        break;
-        
-        default:
-        printf("Unknown\n");
-        break;
-    };
+    return;
 }
 
 void
-kmip_print_attribute(int indent, Attribute *value)
+kmip_free_encryption_key_information(KMIP *ctx, EncryptionKeyInformation *value)
 {
-    printf("%*sAttribute @ %p\n", indent, "", (void *)value);
+    kmip_free_schema(ctx, &kmip_encryption_key_information_schema, value);
     
-    if(value != NULL)
-    {
-        printf("%*sAttribute Name: ", indent + 2, "");
-        kmip_print_attribute_type_enum(value->type);
-        printf("\n");
-        
-        printf("%*sAttribute Index: ", indent + 2, "");
-        kmip_print_integer(value->index);
-        printf("\n");
-        
-        kmip_print_attribute_value(indent + 2, value->type, value->value);
-    }
+    return;
+}
+
+void
+kmip_free_mac_signature_key_information(KMIP *ctx, MACSignatureKeyInformation *value)
+{
+    kmip_free_schema(ctx, &kmip_mac_signature_key_information_schema, value);
     
     return;
 }
 
 void
-kmip_print_key_material(int indent, enum key_format_type format, void *value)
+kmip_free_key_wrapping_data(KMIP *ctx, KeyWrappingData *value)
 {
-    switch(format)
-    {
-        case KMIP_KEYFORMAT_RAW:
-        case KMIP_KEYFORMAT_OPAQUE:
-        case KMIP_KEYFORMAT_PKCS1:
-        case KMIP_KEYFORMAT_PKCS8:
-        case KMIP_KEYFORMAT_X509:
-        case KMIP_KEYFORMAT_EC_PRIVATE_KEY:
-        kmip_print_byte_string(indent, "Key Material", (ByteString *)value);
-        break;
-        
-        default:
-        printf("%*sUnknown Key Material @ %p\n", indent, "", value);
-        break;
-    };
+    kmip_free_schema(ctx, &kmip_key_wrapping_data_schema, value);
+    
+    return;
 }
 
 void
-kmip_print_key_value(int indent, enum type type, enum key_format_type format, void *value)
+kmip_free_key_block(KMIP *ctx, KeyBlock *value)
 {
-    switch(type)
+    if(value != NULL)
     {
-        case KMIP_TYPE_BYTE_STRING:
-        kmip_print_byte_string(indent, "Key Value", (ByteString *)value);
-        break;
-        
-        case KMIP_TYPE_STRUCTURE:
-        printf("%*sKey Value @ %p\n", indent, "", value);
-        
-        if(value != NULL)
+        if(value->key_value != NULL)
         {
-            KeyValue key_value = *(KeyValue *)value;
-            kmip_print_key_material(indent + 2, format, key_value.key_material);
-            printf("%*sAttributes: %zu\n", indent + 2, "", key_value.attribute_count);
-            for(size_t i = 0; i < key_value.attribute_count; i++)
+            if(value->key_value_type == KMIP_TYPE_BYTE_STRING)
             {
-                kmip_print_attribute(indent + 2, &key_value.attributes[i]);
+                kmip_free_sensitive_byte_string(ctx, value->key_value);
+                ctx->free_func(ctx->state, value->key_value);
+            }
+            else
+            {
+                kmip_free_key_value(ctx, value->key_format_type, value->key_value);
+                ctx->free_func(ctx->state, value->key_value);
             }
+            value->key_value = NULL;
         }
-        break;
         
-        default:
-        printf("%*sUnknown Key Value @ %p\n", indent, "", value);
-        break;
-    };
+        if(value->key_wrapping_data != NULL)
+        {
+            kmip_free_key_wrapping_data(ctx, value->key_wrapping_data);
+            ctx->free_func(ctx->state, value->key_wrapping_data);
+            value->key_wrapping_data = NULL;
+        }
+        
+        kmip_init_key_block(value);
+    }
+    
+    return;
 }
 
 void
-kmip_print_key_block(int indent, KeyBlock *value)
+kmip_free_symmetric_key(KMIP *ctx, SymmetricKey *value)
 {
-    printf("%*sKey Block @ %p\n", indent, "", (void *)value);
-    
     if(value != NULL)
     {
-        printf("%*sKey Format Type: ", indent + 2, "");
-        kmip_print_key_format_type_enum(value->key_format_type);
-        printf("\n");
-        
-        printf("%*sKey Compression Type: ", indent + 2, "");
-        kmip_print_key_compression_type_enum(value->key_compression_type);
-        printf("\n");
-        
-        kmip_print_key_value(indent + 2, value->key_value_type, value->key_format_type, value->key_value);
-        
-        printf("%*sCryptographic Algorithm: ", indent + 2, "");
-        kmip_print_cryptographic_algorithm_enum(value->cryptographic_algorithm);
-        printf("\n");
-        
-        printf("%*sCryptographic Length: %d\n", indent + 2, "", value->cryptographic_length);
-        
-        kmip_print_key_wrapping_data(indent + 2, value->key_wrapping_data);
+        if(value->key_block != NULL)
+        {
+            kmip_free_key_block(ctx, value->key_block);
+            ctx->free_func(ctx->state, value->key_block);
+            value->key_block = NULL;
+        }
     }
     
     return;
 }
 
 void
-kmip_print_symmetric_key(int indent, SymmetricKey *value)
+kmip_free_public_key(KMIP *ctx, PublicKey *value)
 {
-    printf("%*sSymmetric Key @ %p\n", indent, "", (void *)value);
-    
     if(value != NULL)
     {
-        kmip_print_key_block(indent + 2, value->key_block);
+        if(value->key_block != NULL)
+        {
+            kmip_free_key_block(ctx, value->key_block);
+            ctx->free_func(ctx->state, value->key_block);
+            value->key_block = NULL;
+        }
     }
     
     return;
 }
 
 void
-kmip_print_object(int indent, enum object_type type, void *value)
+kmip_free_private_key(KMIP *ctx, PrivateKey *value)
 {
-    switch(type)
+    if(value != NULL)
     {
-        case KMIP_OBJTYPE_SYMMETRIC_KEY:
-        kmip_print_symmetric_key(indent, (SymmetricKey *)value);
-        break;
-        
-        default:
-        printf("%*sUnknown Object @ %p\n", indent, "", value);
-        break;
-    };
+        if(value->key_block != NULL)
+        {
+            kmip_free_key_block(ctx, value->key_block);
+            ctx->free_func(ctx->state, value->key_block);
+            value->key_block = NULL;
+        }
+    }
+    
+    return;
 }
 
 void
-kmip_print_key_wrapping_specification(int indent, KeyWrappingSpecification *value)
+kmip_free_key_wrapping_specification(KMIP *ctx, KeyWrappingSpecification *value)
 {
-    printf("%*sKey Wrapping Specification @ %p\n", indent, "", (void *)value);
+    if(value != NULL)
+    {
+        if(value->encryption_key_info != NULL)
+        {
+            kmip_free_encryption_key_information(ctx, value->encryption_key_info);
+            ctx->free_func(ctx->state, value->encryption_key_info);
+            value->encryption_key_info = NULL;
+        }
+        
+        if(value->mac_signature_key_info != NULL)
+        {
+            kmip_free_mac_signature_key_information(ctx, value->mac_signature_key_info);
+            ctx->free_func(ctx->state, value->mac_signature_key_info);
+            value->mac_signature_key_info = NULL;
+        }
+        
+        if(value->attribute_names != NULL)
+        {
+            for(size_t i = 0; i < value->attribute_name_count; i++)
+            {
+                kmip_free_text_string(ctx, &value->attribute_names[i]);
+            }
+            ctx->free_func(ctx->state, value->attribute_names);
+            value->attribute_names = NULL;
+        }
+        value->attribute_name_count = 0;
+        
+        value->wrapping_method = 0;
+        value->encoding_option = 0;
+    }
+    
+    return;
 }
 
 void
-kmip_print_attributes(int indent, Attributes *value)
+kmip_free_create_request_payload(KMIP *ctx, CreateRequestPayload *value)
 {
-    printf("%*sAttributes @ %p\n", indent, "", (void *)value);
-
     if(value != NULL)
     {
-        printf("%*sAttributes: %zu\n", indent + 2, "", value->attribute_list->size);
-        LinkedListItem *curr = value->attribute_list->head;
-        while(curr != NULL)
+        if(value->template_attribute != NULL)
         {
-            Attribute *attribute = (Attribute *)curr->data;
-            kmip_print_attribute(indent + 4, attribute);
+            kmip_free_template_attribute(ctx, value->template_attribute);
+            ctx->free_func(ctx->state, value->template_attribute);
+            value->template_attribute = NULL;
+        }
+
+        if(value->attributes != NULL)
+        {
+            kmip_free_attributes(ctx, value->attributes);
+            ctx->free_func(ctx->state, value->attributes);
+            value->attributes = NULL;
+        }
 
-            curr = curr->next;
+        if(value->protection_storage_masks != NULL)
+        {
+            kmip_free_protection_storage_masks(ctx, value->protection_storage_masks);
+            ctx->free_func(ctx->state, value->protection_storage_masks);
+            value->protection_storage_masks = NULL;
         }
+        
+        value->object_type = 0;
     }
+    
+    return;
 }
 
 void
-kmip_print_template_attribute(int indent, TemplateAttribute *value)
+kmip_free_create_response_payload(KMIP *ctx, CreateResponsePayload *value)
 {
-    printf("%*sTemplate Attribute @ %p\n", indent, "", (void *)value);
-    
     if(value != NULL)
     {
-        printf("%*sNames: %zu\n", indent + 2, "", value->name_count);
-        for(size_t i = 0; i < value->name_count; i++)
+        if(value->unique_identifier != NULL)
         {
-            kmip_print_name(indent + 4, &value->names[i]);
+            kmip_free_text_string(ctx, value->unique_identifier);
+            ctx->free_func(ctx->state, value->unique_identifier);
+            value->unique_identifier = NULL;
         }
         
-        printf("%*sAttributes: %zu\n", indent + 2, "", value->attribute_count);
-        for(size_t i = 0; i< value->attribute_count; i++)
+        if(value->template_attribute != NULL)
         {
-            kmip_print_attribute(indent + 4, &value->attributes[i]);
+            kmip_free_template_attribute(ctx, value->template_attribute);
+            ctx->free_func(ctx->state, value->template_attribute);
+            value->template_attribute = NULL;
         }
+        
+        value->object_type = 0;
     }
+    
+    return;
 }
 
 void
-kmip_print_create_request_payload(int indent, CreateRequestPayload *value)
+kmip_free_get_request_payload(KMIP *ctx, GetRequestPayload *value)
 {
-    printf("%*sCreate Request Payload @ %p\n", indent, "", (void *)value);
-    
     if(value != NULL)
     {
-        printf("%*sObject Type: ", indent + 2, "");
-        kmip_print_object_type_enum(value->object_type);
-        printf("\n");
+        if(value->unique_identifier != NULL)
+        {
+            kmip_free_text_string(ctx, value->unique_identifier);
+            ctx->free_func(ctx->state, value->unique_identifier);
+            value->unique_identifier = NULL;
+        }
         
-        kmip_print_template_attribute(indent + 2, value->template_attribute);
-        kmip_print_attributes(indent + 2, value->attributes);
-        kmip_print_protection_storage_masks(indent + 2, value->protection_storage_masks);
+        if(value->key_wrapping_spec != NULL)
+        {
+            kmip_free_key_wrapping_specification(ctx, value->key_wrapping_spec);
+            ctx->free_func(ctx->state, value->key_wrapping_spec);
+            value->key_wrapping_spec = NULL;
+        }
+        
+        value->key_format_type = 0;
+        value->key_compression_type = 0;
+        value->key_wrap_type = 0;
     }
+    
+    return;
 }
 
 void
-kmip_print_create_response_payload(int indent, CreateResponsePayload *value)
+kmip_free_get_response_payload(KMIP *ctx, GetResponsePayload *value)
 {
-    printf("%*sCreate Response Payload @ %p\n", indent, "", (void *)value);
-    
     if(value != NULL)
     {
-        printf("%*sObject Type: ", indent + 2, "");
-        kmip_print_object_type_enum(value->object_type);
-        printf("\n");
+        if(value->unique_identifier != NULL)
+        {
+            kmip_free_text_string(ctx, value->unique_identifier);
+            ctx->free_func(ctx->state, value->unique_identifier);
+            value->unique_identifier = NULL;
+        }
         
-        kmip_print_text_string(
-            indent + 2,
-            "Unique Identifier",
-            value->unique_identifier);
+        if(value->object != NULL)
+        {
+            switch(value->object_type)
+            {
+                case KMIP_OBJTYPE_SYMMETRIC_KEY:
+                kmip_free_symmetric_key(ctx, (SymmetricKey *)value->object);
+                break;
+                
+                case KMIP_OBJTYPE_PUBLIC_KEY:
+                kmip_free_public_key(ctx, (PublicKey *)value->object);
+                break;
+                
+                case KMIP_OBJTYPE_PRIVATE_KEY:
+                kmip_free_private_key(ctx, (PrivateKey *)value->object);
+                break;
+                
+                default:
+                /* NOTE (ph) Hitting this case means that we don't know */
+                /*      what the actual type, size, or value of         */
+                /*      value->object is. We can still free it but we   */
+                /*      cannot securely zero the memory. We also do not */
+                /*      know how to free any possible substructures     */
+                /*      pointed to within value->object.                */
+                /*                                                      */
+                /*      Avoid hitting this case at all costs.           */
+                break;
+            };
+            
+            ctx->free_func(ctx->state, value->object);
+            value->object = NULL;
+        }
         
-        kmip_print_template_attribute(indent + 2, value->template_attribute);
+        value->object_type = 0;
     }
+    
+    return;
 }
 
 void
-kmip_print_get_request_payload(int indent, GetRequestPayload *value)
+kmip_free_destroy_request_payload(KMIP *ctx, DestroyRequestPayload *value)
 {
-    printf("%*sGet Request Payload @ %p\n", indent, "", (void *)value);
+    kmip_free_schema(ctx, &kmip_destroy_request_payload_schema, value);
     
-    if(value != NULL)
-    {
-        kmip_print_text_string(
-            indent + 2,
-            "Unique Identifier",
-            value->unique_identifier);
-        
-        printf("%*sKey Format Type: ", indent + 2, "");
-        kmip_print_key_format_type_enum(value->key_format_type);
-        printf("\n");
-        
-        printf("%*sKey Wrap Type: ", indent + 2, "");
-        kmip_print_key_wrap_type_enum(value->key_wrap_type);
-        printf("\n");
-        
-        printf("%*sKey Compression Type: ", indent + 2, "");
-        kmip_print_key_compression_type_enum(value->key_compression_type);
-        printf("\n");
-        
-        kmip_print_key_wrapping_specification(indent + 2, value->key_wrapping_spec);
-    }
+    return;
 }
 
 void
-kmip_print_get_response_payload(int indent, GetResponsePayload *value)
+kmip_free_destroy_response_payload(KMIP *ctx, DestroyResponsePayload *value)
 {
-    printf("%*sGet Response Payload @ %p\n", indent, "", (void *)value);
-    
-    if(value != NULL)
-    {
-        printf("%*sObject Type: ", indent + 2, "");
-        kmip_print_object_type_enum(value->object_type);
-        printf("\n");
-        
-        kmip_print_text_string(indent + 2, "Unique Identifier", value->unique_identifier);
-        kmip_print_object(indent + 2, value->object_type, value->object);
-    }
+    kmip_free_schema(ctx, &kmip_destroy_response_payload_schema, value);
     
     return;
 }
 
 void
-kmip_print_destroy_request_payload(int indent, DestroyRequestPayload *value)
+kmip_free_request_batch_item(KMIP *ctx, RequestBatchItem *value)
 {
-    printf("%*sDestroy Request Payload @ %p\n", indent, "", (void *)value);
-    
     if(value != NULL)
     {
-        kmip_print_text_string(
-            indent + 2,
-            "Unique Identifier",
-            value->unique_identifier);
+        if(value->unique_batch_item_id != NULL)
+        {
+            kmip_free_byte_string(ctx, value->unique_batch_item_id);
+            ctx->free_func(ctx->state, value->unique_batch_item_id);
+            value->unique_batch_item_id = NULL;
+        }
+        
+        if(value->request_payload != NULL)
+        {
+            switch(value->operation)
+            {
+                case KMIP_OP_CREATE:
+                kmip_free_create_request_payload(ctx, (CreateRequestPayload *)value->request_payload);
+                break;
+                
+                case KMIP_OP_GET:
+                kmip_free_get_request_payload(ctx, (GetRequestPayload *)value->request_payload);
+                break;
+                
+                case KMIP_OP_DESTROY:
+                kmip_free_destroy_request_payload(ctx, (DestroyRequestPayload *)value->request_payload);
+                break;
+                
+                default:
+                /* NOTE (ph) Hitting this case means that we don't know    */
+                /*      what the actual type, size, or value of            */
+                /*      value->request_payload is. We can still free it    */
+                /*      but we cannot securely zero the memory. We also    */
+                /*      do not know how to free any possible substructures */
+                /*      pointed to within value->request_payload.          */
+                /*                                                         */
+                /*      Avoid hitting this case at all costs.              */
+                break;
+            };
+            
+            ctx->free_func(ctx->state, value->request_payload);
+            value->request_payload = NULL;
+        }
+        
+        value->operation = 0;
+        value->ephemeral = 0;
     }
+    
+    return;
 }
 
 void
-kmip_print_destroy_response_payload(int indent, DestroyResponsePayload *value)
+kmip_free_response_batch_item(KMIP *ctx, ResponseBatchItem *value)
 {
-    printf("%*sDestroy Response Payload @ %p\n", indent, "", (void *)value);
-
     if(value != NULL)
     {
-        kmip_print_text_string(
-            indent + 2,
-            "Unique Identifier",
-            value->unique_identifier);
+        if(value->unique_batch_item_id != NULL)
+        {
+            kmip_free_byte_string(ctx, value->unique_batch_item_id);
+            ctx->free_func(ctx->state, value->unique_batch_item_id);
+            value->unique_batch_item_id = NULL;
+        }
+        
+        if(value->result_message != NULL)
+        {
+            kmip_free_text_string(ctx, value->result_message);
+            ctx->free_func(ctx->state, value->result_message);
+            value->result_message = NULL;
+        }
+        
+        if(value->asynchronous_correlation_value != NULL)
+        {
+            kmip_free_byte_string(ctx, value->asynchronous_correlation_value);
+            ctx->free_func(ctx->state, value->asynchronous_correlation_value);
+            value->asynchronous_correlation_value = NULL;
+        }
+        
+        if(value->response_payload != NULL)
+        {
+            switch(value->operation)
+            {
+                case KMIP_OP_CREATE:
+                kmip_free_create_response_payload(ctx, (CreateResponsePayload *)value->response_payload);
+                break;
+                
+                case KMIP_OP_GET:
+                kmip_free_get_response_payload(ctx, (GetResponsePayload *)value->response_payload);
+                break;
+                
+                case KMIP_OP_DESTROY:
+                kmip_free_destroy_response_payload(ctx, (DestroyResponsePayload *)value->response_payload);
+                break;
+                
+                default:
+                /* NOTE (ph) Hitting this case means that we don't know    */
+                /*      what the actual type, size, or value of            */
+                /*      value->response_payload is. We can still free it   */
+                /*      but we cannot securely zero the memory. We also    */
+                /*      do not know how to free any possible substructures */
+                /*      pointed to within value->response_payload.         */
+                /*                                                         */
+                /*      Avoid hitting this case at all costs.              */
+                break;
+            };
+            
+            ctx->free_func(ctx->state, value->response_payload);
+            value->response_payload = NULL;
+        }
+        
+        value->operation = 0;
+        value->result_status = 0;
+        value->result_reason = 0;
+        value->payload_offset = 0;
+        value->payload_size = 0;
     }
+    
+    return;
 }
 
 void
-kmip_print_request_payload(int indent, enum operation type, void *value)
+kmip_free_nonce(KMIP *ctx, Nonce *value)
 {
-    switch(type)
-    {
-        case KMIP_OP_CREATE:
-        kmip_print_create_request_payload(indent, value);
-        break;
-        
-        case KMIP_OP_GET:
-        kmip_print_get_request_payload(indent, (GetRequestPayload *)value);
-        break;
-        
-        case KMIP_OP_DESTROY:
-        kmip_print_destroy_request_payload(indent, value);
-        break;
-        
-        default:
-        printf("%*sUnknown Payload @ %p\n", indent, "", value);
-        break;
-    };
+    kmip_free_schema(ctx, &kmip_nonce_schema, value);
+    
+    return;
 }
 
 void
-kmip_print_response_payload(int indent, enum operation type, void *value)
+kmip_free_username_password_credential(KMIP *ctx, UsernamePasswordCredential *value)
 {
-    switch(type)
-    {
-        case KMIP_OP_CREATE:
-        kmip_print_create_response_payload(indent, value);
-        break;
-        
-        case KMIP_OP_GET:
-        kmip_print_get_response_payload(indent, (GetResponsePayload *)value);
-        break;
-        
-        case KMIP_OP_DESTROY:
-        kmip_print_destroy_response_payload(indent, value);
-        break;
-        
-        default:
-        printf("%*sUnknown Payload @ %p\n", indent, "", value);
-        break;
-    };
+    kmip_free_schema(ctx, &kmip_username_password_credential_schema, value);
+    
+    return;
 }
 
 void
-kmip_print_username_password_credential(int indent, UsernamePasswordCredential *value)
+kmip_free_device_credential(KMIP *ctx, DeviceCredential *value)
 {
-    printf("%*sUsername/Password Credential @ %p\n", indent, "", (void *)value);
+    kmip_free_schema(ctx, &kmip_device_credential_schema, value);
     
-    if(value != NULL)
-    {
-        kmip_print_text_string(indent + 2, "Username", value->username);
-        kmip_print_text_string(indent + 2, "Password", value->password);
-    }
+    return;
 }
 
 void
-kmip_print_device_credential(int indent, DeviceCredential *value)
+kmip_free_attestation_credential(KMIP *ctx, AttestationCredential *value)
 {
-    printf("%*sDevice Credential @ %p\n", indent, "", (void *)value);
+    kmip_free_schema(ctx, &kmip_attestation_credential_schema, value);
+    
+    return;
+}
 
+void
+kmip_free_credential_value(KMIP *ctx, enum credential_type type, void **value)
+{
     if(value != NULL)
     {
-        kmip_print_text_string(indent + 2, "Device Serial Number", value->device_serial_number);
-        kmip_print_text_string(indent + 2, "Password", value->password);
-        kmip_print_text_string(indent + 2, "Device Identifier", value->device_identifier);
-        kmip_print_text_string(indent + 2, "Network Identifier", value->network_identifier);
-        kmip_print_text_string(indent + 2, "Machine Identifier", value->machine_identifier);
-        kmip_print_text_string(indent + 2, "Media Identifier", value->media_identifier);
+        if(*value != NULL)
+        {
+            switch(type)
+            {
+                case KMIP_CRED_USERNAME_AND_PASSWORD:
+                kmip_free_username_password_credential(ctx, (UsernamePasswordCredential *)*value);
+                break;
+                
+                case KMIP_CRED_DEVICE:
+                kmip_free_device_credential(ctx, (DeviceCredential *)*value);
+                break;
+                
+                case KMIP_CRED_ATTESTATION:
+                kmip_free_attestation_credential(ctx, (AttestationCredential *)*value);
+                break;
+                
+                default:
+                /* NOTE (ph) Hitting this case means that we don't know   */
+                /*      what the actual type, size, or value of value is. */
+                /*      We can still free it but we cannot securely zero  */
+                /*      the memory. We also do not know how to free any   */
+                /*      possible substructures pointed to within value.   */
+                /*                                                        */
+                /*      Avoid hitting this case at all costs.             */
+                break;
+            };
+        
+            ctx->free_func(ctx->state, *value);
+            *value = NULL;
+        }    
     }
+    
+    return;
 }
 
 void
-kmip_print_attestation_credential(int indent, AttestationCredential *value)
+kmip_free_credential(KMIP *ctx, Credential *value)
 {
-    printf("%*sAttestation Credential @ %p\n", indent, "", (void *)value);
-
     if(value != NULL)
     {
-        kmip_print_nonce(indent + 2, value->nonce);
-        printf("%*sAttestation Type: ", indent + 2, "");
-        kmip_print_attestation_type_enum(value->attestation_type);
-        printf("\n");
-        kmip_print_byte_string(indent + 2, "Attestation Measurement", value->attestation_measurement);
-        kmip_print_byte_string(indent + 2, "Attestation Assertion", value->attestation_assertion);
+        if(value->credential_value != NULL)
+        {
+            kmip_free_credential_value(ctx, value->credential_type, &value->credential_value);
+            value->credential_value = NULL;
+        }
+        
+        value->credential_type = 0;
     }
+    
+    return;
 }
 
 void
-kmip_print_credential_value(int indent, enum credential_type type, void *value)
+kmip_free_authentication(KMIP *ctx, Authentication *value)
 {
-    printf("%*sCredential Value @ %p\n", indent, "", value);
-    
     if(value != NULL)
     {
-        switch(type)
+        if(value->credential != NULL)
         {
-            case KMIP_CRED_USERNAME_AND_PASSWORD:
-            kmip_print_username_password_credential(indent + 2, value);
-            break;
-            
-            case KMIP_CRED_DEVICE:
-            kmip_print_device_credential(indent + 2, value);
-            break;
-            
-            case KMIP_CRED_ATTESTATION:
-            kmip_print_attestation_credential(indent + 2, value);
-            break;
-            
-            default:
-            printf("%*sUnknown Credential @ %p\n", indent + 2, "", value);
-            break;
-        };
+            kmip_free_credential(ctx, value->credential);
+            ctx->free_func(ctx->state, value->credential);
+            value->credential = NULL;
+        }
+        
+        /* The fragment belongs to the caller and may be shared. */
+        value->fragment = NULL;
     }
+    
+    return;
 }
 
 void
-kmip_print_credential(int indent, Credential *value)
+kmip_free_fragment(KMIP *ctx, KMIPFragment *value)
 {
-    printf("%*sCredential @ %p\n", indent, "", (void *)value);
-    
     if(value != NULL)
     {
-        printf("%*sCredential Type: ", indent + 2, "");
-        kmip_print_credential_type_enum(value->credential_type);
-        printf("\n");
+        if(value->encoding != NULL)
+        {
+            kmip_free_memory(ctx, value->encoding, value->size, value->sensitive);
+            value->encoding = NULL;
+        }
         
-        kmip_print_credential_value(
-            indent + 2,
-            value->credential_type,
-            value->credential_value);
+        value->size = 0;
+        value->sensitive = KMIP_FALSE;
     }
+    
+    return;
 }
 
 void
-kmip_print_authentication(int indent, Authentication *value)
+kmip_free_request_header(KMIP *ctx, RequestHeader *value)
 {
-    printf("%*sAuthentication @ %p\n", indent, "", (void *)value);
-    
     if(value != NULL)
     {
-        kmip_print_credential(indent + 2, value->credential);
+        if(value->protocol_version != NULL)
+        {
+            kmip_free_memory(ctx, value->protocol_version, sizeof(ProtocolVersion), KMIP_FALSE);
+            value->protocol_version = NULL;
+        }
+        
+        if(value->authentication != NULL)
+        {
+            kmip_free_authentication(ctx, value->authentication);
+            ctx->free_func(ctx->state, value->authentication);
+            value->authentication = NULL;
+        }
+        
+        if(value->attestation_types != NULL)
+        {
+            kmip_free_memory(ctx, value->attestation_types, value->attestation_type_count * sizeof(enum attestation_type), KMIP_FALSE);
+            value->attestation_types = NULL;
+            value->attestation_type_count = 0;
+        }
+        
+        if(value->client_correlation_value != NULL)
+        {
+            kmip_free_text_string(ctx, value->client_correlation_value);
+            ctx->free_func(ctx->state, value->client_correlation_value);
+            value->client_correlation_value = NULL;
+        }
+        
+        if(value->server_correlation_value != NULL)
+        {
+            kmip_free_text_string(ctx, value->server_correlation_value);
+            ctx->free_func(ctx->state, value->server_correlation_value);
+            value->server_correlation_value = NULL;
+        }
+        
+        kmip_init_request_header(value);
     }
+    
+    return;
 }
 
 void
-kmip_print_request_batch_item(int indent, RequestBatchItem *value)
+kmip_free_response_header(KMIP *ctx, ResponseHeader *value)
 {
-    printf("%*sRequest Batch Item @ %p\n", indent, "", (void *)value);
-    
     if(value != NULL)
     {
-        printf("%*sOperation: ", indent + 2, "");
-        kmip_print_operation_enum(value->operation);
-        printf("\n");
+        if(value->protocol_version != NULL)
+        {
+            kmip_free_memory(ctx, value->protocol_version, sizeof(ProtocolVersion), KMIP_FALSE);
+            value->protocol_version = NULL;
+        }
+        
+        if(value->nonce != NULL)
+        {
+            kmip_free_nonce(ctx, value->nonce);
+            ctx->free_func(ctx->state, value->nonce);
+            value->nonce = NULL;
+        }
 
-        printf("%*sEphemeral: ", indent + 2, "");
-        kmip_print_bool(value->ephemeral);
-        printf("\n");
+        if(value->server_hashed_password != NULL)
+        {
+            kmip_free_sensitive_byte_string(ctx, value->server_hashed_password);
+            ctx->free_func(ctx->state, value->server_hashed_password);
+            value->server_hashed_password = NULL;
+        }
 
-        kmip_print_byte_string(
-            indent + 2,
-            "Unique Batch Item ID",
-            value->unique_batch_item_id);
+        if(value->attestation_types != NULL)
+        {
+            kmip_free_memory(ctx, value->attestation_types, value->attestation_type_count * sizeof(enum attestation_type), KMIP_FALSE);
+            value->attestation_types = NULL;
+        }
+        
+        value->attestation_type_count = 0;
+        
+        if(value->client_correlation_value != NULL)
+        {
+            kmip_free_text_string(ctx, value->client_correlation_value);
+            ctx->free_func(ctx->state, value->client_correlation_value);
+            value->client_correlation_value = NULL;
+        }
+        
+        if(value->server_correlation_value != NULL)
+        {
+            kmip_free_text_string(ctx, value->server_correlation_value);
+            ctx->free_func(ctx->state, value->server_correlation_value);
+            value->server_correlation_value = NULL;
+        }
         
-        kmip_print_request_payload(
-            indent + 2,
-            value->operation,
-            value->request_payload);
+        kmip_init_response_header(value);
     }
+    
+    return;
 }
 
 void
-kmip_print_response_batch_item(int indent, ResponseBatchItem *value)
+kmip_free_request_message(KMIP *ctx, RequestMessage *value)
 {
-    printf("%*sResponse Batch Item @ %p\n", indent, "", (void *)value);
-    
     if(value != NULL)
     {
-        printf("%*sOperation: ", indent + 2, "");
-        kmip_print_operation_enum(value->operation);
-        printf("\n");
-        
-        kmip_print_byte_string(
-            indent + 2,
-            "Unique Batch Item ID",
-            value->unique_batch_item_id);
-        
-        printf("%*sResult Status: ", indent + 2, "");
-        kmip_print_result_status_enum(value->result_status);
-        printf("\n");
-        
-        printf("%*sResult Reason: ", indent + 2, "");
-        kmip_print_result_reason_enum(value->result_reason);
-        printf("\n");
+        if(value->request_header != NULL)
+        {
+            kmip_free_request_header(ctx, value->request_header);
+            ctx->free_func(ctx->state, value->request_header);
+            value->request_header = NULL;
+        }
         
-        kmip_print_text_string(indent + 2, "Result Message", value->result_message);
-        kmip_print_byte_string(
-            indent + 2,
-            "Asynchronous Correlation Value",
-            value->asynchronous_correlation_value);
+        if(value->batch_items != NULL)
+        {
+            for(size_t i = 0; i < value->batch_count; i++)
+            {
+                kmip_free_request_batch_item(ctx, &value->batch_items[i]);
+            }
+            ctx->free_func(ctx->state, value->batch_items);
+            value->batch_items = NULL;
+        }
         
-        kmip_print_response_payload(
-            indent + 2,
-            value->operation,
-            value->response_payload);
+        value->batch_count = 0;
     }
     
     return;
 }
 
 void
-kmip_print_request_header(int indent, RequestHeader *value)
+kmip_free_response_message(KMIP *ctx, ResponseMessage *value)
 {
-    printf("%*sRequest Header @ %p\n", indent, "", (void *)value);
-    
     if(value != NULL)
     {
-        kmip_print_protocol_version(indent + 2, value->protocol_version);
-        
-        printf("%*sMaximum Response Size: ", indent + 2, "");
-        kmip_print_integer(value->maximum_response_size);
-        printf("\n");
+        if(value->response_header != NULL)
+        {
+            kmip_free_response_header(ctx, value->response_header);
+            ctx->free_func(ctx->state, value->response_header);
+            value->response_header = NULL;
+        }
         
-        kmip_print_text_string(
-            indent + 2,
-            "Client Correlation Value",
-            value->client_correlation_value);
-        kmip_print_text_string(
-            indent + 2,
-            "Server Correlation Value",
-            value->server_correlation_value);
-        printf("%*sAsynchronous Indicator: ", indent + 2, "");
-        kmip_print_bool(value->asynchronous_indicator);
-        printf("\n");
-        printf("%*sAttestation Capable Indicator: ", indent + 2, "");
-        kmip_print_bool(value->attestation_capable_indicator);
-        printf("\n");
-        printf(
-            "%*sAttestation Types: %zu\n",
-            indent + 2,
-            "",
-            value->attestation_type_count);
-        for(size_t i = 0; i < value->attestation_type_count; i++)
+        if(value->batch_items != NULL)
         {
-            /* TODO (ph) Add enum value -> string functionality. */
-            printf("%*sAttestation Type: %s\n", indent + 4, "", "???");
+            for(size_t i = 0; i < value->batch_count; i++)
+            {
+                kmip_free_response_batch_item(ctx, &value->batch_items[i]);
+            }
+            ctx->free_func(ctx->state, value->batch_items);
+            value->batch_items = NULL;
         }
-        kmip_print_authentication(indent + 2, value->authentication);
-        printf("%*sBatch Error Continuation Option: ", indent + 2, "");
-        kmip_print_batch_error_continuation_option(
-            value->batch_error_continuation_option);
-        printf("\n");
-        printf("%*sBatch Order Option: ", indent + 2, "");
-        kmip_print_bool(value->batch_order_option);
-        printf("\n");
-        printf("%*sTime Stamp: %lu\n", indent + 2, "", value->time_stamp);
-        printf("%*sBatch Count: %d\n", indent + 2, "", value->batch_count);
+        
+        value->batch_count = 0;
     }
+    
+    return;
 }
 
 void
-kmip_print_response_header(int indent, ResponseHeader *value)
+kmip_reset_arena_after_request_message(KMIP *ctx, RequestMessage *value)
 {
-    printf("%*sResponse Header @ %p\n", indent, "", (void *)value);
+    if(ctx == NULL || value == NULL)
+    {
+        return;
+    }
     
-    if(value != NULL)
+    if(ctx->free_func != &kmip_arena_free)
     {
-        kmip_print_protocol_version(indent + 2, value->protocol_version);
-        printf("%*sTime Stamp: %lu\n", indent + 2, "", value->time_stamp);
-        kmip_print_nonce(indent + 2, value->nonce);
-
-        kmip_print_byte_string(indent + 2, "Server Hashed Password", value->server_hashed_password);
-
-        printf(
-            "%*sAttestation Types: %zu\n",
-            indent + 2,
-            "",
-            value->attestation_type_count);
-        for(size_t i = 0; i < value->attestation_type_count; i++)
-        {
-            /* TODO (ph) Add enum value -> string functionality. */
-            printf("%*sAttestation Type: %s\n", indent + 4, "", "???");
-        }
-        kmip_print_text_string(
-            indent + 2,
-            "Client Correlation Value",
-            value->client_correlation_value);
-        kmip_print_text_string(
-            indent + 2,
-            "Server Correlation Value",
-            value->server_correlation_value);
-        printf("%*sBatch Count: %d\n", indent + 2, "", value->batch_count);
+        kmip_free_request_message(ctx, value);
+        return;
     }
+    
+    /* NOTE (ph) Every node of the message lives in the arena, so the */
+    /*      tree is dropped without walking it and the arena is wiped */
+    /*      in one pass. That also drops anything else allocated in   */
+    /*      the arena since its last reset, not just this message.    */
+    /*      The reset also frees any key material the decoder put in  */
+    /*      the secure heap.                                          */
+    /*      Errors are cleared first since the error message may live */
+    /*      in the arena too.                                         */
+    kmip_clear_errors(ctx);
+    
+    value->request_header = NULL;
+    value->batch_items = NULL;
+    value->batch_count = 0;
+    
+    kmip_reset_arena((KMIPArena *)ctx->state);
 }
 
 void
-kmip_print_request_message(RequestMessage *value)
+kmip_reset_arena_after_response_message(KMIP *ctx, ResponseMessage *value)
 {
-    printf("Request Message @ %p\n", (void *)value);
+    if(ctx == NULL || value == NULL)
+    {
+        return;
+    }
     
-    if(value != NULL)
+    if(ctx->free_func != &kmip_arena_free)
     {
-        kmip_print_request_header(2, value->request_header);
-        printf("%*sBatch Items: %zu\n", 2, "", value->batch_count);
-        
-        for(size_t i = 0; i < value->batch_count; i++)
-        {
-            kmip_print_request_batch_item(4, &value->batch_items[i]);
-        }
+        kmip_free_response_message(ctx, value);
+        return;
     }
     
-    return;
+    kmip_clear_errors(ctx);
+    
+    value->response_header = NULL;
+    value->batch_items = NULL;
+    value->batch_count = 0;
+    
+    kmip_reset_arena((KMIPArena *)ctx->state);
 }
 
-void
-kmip_print_response_message(ResponseMessage *value)
+/*
+Copying Functions
+*/
+
+int32 *
+kmip_deep_copy_int32(KMIP *ctx, const int32 *value)
 {
-    printf("Response Message @ %p\n", (void *)value);
-    
-    if(value != NULL)
+    if(ctx == NULL || value == NULL)
+        return(NULL);
+
+    int32 *copy = ctx->calloc_func(ctx->state, 1, sizeof(int32));
+    if(copy == NULL)
+        return(NULL);
+
+    copy = ctx->memcpy_func(ctx->state, copy, value, sizeof(int32));
+
+    return(copy);
+}
+
+uint32 *
+kmip_deep_copy_uint32(KMIP *ctx, const uint32 *value)
+{
+    if(ctx == NULL || value == NULL)
+        return(NULL);
+
+    uint32 *copy = ctx->calloc_func(ctx->state, 1, sizeof(uint32));
+    if(copy == NULL)
+        return(NULL);
+
+    copy = ctx->memcpy_func(ctx->state, copy, value, sizeof(uint32));
+
+    return(copy);
+}
+
+uint64 *
+kmip_deep_copy_uint64(KMIP *ctx, const uint64 *value)
+{
+    if(ctx == NULL || value == NULL)
+        return(NULL);
+
+    uint64 *copy = ctx->calloc_func(ctx->state, 1, sizeof(uint64));
+    if(copy == NULL)
+        return(NULL);
+
+    copy = ctx->memcpy_func(ctx->state, copy, value, sizeof(uint64));
+
+    return(copy);
+}
+
+TextString *
+kmip_new_text_string(KMIP *ctx, size_t size)
+{
+    if(ctx == NULL)
+        return(NULL);
+
+    /* Small values share the TextString allocation; see kmip.h. */
+    size_t inline_size = (size <= KMIP_TEXT_STRING_INLINE_CAPACITY) ? size : 0;
+    TextString *string = ctx->calloc_func(ctx->state, 1, sizeof(TextString) + inline_size);
+    if(string == NULL)
+        return(NULL);
+
+    string->size = size;
+    if(inline_size > 0)
     {
-        kmip_print_response_header(2, value->response_header);
-        printf("  Batch Items: %zu\n", value->batch_count);
-        
-        for(size_t i = 0; i < value->batch_count; i++)
+        string->value = (char *)(string + 1);
+        string->inlined = KMIP_TRUE;
+    }
+    else if(size > 0)
+    {
+        string->value = ctx->calloc_func(ctx->state, 1, size);
+        if(string->value == NULL)
+        {
+            ctx->free_func(ctx->state, string);
+            return(NULL);
+        }
+    }
+
+    return(string);
+}
+
+TextString *
+kmip_deep_copy_text_string(KMIP *ctx, const TextString *value)
+{
+    if(ctx == NULL || value == NULL)
+        return(NULL);
+
+    TextString *copy = kmip_new_text_string(ctx, (value->value != NULL) ? value->size : 0);
+    if(copy == NULL)
+        return(NULL);
+
+    copy->size = value->size;
+    if(value->value != NULL && value->size > 0)
+        ctx->memcpy_func(ctx->state, copy->value, value->value, value->size);
+
+    return(copy);
+}
+
+Name *
+kmip_deep_copy_name(KMIP *ctx, const Name *value)
+{
+    if(ctx == NULL || value == NULL)
+        return(NULL);
+
+    Name *copy = ctx->calloc_func(ctx->state, 1, sizeof(Name));
+    if(copy == NULL)
+        return(NULL);
+
+    copy->type = value->type;
+    if(value->value != NULL)
+    {
+        copy->value = kmip_deep_copy_text_string(ctx, value->value);
+        if(copy->value == NULL)
         {
-            kmip_print_response_batch_item(4, &value->batch_items[i]);
+            ctx->free_func(ctx->state, copy);
+            return(NULL);
         }
     }
-    
-    return;
-}
+    else
+        copy->value = NULL;
 
-/*
-Freeing Functions
-*/
+    return(copy);
+}
 
-void
-kmip_free_buffer(KMIP *ctx, void *buffer, size_t size)
+ApplicationSpecificInformation *
+kmip_deep_copy_application_specific_information(KMIP *ctx, const ApplicationSpecificInformation *value)
 {
-    if(ctx == NULL)
+    if(ctx == NULL || value == NULL)
     {
-        return;
+        return(NULL);
     }
-    
-    ctx->memset_func(buffer, 0, size);
-    ctx->free_func(ctx->state, buffer);
-}
 
-void
-kmip_free_text_string(KMIP *ctx, TextString *value)
-{
-    if(ctx == NULL)
+    ApplicationSpecificInformation *copy = ctx->calloc_func(ctx->state, 1, sizeof(ApplicationSpecificInformation));
+    if(copy == NULL)
     {
-        return;
+        return(NULL);
     }
-    
-    if(value != NULL)
+
+    if(value->application_namespace != NULL)
     {
-        if(value->value != NULL)
+        copy->application_namespace = kmip_deep_copy_text_string(ctx, value->application_namespace);
+        if(copy->application_namespace == NULL)
         {
-            ctx->memset_func(value->value, 0, value->size);
-            ctx->free_func(ctx->state, value->value);
-            
-            value->value = NULL;
+            ctx->free_func(ctx->state, copy);
+            return(NULL);
         }
-        
-        value->size = 0;
     }
-    
-    return;
-}
+    else
+    {
+        copy->application_namespace = NULL;
+    }
 
-void
-kmip_free_byte_string(KMIP *ctx, ByteString *value)
-{
-    if(value != NULL)
+    if(value->application_data != NULL)
     {
-        if(value->value != NULL)
+        copy->application_data = kmip_deep_copy_text_string(ctx, value->application_data);
+        if(copy->application_data == NULL)
         {
-            ctx->memset_func(value->value, 0, value->size);
-            ctx->free_func(ctx->state, value->value);
-            
-            value->value = NULL;
+            kmip_free_application_specific_information(ctx, copy);
+            ctx->free_func(ctx->state, copy);
+            return(NULL);
         }
-        
-        value->size = 0;
     }
-    
-    return;
+    else
+    {
+        copy->application_data = NULL;
+    }
+
+    return(copy);
 }
 
-void
-kmip_free_name(KMIP *ctx, Name *value)
+Attribute *
+kmip_deep_copy_attribute(KMIP *ctx, const Attribute *value)
 {
-    if(value != NULL)
+    if(ctx == NULL || value == NULL)
+        return(NULL);
+
+    Attribute *copy = ctx->calloc_func(ctx->state, 1, sizeof(Attribute));
+    if(copy == NULL)
+        return(NULL);
+
+    copy->type = value->type;
+    copy->index = value->index;
+
+    if(value->value == NULL)
     {
-        if(value->value != NULL)
-        {
-            kmip_free_text_string(ctx, value->value);
-            ctx->free_func(ctx->state, value->value);
-            
-            value->value = NULL;
-        }
-        
-        value->type = 0;
+        copy->value = NULL;
+        return(copy);
     }
-    
-    return;
-}
 
-void
-kmip_free_protection_storage_masks(KMIP *ctx, ProtectionStorageMasks *value)
-{
-    if(value != NULL)
+    switch(value->type)
     {
-        if(value->masks != NULL)
+        case KMIP_ATTR_UNIQUE_IDENTIFIER:
+        case KMIP_ATTR_OPERATION_POLICY_NAME:
         {
-            LinkedListItem *curr = kmip_linked_list_pop(value->masks);
-            while(curr != NULL)
+            copy->value = kmip_deep_copy_text_string(ctx, (TextString *)value->value);
+            if(copy->value == NULL)
             {
-                ctx->free_func(ctx->state, curr->data);
-                curr->data = NULL;
-                ctx->free_func(ctx->state, curr);
-                curr = kmip_linked_list_pop(value->masks);
+                ctx->free_func(ctx->state, copy);
+                return(NULL);
             }
-            ctx->free_func(ctx->state, value->masks);
-            value->masks = NULL;
-        }
-    }
+        } break;
 
-    return;
-}
+        case KMIP_ATTR_NAME:
+        {
+            copy->value = kmip_deep_copy_name(ctx, (Name *)value->value);
+            if(copy->value == NULL)
+            {
+                ctx->free_func(ctx->state, copy);
+                return(NULL);
+            }
+        } break;
 
-void
-kmip_free_attribute(KMIP *ctx, Attribute *value)
-{
-    if(value != NULL)
-    {
-        if(value->value != NULL)
+        case KMIP_ATTR_OBJECT_TYPE:
+        case KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM:
+        case KMIP_ATTR_CRYPTOGRAPHIC_LENGTH:
+        case KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK:
+        case KMIP_ATTR_STATE:
         {
-            switch(value->type)
+            copy->value = kmip_deep_copy_int32(ctx, (int32 *)value->value);
+            if(copy->value == NULL)
             {
-                case KMIP_ATTR_APPLICATION_SPECIFIC_INFORMATION:
-                {
-                    kmip_free_application_specific_information(ctx, value->value);
-                }
-                break;
+                ctx->free_func(ctx->state, copy);
+                return(NULL);
+            }
+        } break;
 
-                case KMIP_ATTR_UNIQUE_IDENTIFIER:
-                kmip_free_text_string(ctx, value->value);
-                break;
-                
-                case KMIP_ATTR_NAME:
-                kmip_free_name(ctx, value->value);
-                break;
-                
-                case KMIP_ATTR_OBJECT_TYPE:
-                *(int32*)value->value = 0;
-                break;
-                
-                case KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM:
-                *(int32*)value->value = 0;
-                break;
-                
-                case KMIP_ATTR_CRYPTOGRAPHIC_LENGTH:
-                *(int32*)value->value = KMIP_UNSET;
+        default:
+        {
+            switch(kmip_get_attribute_value_type(value->type))
+            {
+                case KMIP_TYPE_TEXT_STRING:
+                copy->value = kmip_deep_copy_text_string(ctx, (TextString *)value->value);
                 break;
-                
-                case KMIP_ATTR_OPERATION_POLICY_NAME:
-                kmip_free_text_string(ctx, value->value);
+
+                case KMIP_TYPE_INTEGER:
+                case KMIP_TYPE_ENUMERATION:
+                case KMIP_TYPE_BOOLEAN:
+                copy->value = kmip_deep_copy_int32(ctx, (int32 *)value->value);
                 break;
-                
-                case KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK:
-                *(int32*)value->value = KMIP_UNSET;
+
+                case KMIP_TYPE_INTERVAL:
+                copy->value = kmip_deep_copy_uint32(ctx, (uint32 *)value->value);
                 break;
-                
-                case KMIP_ATTR_STATE:
-                *(int32*)value->value = 0;
+
+                case KMIP_TYPE_DATE_TIME:
+                copy->value = kmip_deep_copy_uint64(ctx, (uint64 *)value->value);
                 break;
-                
+
                 default:
-                /* NOTE (ph) Hitting this case means that we don't know what the */
-                /*      actual type, size, or value of value->value is. We can   */
-                /*      still free it but we cannot securely zero the memory. We */
-                /*      also do not know how to free any possible substructures  */
-                /*      pointed to within value->value.                          */
-                /*                                                               */
-                /*      Avoid hitting this case at all costs.                    */
+                copy->value = NULL;
                 break;
             };
-            
-            ctx->free_func(ctx->state, value->value);
-            value->value = NULL;
-        }
-        
-        value->type = 0;
-        value->index = KMIP_UNSET;
-    }
-    
-    return;
-}
 
-void
-kmip_free_attributes(KMIP *ctx, Attributes *value)
-{
-    if(value != NULL)
-    {
-        if(value->attribute_list != NULL)
-        {
-            LinkedListItem *curr = kmip_linked_list_pop(value->attribute_list);
-            while(curr != NULL)
+            if(copy->value == NULL)
             {
-                Attribute *attribute = (Attribute *)curr->data;
-                kmip_free_attribute(ctx, attribute);
-                ctx->free_func(ctx->state, attribute);
-                ctx->free_func(ctx->state, curr);
-                curr = kmip_linked_list_pop(value->attribute_list);
+                ctx->free_func(ctx->state, copy);
+                return(NULL);
             }
-            ctx->free_func(ctx->state, value->attribute_list);
-
-            value->attribute_list = NULL;
-        }
-    }
+        } break;
+    };
 
-    return;
+    return(copy);
 }
 
-void
-kmip_free_template_attribute(KMIP *ctx, TemplateAttribute *value)
+/*
+Flat Cloning Functions
+*/
+
+/* NOTE (ph) Every kmip_flat_copy_* function makes the same allocations */
+/*      in the same order on both walks, so the fill walk lands exactly */
+/*      on the layout the size walk measured. While sizing, allocations */
+/*      return NULL and nothing is written.                             */
+/*                                                                      */
+/*      Strings in a clone are marked inlined and their bytes follow    */
+/*      their headers. Nothing in a clone may be freed on its own; the  */
+/*      whole block goes through kmip_free_flat_clone.                  */
+
+void *
+kmip_flat_alloc(KMIPFlatBuffer *flat, size_t size)
 {
-    if(value != NULL)
+    size_t offset = KMIP_ARENA_ALIGN(flat->used);
+    flat->used = offset + size;
+    
+    if(flat->base == NULL)
     {
-        if(value->names != NULL)
-        {
-            for(size_t i = 0; i < value->name_count; i++)
-            {
-                kmip_free_name(ctx, &value->names[i]);
-            }
-            ctx->free_func(ctx->state, value->names);
-            
-            value->names = NULL;
-        }
-        
-        value->name_count = 0;
-        
-        if(value->attributes != NULL)
-        {
-            for(size_t i = 0; i < value->attribute_count; i++)
-            {
-                kmip_free_attribute(ctx, &value->attributes[i]);
-            }
-            ctx->free_func(ctx->state, value->attributes);
-            
-            value->attributes = NULL;
-        }
-        
-        value->attribute_count = 0;
+        return(NULL);
     }
     
-    return;
+    return(flat->base + offset);
 }
 
-void
-kmip_free_transparent_symmetric_key(KMIP *ctx, TransparentSymmetricKey *value)
+void *
+kmip_flat_copy_bytes(KMIPFlatBuffer *flat, const void *value, size_t size)
 {
-    if(value != NULL)
+    void *copy = kmip_flat_alloc(flat, size);
+    if(copy != NULL && size > 0)
     {
-        if(value->key != NULL)
-        {
-            kmip_free_byte_string(ctx, value->key);
-            
-            ctx->free_func(ctx->state, value->key);
-            value->key = NULL;
-        }
+        flat->ctx->memcpy_func(flat->ctx->state, copy, value, size);
     }
     
-    return;
+    return(copy);
 }
 
-void
-kmip_free_key_material(KMIP *ctx, enum key_format_type format, void **value)
+TextString *
+kmip_flat_copy_text_string(KMIPFlatBuffer *flat, const TextString *value)
 {
-    if(value != NULL)
+    if(value == NULL)
     {
-        if(*value != NULL)
-        {
-            switch(format)
-            {
-                case KMIP_KEYFORMAT_RAW:
-                case KMIP_KEYFORMAT_OPAQUE:
-                case KMIP_KEYFORMAT_PKCS1:
-                case KMIP_KEYFORMAT_PKCS8:
-                case KMIP_KEYFORMAT_X509:
-                case KMIP_KEYFORMAT_EC_PRIVATE_KEY:
-                kmip_free_byte_string(ctx, *value);
-                break;
-                
-                case KMIP_KEYFORMAT_TRANS_SYMMETRIC_KEY:
-                kmip_free_transparent_symmetric_key(ctx, *value);
-                break;
-                
-                default:
-                /* NOTE (ph) Hitting this case means that we don't know   */
-                /*      what the actual type, size, or value of value is. */
-                /*      We can still free it but we cannot securely zero  */
-                /*      the memory. We also do not know how to free any   */
-                /*      possible substructures pointed to within value.   */
-                /*                                                        */
-                /*      Avoid hitting this case at all costs.             */
-                break;
-            };
-            
-            ctx->free_func(ctx->state, *value);
-            *value = NULL;
-        }
+        return(NULL);
     }
     
-    return;
-}
-
-void
-kmip_free_key_value(KMIP *ctx, enum key_format_type format, KeyValue *value)
-{
-    if(value != NULL)
+    TextString *copy = kmip_flat_alloc(flat, sizeof(TextString));
+    char *chars = NULL;
+    if(value->value != NULL)
     {
-        if(value->key_material != NULL)
-        {
-            kmip_free_key_material(ctx, format, &value->key_material);
-            value->key_material = NULL;
-        }
-        
-        if(value->attributes != NULL)
-        {
-            for(size_t i = 0; i < value->attribute_count; i++)
-            {
-                kmip_free_attribute(ctx, &value->attributes[i]);
-            }
-            ctx->free_func(ctx->state, value->attributes);
-            
-            value->attributes = NULL;
-        }
-        
-        value->attribute_count = 0;
+        chars = kmip_flat_copy_bytes(flat, value->value, value->size);
     }
     
-    return;
-}
-
-void
-kmip_free_application_specific_information(KMIP *ctx, ApplicationSpecificInformation *value)
-{
-    if(value != NULL)
+    if(copy != NULL)
     {
-        if(value->application_namespace != NULL)
-        {
-            kmip_free_text_string(ctx, value->application_namespace);
-
-            ctx->free_func(ctx->state, value->application_namespace);
-            value->application_namespace = NULL;
-        }
-
-        if(value->application_data != NULL)
-        {
-            kmip_free_text_string(ctx, value->application_data);
-
-            ctx->free_func(ctx->state, value->application_data);
-            value->application_data = NULL;
-        }
+        copy->value = chars;
+        copy->size = value->size;
+        copy->borrowed = KMIP_FALSE;
+        copy->inlined = KMIP_TRUE;
     }
-
-    return;
+    
+    return(copy);
 }
 
-void
-kmip_free_cryptographic_parameters(KMIP *ctx, CryptographicParameters *value)
+ByteString *
+kmip_flat_copy_byte_string(KMIPFlatBuffer *flat, const ByteString *value)
 {
-    if(value != NULL)
+    if(value == NULL)
     {
-        if(value->p_source != NULL)
-        {
-            kmip_free_byte_string(ctx, value->p_source);
-            
-            ctx->free_func(ctx->state, value->p_source);
-            value->p_source = NULL;
-        }
-        
-        kmip_init_cryptographic_parameters(value);
+        return(NULL);
     }
     
-    return;
+    ByteString *copy = kmip_flat_alloc(flat, sizeof(ByteString));
+    uint8 *bytes = NULL;
+    if(value->value != NULL)
+    {
+        bytes = kmip_flat_copy_bytes(flat, value->value, value->size);
+    }
+    
+    if(copy != NULL)
+    {
+        copy->value = bytes;
+        copy->size = value->size;
+        copy->borrowed = KMIP_FALSE;
+    }
+    
+    return(copy);
 }
 
-void
-kmip_free_encryption_key_information(KMIP *ctx, EncryptionKeyInformation *value)
+void *
+kmip_flat_copy_schema(KMIPFlatBuffer *flat, const KMIPSchema *schema, const void *value)
 {
-    if(value != NULL)
+    if(value == NULL)
     {
-        if(value->unique_identifier != NULL)
+        return(NULL);
+    }
+    
+    /* Scalars come across with the struct; pointers are redone below. */
+    uint8 *copy = kmip_flat_copy_bytes(flat, value, schema->size);
+    
+    for(size_t i = 0; i < schema->field_count; i++)
+    {
+        const KMIPField *field = &schema->fields[i];
+        if(kmip_is_scalar_field(field))
         {
-            kmip_free_text_string(ctx, value->unique_identifier);
-            
-            ctx->free_func(ctx->state, value->unique_identifier);
-            value->unique_identifier = NULL;
+            continue;
         }
-        
-        if(value->cryptographic_parameters != NULL)
+    
+        const void *source = *(void * const *)((const uint8 *)value + field->offset);
+        void *child = NULL;
+    
+        switch(field->type)
         {
-            kmip_free_cryptographic_parameters(ctx, value->cryptographic_parameters);
-            
-            ctx->free_func(ctx->state, value->cryptographic_parameters);
-            value->cryptographic_parameters = NULL;
+            case KMIP_TYPE_TEXT_STRING:
+            child = kmip_flat_copy_text_string(flat, source);
+            break;
+    
+            case KMIP_TYPE_BYTE_STRING:
+            child = kmip_flat_copy_byte_string(flat, source);
+            break;
+    
+            default:
+            child = kmip_flat_copy_schema(flat, field->child, source);
+            break;
+        };
+    
+        if(copy != NULL)
+        {
+            *(void **)(copy + field->offset) = child;
         }
     }
     
-    return;
+    return(copy);
 }
 
-void
-kmip_free_mac_signature_key_information(KMIP *ctx, MACSignatureKeyInformation *value)
+ApplicationSpecificInformation *
+kmip_flat_copy_application_specific_information(KMIPFlatBuffer *flat, const ApplicationSpecificInformation *value)
 {
-    if(value != NULL)
+    if(value == NULL)
     {
-        if(value->unique_identifier != NULL)
-        {
-            kmip_free_text_string(ctx, value->unique_identifier);
-            
-            ctx->free_func(ctx->state, value->unique_identifier);
-            value->unique_identifier = NULL;
-        }
-        
-        if(value->cryptographic_parameters != NULL)
-        {
-            kmip_free_cryptographic_parameters(ctx, value->cryptographic_parameters);
-            
-            ctx->free_func(ctx->state, value->cryptographic_parameters);
-            value->cryptographic_parameters = NULL;
-        }
+        return(NULL);
     }
     
-    return;
+    ApplicationSpecificInformation *copy = kmip_flat_alloc(flat, sizeof(ApplicationSpecificInformation));
+    TextString *application_namespace = kmip_flat_copy_text_string(flat, value->application_namespace);
+    TextString *application_data = kmip_flat_copy_text_string(flat, value->application_data);
+    
+    if(copy != NULL)
+    {
+        copy->application_namespace = application_namespace;
+        copy->application_data = application_data;
+    }
+    
+    return(copy);
 }
 
 void
-kmip_free_key_wrapping_data(KMIP *ctx, KeyWrappingData *value)
+kmip_flat_copy_attribute(KMIPFlatBuffer *flat, Attribute *copy, const Attribute *value)
 {
-    if(value != NULL)
+    void *attribute_value = NULL;
+    
+    if(value->value != NULL)
     {
-        if(value->encryption_key_info != NULL)
-        {
-            kmip_free_encryption_key_information(ctx, value->encryption_key_info);
-            
-            ctx->free_func(ctx->state, value->encryption_key_info);
-            value->encryption_key_info = NULL;
-        }
-        
-        if(value->mac_signature_key_info != NULL)
-        {
-            kmip_free_mac_signature_key_information(ctx, value->mac_signature_key_info);
-            
-            ctx->free_func(ctx->state, value->mac_signature_key_info);
-            value->mac_signature_key_info = NULL;
-        }
-        
-        if(value->mac_signature != NULL)
+        switch(value->type)
         {
-            kmip_free_byte_string(ctx, value->mac_signature);
-            
-            ctx->free_func(ctx->state, value->mac_signature);
-            value->mac_signature = NULL;
-        }
-        
-        if(value->iv_counter_nonce != NULL)
-        {
-            kmip_free_byte_string(ctx, value->iv_counter_nonce);
-            
-            ctx->free_func(ctx->state, value->iv_counter_nonce);
-            value->iv_counter_nonce = NULL;
-        }
-        
-        value->wrapping_method = 0;
-        value->encoding_option = 0;
+            case KMIP_ATTR_NAME:
+            attribute_value = kmip_flat_copy_schema(flat, &kmip_name_schema, value->value);
+            break;
+    
+            case KMIP_ATTR_APPLICATION_SPECIFIC_INFORMATION:
+            attribute_value = kmip_flat_copy_application_specific_information(flat, value->value);
+            break;
+    
+            default:
+            switch(kmip_get_attribute_value_type(value->type))
+            {
+                case KMIP_TYPE_TEXT_STRING:
+                attribute_value = kmip_flat_copy_text_string(flat, value->value);
+                break;
+    
+                case KMIP_TYPE_INTEGER:
+                case KMIP_TYPE_ENUMERATION:
+                case KMIP_TYPE_BOOLEAN:
+                attribute_value = kmip_flat_copy_bytes(flat, value->value, sizeof(int32));
+                break;
+    
+                case KMIP_TYPE_INTERVAL:
+                attribute_value = kmip_flat_copy_bytes(flat, value->value, sizeof(uint32));
+                break;
+    
+                case KMIP_TYPE_DATE_TIME:
+                attribute_value = kmip_flat_copy_bytes(flat, value->value, sizeof(uint64));
+                break;
+    
+                default:
+                flat->result = KMIP_ERROR_ATTR_UNSUPPORTED;
+                break;
+            };
+            break;
+        };
     }
     
-    return;
+    if(copy != NULL)
+    {
+        copy->type = value->type;
+        copy->index = value->index;
+        copy->value = attribute_value;
+    }
 }
 
-void
-kmip_free_key_block(KMIP *ctx, KeyBlock *value)
+void *
+kmip_flat_copy_key_material(KMIPFlatBuffer *flat, enum key_format_type format, const void *value)
 {
-    if(value != NULL)
+    if(value == NULL)
     {
-        if(value->key_value != NULL)
-        {
-            if(value->key_value_type == KMIP_TYPE_BYTE_STRING)
-            {
-                kmip_free_byte_string(ctx, value->key_value);
-                ctx->free_func(ctx->state, value->key_value);
-            }
-            else
-            {
-                kmip_free_key_value(ctx, value->key_format_type, value->key_value);
-                ctx->free_func(ctx->state, value->key_value);
-            }
-            value->key_value = NULL;
-        }
-        
-        if(value->key_wrapping_data != NULL)
-        {
-            kmip_free_key_wrapping_data(ctx, value->key_wrapping_data);
-            ctx->free_func(ctx->state, value->key_wrapping_data);
-            value->key_wrapping_data = NULL;
-        }
-        
-        kmip_init_key_block(value);
+        return(NULL);
     }
     
-    return;
+    switch(format)
+    {
+        case KMIP_KEYFORMAT_RAW:
+        case KMIP_KEYFORMAT_OPAQUE:
+        case KMIP_KEYFORMAT_PKCS1:
+        case KMIP_KEYFORMAT_PKCS8:
+        case KMIP_KEYFORMAT_X509:
+        case KMIP_KEYFORMAT_EC_PRIVATE_KEY:
+        return(kmip_flat_copy_byte_string(flat, value));
+    
+        case KMIP_KEYFORMAT_TRANS_SYMMETRIC_KEY:
+        return(kmip_flat_copy_schema(flat, &kmip_transparent_symmetric_key_schema, value));
+    
+        default:
+        flat->result = KMIP_NOT_IMPLEMENTED;
+        return(NULL);
+    };
 }
 
-void
-kmip_free_symmetric_key(KMIP *ctx, SymmetricKey *value)
+KeyValue *
+kmip_flat_copy_key_value(KMIPFlatBuffer *flat, enum key_format_type format, const KeyValue *value)
 {
-    if(value != NULL)
+    if(value == NULL)
     {
-        if(value->key_block != NULL)
+        return(NULL);
+    }
+    
+    KeyValue *copy = kmip_flat_alloc(flat, sizeof(KeyValue));
+    void *key_material = kmip_flat_copy_key_material(flat, format, value->key_material);
+    
+    Attribute *attributes = NULL;
+    size_t attribute_count = 0;
+    if(value->attributes != NULL)
+    {
+        attribute_count = value->attribute_count;
+        attributes = kmip_flat_alloc(flat, attribute_count * sizeof(Attribute));
+        for(size_t i = 0; i < attribute_count; i++)
         {
-            kmip_free_key_block(ctx, value->key_block);
-            ctx->free_func(ctx->state, value->key_block);
-            value->key_block = NULL;
+            kmip_flat_copy_attribute(flat, (attributes != NULL) ? &attributes[i] : NULL, &value->attributes[i]);
         }
     }
     
-    return;
+    if(copy != NULL)
+    {
+        copy->key_material = key_material;
+        copy->attributes = attributes;
+        copy->attribute_count = attribute_count;
+    }
+    
+    return(copy);
 }
 
-void
-kmip_free_public_key(KMIP *ctx, PublicKey *value)
+KeyBlock *
+kmip_flat_copy_key_block(KMIPFlatBuffer *flat, const KeyBlock *value)
 {
-    if(value != NULL)
+    if(value == NULL)
     {
-        if(value->key_block != NULL)
-        {
-            kmip_free_key_block(ctx, value->key_block);
-            ctx->free_func(ctx->state, value->key_block);
-            value->key_block = NULL;
-        }
+        return(NULL);
     }
     
-    return;
+    KeyBlock *copy = kmip_flat_copy_bytes(flat, value, sizeof(KeyBlock));
+    
+    void *key_value = NULL;
+    if(value->key_value_type == KMIP_TYPE_BYTE_STRING)
+    {
+        key_value = kmip_flat_copy_byte_string(flat, value->key_value);
+    }
+    else
+    {
+        key_value = kmip_flat_copy_key_value(flat, value->key_format_type, value->key_value);
+    }
+    
+    KeyWrappingData *key_wrapping_data = kmip_flat_copy_schema(flat, &kmip_key_wrapping_data_schema, value->key_wrapping_data);
+    
+    if(copy != NULL)
+    {
+        copy->key_value = key_value;
+        copy->key_wrapping_data = key_wrapping_data;
+    }
+    
+    return(copy);
 }
 
-void
-kmip_free_private_key(KMIP *ctx, PrivateKey *value)
+SymmetricKey *
+kmip_flat_copy_symmetric_key(KMIPFlatBuffer *flat, const SymmetricKey *value)
 {
-    if(value != NULL)
+    if(value == NULL)
     {
-        if(value->key_block != NULL)
-        {
-            kmip_free_key_block(ctx, value->key_block);
-            ctx->free_func(ctx->state, value->key_block);
-            value->key_block = NULL;
-        }
+        return(NULL);
     }
     
-    return;
+    SymmetricKey *copy = kmip_flat_alloc(flat, sizeof(SymmetricKey));
+    KeyBlock *key_block = kmip_flat_copy_key_block(flat, value->key_block);
+    
+    if(copy != NULL)
+    {
+        copy->key_block = key_block;
+    }
+    
+    return(copy);
 }
 
-void
-kmip_free_key_wrapping_specification(KMIP *ctx, KeyWrappingSpecification *value)
+PublicKey *
+kmip_flat_copy_public_key(KMIPFlatBuffer *flat, const PublicKey *value)
 {
-    if(value != NULL)
+    if(value == NULL)
     {
-        if(value->encryption_key_info != NULL)
-        {
-            kmip_free_encryption_key_information(ctx, value->encryption_key_info);
-            ctx->free_func(ctx->state, value->encryption_key_info);
-            value->encryption_key_info = NULL;
-        }
-        
-        if(value->mac_signature_key_info != NULL)
-        {
-            kmip_free_mac_signature_key_information(ctx, value->mac_signature_key_info);
-            ctx->free_func(ctx->state, value->mac_signature_key_info);
-            value->mac_signature_key_info = NULL;
-        }
-        
-        if(value->attribute_names != NULL)
-        {
-            for(size_t i = 0; i < value->attribute_name_count; i++)
-            {
-                kmip_free_text_string(ctx, &value->attribute_names[i]);
-            }
-            ctx->free_func(ctx->state, value->attribute_names);
-            value->attribute_names = NULL;
-        }
-        value->attribute_name_count = 0;
-        
-        value->wrapping_method = 0;
-        value->encoding_option = 0;
+        return(NULL);
     }
     
-    return;
+    PublicKey *copy = kmip_flat_alloc(flat, sizeof(PublicKey));
+    KeyBlock *key_block = kmip_flat_copy_key_block(flat, value->key_block);
+    
+    if(copy != NULL)
+    {
+        copy->key_block = key_block;
+    }
+    
+    return(copy);
 }
 
-void
-kmip_free_create_request_payload(KMIP *ctx, CreateRequestPayload *value)
+PrivateKey *
+kmip_flat_copy_private_key(KMIPFlatBuffer *flat, const PrivateKey *value)
 {
-    if(value != NULL)
+    if(value == NULL)
     {
-        if(value->template_attribute != NULL)
-        {
-            kmip_free_template_attribute(ctx, value->template_attribute);
-            ctx->free_func(ctx->state, value->template_attribute);
-            value->template_attribute = NULL;
-        }
-
-        if(value->attributes != NULL)
-        {
-            kmip_free_attributes(ctx, value->attributes);
-            ctx->free_func(ctx->state, value->attributes);
-            value->attributes = NULL;
-        }
-
-        if(value->protection_storage_masks != NULL)
-        {
-            kmip_free_protection_storage_masks(ctx, value->protection_storage_masks);
-            ctx->free_func(ctx->state, value->protection_storage_masks);
-            value->protection_storage_masks = NULL;
-        }
-        
-        value->object_type = 0;
+        return(NULL);
     }
     
-    return;
+    PrivateKey *copy = kmip_flat_alloc(flat, sizeof(PrivateKey));
+    KeyBlock *key_block = kmip_flat_copy_key_block(flat, value->key_block);
+    
+    if(copy != NULL)
+    {
+        copy->key_block = key_block;
+    }
+    
+    return(copy);
 }
 
-void
-kmip_free_create_response_payload(KMIP *ctx, CreateResponsePayload *value)
+GetResponsePayload *
+kmip_flat_copy_get_response_payload(KMIPFlatBuffer *flat, const GetResponsePayload *value)
 {
-    if(value != NULL)
+    if(value == NULL)
     {
-        if(value->unique_identifier != NULL)
-        {
-            kmip_free_text_string(ctx, value->unique_identifier);
-            ctx->free_func(ctx->state, value->unique_identifier);
-            value->unique_identifier = NULL;
-        }
-        
-        if(value->template_attribute != NULL)
+        return(NULL);
+    }
+    
+    GetResponsePayload *copy = kmip_flat_alloc(flat, sizeof(GetResponsePayload));
+    TextString *unique_identifier = kmip_flat_copy_text_string(flat, value->unique_identifier);
+    
+    void *object = NULL;
+    if(value->object != NULL)
+    {
+        switch(value->object_type)
         {
-            kmip_free_template_attribute(ctx, value->template_attribute);
-            ctx->free_func(ctx->state, value->template_attribute);
-            value->template_attribute = NULL;
-        }
-        
-        value->object_type = 0;
+            case KMIP_OBJTYPE_SYMMETRIC_KEY:
+            object = kmip_flat_copy_symmetric_key(flat, value->object);
+            break;
+    
+            case KMIP_OBJTYPE_PUBLIC_KEY:
+            object = kmip_flat_copy_public_key(flat, value->object);
+            break;
+    
+            case KMIP_OBJTYPE_PRIVATE_KEY:
+            object = kmip_flat_copy_private_key(flat, value->object);
+            break;
+    
+            default:
+            flat->result = KMIP_OBJECT_MISMATCH;
+            break;
+        };
     }
     
-    return;
+    if(copy != NULL)
+    {
+        copy->object_type = value->object_type;
+        copy->unique_identifier = unique_identifier;
+        copy->object = object;
+    }
+    
+    return(copy);
 }
 
-void
-kmip_free_get_request_payload(KMIP *ctx, GetRequestPayload *value)
+int
+kmip_begin_flat_clone(KMIPFlatBuffer *flat)
 {
-    if(value != NULL)
+    if(flat->result != KMIP_OK)
     {
-        if(value->unique_identifier != NULL)
-        {
-            kmip_free_text_string(ctx, value->unique_identifier);
-            ctx->free_func(ctx->state, value->unique_identifier);
-            value->unique_identifier = NULL;
-        }
-        
-        if(value->key_wrapping_spec != NULL)
-        {
-            kmip_free_key_wrapping_specification(ctx, value->key_wrapping_spec);
-            ctx->free_func(ctx->state, value->key_wrapping_spec);
-            value->key_wrapping_spec = NULL;
-        }
-        
-        value->key_format_type = 0;
-        value->key_compression_type = 0;
-        value->key_wrap_type = 0;
+        return(flat->result);
     }
     
-    return;
+    /* Clones usually hold key material and outlive their message, so */
+    /* they live with the secrets but never in an installed arena.    */
+    size_t header_size = KMIP_ARENA_ALIGN(sizeof(KMIPFlatHeader));
+    size_t size = header_size + flat->used;
+    KMIPFlatHeader *header = kmip_calloc_detached(flat->ctx, 1, size, KMIP_TRUE);
+    if(header == NULL)
+    {
+        flat->result = KMIP_MEMORY_ALLOC_FAILED;
+        return(flat->result);
+    }
+    
+    header->size = size;
+    flat->base = (uint8 *)header + header_size;
+    flat->used = 0;
+    
+    return(KMIP_OK);
 }
 
-void
-kmip_free_get_response_payload(KMIP *ctx, GetResponsePayload *value)
+SymmetricKey *
+kmip_clone_flat_symmetric_key(KMIP *ctx, const SymmetricKey *value)
 {
-    if(value != NULL)
+    if(ctx == NULL || value == NULL)
     {
-        if(value->unique_identifier != NULL)
-        {
-            kmip_free_text_string(ctx, value->unique_identifier);
-            ctx->free_func(ctx->state, value->unique_identifier);
-            value->unique_identifier = NULL;
-        }
-        
-        if(value->object != NULL)
-        {
-            switch(value->object_type)
-            {
-                case KMIP_OBJTYPE_SYMMETRIC_KEY:
-                kmip_free_symmetric_key(ctx, (SymmetricKey *)value->object);
-                break;
-                
-                case KMIP_OBJTYPE_PUBLIC_KEY:
-                kmip_free_public_key(ctx, (PublicKey *)value->object);
-                break;
-                
-                case KMIP_OBJTYPE_PRIVATE_KEY:
-                kmip_free_private_key(ctx, (PrivateKey *)value->object);
-                break;
-                
-                default:
-                /* NOTE (ph) Hitting this case means that we don't know */
-                /*      what the actual type, size, or value of         */
-                /*      value->object is. We can still free it but we   */
-                /*      cannot securely zero the memory. We also do not */
-                /*      know how to free any possible substructures     */
-                /*      pointed to within value->object.                */
-                /*                                                      */
-                /*      Avoid hitting this case at all costs.           */
-                break;
-            };
-            
-            ctx->free_func(ctx->state, value->object);
-            value->object = NULL;
-        }
-        
-        value->object_type = 0;
+        return(NULL);
+    }
+    
+    KMIPFlatBuffer flat = {ctx, NULL, 0, KMIP_OK};
+    kmip_flat_copy_symmetric_key(&flat, value);
+    if(kmip_begin_flat_clone(&flat) != KMIP_OK)
+    {
+        return(NULL);
     }
     
-    return;
+    return(kmip_flat_copy_symmetric_key(&flat, value));
 }
 
-void
-kmip_free_destroy_request_payload(KMIP *ctx, DestroyRequestPayload *value)
+PublicKey *
+kmip_clone_flat_public_key(KMIP *ctx, const PublicKey *value)
 {
-    if(value != NULL)
+    if(ctx == NULL || value == NULL)
     {
-        if(value->unique_identifier != NULL)
-        {
-            kmip_free_text_string(ctx, value->unique_identifier);
-            ctx->free_func(ctx->state, value->unique_identifier);
-            value->unique_identifier = NULL;
-        }
+        return(NULL);
     }
     
-    return;
+    KMIPFlatBuffer flat = {ctx, NULL, 0, KMIP_OK};
+    kmip_flat_copy_public_key(&flat, value);
+    if(kmip_begin_flat_clone(&flat) != KMIP_OK)
+    {
+        return(NULL);
+    }
+    
+    return(kmip_flat_copy_public_key(&flat, value));
 }
 
-void
-kmip_free_destroy_response_payload(KMIP *ctx, DestroyResponsePayload *value)
+PrivateKey *
+kmip_clone_flat_private_key(KMIP *ctx, const PrivateKey *value)
 {
-    if(value != NULL)
+    if(ctx == NULL || value == NULL)
     {
-        if(value->unique_identifier != NULL)
-        {
-            kmip_free_text_string(ctx, value->unique_identifier);
-            ctx->free_func(ctx->state, value->unique_identifier);
-            value->unique_identifier = NULL;
-        }
+        return(NULL);
     }
     
-    return;
+    KMIPFlatBuffer flat = {ctx, NULL, 0, KMIP_OK};
+    kmip_flat_copy_private_key(&flat, value);
+    if(kmip_begin_flat_clone(&flat) != KMIP_OK)
+    {
+        return(NULL);
+    }
+    
+    return(kmip_flat_copy_private_key(&flat, value));
+}
+
+GetResponsePayload *
+kmip_clone_flat_get_response_payload(KMIP *ctx, const GetResponsePayload *value)
+{
+    if(ctx == NULL || value == NULL)
+    {
+        return(NULL);
+    }
+    
+    KMIPFlatBuffer flat = {ctx, NULL, 0, KMIP_OK};
+    kmip_flat_copy_get_response_payload(&flat, value);
+    if(kmip_begin_flat_clone(&flat) != KMIP_OK)
+    {
+        return(NULL);
+    }
+    
+    return(kmip_flat_copy_get_response_payload(&flat, value));
+}
+
+size_t
+kmip_get_flat_clone_size(const void *clone)
+{
+    if(clone == NULL)
+    {
+        return(0);
+    }
+    
+    const KMIPFlatHeader *header = (const KMIPFlatHeader *)((const uint8 *)clone - KMIP_ARENA_ALIGN(sizeof(KMIPFlatHeader)));
+    return(header->size);
 }
 
 void
-kmip_free_request_batch_item(KMIP *ctx, RequestBatchItem *value)
+kmip_free_flat_clone(KMIP *ctx, void *clone)
 {
-    if(value != NULL)
+    if(ctx == NULL || clone == NULL)
     {
-        if(value->unique_batch_item_id != NULL)
-        {
-            kmip_free_byte_string(ctx, value->unique_batch_item_id);
-            ctx->free_func(ctx->state, value->unique_batch_item_id);
-            value->unique_batch_item_id = NULL;
-        }
-        
-        if(value->request_payload != NULL)
-        {
-            switch(value->operation)
-            {
-                case KMIP_OP_CREATE:
-                kmip_free_create_request_payload(ctx, (CreateRequestPayload *)value->request_payload);
-                break;
-                
-                case KMIP_OP_GET:
-                kmip_free_get_request_payload(ctx, (GetRequestPayload *)value->request_payload);
-                break;
-                
-                case KMIP_OP_DESTROY:
-                kmip_free_destroy_request_payload(ctx, (DestroyRequestPayload *)value->request_payload);
-                break;
-                
-                default:
-                /* NOTE (ph) Hitting this case means that we don't know    */
-                /*      what the actual type, size, or value of            */
-                /*      value->request_payload is. We can still free it    */
-                /*      but we cannot securely zero the memory. We also    */
-                /*      do not know how to free any possible substructures */
-                /*      pointed to within value->request_payload.          */
-                /*                                                         */
-                /*      Avoid hitting this case at all costs.              */
-                break;
-            };
-            
-            ctx->free_func(ctx->state, value->request_payload);
-            value->request_payload = NULL;
-        }
-        
-        value->operation = 0;
-        value->ephemeral = 0;
+        return;
     }
     
+    uint8 *header = (uint8 *)clone - KMIP_ARENA_ALIGN(sizeof(KMIPFlatHeader));
+    kmip_free_secret(ctx, header, ((KMIPFlatHeader *)header)->size);
+    
     return;
 }
 
-void
-kmip_free_response_batch_item(KMIP *ctx, ResponseBatchItem *value)
+/*
+Comparison Functions
+*/
+
+int
+kmip_compare_text_string(const TextString *a, const TextString *b)
 {
-    if(value != NULL)
+    if(a != b)
     {
-        if(value->unique_batch_item_id != NULL)
-        {
-            kmip_free_byte_string(ctx, value->unique_batch_item_id);
-            ctx->free_func(ctx->state, value->unique_batch_item_id);
-            value->unique_batch_item_id = NULL;
-        }
-        
-        if(value->result_message != NULL)
+        if((a == NULL) || (b == NULL))
         {
-            kmip_free_text_string(ctx, value->result_message);
-            ctx->free_func(ctx->state, value->result_message);
-            value->result_message = NULL;
+            return(KMIP_FALSE);
         }
         
-        if(value->asynchronous_correlation_value != NULL)
+        if(a->size != b->size)
         {
-            kmip_free_byte_string(ctx, value->asynchronous_correlation_value);
-            ctx->free_func(ctx->state, value->asynchronous_correlation_value);
-            value->asynchronous_correlation_value = NULL;
+            return(KMIP_FALSE);
         }
         
-        if(value->response_payload != NULL)
+        if(a->value != b->value)
         {
-            switch(value->operation)
+            if((a->value == NULL) || (b->value == NULL))
             {
-                case KMIP_OP_CREATE:
-                kmip_free_create_response_payload(ctx, (CreateResponsePayload *)value->response_payload);
-                break;
-                
-                case KMIP_OP_GET:
-                kmip_free_get_response_payload(ctx, (GetResponsePayload *)value->response_payload);
-                break;
-                
-                case KMIP_OP_DESTROY:
-                kmip_free_destroy_response_payload(ctx, (DestroyResponsePayload *)value->response_payload);
-                break;
-                
-                default:
-                /* NOTE (ph) Hitting this case means that we don't know    */
-                /*      what the actual type, size, or value of            */
-                /*      value->response_payload is. We can still free it   */
-                /*      but we cannot securely zero the memory. We also    */
-                /*      do not know how to free any possible substructures */
-                /*      pointed to within value->response_payload.         */
-                /*                                                         */
-                /*      Avoid hitting this case at all costs.              */
-                break;
-            };
+                return(KMIP_FALSE);
+            }
             
-            ctx->free_func(ctx->state, value->response_payload);
-            value->response_payload = NULL;
+            if(memcmp(a->value, b->value, a->size) != 0)
+            {
+                return(KMIP_FALSE);
+            }
         }
-        
-        value->operation = 0;
-        value->result_status = 0;
-        value->result_reason = 0;
     }
     
-    return;
+    return(KMIP_TRUE);
 }
 
-void
-kmip_free_nonce(KMIP *ctx, Nonce *value)
+int
+kmip_compare_byte_string(const ByteString *a, const ByteString *b)
 {
-    if(value != NULL)
+    if(a != b)
     {
-        if(value->nonce_id != NULL)
+        if((a == NULL) || (b == NULL))
+        {
+            return(KMIP_FALSE);
+        }
+        
+        if(a->size != b->size)
         {
-            kmip_free_byte_string(ctx, value->nonce_id);
-            ctx->free_func(ctx->state, value->nonce_id);
-            value->nonce_id = NULL;
+            return(KMIP_FALSE);
         }
         
-        if(value->nonce_value != NULL)
+        if(a->value != b->value)
         {
-            kmip_free_byte_string(ctx, value->nonce_value);
-            ctx->free_func(ctx->state, value->nonce_value);
-            value->nonce_value = NULL;
+            if((a->value == NULL) || (b->value == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+            
+            for(size_t i = 0; i < a->size; i++)
+            {
+                if(a->value[i] != b->value[i])
+                {
+                    return(KMIP_FALSE);
+                }
+            }
         }
     }
     
-    return;
+    return(KMIP_TRUE);
 }
 
-void
-kmip_free_username_password_credential(KMIP *ctx, UsernamePasswordCredential *value)
+int
+kmip_compare_fragment(const KMIPFragment *a, const KMIPFragment *b)
 {
-    if(value != NULL)
+    if(a != b)
     {
-        if(value->username != NULL)
+        if((a == NULL) || (b == NULL))
         {
-            kmip_free_text_string(ctx, value->username);
-            ctx->free_func(ctx->state, value->username);
-            value->username = NULL;
+            return(KMIP_FALSE);
         }
-        
-        if(value->password != NULL)
+    
+        if(a->tag != b->tag)
         {
-            kmip_free_text_string(ctx, value->password);
-            ctx->free_func(ctx->state, value->password);
-            value->password = NULL;
+            return(KMIP_FALSE);
         }
-    }
     
-    return;
-}
-
-void
-kmip_free_device_credential(KMIP *ctx, DeviceCredential *value)
-{
-    if(value != NULL)
-    {
-        if(value->device_serial_number != NULL)
+        if(a->version != b->version)
         {
-            kmip_free_text_string(ctx, value->device_serial_number);
-            ctx->free_func(ctx->state, value->device_serial_number);
-            value->device_serial_number = NULL;
+            return(KMIP_FALSE);
         }
-        
-        if(value->password != NULL)
+    
+        if(a->size != b->size)
         {
-            kmip_free_text_string(ctx, value->password);
-            ctx->free_func(ctx->state, value->password);
-            value->password = NULL;
+            return(KMIP_FALSE);
         }
-        
-        if(value->device_identifier != NULL)
+    
+        if(a->encoding != b->encoding)
         {
-            kmip_free_text_string(ctx, value->device_identifier);
-            ctx->free_func(ctx->state, value->device_identifier);
-            value->device_identifier = NULL;
+            if((a->encoding == NULL) || (b->encoding == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+    
+            if(memcmp(a->encoding, b->encoding, a->size) != 0)
+            {
+                return(KMIP_FALSE);
+            }
         }
-        
-        if(value->network_identifier != NULL)
+    }
+    
+    return(KMIP_TRUE);
+}
+
+int
+kmip_compare_name(const Name *a, const Name *b)
+{
+    return(kmip_compare_schema(&kmip_name_schema, a, b));
+}
+
+int
+kmip_compare_protection_storage_masks(const ProtectionStorageMasks *a, const ProtectionStorageMasks *b)
+{
+    if(a != b)
+    {
+        if((a == NULL) || (b == NULL))
         {
-            kmip_free_text_string(ctx, value->network_identifier);
-            ctx->free_func(ctx->state, value->network_identifier);
-            value->network_identifier = NULL;
+            return(KMIP_FALSE);
         }
-        
-        if(value->machine_identifier != NULL)
+
+        if((a->masks.size != b->masks.size))
         {
-            kmip_free_text_string(ctx, value->machine_identifier);
-            ctx->free_func(ctx->state, value->machine_identifier);
-            value->machine_identifier = NULL;
+            return(KMIP_FALSE);
         }
-        
-        if(value->media_identifier != NULL)
+
+        for(size_t i = 0; i < a->masks.size; i++)
         {
-            kmip_free_text_string(ctx, value->media_identifier);
-            ctx->free_func(ctx->state, value->media_identifier);
-            value->media_identifier = NULL;
+            int32 *a_data = (int32 *)kmip_vector_get(&a->masks, i);
+            int32 *b_data = (int32 *)kmip_vector_get(&b->masks, i);
+            if(a_data != b_data)
+            {
+                if((a_data == NULL) || (b_data == NULL) || (*a_data != *b_data))
+                {
+                    return(KMIP_FALSE);
+                }
+            }
         }
     }
-    
-    return;
+
+    return(KMIP_TRUE);
 }
 
-void
-kmip_free_attestation_credential(KMIP *ctx, AttestationCredential *value)
+int
+kmip_compare_attribute(const Attribute *a, const Attribute *b)
 {
-    if(value != NULL)
+    if(a != b)
     {
-        if(value->nonce != NULL)
+        if((a == NULL) || (b == NULL))
         {
-            kmip_free_nonce(ctx, value->nonce);
-            ctx->free_func(ctx->state, value->nonce);
-            value->nonce = NULL;
+            return(KMIP_FALSE);
         }
         
-        if(value->attestation_measurement != NULL)
+        if(a->type != b->type)
         {
-            kmip_free_byte_string(ctx, value->attestation_measurement);
-            ctx->free_func(ctx->state, value->attestation_measurement);
-            value->attestation_measurement = NULL;
+            return(KMIP_FALSE);
         }
         
-        if(value->attestation_assertion != NULL)
+        if(a->index != b->index)
         {
-            kmip_free_byte_string(ctx, value->attestation_assertion);
-            ctx->free_func(ctx->state, value->attestation_assertion);
-            value->attestation_assertion = NULL;
+            return(KMIP_FALSE);
         }
         
-        value->attestation_type = 0;
-    }
-    
-    return;
-}
-
-void
-kmip_free_credential_value(KMIP *ctx, enum credential_type type, void **value)
-{
-    if(value != NULL)
-    {
-        if(*value != NULL)
+        if(a->value != b->value)
         {
-            switch(type)
+            if((a->value == NULL) || (b->value == NULL))
             {
-                case KMIP_CRED_USERNAME_AND_PASSWORD:
-                kmip_free_username_password_credential(ctx, (UsernamePasswordCredential *)*value);
+                return(KMIP_FALSE);
+            }
+            
+            switch(a->type)
+            {
+                case KMIP_ATTR_APPLICATION_SPECIFIC_INFORMATION:
+                {
+                    return(
+                        kmip_compare_application_specific_information(
+                            (ApplicationSpecificInformation*)a->value,
+                            (ApplicationSpecificInformation*)b->value
+                        )
+                    );
+                }
+                break;
+
+                case KMIP_ATTR_UNIQUE_IDENTIFIER:
+                return(kmip_compare_text_string((TextString *)a->value, (TextString *)b->value));
                 break;
                 
-                case KMIP_CRED_DEVICE:
-                kmip_free_device_credential(ctx, (DeviceCredential *)*value);
+                case KMIP_ATTR_NAME:
+                return(kmip_compare_name((Name *)a->value, (Name *)b->value));
                 break;
                 
-                case KMIP_CRED_ATTESTATION:
-                kmip_free_attestation_credential(ctx, (AttestationCredential *)*value);
+                case KMIP_ATTR_OBJECT_TYPE:
+                if(*(int32*)a->value != *(int32*)b->value)
+                {
+                    return(KMIP_FALSE);
+                }
+                break;
+                
+                case KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM:
+                if(*(int32*)a->value != *(int32*)b->value)
+                {
+                    return(KMIP_FALSE);
+                }
+                break;
+                
+                case KMIP_ATTR_CRYPTOGRAPHIC_LENGTH:
+                if(*(int32*)a->value != *(int32*)b->value)
+                {
+                    return(KMIP_FALSE);
+                }
+                break;
+                
+                case KMIP_ATTR_OPERATION_POLICY_NAME:
+                return(kmip_compare_text_string((TextString *)a->value, (TextString *)b->value));
+                break;
+                
+                case KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK:
+                if(*(int32*)a->value != *(int32*)b->value)
+                {
+                    return(KMIP_FALSE);
+                }
+                break;
+                
+                case KMIP_ATTR_STATE:
+                if(*(int32*)a->value != *(int32*)b->value)
+                {
+                    return(KMIP_FALSE);
+                }
                 break;
                 
                 default:
-                /* NOTE (ph) Hitting this case means that we don't know   */
-                /*      what the actual type, size, or value of value is. */
-                /*      We can still free it but we cannot securely zero  */
-                /*      the memory. We also do not know how to free any   */
-                /*      possible substructures pointed to within value.   */
-                /*                                                        */
-                /*      Avoid hitting this case at all costs.             */
+                switch(kmip_get_attribute_value_type(a->type))
+                {
+                    case KMIP_TYPE_TEXT_STRING:
+                    return(kmip_compare_text_string((TextString *)a->value, (TextString *)b->value));
+                    break;
+                    
+                    case KMIP_TYPE_INTEGER:
+                    case KMIP_TYPE_ENUMERATION:
+                    case KMIP_TYPE_BOOLEAN:
+                    if(*(int32*)a->value != *(int32*)b->value)
+                    {
+                        return(KMIP_FALSE);
+                    }
+                    break;
+                    
+                    case KMIP_TYPE_INTERVAL:
+                    if(*(uint32*)a->value != *(uint32*)b->value)
+                    {
+                        return(KMIP_FALSE);
+                    }
+                    break;
+                    
+                    case KMIP_TYPE_DATE_TIME:
+                    if(*(uint64*)a->value != *(uint64*)b->value)
+                    {
+                        return(KMIP_FALSE);
+                    }
+                    break;
+                    
+                    default:
+                    /* NOTE (ph) Unsupported types can't be compared. */
+                    return(KMIP_FALSE);
+                    break;
+                };
                 break;
             };
-        
-            ctx->free_func(ctx->state, *value);
-            *value = NULL;
-        }    
+        }
     }
     
-    return;
+    return(KMIP_TRUE);
 }
 
-void
-kmip_free_credential(KMIP *ctx, Credential *value)
+int
+kmip_compare_attributes(const Attributes *a, const Attributes *b)
 {
-    if(value != NULL)
+    if(a != b)
     {
-        if(value->credential_value != NULL)
+        if((a == NULL) || (b == NULL))
         {
-            kmip_free_credential_value(ctx, value->credential_type, &value->credential_value);
-            value->credential_value = NULL;
+            return(KMIP_FALSE);
         }
-        
-        value->credential_type = 0;
-    }
-    
-    return;
-}
 
-void
-kmip_free_authentication(KMIP *ctx, Authentication *value)
-{
-    if(value != NULL)
-    {
-        if(value->credential != NULL)
+        if((a->attribute_list.size != b->attribute_list.size))
         {
-            kmip_free_credential(ctx, value->credential);
-            ctx->free_func(ctx->state, value->credential);
-            value->credential = NULL;
+            return(KMIP_FALSE);
+        }
+
+        void *const *a_item = kmip_vector_begin(&a->attribute_list);
+        void *const *b_item = kmip_vector_begin(&b->attribute_list);
+        for(size_t i = 0; i < a->attribute_list.size; i++)
+        {
+            Attribute *a_data = (Attribute *)a_item[i];
+            Attribute *b_data = (Attribute *)b_item[i];
+            if(kmip_compare_attribute(a_data, b_data) == KMIP_FALSE)
+            {
+                return(KMIP_FALSE);
+            }
         }
     }
-    
-    return;
+
+    return(KMIP_TRUE);
 }
 
-void
-kmip_free_request_header(KMIP *ctx, RequestHeader *value)
+int
+kmip_compare_template_attribute(const TemplateAttribute *a, const TemplateAttribute *b)
 {
-    if(value != NULL)
+    if(a != b)
     {
-        if(value->protocol_version != NULL)
+        if((a == NULL) || (b == NULL))
         {
-            ctx->memset_func(
-                value->protocol_version,
-                0,
-                sizeof(ProtocolVersion));
-            ctx->free_func(ctx->state, value->protocol_version);
-            value->protocol_version = NULL;
+            return(KMIP_FALSE);
         }
         
-        if(value->authentication != NULL)
+        /* A pre-encoded template only equals the same encoding. */
+        if(kmip_compare_fragment(a->fragment, b->fragment) == KMIP_FALSE)
         {
-            kmip_free_authentication(ctx, value->authentication);
-            ctx->free_func(ctx->state, value->authentication);
-            value->authentication = NULL;
+            return(KMIP_FALSE);
         }
         
-        if(value->attestation_types != NULL)
+        if(a->name_count != b->name_count)
         {
-            ctx->memset_func(
-                value->attestation_types,
-                0,
-                value->attestation_type_count * sizeof(enum attestation_type));
-            ctx->free_func(ctx->state, value->attestation_types);
-            value->attestation_types = NULL;
-            value->attestation_type_count = 0;
+            return(KMIP_FALSE);
         }
         
-        if(value->client_correlation_value != NULL)
+        if(a->attribute_count != b->attribute_count)
         {
-            kmip_free_text_string(ctx, value->client_correlation_value);
-            ctx->free_func(ctx->state, value->client_correlation_value);
-            value->client_correlation_value = NULL;
+            return(KMIP_FALSE);
         }
         
-        if(value->server_correlation_value != NULL)
+        if(a->names != b->names)
         {
-            kmip_free_text_string(ctx, value->server_correlation_value);
-            ctx->free_func(ctx->state, value->server_correlation_value);
-            value->server_correlation_value = NULL;
+            if((a->names == NULL) || (b->names == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+            
+            for(size_t i = 0; i < a->name_count; i++)
+            {
+                if(kmip_compare_name(&a->names[i], &b->names[i]) == KMIP_FALSE)
+                {
+                    return(KMIP_FALSE);
+                }
+            }
         }
         
-        kmip_init_request_header(value);
+        if(a->attributes != b->attributes)
+        {
+            if((a->attributes == NULL) || (b->attributes == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+            
+            for(size_t i = 0; i < a->attribute_count; i++)
+            {
+                if(kmip_compare_attribute(&a->attributes[i], &b->attributes[i]) == KMIP_FALSE)
+                {
+                    return(KMIP_FALSE);
+                }
+            }
+        }
     }
     
-    return;
+    return(KMIP_TRUE);
 }
 
-void
-kmip_free_response_header(KMIP *ctx, ResponseHeader *value)
+int
+kmip_compare_protocol_version(const ProtocolVersion *a, const ProtocolVersion *b)
 {
-    if(value != NULL)
+    if(a != b)
     {
-        if(value->protocol_version != NULL)
-        {
-            ctx->memset_func(
-                value->protocol_version,
-                0,
-                sizeof(ProtocolVersion));
-            ctx->free_func(ctx->state, value->protocol_version);
-            value->protocol_version = NULL;
-        }
-        
-        if(value->nonce != NULL)
-        {
-            kmip_free_nonce(ctx, value->nonce);
-            ctx->free_func(ctx->state, value->nonce);
-            value->nonce = NULL;
-        }
-
-        if(value->server_hashed_password != NULL)
-        {
-            kmip_free_byte_string(ctx, value->server_hashed_password);
-            ctx->free_func(ctx->state, value->server_hashed_password);
-            value->server_hashed_password = NULL;
-        }
-
-        if(value->attestation_types != NULL)
-        {
-            ctx->memset_func(
-                value->attestation_types,
-                0,
-                value->attestation_type_count * sizeof(enum attestation_type));
-            ctx->free_func(ctx->state, value->attestation_types);
-            value->attestation_types = NULL;
-        }
-        
-        value->attestation_type_count = 0;
-        
-        if(value->client_correlation_value != NULL)
+        if((a == NULL) || (b == NULL))
         {
-            kmip_free_text_string(ctx, value->client_correlation_value);
-            ctx->free_func(ctx->state, value->client_correlation_value);
-            value->client_correlation_value = NULL;
+            return(KMIP_FALSE);
         }
         
-        if(value->server_correlation_value != NULL)
+        if(a->major != b->major)
         {
-            kmip_free_text_string(ctx, value->server_correlation_value);
-            ctx->free_func(ctx->state, value->server_correlation_value);
-            value->server_correlation_value = NULL;
+            return(KMIP_FALSE);
         }
         
-        kmip_init_response_header(value);
+        if(a->minor != b->minor)
+        {
+            return(KMIP_FALSE);
+        }
     }
     
-    return;
+    return(KMIP_TRUE);
 }
 
-void
-kmip_free_request_message(KMIP *ctx, RequestMessage *value)
+int
+kmip_compare_transparent_symmetric_key(const TransparentSymmetricKey *a, const TransparentSymmetricKey *b)
 {
-    if(value != NULL)
+    return(kmip_compare_schema(&kmip_transparent_symmetric_key_schema, a, b));
+}
+
+int
+kmip_compare_key_material(enum key_format_type format, void **a, void **b)
+{
+    if(a != b)
     {
-        if(value->request_header != NULL)
+        if((a == NULL) || (b == NULL))
         {
-            kmip_free_request_header(ctx, value->request_header);
-            ctx->free_func(ctx->state, value->request_header);
-            value->request_header = NULL;
+            return(KMIP_FALSE);
         }
         
-        if(value->batch_items != NULL)
+        if(*a != *b)
         {
-            for(size_t i = 0; i < value->batch_count; i++)
+            if((*a == NULL) || (*b == NULL))
             {
-                kmip_free_request_batch_item(ctx, &value->batch_items[i]);
+                return(KMIP_FALSE);
             }
-            ctx->free_func(ctx, value->batch_items);
-            value->batch_items = NULL;
+            
+            switch(format)
+            {
+                case KMIP_KEYFORMAT_RAW:
+                case KMIP_KEYFORMAT_OPAQUE:
+                case KMIP_KEYFORMAT_PKCS1:
+                case KMIP_KEYFORMAT_PKCS8:
+                case KMIP_KEYFORMAT_X509:
+                case KMIP_KEYFORMAT_EC_PRIVATE_KEY:
+                if(kmip_compare_byte_string(*a, *b) == KMIP_FALSE)
+                {
+                    return(KMIP_FALSE);
+                }
+                break;
+                
+                case KMIP_KEYFORMAT_TRANS_SYMMETRIC_KEY:
+                if(kmip_compare_transparent_symmetric_key(*a, *b) == KMIP_FALSE)
+                {
+                    return(KMIP_FALSE);
+                }
+                break;
+                
+                default:
+                /* NOTE (ph) Unsupported types cannot be compared. */
+                return(KMIP_FALSE);
+                break;
+            };
         }
-        
-        value->batch_count = 0;
     }
     
-    return;
+    return(KMIP_TRUE);
 }
 
-void
-kmip_free_response_message(KMIP *ctx, ResponseMessage *value)
+int
+kmip_compare_key_value(enum key_format_type format, const KeyValue *a, const KeyValue *b)
 {
-    if(value != NULL)
+    if(a != b)
     {
-        if(value->response_header != NULL)
+        if((a == NULL) || (b == NULL))
         {
-            kmip_free_response_header(ctx, value->response_header);
-            ctx->free_func(ctx->state, value->response_header);
-            value->response_header = NULL;
+            return(KMIP_FALSE);
         }
         
-        if(value->batch_items != NULL)
+        if(a->key_material != b->key_material)
         {
-            for(size_t i = 0; i < value->batch_count; i++)
+            if((a->key_material == NULL) || (b->key_material == NULL))
             {
-                kmip_free_response_batch_item(ctx, &value->batch_items[i]);
+                return(KMIP_FALSE);
+            }
+            
+            if(kmip_compare_key_material(format, (void**)&a->key_material, (void**)&b->key_material) == KMIP_FALSE)
+            {
+                return(KMIP_FALSE);
             }
-            ctx->free_func(ctx, value->batch_items);
-            value->batch_items = NULL;
         }
         
-        value->batch_count = 0;
+        if(a->attributes != b->attributes)
+        {
+            if((a->attributes == NULL) || (b->attributes == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+            
+            for(size_t i = 0; i < a->attribute_count; i++)
+            {
+                if(kmip_compare_attribute(&a->attributes[i], &b->attributes[i]) == KMIP_FALSE)
+                {
+                    return(KMIP_FALSE);
+                }
+            }
+        }
     }
     
-    return;
+    return(KMIP_TRUE);
 }
 
-/*
-Copying Functions
-*/
-
-int32 *
-kmip_deep_copy_int32(KMIP *ctx, const int32 *value)
+int
+kmip_compare_application_specific_information(const ApplicationSpecificInformation *a, const ApplicationSpecificInformation *b)
 {
-    if(ctx == NULL || value == NULL)
-        return(NULL);
+    if(a != b)
+    {
+        if((a == NULL) || (b == NULL))
+        {
+            return(KMIP_FALSE);
+        }
 
-    int32 *copy = ctx->calloc_func(ctx, 1, sizeof(int32));
-    if(copy == NULL)
-        return(NULL);
+        if(a->application_namespace != b->application_namespace)
+        {
+            if((a->application_namespace == NULL) || (b->application_namespace == NULL))
+            {
+                return(KMIP_FALSE);
+            }
 
-    copy = ctx->memcpy_func(ctx->state, copy, value, sizeof(int32));
+            if(kmip_compare_text_string(a->application_namespace, b->application_namespace) == KMIP_FALSE)
+            {
+                return(KMIP_FALSE);
+            }
+        }
 
-    return(copy);
+        if(a->application_data != b->application_data)
+        {
+            if((a->application_data == NULL) || (b->application_data == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+
+            if(kmip_compare_text_string(a->application_data, b->application_data) == KMIP_FALSE)
+            {
+                return(KMIP_FALSE);
+            }
+        }
+    }
+
+    return(KMIP_TRUE);
 }
 
-TextString *
-kmip_deep_copy_text_string(KMIP *ctx, const TextString *value)
+int
+kmip_compare_cryptographic_parameters(const CryptographicParameters *a, const CryptographicParameters *b)
 {
-    if(ctx == NULL || value == NULL)
-        return(NULL);
+    return(kmip_compare_schema(&kmip_cryptographic_parameters_schema, a, b));
+}
 
-    TextString *copy = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-    if(copy == NULL)
-        return(NULL);
+int
+kmip_compare_encryption_key_information(const EncryptionKeyInformation *a, const EncryptionKeyInformation *b)
+{
+    return(kmip_compare_schema(&kmip_encryption_key_information_schema, a, b));
+}
 
-    copy->size = value->size;
-    if(value->value != NULL)
+int
+kmip_compare_mac_signature_key_information(const MACSignatureKeyInformation *a, const MACSignatureKeyInformation *b)
+{
+    return(kmip_compare_schema(&kmip_mac_signature_key_information_schema, a, b));
+}
+
+int
+kmip_compare_key_wrapping_data(const KeyWrappingData *a, const KeyWrappingData *b)
+{
+    return(kmip_compare_schema(&kmip_key_wrapping_data_schema, a, b));
+}
+
+int
+kmip_compare_key_block(const KeyBlock *a, const KeyBlock *b)
+{
+    if(a != b)
     {
-        copy->value = ctx->calloc_func(ctx->state, 1, value->size);
-        if(copy->value == NULL && value->value != NULL)
+        if((a == NULL) || (b == NULL))
         {
-            ctx->free_func(ctx->state, copy);
-            return(NULL);
+            return(KMIP_FALSE);
         }
-        copy->value = ctx->memcpy_func(ctx->state, copy->value, value->value, value->size);
-    }
-    else
-        copy->value = NULL;
-
-    return(copy);
+        
+        if(a->key_format_type != b->key_format_type)
+        {
+            return(KMIP_FALSE);
+        }
+        
+        if(a->key_compression_type != b->key_compression_type)
+        {
+            return(KMIP_FALSE);
+        }
+        
+        if(a->cryptographic_algorithm != b->cryptographic_algorithm)
+        {
+            return(KMIP_FALSE);
+        }
+        
+        if(a->cryptographic_length != b->cryptographic_length)
+        {
+            return(KMIP_FALSE);
+        }
+        
+        if(a->key_value_type != b->key_value_type)
+        {
+            return(KMIP_FALSE);
+        }
+        
+        if(a->key_value != b->key_value)
+        {
+            if((a->key_value == NULL) || (b->key_value == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+            
+            if(a->key_value_type == KMIP_TYPE_BYTE_STRING)
+            {
+                if(kmip_compare_byte_string((ByteString *)a->key_value, (ByteString *)b->key_value) == KMIP_FALSE)
+                {
+                    return(KMIP_FALSE);
+                }
+            }
+            else
+            {
+                if(kmip_compare_key_value(a->key_format_type, (KeyValue *)a->key_value, (KeyValue *)b->key_value) == KMIP_FALSE)
+                {
+                    return(KMIP_FALSE);
+                }
+            }
+        }
+        
+        if(a->key_wrapping_data != b->key_wrapping_data)
+        {
+            if((a->key_wrapping_data == NULL) || (b->key_wrapping_data == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+            
+            if(kmip_compare_key_wrapping_data(a->key_wrapping_data, b->key_wrapping_data) == KMIP_FALSE)
+            {
+                return(KMIP_FALSE);
+            }
+        }
+    }
+    
+    return(KMIP_TRUE);
 }
 
-Name *
-kmip_deep_copy_name(KMIP *ctx, const Name *value)
+int
+kmip_compare_symmetric_key(const SymmetricKey *a, const SymmetricKey *b)
 {
-    if(ctx == NULL || value == NULL)
-        return(NULL);
-
-    Name *copy = ctx->calloc_func(ctx->state, 1, sizeof(Name));
-    if(copy == NULL)
-        return(NULL);
-
-    copy->type = value->type;
-    if(value->value != NULL)
+    if(a != b)
     {
-        copy->value = kmip_deep_copy_text_string(ctx, value->value);
-        if(copy->value == NULL)
+        if((a == NULL) || (b == NULL))
         {
-            ctx->free_func(ctx->state, copy);
-            return(NULL);
+            return(KMIP_FALSE);
+        }
+        
+        if(a->key_block != b->key_block)
+        {
+            if((a->key_block == NULL) || (b->key_block == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+            
+            if(kmip_compare_key_block(a->key_block, b->key_block) == KMIP_FALSE)
+            {
+                return(KMIP_FALSE);
+            }
         }
     }
-    else
-        copy->value = NULL;
-
-    return(copy);
+    
+    return(KMIP_TRUE);
 }
 
-ApplicationSpecificInformation *
-kmip_deep_copy_application_specific_information(KMIP *ctx, const ApplicationSpecificInformation *value)
+int
+kmip_compare_public_key(const PublicKey *a, const PublicKey *b)
 {
-    if(ctx == NULL || value == NULL)
-    {
-        return(NULL);
-    }
-
-    ApplicationSpecificInformation *copy = ctx->calloc_func(ctx->state, 1, sizeof(ApplicationSpecificInformation));
-    if(copy == NULL)
-    {
-        return(NULL);
-    }
-
-    if(value->application_namespace != NULL)
+    if(a != b)
     {
-        copy->application_namespace = kmip_deep_copy_text_string(ctx, value->application_namespace);
-        if(copy->application_namespace == NULL)
+        if((a == NULL) || (b == NULL))
         {
-            ctx->free_func(ctx->state, copy);
-            return(NULL);
+            return(KMIP_FALSE);
         }
-    }
-    else
-    {
-        copy->application_namespace = NULL;
-    }
-
-    if(value->application_data != NULL)
-    {
-        copy->application_data = kmip_deep_copy_text_string(ctx, value->application_data);
-        if(copy->application_data == NULL)
+        
+        if(a->key_block != b->key_block)
         {
-            kmip_free_application_specific_information(ctx, copy);
-            ctx->free_func(ctx->state, copy);
-            return(NULL);
+            if((a->key_block == NULL) || (b->key_block == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+            
+            if(kmip_compare_key_block(a->key_block, b->key_block) == KMIP_FALSE)
+            {
+                return(KMIP_FALSE);
+            }
         }
     }
-    else
-    {
-        copy->application_data = NULL;
-    }
-
-    return(copy);
+    
+    return(KMIP_TRUE);
 }
 
-Attribute *
-kmip_deep_copy_attribute(KMIP *ctx, const Attribute *value)
+int
+kmip_compare_private_key(const PrivateKey *a, const PrivateKey *b)
 {
-    if(ctx == NULL || value == NULL)
-        return(NULL);
-
-    Attribute *copy = ctx->calloc_func(ctx->state, 1, sizeof(Attribute));
-    if(copy == NULL)
-        return(NULL);
-
-    copy->type = value->type;
-    copy->index = value->index;
-
-    if(value->value == NULL)
-    {
-        copy->value = NULL;
-        return(copy);
-    }
-
-    switch(value->type)
+    if(a != b)
     {
-        case KMIP_ATTR_UNIQUE_IDENTIFIER:
-        case KMIP_ATTR_OPERATION_POLICY_NAME:
+        if((a == NULL) || (b == NULL))
         {
-            copy->value = kmip_deep_copy_text_string(ctx, (TextString *)value->value);
-            if(copy->value == NULL)
-            {
-                ctx->free_func(ctx->state, copy);
-                return(NULL);
-            }
-        } break;
-
-        case KMIP_ATTR_NAME:
+            return(KMIP_FALSE);
+        }
+        
+        if(a->key_block != b->key_block)
         {
-            copy->value = kmip_deep_copy_name(ctx, (Name *)value->value);
-            if(copy->value == NULL)
+            if((a->key_block == NULL) || (b->key_block == NULL))
             {
-                ctx->free_func(ctx->state, copy);
-                return(NULL);
+                return(KMIP_FALSE);
             }
-        } break;
-
-        case KMIP_ATTR_OBJECT_TYPE:
-        case KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM:
-        case KMIP_ATTR_CRYPTOGRAPHIC_LENGTH:
-        case KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK:
-        case KMIP_ATTR_STATE:
-        {
-            copy->value = kmip_deep_copy_int32(ctx, (int32 *)value->value);
-            if(copy->value == NULL)
+            
+            if(kmip_compare_key_block(a->key_block, b->key_block) == KMIP_FALSE)
             {
-                ctx->free_func(ctx->state, copy);
-                return(NULL);
+                return(KMIP_FALSE);
             }
-        } break;
-
-        default:
-        {
-            ctx->free_func(ctx->state, copy);
-            return(NULL);
-        } break;
-    };
-
-    return(copy);
+        }
+    }
+    
+    return(KMIP_TRUE);
 }
 
-/*
-Comparison Functions
-*/
-
 int
-kmip_compare_text_string(const TextString *a, const TextString *b)
+kmip_compare_key_wrapping_specification(const KeyWrappingSpecification *a, const KeyWrappingSpecification *b)
 {
     if(a != b)
     {
@@ -6021,21 +8570,57 @@ kmip_compare_text_string(const TextString *a, const TextString *b)
             return(KMIP_FALSE);
         }
         
-        if(a->size != b->size)
+        if(a->wrapping_method != b->wrapping_method)
         {
             return(KMIP_FALSE);
         }
         
-        if(a->value != b->value)
+        if(a->encoding_option != b->encoding_option)
         {
-            if((a->value == NULL) || (b->value == NULL))
+            return(KMIP_FALSE);
+        }
+        
+        if(a->attribute_name_count != b->attribute_name_count)
+        {
+            return(KMIP_FALSE);
+        }
+        
+        if(a->encryption_key_info != b->encryption_key_info)
+        {
+            if((a->encryption_key_info == NULL) || (b->encryption_key_info == NULL))
             {
                 return(KMIP_FALSE);
             }
             
-            for(size_t i = 0; i < a->size; i++)
+            if(kmip_compare_encryption_key_information(a->encryption_key_info, b->encryption_key_info) == KMIP_FALSE)
             {
-                if(a->value[i] != b->value[i])
+                return(KMIP_FALSE);
+            }
+        }
+        
+        if(a->mac_signature_key_info != b->mac_signature_key_info)
+        {
+            if((a->mac_signature_key_info == NULL) || (b->mac_signature_key_info == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+            
+            if(kmip_compare_mac_signature_key_information(a->mac_signature_key_info, b->mac_signature_key_info) == KMIP_FALSE)
+            {
+                return(KMIP_FALSE);
+            }
+        }
+        
+        if(a->attribute_names != b->attribute_names)
+        {
+            if((a->attribute_names == NULL) || (b->attribute_names == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+            
+            for(size_t i = 0; i < a->attribute_name_count; i++)
+            {
+                if(kmip_compare_text_string(&a->attribute_names[i], &b->attribute_names[i]) == KMIP_FALSE)
                 {
                     return(KMIP_FALSE);
                 }
@@ -6047,7 +8632,7 @@ kmip_compare_text_string(const TextString *a, const TextString *b)
 }
 
 int
-kmip_compare_byte_string(const ByteString *a, const ByteString *b)
+kmip_compare_create_request_payload(const CreateRequestPayload *a, const CreateRequestPayload *b)
 {
     if(a != b)
     {
@@ -6056,24 +8641,47 @@ kmip_compare_byte_string(const ByteString *a, const ByteString *b)
             return(KMIP_FALSE);
         }
         
-        if(a->size != b->size)
+        if(a->object_type != b->object_type)
         {
             return(KMIP_FALSE);
         }
         
-        if(a->value != b->value)
+        if(a->template_attribute != b->template_attribute)
         {
-            if((a->value == NULL) || (b->value == NULL))
+            if((a->template_attribute == NULL) || (b->template_attribute == NULL))
             {
                 return(KMIP_FALSE);
             }
             
-            for(size_t i = 0; i < a->size; i++)
+            if(kmip_compare_template_attribute(a->template_attribute, b->template_attribute) == KMIP_FALSE)
+            {
+                return(KMIP_FALSE);
+            }
+        }
+
+        if(a->attributes != b->attributes)
+        {
+            if((a->attributes == NULL) || (b->attributes == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+
+            if(kmip_compare_attributes(a->attributes, b->attributes) == KMIP_FALSE)
+            {
+                return(KMIP_FALSE);
+            }
+        }
+
+        if(a->protection_storage_masks != b->protection_storage_masks)
+        {
+            if((a->protection_storage_masks == NULL) || (b->protection_storage_masks == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+
+            if(kmip_compare_protection_storage_masks(a->protection_storage_masks, b->protection_storage_masks) == KMIP_FALSE)
             {
-                if(a->value[i] != b->value[i])
-                {
-                    return(KMIP_FALSE);
-                }
+                return(KMIP_FALSE);
             }
         }
     }
@@ -6082,7 +8690,7 @@ kmip_compare_byte_string(const ByteString *a, const ByteString *b)
 }
 
 int
-kmip_compare_name(const Name *a, const Name *b)
+kmip_compare_create_response_payload(const CreateResponsePayload *a, const CreateResponsePayload *b)
 {
     if(a != b)
     {
@@ -6091,19 +8699,32 @@ kmip_compare_name(const Name *a, const Name *b)
             return(KMIP_FALSE);
         }
         
-        if(a->type != b->type)
+        if(a->object_type != b->object_type)
         {
             return(KMIP_FALSE);
         }
         
-        if(a->value != b->value)
+        if(a->unique_identifier != b->unique_identifier)
         {
-            if((a->value == NULL) || (b->value == NULL))
+            if((a->unique_identifier == NULL) || (b->unique_identifier == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+            
+            if(kmip_compare_text_string(a->unique_identifier, b->unique_identifier) == KMIP_FALSE)
+            {
+                return(KMIP_FALSE);
+            }
+        }
+        
+        if(a->template_attribute != b->template_attribute)
+        {
+            if((a->template_attribute == NULL) || (b->template_attribute == NULL))
             {
                 return(KMIP_FALSE);
             }
             
-            if(kmip_compare_text_string(a->value, b->value) != KMIP_TRUE)
+            if(kmip_compare_template_attribute(a->template_attribute, b->template_attribute) == KMIP_FALSE)
             {
                 return(KMIP_FALSE);
             }
@@ -6114,7 +8735,7 @@ kmip_compare_name(const Name *a, const Name *b)
 }
 
 int
-kmip_compare_protection_storage_masks(const ProtectionStorageMasks *a, const ProtectionStorageMasks *b)
+kmip_compare_get_request_payload(const GetRequestPayload *a, const GetRequestPayload *b)
 {
     if(a != b)
     {
@@ -6122,49 +8743,54 @@ kmip_compare_protection_storage_masks(const ProtectionStorageMasks *a, const Pro
         {
             return(KMIP_FALSE);
         }
-
-        if((a->masks != b->masks))
+        
+        if(a->key_format_type != b->key_format_type)
+        {
+            return(KMIP_FALSE);
+        }
+        
+        if(a->key_compression_type != b->key_compression_type)
+        {
+            return(KMIP_FALSE);
+        }
+        
+        if(a->key_wrap_type != b->key_wrap_type)
+        {
+            return(KMIP_FALSE);
+        }
+        
+        if(a->unique_identifier != b->unique_identifier)
         {
-            if((a->masks == NULL) || (b->masks == NULL))
+            if((a->unique_identifier == NULL) || (b->unique_identifier == NULL))
             {
                 return(KMIP_FALSE);
             }
-
-            if((a->masks->size != b->masks->size))
+            
+            if(kmip_compare_text_string(a->unique_identifier, b->unique_identifier) == KMIP_FALSE)
             {
                 return(KMIP_FALSE);
             }
-
-            LinkedListItem *a_item = a->masks->head;
-            LinkedListItem *b_item = b->masks->head;
-            while((a_item != NULL) || (b_item != NULL))
+        }
+        
+        if(a->key_wrapping_spec != b->key_wrapping_spec)
+        {
+            if((a->key_wrapping_spec == NULL) || (b->key_wrapping_spec == NULL))
             {
-                if(a_item != b_item)
-                {
-                    int32 a_data = *(int32 *)a_item->data;
-                    int32 b_data = *(int32 *)b_item->data;
-                    if(a_data != b_data)
-                    {
-                        return(KMIP_FALSE);
-                    }
-                }
-
-                a_item = a_item->next;
-                b_item = b_item->next;
+                return(KMIP_FALSE);
             }
-
-            if(a_item != b_item)
+            
+            if(kmip_compare_key_wrapping_specification(a->key_wrapping_spec, b->key_wrapping_spec) == KMIP_FALSE)
             {
                 return(KMIP_FALSE);
             }
         }
     }
-
+    
     return(KMIP_TRUE);
 }
 
 int
-kmip_compare_attribute(const Attribute *a, const Attribute *b)
+kmip_compare_get_response_payload(const GetResponsePayload *a, const GetResponsePayload *b)
 {
     if(a != b)
     {
@@ -6173,85 +8799,51 @@ kmip_compare_attribute(const Attribute *a, const Attribute *b)
             return(KMIP_FALSE);
         }
         
-        if(a->type != b->type)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->index != b->index)
+        if(a->object_type != b->object_type)
         {
             return(KMIP_FALSE);
         }
         
-        if(a->value != b->value)
+        if(a->unique_identifier != b->unique_identifier)
         {
-            if((a->value == NULL) || (b->value == NULL))
+            if((a->unique_identifier == NULL) || (b->unique_identifier == NULL))
             {
                 return(KMIP_FALSE);
             }
             
-            switch(a->type)
+            if(kmip_compare_text_string(a->unique_identifier, b->unique_identifier) == KMIP_FALSE)
             {
-                case KMIP_ATTR_APPLICATION_SPECIFIC_INFORMATION:
-                {
-                    return(
-                        kmip_compare_application_specific_information(
-                            (ApplicationSpecificInformation*)a->value,
-                            (ApplicationSpecificInformation*)b->value
-                        )
-                    );
-                }
-                break;
-
-                case KMIP_ATTR_UNIQUE_IDENTIFIER:
-                return(kmip_compare_text_string((TextString *)a->value, (TextString *)b->value));
-                break;
-                
-                case KMIP_ATTR_NAME:
-                return(kmip_compare_name((Name *)a->value, (Name *)b->value));
-                break;
-                
-                case KMIP_ATTR_OBJECT_TYPE:
-                if(*(int32*)a->value != *(int32*)b->value)
-                {
-                    return(KMIP_FALSE);
-                }
-                break;
-                
-                case KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM:
-                if(*(int32*)a->value != *(int32*)b->value)
-                {
-                    return(KMIP_FALSE);
-                }
-                break;
-                
-                case KMIP_ATTR_CRYPTOGRAPHIC_LENGTH:
-                if(*(int32*)a->value != *(int32*)b->value)
+                return(KMIP_FALSE);
+            }
+        }
+        
+        if(a->object != b->object)
+        {
+            switch(a->object_type)
+            {
+                case KMIP_OBJTYPE_SYMMETRIC_KEY:
+                if(kmip_compare_symmetric_key((SymmetricKey *)a->object, (SymmetricKey *)b->object) == KMIP_FALSE)
                 {
                     return(KMIP_FALSE);
                 }
                 break;
                 
-                case KMIP_ATTR_OPERATION_POLICY_NAME:
-                return(kmip_compare_text_string((TextString *)a->value, (TextString *)b->value));
-                break;
-                
-                case KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK:
-                if(*(int32*)a->value != *(int32*)b->value)
+                case KMIP_OBJTYPE_PUBLIC_KEY:
+                if(kmip_compare_public_key((PublicKey *)a->object, (PublicKey *)b->object) == KMIP_FALSE)
                 {
                     return(KMIP_FALSE);
                 }
                 break;
                 
-                case KMIP_ATTR_STATE:
-                if(*(int32*)a->value != *(int32*)b->value)
+                case KMIP_OBJTYPE_PRIVATE_KEY:
+                if(kmip_compare_private_key((PrivateKey *)a->object, (PrivateKey *)b->object) == KMIP_FALSE)
                 {
                     return(KMIP_FALSE);
                 }
                 break;
                 
                 default:
-                /* NOTE (ph) Unsupported types can't be compared. */
+                /* NOTE (ph) Unsupported types cannot be compared. */
                 return(KMIP_FALSE);
                 break;
             };
@@ -6262,7 +8854,19 @@ kmip_compare_attribute(const Attribute *a, const Attribute *b)
 }
 
 int
-kmip_compare_attributes(const Attributes *a, const Attributes *b)
+kmip_compare_destroy_request_payload(const DestroyRequestPayload *a, const DestroyRequestPayload *b)
+{
+    return(kmip_compare_schema(&kmip_destroy_request_payload_schema, a, b));
+}
+
+int
+kmip_compare_destroy_response_payload(const DestroyResponsePayload *a, const DestroyResponsePayload *b)
+{
+    return(kmip_compare_schema(&kmip_destroy_response_payload_schema, a, b));
+}
+
+int
+kmip_compare_request_batch_item(const RequestBatchItem *a, const RequestBatchItem *b)
 {
     if(a != b)
     {
@@ -6270,49 +8874,73 @@ kmip_compare_attributes(const Attributes *a, const Attributes *b)
         {
             return(KMIP_FALSE);
         }
+        
+        if(a->operation != b->operation)
+        {
+            return(KMIP_FALSE);
+        }
 
-        if((a->attribute_list != b->attribute_list))
+        if(a->ephemeral != b->ephemeral)
+        {
+            return(KMIP_FALSE);
+        }
+        
+        if(a->unique_batch_item_id != b->unique_batch_item_id)
         {
-            if((a->attribute_list == NULL) || (b->attribute_list == NULL))
+            if((a->unique_batch_item_id == NULL) || (b->unique_batch_item_id == NULL))
             {
                 return(KMIP_FALSE);
             }
-
-            if((a->attribute_list->size != b->attribute_list->size))
+            
+            if(kmip_compare_byte_string(a->unique_batch_item_id, b->unique_batch_item_id) == KMIP_FALSE)
             {
                 return(KMIP_FALSE);
             }
-
-            LinkedListItem *a_item = a->attribute_list->head;
-            LinkedListItem *b_item = b->attribute_list->head;
-            while((a_item != NULL) || (b_item != NULL))
+        }
+        
+        if(a->request_payload != b->request_payload)
+        {
+            if((a->request_payload == NULL) || (b->request_payload == NULL))
             {
-                if(a_item != b_item)
-                {
-                    Attribute *a_data = (Attribute *)a_item->data;
-                    Attribute *b_data = (Attribute *)b_item->data;
-                    if(kmip_compare_attribute(a_data, b_data) == KMIP_FALSE)
-                    {
-                        return(KMIP_FALSE);
-                    }
-                }
-
-                a_item = a_item->next;
-                b_item = b_item->next;
+                return(KMIP_FALSE);
             }
-
-            if(a_item != b_item)
+            
+            switch(a->operation)
             {
+                case KMIP_OP_CREATE:
+                if(kmip_compare_create_request_payload((CreateRequestPayload *)a->request_payload, (CreateRequestPayload *)b->request_payload) == KMIP_FALSE)
+                {
+                    return(KMIP_FALSE);
+                }
+                break;
+                
+                case KMIP_OP_GET:
+                if(kmip_compare_get_request_payload((GetRequestPayload *)a->request_payload, (GetRequestPayload *)b->request_payload) == KMIP_FALSE)
+                {
+                    return(KMIP_FALSE);
+                }
+                break;
+                
+                case KMIP_OP_DESTROY:
+                if(kmip_compare_destroy_request_payload((DestroyRequestPayload *)a->request_payload, (DestroyRequestPayload *)b->request_payload) == KMIP_FALSE)
+                {
+                    return(KMIP_FALSE);
+                }
+                break;
+                
+                default:
+                /* NOTE (ph) Unsupported payloads cannot be compared. */
                 return(KMIP_FALSE);
-            }
+                break;
+            };
         }
     }
-
+    
     return(KMIP_TRUE);
 }
 
 int
-kmip_compare_template_attribute(const TemplateAttribute *a, const TemplateAttribute *b)
+kmip_compare_response_batch_item(const ResponseBatchItem *a, const ResponseBatchItem *b)
 {
     if(a != b)
     {
@@ -6321,46 +8949,95 @@ kmip_compare_template_attribute(const TemplateAttribute *a, const TemplateAttrib
             return(KMIP_FALSE);
         }
         
-        if(a->name_count != b->name_count)
+        if(a->operation != b->operation)
         {
             return(KMIP_FALSE);
         }
         
-        if(a->attribute_count != b->attribute_count)
+        if(a->result_status != b->result_status)
         {
             return(KMIP_FALSE);
         }
         
-        if(a->names != b->names)
+        if(a->result_reason != b->result_reason)
         {
-            if((a->names == NULL) || (b->names == NULL))
+            return(KMIP_FALSE);
+        }
+        
+        if(a->unique_batch_item_id != b->unique_batch_item_id)
+        {
+            if((a->unique_batch_item_id == NULL) || (b->unique_batch_item_id == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+            
+            if(kmip_compare_byte_string(a->unique_batch_item_id, b->unique_batch_item_id) == KMIP_FALSE)
+            {
+                return(KMIP_FALSE);
+            }
+        }
+        
+        if(a->result_message != b->result_message)
+        {
+            if((a->result_message == NULL) || (b->result_message == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+            
+            if(kmip_compare_text_string(a->result_message, b->result_message) == KMIP_FALSE)
+            {
+                return(KMIP_FALSE);
+            }
+        }
+        
+        if(a->asynchronous_correlation_value != b->asynchronous_correlation_value)
+        {
+            if((a->asynchronous_correlation_value == NULL) || (b->asynchronous_correlation_value == NULL))
             {
                 return(KMIP_FALSE);
             }
             
-            for(size_t i = 0; i < a->name_count; i++)
+            if(kmip_compare_byte_string(a->asynchronous_correlation_value, b->asynchronous_correlation_value) == KMIP_FALSE)
             {
-                if(kmip_compare_name(&a->names[i], &b->names[i]) == KMIP_FALSE)
-                {
-                    return(KMIP_FALSE);
-                }
+                return(KMIP_FALSE);
             }
         }
         
-        if(a->attributes != b->attributes)
+        if(a->response_payload != b->response_payload)
         {
-            if((a->attributes == NULL) || (b->attributes == NULL))
+            if((a->response_payload == NULL) || (b->response_payload == NULL))
             {
                 return(KMIP_FALSE);
             }
             
-            for(size_t i = 0; i < a->attribute_count; i++)
+            switch(a->operation)
             {
-                if(kmip_compare_attribute(&a->attributes[i], &b->attributes[i]) == KMIP_FALSE)
+                case KMIP_OP_CREATE:
+                if(kmip_compare_create_response_payload((CreateResponsePayload *)a->response_payload, (CreateResponsePayload *)b->response_payload) == KMIP_FALSE)
                 {
                     return(KMIP_FALSE);
                 }
-            }
+                break;
+                
+                case KMIP_OP_GET:
+                if(kmip_compare_get_response_payload((GetResponsePayload *)a->response_payload, (GetResponsePayload *)b->response_payload) == KMIP_FALSE)
+                {
+                    return(KMIP_FALSE);
+                }
+                break;
+                
+                case KMIP_OP_DESTROY:
+                if(kmip_compare_destroy_response_payload((DestroyResponsePayload *)a->response_payload, (DestroyResponsePayload *)b->response_payload) == KMIP_FALSE)
+                {
+                    return(KMIP_FALSE);
+                }
+                break;
+                
+                default:
+                /* NOTE (ph) Unsupported payloads cannot be compared. */
+                return(KMIP_FALSE);
+                break;
+            };
         }
     }
     
@@ -6368,58 +9045,31 @@ kmip_compare_template_attribute(const TemplateAttribute *a, const TemplateAttrib
 }
 
 int
-kmip_compare_protocol_version(const ProtocolVersion *a, const ProtocolVersion *b)
+kmip_compare_nonce(const Nonce *a, const Nonce *b)
 {
-    if(a != b)
-    {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->major != b->major)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->minor != b->minor)
-        {
-            return(KMIP_FALSE);
-        }
-    }
-    
-    return(KMIP_TRUE);
+    return(kmip_compare_schema(&kmip_nonce_schema, a, b));
 }
 
 int
-kmip_compare_transparent_symmetric_key(const TransparentSymmetricKey *a, const TransparentSymmetricKey *b)
+kmip_compare_username_password_credential(const UsernamePasswordCredential *a, const UsernamePasswordCredential *b)
 {
-    if(a != b)
-    {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->key != b->key)
-        {
-            if((a->key == NULL) || (b->key == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_byte_string(a->key, b->key) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
-    }
-    
-    return(KMIP_TRUE);
+    return(kmip_compare_schema(&kmip_username_password_credential_schema, a, b));
 }
 
 int
-kmip_compare_key_material(enum key_format_type format, void **a, void **b)
+kmip_compare_device_credential(const DeviceCredential *a, const DeviceCredential *b)
+{
+    return(kmip_compare_schema(&kmip_device_credential_schema, a, b));
+}
+
+int
+kmip_compare_attestation_credential(const AttestationCredential *a, const AttestationCredential *b)
+{
+    return(kmip_compare_schema(&kmip_attestation_credential_schema, a, b));
+}
+
+int
+kmip_compare_credential_value(enum credential_type type, void **a, void **b)
 {
     if(a != b)
     {
@@ -6435,22 +9085,24 @@ kmip_compare_key_material(enum key_format_type format, void **a, void **b)
                 return(KMIP_FALSE);
             }
             
-            switch(format)
+            switch(type)
             {
-                case KMIP_KEYFORMAT_RAW:
-                case KMIP_KEYFORMAT_OPAQUE:
-                case KMIP_KEYFORMAT_PKCS1:
-                case KMIP_KEYFORMAT_PKCS8:
-                case KMIP_KEYFORMAT_X509:
-                case KMIP_KEYFORMAT_EC_PRIVATE_KEY:
-                if(kmip_compare_byte_string(*a, *b) == KMIP_FALSE)
+                case KMIP_CRED_USERNAME_AND_PASSWORD:
+                if(kmip_compare_username_password_credential(*a, *b) == KMIP_FALSE)
                 {
                     return(KMIP_FALSE);
                 }
                 break;
                 
-                case KMIP_KEYFORMAT_TRANS_SYMMETRIC_KEY:
-                if(kmip_compare_transparent_symmetric_key(*a, *b) == KMIP_FALSE)
+                case KMIP_CRED_DEVICE:
+                if(kmip_compare_device_credential(*a, *b) == KMIP_FALSE)
+                {
+                    return(KMIP_FALSE);
+                }
+                break;
+                
+                case KMIP_CRED_ATTESTATION:
+                if(kmip_compare_attestation_credential(*a, *b) == KMIP_FALSE)
                 {
                     return(KMIP_FALSE);
                 }
@@ -6468,7 +9120,7 @@ kmip_compare_key_material(enum key_format_type format, void **a, void **b)
 }
 
 int
-kmip_compare_key_value(enum key_format_type format, const KeyValue *a, const KeyValue *b)
+kmip_compare_credential(const Credential *a, const Credential *b)
 {
     if(a != b)
     {
@@ -6477,32 +9129,21 @@ kmip_compare_key_value(enum key_format_type format, const KeyValue *a, const Key
             return(KMIP_FALSE);
         }
         
-        if(a->key_material != b->key_material)
+        if(a->credential_type != b->credential_type)
         {
-            if((a->key_material == NULL) || (b->key_material == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_key_material(format, (void**)&a->key_material, (void**)&b->key_material) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
+            return(KMIP_FALSE);
         }
         
-        if(a->attributes != b->attributes)
+        if(a->credential_value != b->credential_value)
         {
-            if((a->attributes == NULL) || (b->attributes == NULL))
+            if((a->credential_value == NULL) || (b->credential_value == NULL))
             {
                 return(KMIP_FALSE);
             }
             
-            for(size_t i = 0; i < a->attribute_count; i++)
+            if(kmip_compare_credential_value(a->credential_type, (void**)&a->credential_value, (void**)&b->credential_value) == KMIP_FALSE)
             {
-                if(kmip_compare_attribute(&a->attributes[i], &b->attributes[i]) == KMIP_FALSE)
-                {
-                    return(KMIP_FALSE);
-                }
+                return(KMIP_FALSE);
             }
         }
     }
@@ -6511,7 +9152,7 @@ kmip_compare_key_value(enum key_format_type format, const KeyValue *a, const Key
 }
 
 int
-kmip_compare_application_specific_information(const ApplicationSpecificInformation *a, const ApplicationSpecificInformation *b)
+kmip_compare_authentication(const Authentication *a, const Authentication *b)
 {
     if(a != b)
     {
@@ -6519,39 +9160,31 @@ kmip_compare_application_specific_information(const ApplicationSpecificInformati
         {
             return(KMIP_FALSE);
         }
-
-        if(a->application_namespace != b->application_namespace)
+        
+        if(kmip_compare_fragment(a->fragment, b->fragment) == KMIP_FALSE)
         {
-            if((a->application_namespace == NULL) || (b->application_namespace == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-
-            if(kmip_compare_text_string(a->application_namespace, b->application_namespace) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
+            return(KMIP_FALSE);
         }
-
-        if(a->application_data != b->application_data)
+        
+        if(a->credential != b->credential)
         {
-            if((a->application_data == NULL) || (b->application_data == NULL))
+            if((a->credential == NULL) || (b->credential == NULL))
             {
                 return(KMIP_FALSE);
             }
-
-            if(kmip_compare_text_string(a->application_data, b->application_data) == KMIP_FALSE)
+            
+            if(kmip_compare_credential(a->credential, b->credential) == KMIP_FALSE)
             {
                 return(KMIP_FALSE);
             }
         }
     }
-
+    
     return(KMIP_TRUE);
 }
 
 int
-kmip_compare_cryptographic_parameters(const CryptographicParameters *a, const CryptographicParameters *b)
+kmip_compare_request_header(const RequestHeader *a, const RequestHeader *b)
 {
     if(a != b)
     {
@@ -6560,181 +9193,109 @@ kmip_compare_cryptographic_parameters(const CryptographicParameters *a, const Cr
             return(KMIP_FALSE);
         }
         
-        if(a->block_cipher_mode != b->block_cipher_mode)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->padding_method != b->padding_method)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->hashing_algorithm != b->hashing_algorithm)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->key_role_type != b->key_role_type)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->digital_signature_algorithm != b->digital_signature_algorithm)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->cryptographic_algorithm != b->cryptographic_algorithm)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->random_iv != b->random_iv)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->iv_length != b->iv_length)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->tag_length != b->tag_length)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->fixed_field_length != b->fixed_field_length)
+        if(a->maximum_response_size != b->maximum_response_size)
         {
             return(KMIP_FALSE);
         }
         
-        if(a->invocation_field_length != b->invocation_field_length)
+        if(a->asynchronous_indicator != b->asynchronous_indicator)
         {
             return(KMIP_FALSE);
         }
         
-        if(a->counter_length != b->counter_length)
+        if(a->batch_error_continuation_option != b->batch_error_continuation_option)
         {
             return(KMIP_FALSE);
         }
         
-        if(a->initial_counter_value != b->initial_counter_value)
+        if(a->batch_order_option != b->batch_order_option)
         {
             return(KMIP_FALSE);
         }
         
-        if(a->salt_length != b->salt_length)
+        if(a->time_stamp != b->time_stamp)
         {
             return(KMIP_FALSE);
         }
         
-        if(a->mask_generator != b->mask_generator)
+        if(a->batch_count != b->batch_count)
         {
             return(KMIP_FALSE);
         }
         
-        if(a->mask_generator_hashing_algorithm != 
-           b->mask_generator_hashing_algorithm)
+        if(a->attestation_capable_indicator != b->attestation_capable_indicator)
         {
             return(KMIP_FALSE);
         }
         
-        if(a->trailer_field != b->trailer_field)
+        if(a->attestation_type_count != b->attestation_type_count)
         {
             return(KMIP_FALSE);
         }
         
-        if(a->p_source != b->p_source)
+        if(a->protocol_version != b->protocol_version)
         {
-            if((a->p_source == NULL) || (b->p_source == NULL))
+            if((a->protocol_version == NULL) || (b->protocol_version == NULL))
             {
                 return(KMIP_FALSE);
             }
             
-            if(kmip_compare_byte_string(a->p_source, b->p_source) == KMIP_FALSE)
+            if(kmip_compare_protocol_version(a->protocol_version, b->protocol_version) == KMIP_FALSE)
             {
                 return(KMIP_FALSE);
             }
         }
-    }
-    
-    return(KMIP_TRUE);
-}
-
-int
-kmip_compare_encryption_key_information(const EncryptionKeyInformation *a, const EncryptionKeyInformation *b)
-{
-    if(a != b)
-    {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
         
-        if(a->unique_identifier != b->unique_identifier)
+        if(a->authentication != b->authentication)
         {
-            if((a->unique_identifier == NULL) || (b->unique_identifier == NULL))
+            if((a->authentication == NULL) || (b->authentication == NULL))
             {
                 return(KMIP_FALSE);
             }
             
-            if(kmip_compare_text_string(a->unique_identifier, b->unique_identifier) == KMIP_FALSE)
+            if(kmip_compare_authentication(a->authentication, b->authentication) == KMIP_FALSE)
             {
                 return(KMIP_FALSE);
             }
         }
         
-        if(a->cryptographic_parameters != b->cryptographic_parameters)
+        if(a->attestation_types != b->attestation_types)
         {
-            if((a->cryptographic_parameters == NULL) ||
-               (b->cryptographic_parameters == NULL))
+            if((a->attestation_types == NULL) || (b->attestation_types == NULL))
             {
                 return(KMIP_FALSE);
             }
             
-            if(kmip_compare_cryptographic_parameters(a->cryptographic_parameters, b->cryptographic_parameters) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
-    }
-    
-    return(KMIP_TRUE);
-}
-
-int
-kmip_compare_mac_signature_key_information(const MACSignatureKeyInformation *a, const MACSignatureKeyInformation *b)
-{
-    if(a != b)
-    {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
+            for(size_t i = 0; i < a->attestation_type_count; i++)
+            {
+                if(a->attestation_types[i] != b->attestation_types[i])
+                {
+                    return(KMIP_FALSE);
+                }
+            }
         }
         
-        if(a->unique_identifier != b->unique_identifier)
+        if(a->client_correlation_value != b->client_correlation_value)
         {
-            if((a->unique_identifier == NULL) || (b->unique_identifier == NULL))
+            if((a->client_correlation_value == NULL) || (b->client_correlation_value == NULL))
             {
                 return(KMIP_FALSE);
             }
             
-            if(kmip_compare_text_string(a->unique_identifier, b->unique_identifier) == KMIP_FALSE)
+            if(kmip_compare_text_string(a->client_correlation_value, b->client_correlation_value) == KMIP_FALSE)
             {
                 return(KMIP_FALSE);
             }
         }
         
-        if(a->cryptographic_parameters != b->cryptographic_parameters)
+        if(a->server_correlation_value != b->server_correlation_value)
         {
-            if((a->cryptographic_parameters == NULL) || (b->cryptographic_parameters == NULL))
+            if((a->server_correlation_value == NULL) || (b->server_correlation_value == NULL))
             {
                 return(KMIP_FALSE);
             }
             
-            if(kmip_compare_cryptographic_parameters(a->cryptographic_parameters, b->cryptographic_parameters) == KMIP_FALSE)
+            if(kmip_compare_text_string(a->server_correlation_value, b->server_correlation_value) == KMIP_FALSE)
             {
                 return(KMIP_FALSE);
             }
@@ -6745,7 +9306,7 @@ kmip_compare_mac_signature_key_information(const MACSignatureKeyInformation *a,
 }
 
 int
-kmip_compare_key_wrapping_data(const KeyWrappingData *a, const KeyWrappingData *b)
+kmip_compare_response_header(const ResponseHeader *a, const ResponseHeader *b)
 {
     if(a != b)
     {
@@ -6754,63 +9315,93 @@ kmip_compare_key_wrapping_data(const KeyWrappingData *a, const KeyWrappingData *
             return(KMIP_FALSE);
         }
         
-        if(a->wrapping_method != b->wrapping_method)
+        if(a->time_stamp != b->time_stamp)
         {
             return(KMIP_FALSE);
         }
         
-        if(a->encoding_option != b->encoding_option)
+        if(a->batch_count != b->batch_count)
+        {
+            return(KMIP_FALSE);
+        }
+        
+        if(a->attestation_type_count != b->attestation_type_count)
         {
             return(KMIP_FALSE);
         }
         
-        if(a->mac_signature != b->mac_signature)
+        if(a->protocol_version != b->protocol_version)
         {
-            if((a->mac_signature == NULL) || (b->mac_signature == NULL))
+            if((a->protocol_version == NULL) || (b->protocol_version == NULL))
             {
                 return(KMIP_FALSE);
             }
             
-            if(kmip_compare_byte_string(a->mac_signature, b->mac_signature) == KMIP_FALSE)
+            if(kmip_compare_protocol_version(a->protocol_version, b->protocol_version) == KMIP_FALSE)
             {
                 return(KMIP_FALSE);
             }
         }
         
-        if(a->iv_counter_nonce != b->iv_counter_nonce)
+        if(a->nonce != b->nonce)
         {
-            if((a->iv_counter_nonce == NULL) || (b->iv_counter_nonce == NULL))
+            if((a->nonce == NULL) || (b->nonce == NULL))
             {
                 return(KMIP_FALSE);
             }
             
-            if(kmip_compare_byte_string(a->iv_counter_nonce, b->iv_counter_nonce) == KMIP_FALSE)
+            if(kmip_compare_nonce(a->nonce, b->nonce) == KMIP_FALSE)
             {
                 return(KMIP_FALSE);
             }
         }
+
+        if(a->server_hashed_password != b->server_hashed_password)
+        {
+            if((a->server_hashed_password == NULL) || (b->server_hashed_password == NULL))
+                return(KMIP_FALSE);
+
+            if(kmip_compare_byte_string(a->server_hashed_password, b->server_hashed_password) == KMIP_FALSE)
+                return(KMIP_FALSE);
+        }
+
+        if(a->attestation_types != b->attestation_types)
+        {
+            if((a->attestation_types == NULL) || (b->attestation_types == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+            
+            for(size_t i = 0; i < a->attestation_type_count; i++)
+            {
+                if(a->attestation_types[i] != b->attestation_types[i])
+                {
+                    return(KMIP_FALSE);
+                }
+            }
+        }
         
-        if(a->encryption_key_info != b->encryption_key_info)
+        if(a->client_correlation_value != b->client_correlation_value)
         {
-            if((a->encryption_key_info == NULL) || (b->encryption_key_info == NULL))
+            if((a->client_correlation_value == NULL) || (b->client_correlation_value == NULL))
             {
                 return(KMIP_FALSE);
             }
             
-            if(kmip_compare_encryption_key_information(a->encryption_key_info, b->encryption_key_info) == KMIP_FALSE)
+            if(kmip_compare_text_string(a->client_correlation_value, b->client_correlation_value) == KMIP_FALSE)
             {
                 return(KMIP_FALSE);
             }
         }
         
-        if(a->mac_signature_key_info != b->mac_signature_key_info)
+        if(a->server_correlation_value != b->server_correlation_value)
         {
-            if((a->mac_signature_key_info == NULL) || (b->mac_signature_key_info == NULL))
+            if((a->server_correlation_value == NULL) || (b->server_correlation_value == NULL))
             {
                 return(KMIP_FALSE);
             }
             
-            if(kmip_compare_mac_signature_key_information(a->mac_signature_key_info, b->mac_signature_key_info) == KMIP_FALSE)
+            if(kmip_compare_text_string(a->server_correlation_value, b->server_correlation_value) == KMIP_FALSE)
             {
                 return(KMIP_FALSE);
             }
@@ -6821,7 +9412,7 @@ kmip_compare_key_wrapping_data(const KeyWrappingData *a, const KeyWrappingData *
 }
 
 int
-kmip_compare_key_block(const KeyBlock *a, const KeyBlock *b)
+kmip_compare_request_message(const RequestMessage *a, const RequestMessage *b)
 {
     if(a != b)
     {
@@ -6830,1340 +9421,1535 @@ kmip_compare_key_block(const KeyBlock *a, const KeyBlock *b)
             return(KMIP_FALSE);
         }
         
-        if(a->key_format_type != b->key_format_type)
+        if(a->batch_count != b->batch_count)
         {
             return(KMIP_FALSE);
         }
         
-        if(a->key_compression_type != b->key_compression_type)
+        if(a->request_header != b->request_header)
         {
-            return(KMIP_FALSE);
+            if((a->request_header == NULL) || (b->request_header == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+            
+            if(kmip_compare_request_header(a->request_header, b->request_header) == KMIP_FALSE)
+            {
+                return(KMIP_FALSE);
+            }
         }
         
-        if(a->cryptographic_algorithm != b->cryptographic_algorithm)
+        if(a->batch_items != b->batch_items)
         {
-            return(KMIP_FALSE);
+            if((a->batch_items == NULL) || (b->batch_items == NULL))
+            {
+                return(KMIP_FALSE);
+            }
+            
+            for(size_t i = 0; i < a->batch_count; i++)
+            {
+                if(kmip_compare_request_batch_item(&a->batch_items[i], &b->batch_items[i]) == KMIP_FALSE)
+                {
+                    return(KMIP_FALSE);
+                }
+            }
         }
-        
-        if(a->cryptographic_length != b->cryptographic_length)
+    }
+    
+    return(KMIP_TRUE);
+}
+
+int
+kmip_compare_response_message(const ResponseMessage *a, const ResponseMessage *b)
+{
+    if(a != b)
+    {
+        if((a == NULL) || (b == NULL))
         {
             return(KMIP_FALSE);
         }
         
-        if(a->key_value_type != b->key_value_type)
+        if(a->batch_count != b->batch_count)
         {
             return(KMIP_FALSE);
         }
         
-        if(a->key_value != b->key_value)
+        if(a->response_header != b->response_header)
         {
-            if((a->key_value == NULL) || (b->key_value == NULL))
+            if((a->response_header == NULL) || (b->response_header == NULL))
             {
                 return(KMIP_FALSE);
             }
             
-            if(a->key_value_type == KMIP_TYPE_BYTE_STRING)
-            {
-                if(kmip_compare_byte_string((ByteString *)a->key_value, (ByteString *)b->key_value) == KMIP_FALSE)
-                {
-                    return(KMIP_FALSE);
-                }
-            }
-            else
+            if(kmip_compare_response_header(a->response_header, b->response_header) == KMIP_FALSE)
             {
-                if(kmip_compare_key_value(a->key_format_type, (KeyValue *)a->key_value, (KeyValue *)b->key_value) == KMIP_FALSE)
-                {
-                    return(KMIP_FALSE);
-                }
+                return(KMIP_FALSE);
             }
         }
         
-        if(a->key_wrapping_data != b->key_wrapping_data)
+        if(a->batch_items != b->batch_items)
         {
-            if((a->key_wrapping_data == NULL) || (b->key_wrapping_data == NULL))
+            if((a->batch_items == NULL) || (b->batch_items == NULL))
             {
                 return(KMIP_FALSE);
             }
             
-            if(kmip_compare_key_wrapping_data(a->key_wrapping_data, b->key_wrapping_data) == KMIP_FALSE)
+            for(size_t i = 0; i < a->batch_count; i++)
             {
-                return(KMIP_FALSE);
+                if(kmip_compare_response_batch_item(&a->batch_items[i], &b->batch_items[i]) == KMIP_FALSE)
+                {
+                    return(KMIP_FALSE);
+                }
+            }
+        }
+    }
+    
+    return(KMIP_TRUE);
+}
+
+/*
+Hashing Functions
+*/
+
+/* NOTE (ph) Each hashing function mirrors its comparison counterpart:  */
+/*      it covers exactly the fields the comparison checks, so values  */
+/*      that compare equal always hash equal. Values the comparison    */
+/*      cannot look into, such as unsupported payloads, hash by their  */
+/*      type alone. Hashes are seeded per process and must not be      */
+/*      stored or sent anywhere.                                       */
+/*                                                                     */
+/*      The seed is drawn from the system entropy device the first     */
+/*      time it is needed and then kept for the life of the process.   */
+/*      Zero means no seed has been drawn yet.                         */
+
+#define KMIP_HASH_MULTIPLIER (0x9E3779B97F4A7C15ULL)
+
+#if defined(__STDC_NO_ATOMICS__)
+static uint64 kmip_hash_seed = 0;
+#else
+static _Atomic uint64 kmip_hash_seed = 0;
+#endif
+
+uint64
+kmip_generate_hash_seed(void)
+{
+    uint64 seed = 0;
+    
+    FILE *source = fopen("/dev/urandom", "rb");
+    if(source != NULL)
+    {
+        setvbuf(source, NULL, _IONBF, 0);
+        if(fread(&seed, sizeof(seed), 1, source) != 1)
+        {
+            seed = 0;
+        }
+        fclose(source);
+    }
+    
+    /* Without an entropy device, fall back on what differs between */
+    /* processes: the time, the process id and the stack address.    */
+    if(seed == 0)
+    {
+        int local = 0;
+        seed = kmip_hash_mix(KMIP_HASH_MULTIPLIER, (uint64)time(NULL));
+        seed = kmip_hash_mix(seed, (uint64)clock());
+        seed = kmip_hash_mix(seed, (uint64)(uintptr_t)&local);
+#if defined(__unix__) || defined(__APPLE__)
+        seed = kmip_hash_mix(seed, (uint64)getpid());
+#endif
+    }
+    
+    return((seed != 0) ? seed : KMIP_HASH_MULTIPLIER);
+}
+
+uint64
+kmip_get_hash_seed(void)
+{
+#if defined(__STDC_NO_ATOMICS__)
+    if(kmip_hash_seed == 0)
+    {
+        kmip_hash_seed = kmip_generate_hash_seed();
+    }
+    
+    return(kmip_hash_seed);
+#else
+    uint64 seed = atomic_load_explicit(&kmip_hash_seed, memory_order_relaxed);
+    if(seed == 0)
+    {
+        /* Threads racing to seed all settle on the first seed stored. */
+        uint64 generated = kmip_generate_hash_seed();
+        if(atomic_compare_exchange_strong(&kmip_hash_seed, &seed, generated))
+        {
+            seed = generated;
+        }
+    }
+    
+    return(seed);
+#endif
+}
+
+void
+kmip_set_hash_seed(uint64 seed)
+{
+    /* A zero seed draws a fresh one the next time it is needed. */
+#if defined(__STDC_NO_ATOMICS__)
+    kmip_hash_seed = seed;
+#else
+    atomic_store(&kmip_hash_seed, seed);
+#endif
+}
+
+uint64
+kmip_hash_mix(uint64 hash, uint64 value)
+{
+    hash ^= value;
+    hash *= KMIP_HASH_MULTIPLIER;
+    hash ^= hash >> 32;
+    
+    return(hash);
+}
+
+uint64
+kmip_hash_bytes(uint64 hash, const void *value, size_t size)
+{
+    const uint8 *bytes = (const uint8 *)value;
+    size_t i = 0;
+    
+    for(; i + sizeof(uint64) <= size; i += sizeof(uint64))
+    {
+        uint64 word = 0;
+        memcpy(&word, bytes + i, sizeof(uint64));
+        hash = kmip_hash_mix(hash, word);
+    }
+    
+    uint64 tail = 0;
+    for(; i < size; i++)
+    {
+        tail = (tail << 8) | bytes[i];
+    }
+    hash = kmip_hash_mix(hash, tail);
+    
+    return(kmip_hash_mix(hash, size));
+}
+
+uint64
+kmip_hash_text_string(const TextString *value)
+{
+    uint64 hash = kmip_get_hash_seed();
+    
+    if(value != NULL)
+    {
+        hash = kmip_hash_mix(hash, value->size);
+        if(value->value != NULL)
+        {
+            hash = kmip_hash_bytes(hash, value->value, value->size);
+        }
+    }
+    
+    return(hash);
+}
+
+uint64
+kmip_hash_byte_string(const ByteString *value)
+{
+    uint64 hash = kmip_get_hash_seed();
+    
+    if(value != NULL)
+    {
+        hash = kmip_hash_mix(hash, value->size);
+        if(value->value != NULL)
+        {
+            hash = kmip_hash_bytes(hash, value->value, value->size);
+        }
+    }
+    
+    return(hash);
+}
+
+uint64
+kmip_hash_fragment(const KMIPFragment *value)
+{
+    uint64 hash = kmip_get_hash_seed();
+    
+    if(value != NULL)
+    {
+        hash = kmip_hash_mix(hash, value->tag);
+        hash = kmip_hash_mix(hash, value->version);
+        hash = kmip_hash_mix(hash, value->size);
+        if(value->encoding != NULL)
+        {
+            hash = kmip_hash_bytes(hash, value->encoding, value->size);
+        }
+    }
+    
+    return(hash);
+}
+
+uint64
+kmip_hash_name(const Name *value)
+{
+    return(kmip_hash_schema(&kmip_name_schema, value));
+}
+
+uint64
+kmip_hash_protection_storage_masks(const ProtectionStorageMasks *value)
+{
+    uint64 hash = kmip_get_hash_seed();
+    
+    if(value != NULL)
+    {
+        hash = kmip_hash_mix(hash, value->masks.size);
+        for(size_t i = 0; i < value->masks.size; i++)
+        {
+            const int32 *mask = (const int32 *)kmip_vector_get(&value->masks, i);
+            if(mask != NULL)
+            {
+                hash = kmip_hash_mix(hash, (uint64)*mask);
             }
         }
     }
     
-    return(KMIP_TRUE);
+    return(hash);
+}
+
+uint64
+kmip_hash_application_specific_information(const ApplicationSpecificInformation *value)
+{
+    uint64 hash = kmip_get_hash_seed();
+    
+    if(value != NULL)
+    {
+        hash = kmip_hash_mix(hash, kmip_hash_text_string(value->application_namespace));
+        hash = kmip_hash_mix(hash, kmip_hash_text_string(value->application_data));
+    }
+    
+    return(hash);
+}
+
+uint64
+kmip_hash_attribute(const Attribute *value)
+{
+    uint64 hash = kmip_get_hash_seed();
+    
+    if(value == NULL)
+    {
+        return(hash);
+    }
+    
+    hash = kmip_hash_mix(hash, (uint64)value->type);
+    hash = kmip_hash_mix(hash, (uint64)value->index);
+    
+    if(value->value == NULL)
+    {
+        return(hash);
+    }
+    
+    switch(value->type)
+    {
+        case KMIP_ATTR_APPLICATION_SPECIFIC_INFORMATION:
+        return(kmip_hash_mix(hash, kmip_hash_application_specific_information((ApplicationSpecificInformation *)value->value)));
+    
+        case KMIP_ATTR_NAME:
+        return(kmip_hash_mix(hash, kmip_hash_name((Name *)value->value)));
+    
+        default:
+        switch(kmip_get_attribute_value_type(value->type))
+        {
+            case KMIP_TYPE_TEXT_STRING:
+            return(kmip_hash_mix(hash, kmip_hash_text_string((TextString *)value->value)));
+    
+            case KMIP_TYPE_INTEGER:
+            case KMIP_TYPE_ENUMERATION:
+            case KMIP_TYPE_BOOLEAN:
+            return(kmip_hash_mix(hash, (uint64)*(int32 *)value->value));
+    
+            case KMIP_TYPE_INTERVAL:
+            return(kmip_hash_mix(hash, *(uint32 *)value->value));
+    
+            case KMIP_TYPE_DATE_TIME:
+            return(kmip_hash_mix(hash, *(uint64 *)value->value));
+    
+            default:
+            return(hash);
+        };
+    };
 }
 
-int
-kmip_compare_symmetric_key(const SymmetricKey *a, const SymmetricKey *b)
+uint64
+kmip_hash_attributes(const Attributes *value)
 {
-    if(a != b)
+    uint64 hash = kmip_get_hash_seed();
+    
+    if(value != NULL)
     {
-        if((a == NULL) || (b == NULL))
+        void *const *items = kmip_vector_begin(&value->attribute_list);
+        hash = kmip_hash_mix(hash, value->attribute_list.size);
+        for(size_t i = 0; i < value->attribute_list.size; i++)
         {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->key_block != b->key_block)
-        {
-            if((a->key_block == NULL) || (b->key_block == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_key_block(a->key_block, b->key_block) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
+            hash = kmip_hash_mix(hash, kmip_hash_attribute((const Attribute *)items[i]));
         }
     }
     
-    return(KMIP_TRUE);
+    return(hash);
 }
 
-int
-kmip_compare_public_key(const PublicKey *a, const PublicKey *b)
+uint64
+kmip_hash_template_attribute(const TemplateAttribute *value)
 {
-    if(a != b)
+    uint64 hash = kmip_get_hash_seed();
+    
+    if(value == NULL)
     {
-        if((a == NULL) || (b == NULL))
+        return(hash);
+    }
+    
+    hash = kmip_hash_mix(hash, kmip_hash_fragment(value->fragment));
+    hash = kmip_hash_mix(hash, value->name_count);
+    hash = kmip_hash_mix(hash, value->attribute_count);
+    
+    if(value->names != NULL)
+    {
+        for(size_t i = 0; i < value->name_count; i++)
         {
-            return(KMIP_FALSE);
+            hash = kmip_hash_mix(hash, kmip_hash_name(&value->names[i]));
         }
-        
-        if(a->key_block != b->key_block)
+    }
+    
+    if(value->attributes != NULL)
+    {
+        for(size_t i = 0; i < value->attribute_count; i++)
         {
-            if((a->key_block == NULL) || (b->key_block == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_key_block(a->key_block, b->key_block) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
+            hash = kmip_hash_mix(hash, kmip_hash_attribute(&value->attributes[i]));
         }
     }
     
-    return(KMIP_TRUE);
+    return(hash);
 }
 
-int
-kmip_compare_private_key(const PrivateKey *a, const PrivateKey *b)
+uint64
+kmip_hash_protocol_version(const ProtocolVersion *value)
 {
-    if(a != b)
+    uint64 hash = kmip_get_hash_seed();
+    
+    if(value != NULL)
     {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->key_block != b->key_block)
-        {
-            if((a->key_block == NULL) || (b->key_block == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_key_block(a->key_block, b->key_block) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        hash = kmip_hash_mix(hash, (uint64)value->major);
+        hash = kmip_hash_mix(hash, (uint64)value->minor);
     }
     
-    return(KMIP_TRUE);
+    return(hash);
 }
 
-int
-kmip_compare_key_wrapping_specification(const KeyWrappingSpecification *a, const KeyWrappingSpecification *b)
+uint64
+kmip_hash_cryptographic_parameters(const CryptographicParameters *value)
 {
-    if(a != b)
+    return(kmip_hash_schema(&kmip_cryptographic_parameters_schema, value));
+}
+
+uint64
+kmip_hash_encryption_key_information(const EncryptionKeyInformation *value)
+{
+    return(kmip_hash_schema(&kmip_encryption_key_information_schema, value));
+}
+
+uint64
+kmip_hash_mac_signature_key_information(const MACSignatureKeyInformation *value)
+{
+    return(kmip_hash_schema(&kmip_mac_signature_key_information_schema, value));
+}
+
+uint64
+kmip_hash_key_wrapping_specification(const KeyWrappingSpecification *value)
+{
+    uint64 hash = kmip_get_hash_seed();
+    
+    if(value == NULL)
     {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->wrapping_method != b->wrapping_method)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->encoding_option != b->encoding_option)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->attribute_name_count != b->attribute_name_count)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->encryption_key_info != b->encryption_key_info)
-        {
-            if((a->encryption_key_info == NULL) || (b->encryption_key_info == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_encryption_key_information(a->encryption_key_info, b->encryption_key_info) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
-        
-        if(a->mac_signature_key_info != b->mac_signature_key_info)
+        return(hash);
+    }
+    
+    hash = kmip_hash_mix(hash, (uint64)value->wrapping_method);
+    hash = kmip_hash_mix(hash, (uint64)value->encoding_option);
+    hash = kmip_hash_mix(hash, value->attribute_name_count);
+    hash = kmip_hash_mix(hash, kmip_hash_encryption_key_information(value->encryption_key_info));
+    hash = kmip_hash_mix(hash, kmip_hash_mac_signature_key_information(value->mac_signature_key_info));
+    
+    if(value->attribute_names != NULL)
+    {
+        for(size_t i = 0; i < value->attribute_name_count; i++)
         {
-            if((a->mac_signature_key_info == NULL) || (b->mac_signature_key_info == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_mac_signature_key_information(a->mac_signature_key_info, b->mac_signature_key_info) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
+            hash = kmip_hash_mix(hash, kmip_hash_text_string(&value->attribute_names[i]));
         }
-        
-        if(a->attribute_names != b->attribute_names)
+    }
+    
+    return(hash);
+}
+
+uint64
+kmip_hash_create_request_payload(const CreateRequestPayload *value)
+{
+    uint64 hash = kmip_get_hash_seed();
+    
+    if(value != NULL)
+    {
+        hash = kmip_hash_mix(hash, (uint64)value->object_type);
+        hash = kmip_hash_mix(hash, kmip_hash_template_attribute(value->template_attribute));
+        hash = kmip_hash_mix(hash, kmip_hash_attributes(value->attributes));
+        hash = kmip_hash_mix(hash, kmip_hash_protection_storage_masks(value->protection_storage_masks));
+    }
+    
+    return(hash);
+}
+
+uint64
+kmip_hash_get_request_payload(const GetRequestPayload *value)
+{
+    uint64 hash = kmip_get_hash_seed();
+    
+    if(value != NULL)
+    {
+        hash = kmip_hash_mix(hash, (uint64)value->key_format_type);
+        hash = kmip_hash_mix(hash, (uint64)value->key_compression_type);
+        hash = kmip_hash_mix(hash, (uint64)value->key_wrap_type);
+        hash = kmip_hash_mix(hash, kmip_hash_text_string(value->unique_identifier));
+        hash = kmip_hash_mix(hash, kmip_hash_key_wrapping_specification(value->key_wrapping_spec));
+    }
+    
+    return(hash);
+}
+
+uint64
+kmip_hash_destroy_request_payload(const DestroyRequestPayload *value)
+{
+    return(kmip_hash_schema(&kmip_destroy_request_payload_schema, value));
+}
+
+uint64
+kmip_hash_request_batch_item(const RequestBatchItem *value)
+{
+    uint64 hash = kmip_get_hash_seed();
+    
+    if(value == NULL)
+    {
+        return(hash);
+    }
+    
+    hash = kmip_hash_mix(hash, (uint64)value->operation);
+    hash = kmip_hash_mix(hash, (uint64)value->ephemeral);
+    hash = kmip_hash_mix(hash, kmip_hash_byte_string(value->unique_batch_item_id));
+    
+    if(value->request_payload != NULL)
+    {
+        switch(value->operation)
         {
-            if((a->attribute_names == NULL) || (b->attribute_names == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            for(size_t i = 0; i < a->attribute_name_count; i++)
-            {
-                if(kmip_compare_text_string(&a->attribute_names[i], &b->attribute_names[i]) == KMIP_FALSE)
-                {
-                    return(KMIP_FALSE);
-                }
-            }
+            case KMIP_OP_CREATE:
+            hash = kmip_hash_mix(hash, kmip_hash_create_request_payload((CreateRequestPayload *)value->request_payload));
+            break;
+    
+            case KMIP_OP_GET:
+            hash = kmip_hash_mix(hash, kmip_hash_get_request_payload((GetRequestPayload *)value->request_payload));
+            break;
+    
+            case KMIP_OP_DESTROY:
+            hash = kmip_hash_mix(hash, kmip_hash_destroy_request_payload((DestroyRequestPayload *)value->request_payload));
+            break;
+    
+            default:
+            break;
+        };
+    }
+    
+    return(hash);
+}
+
+uint64
+kmip_hash_credential_value(enum credential_type type, const void *value)
+{
+    switch(type)
+    {
+        case KMIP_CRED_USERNAME_AND_PASSWORD:
+        return(kmip_hash_schema(&kmip_username_password_credential_schema, value));
+    
+        case KMIP_CRED_DEVICE:
+        return(kmip_hash_schema(&kmip_device_credential_schema, value));
+    
+        case KMIP_CRED_ATTESTATION:
+        return(kmip_hash_schema(&kmip_attestation_credential_schema, value));
+    
+        default:
+        return(kmip_get_hash_seed());
+    };
+}
+
+uint64
+kmip_hash_credential(const Credential *value)
+{
+    uint64 hash = kmip_get_hash_seed();
+    
+    if(value != NULL)
+    {
+        hash = kmip_hash_mix(hash, (uint64)value->credential_type);
+        hash = kmip_hash_mix(hash, kmip_hash_credential_value(value->credential_type, value->credential_value));
+    }
+    
+    return(hash);
+}
+
+uint64
+kmip_hash_authentication(const Authentication *value)
+{
+    uint64 hash = kmip_get_hash_seed();
+    
+    if(value != NULL)
+    {
+        hash = kmip_hash_mix(hash, kmip_hash_fragment(value->fragment));
+        hash = kmip_hash_mix(hash, kmip_hash_credential(value->credential));
+    }
+    
+    return(hash);
+}
+
+uint64
+kmip_hash_request_header(const RequestHeader *value)
+{
+    uint64 hash = kmip_get_hash_seed();
+    
+    if(value == NULL)
+    {
+        return(hash);
+    }
+    
+    hash = kmip_hash_mix(hash, (uint64)value->maximum_response_size);
+    hash = kmip_hash_mix(hash, (uint64)value->asynchronous_indicator);
+    hash = kmip_hash_mix(hash, (uint64)value->batch_error_continuation_option);
+    hash = kmip_hash_mix(hash, (uint64)value->batch_order_option);
+    hash = kmip_hash_mix(hash, value->time_stamp);
+    hash = kmip_hash_mix(hash, (uint64)value->batch_count);
+    hash = kmip_hash_mix(hash, (uint64)value->attestation_capable_indicator);
+    hash = kmip_hash_mix(hash, value->attestation_type_count);
+    hash = kmip_hash_mix(hash, kmip_hash_protocol_version(value->protocol_version));
+    hash = kmip_hash_mix(hash, kmip_hash_authentication(value->authentication));
+    
+    if(value->attestation_types != NULL)
+    {
+        for(size_t i = 0; i < value->attestation_type_count; i++)
+        {
+            hash = kmip_hash_mix(hash, (uint64)value->attestation_types[i]);
         }
     }
     
-    return(KMIP_TRUE);
+    hash = kmip_hash_mix(hash, kmip_hash_text_string(value->client_correlation_value));
+    hash = kmip_hash_mix(hash, kmip_hash_text_string(value->server_correlation_value));
+    
+    return(hash);
 }
 
-int
-kmip_compare_create_request_payload(const CreateRequestPayload *a, const CreateRequestPayload *b)
+uint64
+kmip_hash_request_message(const RequestMessage *value)
 {
-    if(a != b)
+    uint64 hash = kmip_get_hash_seed();
+    
+    if(value == NULL)
     {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->object_type != b->object_type)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->template_attribute != b->template_attribute)
+        return(hash);
+    }
+    
+    hash = kmip_hash_mix(hash, value->batch_count);
+    hash = kmip_hash_mix(hash, kmip_hash_request_header(value->request_header));
+    
+    if(value->batch_items != NULL)
+    {
+        for(size_t i = 0; i < value->batch_count; i++)
         {
-            if((a->template_attribute == NULL) || (b->template_attribute == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_template_attribute(a->template_attribute, b->template_attribute) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
+            hash = kmip_hash_mix(hash, kmip_hash_request_batch_item(&value->batch_items[i]));
         }
+    }
+    
+    return(hash);
+}
 
-        if(a->attributes != b->attributes)
-        {
-            if((a->attributes == NULL) || (b->attributes == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-
-            if(kmip_compare_attributes(a->attributes, b->attributes) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+/*
+Sizing Functions
+*/
 
-        if(a->protection_storage_masks != b->protection_storage_masks)
-        {
-            if((a->protection_storage_masks == NULL) || (b->protection_storage_masks == NULL))
-            {
-                return(KMIP_FALSE);
-            }
+/* NOTE (ph) Each sizing function mirrors its encoding counterpart and */
+/* returns the exact number of bytes the encoder will write, including */
+/* the 8-byte tag/type/length header and any trailing padding. Values  */
+/* the encoder cannot handle contribute 0 bytes; the encoder will      */
+/* report the actual error.                                            */
 
-            if(kmip_compare_protection_storage_masks(a->protection_storage_masks, b->protection_storage_masks) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+size_t
+kmip_size_text_string(const TextString *value)
+{
+    if(value == NULL)
+    {
+        return(0);
     }
     
-    return(KMIP_TRUE);
+    return(8 + value->size + CALCULATE_PADDING(value->size));
 }
 
-int
-kmip_compare_create_response_payload(const CreateResponsePayload *a, const CreateResponsePayload *b)
+size_t
+kmip_size_byte_string(const ByteString *value)
 {
-    if(a != b)
+    if(value == NULL)
     {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->object_type != b->object_type)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->unique_identifier != b->unique_identifier)
-        {
-            if((a->unique_identifier == NULL) || (b->unique_identifier == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_text_string(a->unique_identifier, b->unique_identifier) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
-        
-        if(a->template_attribute != b->template_attribute)
-        {
-            if((a->template_attribute == NULL) || (b->template_attribute == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_template_attribute(a->template_attribute, b->template_attribute) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        return(0);
     }
     
-    return(KMIP_TRUE);
+    return(8 + value->size + CALCULATE_PADDING(value->size));
 }
 
-int
-kmip_compare_get_request_payload(const GetRequestPayload *a, const GetRequestPayload *b)
+size_t
+kmip_size_name(KMIP *ctx, const Name *value)
 {
-    if(a != b)
+    return(kmip_size_schema(ctx, &kmip_name_schema, value));
+}
+
+size_t
+kmip_size_attribute_name(KMIP *ctx, enum attribute_type value)
+{
+    (void)ctx;
+    
+    size_t length = 0;
+    if(kmip_get_attribute_name(value, &length) == NULL)
     {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->key_format_type != b->key_format_type)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->key_compression_type != b->key_compression_type)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->key_wrap_type != b->key_wrap_type)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->unique_identifier != b->unique_identifier)
-        {
-            if((a->unique_identifier == NULL) || (b->unique_identifier == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_text_string(a->unique_identifier, b->unique_identifier) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
-        
-        if(a->key_wrapping_spec != b->key_wrapping_spec)
-        {
-            if((a->key_wrapping_spec == NULL) || (b->key_wrapping_spec == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_key_wrapping_specification(a->key_wrapping_spec, b->key_wrapping_spec) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        return(0);
     }
     
-    return(KMIP_TRUE);
+    return(8 + length + CALCULATE_PADDING(length));
 }
 
-int
-kmip_compare_get_response_payload(const GetResponsePayload *a, const GetResponsePayload *b)
+size_t
+kmip_size_attribute_value(KMIP *ctx, const Attribute *value)
 {
-    if(a != b)
+    if(value == NULL)
     {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
+        return(0);
+    }
+    
+    switch(value->type)
+    {
+        case KMIP_ATTR_APPLICATION_SPECIFIC_INFORMATION:
+        return(kmip_size_application_specific_information(ctx, (ApplicationSpecificInformation*)value->value));
+        break;
         
-        if(a->object_type != b->object_type)
-        {
-            return(KMIP_FALSE);
-        }
+        case KMIP_ATTR_UNIQUE_IDENTIFIER:
+        case KMIP_ATTR_OPERATION_POLICY_NAME:
+        return(kmip_size_text_string((TextString*)value->value));
+        break;
         
-        if(a->unique_identifier != b->unique_identifier)
-        {
-            if((a->unique_identifier == NULL) || (b->unique_identifier == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_text_string(a->unique_identifier, b->unique_identifier) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        case KMIP_ATTR_NAME:
+        return(kmip_size_name(ctx, (Name*)value->value));
+        break;
         
-        if(a->object != b->object)
+        case KMIP_ATTR_OBJECT_TYPE:
+        case KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM:
+        case KMIP_ATTR_CRYPTOGRAPHIC_LENGTH:
+        case KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK:
+        case KMIP_ATTR_STATE:
+        return(16);
+        break;
+        
+        default:
+        switch(kmip_get_attribute_value_type(value->type))
         {
-            switch(a->object_type)
-            {
-                case KMIP_OBJTYPE_SYMMETRIC_KEY:
-                if(kmip_compare_symmetric_key((SymmetricKey *)a->object, (SymmetricKey *)b->object) == KMIP_FALSE)
-                {
-                    return(KMIP_FALSE);
-                }
-                break;
-                
-                case KMIP_OBJTYPE_PUBLIC_KEY:
-                if(kmip_compare_public_key((PublicKey *)a->object, (PublicKey *)b->object) == KMIP_FALSE)
-                {
-                    return(KMIP_FALSE);
-                }
-                break;
-                
-                case KMIP_OBJTYPE_PRIVATE_KEY:
-                if(kmip_compare_private_key((PrivateKey *)a->object, (PrivateKey *)b->object) == KMIP_FALSE)
-                {
-                    return(KMIP_FALSE);
-                }
-                break;
-                
-                default:
-                /* NOTE (ph) Unsupported types cannot be compared. */
-                return(KMIP_FALSE);
-                break;
-            };
-        }
-    }
-    
-    return(KMIP_TRUE);
+            case KMIP_TYPE_TEXT_STRING:
+            return(kmip_size_text_string((TextString*)value->value));
+            break;
+            
+            case KMIP_TYPE_INTEGER:
+            case KMIP_TYPE_ENUMERATION:
+            case KMIP_TYPE_BOOLEAN:
+            case KMIP_TYPE_DATE_TIME:
+            case KMIP_TYPE_INTERVAL:
+            return(16);
+            break;
+            
+            default:
+            return(0);
+            break;
+        };
+        break;
+    };
 }
 
-int
-kmip_compare_destroy_request_payload(const DestroyRequestPayload *a, const DestroyRequestPayload *b)
+size_t
+kmip_size_attribute_v1(KMIP *ctx, const Attribute *value)
 {
-    if(a != b)
+    if(value == NULL)
     {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->unique_identifier != b->unique_identifier)
-        {
-            if((a->unique_identifier == NULL) || (b->unique_identifier == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_text_string(a->unique_identifier, b->unique_identifier) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        return(0);
     }
     
-    return(KMIP_TRUE);
+    size_t size = 8;
+    
+    size += kmip_size_attribute_name(ctx, value->type);
+    
+    if(value->index != KMIP_UNSET)
+    {
+        size += 16;
+    }
+    
+    size += kmip_size_attribute_value(ctx, value);
+    
+    return(size);
 }
 
-int
-kmip_compare_destroy_response_payload(const DestroyResponsePayload *a, const DestroyResponsePayload *b)
+size_t
+kmip_size_attribute_v2(KMIP *ctx, const Attribute *value)
 {
-    if(a != b)
+    return(kmip_size_attribute_value(ctx, value));
+}
+
+size_t
+kmip_size_attribute(KMIP *ctx, const Attribute *value)
+{
+    if(ctx == NULL || value == NULL)
     {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->unique_identifier != b->unique_identifier)
-        {
-            if((a->unique_identifier == NULL) || (b->unique_identifier == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_text_string(a->unique_identifier, b->unique_identifier) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        return(0);
     }
     
-    return(KMIP_TRUE);
+    if(ctx->version < KMIP_2_0)
+    {
+        return(kmip_size_attribute_v1(ctx, value));
+    }
+    else
+    {
+        return(kmip_size_attribute_v2(ctx, value));
+    }
 }
 
-int
-kmip_compare_request_batch_item(const RequestBatchItem *a, const RequestBatchItem *b)
+size_t
+kmip_size_attributes(KMIP *ctx, const Attributes *value)
 {
-    if(a != b)
+    if(value == NULL)
     {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->operation != b->operation)
-        {
-            return(KMIP_FALSE);
-        }
-
-        if(a->ephemeral != b->ephemeral)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->unique_batch_item_id != b->unique_batch_item_id)
-        {
-            if((a->unique_batch_item_id == NULL) || (b->unique_batch_item_id == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_byte_string(a->unique_batch_item_id, b->unique_batch_item_id) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
-        
-        if(a->request_payload != b->request_payload)
-        {
-            if((a->request_payload == NULL) || (b->request_payload == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            switch(a->operation)
-            {
-                case KMIP_OP_CREATE:
-                if(kmip_compare_create_request_payload((CreateRequestPayload *)a->request_payload, (CreateRequestPayload *)b->request_payload) == KMIP_FALSE)
-                {
-                    return(KMIP_FALSE);
-                }
-                break;
-                
-                case KMIP_OP_GET:
-                if(kmip_compare_get_request_payload((GetRequestPayload *)a->request_payload, (GetRequestPayload *)b->request_payload) == KMIP_FALSE)
-                {
-                    return(KMIP_FALSE);
-                }
-                break;
-                
-                case KMIP_OP_DESTROY:
-                if(kmip_compare_destroy_request_payload((DestroyRequestPayload *)a->request_payload, (DestroyRequestPayload *)b->request_payload) == KMIP_FALSE)
-                {
-                    return(KMIP_FALSE);
-                }
-                break;
-                
-                default:
-                /* NOTE (ph) Unsupported payloads cannot be compared. */
-                return(KMIP_FALSE);
-                break;
-            };
-        }
+        return(0);
     }
     
-    return(KMIP_TRUE);
+    size_t size = 8;
+    
+    void *const *end = kmip_vector_end(&value->attribute_list);
+    for(void *const *item = kmip_vector_begin(&value->attribute_list); item != end; item++)
+    {
+        size += kmip_size_attribute(ctx, (Attribute *)*item);
+    }
+    
+    return(size);
 }
 
-int
-kmip_compare_response_batch_item(const ResponseBatchItem *a, const ResponseBatchItem *b)
+size_t
+kmip_size_template_attribute(KMIP *ctx, const TemplateAttribute *value)
 {
-    if(a != b)
+    if(value == NULL)
     {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->operation != b->operation)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->result_status != b->result_status)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->result_reason != b->result_reason)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->unique_batch_item_id != b->unique_batch_item_id)
-        {
-            if((a->unique_batch_item_id == NULL) || (b->unique_batch_item_id == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_byte_string(a->unique_batch_item_id, b->unique_batch_item_id) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
-        
-        if(a->result_message != b->result_message)
-        {
-            if((a->result_message == NULL) || (b->result_message == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_text_string(a->result_message, b->result_message) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
-        
-        if(a->asynchronous_correlation_value != b->asynchronous_correlation_value)
-        {
-            if((a->asynchronous_correlation_value == NULL) || (b->asynchronous_correlation_value == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_byte_string(a->asynchronous_correlation_value, b->asynchronous_correlation_value) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
-        
-        if(a->response_payload != b->response_payload)
-        {
-            if((a->response_payload == NULL) || (b->response_payload == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            switch(a->operation)
-            {
-                case KMIP_OP_CREATE:
-                if(kmip_compare_create_response_payload((CreateResponsePayload *)a->response_payload, (CreateResponsePayload *)b->response_payload) == KMIP_FALSE)
-                {
-                    return(KMIP_FALSE);
-                }
-                break;
-                
-                case KMIP_OP_GET:
-                if(kmip_compare_get_response_payload((GetResponsePayload *)a->response_payload, (GetResponsePayload *)b->response_payload) == KMIP_FALSE)
-                {
-                    return(KMIP_FALSE);
-                }
-                break;
-                
-                case KMIP_OP_DESTROY:
-                if(kmip_compare_destroy_response_payload((DestroyResponsePayload *)a->response_payload, (DestroyResponsePayload *)b->response_payload) == KMIP_FALSE)
-                {
-                    return(KMIP_FALSE);
-                }
-                break;
-                
-                default:
-                /* NOTE (ph) Unsupported payloads cannot be compared. */
-                return(KMIP_FALSE);
-                break;
-            };
-        }
+        return(0);
+    }
+    
+    if(value->fragment != NULL)
+    {
+        return(value->fragment->size);
+    }
+    
+    size_t size = 8;
+    
+    for(size_t i = 0; i < value->name_count; i++)
+    {
+        size += kmip_size_name(ctx, &value->names[i]);
     }
     
-    return(KMIP_TRUE);
+    for(size_t i = 0; i < value->attribute_count; i++)
+    {
+        size += kmip_size_attribute(ctx, &value->attributes[i]);
+    }
+    
+    return(size);
 }
 
-int
-kmip_compare_nonce(const Nonce *a, const Nonce *b)
+size_t
+kmip_size_template_attribute_as_attributes(KMIP *ctx, const TemplateAttribute *value)
 {
-    if(a != b)
+    if(value == NULL)
     {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->nonce_id != b->nonce_id)
-        {
-            if((a->nonce_id == NULL) || (b->nonce_id == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_byte_string(a->nonce_id, b->nonce_id) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
-        
-        if(a->nonce_value != b->nonce_value)
-        {
-            if((a->nonce_value == NULL) || (b->nonce_value == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_byte_string(a->nonce_value, b->nonce_value) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        return(0);
     }
     
-    return(KMIP_TRUE);
+    if(value->fragment != NULL)
+    {
+        return(value->fragment->size);
+    }
+    
+    /* Template names have no place in an Attributes structure. */
+    size_t size = 8;
+    
+    for(size_t i = 0; i < value->attribute_count; i++)
+    {
+        size += kmip_size_attribute(ctx, &value->attributes[i]);
+    }
+    
+    return(size);
 }
 
-int
-kmip_compare_username_password_credential(const UsernamePasswordCredential *a, const UsernamePasswordCredential *b)
+size_t
+kmip_size_protocol_version(KMIP *ctx, const ProtocolVersion *value)
 {
-    if(a != b)
+    (void)ctx;
+    
+    if(value == NULL)
     {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->username != b->username)
-        {
-            if((a->username == NULL) || (b->username == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_text_string(a->username, b->username) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
-        
-        if(a->password != b->password)
-        {
-            if((a->password == NULL) || (b->password == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_text_string(a->password, b->password) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        return(0);
     }
     
-    return(KMIP_TRUE);
+    return(40);
 }
 
-int
-kmip_compare_device_credential(const DeviceCredential *a, const DeviceCredential *b)
+size_t
+kmip_size_protection_storage_masks(KMIP *ctx, const ProtectionStorageMasks *value)
 {
-    if(a != b)
+    (void)ctx;
+    
+    if(value == NULL)
     {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->device_serial_number != b->device_serial_number)
-        {
-            if((a->device_serial_number == NULL) || (b->device_serial_number == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_text_string(a->device_serial_number, b->device_serial_number) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
-        
-        if(a->password != b->password)
-        {
-            if((a->password == NULL) || (b->password == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_text_string(a->password, b->password) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
-        
-        if(a->device_identifier != b->device_identifier)
-        {
-            if((a->device_identifier == NULL) || (b->device_identifier == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_text_string(a->device_identifier, b->device_identifier) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
-        
-        if(a->network_identifier != b->network_identifier)
-        {
-            if((a->network_identifier == NULL) || (b->network_identifier == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_text_string(a->network_identifier, b->network_identifier) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
-        
-        if(a->machine_identifier != b->machine_identifier)
-        {
-            if((a->machine_identifier == NULL) || (b->machine_identifier == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_text_string(a->machine_identifier, b->machine_identifier) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
-        
-        if(a->media_identifier != b->media_identifier)
-        {
-            if((a->media_identifier == NULL) || (b->media_identifier == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_text_string(a->media_identifier, b->media_identifier) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        return(0);
     }
     
-    return(KMIP_TRUE);
+    size_t size = 8;
+    
+    size += 16 * value->masks.size;
+    
+    return(size);
 }
 
-int
-kmip_compare_attestation_credential(const AttestationCredential *a, const AttestationCredential *b)
+size_t
+kmip_size_application_specific_information(KMIP *ctx, const ApplicationSpecificInformation *value)
 {
-    if(a != b)
+    (void)ctx;
+    
+    if(value == NULL)
     {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->attestation_type != b->attestation_type)
-        {
-            return(KMIP_FALSE);
-        }
+        return(0);
+    }
+    
+    size_t size = 8;
+    
+    size += kmip_size_text_string(value->application_namespace);
+    size += kmip_size_text_string(value->application_data);
+    
+    return(size);
+}
+
+size_t
+kmip_size_cryptographic_parameters(KMIP *ctx, const CryptographicParameters *value)
+{
+    return(kmip_size_schema(ctx, &kmip_cryptographic_parameters_schema, value));
+}
+
+size_t
+kmip_size_encryption_key_information(KMIP *ctx, const EncryptionKeyInformation *value)
+{
+    return(kmip_size_schema(ctx, &kmip_encryption_key_information_schema, value));
+}
+
+size_t
+kmip_size_mac_signature_key_information(KMIP *ctx, const MACSignatureKeyInformation *value)
+{
+    return(kmip_size_schema(ctx, &kmip_mac_signature_key_information_schema, value));
+}
+
+size_t
+kmip_size_key_wrapping_data(KMIP *ctx, const KeyWrappingData *value)
+{
+    return(kmip_size_schema(ctx, &kmip_key_wrapping_data_schema, value));
+}
+
+size_t
+kmip_size_transparent_symmetric_key(KMIP *ctx, const TransparentSymmetricKey *value)
+{
+    return(kmip_size_schema(ctx, &kmip_transparent_symmetric_key_schema, value));
+}
+
+size_t
+kmip_size_key_material(KMIP *ctx, enum key_format_type format, const void *value)
+{
+    switch(format)
+    {
+        case KMIP_KEYFORMAT_RAW:
+        case KMIP_KEYFORMAT_OPAQUE:
+        case KMIP_KEYFORMAT_PKCS1:
+        case KMIP_KEYFORMAT_PKCS8:
+        case KMIP_KEYFORMAT_X509:
+        case KMIP_KEYFORMAT_EC_PRIVATE_KEY:
+        return(kmip_size_byte_string((const ByteString*)value));
+        break;
         
-        if(a->nonce != b->nonce)
-        {
-            if((a->nonce == NULL) || (b->nonce == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_nonce(a->nonce, b->nonce) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        case KMIP_KEYFORMAT_TRANS_SYMMETRIC_KEY:
+        return(kmip_size_transparent_symmetric_key(ctx, (const TransparentSymmetricKey*)value));
+        break;
         
-        if(a->attestation_measurement != b->attestation_measurement)
-        {
-            if((a->attestation_measurement == NULL) || (b->attestation_measurement == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_byte_string(a->attestation_measurement, b->attestation_measurement) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        /* TODO (ph) The rest require BigInteger support. */
         
-        if(a->attestation_assertion != b->attestation_assertion)
-        {
-            if((a->attestation_assertion == NULL) || (b->attestation_assertion == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_byte_string(a->attestation_assertion, b->attestation_assertion) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        default:
+        return(0);
+        break;
+    };
+}
+
+size_t
+kmip_size_key_value(KMIP *ctx, enum key_format_type format, const KeyValue *value)
+{
+    if(value == NULL)
+    {
+        return(0);
+    }
+    
+    size_t size = 8;
+    
+    size += kmip_size_key_material(ctx, format, value->key_material);
+    
+    for(size_t i = 0; i < value->attribute_count; i++)
+    {
+        size += kmip_size_attribute(ctx, &value->attributes[i]);
+    }
+    
+    return(size);
+}
+
+size_t
+kmip_size_key_block(KMIP *ctx, const KeyBlock *value)
+{
+    if(value == NULL)
+    {
+        return(0);
     }
     
-    return(KMIP_TRUE);
+    size_t size = 8;
+    
+    size += 16;
+    
+    if(value->key_compression_type != 0)
+    {
+        size += 16;
+    }
+    
+    if(value->key_wrapping_data != NULL)
+    {
+        size += kmip_size_byte_string((const ByteString*)value->key_value);
+    }
+    else
+    {
+        size += kmip_size_key_value(ctx, value->key_format_type, (const KeyValue*)value->key_value);
+    }
+    
+    if(value->cryptographic_algorithm != 0)
+    {
+        size += 16;
+    }
+    
+    if(value->cryptographic_length != KMIP_UNSET)
+    {
+        size += 16;
+    }
+    
+    size += kmip_size_key_wrapping_data(ctx, value->key_wrapping_data);
+    
+    return(size);
 }
 
-int
-kmip_compare_credential_value(enum credential_type type, void **a, void **b)
+size_t
+kmip_size_symmetric_key(KMIP *ctx, const SymmetricKey *value)
 {
-    if(a != b)
+    if(value == NULL)
     {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(*a != *b)
-        {
-            if((*a == NULL) || (*b == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            switch(type)
-            {
-                case KMIP_CRED_USERNAME_AND_PASSWORD:
-                if(kmip_compare_username_password_credential(*a, *b) == KMIP_FALSE)
-                {
-                    return(KMIP_FALSE);
-                }
-                break;
-                
-                case KMIP_CRED_DEVICE:
-                if(kmip_compare_device_credential(*a, *b) == KMIP_FALSE)
-                {
-                    return(KMIP_FALSE);
-                }
-                break;
-                
-                case KMIP_CRED_ATTESTATION:
-                if(kmip_compare_attestation_credential(*a, *b) == KMIP_FALSE)
-                {
-                    return(KMIP_FALSE);
-                }
-                break;
-                
-                default:
-                /* NOTE (ph) Unsupported types cannot be compared. */
-                return(KMIP_FALSE);
-                break;
-            };
-        }
+        return(0);
     }
     
-    return(KMIP_TRUE);
+    return(8 + kmip_size_key_block(ctx, value->key_block));
 }
 
-int
-kmip_compare_credential(const Credential *a, const Credential *b)
+size_t
+kmip_size_public_key(KMIP *ctx, const PublicKey *value)
 {
-    if(a != b)
+    if(value == NULL)
     {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->credential_type != b->credential_type)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->credential_value != b->credential_value)
-        {
-            if((a->credential_value == NULL) || (b->credential_value == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_credential_value(a->credential_type, (void**)&a->credential_value, (void**)&b->credential_value) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        return(0);
     }
     
-    return(KMIP_TRUE);
+    return(8 + kmip_size_key_block(ctx, value->key_block));
 }
 
-int
-kmip_compare_authentication(const Authentication *a, const Authentication *b)
+size_t
+kmip_size_private_key(KMIP *ctx, const PrivateKey *value)
 {
-    if(a != b)
+    if(value == NULL)
     {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->credential != b->credential)
-        {
-            if((a->credential == NULL) || (b->credential == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_credential(a->credential, b->credential) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        return(0);
     }
     
-    return(KMIP_TRUE);
+    return(8 + kmip_size_key_block(ctx, value->key_block));
 }
 
-int
-kmip_compare_request_header(const RequestHeader *a, const RequestHeader *b)
+size_t
+kmip_size_key_wrapping_specification(KMIP *ctx, const KeyWrappingSpecification *value)
 {
-    if(a != b)
+    if(value == NULL)
     {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->maximum_response_size != b->maximum_response_size)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->asynchronous_indicator != b->asynchronous_indicator)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->batch_error_continuation_option != b->batch_error_continuation_option)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->batch_order_option != b->batch_order_option)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->time_stamp != b->time_stamp)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->batch_count != b->batch_count)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->attestation_capable_indicator != b->attestation_capable_indicator)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->attestation_type_count != b->attestation_type_count)
-        {
-            return(KMIP_FALSE);
-        }
-        
-        if(a->protocol_version != b->protocol_version)
-        {
-            if((a->protocol_version == NULL) || (b->protocol_version == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_protocol_version(a->protocol_version, b->protocol_version) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
-        
-        if(a->authentication != b->authentication)
-        {
-            if((a->authentication == NULL) || (b->authentication == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_authentication(a->authentication, b->authentication) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
-        
-        if(a->attestation_types != b->attestation_types)
-        {
-            if((a->attestation_types == NULL) || (b->attestation_types == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            for(size_t i = 0; i < a->attestation_type_count; i++)
-            {
-                if(a->attestation_types[i] != b->attestation_types[i])
-                {
-                    return(KMIP_FALSE);
-                }
-            }
-        }
-        
-        if(a->client_correlation_value != b->client_correlation_value)
-        {
-            if((a->client_correlation_value == NULL) || (b->client_correlation_value == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_text_string(a->client_correlation_value, b->client_correlation_value) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
-        
-        if(a->server_correlation_value != b->server_correlation_value)
-        {
-            if((a->server_correlation_value == NULL) || (b->server_correlation_value == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_text_string(a->server_correlation_value, b->server_correlation_value) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        return(0);
+    }
+    
+    size_t size = 8;
+    
+    size += 16;
+    size += kmip_size_encryption_key_information(ctx, value->encryption_key_info);
+    size += kmip_size_mac_signature_key_information(ctx, value->mac_signature_key_info);
+    
+    for(size_t i = 0; i < value->attribute_name_count; i++)
+    {
+        size += kmip_size_text_string(&value->attribute_names[i]);
+    }
+    
+    if(ctx->version >= KMIP_1_1)
+    {
+        size += 16;
     }
     
-    return(KMIP_TRUE);
+    return(size);
 }
 
-int
-kmip_compare_response_header(const ResponseHeader *a, const ResponseHeader *b)
+size_t
+kmip_size_create_request_payload(KMIP *ctx, const CreateRequestPayload *value)
 {
-    if(a != b)
+    if(value == NULL)
     {
-        if((a == NULL) || (b == NULL))
+        return(0);
+    }
+    
+    size_t size = 8;
+    
+    size += 16;
+    
+    if(ctx->version < KMIP_2_0)
+    {
+        size += kmip_size_template_attribute(ctx, value->template_attribute);
+    }
+    else
+    {
+        if(value->attributes)
         {
-            return(KMIP_FALSE);
+            size += kmip_size_attributes(ctx, value->attributes);
         }
-        
-        if(a->time_stamp != b->time_stamp)
+        else if(value->template_attribute)
         {
-            return(KMIP_FALSE);
+            size += kmip_size_template_attribute_as_attributes(ctx, value->template_attribute);
         }
         
-        if(a->batch_count != b->batch_count)
+        size += kmip_size_protection_storage_masks(ctx, value->protection_storage_masks);
+    }
+    
+    return(size);
+}
+
+size_t
+kmip_size_create_response_payload(KMIP *ctx, const CreateResponsePayload *value)
+{
+    if(value == NULL)
+    {
+        return(0);
+    }
+    
+    size_t size = 8;
+    
+    size += 16;
+    size += kmip_size_text_string(value->unique_identifier);
+    
+    if(ctx->version < KMIP_2_0)
+    {
+        size += kmip_size_template_attribute(ctx, value->template_attribute);
+    }
+    
+    return(size);
+}
+
+size_t
+kmip_size_get_request_payload(KMIP *ctx, const GetRequestPayload *value)
+{
+    if(value == NULL)
+    {
+        return(0);
+    }
+    
+    size_t size = 8;
+    
+    size += kmip_size_text_string(value->unique_identifier);
+    
+    if(value->key_format_type != 0)
+    {
+        size += 16;
+    }
+    
+    if(ctx->version >= KMIP_1_4)
+    {
+        if(value->key_wrap_type != 0)
         {
-            return(KMIP_FALSE);
+            size += 16;
         }
+    }
+    
+    if(value->key_compression_type != 0)
+    {
+        size += 16;
+    }
+    
+    size += kmip_size_key_wrapping_specification(ctx, value->key_wrapping_spec);
+    
+    return(size);
+}
+
+size_t
+kmip_size_get_response_payload(KMIP *ctx, const GetResponsePayload *value)
+{
+    if(value == NULL)
+    {
+        return(0);
+    }
+    
+    size_t size = 8;
+    
+    size += 16;
+    size += kmip_size_text_string(value->unique_identifier);
+    
+    switch(value->object_type)
+    {
+        case KMIP_OBJTYPE_SYMMETRIC_KEY:
+        size += kmip_size_symmetric_key(ctx, (const SymmetricKey*)value->object);
+        break;
         
-        if(a->attestation_type_count != b->attestation_type_count)
-        {
-            return(KMIP_FALSE);
-        }
+        case KMIP_OBJTYPE_PUBLIC_KEY:
+        size += kmip_size_public_key(ctx, (const PublicKey*)value->object);
+        break;
         
-        if(a->protocol_version != b->protocol_version)
-        {
-            if((a->protocol_version == NULL) || (b->protocol_version == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_protocol_version(a->protocol_version, b->protocol_version) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        case KMIP_OBJTYPE_PRIVATE_KEY:
+        size += kmip_size_private_key(ctx, (const PrivateKey*)value->object);
+        break;
         
-        if(a->nonce != b->nonce)
-        {
-            if((a->nonce == NULL) || (b->nonce == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_nonce(a->nonce, b->nonce) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        default:
+        break;
+    };
+    
+    return(size);
+}
 
-        if(a->server_hashed_password != b->server_hashed_password)
-        {
-            if((a->server_hashed_password == NULL) || (b->server_hashed_password == NULL))
-                return(KMIP_FALSE);
+size_t
+kmip_size_destroy_request_payload(KMIP *ctx, const DestroyRequestPayload *value)
+{
+    return(kmip_size_schema(ctx, &kmip_destroy_request_payload_schema, value));
+}
 
-            if(kmip_compare_byte_string(a->server_hashed_password, b->server_hashed_password) == KMIP_FALSE)
-                return(KMIP_FALSE);
-        }
+size_t
+kmip_size_destroy_response_payload(KMIP *ctx, const DestroyResponsePayload *value)
+{
+    return(kmip_size_schema(ctx, &kmip_destroy_response_payload_schema, value));
+}
 
-        if(a->attestation_types != b->attestation_types)
+size_t
+kmip_size_nonce(KMIP *ctx, const Nonce *value)
+{
+    return(kmip_size_schema(ctx, &kmip_nonce_schema, value));
+}
+
+size_t
+kmip_size_username_password_credential(KMIP *ctx, const UsernamePasswordCredential *value)
+{
+    return(kmip_size_schema(ctx, &kmip_username_password_credential_schema, value));
+}
+
+size_t
+kmip_size_device_credential(KMIP *ctx, const DeviceCredential *value)
+{
+    return(kmip_size_schema(ctx, &kmip_device_credential_schema, value));
+}
+
+size_t
+kmip_size_attestation_credential(KMIP *ctx, const AttestationCredential *value)
+{
+    return(kmip_size_schema(ctx, &kmip_attestation_credential_schema, value));
+}
+
+size_t
+kmip_size_credential_value(KMIP *ctx, enum credential_type type, const void *value)
+{
+    switch(type)
+    {
+        case KMIP_CRED_USERNAME_AND_PASSWORD:
+        return(kmip_size_username_password_credential(ctx, (const UsernamePasswordCredential*)value));
+        break;
+        
+        case KMIP_CRED_DEVICE:
+        return(kmip_size_device_credential(ctx, (const DeviceCredential*)value));
+        break;
+        
+        case KMIP_CRED_ATTESTATION:
+        return(kmip_size_attestation_credential(ctx, (const AttestationCredential*)value));
+        break;
+        
+        default:
+        return(0);
+        break;
+    }
+}
+
+size_t
+kmip_size_credential(KMIP *ctx, const Credential *value)
+{
+    if(value == NULL)
+    {
+        return(0);
+    }
+    
+    size_t size = 8;
+    
+    size += 16;
+    size += kmip_size_credential_value(ctx, value->credential_type, value->credential_value);
+    
+    return(size);
+}
+
+size_t
+kmip_size_authentication(KMIP *ctx, const Authentication *value)
+{
+    if(value == NULL)
+    {
+        return(0);
+    }
+    
+    if(value->fragment != NULL)
+    {
+        return(value->fragment->size);
+    }
+    
+    return(8 + kmip_size_credential(ctx, value->credential));
+}
+
+size_t
+kmip_size_request_header(KMIP *ctx, const RequestHeader *value)
+{
+    if(value == NULL)
+    {
+        return(0);
+    }
+    
+    size_t size = 8;
+    
+    size += kmip_size_protocol_version(ctx, value->protocol_version);
+    
+    if(value->maximum_response_size != KMIP_UNSET)
+    {
+        size += 16;
+    }
+    
+    if(ctx->version >= KMIP_1_4)
+    {
+        size += kmip_size_text_string(value->client_correlation_value);
+        size += kmip_size_text_string(value->server_correlation_value);
+    }
+    
+    if(value->asynchronous_indicator != KMIP_UNSET)
+    {
+        size += 16;
+    }
+    
+    if(ctx->version >= KMIP_1_2)
+    {
+        if(value->attestation_capable_indicator != KMIP_UNSET)
         {
-            if((a->attestation_types == NULL) || (b->attestation_types == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            for(size_t i = 0; i < a->attestation_type_count; i++)
-            {
-                if(a->attestation_types[i] != b->attestation_types[i])
-                {
-                    return(KMIP_FALSE);
-                }
-            }
+            size += 16;
         }
         
-        if(a->client_correlation_value != b->client_correlation_value)
+        size += 16 * value->attestation_type_count;
+    }
+    
+    size += kmip_size_authentication(ctx, value->authentication);
+    
+    if(value->batch_error_continuation_option != 0)
+    {
+        size += 16;
+    }
+    
+    if(value->batch_order_option != KMIP_UNSET)
+    {
+        size += 16;
+    }
+    
+    if(value->time_stamp != 0)
+    {
+        size += 16;
+    }
+    
+    size += 16;
+    
+    return(size);
+}
+
+size_t
+kmip_size_response_header(KMIP *ctx, const ResponseHeader *value)
+{
+    if(value == NULL)
+    {
+        return(0);
+    }
+    
+    size_t size = 8;
+    
+    size += kmip_size_protocol_version(ctx, value->protocol_version);
+    size += 16;
+    
+    if(ctx->version >= KMIP_1_2)
+    {
+        size += kmip_size_nonce(ctx, value->nonce);
+        
+        if(ctx->version >= KMIP_2_0)
         {
-            if((a->client_correlation_value == NULL) || (b->client_correlation_value == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_text_string(a->client_correlation_value, b->client_correlation_value) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
+            size += kmip_size_byte_string(value->server_hashed_password);
         }
         
-        if(a->server_correlation_value != b->server_correlation_value)
-        {
-            if((a->server_correlation_value == NULL) || (b->server_correlation_value == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_text_string(a->server_correlation_value, b->server_correlation_value) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        size += 16 * value->attestation_type_count;
     }
     
-    return(KMIP_TRUE);
+    if(ctx->version >= KMIP_1_4)
+    {
+        size += kmip_size_text_string(value->client_correlation_value);
+        size += kmip_size_text_string(value->server_correlation_value);
+    }
+    
+    size += 16;
+    
+    return(size);
 }
 
-int
-kmip_compare_request_message(const RequestMessage *a, const RequestMessage *b)
+size_t
+kmip_size_request_batch_item(KMIP *ctx, const RequestBatchItem *value)
 {
-    if(a != b)
+    if(value == NULL)
     {
-        if((a == NULL) || (b == NULL))
+        return(0);
+    }
+    
+    size_t size = 8;
+    
+    size += 16;
+    
+    if(ctx->version >= KMIP_2_0)
+    {
+        if(value->ephemeral != KMIP_UNSET)
         {
-            return(KMIP_FALSE);
+            size += 16;
         }
+    }
+    
+    size += kmip_size_byte_string(value->unique_batch_item_id);
+    
+    switch(value->operation)
+    {
+        case KMIP_OP_CREATE:
+        size += kmip_size_create_request_payload(ctx, (const CreateRequestPayload*)value->request_payload);
+        break;
         
-        if(a->batch_count != b->batch_count)
-        {
-            return(KMIP_FALSE);
-        }
+        case KMIP_OP_GET:
+        size += kmip_size_get_request_payload(ctx, (const GetRequestPayload*)value->request_payload);
+        break;
         
-        if(a->request_header != b->request_header)
-        {
-            if((a->request_header == NULL) || (b->request_header == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_request_header(a->request_header, b->request_header) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        case KMIP_OP_DESTROY:
+        size += kmip_size_destroy_request_payload(ctx, (const DestroyRequestPayload*)value->request_payload);
+        break;
         
-        if(a->batch_items != b->batch_items)
-        {
-            if((a->batch_items == NULL) || (b->batch_items == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            for(size_t i = 0; i < a->batch_count; i++)
-            {
-                if(kmip_compare_request_batch_item(&a->batch_items[i], &b->batch_items[i]) == KMIP_FALSE)
-                {
-                    return(KMIP_FALSE);
-                }
-            }
-        }
-    }
+        default:
+        break;
+    };
     
-    return(KMIP_TRUE);
+    return(size);
 }
 
-int
-kmip_compare_response_message(const ResponseMessage *a, const ResponseMessage *b)
+size_t
+kmip_size_response_batch_item(KMIP *ctx, const ResponseBatchItem *value)
 {
-    if(a != b)
+    if(value == NULL)
     {
-        if((a == NULL) || (b == NULL))
-        {
-            return(KMIP_FALSE);
-        }
+        return(0);
+    }
+    
+    size_t size = 8;
+    
+    size += 16;
+    size += kmip_size_byte_string(value->unique_batch_item_id);
+    size += 16;
+    
+    if(value->result_reason != 0)
+    {
+        size += 16;
+    }
+    
+    size += kmip_size_text_string(value->result_message);
+    size += kmip_size_byte_string(value->asynchronous_correlation_value);
+    
+    switch(value->operation)
+    {
+        case KMIP_OP_CREATE:
+        size += kmip_size_create_response_payload(ctx, (const CreateResponsePayload*)value->response_payload);
+        break;
         
-        if(a->batch_count != b->batch_count)
-        {
-            return(KMIP_FALSE);
-        }
+        case KMIP_OP_GET:
+        size += kmip_size_get_response_payload(ctx, (const GetResponsePayload*)value->response_payload);
+        break;
         
-        if(a->response_header != b->response_header)
-        {
-            if((a->response_header == NULL) || (b->response_header == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            if(kmip_compare_response_header(a->response_header, b->response_header) == KMIP_FALSE)
-            {
-                return(KMIP_FALSE);
-            }
-        }
+        case KMIP_OP_DESTROY:
+        size += kmip_size_destroy_response_payload(ctx, (const DestroyResponsePayload*)value->response_payload);
+        break;
         
-        if(a->batch_items != b->batch_items)
-        {
-            if((a->batch_items == NULL) || (b->batch_items == NULL))
-            {
-                return(KMIP_FALSE);
-            }
-            
-            for(size_t i = 0; i < a->batch_count; i++)
-            {
-                if(kmip_compare_response_batch_item(&a->batch_items[i], &b->batch_items[i]) == KMIP_FALSE)
-                {
-                    return(KMIP_FALSE);
-                }
-            }
-        }
+        default:
+        break;
+    };
+    
+    return(size);
+}
+
+size_t
+kmip_size_request_message(KMIP *ctx, const RequestMessage *value)
+{
+    if(ctx == NULL || value == NULL)
+    {
+        return(0);
     }
     
-    return(KMIP_TRUE);
+    size_t size = 8;
+    
+    size += kmip_size_request_header(ctx, value->request_header);
+    
+    for(size_t i = 0; i < value->batch_count; i++)
+    {
+        size += kmip_size_request_batch_item(ctx, &value->batch_items[i]);
+    }
+    
+    return(size);
+}
+
+size_t
+kmip_size_response_message(KMIP *ctx, const ResponseMessage *value)
+{
+    if(ctx == NULL || value == NULL)
+    {
+        return(0);
+    }
+    
+    size_t size = 8;
+    
+    size += kmip_size_response_header(ctx, value->response_header);
+    
+    for(size_t i = 0; i < value->batch_count; i++)
+    {
+        size += kmip_size_response_batch_item(ctx, &value->batch_items[i]);
+    }
+    
+    return(size);
 }
 
 /*
@@ -8173,7 +10959,7 @@ Encoding Functions
 int
 kmip_encode_int8_be(KMIP *ctx, int8 value)
 {
-    CHECK_BUFFER_FULL(ctx, sizeof(int8));
+    CHECK_ENCODE_BUFFER(ctx, sizeof(int8));
     
     *ctx->index++ = value;
     
@@ -8183,12 +10969,10 @@ kmip_encode_int8_be(KMIP *ctx, int8 value)
 int
 kmip_encode_int32_be(KMIP *ctx, int32 value)
 {
-    CHECK_BUFFER_FULL(ctx, sizeof(int32));
+    CHECK_ENCODE_BUFFER(ctx, sizeof(int32));
     
-    *ctx->index++ = (value << 0) >> 24;
-    *ctx->index++ = (value << 8) >> 24;
-    *ctx->index++ = (value << 16) >> 24;
-    *ctx->index++ = (value << 24) >> 24;
+    kmip_store_uint32_be(ctx->index, (uint32)value);
+    ctx->index += sizeof(int32);
     
     return(KMIP_OK);
 }
@@ -8196,16 +10980,10 @@ kmip_encode_int32_be(KMIP *ctx, int32 value)
 int
 kmip_encode_int64_be(KMIP *ctx, int64 value)
 {
-    CHECK_BUFFER_FULL(ctx, sizeof(int64));
+    CHECK_ENCODE_BUFFER(ctx, sizeof(int64));
     
-    *ctx->index++ = (value << 0) >> 56;
-    *ctx->index++ = (value << 8) >> 56;
-    *ctx->index++ = (value << 16) >> 56;
-    *ctx->index++ = (value << 24) >> 56;
-    *ctx->index++ = (value << 32) >> 56;
-    *ctx->index++ = (value << 40) >> 56;
-    *ctx->index++ = (value << 48) >> 56;
-    *ctx->index++ = (value << 56) >> 56;
+    kmip_store_uint64_be(ctx->index, (uint64)value);
+    ctx->index += sizeof(int64);
     
     return(KMIP_OK);
 }
@@ -8213,7 +10991,7 @@ kmip_encode_int64_be(KMIP *ctx, int64 value)
 int
 kmip_encode_integer(KMIP *ctx, enum tag t, int32 value)
 {
-    CHECK_BUFFER_FULL(ctx, 16);
+    CHECK_ENCODE_BUFFER(ctx, 16);
     
     kmip_encode_int32_be(ctx, TAG_TYPE(t, KMIP_TYPE_INTEGER));
     kmip_encode_int32_be(ctx, 4);
@@ -8226,7 +11004,7 @@ kmip_encode_integer(KMIP *ctx, enum tag t, int32 value)
 int
 kmip_encode_long(KMIP *ctx, enum tag t, int64 value)
 {
-    CHECK_BUFFER_FULL(ctx, 16);
+    CHECK_ENCODE_BUFFER(ctx, 16);
     
     kmip_encode_int32_be(ctx, TAG_TYPE(t, KMIP_TYPE_LONG_INTEGER));
     kmip_encode_int32_be(ctx, 8);
@@ -8238,7 +11016,7 @@ kmip_encode_long(KMIP *ctx, enum tag t, int64 value)
 int
 kmip_encode_enum(KMIP *ctx, enum tag t, int32 value)
 {
-    CHECK_BUFFER_FULL(ctx, 16);
+    CHECK_ENCODE_BUFFER(ctx, 16);
     
     kmip_encode_int32_be(ctx, TAG_TYPE(t, KMIP_TYPE_ENUMERATION));
     kmip_encode_int32_be(ctx, 4);
@@ -8251,7 +11029,7 @@ kmip_encode_enum(KMIP *ctx, enum tag t, int32 value)
 int
 kmip_encode_bool(KMIP *ctx, enum tag t, bool32 value)
 {
-    CHECK_BUFFER_FULL(ctx, 16);
+    CHECK_ENCODE_BUFFER(ctx, 16);
     
     kmip_encode_int32_be(ctx, TAG_TYPE(t, KMIP_TYPE_BOOLEAN));
     kmip_encode_int32_be(ctx, 8);
@@ -8266,19 +11044,18 @@ kmip_encode_text_string(KMIP *ctx, enum tag t, const TextString *value)
 {
     /* TODO (ph) What if value is NULL? */
     uint8 padding = (8 - (value->size % 8)) % 8;
-    CHECK_BUFFER_FULL(ctx, 8 + value->size + padding);
+    CHECK_ENCODE_BUFFER(ctx, 8 + value->size + padding);
     
     kmip_encode_int32_be(ctx, TAG_TYPE(t, KMIP_TYPE_TEXT_STRING));
     kmip_encode_int32_be(ctx, value->size);
     
-    for(uint32 i = 0; i < value->size; i++)
+    if(value->size > 0)
     {
-        kmip_encode_int8_be(ctx, value->value[i]);
-    }
-    for(uint8 i = 0; i < padding; i++)
-    {
-        kmip_encode_int8_be(ctx, 0);
+        memcpy(ctx->index, value->value, value->size);
+        ctx->index += value->size;
     }
+    memset(ctx->index, 0, padding);
+    ctx->index += padding;
     
     return(KMIP_OK);
 }
@@ -8287,19 +11064,18 @@ int
 kmip_encode_byte_string(KMIP *ctx, enum tag t, const ByteString *value)
 {
     uint8 padding = (8 - (value->size % 8)) % 8;
-    CHECK_BUFFER_FULL(ctx, 8 + value->size + padding);
+    CHECK_ENCODE_BUFFER(ctx, 8 + value->size + padding);
     
     kmip_encode_int32_be(ctx, TAG_TYPE(t, KMIP_TYPE_BYTE_STRING));
     kmip_encode_int32_be(ctx, value->size);
     
-    for(uint32 i = 0; i < value->size; i++)
-    {
-        kmip_encode_int8_be(ctx, value->value[i]);
-    }
-    for(uint8 i = 0; i < padding; i++)
+    if(value->size > 0)
     {
-        kmip_encode_int8_be(ctx, 0);
+        memcpy(ctx->index, value->value, value->size);
+        ctx->index += value->size;
     }
+    memset(ctx->index, 0, padding);
+    ctx->index += padding;
     
     return(KMIP_OK);
 }
@@ -8307,7 +11083,7 @@ kmip_encode_byte_string(KMIP *ctx, enum tag t, const ByteString *value)
 int
 kmip_encode_date_time(KMIP *ctx, enum tag t, uint64 value)
 {
-    CHECK_BUFFER_FULL(ctx, 16);
+    CHECK_ENCODE_BUFFER(ctx, 16);
     
     kmip_encode_int32_be(ctx, TAG_TYPE(t, KMIP_TYPE_DATE_TIME));
     kmip_encode_int32_be(ctx, 8);
@@ -8319,7 +11095,7 @@ kmip_encode_date_time(KMIP *ctx, enum tag t, uint64 value)
 int
 kmip_encode_interval(KMIP *ctx, enum tag t, uint32 value)
 {
-    CHECK_BUFFER_FULL(ctx, 16);
+    CHECK_ENCODE_BUFFER(ctx, 16);
     
     kmip_encode_int32_be(ctx, TAG_TYPE(t, KMIP_TYPE_INTERVAL));
     kmip_encode_int32_be(ctx, 4);
@@ -8332,30 +11108,9 @@ kmip_encode_interval(KMIP *ctx, enum tag t, uint32 value)
 int
 kmip_encode_name(KMIP *ctx, const Name *value)
 {
-    /* TODO (ph) Check for value == NULL? */
-    
-    int result = 0;
-    
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_NAME, KMIP_TYPE_STRUCTURE));
-    CHECK_RESULT(ctx, result);
-    
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
-    
-    result = kmip_encode_text_string(ctx, KMIP_TAG_NAME_VALUE, value->value);
-    CHECK_RESULT(ctx, result);
-    
-    result = kmip_encode_enum(ctx, KMIP_TAG_NAME_TYPE, value->type);
-    CHECK_RESULT(ctx, result);
-    
-    uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
-    
-    result = kmip_encode_int32_be(ctx, curr_index - value_index);
+    int result = kmip_encode_schema(ctx, &kmip_name_schema, value);
     CHECK_RESULT(ctx, result);
     
-    ctx->index = curr_index;
-    
     return(KMIP_OK);
 }
 
@@ -8373,93 +11128,41 @@ kmip_encode_protection_storage_masks(KMIP *ctx, const ProtectionStorageMasks *va
     );
     CHECK_RESULT(ctx, result);
 
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
 
-    if(value->masks != NULL)
+    void *const *end = kmip_vector_end(&value->masks);
+    for(void *const *item = kmip_vector_begin(&value->masks); item != end; item++)
     {
-        LinkedListItem *curr = value->masks->head;
-        while(curr != NULL)
-        {
-            result = kmip_encode_integer(ctx, KMIP_TAG_PROTECTION_STORAGE_MASK, *(int32 *)curr->data);
-            CHECK_RESULT(ctx, result);
-
-            curr = curr->next;
-        }
+        result = kmip_encode_integer(ctx, KMIP_TAG_PROTECTION_STORAGE_MASK, *(int32 *)*item);
+        CHECK_RESULT(ctx, result);
     }
 
     uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
-
-    result = kmip_encode_int32_be(ctx, curr_index - value_index);
-    CHECK_RESULT(ctx, result);
-
-    ctx->index = curr_index;
-
-    return(KMIP_OK);
-}
+    ctx->index = ctx->buffer + length_index;
 
-int
-kmip_encode_attribute_name(KMIP *ctx, enum attribute_type value)
-{
-    int result = 0;
-    enum tag t = KMIP_TAG_ATTRIBUTE_NAME;
-    TextString attribute_name = {0};
-    
-    switch(value)
-    {
-        case KMIP_ATTR_UNIQUE_IDENTIFIER:
-        attribute_name.value = "Unique Identifier";
-        attribute_name.size = 17;
-        break;
-        
-        case KMIP_ATTR_NAME:
-        attribute_name.value = "Name";
-        attribute_name.size = 4;
-        break;
-        
-        case KMIP_ATTR_OBJECT_TYPE:
-        attribute_name.value = "Object Type";
-        attribute_name.size = 11;
-        break;
-        
-        case KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM:
-        attribute_name.value = "Cryptographic Algorithm";
-        attribute_name.size = 23;
-        break;
-        
-        case KMIP_ATTR_CRYPTOGRAPHIC_LENGTH:
-        attribute_name.value = "Cryptographic Length";
-        attribute_name.size = 20;
-        break;
-        
-        case KMIP_ATTR_OPERATION_POLICY_NAME:
-        attribute_name.value = "Operation Policy Name";
-        attribute_name.size = 21;
-        break;
-        
-        case KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK:
-        attribute_name.value = "Cryptographic Usage Mask";
-        attribute_name.size = 24;
-        break;
-        
-        case KMIP_ATTR_STATE:
-        attribute_name.value = "State";
-        attribute_name.size = 5;
-        break;
+    result = kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
+    CHECK_RESULT(ctx, result);
 
-        case KMIP_ATTR_APPLICATION_SPECIFIC_INFORMATION:
-        {
-            attribute_name.value = "Application Specific Information";
-            attribute_name.size = 32;
-        }
-        break;
-        
-        default:
+    ctx->index = curr_index;
+
+    return(KMIP_OK);
+}
+
+int
+kmip_encode_attribute_name(KMIP *ctx, enum attribute_type value)
+{
+    int result = 0;
+    enum tag t = KMIP_TAG_ATTRIBUTE_NAME;
+    TextString attribute_name = {0};
+    
+    attribute_name.value = (char *)kmip_get_attribute_name(value, &attribute_name.size);
+    if(attribute_name.value == NULL)
+    {
         kmip_push_error_frame(ctx, __func__, __LINE__);
         return(KMIP_ERROR_ATTR_UNSUPPORTED);
-        break;
-    };
+    }
     
     result = kmip_encode_text_string(ctx, t, &attribute_name);
     CHECK_RESULT(ctx, result);
@@ -8478,8 +11181,9 @@ kmip_encode_attribute_v1(KMIP *ctx, const Attribute *value)
     result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_ATTRIBUTE, KMIP_TYPE_STRUCTURE));
     CHECK_RESULT(ctx, result);
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
     
     result = kmip_encode_attribute_name(ctx, value->type);
     CHECK_RESULT(ctx, result);
@@ -8491,7 +11195,7 @@ kmip_encode_attribute_v1(KMIP *ctx, const Attribute *value)
     }
     
     uint8 *curr_index = ctx->index;
-    uint8 *tag_index = ctx->index;
+    size_t tag_index = ctx->index - ctx->buffer;
     enum tag t = KMIP_TAG_ATTRIBUTE_VALUE;
     
     switch(value->type)
@@ -8502,7 +11206,7 @@ kmip_encode_attribute_v1(KMIP *ctx, const Attribute *value)
             CHECK_RESULT(ctx, result);
 
             curr_index = ctx->index;
-            ctx->index = tag_index;
+            ctx->index = ctx->buffer + tag_index;
 
             result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_ATTRIBUTE_VALUE, KMIP_TYPE_STRUCTURE));
 
@@ -8520,7 +11224,7 @@ kmip_encode_attribute_v1(KMIP *ctx, const Attribute *value)
         CHECK_RESULT(ctx, result);
         
         curr_index = ctx->index;
-        ctx->index = tag_index;
+        ctx->index = ctx->buffer + tag_index;
         
         result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_ATTRIBUTE_VALUE, KMIP_TYPE_STRUCTURE));
         
@@ -8552,16 +11256,45 @@ kmip_encode_attribute_v1(KMIP *ctx, const Attribute *value)
         break;
         
         default:
-        kmip_push_error_frame(ctx, __func__, __LINE__);
-        return(KMIP_ERROR_ATTR_UNSUPPORTED);
+        switch(kmip_get_attribute_value_type(value->type))
+        {
+            case KMIP_TYPE_TEXT_STRING:
+            result = kmip_encode_text_string(ctx, t, (TextString*)value->value);
+            break;
+            
+            case KMIP_TYPE_INTEGER:
+            result = kmip_encode_integer(ctx, t, *(int32 *)value->value);
+            break;
+            
+            case KMIP_TYPE_ENUMERATION:
+            result = kmip_encode_enum(ctx, t, *(int32 *)value->value);
+            break;
+            
+            case KMIP_TYPE_BOOLEAN:
+            result = kmip_encode_bool(ctx, t, *(bool32 *)value->value);
+            break;
+            
+            case KMIP_TYPE_DATE_TIME:
+            result = kmip_encode_date_time(ctx, t, *(uint64 *)value->value);
+            break;
+            
+            case KMIP_TYPE_INTERVAL:
+            result = kmip_encode_interval(ctx, t, *(uint32 *)value->value);
+            break;
+            
+            default:
+            kmip_push_error_frame(ctx, __func__, __LINE__);
+            return(KMIP_ERROR_ATTR_UNSUPPORTED);
+            break;
+        };
         break;
     };
     CHECK_RESULT(ctx, result);
     
     curr_index = ctx->index;
-    ctx->index = length_index;
+    ctx->index = ctx->buffer + length_index;
     
-    result = kmip_encode_int32_be(ctx, curr_index - value_index);
+    result = kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
     CHECK_RESULT(ctx, result);
     
     ctx->index = curr_index;
@@ -8705,26 +11438,21 @@ kmip_encode_attributes(KMIP *ctx, const Attributes *value)
     );
     CHECK_RESULT(ctx, result);
 
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
 
-    if(value->attribute_list != NULL)
+    void *const *end = kmip_vector_end(&value->attribute_list);
+    for(void *const *item = kmip_vector_begin(&value->attribute_list); item != end; item++)
     {
-        LinkedListItem *curr = value->attribute_list->head;
-        while(curr != NULL)
-        {
-            Attribute *attribute = (Attribute *)curr->data;
-            result = kmip_encode_attribute(ctx, attribute);
-            CHECK_RESULT(ctx, result);
-
-            curr = curr->next;
-        }
+        result = kmip_encode_attribute(ctx, (Attribute *)*item);
+        CHECK_RESULT(ctx, result);
     }
 
     uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    ctx->index = ctx->buffer + length_index;
 
-    result = kmip_encode_int32_be(ctx, curr_index - value_index);
+    result = kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
     CHECK_RESULT(ctx, result);
 
     ctx->index = curr_index;
@@ -8737,11 +11465,20 @@ kmip_encode_template_attribute(KMIP *ctx, const TemplateAttribute *value)
 {
     int result = 0;
     
+    if(value->fragment != NULL)
+    {
+        result = kmip_encode_fragment(ctx, KMIP_TAG_TEMPLATE_ATTRIBUTE, value->fragment);
+        CHECK_RESULT(ctx, result);
+        
+        return(KMIP_OK);
+    }
+    
     result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_TEMPLATE_ATTRIBUTE, KMIP_TYPE_STRUCTURE));
     CHECK_RESULT(ctx, result);
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
     
     for(size_t i = 0; i < value->name_count; i++)
     {
@@ -8756,9 +11493,9 @@ kmip_encode_template_attribute(KMIP *ctx, const TemplateAttribute *value)
     }
     
     uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    ctx->index = ctx->buffer + length_index;
     
-    result = kmip_encode_int32_be(ctx, curr_index - value_index);
+    result = kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
     CHECK_RESULT(ctx, result);
     
     ctx->index = curr_index;
@@ -8766,23 +11503,57 @@ kmip_encode_template_attribute(KMIP *ctx, const TemplateAttribute *value)
     return(KMIP_OK);
 }
 
+int
+kmip_encode_template_attribute_as_attributes(KMIP *ctx, const TemplateAttribute *value)
+{
+    int result = KMIP_OK;
+    
+    if(value->fragment != NULL)
+    {
+        result = kmip_encode_fragment(ctx, KMIP_TAG_ATTRIBUTES, value->fragment);
+        CHECK_RESULT(ctx, result);
+        
+        return(KMIP_OK);
+    }
+    
+    /* Encoding only reads the attributes, so the vector can */
+    /* point at the template attributes instead of copies.    */
+    Attributes attributes = {0};
+    for(size_t i = 0; i < value->attribute_count && result == KMIP_OK; i++)
+    {
+        result = kmip_vector_append(ctx, &attributes.attribute_list, &value->attributes[i]);
+    }
+    
+    if(result == KMIP_OK)
+    {
+        result = kmip_encode_attributes(ctx, &attributes);
+    }
+    
+    kmip_free_vector(ctx, &attributes.attribute_list);
+    
+    CHECK_RESULT(ctx, result);
+    
+    return(KMIP_OK);
+}
+
 int
 kmip_encode_protocol_version(KMIP *ctx, const ProtocolVersion *value)
 {
-    CHECK_BUFFER_FULL(ctx, 40);
+    CHECK_ENCODE_BUFFER(ctx, 40);
     
     kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_PROTOCOL_VERSION, KMIP_TYPE_STRUCTURE));
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
     
     kmip_encode_integer(ctx, KMIP_TAG_PROTOCOL_VERSION_MAJOR, value->major);
     kmip_encode_integer(ctx, KMIP_TAG_PROTOCOL_VERSION_MINOR, value->minor);
     
     uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    ctx->index = ctx->buffer + length_index;
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
     
     ctx->index = curr_index;
     
@@ -8796,8 +11567,9 @@ kmip_encode_application_specific_information(KMIP *ctx, const ApplicationSpecifi
     result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_APPLICATION_SPECIFIC_INFORMATION, KMIP_TYPE_STRUCTURE));
     CHECK_RESULT(ctx, result);
 
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
 
     if(value->application_namespace != NULL)
     {
@@ -8827,8 +11599,8 @@ kmip_encode_application_specific_information(KMIP *ctx, const ApplicationSpecifi
     }
 
     uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    ctx->index = ctx->buffer + length_index;
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
     ctx->index = curr_index;
 
     return(KMIP_OK);
@@ -8837,268 +11609,44 @@ kmip_encode_application_specific_information(KMIP *ctx, const ApplicationSpecifi
 int
 kmip_encode_cryptographic_parameters(KMIP *ctx, const CryptographicParameters *value)
 {
-    int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_CRYPTOGRAPHIC_PARAMETERS, KMIP_TYPE_STRUCTURE));
-    CHECK_RESULT(ctx, result);
-    
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
-    
-    if(value->block_cipher_mode != 0)
-    {
-        result = kmip_encode_enum(ctx, KMIP_TAG_BLOCK_CIPHER_MODE, value->block_cipher_mode);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    if(value->padding_method != 0)
-    {
-        result = kmip_encode_enum(ctx, KMIP_TAG_PADDING_METHOD, value->padding_method);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    if(value->hashing_algorithm != 0)
-    {
-        result = kmip_encode_enum(ctx, KMIP_TAG_HASHING_ALGORITHM, value->hashing_algorithm);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    if(value->key_role_type != 0)
-    {
-        result = kmip_encode_enum(ctx, KMIP_TAG_KEY_ROLE_TYPE, value->key_role_type);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    if(ctx->version >= KMIP_1_2)
-    {
-        if(value->digital_signature_algorithm != 0)
-        {
-            result = kmip_encode_enum(ctx, KMIP_TAG_DIGITAL_SIGNATURE_ALGORITHM, value->digital_signature_algorithm);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(value->cryptographic_algorithm != 0)
-        {
-            result = kmip_encode_enum(ctx, KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM, value->cryptographic_algorithm);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(value->random_iv != KMIP_UNSET)
-        {
-            result = kmip_encode_bool(ctx, KMIP_TAG_RANDOM_IV, value->random_iv);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(value->iv_length != KMIP_UNSET)
-        {
-            result = kmip_encode_integer(ctx, KMIP_TAG_IV_LENGTH, value->iv_length);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(value->tag_length != KMIP_UNSET)
-        {
-            result = kmip_encode_integer(ctx, KMIP_TAG_TAG_LENGTH, value->tag_length);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(value->fixed_field_length != KMIP_UNSET)
-        {
-            result = kmip_encode_integer(ctx, KMIP_TAG_FIXED_FIELD_LENGTH, value->fixed_field_length);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(value->invocation_field_length != KMIP_UNSET)
-        {
-            result = kmip_encode_integer(ctx, KMIP_TAG_INVOCATION_FIELD_LENGTH, value->invocation_field_length);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(value->counter_length != KMIP_UNSET)
-        {
-            result = kmip_encode_integer(ctx, KMIP_TAG_COUNTER_LENGTH, value->counter_length);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(value->initial_counter_value != KMIP_UNSET)
-        {
-            result = kmip_encode_integer(ctx, KMIP_TAG_INITIAL_COUNTER_VALUE, value->initial_counter_value);
-            CHECK_RESULT(ctx, result);
-        }
-    }
-    
-    if(ctx->version >= KMIP_1_4)
-    {
-        if(value->salt_length != KMIP_UNSET)
-        {
-            result = kmip_encode_integer(ctx, KMIP_TAG_SALT_LENGTH, value->salt_length);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(value->mask_generator != 0)
-        {
-            result = kmip_encode_enum(ctx, KMIP_TAG_MASK_GENERATOR, value->mask_generator);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(value->mask_generator_hashing_algorithm != 0)
-        {
-            result = kmip_encode_enum(ctx, KMIP_TAG_MASK_GENERATOR_HASHING_ALGORITHM, value->mask_generator_hashing_algorithm);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(value->p_source != NULL)
-        {
-            result = kmip_encode_byte_string(ctx, KMIP_TAG_P_SOURCE, value->p_source);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(value->trailer_field != KMIP_UNSET)
-        {
-            result = kmip_encode_integer(ctx, KMIP_TAG_TRAILER_FIELD, value->trailer_field);
-            CHECK_RESULT(ctx, result);
-        }
-    }
-    
-    uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
-    
-    kmip_encode_int32_be(ctx, curr_index - value_index);
-    
-    ctx->index = curr_index;
-    
-    return(KMIP_OK);
-}
-
-int
-kmip_encode_encryption_key_information(KMIP *ctx, const EncryptionKeyInformation *value)
-{
-    int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_ENCRYPTION_KEY_INFORMATION, KMIP_TYPE_STRUCTURE));
-    CHECK_RESULT(ctx, result);
-    
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
-    
-    result = kmip_encode_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, value->unique_identifier);
-    CHECK_RESULT(ctx, result);
-    
-    if(value->cryptographic_parameters != 0)
-    {
-        result = kmip_encode_cryptographic_parameters(ctx, value->cryptographic_parameters);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
-    
-    kmip_encode_int32_be(ctx, curr_index - value_index);
-    
-    ctx->index = curr_index;
-    
-    return(KMIP_OK);
-}
-
-int
-kmip_encode_mac_signature_key_information(KMIP *ctx, const MACSignatureKeyInformation *value)
-{
-    int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_MAC_SIGNATURE_KEY_INFORMATION, KMIP_TYPE_STRUCTURE));
-    CHECK_RESULT(ctx, result);
-    
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
-    
-    result = kmip_encode_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, value->unique_identifier);
-    CHECK_RESULT(ctx, result);
-    
-    if(value->cryptographic_parameters != 0)
-    {
-        result = kmip_encode_cryptographic_parameters(ctx, value->cryptographic_parameters);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
-    
-    kmip_encode_int32_be(ctx, curr_index - value_index);
-    
-    ctx->index = curr_index;
-    
-    return(KMIP_OK);
-}
-
-int
-kmip_encode_key_wrapping_data(KMIP *ctx, const KeyWrappingData *value)
-{
-    int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_KEY_WRAPPING_DATA, KMIP_TYPE_STRUCTURE));
-    CHECK_RESULT(ctx, result);
-    
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
-    
-    result = kmip_encode_enum(ctx, KMIP_TAG_WRAPPING_METHOD, value->wrapping_method);
+    int result = kmip_encode_schema(ctx, &kmip_cryptographic_parameters_schema, value);
     CHECK_RESULT(ctx, result);
     
-    if(value->encryption_key_info != NULL)
-    {
-        result = kmip_encode_encryption_key_information(ctx, value->encryption_key_info);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    if(value->mac_signature_key_info != NULL)
-    {
-        result = kmip_encode_mac_signature_key_information(ctx, value->mac_signature_key_info);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    if(value->mac_signature != NULL)
-    {
-        result = kmip_encode_byte_string(ctx, KMIP_TAG_MAC_SIGNATURE, value->mac_signature);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    if(value->iv_counter_nonce != NULL)
-    {
-        result = kmip_encode_byte_string(ctx, KMIP_TAG_IV_COUNTER_NONCE, value->iv_counter_nonce);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    if(ctx->version >= KMIP_1_1)
-    {
-        result = kmip_encode_enum(ctx, KMIP_TAG_ENCODING_OPTION, value->encoding_option);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
-    
-    kmip_encode_int32_be(ctx, curr_index - value_index);
-    
-    ctx->index = curr_index;
-    
     return(KMIP_OK);
 }
 
 int
-kmip_encode_transparent_symmetric_key(KMIP *ctx, const TransparentSymmetricKey *value)
+kmip_encode_encryption_key_information(KMIP *ctx, const EncryptionKeyInformation *value)
 {
-    int result = 0;
-    
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_KEY_MATERIAL, KMIP_TYPE_STRUCTURE));
+    int result = kmip_encode_schema(ctx, &kmip_encryption_key_information_schema, value);
     CHECK_RESULT(ctx, result);
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
-    
-    result = kmip_encode_byte_string(ctx, KMIP_TAG_KEY, value->key);
+    return(KMIP_OK);
+}
+
+int
+kmip_encode_mac_signature_key_information(KMIP *ctx, const MACSignatureKeyInformation *value)
+{
+    int result = kmip_encode_schema(ctx, &kmip_mac_signature_key_information_schema, value);
     CHECK_RESULT(ctx, result);
     
-    uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
-    
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    return(KMIP_OK);
+}
+
+int
+kmip_encode_key_wrapping_data(KMIP *ctx, const KeyWrappingData *value)
+{
+    int result = kmip_encode_schema(ctx, &kmip_key_wrapping_data_schema, value);
+    CHECK_RESULT(ctx, result);
     
-    ctx->index = curr_index;
+    return(KMIP_OK);
+}
+
+int
+kmip_encode_transparent_symmetric_key(KMIP *ctx, const TransparentSymmetricKey *value)
+{
+    int result = kmip_encode_schema(ctx, &kmip_transparent_symmetric_key_schema, value);
+    CHECK_RESULT(ctx, result);
     
     return(KMIP_OK);
 }
@@ -9210,22 +11758,290 @@ kmip_encode_key_value(KMIP *ctx, enum key_format_type format, const KeyValue *va
     result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_KEY_VALUE, KMIP_TYPE_STRUCTURE));
     CHECK_RESULT(ctx, result);
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
     
     result = kmip_encode_key_material(ctx, format, value->key_material);
     CHECK_RESULT(ctx, result);
-    
-    for(size_t i = 0; i < value->attribute_count; i++)
+    
+    for(size_t i = 0; i < value->attribute_count; i++)
+    {
+        result = kmip_encode_attribute(ctx, &value->attributes[i]);
+        CHECK_RESULT(ctx, result);
+    }
+    
+    uint8 *curr_index = ctx->index;
+    ctx->index = ctx->buffer + length_index;
+    
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
+    
+    ctx->index = curr_index;
+    
+    return(KMIP_OK);
+}
+
+int
+kmip_encode_key_block(KMIP *ctx, const KeyBlock *value)
+{
+    int result = 0;
+    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_KEY_BLOCK, KMIP_TYPE_STRUCTURE));
+    CHECK_RESULT(ctx, result);
+    
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
+    
+    result = kmip_encode_enum(ctx, KMIP_TAG_KEY_FORMAT_TYPE, value->key_format_type);
+    CHECK_RESULT(ctx, result);
+    
+    if(value->key_compression_type != 0)
+    {
+        result = kmip_encode_enum(ctx, KMIP_TAG_KEY_COMPRESSION_TYPE, value->key_compression_type);
+        CHECK_RESULT(ctx, result);
+    }
+    
+    if(value->key_wrapping_data != NULL)
+    {
+        result = kmip_encode_byte_string(ctx, KMIP_TAG_KEY_VALUE, (ByteString*)value->key_value);
+    }
+    else
+    {
+        result = kmip_encode_key_value(ctx, value->key_format_type, (KeyValue*)value->key_value);
+    }
+    CHECK_RESULT(ctx, result);
+    
+    if(value->cryptographic_algorithm != 0)
+    {
+        result = kmip_encode_enum(ctx, KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM, value->cryptographic_algorithm);
+        CHECK_RESULT(ctx, result);
+    }
+    
+    if(value->cryptographic_length != KMIP_UNSET)
+    {
+        result = kmip_encode_integer(ctx, KMIP_TAG_CRYPTOGRAPHIC_LENGTH, value->cryptographic_length);
+        CHECK_RESULT(ctx, result);
+    }
+    
+    if(value->key_wrapping_data != NULL)
+    {
+        result = kmip_encode_key_wrapping_data(ctx, value->key_wrapping_data);
+        CHECK_RESULT(ctx, result);
+    }
+    
+    uint8 *curr_index = ctx->index;
+    ctx->index = ctx->buffer + length_index;
+    
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
+    
+    ctx->index = curr_index;
+    
+    return(KMIP_OK);
+}
+
+int
+kmip_encode_symmetric_key(KMIP *ctx, const SymmetricKey *value)
+{
+    int result = 0;
+    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_SYMMETRIC_KEY, KMIP_TYPE_STRUCTURE));
+    CHECK_RESULT(ctx, result);
+    
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
+    
+    result = kmip_encode_key_block(ctx, value->key_block);
+    CHECK_RESULT(ctx, result);
+    
+    uint8 *curr_index = ctx->index;
+    ctx->index = ctx->buffer + length_index;
+    
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
+    
+    ctx->index = curr_index;
+    
+    return(KMIP_OK);
+}
+
+int
+kmip_encode_public_key(KMIP *ctx, const PublicKey *value)
+{
+    int result = 0;
+    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_PUBLIC_KEY, KMIP_TYPE_STRUCTURE));
+    CHECK_RESULT(ctx, result);
+    
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
+    
+    result = kmip_encode_key_block(ctx, value->key_block);
+    CHECK_RESULT(ctx, result);
+    
+    uint8 *curr_index = ctx->index;
+    ctx->index = ctx->buffer + length_index;
+    
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
+    
+    ctx->index = curr_index;
+    
+    return(KMIP_OK);
+}
+
+int
+kmip_encode_private_key(KMIP *ctx, const PrivateKey *value)
+{
+    int result = 0;
+    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_PRIVATE_KEY, KMIP_TYPE_STRUCTURE));
+    CHECK_RESULT(ctx, result);
+    
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
+    
+    result = kmip_encode_key_block(ctx, value->key_block);
+    CHECK_RESULT(ctx, result);
+    
+    uint8 *curr_index = ctx->index;
+    ctx->index = ctx->buffer + length_index;
+    
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
+    
+    ctx->index = curr_index;
+    
+    return(KMIP_OK);
+}
+
+int
+kmip_encode_key_wrapping_specification(KMIP *ctx, const KeyWrappingSpecification *value)
+{
+    int result = 0;
+    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_KEY_WRAPPING_SPECIFICATION, KMIP_TYPE_STRUCTURE));
+    CHECK_RESULT(ctx, result);
+    
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
+    
+    result = kmip_encode_enum(ctx, KMIP_TAG_WRAPPING_METHOD, value->wrapping_method);
+    CHECK_RESULT(ctx, result);
+    
+    if(value->encryption_key_info != NULL)
+    {
+        result = kmip_encode_encryption_key_information(ctx, value->encryption_key_info);
+        CHECK_RESULT(ctx, result);
+    }
+    
+    if(value->mac_signature_key_info != NULL)
+    {
+        result = kmip_encode_mac_signature_key_information(ctx, value->mac_signature_key_info);
+        CHECK_RESULT(ctx, result);
+    }
+    
+    for(size_t i = 0; i < value->attribute_name_count; i++)
+    {
+        result = kmip_encode_text_string(ctx, KMIP_TAG_ATTRIBUTE_NAME, &value->attribute_names[i]);
+        CHECK_RESULT(ctx, result);
+    }
+    
+    if(ctx->version >= KMIP_1_1)
+    {
+        result = kmip_encode_enum(ctx, KMIP_TAG_ENCODING_OPTION, value->encoding_option);
+        CHECK_RESULT(ctx, result);
+    }
+    
+    uint8 *curr_index = ctx->index;
+    ctx->index = ctx->buffer + length_index;
+    
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
+    
+    ctx->index = curr_index;
+    
+    return(KMIP_OK);
+}
+
+int
+kmip_encode_create_request_payload(KMIP *ctx, const CreateRequestPayload *value)
+{
+    CHECK_ENCODE_ARGS(ctx, value);
+
+    int result = 0;
+    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_REQUEST_PAYLOAD, KMIP_TYPE_STRUCTURE));
+    CHECK_RESULT(ctx, result);
+    
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
+    
+    result = kmip_encode_enum(ctx, KMIP_TAG_OBJECT_TYPE, value->object_type);
+    CHECK_RESULT(ctx, result);
+
+    if(ctx->version < KMIP_2_0)
+    {
+        result = kmip_encode_template_attribute(ctx, value->template_attribute);
+        CHECK_RESULT(ctx, result);
+    }
+    else
+    {
+        if(value->attributes)
+        {
+            result = kmip_encode_attributes(ctx, value->attributes);
+            CHECK_RESULT(ctx, result);
+        }
+        else if(value->template_attribute)
+        {
+            result = kmip_encode_template_attribute_as_attributes(ctx, value->template_attribute);
+            CHECK_RESULT(ctx, result);
+        }
+
+        if(value->protection_storage_masks != NULL)
+        {
+            result = kmip_encode_protection_storage_masks(ctx, value->protection_storage_masks);
+            CHECK_RESULT(ctx, result);
+        }
+    }
+    
+    uint8 *curr_index = ctx->index;
+    ctx->index = ctx->buffer + length_index;
+    
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
+    
+    ctx->index = curr_index;
+    
+    return(KMIP_OK);
+}
+
+int
+kmip_encode_create_response_payload(KMIP *ctx, const CreateResponsePayload *value)
+{
+    CHECK_ENCODE_ARGS(ctx, value);
+
+    int result = 0;
+    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_RESPONSE_PAYLOAD, KMIP_TYPE_STRUCTURE));
+    CHECK_RESULT(ctx, result);
+    
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
+    
+    result = kmip_encode_enum(ctx, KMIP_TAG_OBJECT_TYPE, value->object_type);
+    CHECK_RESULT(ctx, result);
+    
+    result = kmip_encode_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, value->unique_identifier);
+    CHECK_RESULT(ctx, result);
+
+    if(ctx->version < KMIP_2_0)
     {
-        result = kmip_encode_attribute(ctx, &value->attributes[i]);
-        CHECK_RESULT(ctx, result);
+        if(value->template_attribute != NULL)
+        {
+            result = kmip_encode_template_attribute(ctx, value->template_attribute);
+            CHECK_RESULT(ctx, result);
+        }
     }
     
     uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    ctx->index = ctx->buffer + length_index;
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
     
     ctx->index = curr_index;
     
@@ -9233,56 +12049,53 @@ kmip_encode_key_value(KMIP *ctx, enum key_format_type format, const KeyValue *va
 }
 
 int
-kmip_encode_key_block(KMIP *ctx, const KeyBlock *value)
+kmip_encode_get_request_payload(KMIP *ctx, const GetRequestPayload *value)
 {
     int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_KEY_BLOCK, KMIP_TYPE_STRUCTURE));
+    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_REQUEST_PAYLOAD, KMIP_TYPE_STRUCTURE));
     CHECK_RESULT(ctx, result);
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
-    
-    result = kmip_encode_enum(ctx, KMIP_TAG_KEY_FORMAT_TYPE, value->key_format_type);
-    CHECK_RESULT(ctx, result);
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
     
-    if(value->key_compression_type != 0)
+    if(value->unique_identifier != NULL)
     {
-        result = kmip_encode_enum(ctx, KMIP_TAG_KEY_COMPRESSION_TYPE, value->key_compression_type);
+        result = kmip_encode_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, value->unique_identifier);
         CHECK_RESULT(ctx, result);
     }
     
-    if(value->key_wrapping_data != NULL)
-    {
-        result = kmip_encode_byte_string(ctx, KMIP_TAG_KEY_VALUE, (ByteString*)value->key_value);
-    }
-    else
+    if(value->key_format_type != 0)
     {
-        result = kmip_encode_key_value(ctx, value->key_format_type, (KeyValue*)value->key_value);
+        result = kmip_encode_enum(ctx, KMIP_TAG_KEY_FORMAT_TYPE, value->key_format_type);
+        CHECK_RESULT(ctx, result);
     }
-    CHECK_RESULT(ctx, result);
     
-    if(value->cryptographic_algorithm != 0)
+    if(ctx->version >= KMIP_1_4)
     {
-        result = kmip_encode_enum(ctx, KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM, value->cryptographic_algorithm);
-        CHECK_RESULT(ctx, result);
+        if(value->key_wrap_type != 0)
+        {
+            result = kmip_encode_enum(ctx, KMIP_TAG_KEY_WRAP_TYPE, value->key_wrap_type);
+            CHECK_RESULT(ctx, result);
+        }
     }
     
-    if(value->cryptographic_length != KMIP_UNSET)
+    if(value->key_compression_type != 0)
     {
-        result = kmip_encode_integer(ctx, KMIP_TAG_CRYPTOGRAPHIC_LENGTH, value->cryptographic_length);
+        result = kmip_encode_enum(ctx, KMIP_TAG_KEY_COMPRESSION_TYPE, value->key_compression_type);
         CHECK_RESULT(ctx, result);
     }
     
-    if(value->key_wrapping_data != NULL)
+    if(value->key_wrapping_spec != NULL)
     {
-        result = kmip_encode_key_wrapping_data(ctx, value->key_wrapping_data);
+        result = kmip_encode_key_wrapping_specification(ctx, value->key_wrapping_spec);
         CHECK_RESULT(ctx, result);
     }
     
     uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    ctx->index = ctx->buffer + length_index;
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
     
     ctx->index = curr_index;
     
@@ -9290,22 +12103,49 @@ kmip_encode_key_block(KMIP *ctx, const KeyBlock *value)
 }
 
 int
-kmip_encode_symmetric_key(KMIP *ctx, const SymmetricKey *value)
+kmip_encode_get_response_payload(KMIP *ctx, const GetResponsePayload *value)
 {
     int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_SYMMETRIC_KEY, KMIP_TYPE_STRUCTURE));
+    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_RESPONSE_PAYLOAD, KMIP_TYPE_STRUCTURE));
     CHECK_RESULT(ctx, result);
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
     
-    result = kmip_encode_key_block(ctx, value->key_block);
+    result = kmip_encode_enum(ctx, KMIP_TAG_OBJECT_TYPE, value->object_type);
+    CHECK_RESULT(ctx, result);
+    
+    result = kmip_encode_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, value->unique_identifier);
     CHECK_RESULT(ctx, result);
     
+    switch(value->object_type)
+    {
+        case KMIP_OBJTYPE_SYMMETRIC_KEY:
+        result = kmip_encode_symmetric_key(ctx, (const SymmetricKey*)value->object);
+        CHECK_RESULT(ctx, result);
+        break;
+        
+        case KMIP_OBJTYPE_PUBLIC_KEY:
+        result = kmip_encode_public_key(ctx, (const PublicKey*)value->object);
+        CHECK_RESULT(ctx, result);
+        break;
+        
+        case KMIP_OBJTYPE_PRIVATE_KEY:
+        result = kmip_encode_private_key(ctx, (const PrivateKey*)value->object);
+        CHECK_RESULT(ctx, result);
+        break;
+        
+        default:
+        kmip_push_error_frame(ctx, __func__, __LINE__);
+        return(KMIP_NOT_IMPLEMENTED);
+        break;
+    };
+    
     uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    ctx->index = ctx->buffer + length_index;
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
     
     ctx->index = curr_index;
     
@@ -9313,45 +12153,109 @@ kmip_encode_symmetric_key(KMIP *ctx, const SymmetricKey *value)
 }
 
 int
-kmip_encode_public_key(KMIP *ctx, const PublicKey *value)
+kmip_encode_destroy_request_payload(KMIP *ctx, const DestroyRequestPayload *value)
 {
-    int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_PUBLIC_KEY, KMIP_TYPE_STRUCTURE));
+    int result = kmip_encode_schema(ctx, &kmip_destroy_request_payload_schema, value);
     CHECK_RESULT(ctx, result);
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    return(KMIP_OK);
+}
+
+int
+kmip_encode_destroy_response_payload(KMIP *ctx, const DestroyResponsePayload *value)
+{
+    int result = kmip_encode_schema(ctx, &kmip_destroy_response_payload_schema, value);
+    CHECK_RESULT(ctx, result);
     
-    result = kmip_encode_key_block(ctx, value->key_block);
+    return(KMIP_OK);
+}
+
+int
+kmip_encode_nonce(KMIP *ctx, const Nonce *value)
+{
+    int result = kmip_encode_schema(ctx, &kmip_nonce_schema, value);
     CHECK_RESULT(ctx, result);
     
-    uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    return(KMIP_OK);
+}
+
+int
+kmip_encode_username_password_credential(KMIP *ctx, const UsernamePasswordCredential *value)
+{
+    int result = kmip_encode_schema(ctx, &kmip_username_password_credential_schema, value);
+    CHECK_RESULT(ctx, result);
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    return(KMIP_OK);
+}
+
+int
+kmip_encode_device_credential(KMIP *ctx, const DeviceCredential *value)
+{
+    int result = kmip_encode_schema(ctx, &kmip_device_credential_schema, value);
+    CHECK_RESULT(ctx, result);
     
-    ctx->index = curr_index;
+    return(KMIP_OK);
+}
+
+int
+kmip_encode_attestation_credential(KMIP *ctx, const AttestationCredential *value)
+{
+    int result = kmip_encode_schema(ctx, &kmip_attestation_credential_schema, value);
+    CHECK_RESULT(ctx, result);
     
     return(KMIP_OK);
 }
 
 int
-kmip_encode_private_key(KMIP *ctx, const PrivateKey *value)
+kmip_encode_credential_value(KMIP *ctx, enum credential_type type, void *value)
 {
     int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_PRIVATE_KEY, KMIP_TYPE_STRUCTURE));
+    
+    switch(type)
+    {
+        case KMIP_CRED_USERNAME_AND_PASSWORD:
+        result = kmip_encode_username_password_credential(ctx, (UsernamePasswordCredential*)value);
+        break;
+        
+        case KMIP_CRED_DEVICE:
+        result = kmip_encode_device_credential(ctx, (DeviceCredential*)value);
+        break;
+        
+        case KMIP_CRED_ATTESTATION:
+        result = kmip_encode_attestation_credential(ctx, (AttestationCredential*)value);
+        break;
+        
+        default:
+        kmip_push_error_frame(ctx, __func__, __LINE__);
+        return(KMIP_NOT_IMPLEMENTED);
+        break;
+    }
+    CHECK_RESULT(ctx, result);
+    
+    return(KMIP_OK);
+}
+
+int
+kmip_encode_credential(KMIP *ctx, const Credential *value)
+{
+    int result = 0;
+    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_CREDENTIAL, KMIP_TYPE_STRUCTURE));
     CHECK_RESULT(ctx, result);
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
     
-    result = kmip_encode_key_block(ctx, value->key_block);
+    result = kmip_encode_enum(ctx, KMIP_TAG_CREDENTIAL_TYPE, value->credential_type);
+    CHECK_RESULT(ctx, result);
+    
+    result = kmip_encode_credential_value(ctx, value->credential_type, value->credential_value);
     CHECK_RESULT(ctx, result);
     
     uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    ctx->index = ctx->buffer + length_index;
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
     
     ctx->index = curr_index;
     
@@ -9359,46 +12263,32 @@ kmip_encode_private_key(KMIP *ctx, const PrivateKey *value)
 }
 
 int
-kmip_encode_key_wrapping_specification(KMIP *ctx, const KeyWrappingSpecification *value)
+kmip_encode_authentication(KMIP *ctx, const Authentication *value)
 {
     int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_KEY_WRAPPING_SPECIFICATION, KMIP_TYPE_STRUCTURE));
-    CHECK_RESULT(ctx, result);
-    
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
-    
-    result = kmip_encode_enum(ctx, KMIP_TAG_WRAPPING_METHOD, value->wrapping_method);
-    CHECK_RESULT(ctx, result);
     
-    if(value->encryption_key_info != NULL)
+    if(value->fragment != NULL)
     {
-        result = kmip_encode_encryption_key_information(ctx, value->encryption_key_info);
+        result = kmip_encode_fragment(ctx, KMIP_TAG_AUTHENTICATION, value->fragment);
         CHECK_RESULT(ctx, result);
+        
+        return(KMIP_OK);
     }
     
-    if(value->mac_signature_key_info != NULL)
-    {
-        result = kmip_encode_mac_signature_key_information(ctx, value->mac_signature_key_info);
-        CHECK_RESULT(ctx, result);
-    }
+    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_AUTHENTICATION, KMIP_TYPE_STRUCTURE));
+    CHECK_RESULT(ctx, result);
     
-    for(size_t i = 0; i < value->attribute_name_count; i++)
-    {
-        result = kmip_encode_text_string(ctx, KMIP_TAG_ATTRIBUTE_NAME, &value->attribute_names[i]);
-        CHECK_RESULT(ctx, result);
-    }
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
     
-    if(ctx->version >= KMIP_1_1)
-    {
-        result = kmip_encode_enum(ctx, KMIP_TAG_ENCODING_OPTION, value->encoding_option);
-        CHECK_RESULT(ctx, result);
-    }
+    result = kmip_encode_credential(ctx, value->credential);
+    CHECK_RESULT(ctx, result);
     
     uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    ctx->index = ctx->buffer + length_index;
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
     
     ctx->index = curr_index;
     
@@ -9406,63 +12296,93 @@ kmip_encode_key_wrapping_specification(KMIP *ctx, const KeyWrappingSpecification
 }
 
 int
-kmip_encode_create_request_payload(KMIP *ctx, const CreateRequestPayload *value)
+kmip_encode_request_header(KMIP *ctx, const RequestHeader *value)
 {
-    CHECK_ENCODE_ARGS(ctx, value);
-
     int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_REQUEST_PAYLOAD, KMIP_TYPE_STRUCTURE));
+    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_REQUEST_HEADER, KMIP_TYPE_STRUCTURE));
     CHECK_RESULT(ctx, result);
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
     
-    result = kmip_encode_enum(ctx, KMIP_TAG_OBJECT_TYPE, value->object_type);
+    result = kmip_encode_protocol_version(ctx, value->protocol_version);
     CHECK_RESULT(ctx, result);
-
-    if(ctx->version < KMIP_2_0)
+    
+    /* HERE (ph) Stopped working here after bug with 0 vs KMIP_UNSET */
+    if(value->maximum_response_size != KMIP_UNSET)
     {
-        result = kmip_encode_template_attribute(ctx, value->template_attribute);
+        result = kmip_encode_integer(ctx, KMIP_TAG_MAXIMUM_RESPONSE_SIZE, value->maximum_response_size);
         CHECK_RESULT(ctx, result);
     }
-    else
+    
+    if(ctx->version >= KMIP_1_4)
     {
-        if(value->attributes)
+        if(value->client_correlation_value != NULL)
         {
-            result = kmip_encode_attributes(ctx, value->attributes);
+            result = kmip_encode_text_string(ctx, KMIP_TAG_CLIENT_CORRELATION_VALUE, value->client_correlation_value);
             CHECK_RESULT(ctx, result);
         }
-        else if(value->template_attribute)
+        
+        if(value->server_correlation_value != NULL)
         {
-            Attributes *attributes = ctx->calloc_func(ctx->state, 1, sizeof(Attributes));
-            LinkedList *list = ctx->calloc_func(ctx->state, 1, sizeof(LinkedList));
-            attributes->attribute_list = list;
-            for(size_t i = 0; i < value->template_attribute->attribute_count; i++)
-            {
-                LinkedListItem *item = ctx->calloc_func(ctx->state, 1, sizeof(LinkedListItem));
-                item->data = kmip_deep_copy_attribute(ctx, &value->template_attribute->attributes[i]);
-                kmip_linked_list_enqueue(list, item);
-            }
-
-            result = kmip_encode_attributes(ctx, attributes);
-
-            kmip_free_attributes(ctx, attributes);
-            ctx->free_func(ctx->state, attributes);
-
+            result = kmip_encode_text_string(ctx, KMIP_TAG_SERVER_CORRELATION_VALUE, value->server_correlation_value);
             CHECK_RESULT(ctx, result);
         }
-
-        if(value->protection_storage_masks != NULL)
+    }
+    
+    if(value->asynchronous_indicator != KMIP_UNSET)
+    {
+        result = kmip_encode_bool(ctx, KMIP_TAG_ASYNCHRONOUS_INDICATOR, value->asynchronous_indicator);
+        CHECK_RESULT(ctx, result);
+    }
+    
+    if(ctx->version >= KMIP_1_2)
+    {
+        if(value->attestation_capable_indicator != KMIP_UNSET)
         {
-            result = kmip_encode_protection_storage_masks(ctx, value->protection_storage_masks);
+            result = kmip_encode_bool(ctx, KMIP_TAG_ATTESTATION_CAPABLE_INDICATOR, value->attestation_capable_indicator);
+            CHECK_RESULT(ctx, result);
+        }
+        
+        for(size_t i = 0; i < value->attestation_type_count; i++)
+        {
+            result = kmip_encode_enum(ctx, KMIP_TAG_ATTESTATION_TYPE, value->attestation_types[i]);
             CHECK_RESULT(ctx, result);
         }
     }
     
+    if(value->authentication != NULL)
+    {
+        result = kmip_encode_authentication(ctx, value->authentication);
+        CHECK_RESULT(ctx, result);
+    }
+    
+    if(value->batch_error_continuation_option != 0)
+    {
+        result = kmip_encode_enum(ctx, KMIP_TAG_BATCH_ERROR_CONTINUATION_OPTION, value->batch_error_continuation_option);
+        CHECK_RESULT(ctx, result);
+    }
+    
+    if(value->batch_order_option != KMIP_UNSET)
+    {
+        result = kmip_encode_bool(ctx, KMIP_TAG_BATCH_ORDER_OPTION, value->batch_order_option);
+        CHECK_RESULT(ctx, result);
+    }
+    
+    if(value->time_stamp != 0)
+    {
+        result = kmip_encode_date_time(ctx, KMIP_TAG_TIME_STAMP, value->time_stamp);
+        CHECK_RESULT(ctx, result);
+    }
+    
+    result = kmip_encode_integer(ctx, KMIP_TAG_BATCH_COUNT, value->batch_count);
+    CHECK_RESULT(ctx, result);
+    
     uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    ctx->index = ctx->buffer + length_index;
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
     
     ctx->index = curr_index;
     
@@ -9470,89 +12390,68 @@ kmip_encode_create_request_payload(KMIP *ctx, const CreateRequestPayload *value)
 }
 
 int
-kmip_encode_create_response_payload(KMIP *ctx, const CreateResponsePayload *value)
+kmip_encode_response_header(KMIP *ctx, const ResponseHeader *value)
 {
-    CHECK_ENCODE_ARGS(ctx, value);
-
     int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_RESPONSE_PAYLOAD, KMIP_TYPE_STRUCTURE));
+    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_RESPONSE_HEADER, KMIP_TYPE_STRUCTURE));
     CHECK_RESULT(ctx, result);
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
     
-    result = kmip_encode_enum(ctx, KMIP_TAG_OBJECT_TYPE, value->object_type);
+    result = kmip_encode_protocol_version(ctx, value->protocol_version);
     CHECK_RESULT(ctx, result);
     
-    result = kmip_encode_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, value->unique_identifier);
+    result = kmip_encode_date_time(ctx, KMIP_TAG_TIME_STAMP, value->time_stamp);
     CHECK_RESULT(ctx, result);
-
-    if(ctx->version < KMIP_2_0)
+    
+    if(ctx->version >= KMIP_1_2)
     {
-        if(value->template_attribute != NULL)
+        if(value->nonce != NULL)
         {
-            result = kmip_encode_template_attribute(ctx, value->template_attribute);
+            result = kmip_encode_nonce(ctx, value->nonce);
             CHECK_RESULT(ctx, result);
         }
-    }
-    
-    uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
-    
-    kmip_encode_int32_be(ctx, curr_index - value_index);
-    
-    ctx->index = curr_index;
-    
-    return(KMIP_OK);
-}
 
-int
-kmip_encode_get_request_payload(KMIP *ctx, const GetRequestPayload *value)
-{
-    int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_REQUEST_PAYLOAD, KMIP_TYPE_STRUCTURE));
-    CHECK_RESULT(ctx, result);
-    
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
-    
-    if(value->unique_identifier != NULL)
-    {
-        result = kmip_encode_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, value->unique_identifier);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    if(value->key_format_type != 0)
-    {
-        result = kmip_encode_enum(ctx, KMIP_TAG_KEY_FORMAT_TYPE, value->key_format_type);
-        CHECK_RESULT(ctx, result);
+        if(ctx->version >= KMIP_2_0)
+        {
+            if(value->server_hashed_password != NULL)
+            {
+                result = kmip_encode_byte_string(ctx, KMIP_TAG_SERVER_HASHED_PASSWORD, value->server_hashed_password);
+                CHECK_RESULT(ctx, result);
+            }
+        }
+
+        for(size_t i = 0; i < value->attestation_type_count; i++)
+        {
+            result = kmip_encode_enum(ctx, KMIP_TAG_ATTESTATION_TYPE, value->attestation_types[i]);
+            CHECK_RESULT(ctx, result);
+        }
     }
     
     if(ctx->version >= KMIP_1_4)
     {
-        if(value->key_wrap_type != 0)
+        if(value->client_correlation_value != NULL)
         {
-            result = kmip_encode_enum(ctx, KMIP_TAG_KEY_WRAP_TYPE, value->key_wrap_type);
+            result = kmip_encode_text_string(ctx, KMIP_TAG_CLIENT_CORRELATION_VALUE, value->client_correlation_value);
+            CHECK_RESULT(ctx, result);
+        }
+        
+        if(value->server_correlation_value != NULL)
+        {
+            result = kmip_encode_text_string(ctx, KMIP_TAG_SERVER_CORRELATION_VALUE, value->server_correlation_value);
             CHECK_RESULT(ctx, result);
         }
     }
     
-    if(value->key_compression_type != 0)
-    {
-        result = kmip_encode_enum(ctx, KMIP_TAG_KEY_COMPRESSION_TYPE, value->key_compression_type);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    if(value->key_wrapping_spec != NULL)
-    {
-        result = kmip_encode_key_wrapping_specification(ctx, value->key_wrapping_spec);
-        CHECK_RESULT(ctx, result);
-    }
+    result = kmip_encode_integer(ctx, KMIP_TAG_BATCH_COUNT, value->batch_count);
+    CHECK_RESULT(ctx, result);
     
     uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    ctx->index = ctx->buffer + length_index;
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
     
     ctx->index = curr_index;
     
@@ -9560,36 +12459,48 @@ kmip_encode_get_request_payload(KMIP *ctx, const GetRequestPayload *value)
 }
 
 int
-kmip_encode_get_response_payload(KMIP *ctx, const GetResponsePayload *value)
+kmip_encode_request_batch_item(KMIP *ctx, const RequestBatchItem *value)
 {
+    CHECK_ENCODE_ARGS(ctx, value);
+
     int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_RESPONSE_PAYLOAD, KMIP_TYPE_STRUCTURE));
+    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_BATCH_ITEM, KMIP_TYPE_STRUCTURE));
     CHECK_RESULT(ctx, result);
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
-    
-    result = kmip_encode_enum(ctx, KMIP_TAG_OBJECT_TYPE, value->object_type);
-    CHECK_RESULT(ctx, result);
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
     
-    result = kmip_encode_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, value->unique_identifier);
+    result = kmip_encode_enum(ctx, KMIP_TAG_OPERATION, value->operation);
     CHECK_RESULT(ctx, result);
-    
-    switch(value->object_type)
+
+    if(ctx->version >= KMIP_2_0)
     {
-        case KMIP_OBJTYPE_SYMMETRIC_KEY:
-        result = kmip_encode_symmetric_key(ctx, (const SymmetricKey*)value->object);
+        if(value->ephemeral != KMIP_UNSET)
+        {
+            result=kmip_encode_bool(ctx, KMIP_TAG_EPHEMERAL, value->ephemeral);
+            CHECK_RESULT(ctx, result);
+        }
+    }
+
+    if(value->unique_batch_item_id != NULL)
+    {
+        result = kmip_encode_byte_string(ctx, KMIP_TAG_UNIQUE_BATCH_ITEM_ID, value->unique_batch_item_id);
         CHECK_RESULT(ctx, result);
+    }
+    
+    switch(value->operation)
+    {
+        case KMIP_OP_CREATE:
+        result = kmip_encode_create_request_payload(ctx, (CreateRequestPayload*)value->request_payload);
         break;
         
-        case KMIP_OBJTYPE_PUBLIC_KEY:
-        result = kmip_encode_public_key(ctx, (const PublicKey*)value->object);
-        CHECK_RESULT(ctx, result);
+        case KMIP_OP_GET:
+        result = kmip_encode_get_request_payload(ctx, (GetRequestPayload*)value->request_payload);
         break;
         
-        case KMIP_OBJTYPE_PRIVATE_KEY:
-        result = kmip_encode_private_key(ctx, (const PrivateKey*)value->object);
-        CHECK_RESULT(ctx, result);
+        case KMIP_OP_DESTROY:
+        result = kmip_encode_destroy_request_payload(ctx, (DestroyRequestPayload*)value->request_payload);
         break;
         
         default:
@@ -9597,11 +12508,12 @@ kmip_encode_get_response_payload(KMIP *ctx, const GetResponsePayload *value)
         return(KMIP_NOT_IMPLEMENTED);
         break;
     };
+    CHECK_RESULT(ctx, result);
     
     uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    ctx->index = ctx->buffer + length_index;
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
     
     ctx->index = curr_index;
     
@@ -9609,48 +12521,71 @@ kmip_encode_get_response_payload(KMIP *ctx, const GetResponsePayload *value)
 }
 
 int
-kmip_encode_destroy_request_payload(KMIP *ctx, const DestroyRequestPayload *value)
+kmip_encode_response_batch_item(KMIP *ctx, const ResponseBatchItem *value)
 {
     int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_REQUEST_PAYLOAD, KMIP_TYPE_STRUCTURE));
+    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_BATCH_ITEM, KMIP_TYPE_STRUCTURE));
     CHECK_RESULT(ctx, result);
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
     
-    if(value->unique_identifier != NULL)
+    result = kmip_encode_enum(ctx, KMIP_TAG_OPERATION, value->operation);
+    CHECK_RESULT(ctx, result);
+    
+    if(value->unique_batch_item_id != NULL)
     {
-        result = kmip_encode_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, value->unique_identifier);
+        result = kmip_encode_byte_string(ctx, KMIP_TAG_UNIQUE_BATCH_ITEM_ID, value->unique_batch_item_id);
         CHECK_RESULT(ctx, result);
     }
     
-    uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
-    
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    result = kmip_encode_enum(ctx, KMIP_TAG_RESULT_STATUS, value->result_status);
+    CHECK_RESULT(ctx, result);
     
-    ctx->index = curr_index;
+    if(value->result_reason != 0)
+    {
+        result = kmip_encode_enum(ctx, KMIP_TAG_RESULT_REASON, value->result_reason);
+        CHECK_RESULT(ctx, result);
+    }
     
-    return(KMIP_OK);
-}
-
-int
-kmip_encode_destroy_response_payload(KMIP *ctx, const DestroyResponsePayload *value)
-{
-    int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_RESPONSE_PAYLOAD, KMIP_TYPE_STRUCTURE));
-    CHECK_RESULT(ctx, result);
+    if(value->result_message != NULL)
+    {
+        result = kmip_encode_text_string(ctx, KMIP_TAG_RESULT_MESSAGE, value->result_message);
+        CHECK_RESULT(ctx, result);
+    }
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    if(value->asynchronous_correlation_value != NULL)
+    {
+        result = kmip_encode_byte_string(ctx, KMIP_TAG_ASYNCHRONOUS_CORRELATION_VALUE, value->asynchronous_correlation_value);
+        CHECK_RESULT(ctx, result);
+    }
     
-    result = kmip_encode_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, value->unique_identifier);
+    switch(value->operation)
+    {
+        case KMIP_OP_CREATE:
+        result = kmip_encode_create_response_payload(ctx, (CreateResponsePayload*)value->response_payload);
+        break;
+        
+        case KMIP_OP_GET:
+        result = kmip_encode_get_response_payload(ctx, (GetResponsePayload*)value->response_payload);
+        break;
+        
+        case KMIP_OP_DESTROY:
+        result = kmip_encode_destroy_response_payload(ctx, (DestroyResponsePayload*)value->response_payload);
+        break;
+        
+        default:
+        kmip_push_error_frame(ctx, __func__, __LINE__);
+        return(KMIP_NOT_IMPLEMENTED);
+        break;
+    };
     CHECK_RESULT(ctx, result);
     
     uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    ctx->index = ctx->buffer + length_index;
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
     
     ctx->index = curr_index;
     
@@ -9658,25 +12593,29 @@ kmip_encode_destroy_response_payload(KMIP *ctx, const DestroyResponsePayload *va
 }
 
 int
-kmip_encode_nonce(KMIP *ctx, const Nonce *value)
+kmip_encode_request_message(KMIP *ctx, const RequestMessage *value)
 {
     int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_NONCE, KMIP_TYPE_STRUCTURE));
+    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_REQUEST_MESSAGE, KMIP_TYPE_STRUCTURE));
     CHECK_RESULT(ctx, result);
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
     
-    result = kmip_encode_byte_string(ctx, KMIP_TAG_NONCE_ID, value->nonce_id);
+    result = kmip_encode_request_header(ctx, value->request_header);
     CHECK_RESULT(ctx, result);
     
-    result = kmip_encode_byte_string(ctx, KMIP_TAG_NONCE_VALUE, value->nonce_value);
-    CHECK_RESULT(ctx, result);
+    for(size_t i = 0; i < value->batch_count; i++)
+    {
+        result = kmip_encode_request_batch_item(ctx, &value->batch_items[i]);
+        CHECK_RESULT(ctx, result);
+    }
     
     uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    ctx->index = ctx->buffer + length_index;
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
     
     ctx->index = curr_index;
     
@@ -9684,28 +12623,29 @@ kmip_encode_nonce(KMIP *ctx, const Nonce *value)
 }
 
 int
-kmip_encode_username_password_credential(KMIP *ctx, const UsernamePasswordCredential *value)
+kmip_encode_response_message(KMIP *ctx, const ResponseMessage *value)
 {
     int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_CREDENTIAL_VALUE, KMIP_TYPE_STRUCTURE));
+    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_RESPONSE_MESSAGE, KMIP_TYPE_STRUCTURE));
     CHECK_RESULT(ctx, result);
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
     
-    result = kmip_encode_text_string(ctx, KMIP_TAG_USERNAME, value->username);
+    result = kmip_encode_response_header(ctx, value->response_header);
     CHECK_RESULT(ctx, result);
     
-    if(value->password != NULL)
+    for(size_t i = 0; i < value->batch_count; i++)
     {
-        result = kmip_encode_text_string(ctx, KMIP_TAG_PASSWORD, value->password);
+        result = kmip_encode_response_batch_item(ctx, &value->batch_items[i]);
         CHECK_RESULT(ctx, result);
     }
     
     uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    ctx->index = ctx->buffer + length_index;
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
     
     ctx->index = curr_index;
     
@@ -9713,583 +12653,694 @@ kmip_encode_username_password_credential(KMIP *ctx, const UsernamePasswordCreden
 }
 
 int
-kmip_encode_device_credential(KMIP *ctx, const DeviceCredential *value)
+kmip_encode_fragment(KMIP *ctx, enum tag tag, const KMIPFragment *value)
 {
-    int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_CREDENTIAL_VALUE, KMIP_TYPE_STRUCTURE));
-    CHECK_RESULT(ctx, result);
-    
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    CHECK_ENCODE_ARGS(ctx, value);
     
-    if(value->device_serial_number != NULL)
+    if(value->tag != tag)
     {
-        result = kmip_encode_text_string(ctx, KMIP_TAG_DEVICE_SERIAL_NUMBER, value->device_serial_number);
-        CHECK_RESULT(ctx, result);
+        kmip_set_error_message(ctx, "Pre-encoded fragment holds a different structure.");
+        HANDLE_FAILURE(ctx, KMIP_TAG_MISMATCH);
     }
     
-    if(value->password != NULL)
+    if(value->version != ctx->version)
     {
-        result = kmip_encode_text_string(ctx, KMIP_TAG_PASSWORD, value->password);
-        CHECK_RESULT(ctx, result);
+        kmip_set_error_message(ctx, "Pre-encoded fragment was built for a different KMIP version.");
+        HANDLE_FAILURE(ctx, KMIP_INVALID_FOR_VERSION);
     }
     
-    if(value->device_identifier != NULL)
-    {
-        result = kmip_encode_text_string(ctx, KMIP_TAG_DEVICE_IDENTIFIER, value->device_identifier);
-        CHECK_RESULT(ctx, result);
-    }
+    CHECK_ENCODE_BUFFER(ctx, value->size);
     
-    if(value->network_identifier != NULL)
-    {
-        result = kmip_encode_text_string(ctx, KMIP_TAG_NETWORK_IDENTIFIER, value->network_identifier);
-        CHECK_RESULT(ctx, result);
-    }
+    ctx->memcpy_func(ctx->state, ctx->index, value->encoding, value->size);
+    ctx->index += value->size;
     
-    if(value->machine_identifier != NULL)
+    return(KMIP_OK);
+}
+
+/* NOTE (ph) Fragments are encoded through the context so that its     */
+/*      version, hooks and error trace apply. The context buffer is     */
+/*      swapped for the fragment storage for the duration and restored  */
+/*      afterwards, whatever the outcome.                               */
+
+int
+kmip_build_fragment(KMIP *ctx, enum tag tag, const void *value, KMIPFragment *fragment)
+{
+    if(ctx == NULL || value == NULL || fragment == NULL)
     {
-        result = kmip_encode_text_string(ctx, KMIP_TAG_MACHINE_IDENTIFIER, value->machine_identifier);
-        CHECK_RESULT(ctx, result);
+        return(KMIP_ARG_INVALID);
     }
     
-    if(value->media_identifier != NULL)
+    size_t size = 0;
+    switch(tag)
     {
-        result = kmip_encode_text_string(ctx, KMIP_TAG_MEDIA_IDENTIFIER, value->media_identifier);
-        CHECK_RESULT(ctx, result);
-    }
+        case KMIP_TAG_TEMPLATE_ATTRIBUTE:
+        size = kmip_size_template_attribute(ctx, value);
+        break;
     
-    uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+        case KMIP_TAG_ATTRIBUTES:
+        size = kmip_size_template_attribute_as_attributes(ctx, value);
+        break;
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+        case KMIP_TAG_AUTHENTICATION:
+        size = kmip_size_authentication(ctx, value);
+        break;
     
-    ctx->index = curr_index;
+        default:
+        HANDLE_FAILURE(ctx, KMIP_NOT_IMPLEMENTED);
+    };
     
-    return(KMIP_OK);
-}
-
-int
-kmip_encode_attestation_credential(KMIP *ctx, const AttestationCredential *value)
-{
-    int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_CREDENTIAL_VALUE, KMIP_TYPE_STRUCTURE));
-    CHECK_RESULT(ctx, result);
+    /* Fragments are reused across messages, so keep them out of any */
+    /* installed arena.                                              */
+    bool32 sensitive = (tag == KMIP_TAG_AUTHENTICATION);
+    uint8 *encoding = kmip_calloc_detached(ctx, 1, size, sensitive);
+    CHECK_NEW_MEMORY(ctx, encoding, size, "fragment encoding");
+    
+    uint8 *buffer = ctx->buffer;
+    uint8 *index = ctx->index;
+    size_t buffer_size = ctx->size;
+    bool32 own_buffer = ctx->own_buffer;
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    ctx->buffer = encoding;
+    ctx->index = encoding;
+    ctx->size = size;
+    ctx->own_buffer = KMIP_FALSE;
     
-    result = kmip_encode_nonce(ctx, value->nonce);
-    CHECK_RESULT(ctx, result);
+    int result = KMIP_OK;
+    switch(tag)
+    {
+        case KMIP_TAG_TEMPLATE_ATTRIBUTE:
+        result = kmip_encode_template_attribute(ctx, value);
+        break;
     
-    result = kmip_encode_enum(ctx, KMIP_TAG_ATTESTATION_TYPE, value->attestation_type);
-    CHECK_RESULT(ctx, result);
+        case KMIP_TAG_ATTRIBUTES:
+        result = kmip_encode_template_attribute_as_attributes(ctx, value);
+        break;
     
-    if(value->attestation_measurement != NULL)
-    {
-        result = kmip_encode_byte_string(ctx, KMIP_TAG_ATTESTATION_MEASUREMENT, value->attestation_measurement);
-        CHECK_RESULT(ctx, result);
-    }
+        default:
+        result = kmip_encode_authentication(ctx, value);
+        break;
+    };
     
-    if(value->attestation_assertion != NULL)
-    {
-        result = kmip_encode_byte_string(ctx, KMIP_TAG_ATTESTATION_ASSERTION, value->attestation_assertion);
-        CHECK_RESULT(ctx, result);
-    }
+    size_t used = ctx->index - ctx->buffer;
     
-    uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    ctx->buffer = buffer;
+    ctx->index = index;
+    ctx->size = buffer_size;
+    ctx->own_buffer = own_buffer;
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    if(result != KMIP_OK)
+    {
+        kmip_free_memory(ctx, encoding, size, sensitive);
+        HANDLE_FAILURE(ctx, result);
+    }
     
-    ctx->index = curr_index;
+    fragment->tag = tag;
+    fragment->version = ctx->version;
+    fragment->encoding = encoding;
+    fragment->size = used;
+    fragment->sensitive = sensitive;
     
     return(KMIP_OK);
 }
 
 int
-kmip_encode_credential_value(KMIP *ctx, enum credential_type type, void *value)
+kmip_build_template_attribute_fragment(KMIP *ctx, const TemplateAttribute *value, KMIPFragment *fragment)
 {
-    int result = 0;
-    
-    switch(type)
+    if(ctx == NULL)
     {
-        case KMIP_CRED_USERNAME_AND_PASSWORD:
-        result = kmip_encode_username_password_credential(ctx, (UsernamePasswordCredential*)value);
-        break;
-        
-        case KMIP_CRED_DEVICE:
-        result = kmip_encode_device_credential(ctx, (DeviceCredential*)value);
-        break;
-        
-        case KMIP_CRED_ATTESTATION:
-        result = kmip_encode_attestation_credential(ctx, (AttestationCredential*)value);
-        break;
-        
-        default:
-        kmip_push_error_frame(ctx, __func__, __LINE__);
-        return(KMIP_NOT_IMPLEMENTED);
-        break;
+        return(KMIP_ARG_INVALID);
     }
-    CHECK_RESULT(ctx, result);
     
-    return(KMIP_OK);
+    /* KMIP 2.0 Create requests carry the template as Attributes. */
+    enum tag tag = (ctx->version < KMIP_2_0) ? KMIP_TAG_TEMPLATE_ATTRIBUTE : KMIP_TAG_ATTRIBUTES;
+    
+    return(kmip_build_fragment(ctx, tag, value, fragment));
 }
 
 int
-kmip_encode_credential(KMIP *ctx, const Credential *value)
+kmip_build_authentication_fragment(KMIP *ctx, const Authentication *value, KMIPFragment *fragment)
 {
-    int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_CREDENTIAL, KMIP_TYPE_STRUCTURE));
-    CHECK_RESULT(ctx, result);
-    
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
-    
-    result = kmip_encode_enum(ctx, KMIP_TAG_CREDENTIAL_TYPE, value->credential_type);
-    CHECK_RESULT(ctx, result);
-    
-    result = kmip_encode_credential_value(ctx, value->credential_type, value->credential_value);
-    CHECK_RESULT(ctx, result);
-    
-    uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
-    
-    kmip_encode_int32_be(ctx, curr_index - value_index);
-    
-    ctx->index = curr_index;
-    
-    return(KMIP_OK);
+    return(kmip_build_fragment(ctx, KMIP_TAG_AUTHENTICATION, value, fragment));
 }
 
+/*
+Request Templates
+*/
+
+/* NOTE (ph) A request template is an encoded request message with a   */
+/*      few slots that change from one request to the next: the header */
+/*      time stamp, the payload unique identifier and the batch item id. */
+/*      Each slot records where its item sits and where the length      */
+/*      fields of the structures around it are. Patching a slot rewrites */
+/*      the item in place and, when its padded size changes, shifts the  */
+/*      rest of the message and adjusts those lengths.                   */
+
 int
-kmip_encode_authentication(KMIP *ctx, const Authentication *value)
+kmip_init_request_template(KMIP *ctx, KMIPRequestTemplate *value, const RequestMessage *message)
 {
-    int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_AUTHENTICATION, KMIP_TYPE_STRUCTURE));
-    CHECK_RESULT(ctx, result);
+    if(ctx == NULL || value == NULL || message == NULL)
+    {
+        return(KMIP_ARG_INVALID);
+    }
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    /* Templates are reused across messages, so they stay out of any */
+    /* installed arena. Ones with credentials go with the secrets.   */
+    bool32 sensitive = (message->request_header != NULL && message->request_header->authentication != NULL);
+    size_t size = kmip_size_request_message(ctx, message);
+    uint8 *encoding = kmip_calloc_detached(ctx, 1, size, sensitive);
+    CHECK_NEW_MEMORY(ctx, encoding, size, "request template encoding");
     
-    result = kmip_encode_credential(ctx, value->credential);
-    CHECK_RESULT(ctx, result);
+    uint8 *buffer = ctx->buffer;
+    uint8 *index = ctx->index;
+    size_t buffer_size = ctx->size;
+    bool32 own_buffer = ctx->own_buffer;
     
-    uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    ctx->buffer = encoding;
+    ctx->index = encoding;
+    ctx->size = size;
+    ctx->own_buffer = KMIP_FALSE;
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    int result = kmip_encode_request_message(ctx, message);
+    size_t used = ctx->index - ctx->buffer;
     
-    ctx->index = curr_index;
+    ctx->buffer = buffer;
+    ctx->index = index;
+    ctx->size = buffer_size;
+    ctx->own_buffer = own_buffer;
+    
+    if(result != KMIP_OK)
+    {
+        kmip_free_memory(ctx, encoding, size, KMIP_TRUE);
+        HANDLE_FAILURE(ctx, result);
+    }
+    
+    value->version = ctx->version;
+    value->encoding = encoding;
+    value->size = used;
+    value->capacity = size;
+    value->sensitive = sensitive;
+    kmip_find_request_template_slots(value);
     
     return(KMIP_OK);
 }
 
-int
-kmip_encode_request_header(KMIP *ctx, const RequestHeader *value)
+void
+kmip_find_request_template_slots(KMIPRequestTemplate *value)
 {
-    int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_REQUEST_HEADER, KMIP_TYPE_STRUCTURE));
-    CHECK_RESULT(ctx, result);
-    
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
-    
-    result = kmip_encode_protocol_version(ctx, value->protocol_version);
-    CHECK_RESULT(ctx, result);
+    size_t ends[KMIP_PARSER_MAX_DEPTH] = {0};
+    size_t lengths[KMIP_PARSER_MAX_DEPTH] = {0};
+    enum tag tags[KMIP_PARSER_MAX_DEPTH] = {0};
+    size_t depth = 0;
     
-    /* HERE (ph) Stopped working here after bug with 0 vs KMIP_UNSET */
-    if(value->maximum_response_size != KMIP_UNSET)
+    for(size_t i = 0; i < KMIP_TEMPLATE_SLOT_COUNT; i++)
     {
-        result = kmip_encode_integer(ctx, KMIP_TAG_MAXIMUM_RESPONSE_SIZE, value->maximum_response_size);
-        CHECK_RESULT(ctx, result);
+        value->slots[i].present = KMIP_FALSE;
     }
     
-    if(ctx->version >= KMIP_1_4)
+    size_t offset = 0;
+    while(offset + 8 <= value->size)
     {
-        if(value->client_correlation_value != NULL)
+        while(depth > 0 && offset >= ends[depth - 1])
         {
-            result = kmip_encode_text_string(ctx, KMIP_TAG_CLIENT_CORRELATION_VALUE, value->client_correlation_value);
-            CHECK_RESULT(ctx, result);
+            depth--;
         }
-        
-        if(value->server_correlation_value != NULL)
+    
+        const uint8 *item = value->encoding + offset;
+        enum tag tag = (enum tag)(kmip_load_uint32_be(item) >> 8);
+        enum type type = (enum type)item[3];
+        uint32 length = kmip_load_uint32_be(item + 4);
+        enum tag parent = (depth > 0) ? tags[depth - 1] : 0;
+    
+        int slot = -1;
+        if(tag == KMIP_TAG_TIME_STAMP && parent == KMIP_TAG_REQUEST_HEADER)
         {
-            result = kmip_encode_text_string(ctx, KMIP_TAG_SERVER_CORRELATION_VALUE, value->server_correlation_value);
-            CHECK_RESULT(ctx, result);
+            slot = KMIP_TEMPLATE_SLOT_TIME_STAMP;
+        }
+        else if(tag == KMIP_TAG_UNIQUE_IDENTIFIER && parent == KMIP_TAG_REQUEST_PAYLOAD)
+        {
+            slot = KMIP_TEMPLATE_SLOT_UNIQUE_IDENTIFIER;
+        }
+        else if(tag == KMIP_TAG_UNIQUE_BATCH_ITEM_ID && parent == KMIP_TAG_BATCH_ITEM)
+        {
+            slot = KMIP_TEMPLATE_SLOT_UNIQUE_BATCH_ITEM_ID;
         }
-    }
     
-    if(value->asynchronous_indicator != KMIP_UNSET)
-    {
-        result = kmip_encode_bool(ctx, KMIP_TAG_ASYNCHRONOUS_INDICATOR, value->asynchronous_indicator);
-        CHECK_RESULT(ctx, result);
-    }
+        /* Only the first occurrence of each slot is patchable. */
+        if(slot >= 0 && !value->slots[slot].present && depth <= KMIP_TEMPLATE_MAX_DEPTH)
+        {
+            KMIPTemplateSlot *found = &value->slots[slot];
+            found->present = KMIP_TRUE;
+            found->offset = offset;
+            found->parent_count = depth;
+            for(size_t i = 0; i < depth; i++)
+            {
+                found->parents[i] = lengths[i];
+            }
+        }
     
-    if(ctx->version >= KMIP_1_2)
-    {
-        if(value->attestation_capable_indicator != KMIP_UNSET)
+        if(type == KMIP_TYPE_STRUCTURE)
         {
-            result = kmip_encode_bool(ctx, KMIP_TAG_ATTESTATION_CAPABLE_INDICATOR, value->attestation_capable_indicator);
-            CHECK_RESULT(ctx, result);
+            if(depth == KMIP_PARSER_MAX_DEPTH)
+            {
+                return;
+            }
+            ends[depth] = offset + 8 + length;
+            lengths[depth] = offset + 4;
+            tags[depth] = tag;
+            depth++;
+            offset += 8;
         }
-        
-        for(size_t i = 0; i < value->attestation_type_count; i++)
+        else
         {
-            result = kmip_encode_enum(ctx, KMIP_TAG_ATTESTATION_TYPE, value->attestation_types[i]);
-            CHECK_RESULT(ctx, result);
+            offset += 8 + length + CALCULATE_PADDING(length);
         }
     }
-    
-    if(value->authentication != NULL)
+}
+
+int
+kmip_patch_request_template(KMIP *ctx, KMIPRequestTemplate *value, enum request_template_slot slot, const void *data, size_t data_size)
+{
+    if(ctx == NULL || value == NULL || (int)slot < 0 || slot >= KMIP_TEMPLATE_SLOT_COUNT || (data == NULL && data_size > 0))
     {
-        result = kmip_encode_authentication(ctx, value->authentication);
-        CHECK_RESULT(ctx, result);
+        return(KMIP_ARG_INVALID);
     }
     
-    if(value->batch_error_continuation_option != 0)
+    KMIPTemplateSlot *target = &value->slots[slot];
+    if(!target->present)
     {
-        result = kmip_encode_enum(ctx, KMIP_TAG_BATCH_ERROR_CONTINUATION_OPTION, value->batch_error_continuation_option);
-        CHECK_RESULT(ctx, result);
+        kmip_set_error_message(ctx, "The request template has no item for this slot.");
+        HANDLE_FAILURE(ctx, KMIP_INVALID_FIELD);
     }
     
-    if(value->batch_order_option != KMIP_UNSET)
+    if(data_size > UINT32_MAX - 8)
     {
-        result = kmip_encode_bool(ctx, KMIP_TAG_BATCH_ORDER_OPTION, value->batch_order_option);
-        CHECK_RESULT(ctx, result);
+        HANDLE_FAILURE(ctx, KMIP_EXCEED_MAX_MESSAGE_SIZE);
     }
     
-    if(value->time_stamp != 0)
+    uint8 *item = value->encoding + target->offset;
+    uint32 old_length = kmip_load_uint32_be(item + 4);
+    size_t old_size = old_length + CALCULATE_PADDING(old_length);
+    size_t new_size = data_size + CALCULATE_PADDING(data_size);
+    
+    if(new_size != old_size)
     {
-        result = kmip_encode_date_time(ctx, KMIP_TAG_TIME_STAMP, value->time_stamp);
-        CHECK_RESULT(ctx, result);
-    }
+        size_t tail = target->offset + 8 + old_size;
+        size_t total = value->size - old_size + new_size;
+        if(total - 8 > UINT32_MAX)
+        {
+            HANDLE_FAILURE(ctx, KMIP_EXCEED_MAX_MESSAGE_SIZE);
+        }
     
-    result = kmip_encode_integer(ctx, KMIP_TAG_BATCH_COUNT, value->batch_count);
-    CHECK_RESULT(ctx, result);
+        /* A fresh copy instead of realloc, so no stale copy of the */
+        /* credentials is left behind unwiped.                      */
+        if(total > value->capacity)
+        {
+            uint8 *encoding = kmip_calloc_detached(ctx, 1, total, value->sensitive);
+            CHECK_NEW_MEMORY(ctx, encoding, total, "request template encoding");
+            ctx->memcpy_func(ctx->state, encoding, value->encoding, value->size);
+            kmip_free_memory(ctx, value->encoding, value->capacity, KMIP_TRUE);
+            value->encoding = encoding;
+            value->capacity = total;
+            item = value->encoding + target->offset;
+        }
     
-    uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+        memmove(value->encoding + tail - old_size + new_size, value->encoding + tail, value->size - tail);
+        value->size = total;
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+        /* Every enclosing structure grows or shrinks by the same amount. */
+        for(size_t i = 0; i < target->parent_count; i++)
+        {
+            uint8 *length = value->encoding + target->parents[i];
+            kmip_store_uint32_be(length, (uint32)(kmip_load_uint32_be(length) - old_size + new_size));
+        }
     
-    ctx->index = curr_index;
+        /* Items after the patched one, and their length fields, moved. */
+        for(size_t i = 0; i < KMIP_TEMPLATE_SLOT_COUNT; i++)
+        {
+            KMIPTemplateSlot *other = &value->slots[i];
+            if(!other->present || other == target)
+            {
+                continue;
+            }
+            if(other->offset > target->offset)
+            {
+                other->offset = other->offset - old_size + new_size;
+            }
+            for(size_t j = 0; j < other->parent_count; j++)
+            {
+                if(other->parents[j] > target->offset)
+                {
+                    other->parents[j] = other->parents[j] - old_size + new_size;
+                }
+            }
+        }
+    }
+    
+    kmip_store_uint32_be(item + 4, (uint32)data_size);
+    if(data_size > 0)
+    {
+        ctx->memcpy_func(ctx->state, item + 8, data, data_size);
+    }
+    ctx->memset_func(item + 8 + data_size, 0, new_size - data_size);
     
     return(KMIP_OK);
 }
 
 int
-kmip_encode_response_header(KMIP *ctx, const ResponseHeader *value)
+kmip_set_template_time_stamp(KMIP *ctx, KMIPRequestTemplate *value, uint64 time_stamp)
 {
-    int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_RESPONSE_HEADER, KMIP_TYPE_STRUCTURE));
-    CHECK_RESULT(ctx, result);
-    
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
-    
-    result = kmip_encode_protocol_version(ctx, value->protocol_version);
-    CHECK_RESULT(ctx, result);
-    
-    result = kmip_encode_date_time(ctx, KMIP_TAG_TIME_STAMP, value->time_stamp);
-    CHECK_RESULT(ctx, result);
+    uint8 encoded[8] = {0};
+    kmip_store_uint64_be(encoded, time_stamp);
     
-    if(ctx->version >= KMIP_1_2)
-    {
-        if(value->nonce != NULL)
-        {
-            result = kmip_encode_nonce(ctx, value->nonce);
-            CHECK_RESULT(ctx, result);
-        }
+    return(kmip_patch_request_template(ctx, value, KMIP_TEMPLATE_SLOT_TIME_STAMP, encoded, sizeof(encoded)));
+}
 
-        if(ctx->version >= KMIP_2_0)
-        {
-            if(value->server_hashed_password != NULL)
-            {
-                result = kmip_encode_byte_string(ctx, KMIP_TAG_SERVER_HASHED_PASSWORD, value->server_hashed_password);
-                CHECK_RESULT(ctx, result);
-            }
-        }
+int
+kmip_set_template_unique_identifier(KMIP *ctx, KMIPRequestTemplate *value, const TextString *unique_identifier)
+{
+    if(unique_identifier == NULL)
+    {
+        return(KMIP_ARG_INVALID);
+    }
+    
+    return(kmip_patch_request_template(ctx, value, KMIP_TEMPLATE_SLOT_UNIQUE_IDENTIFIER, unique_identifier->value, unique_identifier->size));
+}
 
-        for(size_t i = 0; i < value->attestation_type_count; i++)
-        {
-            result = kmip_encode_enum(ctx, KMIP_TAG_ATTESTATION_TYPE, value->attestation_types[i]);
-            CHECK_RESULT(ctx, result);
-        }
+int
+kmip_set_template_batch_item_id(KMIP *ctx, KMIPRequestTemplate *value, const ByteString *unique_batch_item_id)
+{
+    if(unique_batch_item_id == NULL)
+    {
+        return(KMIP_ARG_INVALID);
     }
     
-    if(ctx->version >= KMIP_1_4)
+    return(kmip_patch_request_template(ctx, value, KMIP_TEMPLATE_SLOT_UNIQUE_BATCH_ITEM_ID, unique_batch_item_id->value, unique_batch_item_id->size));
+}
+
+void
+kmip_free_request_template(KMIP *ctx, KMIPRequestTemplate *value)
+{
+    if(value != NULL)
     {
-        if(value->client_correlation_value != NULL)
+        /* Templates usually carry the request credentials. */
+        if(value->encoding != NULL)
         {
-            result = kmip_encode_text_string(ctx, KMIP_TAG_CLIENT_CORRELATION_VALUE, value->client_correlation_value);
-            CHECK_RESULT(ctx, result);
+            kmip_free_memory(ctx, value->encoding, value->capacity, KMIP_TRUE);
+            value->encoding = NULL;
         }
-        
-        if(value->server_correlation_value != NULL)
+    
+        value->size = 0;
+        value->capacity = 0;
+        value->sensitive = KMIP_FALSE;
+        for(size_t i = 0; i < KMIP_TEMPLATE_SLOT_COUNT; i++)
         {
-            result = kmip_encode_text_string(ctx, KMIP_TAG_SERVER_CORRELATION_VALUE, value->server_correlation_value);
-            CHECK_RESULT(ctx, result);
+            value->slots[i].present = KMIP_FALSE;
         }
     }
     
-    result = kmip_encode_integer(ctx, KMIP_TAG_BATCH_COUNT, value->batch_count);
-    CHECK_RESULT(ctx, result);
+    return;
+}
+
+/*
+Decoding Functions
+*/
+
+int
+kmip_decode_int8_be(KMIP *ctx, void *value)
+{
+    CHECK_BUFFER_FULL(ctx, sizeof(int8));
     
-    uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    int8 *i = (int8*)value;
+    
+    *i = 0;
+    *i = *ctx->index++;
+    
+    return(KMIP_OK);
+}
+
+int
+kmip_decode_int32_be(KMIP *ctx, void *value)
+{
+    CHECK_BUFFER_FULL(ctx, sizeof(int32));
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    int32 *i = (int32*)value;
     
-    ctx->index = curr_index;
+    *i = (int32)kmip_load_uint32_be(ctx->index);
+    ctx->index += sizeof(int32);
     
     return(KMIP_OK);
 }
 
 int
-kmip_encode_request_batch_item(KMIP *ctx, const RequestBatchItem *value)
+kmip_decode_int64_be(KMIP *ctx, void *value)
 {
-    CHECK_ENCODE_ARGS(ctx, value);
-
-    int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_BATCH_ITEM, KMIP_TYPE_STRUCTURE));
-    CHECK_RESULT(ctx, result);
+    CHECK_BUFFER_FULL(ctx, sizeof(int64));
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    int64 *i = (int64*)value;
     
-    result = kmip_encode_enum(ctx, KMIP_TAG_OPERATION, value->operation);
-    CHECK_RESULT(ctx, result);
-
-    if(ctx->version >= KMIP_2_0)
-    {
-        if(value->ephemeral != KMIP_UNSET)
-        {
-            result=kmip_encode_bool(ctx, KMIP_TAG_EPHEMERAL, value->ephemeral);
-            CHECK_RESULT(ctx, result);
-        }
-    }
+    *i = (int64)kmip_load_uint64_be(ctx->index);
+    ctx->index += sizeof(int64);
+    
+    return(KMIP_OK);
+}
 
-    if(value->unique_batch_item_id != NULL)
-    {
-        result = kmip_encode_byte_string(ctx, KMIP_TAG_UNIQUE_BATCH_ITEM_ID, value->unique_batch_item_id);
-        CHECK_RESULT(ctx, result);
-    }
+int
+kmip_decode_integer(KMIP *ctx, enum tag t, int32 *value)
+{
+    CHECK_BUFFER_FULL(ctx, 16);
     
-    switch(value->operation)
-    {
-        case KMIP_OP_CREATE:
-        result = kmip_encode_create_request_payload(ctx, (CreateRequestPayload*)value->request_payload);
-        break;
-        
-        case KMIP_OP_GET:
-        result = kmip_encode_get_request_payload(ctx, (GetRequestPayload*)value->request_payload);
-        break;
-        
-        case KMIP_OP_DESTROY:
-        result = kmip_encode_destroy_request_payload(ctx, (DestroyRequestPayload*)value->request_payload);
-        break;
-        
-        default:
-        kmip_push_error_frame(ctx, __func__, __LINE__);
-        return(KMIP_NOT_IMPLEMENTED);
-        break;
-    };
-    CHECK_RESULT(ctx, result);
+    int32 tag_type = 0;
+    int32 length = 0;
+    int32 padding = 0;
     
-    uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    kmip_decode_int32_be(ctx, &tag_type);
+    CHECK_TAG_TYPE(ctx, tag_type, t, KMIP_TYPE_INTEGER);
+    
+    kmip_decode_int32_be(ctx, &length);
+    CHECK_LENGTH(ctx, length, 4);
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    kmip_decode_int32_be(ctx, value);
     
-    ctx->index = curr_index;
+    kmip_decode_int32_be(ctx, &padding);
+    CHECK_PADDING(ctx, padding);
     
     return(KMIP_OK);
 }
 
 int
-kmip_encode_response_batch_item(KMIP *ctx, const ResponseBatchItem *value)
+kmip_decode_long(KMIP *ctx, enum tag t, int64 *value)
 {
-    int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_BATCH_ITEM, KMIP_TYPE_STRUCTURE));
-    CHECK_RESULT(ctx, result);
-    
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    CHECK_BUFFER_FULL(ctx, 16);
     
-    result = kmip_encode_enum(ctx, KMIP_TAG_OPERATION, value->operation);
-    CHECK_RESULT(ctx, result);
+    int32 tag_type = 0;
+    int32 length = 0;
     
-    if(value->unique_batch_item_id != NULL)
-    {
-        result = kmip_encode_byte_string(ctx, KMIP_TAG_UNIQUE_BATCH_ITEM_ID, value->unique_batch_item_id);
-        CHECK_RESULT(ctx, result);
-    }
+    kmip_decode_int32_be(ctx, &tag_type);
+    CHECK_TAG_TYPE(ctx, tag_type, t, KMIP_TYPE_LONG_INTEGER);
     
-    result = kmip_encode_enum(ctx, KMIP_TAG_RESULT_STATUS, value->result_status);
-    CHECK_RESULT(ctx, result);
+    kmip_decode_int32_be(ctx, &length);
+    CHECK_LENGTH(ctx, length, 8);
     
-    if(value->result_reason != 0)
-    {
-        result = kmip_encode_enum(ctx, KMIP_TAG_RESULT_REASON, value->result_reason);
-        CHECK_RESULT(ctx, result);
-    }
+    kmip_decode_int64_be(ctx, value);
     
-    if(value->result_message != NULL)
-    {
-        result = kmip_encode_text_string(ctx, KMIP_TAG_RESULT_MESSAGE, value->result_message);
-        CHECK_RESULT(ctx, result);
-    }
+    return(KMIP_OK);
+}
+
+int
+kmip_decode_enum(KMIP *ctx, enum tag t, void *value)
+{
+    CHECK_BUFFER_FULL(ctx, 16);
     
-    if(value->asynchronous_correlation_value != NULL)
-    {
-        result = kmip_encode_byte_string(ctx, KMIP_TAG_ASYNCHRONOUS_CORRELATION_VALUE, value->asynchronous_correlation_value);
-        CHECK_RESULT(ctx, result);
-    }
+    int32 tag_type = 0;
+    int32 length = 0;
+    int32 *v = (int32*)value;
+    int32 padding = 0;
     
-    switch(value->operation)
-    {
-        case KMIP_OP_CREATE:
-        result = kmip_encode_create_response_payload(ctx, (CreateResponsePayload*)value->response_payload);
-        break;
-        
-        case KMIP_OP_GET:
-        result = kmip_encode_get_response_payload(ctx, (GetResponsePayload*)value->response_payload);
-        break;
-        
-        case KMIP_OP_DESTROY:
-        result = kmip_encode_destroy_response_payload(ctx, (DestroyResponsePayload*)value->response_payload);
-        break;
-        
-        default:
-        kmip_push_error_frame(ctx, __func__, __LINE__);
-        return(KMIP_NOT_IMPLEMENTED);
-        break;
-    };
-    CHECK_RESULT(ctx, result);
+    kmip_decode_int32_be(ctx, &tag_type);
+    CHECK_TAG_TYPE(ctx, tag_type, t, KMIP_TYPE_ENUMERATION);
     
-    uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    kmip_decode_int32_be(ctx, &length);
+    CHECK_LENGTH(ctx, length, 4);
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    kmip_decode_int32_be(ctx, v);
     
-    ctx->index = curr_index;
+    kmip_decode_int32_be(ctx, &padding);
+    CHECK_PADDING(ctx, padding);
     
     return(KMIP_OK);
 }
 
 int
-kmip_encode_request_message(KMIP *ctx, const RequestMessage *value)
+kmip_decode_bool(KMIP *ctx, enum tag t, bool32 *value)
 {
-    int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_REQUEST_MESSAGE, KMIP_TYPE_STRUCTURE));
-    CHECK_RESULT(ctx, result);
-    
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    CHECK_BUFFER_FULL(ctx, 16);
     
-    result = kmip_encode_request_header(ctx, value->request_header);
-    CHECK_RESULT(ctx, result);
+    int32 tag_type = 0;
+    int32 length = 0;
+    int32 padding = 0;
     
-    for(size_t i = 0; i < value->batch_count; i++)
-    {
-        result = kmip_encode_request_batch_item(ctx, &value->batch_items[i]);
-        CHECK_RESULT(ctx, result);
-    }
+    kmip_decode_int32_be(ctx, &tag_type);
+    CHECK_TAG_TYPE(ctx, tag_type, t, KMIP_TYPE_BOOLEAN);
     
-    uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
+    kmip_decode_int32_be(ctx, &length);
+    CHECK_LENGTH(ctx, length, 8);
     
-    kmip_encode_int32_be(ctx, curr_index - value_index);
+    kmip_decode_int32_be(ctx, &padding);
+    CHECK_PADDING(ctx, padding);
     
-    ctx->index = curr_index;
+    kmip_decode_int32_be(ctx, value);
+    CHECK_BOOLEAN(ctx, *value);
     
     return(KMIP_OK);
 }
 
 int
-kmip_encode_response_message(KMIP *ctx, const ResponseMessage *value)
+kmip_decode_text_string(KMIP *ctx, enum tag t, TextString *value)
 {
-    int result = 0;
-    result = kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_RESPONSE_MESSAGE, KMIP_TYPE_STRUCTURE));
-    CHECK_RESULT(ctx, result);
+    CHECK_BUFFER_FULL(ctx, 8);
     
-    uint8 *length_index = ctx->index;
-    uint8 *value_index = ctx->index += 4;
+    int32 tag_type = 0;
+    int32 length = 0;
+    int32 padding = 0;
     
-    result = kmip_encode_response_header(ctx, value->response_header);
-    CHECK_RESULT(ctx, result);
+    kmip_decode_int32_be(ctx, &tag_type);
+    CHECK_TAG_TYPE(ctx, tag_type, t, KMIP_TYPE_TEXT_STRING);
     
-    for(size_t i = 0; i < value->batch_count; i++)
+    kmip_decode_int32_be(ctx, &length);
+    padding = (8 - (length % 8)) % 8;
+    CHECK_BUFFER_FULL(ctx, (uint32)(length + padding));
+    
+    if(ctx->borrow_strings == KMIP_TRUE)
     {
-        result = kmip_encode_response_batch_item(ctx, &value->batch_items[i]);
-        CHECK_RESULT(ctx, result);
+        /* NOTE (ph) Borrowed values point into the context buffer and */
+        /* are only valid while that buffer is unchanged.              */
+        value->value = (char *)ctx->index;
+        value->size = length;
+        value->borrowed = KMIP_TRUE;
+        
+        ctx->index += length;
     }
-    
-    uint8 *curr_index = ctx->index;
-    ctx->index = length_index;
-    
-    kmip_encode_int32_be(ctx, curr_index - value_index);
-    
-    ctx->index = curr_index;
+    else if(value->inlined == KMIP_TRUE && value->value != NULL && (size_t)length <= value->size)
+    {
+        /* Inline storage reserved by kmip_decode_new_text_string. */
+        memcpy(value->value, ctx->index, length);
+        value->size = length;
+        
+        ctx->index += length;
+    }
+    else
+    {
+        value->value = ctx->calloc_func(ctx->state, 1, length);
+        value->size = length;
+        value->inlined = KMIP_FALSE;
+        
+        if(length > 0)
+        {
+            CHECK_NEW_MEMORY(ctx, value->value, length, "TextString value");
+            memcpy(value->value, ctx->index, length);
+            ctx->index += length;
+        }
+    }
+    CHECK_PADDING_BYTES(ctx, padding);
     
     return(KMIP_OK);
 }
 
-/*
-Decoding Functions
-*/
-
 int
-kmip_decode_int8_be(KMIP *ctx, void *value)
+kmip_decode_new_text_string(KMIP *ctx, enum tag t, TextString **value, const char *name)
 {
-    CHECK_BUFFER_FULL(ctx, sizeof(int8));
+    CHECK_BUFFER_FULL(ctx, 8);
     
-    int8 *i = (int8*)value;
+    /* NOTE (ph) Peek at the length so a short value can be decoded into */
+    /*      the same allocation as its TextString. Borrowed values point */
+    /*      into the buffer and need no storage at all.                  */
+    size_t length = kmip_load_uint32_be(ctx->index + 4);
+    if(ctx->borrow_strings == KMIP_TRUE || length > KMIP_TEXT_STRING_INLINE_CAPACITY)
+    {
+        length = 0;
+    }
     
-    *i = 0;
-    *i = *ctx->index++;
+    TextString *string = kmip_new_text_string(ctx, length);
+    CHECK_NEW_MEMORY(ctx, string, sizeof(TextString) + length, name);
+    *value = string;
+    
+    int result = kmip_decode_text_string(ctx, t, string);
+    CHECK_RESULT(ctx, result);
     
     return(KMIP_OK);
 }
 
 int
-kmip_decode_int32_be(KMIP *ctx, void *value)
+kmip_decode_byte_string(KMIP *ctx, enum tag t, ByteString *value)
 {
-    CHECK_BUFFER_FULL(ctx, sizeof(int32));
+    CHECK_BUFFER_FULL(ctx, 8);
     
-    int32 *i = (int32*)value;
+    int32 tag_type = 0;
+    int32 length = 0;
+    int32 padding = 0;
     
-    *i = 0;
-    *i |= ((int32)*ctx->index++ << 24);
-    *i |= ((int32)*ctx->index++ << 16);
-    *i |= ((int32)*ctx->index++ << 8);
-    *i |= ((int32)*ctx->index++ << 0);
+    kmip_decode_int32_be(ctx, &tag_type);
+    CHECK_TAG_TYPE(ctx, tag_type, t, KMIP_TYPE_BYTE_STRING);
+    
+    kmip_decode_int32_be(ctx, &length);
+    padding = (8 - (length % 8)) % 8;
+    CHECK_BUFFER_FULL(ctx, (uint32)(length + padding));
+    
+    if(ctx->borrow_strings == KMIP_TRUE)
+    {
+        /* NOTE (ph) Borrowed values point into the context buffer and */
+        /* are only valid while that buffer is unchanged.              */
+        value->value = (uint8 *)ctx->index;
+        value->size = length;
+        value->borrowed = KMIP_TRUE;
+        
+        ctx->index += length;
+    }
+    else
+    {
+        if(t == KMIP_TAG_KEY_MATERIAL || t == KMIP_TAG_KEY)
+        {
+            value->value = kmip_calloc_secret(ctx, 1, length);
+        }
+        else
+        {
+            value->value = ctx->calloc_func(ctx->state, 1, length);
+        }
+        value->size = length;
+        
+        if(length > 0)
+        {
+            CHECK_NEW_MEMORY(ctx, value->value, length, "ByteString value");
+            memcpy(value->value, ctx->index, length);
+            ctx->index += length;
+        }
+    }
+    CHECK_PADDING_BYTES(ctx, padding);
     
     return(KMIP_OK);
 }
 
 int
-kmip_decode_int64_be(KMIP *ctx, void *value)
+kmip_decode_date_time(KMIP *ctx, enum tag t, uint64 *value)
 {
-    CHECK_BUFFER_FULL(ctx, sizeof(int64));
+    CHECK_BUFFER_FULL(ctx, 16);
     
-    int64 *i = (int64*)value;
+    int32 tag_type = 0;
+    int32 length = 0;
     
-    *i = 0;
-    *i |= ((int64)*ctx->index++ << 56);
-    *i |= ((int64)*ctx->index++ << 48);
-    *i |= ((int64)*ctx->index++ << 40);
-    *i |= ((int64)*ctx->index++ << 32);
-    *i |= ((int64)*ctx->index++ << 24);
-    *i |= ((int64)*ctx->index++ << 16);
-    *i |= ((int64)*ctx->index++ << 8);
-    *i |= ((int64)*ctx->index++ << 0);
+    kmip_decode_int32_be(ctx, &tag_type);
+    CHECK_TAG_TYPE(ctx, tag_type, t, KMIP_TYPE_DATE_TIME);
+    
+    kmip_decode_int32_be(ctx, &length);
+    CHECK_LENGTH(ctx, length, 8);
+    
+    kmip_decode_int64_be(ctx, value);
     
     return(KMIP_OK);
 }
 
 int
-kmip_decode_integer(KMIP *ctx, enum tag t, int32 *value)
+kmip_decode_interval(KMIP *ctx, enum tag t, uint32 *value)
 {
     CHECK_BUFFER_FULL(ctx, 16);
     
@@ -10298,7 +13349,7 @@ kmip_decode_integer(KMIP *ctx, enum tag t, int32 *value)
     int32 padding = 0;
     
     kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, t, KMIP_TYPE_INTEGER);
+    CHECK_TAG_TYPE(ctx, tag_type, t, KMIP_TYPE_INTERVAL);
     
     kmip_decode_int32_be(ctx, &length);
     CHECK_LENGTH(ctx, length, 4);
@@ -10312,271 +13363,460 @@ kmip_decode_integer(KMIP *ctx, enum tag t, int32 *value)
 }
 
 int
-kmip_decode_long(KMIP *ctx, enum tag t, int64 *value)
+kmip_decode_name(KMIP *ctx, Name *value)
 {
-    CHECK_BUFFER_FULL(ctx, 16);
+    int result = kmip_decode_schema(ctx, &kmip_name_schema, value);
+    CHECK_RESULT(ctx, result);
+    
+    return(KMIP_OK);
+}
+
+int
+kmip_decode_attribute_name(KMIP *ctx, enum attribute_type *value)
+{
+    int result = 0;
+    enum tag t = KMIP_TAG_ATTRIBUTE_NAME;
+    TextString n = {0};
+    
+    result = kmip_decode_text_string(ctx, t, &n);
+    CHECK_RESULT(ctx, result);
+    
+    int type = kmip_get_attribute_type(n.value, n.size);
+    kmip_free_text_string(ctx, &n);
+    
+    /* NOTE (ph) With skip_unknown set, unknown names come back unset so */
+    /*      the caller can skip the whole attribute.                     */
+    if(type == KMIP_UNSET && ctx->skip_unknown != KMIP_TRUE)
+    {
+        kmip_push_error_frame(ctx, __func__, __LINE__);
+        return(KMIP_ERROR_ATTR_UNSUPPORTED);
+    }
     
+    *value = type;
+    return(KMIP_OK);
+}
+
+int
+kmip_decode_protection_storage_masks(KMIP *ctx, ProtectionStorageMasks *value)
+{
+    CHECK_DECODE_ARGS(ctx, value);
+    CHECK_KMIP_VERSION(ctx, KMIP_2_0);
+    CHECK_BUFFER_FULL(ctx, 8);
+
+    int result = 0;
     int32 tag_type = 0;
-    int32 length = 0;
+    uint32 length = 0;
+
+    result = kmip_decode_int32_be(ctx, &tag_type);
+    CHECK_RESULT(ctx, result);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_PROTECTION_STORAGE_MASKS, KMIP_TYPE_STRUCTURE);
+
+    result = kmip_decode_int32_be(ctx, &length);
+    CHECK_RESULT(ctx, result);
+    CHECK_BUFFER_FULL(ctx, length);
+
+    kmip_init_vector(&value->masks);
+
+    uint32 tag = kmip_peek_tag(ctx);
+    while(tag == KMIP_TAG_PROTECTION_STORAGE_MASK)
+    {
+        int32 *mask = ctx->calloc_func(ctx->state, 1, sizeof(int32));
+        CHECK_NEW_MEMORY(ctx, mask, sizeof(int32), "Protection Storage Mask");
+        if(kmip_vector_append(ctx, &value->masks, mask) != KMIP_OK)
+        {
+            ctx->free_func(ctx->state, mask);
+            HANDLE_FAILED_ALLOC(ctx, sizeof(void *), "KMIPVector");
+        }
+
+        result = kmip_decode_integer(ctx, KMIP_TAG_PROTECTION_STORAGE_MASK, mask);
+        CHECK_RESULT(ctx, result);
+
+        tag = kmip_peek_tag(ctx);
+    }
+
+    return(KMIP_OK);
+}
+
+int
+kmip_decode_attribute_v1(KMIP *ctx, Attribute *value)
+{
+    CHECK_BUFFER_FULL(ctx, 8);
+    
+    kmip_init_attribute(value);
+    
+    int result = 0;
+    int32 tag_type = 0;
+    uint32 length = 0;
+    uint8 *attribute_start = ctx->index;
     
     kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, t, KMIP_TYPE_LONG_INTEGER);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_ATTRIBUTE, KMIP_TYPE_STRUCTURE);
     
     kmip_decode_int32_be(ctx, &length);
-    CHECK_LENGTH(ctx, length, 8);
+    CHECK_BUFFER_FULL(ctx, length);
     
-    kmip_decode_int64_be(ctx, value);
+    result = kmip_decode_attribute_name(ctx, &value->type);
+    CHECK_RESULT(ctx, result);
+    
+    if((int)value->type == KMIP_UNSET)
+    {
+        ctx->index = attribute_start;
+        result = kmip_skip_item(ctx);
+        CHECK_RESULT(ctx, result);
+        
+        return(KMIP_OK);
+    }
+    
+    if(kmip_is_tag_next(ctx, KMIP_TAG_ATTRIBUTE_INDEX))
+    {
+        result = kmip_decode_integer(ctx, KMIP_TAG_ATTRIBUTE_INDEX, &value->index);
+        CHECK_RESULT(ctx, result);
+    }
+    
+    uint8 *curr_index = ctx->index;
+    uint8 *tag_index = ctx->index;
+    enum tag t = KMIP_TAG_ATTRIBUTE_VALUE;
+    
+    switch(value->type)
+    {
+        case KMIP_ATTR_APPLICATION_SPECIFIC_INFORMATION:
+        {
+            /* TODO (ph) Like encoding, this is messy. Better solution? */
+            if(kmip_is_tag_type_next(ctx, KMIP_TAG_ATTRIBUTE_VALUE, KMIP_TYPE_STRUCTURE))
+            {
+                /* NOTE (ph) Decoding structures will fail if the structure tag */
+                /* is not present in the encoding. Temporarily swap the tags, */
+                /* decode the structure, and then swap the tags back to */
+                /* preserve the encoding. The tag/type check above guarantees */
+                /* space exists for this to succeed. */
+                kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_APPLICATION_SPECIFIC_INFORMATION, KMIP_TYPE_STRUCTURE));
+                ctx->index = tag_index;
+                value->value = ctx->calloc_func(ctx->state, 1, sizeof(ApplicationSpecificInformation));
+                CHECK_NEW_MEMORY(ctx, value->value, sizeof(ApplicationSpecificInformation), "ApplicationSpecificInformation structure");
+                result = kmip_decode_application_specific_information(ctx, (ApplicationSpecificInformation*)value->value);
+
+                curr_index = ctx->index;
+                ctx->index = tag_index;
+
+                kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_ATTRIBUTE_VALUE, KMIP_TYPE_STRUCTURE));
+                ctx->index = curr_index;
+            }
+            else
+            {
+                result = KMIP_TAG_MISMATCH;
+            }
+
+            CHECK_RESULT(ctx, result);
+
+        }
+        break;
+
+        case KMIP_ATTR_UNIQUE_IDENTIFIER:
+        {
+            TextString *string = NULL;
+            result = kmip_decode_new_text_string(ctx, t, &string, "UniqueIdentifier text string");
+            value->value = string;
+            CHECK_RESULT(ctx, result);
+        } break;
+        
+        case KMIP_ATTR_NAME:
+        {
+            /* TODO (ph) Like encoding, this is messy. Better solution? */
+            if(kmip_is_tag_type_next(ctx, KMIP_TAG_ATTRIBUTE_VALUE, KMIP_TYPE_STRUCTURE))
+            {
+                /* NOTE (ph) Decoding structures will fail if the structure tag */
+                /* is not present in the encoding. Temporarily swap the tags, */
+                /* decode the structure, and then swap the tags back to */
+                /* preserve the encoding. The tag/type check above guarantees */
+                /* space exists for this to succeed. */
+                kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_NAME, KMIP_TYPE_STRUCTURE));
+                ctx->index = tag_index;
+                value->value = ctx->calloc_func(ctx->state, 1, sizeof(Name));
+                CHECK_NEW_MEMORY(ctx, value->value, sizeof(Name), "Name structure");
+                result = kmip_decode_name(ctx, (Name*)value->value);
+
+                curr_index = ctx->index;
+                ctx->index = tag_index;
+
+                kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_ATTRIBUTE_VALUE, KMIP_TYPE_STRUCTURE));
+                ctx->index = curr_index;
+            }
+            else
+            {
+                result = KMIP_TAG_MISMATCH;
+            }
+
+            CHECK_RESULT(ctx, result);
+        }
+        break;
+        
+        case KMIP_ATTR_OBJECT_TYPE:
+        value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
+        CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "ObjectType enumeration");
+        result = kmip_decode_enum(ctx, t, (int32 *)value->value);
+        CHECK_RESULT(ctx, result);
+        CHECK_ENUM(ctx, KMIP_TAG_OBJECT_TYPE, *(int32 *)value->value);
+        break;
+        
+        case KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM:
+        value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
+        CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "CryptographicAlgorithm enumeration");
+        result = kmip_decode_enum(ctx, t, (int32 *)value->value);
+        CHECK_RESULT(ctx, result);
+        CHECK_ENUM(ctx, KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM, *(int32 *)value->value);
+        break;
+        
+        case KMIP_ATTR_CRYPTOGRAPHIC_LENGTH:
+        value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
+        CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "CryptographicLength integer");
+        result = kmip_decode_integer(ctx, t, (int32 *)value->value);
+        CHECK_RESULT(ctx, result);
+        break;
+        
+        case KMIP_ATTR_OPERATION_POLICY_NAME:
+        {
+            TextString *string = NULL;
+            result = kmip_decode_new_text_string(ctx, t, &string, "OperationPolicyName text string");
+            value->value = string;
+            CHECK_RESULT(ctx, result);
+        } break;
+        
+        case KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK:
+        value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
+        CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "CryptographicUsageMask integer");
+        result = kmip_decode_integer(ctx, t, (int32 *)value->value);
+        CHECK_RESULT(ctx, result);
+        break;
+        
+        case KMIP_ATTR_STATE:
+        value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
+        CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "State enumeration");
+        result = kmip_decode_enum(ctx, t, (int32 *)value->value);
+        CHECK_RESULT(ctx, result);
+        CHECK_ENUM(ctx, KMIP_TAG_STATE, *(int32 *)value->value);
+        break;
+        
+        case KMIP_ATTR_DIGITAL_SIGNATURE_ALGORITHM:
+        value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
+        CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "DigitalSignatureAlgorithm enumeration");
+        result = kmip_decode_enum(ctx, t, (int32 *)value->value);
+        CHECK_RESULT(ctx, result);
+        CHECK_ENUM(ctx, KMIP_TAG_DIGITAL_SIGNATURE_ALGORITHM, *(int32 *)value->value);
+        break;
+        
+        default:
+        /* NOTE (ph) Remaining KMIP 1.x attributes with primitive values are */
+        /*      decoded directly from their value type. Structured values   */
+        /*      still need dedicated support above.                         */
+        switch(kmip_get_attribute_value_type(value->type))
+        {
+            case KMIP_TYPE_TEXT_STRING:
+            {
+                TextString *string = NULL;
+                result = kmip_decode_new_text_string(ctx, t, &string, "Attribute text string");
+                value->value = string;
+            } break;
+            
+            case KMIP_TYPE_INTEGER:
+            value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
+            CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "Attribute integer");
+            result = kmip_decode_integer(ctx, t, (int32 *)value->value);
+            break;
+            
+            case KMIP_TYPE_ENUMERATION:
+            value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
+            CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "Attribute enumeration");
+            result = kmip_decode_enum(ctx, t, (int32 *)value->value);
+            break;
+            
+            case KMIP_TYPE_BOOLEAN:
+            value->value = ctx->calloc_func(ctx->state, 1, sizeof(bool32));
+            CHECK_NEW_MEMORY(ctx, value->value, sizeof(bool32), "Attribute boolean");
+            result = kmip_decode_bool(ctx, t, (bool32 *)value->value);
+            break;
+            
+            case KMIP_TYPE_DATE_TIME:
+            value->value = ctx->calloc_func(ctx->state, 1, sizeof(uint64));
+            CHECK_NEW_MEMORY(ctx, value->value, sizeof(uint64), "Attribute date time");
+            result = kmip_decode_date_time(ctx, t, (uint64 *)value->value);
+            break;
+            
+            case KMIP_TYPE_INTERVAL:
+            value->value = ctx->calloc_func(ctx->state, 1, sizeof(uint32));
+            CHECK_NEW_MEMORY(ctx, value->value, sizeof(uint32), "Attribute interval");
+            result = kmip_decode_interval(ctx, t, (uint32 *)value->value);
+            break;
+            
+            default:
+            if(ctx->skip_unknown == KMIP_TRUE)
+            {
+                ctx->index = attribute_start;
+                value->type = KMIP_UNSET;
+                value->index = KMIP_UNSET;
+                result = kmip_skip_item(ctx);
+                CHECK_RESULT(ctx, result);
+                
+                return(KMIP_OK);
+            }
+            kmip_push_error_frame(ctx, __func__, __LINE__);
+            return(KMIP_ERROR_ATTR_UNSUPPORTED);
+            break;
+        };
+        CHECK_RESULT(ctx, result);
+        break;
+    };
+    CHECK_RESULT(ctx, result);
     
     return(KMIP_OK);
 }
 
 int
-kmip_decode_enum(KMIP *ctx, enum tag t, void *value)
+kmip_decode_attribute_v2(KMIP *ctx, Attribute *value)
 {
-    CHECK_BUFFER_FULL(ctx, 16);
-    
-    int32 tag_type = 0;
-    int32 length = 0;
-    int32 *v = (int32*)value;
-    int32 padding = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, t, KMIP_TYPE_ENUMERATION);
-    
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_LENGTH(ctx, length, 4);
-    
-    kmip_decode_int32_be(ctx, v);
-    
-    kmip_decode_int32_be(ctx, &padding);
-    CHECK_PADDING(ctx, padding);
-    
-    return(KMIP_OK);
-}
+    CHECK_DECODE_ARGS(ctx, value);
+    CHECK_KMIP_VERSION(ctx, KMIP_2_0);
 
-int
-kmip_decode_bool(KMIP *ctx, enum tag t, bool32 *value)
-{
-    CHECK_BUFFER_FULL(ctx, 16);
-    
-    int32 tag_type = 0;
-    int32 length = 0;
-    int32 padding = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, t, KMIP_TYPE_BOOLEAN);
-    
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_LENGTH(ctx, length, 8);
-    
-    kmip_decode_int32_be(ctx, &padding);
-    CHECK_PADDING(ctx, padding);
-    
-    kmip_decode_int32_be(ctx, value);
-    CHECK_BOOLEAN(ctx, *value);
-    
-    return(KMIP_OK);
-}
+    kmip_init_attribute(value);
 
-int
-kmip_decode_text_string(KMIP *ctx, enum tag t, TextString *value)
-{
-    CHECK_BUFFER_FULL(ctx, 8);
-    
-    int32 tag_type = 0;
-    int32 length = 0;
-    int32 padding = 0;
-    int8 spacer = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, t, KMIP_TYPE_TEXT_STRING);
-    
-    kmip_decode_int32_be(ctx, &length);
-    padding = (8 - (length % 8)) % 8;
-    CHECK_BUFFER_FULL(ctx, (uint32)(length + padding));
-    
-    value->value = ctx->calloc_func(ctx->state, 1, length);
-    value->size = length;
-    
-    char *index = value->value;
-    
-    for(int32 i = 0; i < length; i++)
-    {
-        kmip_decode_int8_be(ctx, (int8*)index++);
-    }
-    for(int32 i = 0; i < padding; i++)
+    int result = 0;
+    uint32 tag = kmip_peek_tag(ctx);
+    if(tag == 0)
     {
-        kmip_decode_int8_be(ctx, &spacer);
-        CHECK_PADDING(ctx, spacer);
+        /* Record an error for an underfull buffer here and return. */
     }
-    
-    return(KMIP_OK);
-}
 
-int
-kmip_decode_byte_string(KMIP *ctx, enum tag t, ByteString *value)
-{
-    CHECK_BUFFER_FULL(ctx, 8);
-    
-    int32 tag_type = 0;
-    int32 length = 0;
-    int32 padding = 0;
-    int8 spacer = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, t, KMIP_TYPE_BYTE_STRING);
-    
-    kmip_decode_int32_be(ctx, &length);
-    padding = (8 - (length % 8)) % 8;
-    CHECK_BUFFER_FULL(ctx, (uint32)(length + padding));
-    
-    value->value = ctx->calloc_func(ctx->state, 1, length);
-    value->size = length;
-    
-    uint8 *index = value->value;
-    
-    for(int32 i = 0; i < length; i++)
-    {
-        kmip_decode_int8_be(ctx, index++);
-    }
-    for(int32 i = 0; i < padding; i++)
+    CHECK_RESULT(ctx, result);
+
+    switch(tag)
     {
-        kmip_decode_int8_be(ctx, &spacer);
-        CHECK_PADDING(ctx, spacer);
-    }
-    
-    return(KMIP_OK);
-}
+        case KMIP_TAG_UNIQUE_IDENTIFIER:
+        {
+            value->type = KMIP_ATTR_UNIQUE_IDENTIFIER;
+            TextString *string = NULL;
+            result = kmip_decode_new_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, &string, "UniqueIdentifier text string");
+            value->value = string;
+            CHECK_RESULT(ctx, result);
+        }
+        break;
 
-int
-kmip_decode_date_time(KMIP *ctx, enum tag t, uint64 *value)
-{
-    CHECK_BUFFER_FULL(ctx, 16);
-    
-    int32 tag_type = 0;
-    int32 length = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, t, KMIP_TYPE_DATE_TIME);
-    
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_LENGTH(ctx, length, 8);
-    
-    kmip_decode_int64_be(ctx, value);
-    
-    return(KMIP_OK);
-}
+        case KMIP_TAG_NAME:
+        {
+            value->type = KMIP_ATTR_NAME;
+            value->value = ctx->calloc_func(ctx->state, 1, sizeof(Name));
+            CHECK_NEW_MEMORY(ctx, value->value, sizeof(Name), "Name structure");
 
-int
-kmip_decode_interval(KMIP *ctx, enum tag t, uint32 *value)
-{
-    CHECK_BUFFER_FULL(ctx, 16);
-    
-    int32 tag_type = 0;
-    int32 length = 0;
-    int32 padding = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, t, KMIP_TYPE_INTERVAL);
-    
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_LENGTH(ctx, length, 4);
-    
-    kmip_decode_int32_be(ctx, value);
-    
-    kmip_decode_int32_be(ctx, &padding);
-    CHECK_PADDING(ctx, padding);
-    
-    return(KMIP_OK);
-}
+            result = kmip_decode_name(ctx, (Name *)value->value);
+            CHECK_RESULT(ctx, result);
+        }
+        break;
+
+        case KMIP_TAG_OBJECT_TYPE:
+        {
+            value->type = KMIP_ATTR_OBJECT_TYPE;
+            value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
+            CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "ObjectType enumeration");
+
+            result = kmip_decode_enum(ctx, KMIP_TAG_OBJECT_TYPE, (int32 *)value->value);
+            CHECK_RESULT(ctx, result);
+
+            CHECK_ENUM(ctx, KMIP_TAG_OBJECT_TYPE, *(int32 *)value->value);
+        }
+        break;
+
+        case KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM:
+        {
+            value->type = KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM;
+            value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
+            CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "CrypographicAlgorithm enumeration");
+
+            result = kmip_decode_enum(ctx, KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM, (int32 *)value->value);
+            CHECK_RESULT(ctx, result);
+
+            CHECK_ENUM(ctx, KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM, *(int32 *)value->value);
+        }
+        break;
+
+        case KMIP_TAG_CRYPTOGRAPHIC_LENGTH:
+        {
+            value->type = KMIP_ATTR_CRYPTOGRAPHIC_LENGTH;
+            value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
+            CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "CryptographicLength integer");
+
+            result = kmip_decode_integer(ctx, KMIP_TAG_CRYPTOGRAPHIC_LENGTH, (int32 *)value->value);
+            CHECK_RESULT(ctx, result);
+        }
+        break;
+
+        case KMIP_TAG_CRYPTOGRAPHIC_USAGE_MASK:
+        {
+            value->type = KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK;
+            value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
+            CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "CryptographicUsageMask integer");
+
+            result = kmip_decode_integer(ctx, KMIP_TAG_CRYPTOGRAPHIC_USAGE_MASK, (int32 *)value->value);
+            CHECK_RESULT(ctx, result);
+        }
+        break;
+
+        case KMIP_TAG_STATE:
+        {
+            value->type = KMIP_ATTR_STATE;
+            value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
+            CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "State enumeration");
+
+            result = kmip_decode_enum(ctx, KMIP_TAG_STATE, (int32 *)value->value);
+            CHECK_RESULT(ctx, result);
+
+            CHECK_ENUM(ctx, KMIP_TAG_STATE, *(int32 *)value->value);
+        }
+        break;
+
+        case KMIP_TAG_APPLICATION_SPECIFIC_INFORMATION:
+        {
+            value->type = KMIP_ATTR_APPLICATION_SPECIFIC_INFORMATION;
+            value->value = ctx->calloc_func(ctx->state, 1, sizeof(ApplicationSpecificInformation));
+            CHECK_NEW_MEMORY(ctx, value->value, sizeof(ApplicationSpecificInformation), "ApplicationSpecificInformation structure");
+
+            result = kmip_decode_application_specific_information(ctx, value->value);
+            CHECK_RESULT(ctx, result);
+        }
+        break;
+
+        default:
+        {
+            if(ctx->skip_unknown == KMIP_TRUE)
+            {
+                value->type = KMIP_UNSET;
+                result = kmip_skip_item(ctx);
+                CHECK_RESULT(ctx, result);
+                break;
+            }
+            kmip_push_error_frame(ctx, __func__, __LINE__);
+            return(KMIP_ERROR_ATTR_UNSUPPORTED);
+        }
+        break;
+    };
 
-int
-kmip_decode_name(KMIP *ctx, Name *value)
-{
-    CHECK_BUFFER_FULL(ctx, 8);
-    
-    int result = 0;
-    int32 tag_type = 0;
-    uint32 length = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_NAME, KMIP_TYPE_STRUCTURE);
-    
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_BUFFER_FULL(ctx, length);
-    
-    value->value = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-    
-    result = kmip_decode_text_string(ctx, KMIP_TAG_NAME_VALUE, value->value);
-    CHECK_RESULT(ctx, result);
-    
-    result = kmip_decode_enum(ctx, KMIP_TAG_NAME_TYPE, (int32*)&value->type);
-    CHECK_RESULT(ctx, result);
-    CHECK_ENUM(ctx, KMIP_TAG_NAME_TYPE, value->type);
-    
     return(KMIP_OK);
 }
 
 int
-kmip_decode_attribute_name(KMIP *ctx, enum attribute_type *value)
+kmip_decode_attribute(KMIP *ctx, Attribute *value)
 {
-    int result = 0;
-    enum tag t = KMIP_TAG_ATTRIBUTE_NAME;
-    TextString n = {0};
-    
-    result = kmip_decode_text_string(ctx, t, &n);
-    CHECK_RESULT(ctx, result);
-    
-    if((n.size == 32) && (strncmp(n.value, "Application Specific Information", 32) == 0))
-    {
-        *value = KMIP_ATTR_APPLICATION_SPECIFIC_INFORMATION;
-    }
-    else if((n.size == 17) && (strncmp(n.value, "Unique Identifier", 17) == 0))
-    {
-        *value = KMIP_ATTR_UNIQUE_IDENTIFIER;
-    }
-    else if((n.size == 4) && (strncmp(n.value, "Name", 4) == 0))
-    {
-        *value = KMIP_ATTR_NAME;
-    }
-    else if((n.size == 11) && (strncmp(n.value, "Object Type", 11) == 0))
-    {
-        *value = KMIP_ATTR_OBJECT_TYPE;
-    }
-    else if((n.size == 23) && (strncmp(n.value, "Cryptographic Algorithm", 23) == 0))
-    {
-        *value = KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM;
-    }
-    else if((n.size == 20) && (strncmp(n.value, "Cryptographic Length", 20) == 0))
-    {
-        *value = KMIP_ATTR_CRYPTOGRAPHIC_LENGTH;
-    }
-    else if((n.size == 21) && (strncmp(n.value, "Operation Policy Name", 21) == 0))
-    {
-        *value = KMIP_ATTR_OPERATION_POLICY_NAME;
-    }
-    else if((n.size == 24) && (strncmp(n.value, "Cryptographic Usage Mask", 24) == 0))
-    {
-        *value = KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK;
-    }
-    else if((n.size == 5) && (strncmp(n.value, "State", 5) == 0))
+    CHECK_DECODE_ARGS(ctx, value);
+
+    if(ctx->version < KMIP_2_0)
     {
-        *value = KMIP_ATTR_STATE;
+        return(kmip_decode_attribute_v1(ctx, value));
     }
-    /* TODO (ph) Add all remaining attributes here. */
     else
     {
-        kmip_push_error_frame(ctx, __func__, __LINE__);
-        kmip_free_text_string(ctx, &n);
-        return(KMIP_ERROR_ATTR_UNSUPPORTED);
+        return(kmip_decode_attribute_v2(ctx, value));
     }
-    
-    kmip_free_text_string(ctx, &n);
-    return(KMIP_OK);
 }
 
 int
-kmip_decode_protection_storage_masks(KMIP *ctx, ProtectionStorageMasks *value)
+kmip_decode_attributes(KMIP *ctx, Attributes *value)
 {
     CHECK_DECODE_ARGS(ctx, value);
     CHECK_KMIP_VERSION(ctx, KMIP_2_0);
@@ -10588,373 +13828,450 @@ kmip_decode_protection_storage_masks(KMIP *ctx, ProtectionStorageMasks *value)
 
     result = kmip_decode_int32_be(ctx, &tag_type);
     CHECK_RESULT(ctx, result);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_PROTECTION_STORAGE_MASKS, KMIP_TYPE_STRUCTURE);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_ATTRIBUTES, KMIP_TYPE_STRUCTURE);
 
     result = kmip_decode_int32_be(ctx, &length);
     CHECK_RESULT(ctx, result);
     CHECK_BUFFER_FULL(ctx, length);
+    uint8 *end = ctx->index + length;
 
-    value->masks = ctx->calloc_func(ctx->state, 1, sizeof(LinkedList));
-    CHECK_NEW_MEMORY(ctx, value->masks, sizeof(LinkedList), "LinkedList");
+    kmip_init_vector(&value->attribute_list);
 
     uint32 tag = kmip_peek_tag(ctx);
-    while(tag == KMIP_TAG_PROTECTION_STORAGE_MASK)
+    while(tag != 0 && ctx->index < end)
     {
-        LinkedListItem *item = ctx->calloc_func(ctx->state, 1, sizeof(LinkedListItem));
-        CHECK_NEW_MEMORY(ctx, item, sizeof(LinkedListItem), "LinkedListItem");
-        kmip_linked_list_enqueue(value->masks, item);
+        if(!kmip_is_attribute_tag(tag))
+        {
+            if(ctx->skip_unknown != KMIP_TRUE)
+            {
+                break;
+            }
+            
+            result = kmip_skip_item(ctx);
+            CHECK_RESULT(ctx, result);
+            
+            tag = kmip_peek_tag(ctx);
+            continue;
+        }
 
-        item->data = ctx->calloc_func(ctx->state, 1, sizeof(int32));
-        CHECK_NEW_MEMORY(ctx, item->data, sizeof(int32), "Protection Storage Mask");
+        Attribute *attribute = ctx->calloc_func(ctx->state, 1, sizeof(Attribute));
+        CHECK_NEW_MEMORY(ctx, attribute, sizeof(Attribute), "Attribute");
+        if(kmip_vector_append(ctx, &value->attribute_list, attribute) != KMIP_OK)
+        {
+            ctx->free_func(ctx->state, attribute);
+            HANDLE_FAILED_ALLOC(ctx, sizeof(void *), "KMIPVector");
+        }
 
-        result = kmip_decode_integer(ctx, KMIP_TAG_PROTECTION_STORAGE_MASK, (int32 *)item->data);
+        result = kmip_decode_attribute(ctx, attribute);
         CHECK_RESULT(ctx, result);
 
+        /* NOTE (ph) An attribute skipped with skip_unknown set leaves an */
+        /*      unset placeholder at the end of the list; drop it again.  */
+        if((int)attribute->type == KMIP_UNSET)
+        {
+            kmip_vector_pop(&value->attribute_list);
+            ctx->free_func(ctx->state, attribute);
+        }
+
         tag = kmip_peek_tag(ctx);
     }
 
+    kmip_index_attributes(value);
+
     return(KMIP_OK);
 }
 
 int
-kmip_decode_attribute_v1(KMIP *ctx, Attribute *value)
+kmip_decode_template_attribute(KMIP *ctx, TemplateAttribute *value)
 {
     CHECK_BUFFER_FULL(ctx, 8);
     
-    kmip_init_attribute(value);
-    
     int result = 0;
     int32 tag_type = 0;
     uint32 length = 0;
     
     kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_ATTRIBUTE, KMIP_TYPE_STRUCTURE);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_TEMPLATE_ATTRIBUTE, KMIP_TYPE_STRUCTURE);
     
     kmip_decode_int32_be(ctx, &length);
     CHECK_BUFFER_FULL(ctx, length);
-    
-    result = kmip_decode_attribute_name(ctx, &value->type);
-    CHECK_RESULT(ctx, result);
-    
-    if(kmip_is_tag_next(ctx, KMIP_TAG_ATTRIBUTE_INDEX))
-    {
-        result = kmip_decode_integer(ctx, KMIP_TAG_ATTRIBUTE_INDEX, &value->index);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    uint8 *curr_index = ctx->index;
-    uint8 *tag_index = ctx->index;
-    enum tag t = KMIP_TAG_ATTRIBUTE_VALUE;
-    
-    switch(value->type)
-    {
-        case KMIP_ATTR_APPLICATION_SPECIFIC_INFORMATION:
+    uint8 *end = ctx->index + length;
+    
+    /* NOTE (ph) Names come before Attributes, but with skip_unknown   */
+    /*      set an unknown item may sit anywhere, so each item is      */
+    /*      dispatched on its tag until the end of the structure.      */
+    size_t name_capacity = 0;
+    size_t attribute_capacity = 0;
+    value->names = NULL;
+    value->name_count = 0;
+    value->attributes = NULL;
+    value->attribute_count = 0;
+    while(ctx->index < end)
+    {
+        if(kmip_is_tag_next(ctx, KMIP_TAG_NAME))
+        {
+            Name *names = kmip_grow_items(ctx, value->names, &name_capacity, value->name_count, sizeof(Name));
+            CHECK_NEW_MEMORY(ctx, names, (value->name_count + 1) * sizeof(Name), "sequence of Name structures");
+            value->names = names;
+            
+            result = kmip_decode_name(ctx, &value->names[value->name_count++]);
+            CHECK_RESULT(ctx, result);
+        }
+        else if(kmip_is_tag_next(ctx, KMIP_TAG_ATTRIBUTE))
         {
-            /* TODO (ph) Like encoding, this is messy. Better solution? */
-            if(kmip_is_tag_type_next(ctx, KMIP_TAG_ATTRIBUTE_VALUE, KMIP_TYPE_STRUCTURE))
-            {
-                /* NOTE (ph) Decoding structures will fail if the structure tag */
-                /* is not present in the encoding. Temporarily swap the tags, */
-                /* decode the structure, and then swap the tags back to */
-                /* preserve the encoding. The tag/type check above guarantees */
-                /* space exists for this to succeed. */
-                kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_APPLICATION_SPECIFIC_INFORMATION, KMIP_TYPE_STRUCTURE));
-                ctx->index = tag_index;
-                value->value = ctx->calloc_func(ctx->state, 1, sizeof(ApplicationSpecificInformation));
-                CHECK_NEW_MEMORY(ctx, value->value, sizeof(ApplicationSpecificInformation), "ApplicationSpecificInformation structure");
-                result = kmip_decode_application_specific_information(ctx, (ApplicationSpecificInformation*)value->value);
-
-                curr_index = ctx->index;
-                ctx->index = tag_index;
-
-                kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_ATTRIBUTE_VALUE, KMIP_TYPE_STRUCTURE));
-                ctx->index = curr_index;
-            }
-            else
+            Attribute *attributes = kmip_grow_items(ctx, value->attributes, &attribute_capacity, value->attribute_count, sizeof(Attribute));
+            CHECK_NEW_MEMORY(ctx, attributes, (value->attribute_count + 1) * sizeof(Attribute), "sequence of Attribute structures");
+            value->attributes = attributes;
+            
+            result = kmip_decode_attribute(ctx, &value->attributes[value->attribute_count++]);
+            CHECK_RESULT(ctx, result);
+            
+            /* Attributes skipped with skip_unknown set give back their slot. */
+            if((int)value->attributes[value->attribute_count - 1].type == KMIP_UNSET)
             {
-                result = KMIP_TAG_MISMATCH;
+                value->attribute_count--;
             }
-
+        }
+        else if(ctx->skip_unknown == KMIP_TRUE)
+        {
+            result = kmip_skip_item(ctx);
             CHECK_RESULT(ctx, result);
-
         }
-        break;
-
-        case KMIP_ATTR_UNIQUE_IDENTIFIER:
-        value->value = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-        CHECK_NEW_MEMORY(ctx, value->value, sizeof(TextString), "UniqueIdentifier text string");
-        result = kmip_decode_text_string(ctx, t, (TextString*)value->value);
-        CHECK_RESULT(ctx, result);
-        break;
-        
-        case KMIP_ATTR_NAME:
+        else
         {
-            /* TODO (ph) Like encoding, this is messy. Better solution? */
-            if(kmip_is_tag_type_next(ctx, KMIP_TAG_ATTRIBUTE_VALUE, KMIP_TYPE_STRUCTURE))
-            {
-                /* NOTE (ph) Decoding structures will fail if the structure tag */
-                /* is not present in the encoding. Temporarily swap the tags, */
-                /* decode the structure, and then swap the tags back to */
-                /* preserve the encoding. The tag/type check above guarantees */
-                /* space exists for this to succeed. */
-                kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_NAME, KMIP_TYPE_STRUCTURE));
-                ctx->index = tag_index;
-                value->value = ctx->calloc_func(ctx->state, 1, sizeof(Name));
-                CHECK_NEW_MEMORY(ctx, value->value, sizeof(Name), "Name structure");
-                result = kmip_decode_name(ctx, (Name*)value->value);
+            break;
+        }
+    }
+    value->names = kmip_trim_items(ctx, value->names, name_capacity, value->name_count, sizeof(Name));
+    value->attributes = kmip_trim_items(ctx, value->attributes, attribute_capacity, value->attribute_count, sizeof(Attribute));
+    kmip_index_template_attribute(value);
+    
+    return(KMIP_OK);
+}
 
-                curr_index = ctx->index;
-                ctx->index = tag_index;
+int
+kmip_decode_protocol_version(KMIP *ctx, ProtocolVersion *value)
+{
+    CHECK_BUFFER_FULL(ctx, 40);
+    
+    int result = 0;
+    int32 tag_type = 0;
+    uint32 length = 0;
+    
+    kmip_decode_int32_be(ctx, &tag_type);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_PROTOCOL_VERSION, KMIP_TYPE_STRUCTURE);
+    
+    kmip_decode_int32_be(ctx, &length);
+    CHECK_LENGTH(ctx, length, 32);
+    
+    result = kmip_decode_integer(ctx, KMIP_TAG_PROTOCOL_VERSION_MAJOR, &value->major);
+    CHECK_RESULT(ctx, result);
+    
+    result = kmip_decode_integer(ctx, KMIP_TAG_PROTOCOL_VERSION_MINOR, &value->minor);
+    CHECK_RESULT(ctx, result);
+    
+    return(KMIP_OK);
+}
 
-                kmip_encode_int32_be(ctx, TAG_TYPE(KMIP_TAG_ATTRIBUTE_VALUE, KMIP_TYPE_STRUCTURE));
-                ctx->index = curr_index;
-            }
-            else
-            {
-                result = KMIP_TAG_MISMATCH;
-            }
+int
+kmip_decode_transparent_symmetric_key(KMIP *ctx, TransparentSymmetricKey *value)
+{
+    int result = kmip_decode_schema(ctx, &kmip_transparent_symmetric_key_schema, value);
+    CHECK_RESULT(ctx, result);
+    
+    return(KMIP_OK);
+}
 
-            CHECK_RESULT(ctx, result);
-        }
-        break;
-        
-        case KMIP_ATTR_OBJECT_TYPE:
-        value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
-        CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "ObjectType enumeration");
-        result = kmip_decode_enum(ctx, t, (int32 *)value->value);
-        CHECK_RESULT(ctx, result);
-        CHECK_ENUM(ctx, KMIP_TAG_OBJECT_TYPE, *(int32 *)value->value);
-        break;
-        
-        case KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM:
-        value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
-        CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "CryptographicAlgorithm enumeration");
-        result = kmip_decode_enum(ctx, t, (int32 *)value->value);
-        CHECK_RESULT(ctx, result);
-        CHECK_ENUM(ctx, KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM, *(int32 *)value->value);
-        break;
-        
-        case KMIP_ATTR_CRYPTOGRAPHIC_LENGTH:
-        value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
-        CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "CryptographicLength integer");
-        result = kmip_decode_integer(ctx, t, (int32 *)value->value);
+int
+kmip_decode_key_material(KMIP *ctx, enum key_format_type format, void **value)
+{
+    int result = 0;
+    
+    switch(format)
+    {
+        case KMIP_KEYFORMAT_RAW:
+        case KMIP_KEYFORMAT_OPAQUE:
+        case KMIP_KEYFORMAT_PKCS1:
+        case KMIP_KEYFORMAT_PKCS8:
+        case KMIP_KEYFORMAT_X509:
+        case KMIP_KEYFORMAT_EC_PRIVATE_KEY:
+        *value = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
+        CHECK_NEW_MEMORY(ctx, *value, sizeof(ByteString), "KeyMaterial byte string");
+        result = kmip_decode_byte_string(ctx, KMIP_TAG_KEY_MATERIAL, (ByteString*)*value);
         CHECK_RESULT(ctx, result);
+        return(KMIP_OK);
         break;
         
-        case KMIP_ATTR_OPERATION_POLICY_NAME:
-        value->value = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-        CHECK_NEW_MEMORY(ctx, value->value, sizeof(TextString), "OperationPolicyName text string");
-        result = kmip_decode_text_string(ctx, t, (TextString*)value->value);
-        CHECK_RESULT(ctx, result);
+        default:
         break;
-        
-        case KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK:
-        value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
-        CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "CryptographicUsageMask integer");
-        result = kmip_decode_integer(ctx, t, (int32 *)value->value);
+    };
+    
+    switch(format)
+    {
+        case KMIP_KEYFORMAT_TRANS_SYMMETRIC_KEY:
+        *value = ctx->calloc_func(ctx->state, 1, sizeof(TransparentSymmetricKey));
+        CHECK_NEW_MEMORY(ctx, *value, sizeof(TransparentSymmetricKey), "TransparentSymmetricKey structure");
+        result = kmip_decode_transparent_symmetric_key(ctx, (TransparentSymmetricKey*)*value);
         CHECK_RESULT(ctx, result);
         break;
         
-        case KMIP_ATTR_STATE:
-        value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
-        CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "State enumeration");
-        result = kmip_decode_enum(ctx, t, (int32 *)value->value);
-        CHECK_RESULT(ctx, result);
-        CHECK_ENUM(ctx, KMIP_TAG_STATE, *(int32 *)value->value);
-        break;
+        /* TODO (ph) The rest require BigInteger support. */
         
+        case KMIP_KEYFORMAT_TRANS_DSA_PRIVATE_KEY:
+        case KMIP_KEYFORMAT_TRANS_DSA_PUBLIC_KEY:
+        case KMIP_KEYFORMAT_TRANS_RSA_PRIVATE_KEY:
+        case KMIP_KEYFORMAT_TRANS_RSA_PUBLIC_KEY:
+        case KMIP_KEYFORMAT_TRANS_DH_PRIVATE_KEY:
+        case KMIP_KEYFORMAT_TRANS_DH_PUBLIC_KEY:
+        case KMIP_KEYFORMAT_TRANS_ECDSA_PRIVATE_KEY:
+        case KMIP_KEYFORMAT_TRANS_ECDSA_PUBLIC_KEY:
+        case KMIP_KEYFORMAT_TRANS_ECDH_PRIVATE_KEY:
+        case KMIP_KEYFORMAT_TRANS_ECDH_PUBLIC_KEY:
+        case KMIP_KEYFORMAT_TRANS_ECMQV_PRIVATE_KEY:
+        case KMIP_KEYFORMAT_TRANS_ECMQV_PUBLIC_KEY:
         default:
+        if(ctx->skip_unknown == KMIP_TRUE)
+        {
+            *value = NULL;
+            result = kmip_skip_item(ctx);
+            CHECK_RESULT(ctx, result);
+            break;
+        }
         kmip_push_error_frame(ctx, __func__, __LINE__);
-        return(KMIP_ERROR_ATTR_UNSUPPORTED);
+        return(KMIP_NOT_IMPLEMENTED);
         break;
     };
-    CHECK_RESULT(ctx, result);
     
     return(KMIP_OK);
 }
 
 int
-kmip_decode_attribute_v2(KMIP *ctx, Attribute *value)
+kmip_decode_key_value(KMIP *ctx, enum key_format_type format, KeyValue *value)
 {
-    CHECK_DECODE_ARGS(ctx, value);
-    CHECK_KMIP_VERSION(ctx, KMIP_2_0);
-
-    kmip_init_attribute(value);
-
+    CHECK_BUFFER_FULL(ctx, 8);
+    
     int result = 0;
-    uint32 tag = kmip_peek_tag(ctx);
-    if(tag == 0)
-    {
-        /* Record an error for an underfull buffer here and return. */
-    }
-
+    int32 tag_type = 0;
+    uint32 length = 0;
+    
+    kmip_decode_int32_be(ctx, &tag_type);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_KEY_VALUE, KMIP_TYPE_STRUCTURE);
+    
+    kmip_decode_int32_be(ctx, &length);
+    CHECK_BUFFER_FULL(ctx, length);
+    uint8 *end = ctx->index + length;
+    
+    result = kmip_decode_key_material(ctx, format, &value->key_material);
     CHECK_RESULT(ctx, result);
-
-    switch(tag)
+    
+    size_t capacity = 0;
+    value->attributes = NULL;
+    value->attribute_count = 0;
+    while(kmip_is_tag_next(ctx, KMIP_TAG_ATTRIBUTE))
     {
-        case KMIP_TAG_UNIQUE_IDENTIFIER:
-        {
-            value->type = KMIP_ATTR_UNIQUE_IDENTIFIER;
-            value->value = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-            CHECK_NEW_MEMORY(ctx, value->value, sizeof(TextString), "UniqueIdentifier text string");
-
-            result = kmip_decode_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, (TextString *)value->value);
-            CHECK_RESULT(ctx, result);
-        }
-        break;
-
-        case KMIP_TAG_NAME:
+        Attribute *attributes = kmip_grow_items(ctx, value->attributes, &capacity, value->attribute_count, sizeof(Attribute));
+        CHECK_NEW_MEMORY(ctx, attributes, (value->attribute_count + 1) * sizeof(Attribute), "sequence of Attribute structures");
+        value->attributes = attributes;
+        
+        result = kmip_decode_attribute(ctx, &value->attributes[value->attribute_count++]);
+        CHECK_RESULT(ctx, result);
+        
+        /* Attributes skipped with skip_unknown set give back their slot. */
+        if((int)value->attributes[value->attribute_count - 1].type == KMIP_UNSET)
         {
-            value->type = KMIP_ATTR_NAME;
-            value->value = ctx->calloc_func(ctx->state, 1, sizeof(Name));
-            CHECK_NEW_MEMORY(ctx, value->value, sizeof(Name), "Name structure");
-
-            result = kmip_decode_name(ctx, (Name *)value->value);
-            CHECK_RESULT(ctx, result);
+            value->attribute_count--;
         }
-        break;
-
-        case KMIP_TAG_OBJECT_TYPE:
-        {
-            value->type = KMIP_ATTR_OBJECT_TYPE;
-            value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
-            CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "ObjectType enumeration");
-
-            result = kmip_decode_enum(ctx, KMIP_TAG_OBJECT_TYPE, (int32 *)value->value);
-            CHECK_RESULT(ctx, result);
+    }
+    value->attributes = kmip_trim_items(ctx, value->attributes, capacity, value->attribute_count, sizeof(Attribute));
+    
+    while(ctx->skip_unknown == KMIP_TRUE && ctx->index < end)
+    {
+        result = kmip_skip_item(ctx);
+        CHECK_RESULT(ctx, result);
+    }
+    
+    return(KMIP_OK);
+}
 
-            CHECK_ENUM(ctx, KMIP_TAG_OBJECT_TYPE, *(int32 *)value->value);
-        }
-        break;
+int
+kmip_decode_application_specific_information(KMIP *ctx, ApplicationSpecificInformation *value)
+{
+    CHECK_BUFFER_FULL(ctx, 8);
 
-        case KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM:
-        {
-            value->type = KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM;
-            value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
-            CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "CrypographicAlgorithm enumeration");
+    kmip_init_application_specific_information(value);
 
-            result = kmip_decode_enum(ctx, KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM, (int32 *)value->value);
-            CHECK_RESULT(ctx, result);
+    int result = 0;
+    int32 tag_type = 0;
+    uint32 length = 0;
 
-            CHECK_ENUM(ctx, KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM, *(int32 *)value->value);
-        }
-        break;
+    kmip_decode_int32_be(ctx, &tag_type);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_APPLICATION_SPECIFIC_INFORMATION, KMIP_TYPE_STRUCTURE);
 
-        case KMIP_TAG_CRYPTOGRAPHIC_LENGTH:
-        {
-            value->type = KMIP_ATTR_CRYPTOGRAPHIC_LENGTH;
-            value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
-            CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "CryptographicLength integer");
+    kmip_decode_int32_be(ctx, &length);
+    CHECK_BUFFER_FULL(ctx, length);
 
-            result = kmip_decode_integer(ctx, KMIP_TAG_CRYPTOGRAPHIC_LENGTH, (int32 *)value->value);
-            CHECK_RESULT(ctx, result);
-        }
-        break;
+    if(kmip_is_tag_next(ctx, KMIP_TAG_APPLICATION_NAMESPACE))
+    {
+        result = kmip_decode_new_text_string(ctx, KMIP_TAG_APPLICATION_NAMESPACE, &value->application_namespace, "Application Namespace text string");
+        CHECK_RESULT(ctx, result);
+    }
+    else
+    {
+        kmip_set_error_message(ctx, "The ApplicationSpecificInformation encoding is missing the application name field.");
+        kmip_push_error_frame(ctx, __func__, __LINE__);
+        return(KMIP_INVALID_ENCODING);
+    }
 
-        case KMIP_TAG_CRYPTOGRAPHIC_USAGE_MASK:
+    if(kmip_is_tag_next(ctx, KMIP_TAG_APPLICATION_DATA))
+    {
+        result = kmip_decode_new_text_string(ctx, KMIP_TAG_APPLICATION_DATA, &value->application_data, "Application Data text string");
+        CHECK_RESULT(ctx, result);
+    }
+    else
+    {
+        if(ctx->version < KMIP_1_3)
         {
-            value->type = KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK;
-            value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
-            CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "CryptographicUsageMask integer");
-
-            result = kmip_decode_integer(ctx, KMIP_TAG_CRYPTOGRAPHIC_USAGE_MASK, (int32 *)value->value);
-            CHECK_RESULT(ctx, result);
+            kmip_set_error_message(ctx, "The ApplicationSpecificInformation encoding is missing the application data field.");
+            kmip_push_error_frame(ctx, __func__, __LINE__);
+            return(KMIP_INVALID_ENCODING);
         }
-        break;
-
-        case KMIP_TAG_STATE:
-        {
-            value->type = KMIP_ATTR_STATE;
-            value->value = ctx->calloc_func(ctx->state, 1, sizeof(int32));
-            CHECK_NEW_MEMORY(ctx, value->value, sizeof(int32), "State enumeration");
+    }
 
-            result = kmip_decode_enum(ctx, KMIP_TAG_STATE, (int32 *)value->value);
-            CHECK_RESULT(ctx, result);
+    return(KMIP_OK);
+}
 
-            CHECK_ENUM(ctx, KMIP_TAG_STATE, *(int32 *)value->value);
-        }
-        break;
+int
+kmip_decode_cryptographic_parameters(KMIP *ctx, CryptographicParameters *value)
+{
+    int result = kmip_decode_schema(ctx, &kmip_cryptographic_parameters_schema, value);
+    CHECK_RESULT(ctx, result);
+    
+    return(KMIP_OK);
+}
 
-        case KMIP_TAG_APPLICATION_SPECIFIC_INFORMATION:
-        {
-            value->type = KMIP_ATTR_APPLICATION_SPECIFIC_INFORMATION;
-            value->value = ctx->calloc_func(ctx->state, 1, sizeof(ApplicationSpecificInformation));
-            CHECK_NEW_MEMORY(ctx, value->value, sizeof(ApplicationSpecificInformation), "ApplicationSpecificInformation structure");
+int
+kmip_decode_encryption_key_information(KMIP *ctx, EncryptionKeyInformation *value)
+{
+    int result = kmip_decode_schema(ctx, &kmip_encryption_key_information_schema, value);
+    CHECK_RESULT(ctx, result);
+    
+    return(KMIP_OK);
+}
 
-            result = kmip_decode_application_specific_information(ctx, value->value);
-            CHECK_RESULT(ctx, result);
-        }
-        break;
+int
+kmip_decode_mac_signature_key_information(KMIP *ctx, MACSignatureKeyInformation *value)
+{
+    int result = kmip_decode_schema(ctx, &kmip_mac_signature_key_information_schema, value);
+    CHECK_RESULT(ctx, result);
+    
+    return(KMIP_OK);
+}
 
-        default:
-        {
-            kmip_push_error_frame(ctx, __func__, __LINE__);
-            return(KMIP_ERROR_ATTR_UNSUPPORTED);
-        }
-        break;
-    };
 
+int
+kmip_decode_key_wrapping_data(KMIP *ctx, KeyWrappingData *value)
+{
+    int result = kmip_decode_schema(ctx, &kmip_key_wrapping_data_schema, value);
+    CHECK_RESULT(ctx, result);
+    
     return(KMIP_OK);
 }
 
 int
-kmip_decode_attribute(KMIP *ctx, Attribute *value)
+kmip_decode_key_block(KMIP *ctx, KeyBlock *value)
 {
-    CHECK_DECODE_ARGS(ctx, value);
-
-    if(ctx->version < KMIP_2_0)
+    CHECK_BUFFER_FULL(ctx, 8);
+    
+    int result = 0;
+    int32 tag_type = 0;
+    uint32 length = 0;
+    
+    kmip_decode_int32_be(ctx, &tag_type);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_KEY_BLOCK, KMIP_TYPE_STRUCTURE);
+    
+    kmip_decode_int32_be(ctx, &length);
+    CHECK_BUFFER_FULL(ctx, length);
+    
+    result = kmip_decode_enum(ctx, KMIP_TAG_KEY_FORMAT_TYPE, &value->key_format_type);
+    CHECK_RESULT(ctx, result);
+    CHECK_ENUM(ctx, KMIP_TAG_KEY_FORMAT_TYPE, value->key_format_type);
+    
+    if(kmip_is_tag_next(ctx, KMIP_TAG_KEY_COMPRESSION_TYPE))
     {
-        return(kmip_decode_attribute_v1(ctx, value));
+        result = kmip_decode_enum(ctx, KMIP_TAG_KEY_COMPRESSION_TYPE, &value->key_compression_type);
+        CHECK_RESULT(ctx, result);
+        CHECK_ENUM(ctx, KMIP_TAG_KEY_COMPRESSION_TYPE, value->key_compression_type);
+    }
+    
+    if(kmip_is_tag_type_next(ctx, KMIP_TAG_KEY_VALUE, KMIP_TYPE_BYTE_STRING))
+    {
+        value->key_value_type = KMIP_TYPE_BYTE_STRING;
+        value->key_value = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
+        CHECK_NEW_MEMORY(ctx, value->key_value, sizeof(ByteString), "KeyValue byte string");
+        
+        result = kmip_decode_byte_string(ctx, KMIP_TAG_KEY_VALUE, (ByteString *)value->key_value);
+    }
+    else
+    {
+        value->key_value_type = KMIP_TYPE_STRUCTURE;
+        value->key_value = ctx->calloc_func(ctx->state, 1, sizeof(KeyValue));
+        CHECK_NEW_MEMORY(ctx, value->key_value, sizeof(KeyValue), "KeyValue structure");
+        
+        result = kmip_decode_key_value(ctx, value->key_format_type, (KeyValue *)value->key_value);
+    }
+    CHECK_RESULT(ctx, result);
+    
+    if(kmip_is_tag_next(ctx, KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM))
+    {
+        result = kmip_decode_enum(ctx, KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM, &value->cryptographic_algorithm);
+        CHECK_RESULT(ctx, result);
+        CHECK_ENUM(ctx, KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM, value->cryptographic_algorithm);
+    }
+    
+    if(kmip_is_tag_next(ctx, KMIP_TAG_CRYPTOGRAPHIC_LENGTH))
+    {
+        result = kmip_decode_integer(ctx, KMIP_TAG_CRYPTOGRAPHIC_LENGTH, &value->cryptographic_length);
+        CHECK_RESULT(ctx, result);
     }
-    else
+    
+    if(kmip_is_tag_next(ctx, KMIP_TAG_KEY_WRAPPING_DATA))
     {
-        return(kmip_decode_attribute_v2(ctx, value));
+        value->key_wrapping_data = ctx->calloc_func(ctx->state, 1, sizeof(KeyWrappingData));
+        CHECK_NEW_MEMORY(ctx, value->key_wrapping_data, sizeof(KeyWrappingData), "KeyWrappingData structure");
+        
+        result = kmip_decode_key_wrapping_data(ctx, value->key_wrapping_data);
+        CHECK_RESULT(ctx, result);
     }
+    
+    return(KMIP_OK);
 }
 
 int
-kmip_decode_attributes(KMIP *ctx, Attributes *value)
+kmip_decode_symmetric_key(KMIP *ctx, SymmetricKey *value)
 {
-    CHECK_DECODE_ARGS(ctx, value);
-    CHECK_KMIP_VERSION(ctx, KMIP_2_0);
     CHECK_BUFFER_FULL(ctx, 8);
-
+    
     int result = 0;
     int32 tag_type = 0;
     uint32 length = 0;
-
-    result = kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_RESULT(ctx, result);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_ATTRIBUTES, KMIP_TYPE_STRUCTURE);
-
-    result = kmip_decode_int32_be(ctx, &length);
-    CHECK_RESULT(ctx, result);
+    
+    kmip_decode_int32_be(ctx, &tag_type);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_SYMMETRIC_KEY, KMIP_TYPE_STRUCTURE);
+    
+    kmip_decode_int32_be(ctx, &length);
     CHECK_BUFFER_FULL(ctx, length);
-
-    value->attribute_list = ctx->calloc_func(ctx->state, 1, sizeof(LinkedList));
-    CHECK_NEW_MEMORY(ctx, value->attribute_list, sizeof(LinkedList), "LinkedList");
-
-    uint32 tag = kmip_peek_tag(ctx);
-    while(tag != 0 && kmip_is_attribute_tag(tag))
-    {
-        LinkedListItem *item = ctx->calloc_func(ctx->state, 1, sizeof(LinkedListItem));
-        CHECK_NEW_MEMORY(ctx, item, sizeof(LinkedListItem), "LinkedListItem");
-        kmip_linked_list_enqueue(value->attribute_list, item);
-
-        item->data = ctx->calloc_func(ctx->state, 1, sizeof(Attribute));
-        CHECK_NEW_MEMORY(ctx, item->data, sizeof(Attribute), "Attribute");
-
-        result = kmip_decode_attribute(ctx, (Attribute *)item->data);
-        CHECK_RESULT(ctx, result);
-
-        tag = kmip_peek_tag(ctx);
-    }
-
+    
+    value->key_block = ctx->calloc_func(ctx->state, 1, sizeof(KeyBlock));
+    CHECK_NEW_MEMORY(ctx, value->key_block, sizeof(KeyBlock), "KeyBlock structure");
+    
+    result = kmip_decode_key_block(ctx, value->key_block);
+    CHECK_RESULT(ctx, result);
+    
     return(KMIP_OK);
 }
 
 int
-kmip_decode_template_attribute(KMIP *ctx, TemplateAttribute *value)
+kmip_decode_public_key(KMIP *ctx, PublicKey *value)
 {
     CHECK_BUFFER_FULL(ctx, 8);
     
@@ -10963,66 +14280,46 @@ kmip_decode_template_attribute(KMIP *ctx, TemplateAttribute *value)
     uint32 length = 0;
     
     kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_TEMPLATE_ATTRIBUTE, KMIP_TYPE_STRUCTURE);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_PUBLIC_KEY, KMIP_TYPE_STRUCTURE);
     
     kmip_decode_int32_be(ctx, &length);
     CHECK_BUFFER_FULL(ctx, length);
     
-    value->name_count = kmip_get_num_items_next(ctx, KMIP_TAG_NAME);
-    if(value->name_count > 0)
-    {
-        value->names = ctx->calloc_func(ctx->state, value->name_count, sizeof(Name));
-        CHECK_NEW_MEMORY(ctx, value->names, value->name_count * sizeof(Name), "sequence of Name structures");
-        
-        for(size_t i = 0; i < value->name_count; i++)
-        {
-            result = kmip_decode_name(ctx, &value->names[i]);
-            CHECK_RESULT(ctx, result);
-        }
-    }
+    value->key_block = ctx->calloc_func(ctx->state, 1, sizeof(KeyBlock));
+    CHECK_NEW_MEMORY(ctx, value->key_block, sizeof(KeyBlock), "KeyBlock structure");
     
-    value->attribute_count = kmip_get_num_items_next(ctx, KMIP_TAG_ATTRIBUTE);
-    if(value->attribute_count > 0)
-    {
-        value->attributes = ctx->calloc_func(ctx->state, value->attribute_count, sizeof(Attribute));
-        CHECK_NEW_MEMORY(ctx, value->attributes, value->attribute_count * sizeof(Attribute), "sequence of Attribute structures");
-        
-        for(size_t i = 0; i < value->attribute_count; i++)
-        {
-            result = kmip_decode_attribute(ctx, &value->attributes[i]);
-            CHECK_RESULT(ctx, result);
-        }
-    }
+    result = kmip_decode_key_block(ctx, value->key_block);
+    CHECK_RESULT(ctx, result);
     
     return(KMIP_OK);
 }
 
 int
-kmip_decode_protocol_version(KMIP *ctx, ProtocolVersion *value)
+kmip_decode_private_key(KMIP *ctx, PrivateKey *value)
 {
-    CHECK_BUFFER_FULL(ctx, 40);
+    CHECK_BUFFER_FULL(ctx, 8);
     
     int result = 0;
     int32 tag_type = 0;
     uint32 length = 0;
     
     kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_PROTOCOL_VERSION, KMIP_TYPE_STRUCTURE);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_PRIVATE_KEY, KMIP_TYPE_STRUCTURE);
     
     kmip_decode_int32_be(ctx, &length);
-    CHECK_LENGTH(ctx, length, 32);
+    CHECK_BUFFER_FULL(ctx, length);
     
-    result = kmip_decode_integer(ctx, KMIP_TAG_PROTOCOL_VERSION_MAJOR, &value->major);
-    CHECK_RESULT(ctx, result);
+    value->key_block = ctx->calloc_func(ctx->state, 1, sizeof(KeyBlock));
+    CHECK_NEW_MEMORY(ctx, value->key_block, sizeof(KeyBlock), "KeyBlock structure");
     
-    result = kmip_decode_integer(ctx, KMIP_TAG_PROTOCOL_VERSION_MINOR, &value->minor);
+    result = kmip_decode_key_block(ctx, value->key_block);
     CHECK_RESULT(ctx, result);
     
     return(KMIP_OK);
 }
 
 int
-kmip_decode_transparent_symmetric_key(KMIP *ctx, TransparentSymmetricKey *value)
+kmip_decode_key_wrapping_specification(KMIP *ctx, KeyWrappingSpecification *value)
 {
     CHECK_BUFFER_FULL(ctx, 8);
     
@@ -11031,79 +14328,59 @@ kmip_decode_transparent_symmetric_key(KMIP *ctx, TransparentSymmetricKey *value)
     uint32 length = 0;
     
     kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_KEY_MATERIAL, KMIP_TYPE_STRUCTURE);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_KEY_WRAPPING_SPECIFICATION, KMIP_TYPE_STRUCTURE);
     
     kmip_decode_int32_be(ctx, &length);
     CHECK_BUFFER_FULL(ctx, length);
     
-    value->key = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
-    CHECK_NEW_MEMORY(ctx, value->key, sizeof(ByteString), "Key byte string");
-    
-    result = kmip_decode_byte_string(ctx, KMIP_TAG_KEY, value->key);
+    result = kmip_decode_enum(ctx, KMIP_TAG_WRAPPING_METHOD, &value->wrapping_method);
     CHECK_RESULT(ctx, result);
+    CHECK_ENUM(ctx, KMIP_TAG_WRAPPING_METHOD, value->wrapping_method);
     
-    return(KMIP_OK);
-}
-
-int
-kmip_decode_key_material(KMIP *ctx, enum key_format_type format, void **value)
-{
-    int result = 0;
+    if(kmip_is_tag_next(ctx, KMIP_TAG_ENCRYPTION_KEY_INFORMATION))
+    {
+        value->encryption_key_info = ctx->calloc_func(ctx->state, 1, sizeof(EncryptionKeyInformation));
+        CHECK_NEW_MEMORY(ctx, value->encryption_key_info, sizeof(EncryptionKeyInformation), "EncryptionKeyInformation structure");
+        result = kmip_decode_encryption_key_information(ctx, value->encryption_key_info);
+        CHECK_RESULT(ctx, result);
+    }
     
-    switch(format)
+    if(kmip_is_tag_next(ctx, KMIP_TAG_MAC_SIGNATURE_KEY_INFORMATION))
     {
-        case KMIP_KEYFORMAT_RAW:
-        case KMIP_KEYFORMAT_OPAQUE:
-        case KMIP_KEYFORMAT_PKCS1:
-        case KMIP_KEYFORMAT_PKCS8:
-        case KMIP_KEYFORMAT_X509:
-        case KMIP_KEYFORMAT_EC_PRIVATE_KEY:
-        *value = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
-        CHECK_NEW_MEMORY(ctx, *value, sizeof(ByteString), "KeyMaterial byte string");
-        result = kmip_decode_byte_string(ctx, KMIP_TAG_KEY_MATERIAL, (ByteString*)*value);
+        value->mac_signature_key_info = ctx->calloc_func(ctx->state, 1, sizeof(MACSignatureKeyInformation));
+        CHECK_NEW_MEMORY(ctx, value->mac_signature_key_info, sizeof(MACSignatureKeyInformation), "MACSignatureKeyInformation structure");
+        result = kmip_decode_mac_signature_key_information(ctx, value->mac_signature_key_info);
         CHECK_RESULT(ctx, result);
-        return(KMIP_OK);
-        break;
+    }
+    
+    size_t capacity = 0;
+    value->attribute_names = NULL;
+    value->attribute_name_count = 0;
+    while(kmip_is_tag_next(ctx, KMIP_TAG_ATTRIBUTE_NAME))
+    {
+        TextString *attribute_names = kmip_grow_items(ctx, value->attribute_names, &capacity, value->attribute_name_count, sizeof(TextString));
+        CHECK_NEW_MEMORY(ctx, attribute_names, (value->attribute_name_count + 1) * sizeof(TextString), "sequence of AttributeName text strings");
+        value->attribute_names = attribute_names;
         
-        default:
-        break;
-    };
+        result = kmip_decode_text_string(ctx, KMIP_TAG_ATTRIBUTE_NAME, &value->attribute_names[value->attribute_name_count++]);
+        CHECK_RESULT(ctx, result);
+    }
+    value->attribute_names = kmip_trim_items(ctx, value->attribute_names, capacity, value->attribute_name_count, sizeof(TextString));
     
-    switch(format)
+    if(ctx->version >= KMIP_1_1)
     {
-        case KMIP_KEYFORMAT_TRANS_SYMMETRIC_KEY:
-        *value = ctx->calloc_func(ctx->state, 1, sizeof(TransparentSymmetricKey));
-        CHECK_NEW_MEMORY(ctx, *value, sizeof(TransparentSymmetricKey), "TransparentSymmetricKey structure");
-        result = kmip_decode_transparent_symmetric_key(ctx, (TransparentSymmetricKey*)*value);
+        result = kmip_decode_enum(ctx, KMIP_TAG_ENCODING_OPTION, &value->encoding_option);
         CHECK_RESULT(ctx, result);
-        break;
-        
-        /* TODO (ph) The rest require BigInteger support. */
-        
-        case KMIP_KEYFORMAT_TRANS_DSA_PRIVATE_KEY:
-        case KMIP_KEYFORMAT_TRANS_DSA_PUBLIC_KEY:
-        case KMIP_KEYFORMAT_TRANS_RSA_PRIVATE_KEY:
-        case KMIP_KEYFORMAT_TRANS_RSA_PUBLIC_KEY:
-        case KMIP_KEYFORMAT_TRANS_DH_PRIVATE_KEY:
-        case KMIP_KEYFORMAT_TRANS_DH_PUBLIC_KEY:
-        case KMIP_KEYFORMAT_TRANS_ECDSA_PRIVATE_KEY:
-        case KMIP_KEYFORMAT_TRANS_ECDSA_PUBLIC_KEY:
-        case KMIP_KEYFORMAT_TRANS_ECDH_PRIVATE_KEY:
-        case KMIP_KEYFORMAT_TRANS_ECDH_PUBLIC_KEY:
-        case KMIP_KEYFORMAT_TRANS_ECMQV_PRIVATE_KEY:
-        case KMIP_KEYFORMAT_TRANS_ECMQV_PUBLIC_KEY:
-        default:
-        kmip_push_error_frame(ctx, __func__, __LINE__);
-        return(KMIP_NOT_IMPLEMENTED);
-        break;
-    };
+        CHECK_ENUM(ctx, KMIP_TAG_ENCODING_OPTION, value->encoding_option);
+    }
     
     return(KMIP_OK);
 }
 
 int
-kmip_decode_key_value(KMIP *ctx, enum key_format_type format, KeyValue *value)
+kmip_decode_create_request_payload(KMIP *ctx, CreateRequestPayload *value)
 {
+    CHECK_DECODE_ARGS(ctx, value);
     CHECK_BUFFER_FULL(ctx, 8);
     
     int result = 0;
@@ -11111,24 +14388,71 @@ kmip_decode_key_value(KMIP *ctx, enum key_format_type format, KeyValue *value)
     uint32 length = 0;
     
     kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_KEY_VALUE, KMIP_TYPE_STRUCTURE);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_REQUEST_PAYLOAD, KMIP_TYPE_STRUCTURE);
     
     kmip_decode_int32_be(ctx, &length);
     CHECK_BUFFER_FULL(ctx, length);
     
-    result = kmip_decode_key_material(ctx, format, &value->key_material);
+    result = kmip_decode_enum(ctx, KMIP_TAG_OBJECT_TYPE, &value->object_type);
     CHECK_RESULT(ctx, result);
-    
-    value->attribute_count = kmip_get_num_items_next(ctx, KMIP_TAG_ATTRIBUTE);
-    if(value->attribute_count > 0)
+    CHECK_ENUM(ctx, KMIP_TAG_OBJECT_TYPE, value->object_type);
+
+    if(ctx->version < KMIP_2_0)
     {
-        value->attributes = ctx->calloc_func(ctx->state, value->attribute_count, sizeof(Attribute));
-        CHECK_NEW_MEMORY(ctx, value->attributes, value->attribute_count * sizeof(Attribute), "sequence of Attribute structures");
-        
-        for(size_t i = 0; i < value->attribute_count; i++)
+        value->template_attribute = ctx->calloc_func(ctx->state, 1, sizeof(TemplateAttribute));
+        if(value->template_attribute == NULL)
         {
-            result = kmip_decode_attribute(ctx, &value->attributes[i]);
-            CHECK_RESULT(ctx, result);
+            HANDLE_FAILED_ALLOC(ctx, sizeof(TemplateAttribute), "TemplateAttribute");
+        }
+        result = kmip_decode_template_attribute(ctx, value->template_attribute);
+        if(result != KMIP_OK)
+        {
+            kmip_free_template_attribute(ctx, value->template_attribute);
+            ctx->free_func(ctx->state, value->template_attribute);
+            value->template_attribute = NULL;
+            HANDLE_FAILURE(ctx, result);
+        }
+    }
+    else
+    {
+        value->attributes = ctx->calloc_func(ctx->state, 1, sizeof(Attributes));
+        if(value->attributes == NULL)
+        {
+            HANDLE_FAILED_ALLOC(ctx, sizeof(Attributes), "Attributes");
+        }
+        result = kmip_decode_attributes(ctx, value->attributes);
+        if(result != KMIP_OK)
+        {
+            kmip_free_attributes(ctx, value->attributes);
+            ctx->free_func(ctx->state, value->attributes);
+            value->attributes = NULL;
+
+            HANDLE_FAILURE(ctx, result);
+        }
+
+        if(kmip_is_tag_next(ctx, KMIP_TAG_PROTECTION_STORAGE_MASKS))
+        {
+            value->protection_storage_masks = ctx->calloc_func(ctx->state, 1, sizeof(ProtectionStorageMasks));
+            if(value->protection_storage_masks == NULL)
+            {
+                kmip_free_attributes(ctx, value->attributes);
+                ctx->free_func(ctx->state, value->attributes);
+                value->attributes = NULL;
+
+                HANDLE_FAILED_ALLOC(ctx, sizeof(ProtectionStorageMasks), "ProtectionStorageMasks");
+            }
+            result = kmip_decode_protection_storage_masks(ctx, value->protection_storage_masks);
+            if(result != KMIP_OK)
+            {
+                kmip_free_attributes(ctx, value->attributes);
+                kmip_free_protection_storage_masks(ctx, value->protection_storage_masks);
+                ctx->free_func(ctx->state, value->attributes);
+                ctx->free_func(ctx->state, value->protection_storage_masks);
+                value->attributes = NULL;
+                value->protection_storage_masks = NULL;
+
+                HANDLE_FAILURE(ctx, result);
+            }
         }
     }
     
@@ -11136,52 +14460,37 @@ kmip_decode_key_value(KMIP *ctx, enum key_format_type format, KeyValue *value)
 }
 
 int
-kmip_decode_application_specific_information(KMIP *ctx, ApplicationSpecificInformation *value)
+kmip_decode_create_response_payload(KMIP *ctx, CreateResponsePayload *value)
 {
+    CHECK_DECODE_ARGS(ctx, value);
     CHECK_BUFFER_FULL(ctx, 8);
-
-    kmip_init_application_specific_information(value);
-
+    
     int result = 0;
     int32 tag_type = 0;
     uint32 length = 0;
-
+    
     kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_APPLICATION_SPECIFIC_INFORMATION, KMIP_TYPE_STRUCTURE);
-
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_RESPONSE_PAYLOAD, KMIP_TYPE_STRUCTURE);
+    
     kmip_decode_int32_be(ctx, &length);
     CHECK_BUFFER_FULL(ctx, length);
-
-    if(kmip_is_tag_next(ctx, KMIP_TAG_APPLICATION_NAMESPACE))
-    {
-        value->application_namespace = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-        CHECK_NEW_MEMORY(ctx, value->application_namespace, sizeof(TextString), "Application Namespace text string");
-
-        result = kmip_decode_text_string(ctx, KMIP_TAG_APPLICATION_NAMESPACE, value->application_namespace);
-        CHECK_RESULT(ctx, result);
-    }
-    else
-    {
-        kmip_set_error_message(ctx, "The ApplicationSpecificInformation encoding is missing the application name field.");
-        kmip_push_error_frame(ctx, __func__, __LINE__);
-        return(KMIP_INVALID_ENCODING);
-    }
-
-    if(kmip_is_tag_next(ctx, KMIP_TAG_APPLICATION_DATA))
-    {
-        value->application_data = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-        CHECK_NEW_MEMORY(ctx, value->application_data, sizeof(TextString), "Application Data text string");
-
-        result = kmip_decode_text_string(ctx, KMIP_TAG_APPLICATION_DATA, value->application_data);
-        CHECK_RESULT(ctx, result);
-    }
-    else
+    
+    result = kmip_decode_enum(ctx, KMIP_TAG_OBJECT_TYPE, &value->object_type);
+    CHECK_RESULT(ctx, result);
+    CHECK_ENUM(ctx, KMIP_TAG_OBJECT_TYPE, value->object_type);
+    
+    result = kmip_decode_new_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, &value->unique_identifier, "UniqueIdentifier text string");
+    CHECK_RESULT(ctx, result);
+    
+    if(ctx->version < KMIP_2_0)
     {
-        if(ctx->version < KMIP_1_3)
+        if(kmip_is_tag_next(ctx, KMIP_TAG_TEMPLATE_ATTRIBUTE))
         {
-            kmip_set_error_message(ctx, "The ApplicationSpecificInformation encoding is missing the application data field.");
-            kmip_push_error_frame(ctx, __func__, __LINE__);
-            return(KMIP_INVALID_ENCODING);
+            value->template_attribute = ctx->calloc_func(ctx->state, 1, sizeof(TemplateAttribute));
+            CHECK_NEW_MEMORY(ctx, value->template_attribute, sizeof(TemplateAttribute), "TemplateAttribute structure");
+            
+            result = kmip_decode_template_attribute(ctx, value->template_attribute);
+            CHECK_RESULT(ctx, result);
         }
     }
 
@@ -11189,152 +14498,63 @@ kmip_decode_application_specific_information(KMIP *ctx, ApplicationSpecificInfor
 }
 
 int
-kmip_decode_cryptographic_parameters(KMIP *ctx, CryptographicParameters *value)
+kmip_decode_get_request_payload(KMIP *ctx, GetRequestPayload *value)
 {
     CHECK_BUFFER_FULL(ctx, 8);
     
-    kmip_init_cryptographic_parameters(value);
-    
     int result = 0;
     int32 tag_type = 0;
     uint32 length = 0;
     
     kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_CRYPTOGRAPHIC_PARAMETERS, KMIP_TYPE_STRUCTURE);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_REQUEST_PAYLOAD, KMIP_TYPE_STRUCTURE);
     
     kmip_decode_int32_be(ctx, &length);
     CHECK_BUFFER_FULL(ctx, length);
-    
-    if(kmip_is_tag_next(ctx, KMIP_TAG_BLOCK_CIPHER_MODE))
+
+    if(kmip_is_tag_next(ctx, KMIP_TAG_UNIQUE_IDENTIFIER))
     {
-        result = kmip_decode_enum(ctx, KMIP_TAG_BLOCK_CIPHER_MODE, &value->block_cipher_mode);
+        result = kmip_decode_new_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, &value->unique_identifier, "UniqueIdentifier text string");
         CHECK_RESULT(ctx, result);
-        CHECK_ENUM(ctx, KMIP_TAG_BLOCK_CIPHER_MODE, value->block_cipher_mode);
     }
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_PADDING_METHOD))
+    if(kmip_is_tag_next(ctx, KMIP_TAG_KEY_FORMAT_TYPE))
     {
-        result = kmip_decode_enum(ctx, KMIP_TAG_PADDING_METHOD, &value->padding_method);
+        result = kmip_decode_enum(ctx, KMIP_TAG_KEY_FORMAT_TYPE, &value->key_format_type);
         CHECK_RESULT(ctx, result);
-        CHECK_ENUM(ctx, KMIP_TAG_PADDING_METHOD, value->padding_method);
+        CHECK_ENUM(ctx, KMIP_TAG_KEY_FORMAT_TYPE, value->key_format_type);
     }
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_HASHING_ALGORITHM))
+    if(ctx->version >= KMIP_1_4)
     {
-        result = kmip_decode_enum(ctx, KMIP_TAG_HASHING_ALGORITHM, &value->hashing_algorithm);
-        CHECK_RESULT(ctx, result);
-        CHECK_ENUM(ctx, KMIP_TAG_HASHING_ALGORITHM, value->hashing_algorithm);
+        if(kmip_is_tag_next(ctx, KMIP_TAG_KEY_WRAP_TYPE))
+        {
+            result = kmip_decode_enum(ctx, KMIP_TAG_KEY_WRAP_TYPE, &value->key_wrap_type);
+            CHECK_RESULT(ctx, result);
+            CHECK_ENUM(ctx, KMIP_TAG_KEY_WRAP_TYPE, value->key_wrap_type);
+        }
     }
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_KEY_ROLE_TYPE))
+    if(kmip_is_tag_next(ctx, KMIP_TAG_KEY_COMPRESSION_TYPE))
     {
-        result = kmip_decode_enum(ctx, KMIP_TAG_KEY_ROLE_TYPE, &value->key_role_type);
+        result = kmip_decode_enum(ctx, KMIP_TAG_KEY_COMPRESSION_TYPE, &value->key_compression_type);
         CHECK_RESULT(ctx, result);
-        CHECK_ENUM(ctx, KMIP_TAG_KEY_ROLE_TYPE, value->key_role_type);
-    }
-    
-    if(ctx->version >= KMIP_1_2)
-    {
-        if(kmip_is_tag_next(ctx, KMIP_TAG_DIGITAL_SIGNATURE_ALGORITHM))
-        {
-            result = kmip_decode_enum(ctx, KMIP_TAG_DIGITAL_SIGNATURE_ALGORITHM, &value->digital_signature_algorithm);
-            CHECK_RESULT(ctx, result);
-            CHECK_ENUM(ctx, KMIP_TAG_DIGITAL_SIGNATURE_ALGORITHM, value->digital_signature_algorithm);
-        }
-        
-        if(kmip_is_tag_next(ctx, KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM))
-        {
-            result = kmip_decode_enum(ctx, KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM, &value->cryptographic_algorithm);
-            CHECK_RESULT(ctx, result);
-            CHECK_ENUM(ctx, KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM, value->cryptographic_algorithm);
-        }
-        
-        if(kmip_is_tag_next(ctx, KMIP_TAG_RANDOM_IV))
-        {
-            result = kmip_decode_bool(ctx, KMIP_TAG_RANDOM_IV, &value->random_iv);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(kmip_is_tag_next(ctx, KMIP_TAG_IV_LENGTH))
-        {
-            result = kmip_decode_integer(ctx, KMIP_TAG_IV_LENGTH, &value->iv_length);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(kmip_is_tag_next(ctx, KMIP_TAG_TAG_LENGTH))
-        {
-            result = kmip_decode_integer(ctx, KMIP_TAG_TAG_LENGTH, &value->tag_length);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(kmip_is_tag_next(ctx, KMIP_TAG_FIXED_FIELD_LENGTH))
-        {
-            result = kmip_decode_integer(ctx, KMIP_TAG_FIXED_FIELD_LENGTH, &value->fixed_field_length);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(kmip_is_tag_next(ctx, KMIP_TAG_INVOCATION_FIELD_LENGTH))
-        {
-            result = kmip_decode_integer(ctx, KMIP_TAG_INVOCATION_FIELD_LENGTH, &value->invocation_field_length);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(kmip_is_tag_next(ctx, KMIP_TAG_COUNTER_LENGTH))
-        {
-            result = kmip_decode_integer(ctx, KMIP_TAG_COUNTER_LENGTH, &value->counter_length);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(kmip_is_tag_next(ctx, KMIP_TAG_INITIAL_COUNTER_VALUE))
-        {
-            result = kmip_decode_integer(ctx, KMIP_TAG_INITIAL_COUNTER_VALUE, &value->initial_counter_value);
-            CHECK_RESULT(ctx, result);
-        }
+        CHECK_ENUM(ctx, KMIP_TAG_KEY_COMPRESSION_TYPE, value->key_compression_type);
     }
     
-    if(ctx->version >= KMIP_1_4)
+    if(kmip_is_tag_next(ctx, KMIP_TAG_KEY_WRAPPING_SPECIFICATION))
     {
-        if(kmip_is_tag_next(ctx, KMIP_TAG_SALT_LENGTH))
-        {
-            result = kmip_decode_integer(ctx, KMIP_TAG_SALT_LENGTH, &value->salt_length);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(kmip_is_tag_next(ctx, KMIP_TAG_MASK_GENERATOR))
-        {
-            result = kmip_decode_enum(ctx, KMIP_TAG_MASK_GENERATOR, &value->mask_generator);
-            CHECK_RESULT(ctx, result);
-            CHECK_ENUM(ctx, KMIP_TAG_MASK_GENERATOR, value->mask_generator);
-        }
-        
-        if(kmip_is_tag_next(ctx, KMIP_TAG_MASK_GENERATOR_HASHING_ALGORITHM))
-        {
-            result = kmip_decode_enum(ctx, KMIP_TAG_MASK_GENERATOR_HASHING_ALGORITHM, &value->mask_generator_hashing_algorithm);
-            CHECK_RESULT(ctx, result);
-            CHECK_ENUM(ctx, KMIP_TAG_HASHING_ALGORITHM, value->mask_generator_hashing_algorithm);
-        }
-        
-        if(kmip_is_tag_next(ctx, KMIP_TAG_P_SOURCE))
-        {
-            value->p_source = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
-            CHECK_NEW_MEMORY(ctx, value->p_source, sizeof(ByteString), "P Source byte string");
-            
-            result = kmip_decode_byte_string(ctx, KMIP_TAG_P_SOURCE, value->p_source);
-            CHECK_RESULT(ctx, result);
-        }
-        
-        if(kmip_is_tag_next(ctx, KMIP_TAG_TRAILER_FIELD))
-        {
-            result = kmip_decode_integer(ctx, KMIP_TAG_TRAILER_FIELD, &value->trailer_field);
-            CHECK_RESULT(ctx, result);
-        }
+        value->key_wrapping_spec = ctx->calloc_func(ctx->state, 1, sizeof(KeyWrappingSpecification));
+        CHECK_NEW_MEMORY(ctx, value->key_wrapping_spec, sizeof(KeyWrappingSpecification), "KeyWrappingSpecification structure");
+        result = kmip_decode_key_wrapping_specification(ctx, value->key_wrapping_spec);
+        CHECK_RESULT(ctx, result);
     }
     
     return(KMIP_OK);
 }
 
 int
-kmip_decode_encryption_key_information(KMIP *ctx, EncryptionKeyInformation *value)
+kmip_decode_get_response_payload(KMIP *ctx, GetResponsePayload *value)
 {
     CHECK_BUFFER_FULL(ctx, 8);
     
@@ -11343,66 +14563,72 @@ kmip_decode_encryption_key_information(KMIP *ctx, EncryptionKeyInformation *valu
     uint32 length = 0;
     
     kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_ENCRYPTION_KEY_INFORMATION, KMIP_TYPE_STRUCTURE);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_RESPONSE_PAYLOAD, KMIP_TYPE_STRUCTURE);
     
     kmip_decode_int32_be(ctx, &length);
     CHECK_BUFFER_FULL(ctx, length);
     
-    value->unique_identifier = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-    CHECK_NEW_MEMORY(ctx, value->unique_identifier, sizeof(TextString), "UniqueIdentifier text string");
+    result = kmip_decode_enum(ctx, KMIP_TAG_OBJECT_TYPE, &value->object_type);
+    CHECK_RESULT(ctx, result);
+    CHECK_ENUM(ctx, KMIP_TAG_OBJECT_TYPE, value->object_type);
     
-    result = kmip_decode_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, value->unique_identifier);
+    result = kmip_decode_new_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, &value->unique_identifier, "UniqueIdentifier text string");
     CHECK_RESULT(ctx, result);
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_CRYPTOGRAPHIC_PARAMETERS))
+    switch(value->object_type)
     {
-        value->cryptographic_parameters = ctx->calloc_func(ctx->state, 1, sizeof(CryptographicParameters));
-        CHECK_NEW_MEMORY(ctx, value->cryptographic_parameters, sizeof(CryptographicParameters), "CryptographicParameters structure");
+        case KMIP_OBJTYPE_SYMMETRIC_KEY:
+        value->object = ctx->calloc_func(ctx->state, 1, sizeof(SymmetricKey));
+        CHECK_NEW_MEMORY(ctx, value->object, sizeof(SymmetricKey), "SymmetricKey structure");
+        result = kmip_decode_symmetric_key(ctx, (SymmetricKey*)value->object);
+        CHECK_RESULT(ctx, result);
+        break;
         
-        result = kmip_decode_cryptographic_parameters(ctx, value->cryptographic_parameters);
+        case KMIP_OBJTYPE_PUBLIC_KEY:
+        value->object = ctx->calloc_func(ctx->state, 1, sizeof(PublicKey));
+        CHECK_NEW_MEMORY(ctx, value->object, sizeof(PublicKey), "PublicKey structure");
+        result = kmip_decode_public_key(ctx, (PublicKey*)value->object);
         CHECK_RESULT(ctx, result);
-    }
+        break;
+        
+        case KMIP_OBJTYPE_PRIVATE_KEY:
+        value->object = ctx->calloc_func(ctx->state, 1, sizeof(PrivateKey));
+        CHECK_NEW_MEMORY(ctx, value->object, sizeof(PrivateKey), "PrivateKey structure");
+        result = kmip_decode_private_key(ctx, (PrivateKey*)value->object);
+        CHECK_RESULT(ctx, result);
+        break;
+        
+        default:
+        kmip_push_error_frame(ctx, __func__, __LINE__);
+        return(KMIP_NOT_IMPLEMENTED);
+        break;
+    };
     
     return(KMIP_OK);
 }
 
 int
-kmip_decode_mac_signature_key_information(KMIP *ctx, MACSignatureKeyInformation *value)
+kmip_decode_destroy_request_payload(KMIP *ctx, DestroyRequestPayload *value)
 {
-    CHECK_BUFFER_FULL(ctx, 8);
-    
-    int result = 0;
-    int32 tag_type = 0;
-    uint32 length = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_MAC_SIGNATURE_KEY_INFORMATION, KMIP_TYPE_STRUCTURE);
-    
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_BUFFER_FULL(ctx, length);
-    
-    value->unique_identifier = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-    CHECK_NEW_MEMORY(ctx, value->unique_identifier, sizeof(TextString), "UniqueIdentifier text string");
-    
-    result = kmip_decode_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, value->unique_identifier);
+    int result = kmip_decode_schema(ctx, &kmip_destroy_request_payload_schema, value);
     CHECK_RESULT(ctx, result);
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_CRYPTOGRAPHIC_PARAMETERS))
-    {
-        value->cryptographic_parameters = ctx->calloc_func(ctx->state, 1, sizeof(CryptographicParameters));
-        CHECK_NEW_MEMORY(ctx, value->cryptographic_parameters, sizeof(CryptographicParameters), "CryptographicParameters structure");
-        
-        result = kmip_decode_cryptographic_parameters(ctx, value->cryptographic_parameters);
-        CHECK_RESULT(ctx, result);
-    }
-    
     return(KMIP_OK);
 }
 
+int
+kmip_decode_destroy_response_payload(KMIP *ctx, DestroyResponsePayload *value)
+{
+    int result = kmip_decode_schema(ctx, &kmip_destroy_response_payload_schema, value);
+    CHECK_RESULT(ctx, result);
+    
+    return(KMIP_OK);
+}
 
 int
-kmip_decode_key_wrapping_data(KMIP *ctx, KeyWrappingData *value)
+kmip_decode_request_batch_item(KMIP *ctx, RequestBatchItem *value)
 {
+    CHECK_DECODE_ARGS(ctx, value);
     CHECK_BUFFER_FULL(ctx, 8);
     
     int result = 0;
@@ -11410,66 +14636,105 @@ kmip_decode_key_wrapping_data(KMIP *ctx, KeyWrappingData *value)
     uint32 length = 0;
     
     kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_KEY_WRAPPING_DATA, KMIP_TYPE_STRUCTURE);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_BATCH_ITEM, KMIP_TYPE_STRUCTURE);
     
     kmip_decode_int32_be(ctx, &length);
     CHECK_BUFFER_FULL(ctx, length);
     
-    result = kmip_decode_enum(ctx, KMIP_TAG_WRAPPING_METHOD, &value->wrapping_method);
+    result = kmip_decode_enum(ctx, KMIP_TAG_OPERATION, &value->operation);
     CHECK_RESULT(ctx, result);
-    CHECK_ENUM(ctx, KMIP_TAG_WRAPPING_METHOD, value->wrapping_method);
-    
-    if(kmip_is_tag_next(ctx, KMIP_TAG_ENCRYPTION_KEY_INFORMATION))
+    CHECK_ENUM(ctx, KMIP_TAG_OPERATION, value->operation);
+
+    if(ctx->version >= KMIP_2_0)
     {
-        value->encryption_key_info = ctx->calloc_func(ctx->state, 1, sizeof(EncryptionKeyInformation));
-        CHECK_NEW_MEMORY(ctx, value->encryption_key_info, sizeof(EncryptionKeyInformation), "EncryptionKeyInformation structure");
-        
-        result = kmip_decode_encryption_key_information(ctx, value->encryption_key_info);
-        CHECK_RESULT(ctx, result);
+        if(kmip_is_tag_next(ctx, KMIP_TAG_EPHEMERAL))
+        {
+            result = kmip_decode_bool(ctx, KMIP_TAG_EPHEMERAL, &value->ephemeral);
+            CHECK_RESULT(ctx, result);
+        }
     }
-    
-    if(kmip_is_tag_next(ctx, KMIP_TAG_MAC_SIGNATURE_KEY_INFORMATION))
+
+    if(kmip_is_tag_next(ctx, KMIP_TAG_UNIQUE_BATCH_ITEM_ID))
     {
-        value->mac_signature_key_info = ctx->calloc_func(ctx->state, 1, sizeof(MACSignatureKeyInformation));
-        CHECK_NEW_MEMORY(ctx, value->mac_signature_key_info, sizeof(MACSignatureKeyInformation), "MAC/SignatureKeyInformation structure");
-        
-        result = kmip_decode_mac_signature_key_information(ctx, value->mac_signature_key_info);
+        value->unique_batch_item_id = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
+        CHECK_NEW_MEMORY(ctx, value->unique_batch_item_id, sizeof(ByteString), "UniqueBatchItemID byte string");
+        result = kmip_decode_byte_string(ctx, KMIP_TAG_UNIQUE_BATCH_ITEM_ID, value->unique_batch_item_id);
         CHECK_RESULT(ctx, result);
     }
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_MAC_SIGNATURE))
+    switch(value->operation)
     {
-        value->mac_signature = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
-        CHECK_NEW_MEMORY(ctx, value->mac_signature, sizeof(ByteString), "MAC/Signature byte string");
+        case KMIP_OP_CREATE:
+        value->request_payload = ctx->calloc_func(ctx->state, 1, sizeof(CreateRequestPayload));
+        CHECK_NEW_MEMORY(ctx, value->request_payload, sizeof(CreateRequestPayload), "CreateRequestPayload structure");
+        result = kmip_decode_create_request_payload(ctx, (CreateRequestPayload *)value->request_payload);
+        break;
         
-        result = kmip_decode_byte_string(ctx, KMIP_TAG_MAC_SIGNATURE, value->mac_signature);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    if(kmip_is_tag_next(ctx, KMIP_TAG_IV_COUNTER_NONCE))
-    {
-        value->iv_counter_nonce = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
-        CHECK_NEW_MEMORY(ctx, value->iv_counter_nonce, sizeof(ByteString), "IV/Counter/Nonce byte string");
+        case KMIP_OP_GET:
+        value->request_payload = ctx->calloc_func(ctx->state, 1, sizeof(GetRequestPayload));
+        CHECK_NEW_MEMORY(ctx, value->request_payload, sizeof(GetRequestPayload), "GetRequestPayload structure");
+        result = kmip_decode_get_request_payload(ctx, (GetRequestPayload*)value->request_payload);
+        break;
         
-        result = kmip_decode_byte_string(ctx, KMIP_TAG_IV_COUNTER_NONCE, value->iv_counter_nonce);
-        CHECK_RESULT(ctx, result);
-    }
+        case KMIP_OP_DESTROY:
+        value->request_payload = ctx->calloc_func(ctx->state, 1, sizeof(DestroyRequestPayload));
+        CHECK_NEW_MEMORY(ctx, value->request_payload, sizeof(DestroyRequestPayload), "DestroyRequestPayload structure");
+        result = kmip_decode_destroy_request_payload(ctx, (DestroyRequestPayload*)value->request_payload);
+        break;
+        
+        default:
+        kmip_push_error_frame(ctx, __func__, __LINE__);
+        return(KMIP_NOT_IMPLEMENTED);
+        break;
+    };
+    CHECK_RESULT(ctx, result);
     
-    if(ctx->version >= KMIP_1_1)
+    return(KMIP_OK);
+}
+
+int
+kmip_decode_response_payload(KMIP *ctx, enum operation operation, void **value)
+{
+    int result = 0;
+    
+    switch(operation)
     {
-        if(kmip_is_tag_next(ctx, KMIP_TAG_ENCODING_OPTION))
+        case KMIP_OP_CREATE:
+        *value = ctx->calloc_func(ctx->state, 1, sizeof(CreateResponsePayload));
+        CHECK_NEW_MEMORY(ctx, *value, sizeof(CreateResponsePayload), "CreateResponsePayload structure");
+        result = kmip_decode_create_response_payload(ctx, (CreateResponsePayload *)*value);
+        break;
+        
+        case KMIP_OP_GET:
+        *value = ctx->calloc_func(ctx->state, 1, sizeof(GetResponsePayload));
+        CHECK_NEW_MEMORY(ctx, *value, sizeof(GetResponsePayload), "GetResponsePayload structure");
+        result = kmip_decode_get_response_payload(ctx, (GetResponsePayload *)*value);
+        break;
+        
+        case KMIP_OP_DESTROY:
+        *value = ctx->calloc_func(ctx->state, 1, sizeof(DestroyResponsePayload));
+        CHECK_NEW_MEMORY(ctx, *value, sizeof(DestroyResponsePayload), "DestroyResponsePayload structure");
+        result = kmip_decode_destroy_response_payload(ctx, (DestroyResponsePayload *)*value);
+        break;
+        
+        default:
+        if(ctx->skip_unknown == KMIP_TRUE)
         {
-            result = kmip_decode_enum(ctx, KMIP_TAG_ENCODING_OPTION, &value->encoding_option);
-            CHECK_RESULT(ctx, result);
-            CHECK_ENUM(ctx, KMIP_TAG_ENCODING_OPTION, value->encoding_option);
+            *value = NULL;
+            result = kmip_skip_item(ctx);
+            break;
         }
-    }
+        kmip_push_error_frame(ctx, __func__, __LINE__);
+        return(KMIP_NOT_IMPLEMENTED);
+        break;
+    };
+    CHECK_RESULT(ctx, result);
     
     return(KMIP_OK);
 }
 
 int
-kmip_decode_key_block(KMIP *ctx, KeyBlock *value)
+kmip_decode_response_batch_item(KMIP *ctx, ResponseBatchItem *value)
 {
     CHECK_BUFFER_FULL(ctx, 8);
     
@@ -11478,59 +14743,87 @@ kmip_decode_key_block(KMIP *ctx, KeyBlock *value)
     uint32 length = 0;
     
     kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_KEY_BLOCK, KMIP_TYPE_STRUCTURE);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_BATCH_ITEM, KMIP_TYPE_STRUCTURE);
     
     kmip_decode_int32_be(ctx, &length);
-    CHECK_BUFFER_FULL(ctx, length);
-    
-    result = kmip_decode_enum(ctx, KMIP_TAG_KEY_FORMAT_TYPE, &value->key_format_type);
-    CHECK_RESULT(ctx, result);
-    CHECK_ENUM(ctx, KMIP_TAG_KEY_FORMAT_TYPE, value->key_format_type);
+    CHECK_BUFFER_FULL(ctx, length);
+    uint8 *end = ctx->index + length;
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_KEY_COMPRESSION_TYPE))
+    if(kmip_is_tag_next(ctx, KMIP_TAG_OPERATION))
     {
-        result = kmip_decode_enum(ctx, KMIP_TAG_KEY_COMPRESSION_TYPE, &value->key_compression_type);
+        result = kmip_decode_enum(ctx, KMIP_TAG_OPERATION, &value->operation);
         CHECK_RESULT(ctx, result);
-        CHECK_ENUM(ctx, KMIP_TAG_KEY_COMPRESSION_TYPE, value->key_compression_type);
-    }
-    
-    if(kmip_is_tag_type_next(ctx, KMIP_TAG_KEY_VALUE, KMIP_TYPE_BYTE_STRING))
-    {
-        value->key_value_type = KMIP_TYPE_BYTE_STRING;
-        value->key_value = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
-        CHECK_NEW_MEMORY(ctx, value->key_value, sizeof(ByteString), "KeyValue byte string");
         
-        result = kmip_decode_byte_string(ctx, KMIP_TAG_KEY_VALUE, (ByteString *)value->key_value);
+        /* Payloads of unknown operations are skipped with skip_unknown set. */
+        if(ctx->skip_unknown != KMIP_TRUE)
+        {
+            CHECK_ENUM(ctx, KMIP_TAG_OPERATION, value->operation);
+        }
     }
-    else
+    
+    if(kmip_is_tag_next(ctx, KMIP_TAG_UNIQUE_BATCH_ITEM_ID))
     {
-        value->key_value_type = KMIP_TYPE_STRUCTURE;
-        value->key_value = ctx->calloc_func(ctx->state, 1, sizeof(KeyValue));
-        CHECK_NEW_MEMORY(ctx, value->key_value, sizeof(KeyValue), "KeyValue structure");
+        value->unique_batch_item_id = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
+        CHECK_NEW_MEMORY(ctx, value->unique_batch_item_id, sizeof(ByteString), "UniqueBatchItemID byte string");
         
-        result = kmip_decode_key_value(ctx, value->key_format_type, (KeyValue *)value->key_value);
+        result = kmip_decode_byte_string(ctx, KMIP_TAG_UNIQUE_BATCH_ITEM_ID, value->unique_batch_item_id);
+        CHECK_RESULT(ctx, result);
     }
+    
+    result = kmip_decode_enum(ctx, KMIP_TAG_RESULT_STATUS, &value->result_status);
     CHECK_RESULT(ctx, result);
+    CHECK_ENUM(ctx, KMIP_TAG_RESULT_STATUS, value->result_status);
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM))
+    if(kmip_is_tag_next(ctx, KMIP_TAG_RESULT_REASON))
     {
-        result = kmip_decode_enum(ctx, KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM, &value->cryptographic_algorithm);
+        result = kmip_decode_enum(ctx, KMIP_TAG_RESULT_REASON, &value->result_reason);
         CHECK_RESULT(ctx, result);
-        CHECK_ENUM(ctx, KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM, value->cryptographic_algorithm);
     }
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_CRYPTOGRAPHIC_LENGTH))
+    if(kmip_is_tag_next(ctx, KMIP_TAG_RESULT_MESSAGE))
     {
-        result = kmip_decode_integer(ctx, KMIP_TAG_CRYPTOGRAPHIC_LENGTH, &value->cryptographic_length);
+        result = kmip_decode_new_text_string(ctx, KMIP_TAG_RESULT_MESSAGE, &value->result_message, "ResultMessage text string");
         CHECK_RESULT(ctx, result);
     }
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_KEY_WRAPPING_DATA))
+    if(kmip_is_tag_next(ctx, KMIP_TAG_ASYNCHRONOUS_CORRELATION_VALUE))
     {
-        value->key_wrapping_data = ctx->calloc_func(ctx->state, 1, sizeof(KeyWrappingData));
-        CHECK_NEW_MEMORY(ctx, value->key_wrapping_data, sizeof(KeyWrappingData), "KeyWrappingData structure");
+        value->asynchronous_correlation_value = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
+        CHECK_NEW_MEMORY(ctx, value->asynchronous_correlation_value, sizeof(ByteString), "AsynchronousCorrelationValue byte string");
         
-        result = kmip_decode_key_wrapping_data(ctx, value->key_wrapping_data);
+        result = kmip_decode_byte_string(ctx, KMIP_TAG_ASYNCHRONOUS_CORRELATION_VALUE, value->asynchronous_correlation_value);
+        CHECK_RESULT(ctx, result);
+    }
+    
+    /* NOTE (ph) Omitting the tag check is a good way to test error output. */
+    if(kmip_is_tag_next(ctx, KMIP_TAG_RESPONSE_PAYLOAD))
+    {
+        if(ctx->lazy_payloads == KMIP_TRUE)
+        {
+            /* NOTE (ph) Only the payload span is recorded here. It is */
+            /*      decoded by kmip_response_item_payload when needed. */
+            CHECK_BUFFER_FULL(ctx, 8);
+            
+            uint32 payload_length = 0;
+            value->payload_offset = ctx->index - ctx->buffer;
+            
+            ctx->index += 4;
+            kmip_decode_int32_be(ctx, &payload_length);
+            CHECK_BUFFER_FULL(ctx, payload_length);
+            
+            ctx->index += payload_length;
+            value->payload_size = 8 + (size_t)payload_length;
+        }
+        else
+        {
+            result = kmip_decode_response_payload(ctx, value->operation, &value->response_payload);
+            CHECK_RESULT(ctx, result);
+        }
+    }
+    
+    while(ctx->skip_unknown == KMIP_TRUE && ctx->index < end)
+    {
+        result = kmip_skip_item(ctx);
         CHECK_RESULT(ctx, result);
     }
     
@@ -11538,139 +14831,79 @@ kmip_decode_key_block(KMIP *ctx, KeyBlock *value)
 }
 
 int
-kmip_decode_symmetric_key(KMIP *ctx, SymmetricKey *value)
+kmip_decode_nonce(KMIP *ctx, Nonce *value)
 {
-    CHECK_BUFFER_FULL(ctx, 8);
-    
-    int result = 0;
-    int32 tag_type = 0;
-    uint32 length = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_SYMMETRIC_KEY, KMIP_TYPE_STRUCTURE);
-    
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_BUFFER_FULL(ctx, length);
-    
-    value->key_block = ctx->calloc_func(ctx->state, 1, sizeof(KeyBlock));
-    CHECK_NEW_MEMORY(ctx, value->key_block, sizeof(KeyBlock), "KeyBlock structure");
-    
-    result = kmip_decode_key_block(ctx, value->key_block);
+    int result = kmip_decode_schema(ctx, &kmip_nonce_schema, value);
     CHECK_RESULT(ctx, result);
     
     return(KMIP_OK);
 }
 
 int
-kmip_decode_public_key(KMIP *ctx, PublicKey *value)
+kmip_decode_username_password_credential(KMIP *ctx, UsernamePasswordCredential *value)
 {
-    CHECK_BUFFER_FULL(ctx, 8);
-    
-    int result = 0;
-    int32 tag_type = 0;
-    uint32 length = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_PUBLIC_KEY, KMIP_TYPE_STRUCTURE);
-    
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_BUFFER_FULL(ctx, length);
-    
-    value->key_block = ctx->calloc_func(ctx->state, 1, sizeof(KeyBlock));
-    CHECK_NEW_MEMORY(ctx, value->key_block, sizeof(KeyBlock), "KeyBlock structure");
-    
-    result = kmip_decode_key_block(ctx, value->key_block);
+    int result = kmip_decode_schema(ctx, &kmip_username_password_credential_schema, value);
     CHECK_RESULT(ctx, result);
     
     return(KMIP_OK);
 }
 
 int
-kmip_decode_private_key(KMIP *ctx, PrivateKey *value)
+kmip_decode_device_credential(KMIP *ctx, DeviceCredential *value)
 {
-    CHECK_BUFFER_FULL(ctx, 8);
-    
-    int result = 0;
-    int32 tag_type = 0;
-    uint32 length = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_PRIVATE_KEY, KMIP_TYPE_STRUCTURE);
-    
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_BUFFER_FULL(ctx, length);
-    
-    value->key_block = ctx->calloc_func(ctx->state, 1, sizeof(KeyBlock));
-    CHECK_NEW_MEMORY(ctx, value->key_block, sizeof(KeyBlock), "KeyBlock structure");
-    
-    result = kmip_decode_key_block(ctx, value->key_block);
+    int result = kmip_decode_schema(ctx, &kmip_device_credential_schema, value);
     CHECK_RESULT(ctx, result);
     
     return(KMIP_OK);
 }
 
 int
-kmip_decode_key_wrapping_specification(KMIP *ctx, KeyWrappingSpecification *value)
+kmip_decode_attestation_credential(KMIP *ctx, AttestationCredential *value)
 {
-    CHECK_BUFFER_FULL(ctx, 8);
-    
-    int result = 0;
-    int32 tag_type = 0;
-    uint32 length = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_KEY_WRAPPING_SPECIFICATION, KMIP_TYPE_STRUCTURE);
-    
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_BUFFER_FULL(ctx, length);
-    
-    result = kmip_decode_enum(ctx, KMIP_TAG_WRAPPING_METHOD, &value->wrapping_method);
+    int result = kmip_decode_schema(ctx, &kmip_attestation_credential_schema, value);
     CHECK_RESULT(ctx, result);
-    CHECK_ENUM(ctx, KMIP_TAG_WRAPPING_METHOD, value->wrapping_method);
-    
-    if(kmip_is_tag_next(ctx, KMIP_TAG_ENCRYPTION_KEY_INFORMATION))
-    {
-        value->encryption_key_info = ctx->calloc_func(ctx->state, 1, sizeof(EncryptionKeyInformation));
-        CHECK_NEW_MEMORY(ctx, value->encryption_key_info, sizeof(EncryptionKeyInformation), "EncryptionKeyInformation structure");
-        result = kmip_decode_encryption_key_information(ctx, value->encryption_key_info);
-        CHECK_RESULT(ctx, result);
-    }
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_MAC_SIGNATURE_KEY_INFORMATION))
-    {
-        value->mac_signature_key_info = ctx->calloc_func(ctx->state, 1, sizeof(MACSignatureKeyInformation));
-        CHECK_NEW_MEMORY(ctx, value->mac_signature_key_info, sizeof(MACSignatureKeyInformation), "MACSignatureKeyInformation structure");
-        result = kmip_decode_mac_signature_key_information(ctx, value->mac_signature_key_info);
-        CHECK_RESULT(ctx, result);
-    }
+    return(KMIP_OK);
+}
+
+int
+kmip_decode_credential_value(KMIP *ctx, enum credential_type type, void **value)
+{
+    int result = 0;
     
-    value->attribute_name_count = kmip_get_num_items_next(ctx, KMIP_TAG_ATTRIBUTE_NAME);
-    if(value->attribute_name_count > 0)
+    switch(type)
     {
-        value->attribute_names = ctx->calloc_func(ctx->state, value->attribute_name_count, sizeof(TextString));
-        CHECK_NEW_MEMORY(ctx, value->attribute_names, value->attribute_name_count * sizeof(TextString), "sequence of AttributeName text strings");
+        case KMIP_CRED_USERNAME_AND_PASSWORD:
+        *value = ctx->calloc_func(ctx->state, 1, sizeof(UsernamePasswordCredential));
+        CHECK_NEW_MEMORY(ctx, *value, sizeof(UsernamePasswordCredential), "UsernamePasswordCredential structure");
+        result = kmip_decode_username_password_credential(ctx, (UsernamePasswordCredential *)*value);
+        break;
         
-        for(size_t i = 0; i < value->attribute_name_count; i++)
-        {
-            result = kmip_decode_text_string(ctx, KMIP_TAG_ATTRIBUTE_NAME, &value->attribute_names[i]);
-            CHECK_RESULT(ctx, result);
-        }
-    }
-    
-    if(ctx->version >= KMIP_1_1)
-    {
-        result = kmip_decode_enum(ctx, KMIP_TAG_ENCODING_OPTION, &value->encoding_option);
-        CHECK_RESULT(ctx, result);
-        CHECK_ENUM(ctx, KMIP_TAG_ENCODING_OPTION, value->encoding_option);
+        case KMIP_CRED_DEVICE:
+        *value = ctx->calloc_func(ctx->state, 1, sizeof(DeviceCredential));
+        CHECK_NEW_MEMORY(ctx, *value, sizeof(DeviceCredential), "DeviceCredential structure");
+        result = kmip_decode_device_credential(ctx, (DeviceCredential *)*value);
+        break;
+        
+        case KMIP_CRED_ATTESTATION:
+        *value = ctx->calloc_func(ctx->state, 1, sizeof(AttestationCredential));
+        CHECK_NEW_MEMORY(ctx, *value, sizeof(AttestationCredential), "AttestationCredential structure");
+        result = kmip_decode_attestation_credential(ctx, (AttestationCredential*)*value);
+        break;
+        
+        default:
+        kmip_push_error_frame(ctx, __func__, __LINE__);
+        return(KMIP_NOT_IMPLEMENTED);
+        break;
     }
+    CHECK_RESULT(ctx, result);
     
     return(KMIP_OK);
 }
 
 int
-kmip_decode_create_request_payload(KMIP *ctx, CreateRequestPayload *value)
+kmip_decode_credential(KMIP *ctx, Credential *value)
 {
-    CHECK_DECODE_ARGS(ctx, value);
     CHECK_BUFFER_FULL(ctx, 8);
     
     int result = 0;
@@ -11678,81 +14911,24 @@ kmip_decode_create_request_payload(KMIP *ctx, CreateRequestPayload *value)
     uint32 length = 0;
     
     kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_REQUEST_PAYLOAD, KMIP_TYPE_STRUCTURE);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_CREDENTIAL, KMIP_TYPE_STRUCTURE);
     
     kmip_decode_int32_be(ctx, &length);
     CHECK_BUFFER_FULL(ctx, length);
     
-    result = kmip_decode_enum(ctx, KMIP_TAG_OBJECT_TYPE, &value->object_type);
+    result = kmip_decode_enum(ctx, KMIP_TAG_CREDENTIAL_TYPE, &value->credential_type);
+    CHECK_RESULT(ctx, result);
+    CHECK_ENUM(ctx, KMIP_TAG_CREDENTIAL_TYPE, value->credential_type);
+    
+    result = kmip_decode_credential_value(ctx, value->credential_type, &value->credential_value);
     CHECK_RESULT(ctx, result);
-    CHECK_ENUM(ctx, KMIP_TAG_OBJECT_TYPE, value->object_type);
-
-    if(ctx->version < KMIP_2_0)
-    {
-        value->template_attribute = ctx->calloc_func(ctx->state, 1, sizeof(TemplateAttribute));
-        if(value->template_attribute == NULL)
-        {
-            HANDLE_FAILED_ALLOC(ctx, sizeof(TemplateAttribute), "TemplateAttribute");
-        }
-        result = kmip_decode_template_attribute(ctx, value->template_attribute);
-        if(result != KMIP_OK)
-        {
-            kmip_free_template_attribute(ctx, value->template_attribute);
-            ctx->free_func(ctx, value->template_attribute);
-            value->template_attribute = NULL;
-            HANDLE_FAILURE(ctx, result);
-        }
-    }
-    else
-    {
-        value->attributes = ctx->calloc_func(ctx->state, 1, sizeof(Attributes));
-        if(value->attributes == NULL)
-        {
-            HANDLE_FAILED_ALLOC(ctx, sizeof(Attributes), "Attributes");
-        }
-        result = kmip_decode_attributes(ctx, value->attributes);
-        if(result != KMIP_OK)
-        {
-            kmip_free_attributes(ctx, value->attributes);
-            ctx->free_func(ctx, value->attributes);
-            value->attributes = NULL;
-
-            HANDLE_FAILURE(ctx, result);
-        }
-
-        if(kmip_is_tag_next(ctx, KMIP_TAG_PROTECTION_STORAGE_MASKS))
-        {
-            value->protection_storage_masks = ctx->calloc_func(ctx->state, 1, sizeof(ProtectionStorageMasks));
-            if(value->protection_storage_masks == NULL)
-            {
-                kmip_free_attributes(ctx, value->attributes);
-                ctx->free_func(ctx, value->attributes);
-                value->attributes = NULL;
-
-                HANDLE_FAILED_ALLOC(ctx, sizeof(ProtectionStorageMasks), "ProtectionStorageMasks");
-            }
-            result = kmip_decode_protection_storage_masks(ctx, value->protection_storage_masks);
-            if(result != KMIP_OK)
-            {
-                kmip_free_attributes(ctx, value->attributes);
-                kmip_free_protection_storage_masks(ctx, value->protection_storage_masks);
-                ctx->free_func(ctx, value->attributes);
-                ctx->free_func(ctx, value->protection_storage_masks);
-                value->attributes = NULL;
-                value->protection_storage_masks = NULL;
-
-                HANDLE_FAILURE(ctx, result);
-            }
-        }
-    }
     
     return(KMIP_OK);
 }
 
 int
-kmip_decode_create_response_payload(KMIP *ctx, CreateResponsePayload *value)
+kmip_decode_authentication(KMIP *ctx, Authentication *value)
 {
-    CHECK_DECODE_ARGS(ctx, value);
     CHECK_BUFFER_FULL(ctx, 8);
     
     int result = 0;
@@ -11760,38 +14936,22 @@ kmip_decode_create_response_payload(KMIP *ctx, CreateResponsePayload *value)
     uint32 length = 0;
     
     kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_RESPONSE_PAYLOAD, KMIP_TYPE_STRUCTURE);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_AUTHENTICATION, KMIP_TYPE_STRUCTURE);
     
     kmip_decode_int32_be(ctx, &length);
     CHECK_BUFFER_FULL(ctx, length);
     
-    result = kmip_decode_enum(ctx, KMIP_TAG_OBJECT_TYPE, &value->object_type);
-    CHECK_RESULT(ctx, result);
-    CHECK_ENUM(ctx, KMIP_TAG_OBJECT_TYPE, value->object_type);
-    
-    value->unique_identifier = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-    CHECK_NEW_MEMORY(ctx, value->unique_identifier, sizeof(TextString), "UniqueIdentifier text string");
+    value->credential = ctx->calloc_func(ctx->state, 1, sizeof(Credential));
+    CHECK_NEW_MEMORY(ctx, value->credential, sizeof(Credential), "Credential structure");
     
-    result = kmip_decode_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, value->unique_identifier);
+    result = kmip_decode_credential(ctx, value->credential);
     CHECK_RESULT(ctx, result);
     
-    if(ctx->version < KMIP_2_0)
-    {
-        if(kmip_is_tag_next(ctx, KMIP_TAG_TEMPLATE_ATTRIBUTE))
-        {
-            value->template_attribute = ctx->calloc_func(ctx->state, 1, sizeof(TemplateAttribute));
-            CHECK_NEW_MEMORY(ctx, value->template_attribute, sizeof(TemplateAttribute), "TemplateAttribute structure");
-            
-            result = kmip_decode_template_attribute(ctx, value->template_attribute);
-            CHECK_RESULT(ctx, result);
-        }
-    }
-
     return(KMIP_OK);
 }
 
 int
-kmip_decode_get_request_payload(KMIP *ctx, GetRequestPayload *value)
+kmip_decode_request_header(KMIP *ctx, RequestHeader *value)
 {
     CHECK_BUFFER_FULL(ctx, 8);
     
@@ -11800,139 +14960,105 @@ kmip_decode_get_request_payload(KMIP *ctx, GetRequestPayload *value)
     uint32 length = 0;
     
     kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_REQUEST_PAYLOAD, KMIP_TYPE_STRUCTURE);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_REQUEST_HEADER, KMIP_TYPE_STRUCTURE);
     
     kmip_decode_int32_be(ctx, &length);
     CHECK_BUFFER_FULL(ctx, length);
-
-    if(kmip_is_tag_next(ctx, KMIP_TAG_UNIQUE_IDENTIFIER))
-    {
-        value->unique_identifier = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-        CHECK_NEW_MEMORY(ctx, value->unique_identifier, sizeof(TextString), "UniqueIdentifier text string");
-        result = kmip_decode_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, value->unique_identifier);
-        CHECK_RESULT(ctx, result);
-    }
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_KEY_FORMAT_TYPE))
+    value->protocol_version = ctx->calloc_func(ctx->state, 1, sizeof(ProtocolVersion));
+    CHECK_NEW_MEMORY(ctx, value->protocol_version, sizeof(ProtocolVersion), "ProtocolVersion structure");
+    
+    result = kmip_decode_protocol_version(ctx, value->protocol_version);
+    CHECK_RESULT(ctx, result);
+    
+    if(kmip_is_tag_next(ctx, KMIP_TAG_MAXIMUM_RESPONSE_SIZE))
     {
-        result = kmip_decode_enum(ctx, KMIP_TAG_KEY_FORMAT_TYPE, &value->key_format_type);
+        result = kmip_decode_integer(ctx, KMIP_TAG_MAXIMUM_RESPONSE_SIZE, &value->maximum_response_size);
         CHECK_RESULT(ctx, result);
-        CHECK_ENUM(ctx, KMIP_TAG_KEY_FORMAT_TYPE, value->key_format_type);
     }
     
     if(ctx->version >= KMIP_1_4)
     {
-        if(kmip_is_tag_next(ctx, KMIP_TAG_KEY_WRAP_TYPE))
+        if(kmip_is_tag_next(ctx, KMIP_TAG_CLIENT_CORRELATION_VALUE))
         {
-            result = kmip_decode_enum(ctx, KMIP_TAG_KEY_WRAP_TYPE, &value->key_wrap_type);
+            result = kmip_decode_new_text_string(ctx, KMIP_TAG_CLIENT_CORRELATION_VALUE, &value->client_correlation_value, "ClientCorrelationValue text string");
+            CHECK_RESULT(ctx, result);
+        }
+        
+        if(kmip_is_tag_next(ctx, KMIP_TAG_SERVER_CORRELATION_VALUE))
+        {
+            result = kmip_decode_new_text_string(ctx, KMIP_TAG_SERVER_CORRELATION_VALUE, &value->server_correlation_value, "ServerCorrelationValue text string");
             CHECK_RESULT(ctx, result);
-            CHECK_ENUM(ctx, KMIP_TAG_KEY_WRAP_TYPE, value->key_wrap_type);
         }
     }
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_KEY_COMPRESSION_TYPE))
+    if(kmip_is_tag_next(ctx, KMIP_TAG_ASYNCHRONOUS_INDICATOR))
     {
-        result = kmip_decode_enum(ctx, KMIP_TAG_KEY_COMPRESSION_TYPE, &value->key_compression_type);
+        result = kmip_decode_bool(ctx, KMIP_TAG_ASYNCHRONOUS_INDICATOR, &value->asynchronous_indicator);
         CHECK_RESULT(ctx, result);
-        CHECK_ENUM(ctx, KMIP_TAG_KEY_COMPRESSION_TYPE, value->key_compression_type);
     }
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_KEY_WRAPPING_SPECIFICATION))
+    if(ctx->version >= KMIP_1_2)
     {
-        value->key_wrapping_spec = ctx->calloc_func(ctx->state, 1, sizeof(KeyWrappingSpecification));
-        CHECK_NEW_MEMORY(ctx, value->key_wrapping_spec, sizeof(KeyWrappingSpecification), "KeyWrappingSpecification structure");
-        result = kmip_decode_key_wrapping_specification(ctx, value->key_wrapping_spec);
-        CHECK_RESULT(ctx, result);
+        if(kmip_is_tag_next(ctx, KMIP_TAG_ATTESTATION_CAPABLE_INDICATOR))
+        {
+            result = kmip_decode_bool(ctx, KMIP_TAG_ATTESTATION_CAPABLE_INDICATOR, &value->attestation_capable_indicator);
+            CHECK_RESULT(ctx, result);
+        }
+        
+        size_t capacity = 0;
+        value->attestation_types = NULL;
+        value->attestation_type_count = 0;
+        while(kmip_is_tag_next(ctx, KMIP_TAG_ATTESTATION_TYPE))
+        {
+            enum attestation_type *attestation_types = kmip_grow_items(ctx, value->attestation_types, &capacity, value->attestation_type_count, sizeof(enum attestation_type));
+            CHECK_NEW_MEMORY(ctx, attestation_types, (value->attestation_type_count + 1) * sizeof(enum attestation_type), "sequence of AttestationType enumerations");
+            value->attestation_types = attestation_types;
+            
+            enum attestation_type *attestation_type = &value->attestation_types[value->attestation_type_count++];
+            result = kmip_decode_enum(ctx, KMIP_TAG_ATTESTATION_TYPE, attestation_type);
+            CHECK_RESULT(ctx, result);
+            CHECK_ENUM(ctx, KMIP_TAG_ATTESTATION_TYPE, *attestation_type);
+        }
+        value->attestation_types = kmip_trim_items(ctx, value->attestation_types, capacity, value->attestation_type_count, sizeof(enum attestation_type));
     }
     
-    return(KMIP_OK);
-}
-
-int
-kmip_decode_get_response_payload(KMIP *ctx, GetResponsePayload *value)
-{
-    CHECK_BUFFER_FULL(ctx, 8);
-    
-    int result = 0;
-    int32 tag_type = 0;
-    uint32 length = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_RESPONSE_PAYLOAD, KMIP_TYPE_STRUCTURE);
-    
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_BUFFER_FULL(ctx, length);
-    
-    result = kmip_decode_enum(ctx, KMIP_TAG_OBJECT_TYPE, &value->object_type);
-    CHECK_RESULT(ctx, result);
-    CHECK_ENUM(ctx, KMIP_TAG_OBJECT_TYPE, value->object_type);
-    
-    value->unique_identifier = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-    CHECK_NEW_MEMORY(ctx, value->unique_identifier, sizeof(TextString), "UniqueIdentifier text string");
-    
-    result = kmip_decode_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, value->unique_identifier);
-    CHECK_RESULT(ctx, result);
-    
-    switch(value->object_type)
+    if(kmip_is_tag_next(ctx, KMIP_TAG_AUTHENTICATION))
     {
-        case KMIP_OBJTYPE_SYMMETRIC_KEY:
-        value->object = ctx->calloc_func(ctx->state, 1, sizeof(SymmetricKey));
-        CHECK_NEW_MEMORY(ctx, value->object, sizeof(SymmetricKey), "SymmetricKey structure");
-        result = kmip_decode_symmetric_key(ctx, (SymmetricKey*)value->object);
-        CHECK_RESULT(ctx, result);
-        break;
-        
-        case KMIP_OBJTYPE_PUBLIC_KEY:
-        value->object = ctx->calloc_func(ctx->state, 1, sizeof(PublicKey));
-        CHECK_NEW_MEMORY(ctx, value->object, sizeof(PublicKey), "PublicKey structure");
-        result = kmip_decode_public_key(ctx, (PublicKey*)value->object);
-        CHECK_RESULT(ctx, result);
-        break;
+        value->authentication = ctx->calloc_func(ctx->state,1, sizeof(Authentication));
+        CHECK_NEW_MEMORY(ctx, value->authentication, sizeof(Authentication), "Authentication structure");
         
-        case KMIP_OBJTYPE_PRIVATE_KEY:
-        value->object = ctx->calloc_func(ctx->state, 1, sizeof(PrivateKey));
-        CHECK_NEW_MEMORY(ctx, value->object, sizeof(PrivateKey), "PrivateKey structure");
-        result = kmip_decode_private_key(ctx, (PrivateKey*)value->object);
+        result = kmip_decode_authentication(ctx, value->authentication);
         CHECK_RESULT(ctx, result);
-        break;
-        
-        default:
-        kmip_push_error_frame(ctx, __func__, __LINE__);
-        return(KMIP_NOT_IMPLEMENTED);
-        break;
-    };
-    
-    return(KMIP_OK);
-}
-
-int
-kmip_decode_destroy_request_payload(KMIP *ctx, DestroyRequestPayload *value)
-{
-    CHECK_BUFFER_FULL(ctx, 8);
-    
-    int result = 0;
-    int32 tag_type = 0;
-    uint32 length = 0;
+    }
     
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_REQUEST_PAYLOAD, KMIP_TYPE_STRUCTURE);
+    if(kmip_is_tag_next(ctx, KMIP_TAG_BATCH_ERROR_CONTINUATION_OPTION))
+    {
+        result = kmip_decode_enum(ctx, KMIP_TAG_BATCH_ERROR_CONTINUATION_OPTION, &value->batch_error_continuation_option);
+        CHECK_RESULT(ctx, result);
+        CHECK_ENUM(ctx, KMIP_TAG_BATCH_ERROR_CONTINUATION_OPTION, value->batch_error_continuation_option);
+    }
     
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_BUFFER_FULL(ctx, length);
+    if(kmip_is_tag_next(ctx, KMIP_TAG_BATCH_ORDER_OPTION))
+    {
+        result = kmip_decode_bool(ctx, KMIP_TAG_BATCH_ORDER_OPTION, &value->batch_order_option);
+        CHECK_RESULT(ctx, result);
+    }
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_UNIQUE_IDENTIFIER))
+    if(kmip_is_tag_next(ctx, KMIP_TAG_TIME_STAMP))
     {
-        value->unique_identifier = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-        CHECK_NEW_MEMORY(ctx, value->unique_identifier, sizeof(TextString), "UniqueIdentifier text string");
-        result = kmip_decode_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, value->unique_identifier);
+        result = kmip_decode_date_time(ctx, KMIP_TAG_TIME_STAMP, &value->time_stamp);
         CHECK_RESULT(ctx, result);
     }
     
+    result = kmip_decode_integer(ctx, KMIP_TAG_BATCH_COUNT, &value->batch_count);
+    CHECK_RESULT(ctx, result);
+    
     return(KMIP_OK);
 }
 
 int
-kmip_decode_destroy_response_payload(KMIP *ctx, DestroyResponsePayload *value)
+kmip_decode_response_header(KMIP *ctx, ResponseHeader *value)
 {
     CHECK_BUFFER_FULL(ctx, 8);
     
@@ -11941,89 +15067,83 @@ kmip_decode_destroy_response_payload(KMIP *ctx, DestroyResponsePayload *value)
     uint32 length = 0;
     
     kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_RESPONSE_PAYLOAD, KMIP_TYPE_STRUCTURE);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_RESPONSE_HEADER, KMIP_TYPE_STRUCTURE);
     
     kmip_decode_int32_be(ctx, &length);
     CHECK_BUFFER_FULL(ctx, length);
     
-    value->unique_identifier = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-    CHECK_NEW_MEMORY(ctx, value->unique_identifier, sizeof(TextString), "UniqueIdentifier text string");
+    value->protocol_version = ctx->calloc_func(ctx->state, 1, sizeof(ProtocolVersion));
+    CHECK_NEW_MEMORY(ctx, value->protocol_version, sizeof(ProtocolVersion), "ProtocolVersion structure");
     
-    result = kmip_decode_text_string(ctx, KMIP_TAG_UNIQUE_IDENTIFIER, value->unique_identifier);
+    result = kmip_decode_protocol_version(ctx, value->protocol_version);
     CHECK_RESULT(ctx, result);
     
-    return(KMIP_OK);
-}
-
-int
-kmip_decode_request_batch_item(KMIP *ctx, RequestBatchItem *value)
-{
-    CHECK_DECODE_ARGS(ctx, value);
-    CHECK_BUFFER_FULL(ctx, 8);
-    
-    int result = 0;
-    int32 tag_type = 0;
-    uint32 length = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_BATCH_ITEM, KMIP_TYPE_STRUCTURE);
-    
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_BUFFER_FULL(ctx, length);
-    
-    result = kmip_decode_enum(ctx, KMIP_TAG_OPERATION, &value->operation);
+    result = kmip_decode_date_time(ctx, KMIP_TAG_TIME_STAMP, &value->time_stamp);
     CHECK_RESULT(ctx, result);
-    CHECK_ENUM(ctx, KMIP_TAG_OPERATION, value->operation);
-
-    if(ctx->version >= KMIP_2_0)
+    
+    if(ctx->version >= KMIP_1_2)
     {
-        if(kmip_is_tag_next(ctx, KMIP_TAG_EPHEMERAL))
+        if(kmip_is_tag_next(ctx, KMIP_TAG_NONCE))
         {
-            result = kmip_decode_bool(ctx, KMIP_TAG_EPHEMERAL, &value->ephemeral);
+            value->nonce = ctx->calloc_func(ctx->state, 1, sizeof(Nonce));
+            CHECK_NEW_MEMORY(ctx, value->nonce, sizeof(Nonce), "Nonce structure");
+            
+            result = kmip_decode_nonce(ctx, value->nonce);
             CHECK_RESULT(ctx, result);
         }
-    }
 
-    if(kmip_is_tag_next(ctx, KMIP_TAG_UNIQUE_BATCH_ITEM_ID))
-    {
-        value->unique_batch_item_id = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
-        CHECK_NEW_MEMORY(ctx, value->unique_batch_item_id, sizeof(ByteString), "UniqueBatchItemID byte string");
-        result = kmip_decode_byte_string(ctx, KMIP_TAG_UNIQUE_BATCH_ITEM_ID, value->unique_batch_item_id);
-        CHECK_RESULT(ctx, result);
+        if(ctx->version >= KMIP_2_0)
+        {
+            if(kmip_is_tag_next(ctx, KMIP_TAG_SERVER_HASHED_PASSWORD))
+            {
+                value->server_hashed_password = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
+                CHECK_NEW_MEMORY(ctx, value->server_hashed_password, sizeof(ByteString), "ByteString");
+
+                result = kmip_decode_byte_string(ctx, KMIP_TAG_SERVER_HASHED_PASSWORD, value->server_hashed_password);
+                CHECK_RESULT(ctx, result);
+            }
+        }
+
+        size_t capacity = 0;
+        value->attestation_types = NULL;
+        value->attestation_type_count = 0;
+        while(kmip_is_tag_next(ctx, KMIP_TAG_ATTESTATION_TYPE))
+        {
+            enum attestation_type *attestation_types = kmip_grow_items(ctx, value->attestation_types, &capacity, value->attestation_type_count, sizeof(enum attestation_type));
+            CHECK_NEW_MEMORY(ctx, attestation_types, (value->attestation_type_count + 1) * sizeof(enum attestation_type), "sequence of AttestationType enumerations");
+            value->attestation_types = attestation_types;
+            
+            enum attestation_type *attestation_type = &value->attestation_types[value->attestation_type_count++];
+            result = kmip_decode_enum(ctx, KMIP_TAG_ATTESTATION_TYPE, attestation_type);
+            CHECK_RESULT(ctx, result);
+            CHECK_ENUM(ctx, KMIP_TAG_ATTESTATION_TYPE, *attestation_type);
+        }
+        value->attestation_types = kmip_trim_items(ctx, value->attestation_types, capacity, value->attestation_type_count, sizeof(enum attestation_type));
     }
     
-    switch(value->operation)
+    if(ctx->version >= KMIP_1_4)
     {
-        case KMIP_OP_CREATE:
-        value->request_payload = ctx->calloc_func(ctx->state, 1, sizeof(CreateRequestPayload));
-        CHECK_NEW_MEMORY(ctx, value->request_payload, sizeof(CreateRequestPayload), "CreateRequestPayload structure");
-        result = kmip_decode_create_request_payload(ctx, (CreateRequestPayload *)value->request_payload);
-        break;
-        
-        case KMIP_OP_GET:
-        value->request_payload = ctx->calloc_func(ctx->state, 1, sizeof(GetRequestPayload));
-        CHECK_NEW_MEMORY(ctx, value->request_payload, sizeof(GetRequestPayload), "GetRequestPayload structure");
-        result = kmip_decode_get_request_payload(ctx, (GetRequestPayload*)value->request_payload);
-        break;
-        
-        case KMIP_OP_DESTROY:
-        value->request_payload = ctx->calloc_func(ctx->state, 1, sizeof(DestroyRequestPayload));
-        CHECK_NEW_MEMORY(ctx, value->request_payload, sizeof(DestroyRequestPayload), "DestroyRequestPayload structure");
-        result = kmip_decode_destroy_request_payload(ctx, (DestroyRequestPayload*)value->request_payload);
-        break;
-        
-        default:
-        kmip_push_error_frame(ctx, __func__, __LINE__);
-        return(KMIP_NOT_IMPLEMENTED);
-        break;
-    };
+        if(kmip_is_tag_next(ctx, KMIP_TAG_CLIENT_CORRELATION_VALUE))
+        {
+            result = kmip_decode_new_text_string(ctx, KMIP_TAG_CLIENT_CORRELATION_VALUE, &value->client_correlation_value, "ClientCorrelationValue text string");
+            CHECK_RESULT(ctx, result);
+        }
+        
+        if(kmip_is_tag_next(ctx, KMIP_TAG_SERVER_CORRELATION_VALUE))
+        {
+            result = kmip_decode_new_text_string(ctx, KMIP_TAG_SERVER_CORRELATION_VALUE, &value->server_correlation_value, "ServerCorrelationValue text string");
+            CHECK_RESULT(ctx, result);
+        }
+    }
+    
+    result = kmip_decode_integer(ctx, KMIP_TAG_BATCH_COUNT, &value->batch_count);
     CHECK_RESULT(ctx, result);
     
     return(KMIP_OK);
 }
 
 int
-kmip_decode_response_batch_item(KMIP *ctx, ResponseBatchItem *value)
+kmip_decode_request_message(KMIP *ctx, RequestMessage *value)
 {
     CHECK_BUFFER_FULL(ctx, 8);
     
@@ -12032,626 +15152,1067 @@ kmip_decode_response_batch_item(KMIP *ctx, ResponseBatchItem *value)
     uint32 length = 0;
     
     kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_BATCH_ITEM, KMIP_TYPE_STRUCTURE);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_REQUEST_MESSAGE, KMIP_TYPE_STRUCTURE);
     
     kmip_decode_int32_be(ctx, &length);
     CHECK_BUFFER_FULL(ctx, length);
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_OPERATION))
-    {
-        result = kmip_decode_enum(ctx, KMIP_TAG_OPERATION, &value->operation);
-        CHECK_RESULT(ctx, result);
-        CHECK_ENUM(ctx, KMIP_TAG_OPERATION, value->operation);
-    }
+    value->request_header = ctx->calloc_func(ctx->state, 1, sizeof(RequestHeader));
+    CHECK_NEW_MEMORY(ctx, value->request_header, sizeof(RequestHeader), "RequestHeader structure");
+    kmip_init_request_header(value->request_header);
+    result = kmip_decode_request_header(ctx, value->request_header);
+    CHECK_RESULT(ctx, result);
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_UNIQUE_BATCH_ITEM_ID))
+    size_t capacity = 0;
+    value->batch_items = NULL;
+    value->batch_count = 0;
+    while(kmip_is_tag_next(ctx, KMIP_TAG_BATCH_ITEM))
     {
-        value->unique_batch_item_id = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
-        CHECK_NEW_MEMORY(ctx, value->unique_batch_item_id, sizeof(ByteString), "UniqueBatchItemID byte string");
+        RequestBatchItem *batch_items = kmip_grow_items(ctx, value->batch_items, &capacity, value->batch_count, sizeof(RequestBatchItem));
+        CHECK_NEW_MEMORY(ctx, batch_items, (value->batch_count + 1) * sizeof(RequestBatchItem), "sequence of RequestBatchItem structures");
+        value->batch_items = batch_items;
         
-        result = kmip_decode_byte_string(ctx, KMIP_TAG_UNIQUE_BATCH_ITEM_ID, value->unique_batch_item_id);
+        RequestBatchItem *batch_item = &value->batch_items[value->batch_count++];
+        kmip_init_request_batch_item(batch_item);
+        result = kmip_decode_request_batch_item(ctx, batch_item);
         CHECK_RESULT(ctx, result);
     }
+    value->batch_items = kmip_trim_items(ctx, value->batch_items, capacity, value->batch_count, sizeof(RequestBatchItem));
     
-    result = kmip_decode_enum(ctx, KMIP_TAG_RESULT_STATUS, &value->result_status);
+    return(KMIP_OK);
+}
+
+int
+kmip_decode_response_message(KMIP *ctx, ResponseMessage *value)
+{
+    CHECK_BUFFER_FULL(ctx, 8);
+    
+    int result = 0;
+    int32 tag_type = 0;
+    uint32 length = 0;
+    
+    kmip_decode_int32_be(ctx, &tag_type);
+    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_RESPONSE_MESSAGE, KMIP_TYPE_STRUCTURE);
+    
+    kmip_decode_int32_be(ctx, &length);
+    CHECK_BUFFER_FULL(ctx, length);
+    
+    value->response_header = ctx->calloc_func(ctx->state, 1, sizeof(ResponseHeader));
+    CHECK_NEW_MEMORY(ctx, value->response_header, sizeof(ResponseHeader), "ResponseHeader structure");
+    
+    result = kmip_decode_response_header(ctx, value->response_header);
     CHECK_RESULT(ctx, result);
-    CHECK_ENUM(ctx, KMIP_TAG_RESULT_STATUS, value->result_status);
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_RESULT_REASON))
+    size_t capacity = 0;
+    value->batch_items = NULL;
+    value->batch_count = 0;
+    while(kmip_is_tag_next(ctx, KMIP_TAG_BATCH_ITEM))
     {
-        result = kmip_decode_enum(ctx, KMIP_TAG_RESULT_REASON, &value->result_reason);
+        ResponseBatchItem *batch_items = kmip_grow_items(ctx, value->batch_items, &capacity, value->batch_count, sizeof(ResponseBatchItem));
+        CHECK_NEW_MEMORY(ctx, batch_items, (value->batch_count + 1) * sizeof(ResponseBatchItem), "sequence of ResponseBatchItem structures");
+        value->batch_items = batch_items;
+        
+        result = kmip_decode_response_batch_item(ctx, &value->batch_items[value->batch_count++]);
         CHECK_RESULT(ctx, result);
     }
+    value->batch_items = kmip_trim_items(ctx, value->batch_items, capacity, value->batch_count, sizeof(ResponseBatchItem));
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_RESULT_MESSAGE))
+    return(KMIP_OK);
+}
+
+int
+kmip_response_item_payload(KMIP *ctx, ResponseMessage *value, size_t index, void **payload)
+{
+    if(ctx == NULL || value == NULL || payload == NULL || index >= value->batch_count)
+    {
+        return(KMIP_ARG_INVALID);
+    }
+    
+    ResponseBatchItem *item = &value->batch_items[index];
+    
+    /* NOTE (ph) A pending payload is decoded from the span recorded by */
+    /*      kmip_decode_response_batch_item, so the context must still */
+    /*      hold the buffer the message was decoded from.               */
+    if(item->payload_size > 0)
     {
-        value->result_message = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-        CHECK_NEW_MEMORY(ctx, value->result_message, sizeof(TextString), "ResultMessage text string");
+        if(item->payload_offset > ctx->size || item->payload_size > ctx->size - item->payload_offset)
+        {
+            kmip_push_error_frame(ctx, __func__, __LINE__);
+            return(KMIP_ERROR_BUFFER_UNDERFULL);
+        }
+        
+        uint8 *index_save = ctx->index;
+        ctx->index = ctx->buffer + item->payload_offset;
         
-        result = kmip_decode_text_string(ctx, KMIP_TAG_RESULT_MESSAGE, value->result_message);
+        void *decoded = NULL;
+        int result = kmip_decode_response_payload(ctx, item->operation, &decoded);
+        
+        ctx->index = index_save;
+        if(result != KMIP_OK)
+        {
+            /* Release whatever part of the payload was decoded. */
+            ResponseBatchItem partial = {0};
+            partial.operation = item->operation;
+            partial.response_payload = decoded;
+            kmip_free_response_batch_item(ctx, &partial);
+        }
         CHECK_RESULT(ctx, result);
+        
+        item->response_payload = decoded;
+        item->payload_offset = 0;
+        item->payload_size = 0;
     }
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_ASYNCHRONOUS_CORRELATION_VALUE))
+    *payload = item->response_payload;
+    
+    return(KMIP_OK);
+}
+
+/*
+Schema Definitions
+*/
+
+/* NOTE (ph) Field columns: tag, type, offset, flags, minimum version, */
+/* enumeration tag used for value checks, child schema, and the name  */
+/* used in allocation error messages. Fields are listed in encoding   */
+/* order.                                                             */
+
+static const KMIPField kmip_name_fields[] = {
+    {KMIP_TAG_NAME_VALUE, KMIP_TYPE_TEXT_STRING, offsetof(Name, value), KMIP_FIELD_REQUIRED, KMIP_1_0, 0, NULL, "NameValue text string"},
+    {KMIP_TAG_NAME_TYPE, KMIP_TYPE_ENUMERATION, offsetof(Name, type), KMIP_FIELD_REQUIRED, KMIP_1_0, KMIP_TAG_NAME_TYPE, NULL, "NameType enumeration"}
+};
+
+const KMIPSchema kmip_name_schema = {
+    KMIP_TAG_NAME, sizeof(Name), "Name structure",
+    kmip_name_fields, ARRAY_LENGTH(kmip_name_fields)
+};
+
+static const KMIPField kmip_transparent_symmetric_key_fields[] = {
+    {KMIP_TAG_KEY, KMIP_TYPE_BYTE_STRING, offsetof(TransparentSymmetricKey, key), KMIP_FIELD_REQUIRED | KMIP_FIELD_SENSITIVE, KMIP_1_0, 0, NULL, "Key byte string"}
+};
+
+const KMIPSchema kmip_transparent_symmetric_key_schema = {
+    KMIP_TAG_KEY_MATERIAL, sizeof(TransparentSymmetricKey), "TransparentSymmetricKey structure",
+    kmip_transparent_symmetric_key_fields, ARRAY_LENGTH(kmip_transparent_symmetric_key_fields)
+};
+
+static const KMIPField kmip_cryptographic_parameters_fields[] = {
+    /* KMIP 1.0 */
+    {KMIP_TAG_BLOCK_CIPHER_MODE, KMIP_TYPE_ENUMERATION, offsetof(CryptographicParameters, block_cipher_mode), KMIP_FIELD_OPTIONAL, KMIP_1_0, KMIP_TAG_BLOCK_CIPHER_MODE, NULL, "BlockCipherMode enumeration"},
+    {KMIP_TAG_PADDING_METHOD, KMIP_TYPE_ENUMERATION, offsetof(CryptographicParameters, padding_method), KMIP_FIELD_OPTIONAL, KMIP_1_0, KMIP_TAG_PADDING_METHOD, NULL, "PaddingMethod enumeration"},
+    {KMIP_TAG_HASHING_ALGORITHM, KMIP_TYPE_ENUMERATION, offsetof(CryptographicParameters, hashing_algorithm), KMIP_FIELD_OPTIONAL, KMIP_1_0, KMIP_TAG_HASHING_ALGORITHM, NULL, "HashingAlgorithm enumeration"},
+    {KMIP_TAG_KEY_ROLE_TYPE, KMIP_TYPE_ENUMERATION, offsetof(CryptographicParameters, key_role_type), KMIP_FIELD_OPTIONAL, KMIP_1_0, KMIP_TAG_KEY_ROLE_TYPE, NULL, "KeyRoleType enumeration"},
+    /* KMIP 1.2 */
+    {KMIP_TAG_DIGITAL_SIGNATURE_ALGORITHM, KMIP_TYPE_ENUMERATION, offsetof(CryptographicParameters, digital_signature_algorithm), KMIP_FIELD_OPTIONAL, KMIP_1_2, KMIP_TAG_DIGITAL_SIGNATURE_ALGORITHM, NULL, "DigitalSignatureAlgorithm enumeration"},
+    {KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM, KMIP_TYPE_ENUMERATION, offsetof(CryptographicParameters, cryptographic_algorithm), KMIP_FIELD_OPTIONAL, KMIP_1_2, KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM, NULL, "CryptographicAlgorithm enumeration"},
+    {KMIP_TAG_RANDOM_IV, KMIP_TYPE_BOOLEAN, offsetof(CryptographicParameters, random_iv), KMIP_FIELD_OPTIONAL, KMIP_1_2, 0, NULL, "RandomIV boolean"},
+    {KMIP_TAG_IV_LENGTH, KMIP_TYPE_INTEGER, offsetof(CryptographicParameters, iv_length), KMIP_FIELD_OPTIONAL, KMIP_1_2, 0, NULL, "IVLength integer"},
+    {KMIP_TAG_TAG_LENGTH, KMIP_TYPE_INTEGER, offsetof(CryptographicParameters, tag_length), KMIP_FIELD_OPTIONAL, KMIP_1_2, 0, NULL, "TagLength integer"},
+    {KMIP_TAG_FIXED_FIELD_LENGTH, KMIP_TYPE_INTEGER, offsetof(CryptographicParameters, fixed_field_length), KMIP_FIELD_OPTIONAL, KMIP_1_2, 0, NULL, "FixedFieldLength integer"},
+    {KMIP_TAG_INVOCATION_FIELD_LENGTH, KMIP_TYPE_INTEGER, offsetof(CryptographicParameters, invocation_field_length), KMIP_FIELD_OPTIONAL, KMIP_1_2, 0, NULL, "InvocationFieldLength integer"},
+    {KMIP_TAG_COUNTER_LENGTH, KMIP_TYPE_INTEGER, offsetof(CryptographicParameters, counter_length), KMIP_FIELD_OPTIONAL, KMIP_1_2, 0, NULL, "CounterLength integer"},
+    {KMIP_TAG_INITIAL_COUNTER_VALUE, KMIP_TYPE_INTEGER, offsetof(CryptographicParameters, initial_counter_value), KMIP_FIELD_OPTIONAL, KMIP_1_2, 0, NULL, "InitialCounterValue integer"},
+    /* KMIP 1.4 */
+    {KMIP_TAG_SALT_LENGTH, KMIP_TYPE_INTEGER, offsetof(CryptographicParameters, salt_length), KMIP_FIELD_OPTIONAL, KMIP_1_4, 0, NULL, "SaltLength integer"},
+    {KMIP_TAG_MASK_GENERATOR, KMIP_TYPE_ENUMERATION, offsetof(CryptographicParameters, mask_generator), KMIP_FIELD_OPTIONAL, KMIP_1_4, KMIP_TAG_MASK_GENERATOR, NULL, "MaskGenerator enumeration"},
+    {KMIP_TAG_MASK_GENERATOR_HASHING_ALGORITHM, KMIP_TYPE_ENUMERATION, offsetof(CryptographicParameters, mask_generator_hashing_algorithm), KMIP_FIELD_OPTIONAL, KMIP_1_4, KMIP_TAG_HASHING_ALGORITHM, NULL, "MaskGeneratorHashingAlgorithm enumeration"},
+    {KMIP_TAG_P_SOURCE, KMIP_TYPE_BYTE_STRING, offsetof(CryptographicParameters, p_source), KMIP_FIELD_OPTIONAL, KMIP_1_4, 0, NULL, "P Source byte string"},
+    {KMIP_TAG_TRAILER_FIELD, KMIP_TYPE_INTEGER, offsetof(CryptographicParameters, trailer_field), KMIP_FIELD_OPTIONAL, KMIP_1_4, 0, NULL, "TrailerField integer"}
+};
+
+const KMIPSchema kmip_cryptographic_parameters_schema = {
+    KMIP_TAG_CRYPTOGRAPHIC_PARAMETERS, sizeof(CryptographicParameters), "CryptographicParameters structure",
+    kmip_cryptographic_parameters_fields, ARRAY_LENGTH(kmip_cryptographic_parameters_fields)
+};
+
+static const KMIPField kmip_encryption_key_information_fields[] = {
+    {KMIP_TAG_UNIQUE_IDENTIFIER, KMIP_TYPE_TEXT_STRING, offsetof(EncryptionKeyInformation, unique_identifier), KMIP_FIELD_REQUIRED, KMIP_1_0, 0, NULL, "UniqueIdentifier text string"},
+    {KMIP_TAG_CRYPTOGRAPHIC_PARAMETERS, KMIP_TYPE_STRUCTURE, offsetof(EncryptionKeyInformation, cryptographic_parameters), KMIP_FIELD_OPTIONAL, KMIP_1_0, 0, &kmip_cryptographic_parameters_schema, "CryptographicParameters structure"}
+};
+
+const KMIPSchema kmip_encryption_key_information_schema = {
+    KMIP_TAG_ENCRYPTION_KEY_INFORMATION, sizeof(EncryptionKeyInformation), "EncryptionKeyInformation structure",
+    kmip_encryption_key_information_fields, ARRAY_LENGTH(kmip_encryption_key_information_fields)
+};
+
+static const KMIPField kmip_mac_signature_key_information_fields[] = {
+    {KMIP_TAG_UNIQUE_IDENTIFIER, KMIP_TYPE_TEXT_STRING, offsetof(MACSignatureKeyInformation, unique_identifier), KMIP_FIELD_REQUIRED, KMIP_1_0, 0, NULL, "UniqueIdentifier text string"},
+    {KMIP_TAG_CRYPTOGRAPHIC_PARAMETERS, KMIP_TYPE_STRUCTURE, offsetof(MACSignatureKeyInformation, cryptographic_parameters), KMIP_FIELD_OPTIONAL, KMIP_1_0, 0, &kmip_cryptographic_parameters_schema, "CryptographicParameters structure"}
+};
+
+const KMIPSchema kmip_mac_signature_key_information_schema = {
+    KMIP_TAG_MAC_SIGNATURE_KEY_INFORMATION, sizeof(MACSignatureKeyInformation), "MAC/SignatureKeyInformation structure",
+    kmip_mac_signature_key_information_fields, ARRAY_LENGTH(kmip_mac_signature_key_information_fields)
+};
+
+static const KMIPField kmip_key_wrapping_data_fields[] = {
+    /* KMIP 1.0 */
+    {KMIP_TAG_WRAPPING_METHOD, KMIP_TYPE_ENUMERATION, offsetof(KeyWrappingData, wrapping_method), KMIP_FIELD_REQUIRED, KMIP_1_0, KMIP_TAG_WRAPPING_METHOD, NULL, "WrappingMethod enumeration"},
+    {KMIP_TAG_ENCRYPTION_KEY_INFORMATION, KMIP_TYPE_STRUCTURE, offsetof(KeyWrappingData, encryption_key_info), KMIP_FIELD_OPTIONAL, KMIP_1_0, 0, &kmip_encryption_key_information_schema, "EncryptionKeyInformation structure"},
+    {KMIP_TAG_MAC_SIGNATURE_KEY_INFORMATION, KMIP_TYPE_STRUCTURE, offsetof(KeyWrappingData, mac_signature_key_info), KMIP_FIELD_OPTIONAL, KMIP_1_0, 0, &kmip_mac_signature_key_information_schema, "MAC/SignatureKeyInformation structure"},
+    {KMIP_TAG_MAC_SIGNATURE, KMIP_TYPE_BYTE_STRING, offsetof(KeyWrappingData, mac_signature), KMIP_FIELD_OPTIONAL, KMIP_1_0, 0, NULL, "MAC/Signature byte string"},
+    {KMIP_TAG_IV_COUNTER_NONCE, KMIP_TYPE_BYTE_STRING, offsetof(KeyWrappingData, iv_counter_nonce), KMIP_FIELD_OPTIONAL, KMIP_1_0, 0, NULL, "IV/Counter/Nonce byte string"},
+    /* KMIP 1.1 */
+    {KMIP_TAG_ENCODING_OPTION, KMIP_TYPE_ENUMERATION, offsetof(KeyWrappingData, encoding_option), KMIP_FIELD_ENCODE_REQUIRED, KMIP_1_1, KMIP_TAG_ENCODING_OPTION, NULL, "EncodingOption enumeration"}
+};
+
+const KMIPSchema kmip_key_wrapping_data_schema = {
+    KMIP_TAG_KEY_WRAPPING_DATA, sizeof(KeyWrappingData), "KeyWrappingData structure",
+    kmip_key_wrapping_data_fields, ARRAY_LENGTH(kmip_key_wrapping_data_fields)
+};
+
+static const KMIPField kmip_destroy_request_payload_fields[] = {
+    {KMIP_TAG_UNIQUE_IDENTIFIER, KMIP_TYPE_TEXT_STRING, offsetof(DestroyRequestPayload, unique_identifier), KMIP_FIELD_OPTIONAL, KMIP_1_0, 0, NULL, "UniqueIdentifier text string"}
+};
+
+const KMIPSchema kmip_destroy_request_payload_schema = {
+    KMIP_TAG_REQUEST_PAYLOAD, sizeof(DestroyRequestPayload), "DestroyRequestPayload structure",
+    kmip_destroy_request_payload_fields, ARRAY_LENGTH(kmip_destroy_request_payload_fields)
+};
+
+static const KMIPField kmip_destroy_response_payload_fields[] = {
+    {KMIP_TAG_UNIQUE_IDENTIFIER, KMIP_TYPE_TEXT_STRING, offsetof(DestroyResponsePayload, unique_identifier), KMIP_FIELD_REQUIRED, KMIP_1_0, 0, NULL, "UniqueIdentifier text string"}
+};
+
+const KMIPSchema kmip_destroy_response_payload_schema = {
+    KMIP_TAG_RESPONSE_PAYLOAD, sizeof(DestroyResponsePayload), "DestroyResponsePayload structure",
+    kmip_destroy_response_payload_fields, ARRAY_LENGTH(kmip_destroy_response_payload_fields)
+};
+
+static const KMIPField kmip_nonce_fields[] = {
+    {KMIP_TAG_NONCE_ID, KMIP_TYPE_BYTE_STRING, offsetof(Nonce, nonce_id), KMIP_FIELD_REQUIRED | KMIP_FIELD_SENSITIVE, KMIP_1_0, 0, NULL, "NonceID byte string"},
+    {KMIP_TAG_NONCE_VALUE, KMIP_TYPE_BYTE_STRING, offsetof(Nonce, nonce_value), KMIP_FIELD_REQUIRED | KMIP_FIELD_SENSITIVE, KMIP_1_0, 0, NULL, "NonceValue byte string"}
+};
+
+const KMIPSchema kmip_nonce_schema = {
+    KMIP_TAG_NONCE, sizeof(Nonce), "Nonce structure",
+    kmip_nonce_fields, ARRAY_LENGTH(kmip_nonce_fields)
+};
+
+static const KMIPField kmip_username_password_credential_fields[] = {
+    {KMIP_TAG_USERNAME, KMIP_TYPE_TEXT_STRING, offsetof(UsernamePasswordCredential, username), KMIP_FIELD_REQUIRED, KMIP_1_0, 0, NULL, "Username text string"},
+    {KMIP_TAG_PASSWORD, KMIP_TYPE_TEXT_STRING, offsetof(UsernamePasswordCredential, password), KMIP_FIELD_OPTIONAL | KMIP_FIELD_SENSITIVE, KMIP_1_0, 0, NULL, "Password text string"}
+};
+
+const KMIPSchema kmip_username_password_credential_schema = {
+    KMIP_TAG_CREDENTIAL_VALUE, sizeof(UsernamePasswordCredential), "UsernamePasswordCredential structure",
+    kmip_username_password_credential_fields, ARRAY_LENGTH(kmip_username_password_credential_fields)
+};
+
+static const KMIPField kmip_device_credential_fields[] = {
+    {KMIP_TAG_DEVICE_SERIAL_NUMBER, KMIP_TYPE_TEXT_STRING, offsetof(DeviceCredential, device_serial_number), KMIP_FIELD_OPTIONAL, KMIP_1_0, 0, NULL, "DeviceSerialNumber text string"},
+    {KMIP_TAG_PASSWORD, KMIP_TYPE_TEXT_STRING, offsetof(DeviceCredential, password), KMIP_FIELD_OPTIONAL | KMIP_FIELD_SENSITIVE, KMIP_1_0, 0, NULL, "Password text string"},
+    {KMIP_TAG_DEVICE_IDENTIFIER, KMIP_TYPE_TEXT_STRING, offsetof(DeviceCredential, device_identifier), KMIP_FIELD_OPTIONAL, KMIP_1_0, 0, NULL, "DeviceIdentifier text string"},
+    {KMIP_TAG_NETWORK_IDENTIFIER, KMIP_TYPE_TEXT_STRING, offsetof(DeviceCredential, network_identifier), KMIP_FIELD_OPTIONAL, KMIP_1_0, 0, NULL, "NetworkIdentifier text string"},
+    {KMIP_TAG_MACHINE_IDENTIFIER, KMIP_TYPE_TEXT_STRING, offsetof(DeviceCredential, machine_identifier), KMIP_FIELD_OPTIONAL, KMIP_1_0, 0, NULL, "MachineIdentifier text string"},
+    {KMIP_TAG_MEDIA_IDENTIFIER, KMIP_TYPE_TEXT_STRING, offsetof(DeviceCredential, media_identifier), KMIP_FIELD_OPTIONAL, KMIP_1_0, 0, NULL, "MediaIdentifier text string"}
+};
+
+const KMIPSchema kmip_device_credential_schema = {
+    KMIP_TAG_CREDENTIAL_VALUE, sizeof(DeviceCredential), "DeviceCredential structure",
+    kmip_device_credential_fields, ARRAY_LENGTH(kmip_device_credential_fields)
+};
+
+static const KMIPField kmip_attestation_credential_fields[] = {
+    {KMIP_TAG_NONCE, KMIP_TYPE_STRUCTURE, offsetof(AttestationCredential, nonce), KMIP_FIELD_REQUIRED, KMIP_1_0, 0, &kmip_nonce_schema, "Nonce structure"},
+    {KMIP_TAG_ATTESTATION_TYPE, KMIP_TYPE_ENUMERATION, offsetof(AttestationCredential, attestation_type), KMIP_FIELD_REQUIRED, KMIP_1_0, KMIP_TAG_ATTESTATION_TYPE, NULL, "AttestationType enumeration"},
+    {KMIP_TAG_ATTESTATION_MEASUREMENT, KMIP_TYPE_BYTE_STRING, offsetof(AttestationCredential, attestation_measurement), KMIP_FIELD_OPTIONAL | KMIP_FIELD_SENSITIVE, KMIP_1_0, 0, NULL, "AttestationMeasurement byte string"},
+    {KMIP_TAG_ATTESTATION_ASSERTION, KMIP_TYPE_BYTE_STRING, offsetof(AttestationCredential, attestation_assertion), KMIP_FIELD_OPTIONAL | KMIP_FIELD_SENSITIVE, KMIP_1_0, 0, NULL, "AttestationAssertion byte string"}
+};
+
+const KMIPSchema kmip_attestation_credential_schema = {
+    KMIP_TAG_CREDENTIAL_VALUE, sizeof(AttestationCredential), "AttestationCredential structure",
+    kmip_attestation_credential_fields, ARRAY_LENGTH(kmip_attestation_credential_fields)
+};
+
+/*
+Schema Functions
+*/
+
+int
+kmip_is_scalar_field(const KMIPField *field)
+{
+    switch(field->type)
     {
-        value->asynchronous_correlation_value = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
-        CHECK_NEW_MEMORY(ctx, value->asynchronous_correlation_value, sizeof(ByteString), "AsynchronousCorrelationValue byte string");
+        case KMIP_TYPE_TEXT_STRING:
+        case KMIP_TYPE_BYTE_STRING:
+        case KMIP_TYPE_STRUCTURE:
+        return(KMIP_FALSE);
         
-        result = kmip_decode_byte_string(ctx, KMIP_TAG_ASYNCHRONOUS_CORRELATION_VALUE, value->asynchronous_correlation_value);
-        CHECK_RESULT(ctx, result);
+        default:
+        return(KMIP_TRUE);
+    };
+}
+
+int
+kmip_is_field_set(const KMIPField *field, const void *value)
+{
+    const uint8 *address = (const uint8 *)value + field->offset;
+    
+    switch(field->type)
+    {
+        case KMIP_TYPE_INTEGER:
+        return(*(const int32 *)address != KMIP_UNSET);
+        
+        case KMIP_TYPE_LONG_INTEGER:
+        return(*(const int64 *)address != KMIP_UNSET);
+        
+        case KMIP_TYPE_BOOLEAN:
+        return(*(const bool32 *)address != KMIP_UNSET);
+        
+        case KMIP_TYPE_ENUMERATION:
+        return(*(const int32 *)address != 0);
+        
+        case KMIP_TYPE_DATE_TIME:
+        return(*(const uint64 *)address != 0);
+        
+        case KMIP_TYPE_INTERVAL:
+        return(*(const uint32 *)address != 0);
+        
+        default:
+        return(*(void * const *)address != NULL);
+    };
+}
+
+void
+kmip_init_schema(const KMIPSchema *schema, void *value)
+{
+    if(schema == NULL || value == NULL)
+    {
+        return;
     }
     
-    /* NOTE (ph) Omitting the tag check is a good way to test error output. */
-    if(kmip_is_tag_next(ctx, KMIP_TAG_RESPONSE_PAYLOAD))
+    for(size_t i = 0; i < schema->field_count; i++)
     {
-        switch(value->operation)
+        const KMIPField *field = &schema->fields[i];
+        uint8 *address = (uint8 *)value + field->offset;
+        
+        switch(field->type)
         {
-            case KMIP_OP_CREATE:
-            value->response_payload = ctx->calloc_func(ctx->state, 1, sizeof(CreateResponsePayload));
-            CHECK_NEW_MEMORY(ctx, value->response_payload, sizeof(CreateResponsePayload), "CreateResponsePayload structure");
-            result = kmip_decode_create_response_payload(ctx, value->response_payload);
+            case KMIP_TYPE_INTEGER:
+            *(int32 *)address = KMIP_UNSET;
             break;
             
-            case KMIP_OP_GET:
-            value->response_payload = ctx->calloc_func(ctx->state, 1, sizeof(GetResponsePayload));
-            CHECK_NEW_MEMORY(ctx, value->response_payload, sizeof(GetResponsePayload), "GetResponsePayload structure");
+            case KMIP_TYPE_LONG_INTEGER:
+            *(int64 *)address = KMIP_UNSET;
+            break;
             
-            result = kmip_decode_get_response_payload(ctx, value->response_payload);
+            case KMIP_TYPE_BOOLEAN:
+            *(bool32 *)address = KMIP_UNSET;
             break;
             
-            case KMIP_OP_DESTROY:
-            value->response_payload = ctx->calloc_func(ctx->state, 1, sizeof(DestroyResponsePayload));
-            CHECK_NEW_MEMORY(ctx, value->response_payload, sizeof(DestroyResponsePayload), "DestroyResponsePayload structure");
-            result = kmip_decode_destroy_response_payload(ctx, value->response_payload);
+            case KMIP_TYPE_ENUMERATION:
+            *(int32 *)address = 0;
+            break;
+            
+            case KMIP_TYPE_DATE_TIME:
+            *(uint64 *)address = 0;
+            break;
+            
+            case KMIP_TYPE_INTERVAL:
+            *(uint32 *)address = 0;
+            break;
+            
+            default:
+            *(void **)address = NULL;
+            break;
+        };
+    }
+}
+
+void
+kmip_free_schema(KMIP *ctx, const KMIPSchema *schema, void *value)
+{
+    if(schema == NULL || value == NULL)
+    {
+        return;
+    }
+    
+    for(size_t i = 0; i < schema->field_count; i++)
+    {
+        const KMIPField *field = &schema->fields[i];
+        void **address = (void **)((uint8 *)value + field->offset);
+        
+        if(kmip_is_scalar_field(field) || *address == NULL)
+        {
+            continue;
+        }
+        
+        switch(field->type)
+        {
+            case KMIP_TYPE_TEXT_STRING:
+            if(field->flags & KMIP_FIELD_SENSITIVE)
+            {
+                kmip_free_sensitive_text_string(ctx, *address);
+            }
+            else
+            {
+                kmip_free_text_string(ctx, *address);
+            }
             break;
             
-            default:
-            kmip_push_error_frame(ctx, __func__, __LINE__);
-            return(KMIP_NOT_IMPLEMENTED);
-            break;
-        };
-        CHECK_RESULT(ctx, result);
+            case KMIP_TYPE_BYTE_STRING:
+            if(field->flags & KMIP_FIELD_SENSITIVE)
+            {
+                kmip_free_sensitive_byte_string(ctx, *address);
+            }
+            else
+            {
+                kmip_free_byte_string(ctx, *address);
+            }
+            break;
+            
+            default:
+            kmip_free_schema(ctx, field->child, *address);
+            break;
+        };
+        
+        ctx->free_func(ctx->state, *address);
+        *address = NULL;
+    }
+    
+    kmip_init_schema(schema, value);
+    
+    return;
+}
+
+int
+kmip_compare_schema(const KMIPSchema *schema, const void *a, const void *b)
+{
+    if(a != b)
+    {
+        if((a == NULL) || (b == NULL))
+        {
+            return(KMIP_FALSE);
+        }
+        
+        for(size_t i = 0; i < schema->field_count; i++)
+        {
+            const KMIPField *field = &schema->fields[i];
+            const uint8 *x = (const uint8 *)a + field->offset;
+            const uint8 *y = (const uint8 *)b + field->offset;
+            int match = KMIP_TRUE;
+            
+            switch(field->type)
+            {
+                case KMIP_TYPE_INTEGER:
+                case KMIP_TYPE_ENUMERATION:
+                match = (*(const int32 *)x == *(const int32 *)y);
+                break;
+                
+                case KMIP_TYPE_LONG_INTEGER:
+                match = (*(const int64 *)x == *(const int64 *)y);
+                break;
+                
+                case KMIP_TYPE_BOOLEAN:
+                match = (*(const bool32 *)x == *(const bool32 *)y);
+                break;
+                
+                case KMIP_TYPE_DATE_TIME:
+                match = (*(const uint64 *)x == *(const uint64 *)y);
+                break;
+                
+                case KMIP_TYPE_INTERVAL:
+                match = (*(const uint32 *)x == *(const uint32 *)y);
+                break;
+                
+                case KMIP_TYPE_TEXT_STRING:
+                match = kmip_compare_text_string(*(TextString * const *)x, *(TextString * const *)y);
+                break;
+                
+                case KMIP_TYPE_BYTE_STRING:
+                match = kmip_compare_byte_string(*(ByteString * const *)x, *(ByteString * const *)y);
+                break;
+                
+                default:
+                match = kmip_compare_schema(field->child, *(void * const *)x, *(void * const *)y);
+                break;
+            };
+            
+            if(match != KMIP_TRUE)
+            {
+                return(KMIP_FALSE);
+            }
+        }
     }
     
-    return(KMIP_OK);
+    return(KMIP_TRUE);
 }
 
-int
-kmip_decode_nonce(KMIP *ctx, Nonce *value)
+uint64
+kmip_hash_schema(const KMIPSchema *schema, const void *value)
 {
-    CHECK_BUFFER_FULL(ctx, 8);
-    
-    int result = 0;
-    int32 tag_type = 0;
-    uint32 length = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_NONCE, KMIP_TYPE_STRUCTURE);
-    
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_BUFFER_FULL(ctx, length);
+    uint64 hash = kmip_get_hash_seed();
     
-    value->nonce_id = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
-    CHECK_NEW_MEMORY(ctx, value->nonce_id, sizeof(ByteString), "NonceID byte string");
-    
-    result = kmip_decode_byte_string(ctx, KMIP_TAG_NONCE_ID, value->nonce_id);
-    CHECK_RESULT(ctx, result);
+    if(value == NULL)
+    {
+        return(hash);
+    }
     
-    value->nonce_value = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
-    CHECK_NEW_MEMORY(ctx, value->nonce_value, sizeof(ByteString), "NonceValue byte string");
+    for(size_t i = 0; i < schema->field_count; i++)
+    {
+        const KMIPField *field = &schema->fields[i];
+        const uint8 *address = (const uint8 *)value + field->offset;
     
-    result = kmip_decode_byte_string(ctx, KMIP_TAG_NONCE_VALUE, value->nonce_value);
-    CHECK_RESULT(ctx, result);
+        switch(field->type)
+        {
+            case KMIP_TYPE_INTEGER:
+            case KMIP_TYPE_ENUMERATION:
+            hash = kmip_hash_mix(hash, (uint64)*(const int32 *)address);
+            break;
     
-    return(KMIP_OK);
-}
-
-int
-kmip_decode_username_password_credential(KMIP *ctx, UsernamePasswordCredential *value)
-{
-    CHECK_BUFFER_FULL(ctx, 8);
+            case KMIP_TYPE_LONG_INTEGER:
+            hash = kmip_hash_mix(hash, (uint64)*(const int64 *)address);
+            break;
     
-    int result = 0;
-    int32 tag_type = 0;
-    uint32 length = 0;
+            case KMIP_TYPE_BOOLEAN:
+            hash = kmip_hash_mix(hash, (uint64)*(const bool32 *)address);
+            break;
     
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_CREDENTIAL_VALUE, KMIP_TYPE_STRUCTURE);
+            case KMIP_TYPE_DATE_TIME:
+            hash = kmip_hash_mix(hash, *(const uint64 *)address);
+            break;
     
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_BUFFER_FULL(ctx, length);
+            case KMIP_TYPE_INTERVAL:
+            hash = kmip_hash_mix(hash, *(const uint32 *)address);
+            break;
     
-    value->username = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-    CHECK_NEW_MEMORY(ctx, value->username, sizeof(TextString), "Username text string");
+            case KMIP_TYPE_TEXT_STRING:
+            hash = kmip_hash_mix(hash, kmip_hash_text_string(*(TextString * const *)address));
+            break;
     
-    result = kmip_decode_text_string(ctx, KMIP_TAG_USERNAME, value->username);
-    CHECK_RESULT(ctx, result);
+            case KMIP_TYPE_BYTE_STRING:
+            hash = kmip_hash_mix(hash, kmip_hash_byte_string(*(ByteString * const *)address));
+            break;
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_PASSWORD))
-    {
-        value->password = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-        CHECK_NEW_MEMORY(ctx, value->password, sizeof(TextString), "Password text string");
-        
-        result = kmip_decode_text_string(ctx, KMIP_TAG_PASSWORD, value->password);
-        CHECK_RESULT(ctx, result);
+            default:
+            hash = kmip_hash_mix(hash, kmip_hash_schema(field->child, *(void * const *)address));
+            break;
+        };
     }
     
-    return(KMIP_OK);
+    return(hash);
 }
 
-int
-kmip_decode_device_credential(KMIP *ctx, DeviceCredential *value)
+size_t
+kmip_size_schema(KMIP *ctx, const KMIPSchema *schema, const void *value)
 {
-    CHECK_BUFFER_FULL(ctx, 8);
-    
-    int result = 0;
-    int32 tag_type = 0;
-    uint32 length = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_CREDENTIAL_VALUE, KMIP_TYPE_STRUCTURE);
-    
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_BUFFER_FULL(ctx, length);
-    
-    if(kmip_is_tag_next(ctx, KMIP_TAG_DEVICE_SERIAL_NUMBER))
-    {
-        value->device_serial_number = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-        CHECK_NEW_MEMORY(ctx, value->device_serial_number, sizeof(TextString), "DeviceSerialNumber text string");
-        
-        result = kmip_decode_text_string(ctx, KMIP_TAG_DEVICE_SERIAL_NUMBER, value->device_serial_number);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    if(kmip_is_tag_next(ctx, KMIP_TAG_PASSWORD))
-    {
-        value->password = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-        CHECK_NEW_MEMORY(ctx, value->password, sizeof(TextString), "Password text string");
-        
-        result = kmip_decode_text_string(ctx, KMIP_TAG_PASSWORD, value->password);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    if(kmip_is_tag_next(ctx, KMIP_TAG_DEVICE_IDENTIFIER))
+    if(value == NULL)
     {
-        value->device_identifier = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-        CHECK_NEW_MEMORY(ctx, value->device_identifier, sizeof(TextString), "DeviceIdentifier text string");
-        
-        result = kmip_decode_text_string(ctx, KMIP_TAG_DEVICE_IDENTIFIER, value->device_identifier);
-        CHECK_RESULT(ctx, result);
+        return(0);
     }
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_NETWORK_IDENTIFIER))
-    {
-        value->network_identifier = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-        CHECK_NEW_MEMORY(ctx, value->network_identifier, sizeof(TextString), "NetworkIdentifier text string");
-        
-        result = kmip_decode_text_string(ctx, KMIP_TAG_NETWORK_IDENTIFIER, value->network_identifier);
-        CHECK_RESULT(ctx, result);
-    }
+    size_t size = 8;
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_MACHINE_IDENTIFIER))
+    for(size_t i = 0; i < schema->field_count; i++)
     {
-        value->machine_identifier = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-        CHECK_NEW_MEMORY(ctx, value->machine_identifier, sizeof(TextString), "MachineIdentifier text string");
+        const KMIPField *field = &schema->fields[i];
+        const uint8 *address = (const uint8 *)value + field->offset;
         
-        result = kmip_decode_text_string(ctx, KMIP_TAG_MACHINE_IDENTIFIER, value->machine_identifier);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    if(kmip_is_tag_next(ctx, KMIP_TAG_MEDIA_IDENTIFIER))
-    {
-        value->media_identifier = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-        CHECK_NEW_MEMORY(ctx, value->media_identifier, sizeof(TextString), "MediaIdentifier text string");
+        if(ctx->version < field->min_version)
+        {
+            continue;
+        }
         
-        result = kmip_decode_text_string(ctx, KMIP_TAG_MEDIA_IDENTIFIER, value->media_identifier);
-        CHECK_RESULT(ctx, result);
+        switch(field->type)
+        {
+            case KMIP_TYPE_TEXT_STRING:
+            size += kmip_size_text_string(*(TextString * const *)address);
+            break;
+            
+            case KMIP_TYPE_BYTE_STRING:
+            size += kmip_size_byte_string(*(ByteString * const *)address);
+            break;
+            
+            case KMIP_TYPE_STRUCTURE:
+            size += kmip_size_schema(ctx, field->child, *(void * const *)address);
+            break;
+            
+            default:
+            {
+                if((field->flags & KMIP_FIELD_ENCODE_REQUIRED) || kmip_is_field_set(field, value))
+                {
+                    size += 16;
+                }
+            }
+            break;
+        };
     }
     
-    return(KMIP_OK);
+    return(size);
 }
 
 int
-kmip_decode_attestation_credential(KMIP *ctx, AttestationCredential *value)
+kmip_encode_field(KMIP *ctx, const KMIPSchema *schema, const KMIPField *field, const void *value)
 {
-    CHECK_BUFFER_FULL(ctx, 8);
-    
-    int result = 0;
-    int32 tag_type = 0;
-    uint32 length = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_CREDENTIAL_VALUE, KMIP_TYPE_STRUCTURE);
-    
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_BUFFER_FULL(ctx, length);
+    const uint8 *address = (const uint8 *)value + field->offset;
     
-    value->nonce = ctx->calloc_func(ctx->state, 1, sizeof(Nonce));
-    CHECK_NEW_MEMORY(ctx, value->nonce, sizeof(Nonce), "Nonce structure");
-    
-    result = kmip_decode_nonce(ctx, value->nonce);
-    CHECK_RESULT(ctx, result);
-    
-    result = kmip_decode_enum(ctx, KMIP_TAG_ATTESTATION_TYPE, &value->attestation_type);
-    CHECK_RESULT(ctx, result);
-    CHECK_ENUM(ctx, KMIP_TAG_ATTESTATION_TYPE, value->attestation_type);
-    
-    if(kmip_is_tag_next(ctx, KMIP_TAG_ATTESTATION_MEASUREMENT))
+    if(!kmip_is_scalar_field(field) && *(void * const *)address == NULL)
     {
-        value->attestation_measurement = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
-        CHECK_NEW_MEMORY(ctx, value->attestation_measurement, sizeof(ByteString), "AttestationMeasurement byte string");
-        
-        result = kmip_decode_byte_string(ctx, KMIP_TAG_ATTESTATION_MEASUREMENT, value->attestation_measurement);
-        CHECK_RESULT(ctx, result);
+        kmip_init_error_message(ctx);
+        snprintf(ctx->error_message, ctx->error_message_size, "The %s is missing the required %s.", schema->name, field->name);
+        kmip_push_error_frame(ctx, __func__, __LINE__);
+        return(KMIP_INVALID_FIELD);
     }
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_ATTESTATION_ASSERTION))
+    switch(field->type)
     {
-        value->attestation_assertion = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
-        CHECK_NEW_MEMORY(ctx, value->attestation_assertion, sizeof(ByteString), "AttestationAssertion byte string");
+        case KMIP_TYPE_INTEGER:
+        return(kmip_encode_integer(ctx, field->tag, *(const int32 *)address));
         
-        result = kmip_decode_byte_string(ctx, KMIP_TAG_ATTESTATION_ASSERTION, value->attestation_assertion);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    return(KMIP_OK);
+        case KMIP_TYPE_LONG_INTEGER:
+        return(kmip_encode_long(ctx, field->tag, *(const int64 *)address));
+        
+        case KMIP_TYPE_ENUMERATION:
+        return(kmip_encode_enum(ctx, field->tag, *(const int32 *)address));
+        
+        case KMIP_TYPE_BOOLEAN:
+        return(kmip_encode_bool(ctx, field->tag, *(const bool32 *)address));
+        
+        case KMIP_TYPE_DATE_TIME:
+        return(kmip_encode_date_time(ctx, field->tag, *(const uint64 *)address));
+        
+        case KMIP_TYPE_INTERVAL:
+        return(kmip_encode_interval(ctx, field->tag, *(const uint32 *)address));
+        
+        case KMIP_TYPE_TEXT_STRING:
+        return(kmip_encode_text_string(ctx, field->tag, *(TextString * const *)address));
+        
+        case KMIP_TYPE_BYTE_STRING:
+        return(kmip_encode_byte_string(ctx, field->tag, *(ByteString * const *)address));
+        
+        case KMIP_TYPE_STRUCTURE:
+        return(kmip_encode_schema(ctx, field->child, *(void * const *)address));
+        
+        default:
+        {
+            kmip_push_error_frame(ctx, __func__, __LINE__);
+            return(KMIP_NOT_IMPLEMENTED);
+        }
+    };
 }
 
 int
-kmip_decode_credential_value(KMIP *ctx, enum credential_type type, void **value)
+kmip_encode_schema(KMIP *ctx, const KMIPSchema *schema, const void *value)
 {
     int result = 0;
+    result = kmip_encode_int32_be(ctx, TAG_TYPE(schema->tag, KMIP_TYPE_STRUCTURE));
+    CHECK_RESULT(ctx, result);
     
-    switch(type)
+    CHECK_ENCODE_BUFFER(ctx, 4);
+    size_t length_index = ctx->index - ctx->buffer;
+    size_t value_index = (ctx->index += 4) - ctx->buffer;
+    
+    for(size_t i = 0; i < schema->field_count; i++)
     {
-        case KMIP_CRED_USERNAME_AND_PASSWORD:
-        *value = ctx->calloc_func(ctx->state, 1, sizeof(UsernamePasswordCredential));
-        CHECK_NEW_MEMORY(ctx, *value, sizeof(UsernamePasswordCredential), "UsernamePasswordCredential structure");
-        result = kmip_decode_username_password_credential(ctx, (UsernamePasswordCredential *)*value);
-        break;
+        const KMIPField *field = &schema->fields[i];
         
-        case KMIP_CRED_DEVICE:
-        *value = ctx->calloc_func(ctx->state, 1, sizeof(DeviceCredential));
-        CHECK_NEW_MEMORY(ctx, *value, sizeof(DeviceCredential), "DeviceCredential structure");
-        result = kmip_decode_device_credential(ctx, (DeviceCredential *)*value);
-        break;
+        if(ctx->version < field->min_version)
+        {
+            continue;
+        }
         
-        case KMIP_CRED_ATTESTATION:
-        *value = ctx->calloc_func(ctx->state, 1, sizeof(AttestationCredential));
-        CHECK_NEW_MEMORY(ctx, *value, sizeof(AttestationCredential), "AttestationCredential structure");
-        result = kmip_decode_attestation_credential(ctx, (AttestationCredential*)*value);
-        break;
+        if(!(field->flags & KMIP_FIELD_ENCODE_REQUIRED) && !kmip_is_field_set(field, value))
+        {
+            continue;
+        }
         
-        default:
-        kmip_push_error_frame(ctx, __func__, __LINE__);
-        return(KMIP_NOT_IMPLEMENTED);
-        break;
+        result = kmip_encode_field(ctx, schema, field, value);
+        CHECK_RESULT(ctx, result);
     }
-    CHECK_RESULT(ctx, result);
-    
-    return(KMIP_OK);
-}
-
-int
-kmip_decode_credential(KMIP *ctx, Credential *value)
-{
-    CHECK_BUFFER_FULL(ctx, 8);
-    
-    int result = 0;
-    int32 tag_type = 0;
-    uint32 length = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_CREDENTIAL, KMIP_TYPE_STRUCTURE);
     
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_BUFFER_FULL(ctx, length);
+    uint8 *curr_index = ctx->index;
+    ctx->index = ctx->buffer + length_index;
     
-    result = kmip_decode_enum(ctx, KMIP_TAG_CREDENTIAL_TYPE, &value->credential_type);
-    CHECK_RESULT(ctx, result);
-    CHECK_ENUM(ctx, KMIP_TAG_CREDENTIAL_TYPE, value->credential_type);
+    kmip_encode_int32_be(ctx, (curr_index - ctx->buffer) - value_index);
     
-    result = kmip_decode_credential_value(ctx, value->credential_type, &value->credential_value);
-    CHECK_RESULT(ctx, result);
+    ctx->index = curr_index;
     
     return(KMIP_OK);
 }
 
 int
-kmip_decode_authentication(KMIP *ctx, Authentication *value)
+kmip_decode_field(KMIP *ctx, const KMIPField *field, void *value)
 {
-    CHECK_BUFFER_FULL(ctx, 8);
-    
+    uint8 *address = (uint8 *)value + field->offset;
     int result = 0;
-    int32 tag_type = 0;
-    uint32 length = 0;
     
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_AUTHENTICATION, KMIP_TYPE_STRUCTURE);
-    
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_BUFFER_FULL(ctx, length);
-    
-    value->credential = ctx->calloc_func(ctx->state, 1, sizeof(Credential));
-    CHECK_NEW_MEMORY(ctx, value->credential, sizeof(Credential), "Credential structure");
-    
-    result = kmip_decode_credential(ctx, value->credential);
-    CHECK_RESULT(ctx, result);
-    
-    return(KMIP_OK);
+    switch(field->type)
+    {
+        case KMIP_TYPE_INTEGER:
+        return(kmip_decode_integer(ctx, field->tag, (int32 *)address));
+        
+        case KMIP_TYPE_LONG_INTEGER:
+        return(kmip_decode_long(ctx, field->tag, (int64 *)address));
+        
+        case KMIP_TYPE_ENUMERATION:
+        {
+            result = kmip_decode_enum(ctx, field->tag, address);
+            CHECK_RESULT(ctx, result);
+            
+            if(field->enum_tag != 0)
+            {
+                CHECK_ENUM(ctx, field->enum_tag, *(int32 *)address);
+            }
+            
+            return(KMIP_OK);
+        }
+        
+        case KMIP_TYPE_BOOLEAN:
+        return(kmip_decode_bool(ctx, field->tag, (bool32 *)address));
+        
+        case KMIP_TYPE_DATE_TIME:
+        return(kmip_decode_date_time(ctx, field->tag, (uint64 *)address));
+        
+        case KMIP_TYPE_INTERVAL:
+        return(kmip_decode_interval(ctx, field->tag, (uint32 *)address));
+        
+        case KMIP_TYPE_TEXT_STRING:
+        {
+            return(kmip_decode_new_text_string(ctx, field->tag, (TextString **)address, field->name));
+        }
+        
+        case KMIP_TYPE_BYTE_STRING:
+        {
+            ByteString *string = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
+            CHECK_NEW_MEMORY(ctx, string, sizeof(ByteString), field->name);
+            *(ByteString **)address = string;
+            
+            return(kmip_decode_byte_string(ctx, field->tag, string));
+        }
+        
+        case KMIP_TYPE_STRUCTURE:
+        {
+            void *child = ctx->calloc_func(ctx->state, 1, field->child->size);
+            CHECK_NEW_MEMORY(ctx, child, field->child->size, field->name);
+            *(void **)address = child;
+            
+            return(kmip_decode_schema(ctx, field->child, child));
+        }
+        
+        default:
+        {
+            kmip_push_error_frame(ctx, __func__, __LINE__);
+            return(KMIP_NOT_IMPLEMENTED);
+        }
+    };
 }
 
 int
-kmip_decode_request_header(KMIP *ctx, RequestHeader *value)
+kmip_decode_schema(KMIP *ctx, const KMIPSchema *schema, void *value)
 {
     CHECK_BUFFER_FULL(ctx, 8);
     
+    kmip_init_schema(schema, value);
+    
     int result = 0;
     int32 tag_type = 0;
     uint32 length = 0;
     
     kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_REQUEST_HEADER, KMIP_TYPE_STRUCTURE);
+    CHECK_TAG_TYPE(ctx, tag_type, schema->tag, KMIP_TYPE_STRUCTURE);
     
     kmip_decode_int32_be(ctx, &length);
     CHECK_BUFFER_FULL(ctx, length);
     
-    value->protocol_version = ctx->calloc_func(ctx->state, 1, sizeof(ProtocolVersion));
-    CHECK_NEW_MEMORY(ctx, value->protocol_version, sizeof(ProtocolVersion), "ProtocolVersion structure");
-    
-    result = kmip_decode_protocol_version(ctx, value->protocol_version);
-    CHECK_RESULT(ctx, result);
-    
-    if(kmip_is_tag_next(ctx, KMIP_TAG_MAXIMUM_RESPONSE_SIZE))
-    {
-        result = kmip_decode_integer(ctx, KMIP_TAG_MAXIMUM_RESPONSE_SIZE, &value->maximum_response_size);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    if(ctx->version >= KMIP_1_4)
+    for(size_t i = 0; i < schema->field_count; i++)
     {
-        if(kmip_is_tag_next(ctx, KMIP_TAG_CLIENT_CORRELATION_VALUE))
-        {
-            value->client_correlation_value = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-            CHECK_NEW_MEMORY(ctx, value->client_correlation_value, sizeof(TextString), "ClientCorrelationValue text string");
-            
-            result = kmip_decode_text_string(ctx, KMIP_TAG_CLIENT_CORRELATION_VALUE, value->client_correlation_value);
-            CHECK_RESULT(ctx, result);
-        }
+        const KMIPField *field = &schema->fields[i];
         
-        if(kmip_is_tag_next(ctx, KMIP_TAG_SERVER_CORRELATION_VALUE))
-        {
-            value->server_correlation_value = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-            CHECK_NEW_MEMORY(ctx, value->server_correlation_value, sizeof(TextString), "ServerCorrelationValue text string");
-            
-            result = kmip_decode_text_string(ctx, KMIP_TAG_SERVER_CORRELATION_VALUE, value->server_correlation_value);
-            CHECK_RESULT(ctx, result);
-        }
-    }
-    
-    if(kmip_is_tag_next(ctx, KMIP_TAG_ASYNCHRONOUS_INDICATOR))
-    {
-        result = kmip_decode_bool(ctx, KMIP_TAG_ASYNCHRONOUS_INDICATOR, &value->asynchronous_indicator);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    if(ctx->version >= KMIP_1_2)
-    {
-        if(kmip_is_tag_next(ctx, KMIP_TAG_ATTESTATION_CAPABLE_INDICATOR))
+        if(ctx->version < field->min_version)
         {
-            result = kmip_decode_bool(ctx, KMIP_TAG_ATTESTATION_CAPABLE_INDICATOR, &value->attestation_capable_indicator);
-            CHECK_RESULT(ctx, result);
+            continue;
         }
         
-        value->attestation_type_count = kmip_get_num_items_next(ctx, KMIP_TAG_ATTESTATION_TYPE);
-        if(value->attestation_type_count > 0)
+        if(!(field->flags & KMIP_FIELD_DECODE_REQUIRED) && !kmip_is_tag_next(ctx, field->tag))
         {
-            value->attestation_types = ctx->calloc_func(ctx->state, value->attestation_type_count, sizeof(enum attestation_type));
-            CHECK_NEW_MEMORY(ctx, value->attestation_types, value->attestation_type_count * sizeof(enum attestation_type), "sequence of AttestationType enumerations");
-            
-            for(size_t i = 0; i < value->attestation_type_count; i++)
-            {
-                result = kmip_decode_enum(ctx, KMIP_TAG_ATTESTATION_TYPE, &value->attestation_types[i]);
-                CHECK_RESULT(ctx, result);
-                CHECK_ENUM(ctx, KMIP_TAG_ATTESTATION_TYPE, value->attestation_types[i]);
-            }
+            continue;
         }
-    }
-    
-    if(kmip_is_tag_next(ctx, KMIP_TAG_AUTHENTICATION))
-    {
-        value->authentication = ctx->calloc_func(ctx->state,1, sizeof(Authentication));
-        CHECK_NEW_MEMORY(ctx, value->authentication, sizeof(Authentication), "Authentication structure");
         
-        result = kmip_decode_authentication(ctx, value->authentication);
-        CHECK_RESULT(ctx, result);
-    }
-    
-    if(kmip_is_tag_next(ctx, KMIP_TAG_BATCH_ERROR_CONTINUATION_OPTION))
-    {
-        result = kmip_decode_enum(ctx, KMIP_TAG_BATCH_ERROR_CONTINUATION_OPTION, &value->batch_error_continuation_option);
-        CHECK_RESULT(ctx, result);
-        CHECK_ENUM(ctx, KMIP_TAG_BATCH_ERROR_CONTINUATION_OPTION, value->batch_error_continuation_option);
-    }
-    
-    if(kmip_is_tag_next(ctx, KMIP_TAG_BATCH_ORDER_OPTION))
-    {
-        result = kmip_decode_bool(ctx, KMIP_TAG_BATCH_ORDER_OPTION, &value->batch_order_option);
+        result = kmip_decode_field(ctx, field, value);
         CHECK_RESULT(ctx, result);
     }
     
-    if(kmip_is_tag_next(ctx, KMIP_TAG_TIME_STAMP))
+    return(KMIP_OK);
+}
+
+/*
+Incremental Parser Functions
+*/
+
+void
+kmip_parser_init(KMIPParser *parser, KMIP *ctx)
+{
+    if(parser == NULL)
     {
-        result = kmip_decode_date_time(ctx, KMIP_TAG_TIME_STAMP, &value->time_stamp);
-        CHECK_RESULT(ctx, result);
+        return;
     }
     
-    result = kmip_decode_integer(ctx, KMIP_TAG_BATCH_COUNT, &value->batch_count);
-    CHECK_RESULT(ctx, result);
+    parser->ctx = ctx;
+    parser->buffer = NULL;
+    parser->size = 0;
+    parser->capacity = 0;
+    parser->item_func = NULL;
+    parser->item_state = NULL;
     
-    return(KMIP_OK);
+    kmip_parser_reset(parser);
 }
 
 int
-kmip_decode_response_header(KMIP *ctx, ResponseHeader *value)
+kmip_parser_feed(KMIPParser *parser, const void *data, size_t length)
 {
-    CHECK_BUFFER_FULL(ctx, 8);
-    
-    int result = 0;
-    int32 tag_type = 0;
-    uint32 length = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_RESPONSE_HEADER, KMIP_TYPE_STRUCTURE);
-    
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_BUFFER_FULL(ctx, length);
-    
-    value->protocol_version = ctx->calloc_func(ctx->state, 1, sizeof(ProtocolVersion));
-    CHECK_NEW_MEMORY(ctx, value->protocol_version, sizeof(ProtocolVersion), "ProtocolVersion structure");
+    if(parser == NULL || parser->ctx == NULL || (data == NULL && length > 0))
+    {
+        return(KMIP_ARG_INVALID);
+    }
     
-    result = kmip_decode_protocol_version(ctx, value->protocol_version);
-    CHECK_RESULT(ctx, result);
+    KMIP *ctx = parser->ctx;
+    const uint8 *bytes = (const uint8 *)data;
+    parser->consumed = 0;
     
-    result = kmip_decode_date_time(ctx, KMIP_TAG_TIME_STAMP, &value->time_stamp);
-    CHECK_RESULT(ctx, result);
+    if(parser->state != KMIP_PARSER_NEED_MORE)
+    {
+        return(parser->state);
+    }
     
-    if(ctx->version >= KMIP_1_2)
+    for(;;)
     {
-        if(kmip_is_tag_next(ctx, KMIP_TAG_NONCE))
+        /* NOTE (ph) Only the bytes still missing from the message header */
+        /*      (or, once that is known, the message body) are taken, so */
+        /*      trailing bytes belonging to the next message are left to */
+        /*      the caller. parser->consumed reports how many were used. */
+        size_t needed = (parser->message_size > 0) ? parser->message_size : 8;
+        size_t taken = needed - parser->size;
+        if(taken > length)
         {
-            value->nonce = ctx->calloc_func(ctx->state, 1, sizeof(Nonce));
-            CHECK_NEW_MEMORY(ctx, value->nonce, sizeof(Nonce), "Nonce structure");
-            
-            result = kmip_decode_nonce(ctx, value->nonce);
-            CHECK_RESULT(ctx, result);
+            taken = length;
         }
-
-        if(ctx->version >= KMIP_2_0)
+        
+        if(taken > 0)
         {
-            if(kmip_is_tag_next(ctx, KMIP_TAG_SERVER_HASHED_PASSWORD))
+            if(parser->capacity < needed)
             {
-                value->server_hashed_password = ctx->calloc_func(ctx->state, 1, sizeof(ByteString));
-                CHECK_NEW_MEMORY(ctx, value->server_hashed_password, sizeof(ByteString), "ByteString");
-
-                result = kmip_decode_byte_string(ctx, KMIP_TAG_SERVER_HASHED_PASSWORD, value->server_hashed_password);
-                CHECK_RESULT(ctx, result);
+                uint8 *grown = ctx->realloc_func(ctx->state, parser->buffer, needed);
+                if(grown == NULL)
+                {
+                    kmip_set_error_message(ctx, "Could not grow the parser buffer.");
+                    kmip_push_error_frame(ctx, __func__, __LINE__);
+                    parser->state = KMIP_MEMORY_ALLOC_FAILED;
+                    return(parser->state);
+                }
+                
+                parser->buffer = grown;
+                parser->capacity = needed;
             }
+            
+            ctx->memcpy_func(ctx->state, parser->buffer + parser->size, bytes, taken);
+            parser->size += taken;
+            parser->consumed += taken;
+            bytes += taken;
+            length -= taken;
         }
-
-        value->attestation_type_count = kmip_get_num_items_next(ctx, KMIP_TAG_ATTESTATION_TYPE);
-        if(value->attestation_type_count > 0)
+        
+        if(parser->message_size == 0)
         {
-            value->attestation_types = ctx->calloc_func(ctx->state, value->attestation_type_count, sizeof(enum attestation_type));
-            CHECK_NEW_MEMORY(ctx, value->attestation_types, value->attestation_type_count * sizeof(enum attestation_type), "sequence of AttestationType enumerations");
+            if(parser->size < 8)
+            {
+                return(KMIP_PARSER_NEED_MORE);
+            }
             
-            for(size_t i = 0; i < value->attestation_type_count; i++)
+            const uint8 *header = parser->buffer;
+            uint32 tag = (header[0] << 16) | (header[1] << 8) | header[2];
+            uint32 value_length = ((uint32)header[4] << 24) | (header[5] << 16) | (header[6] << 8) | header[7];
+            
+            if(header[3] != KMIP_TYPE_STRUCTURE)
             {
-                result = kmip_decode_enum(ctx, KMIP_TAG_ATTESTATION_TYPE, &value->attestation_types[i]);
-                CHECK_RESULT(ctx, result);
-                CHECK_ENUM(ctx, KMIP_TAG_ATTESTATION_TYPE, value->attestation_types[i]);
+                kmip_set_error_message(ctx, "The parsed message does not start with a structure.");
+                kmip_push_error_frame(ctx, __func__, __LINE__);
+                parser->state = KMIP_TYPE_MISMATCH;
+                return(parser->state);
+            }
+            
+            if(ctx->max_message_size > 0 && value_length > (uint32)ctx->max_message_size)
+            {
+                kmip_push_error_frame(ctx, __func__, __LINE__);
+                parser->state = KMIP_EXCEED_MAX_MESSAGE_SIZE;
+                return(parser->state);
             }
+            
+            parser->message_size = 8 + (size_t)value_length;
+            parser->stack[0].tag = (enum tag)tag;
+            parser->stack[0].start = 0;
+            parser->stack[0].end = parser->message_size;
+            parser->depth = 1;
+            parser->offset = 8;
+            
+            /* Copy whatever is left of this chunk into the sized buffer. */
+            continue;
         }
+        
+        break;
     }
     
-    if(ctx->version >= KMIP_1_4)
+    /* NOTE (ph) parser->offset always sits on a TTLV header boundary. */
+    /*      Structure headers are stepped into as soon as they arrive; */
+    /*      primitives are stepped over once their value is complete.  */
+    while(parser->depth > 0)
     {
-        if(kmip_is_tag_next(ctx, KMIP_TAG_CLIENT_CORRELATION_VALUE))
+        KMIPParserFrame *frame = &parser->stack[parser->depth - 1];
+        
+        if(parser->offset == frame->end)
         {
-            value->client_correlation_value = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-            CHECK_NEW_MEMORY(ctx, value->client_correlation_value, sizeof(TextString), "ClientCorrelationValue text string");
+            if(parser->item_func != NULL)
+            {
+                KMIPParserItem item = {0};
+                item.tag = frame->tag;
+                item.type = KMIP_TYPE_STRUCTURE;
+                item.length = (uint32)(frame->end - frame->start - 8);
+                item.depth = parser->depth - 1;
+                item.encoding = parser->buffer + frame->start;
+                item.encoding_size = frame->end - frame->start;
+                
+                int result = parser->item_func(parser->item_state, &item);
+                if(result != KMIP_OK)
+                {
+                    kmip_push_error_frame(ctx, __func__, __LINE__);
+                    parser->state = result;
+                    return(parser->state);
+                }
+            }
             
-            result = kmip_decode_text_string(ctx, KMIP_TAG_CLIENT_CORRELATION_VALUE, value->client_correlation_value);
-            CHECK_RESULT(ctx, result);
+            parser->depth--;
+            continue;
         }
         
-        if(kmip_is_tag_next(ctx, KMIP_TAG_SERVER_CORRELATION_VALUE))
+        if(parser->size - parser->offset < 8)
+        {
+            break;
+        }
+        
+        const uint8 *header = parser->buffer + parser->offset;
+        uint32 tag = (header[0] << 16) | (header[1] << 8) | header[2];
+        uint8 type = header[3];
+        uint32 value_length = ((uint32)header[4] << 24) | (header[5] << 16) | (header[6] << 8) | header[7];
+        
+        if(type < KMIP_TYPE_STRUCTURE || type > KMIP_TYPE_DATE_TIME_EXTENDED)
+        {
+            kmip_set_error_message(ctx, "The parsed message contains an unknown item type.");
+            kmip_push_error_frame(ctx, __func__, __LINE__);
+            parser->state = KMIP_TYPE_MISMATCH;
+            return(parser->state);
+        }
+        
+        size_t remaining = frame->end - parser->offset;
+        if(remaining < 8 || value_length > remaining - 8)
         {
-            value->server_correlation_value = ctx->calloc_func(ctx->state, 1, sizeof(TextString));
-            CHECK_NEW_MEMORY(ctx, value->server_correlation_value, sizeof(TextString), "ServerCorrelationValue text string");
+            kmip_set_error_message(ctx, "A parsed item overruns its enclosing structure.");
+            kmip_push_error_frame(ctx, __func__, __LINE__);
+            parser->state = KMIP_LENGTH_MISMATCH;
+            return(parser->state);
+        }
+        
+        if(type == KMIP_TYPE_STRUCTURE)
+        {
+            if(parser->depth == KMIP_PARSER_MAX_DEPTH)
+            {
+                kmip_set_error_message(ctx, "The parsed message nests structures too deeply.");
+                kmip_push_error_frame(ctx, __func__, __LINE__);
+                parser->state = KMIP_INVALID_ENCODING;
+                return(parser->state);
+            }
             
-            result = kmip_decode_text_string(ctx, KMIP_TAG_SERVER_CORRELATION_VALUE, value->server_correlation_value);
-            CHECK_RESULT(ctx, result);
+            KMIPParserFrame *child = &parser->stack[parser->depth++];
+            child->tag = (enum tag)tag;
+            child->start = parser->offset;
+            child->end = parser->offset + 8 + value_length;
+            
+            parser->offset += 8;
+            continue;
         }
+        
+        size_t item_size = 8 + (size_t)value_length + CALCULATE_PADDING(value_length);
+        if(item_size > remaining)
+        {
+            kmip_set_error_message(ctx, "A parsed item overruns its enclosing structure.");
+            kmip_push_error_frame(ctx, __func__, __LINE__);
+            parser->state = KMIP_LENGTH_MISMATCH;
+            return(parser->state);
+        }
+        
+        if(parser->size - parser->offset < item_size)
+        {
+            break;
+        }
+        
+        if(parser->item_func != NULL)
+        {
+            KMIPParserItem item = {0};
+            item.tag = (enum tag)tag;
+            item.type = (enum type)type;
+            item.length = value_length;
+            item.depth = parser->depth;
+            item.encoding = header;
+            item.encoding_size = item_size;
+            
+            int result = parser->item_func(parser->item_state, &item);
+            if(result != KMIP_OK)
+            {
+                kmip_push_error_frame(ctx, __func__, __LINE__);
+                parser->state = result;
+                return(parser->state);
+            }
+        }
+        
+        parser->offset += item_size;
     }
     
-    result = kmip_decode_integer(ctx, KMIP_TAG_BATCH_COUNT, &value->batch_count);
-    CHECK_RESULT(ctx, result);
+    if(parser->depth == 0)
+    {
+        parser->state = KMIP_PARSER_COMPLETE;
+    }
     
-    return(KMIP_OK);
+    return(parser->state);
 }
 
-int
-kmip_decode_request_message(KMIP *ctx, RequestMessage *value)
+void
+kmip_parser_reset(KMIPParser *parser)
 {
-    CHECK_BUFFER_FULL(ctx, 8);
-    
-    int result = 0;
-    int32 tag_type = 0;
-    uint32 length = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_REQUEST_MESSAGE, KMIP_TYPE_STRUCTURE);
-    
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_BUFFER_FULL(ctx, length);
-    
-    value->request_header = ctx->calloc_func(ctx->state, 1, sizeof(RequestHeader));
-    CHECK_NEW_MEMORY(ctx, value->request_header, sizeof(RequestHeader), "RequestHeader structure");
-    kmip_init_request_header(value->request_header);
-    result = kmip_decode_request_header(ctx, value->request_header);
-    CHECK_RESULT(ctx, result);
+    if(parser == NULL)
+    {
+        return;
+    }
     
-    value->batch_count = kmip_get_num_items_next(ctx, KMIP_TAG_BATCH_ITEM);
-    if(value->batch_count > 0)
+    /* NOTE (ph) The buffer is kept for the next message, but the old */
+    /*      message may carry key material so its bytes are wiped.    */
+    if(parser->ctx != NULL && parser->buffer != NULL)
     {
-        value->batch_items = ctx->calloc_func(ctx->state, value->batch_count, sizeof(RequestBatchItem));
-        CHECK_NEW_MEMORY(ctx, value->batch_items, value->batch_count * sizeof(RequestBatchItem), "sequence of RequestBatchItem structures");
-        
-        for(size_t i = 0; i < value->batch_count; i++)
-        {
-            kmip_init_request_batch_item(&value->batch_items[i]);
-            result = kmip_decode_request_batch_item(ctx, &value->batch_items[i]);
-            CHECK_RESULT(ctx, result);
-        }
+        parser->ctx->memset_func(parser->buffer, 0, parser->size);
     }
     
-    return(KMIP_OK);
+    parser->size = 0;
+    parser->state = KMIP_PARSER_NEED_MORE;
+    parser->offset = 0;
+    parser->message_size = 0;
+    parser->consumed = 0;
+    parser->depth = 0;
 }
 
-int
-kmip_decode_response_message(KMIP *ctx, ResponseMessage *value)
+void
+kmip_parser_free(KMIPParser *parser)
 {
-    CHECK_BUFFER_FULL(ctx, 8);
-    
-    int result = 0;
-    int32 tag_type = 0;
-    uint32 length = 0;
-    
-    kmip_decode_int32_be(ctx, &tag_type);
-    CHECK_TAG_TYPE(ctx, tag_type, KMIP_TAG_RESPONSE_MESSAGE, KMIP_TYPE_STRUCTURE);
-    
-    kmip_decode_int32_be(ctx, &length);
-    CHECK_BUFFER_FULL(ctx, length);
-    
-    value->response_header = ctx->calloc_func(ctx->state, 1, sizeof(ResponseHeader));
-    CHECK_NEW_MEMORY(ctx, value->response_header, sizeof(ResponseHeader), "ResponseHeader structure");
-    
-    result = kmip_decode_response_header(ctx, value->response_header);
-    CHECK_RESULT(ctx, result);
+    if(parser == NULL)
+    {
+        return;
+    }
     
-    value->batch_count = kmip_get_num_items_next(ctx, KMIP_TAG_BATCH_ITEM);
-    if(value->batch_count > 0)
+    if(parser->ctx != NULL && parser->buffer != NULL)
     {
-        value->batch_items = ctx->calloc_func(ctx->state, value->batch_count, sizeof(ResponseBatchItem));
-        CHECK_NEW_MEMORY(ctx, value->batch_items, value->batch_count * sizeof(ResponseBatchItem), "sequence of ResponseBatchItem structures");
-        
-        for(size_t i = 0; i < value->batch_count; i++)
-        {
-            result = kmip_decode_response_batch_item(ctx, &value->batch_items[i]);
-            CHECK_RESULT(ctx, result);
-        }
+        kmip_free_buffer(parser->ctx, parser->buffer, parser->capacity);
     }
     
-    return(KMIP_OK);
+    parser->buffer = NULL;
+    parser->size = 0;
+    parser->capacity = 0;
+    
+    kmip_parser_reset(parser);
 }
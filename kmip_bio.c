@@ -26,23 +26,10 @@ int kmip_bio_create_symmetric_key(BIO *bio,
     if(bio == NULL || template_attribute == NULL || id == NULL || id_size == NULL)
         return(KMIP_ARG_INVALID);
     
-    /* Set up the KMIP context and the initial encoding buffer. */
+    /* Set up the KMIP context. */
     KMIP ctx = {0};
     kmip_init(&ctx, NULL, 0, KMIP_1_0);
     
-    size_t buffer_blocks = 1;
-    size_t buffer_block_size = 1024;
-    size_t buffer_total_size = buffer_blocks * buffer_block_size;
-    
-    uint8 *encoding = ctx.calloc_func(ctx.state, buffer_blocks,
-                                      buffer_block_size);
-    if(encoding == NULL)
-    {
-        kmip_destroy(&ctx);
-        return(KMIP_MEMORY_ALLOC_FAILED);
-    }
-    kmip_set_buffer(&ctx, encoding, buffer_total_size);
-    
     /* Build the request message. */
     ProtocolVersion pv = {0};
     kmip_init_protocol_version(&pv, ctx.version);
@@ -69,32 +56,25 @@ int kmip_bio_create_symmetric_key(BIO *bio,
     rm.batch_items = &rbi;
     rm.batch_count = 1;
     
-    /* Encode the request message. Dynamically resize the encoding buffer */
-    /* if it's not big enough. Once encoding succeeds, send the request   */
-    /* message.                                                           */
-    int encode_result = kmip_encode_request_message(&ctx, &rm);
-    while(encode_result == KMIP_ERROR_BUFFER_FULL)
-    {
-        kmip_reset(&ctx);
-        ctx.free_func(ctx.state, encoding);
-        
-        buffer_blocks += 1;
-        buffer_total_size = buffer_blocks * buffer_block_size;
-        
-        encoding = ctx.calloc_func(ctx.state, buffer_blocks,
-                                   buffer_block_size);
-        if(encoding == NULL)
-        {
-            kmip_destroy(&ctx);
-            return(KMIP_MEMORY_ALLOC_FAILED);
-        }
-        
-        kmip_set_buffer(
-            &ctx,
-            encoding,
-            buffer_total_size);
-        encode_result = kmip_encode_request_message(&ctx, &rm);
+    /* Compute the exact size of the request message encoding, allocate */
+    /* the encoding buffer once, and encode the request message. Once   */
+    /* encoding succeeds, send the request message.                     */
+    size_t buffer_total_size = kmip_size_request_message(&ctx, &rm);
+    if(buffer_total_size == 0)
+    {
+        kmip_destroy(&ctx);
+        return(KMIP_ARG_INVALID);
+    }
+    
+    uint8 *encoding = ctx.calloc_func(ctx.state, 1, buffer_total_size);
+    if(encoding == NULL)
+    {
+        kmip_destroy(&ctx);
+        return(KMIP_MEMORY_ALLOC_FAILED);
     }
+    kmip_set_buffer(&ctx, encoding, buffer_total_size);
+    
+    int encode_result = kmip_encode_request_message(&ctx, &rm);
     
     if(encode_result != KMIP_OK)
     {
@@ -119,11 +99,9 @@ int kmip_bio_create_symmetric_key(BIO *bio,
     /* Read the response message. Dynamically resize the encoding buffer  */
     /* to align with the message size advertised by the message encoding. */
     /* Reject the message if the message size is too large.               */
-    buffer_blocks = 1;
-    buffer_block_size = 8;
-    buffer_total_size = buffer_blocks * buffer_block_size;
+    buffer_total_size = 8;
     
-    encoding = ctx.calloc_func(ctx.state, buffer_blocks, buffer_block_size);
+    encoding = ctx.calloc_func(ctx.state, 1, buffer_total_size);
     if(encoding == NULL)
     {
         kmip_destroy(&ctx);
@@ -159,8 +137,7 @@ int kmip_bio_create_symmetric_key(BIO *bio,
         encoding = extended;
     ctx.memset_func(encoding + buffer_total_size, 0, length);
     
-    buffer_block_size += length;
-    buffer_total_size = buffer_blocks * buffer_block_size;
+    buffer_total_size += length;
     
     recv = BIO_read(bio, encoding + 8, length);
     if(recv != length)
@@ -171,7 +148,7 @@ int kmip_bio_create_symmetric_key(BIO *bio,
         return(KMIP_IO_FAILURE);
     }
     
-    kmip_set_buffer(&ctx, encoding, buffer_block_size);
+    kmip_set_buffer(&ctx, encoding, buffer_total_size);
     
     /* Decode the response message and retrieve the operation results. */
     ResponseMessage resp_m = {0};
@@ -241,23 +218,10 @@ int kmip_bio_destroy_symmetric_key(BIO *bio, char *uuid, int uuid_size)
         return(KMIP_ARG_INVALID);
     }
     
-    /* Set up the KMIP context and the initial encoding buffer. */
+    /* Set up the KMIP context. */
     KMIP ctx = {0};
     kmip_init(&ctx, NULL, 0, KMIP_1_0);
     
-    size_t buffer_blocks = 1;
-    size_t buffer_block_size = 1024;
-    size_t buffer_total_size = buffer_blocks * buffer_block_size;
-    
-    uint8 *encoding = ctx.calloc_func(ctx.state, buffer_blocks,
-                                      buffer_block_size);
-    if(encoding == NULL)
-    {
-        kmip_destroy(&ctx);
-        return(KMIP_MEMORY_ALLOC_FAILED);
-    }
-    kmip_set_buffer(&ctx, encoding, buffer_total_size);
-    
     /* Build the request message. */
     ProtocolVersion pv = {0};
     kmip_init_protocol_version(&pv, ctx.version);
@@ -287,32 +251,25 @@ int kmip_bio_destroy_symmetric_key(BIO *bio, char *uuid, int uuid_size)
     rm.batch_items = &rbi;
     rm.batch_count = 1;
     
-    /* Encode the request message. Dynamically resize the encoding buffer */
-    /* if it's not big enough. Once encoding succeeds, send the request   */
-    /* message.                                                           */
-    int encode_result = kmip_encode_request_message(&ctx, &rm);
-    while(encode_result == KMIP_ERROR_BUFFER_FULL)
-    {
-        kmip_reset(&ctx);
-        ctx.free_func(ctx.state, encoding);
-        
-        buffer_blocks += 1;
-        buffer_total_size = buffer_blocks * buffer_block_size;
-        
-        encoding = ctx.calloc_func(ctx.state, buffer_blocks,
-                                   buffer_block_size);
-        if(encoding == NULL)
-        {
-            kmip_destroy(&ctx);
-            return(KMIP_MEMORY_ALLOC_FAILED);
-        }
-        
-        kmip_set_buffer(
-            &ctx,
-            encoding,
-            buffer_total_size);
-        encode_result = kmip_encode_request_message(&ctx, &rm);
+    /* Compute the exact size of the request message encoding, allocate */
+    /* the encoding buffer once, and encode the request message. Once   */
+    /* encoding succeeds, send the request message.                     */
+    size_t buffer_total_size = kmip_size_request_message(&ctx, &rm);
+    if(buffer_total_size == 0)
+    {
+        kmip_destroy(&ctx);
+        return(KMIP_ARG_INVALID);
+    }
+    
+    uint8 *encoding = ctx.calloc_func(ctx.state, 1, buffer_total_size);
+    if(encoding == NULL)
+    {
+        kmip_destroy(&ctx);
+        return(KMIP_MEMORY_ALLOC_FAILED);
     }
+    kmip_set_buffer(&ctx, encoding, buffer_total_size);
+    
+    int encode_result = kmip_encode_request_message(&ctx, &rm);
     
     if(encode_result != KMIP_OK)
     {
@@ -337,11 +294,9 @@ int kmip_bio_destroy_symmetric_key(BIO *bio, char *uuid, int uuid_size)
     /* Read the response message. Dynamically resize the encoding buffer  */
     /* to align with the message size advertised by the message encoding. */
     /* Reject the message if the message size is too large.               */
-    buffer_blocks = 1;
-    buffer_block_size = 8;
-    buffer_total_size = buffer_blocks * buffer_block_size;
+    buffer_total_size = 8;
     
-    encoding = ctx.calloc_func(ctx.state, buffer_blocks, buffer_block_size);
+    encoding = ctx.calloc_func(ctx.state, 1, buffer_total_size);
     if(encoding == NULL)
     {
         kmip_destroy(&ctx);
@@ -388,8 +343,7 @@ int kmip_bio_destroy_symmetric_key(BIO *bio, char *uuid, int uuid_size)
     
     ctx.memset_func(encoding + buffer_total_size, 0, length);
     
-    buffer_block_size += length;
-    buffer_total_size = buffer_blocks * buffer_block_size;
+    buffer_total_size += length;
     
     recv = BIO_read(bio, encoding + 8, length);
     if(recv != length)
@@ -400,7 +354,7 @@ int kmip_bio_destroy_symmetric_key(BIO *bio, char *uuid, int uuid_size)
         return(KMIP_IO_FAILURE);
     }
     
-    kmip_set_buffer(&ctx, encoding, buffer_block_size);
+    kmip_set_buffer(&ctx, encoding, buffer_total_size);
     
     /* Decode the response message and retrieve the operation result status. */
     ResponseMessage resp_m = {0};
@@ -447,23 +401,10 @@ int kmip_bio_get_symmetric_key(BIO *bio,
         return(KMIP_ARG_INVALID);
     }
     
-    /* Set up the KMIP context and the initial encoding buffer. */
+    /* Set up the KMIP context. */
     KMIP ctx = {0};
     kmip_init(&ctx, NULL, 0, KMIP_1_0);
     
-    size_t buffer_blocks = 1;
-    size_t buffer_block_size = 1024;
-    size_t buffer_total_size = buffer_blocks * buffer_block_size;
-    
-    uint8 *encoding = ctx.calloc_func(ctx.state, buffer_blocks,
-                                      buffer_block_size);
-    if(encoding == NULL)
-    {
-        kmip_destroy(&ctx);
-        return(KMIP_MEMORY_ALLOC_FAILED);
-    }
-    kmip_set_buffer(&ctx, encoding, buffer_total_size);
-    
     /* Build the request message. */
     ProtocolVersion pv = {0};
     kmip_init_protocol_version(&pv, ctx.version);
@@ -493,33 +434,26 @@ int kmip_bio_get_symmetric_key(BIO *bio,
     rm.batch_items = &rbi;
     rm.batch_count = 1;
     
-    /* Encode the request message. Dynamically resize the encoding buffer */
-    /* if it's not big enough. Once encoding succeeds, send the request   */
-    /* message.                                                           */
-    int encode_result = kmip_encode_request_message(&ctx, &rm);
-    while(encode_result == KMIP_ERROR_BUFFER_FULL)
-    {
-        kmip_reset(&ctx);
-        ctx.free_func(ctx.state, encoding);
-        
-        buffer_blocks += 1;
-        buffer_total_size = buffer_blocks * buffer_block_size;
-        
-        encoding = ctx.calloc_func(ctx.state, buffer_blocks,
-                                   buffer_block_size);
-        if(encoding == NULL)
-        {
-            kmip_destroy(&ctx);
-            return(KMIP_MEMORY_ALLOC_FAILED);
-        }
-        
-        kmip_set_buffer(
-            &ctx,
-            encoding,
-            buffer_total_size);
-        encode_result = kmip_encode_request_message(&ctx, &rm);
+    /* Compute the exact size of the request message encoding, allocate */
+    /* the encoding buffer once, and encode the request message. Once   */
+    /* encoding succeeds, send the request message.                     */
+    size_t buffer_total_size = kmip_size_request_message(&ctx, &rm);
+    if(buffer_total_size == 0)
+    {
+        kmip_destroy(&ctx);
+        return(KMIP_ARG_INVALID);
     }
     
+    uint8 *encoding = ctx.calloc_func(ctx.state, 1, buffer_total_size);
+    if(encoding == NULL)
+    {
+        kmip_destroy(&ctx);
+        return(KMIP_MEMORY_ALLOC_FAILED);
+    }
+    kmip_set_buffer(&ctx, encoding, buffer_total_size);
+    
+    int encode_result = kmip_encode_request_message(&ctx, &rm);
+    
     if(encode_result != KMIP_OK)
     {
         kmip_free_buffer(&ctx, encoding, buffer_total_size);
@@ -543,11 +477,9 @@ int kmip_bio_get_symmetric_key(BIO *bio,
     /* Read the response message. Dynamically resize the encoding buffer  */
     /* to align with the message size advertised by the message encoding. */
     /* Reject the message if the message size is too large.               */
-    buffer_blocks = 1;
-    buffer_block_size = 8;
-    buffer_total_size = buffer_blocks * buffer_block_size;
+    buffer_total_size = 8;
     
-    encoding = ctx.calloc_func(ctx.state, buffer_blocks, buffer_block_size);
+    encoding = ctx.calloc_func(ctx.state, 1, buffer_total_size);
     if(encoding == NULL)
     {
         kmip_destroy(&ctx);
@@ -585,8 +517,7 @@ int kmip_bio_get_symmetric_key(BIO *bio,
     }
     ctx.memset_func(encoding + buffer_total_size, 0, length);
     
-    buffer_block_size += length;
-    buffer_total_size = buffer_blocks * buffer_block_size;
+    buffer_total_size += length;
     
     recv = BIO_read(bio, encoding + 8, length);
     if(recv != length)
@@ -597,7 +528,7 @@ int kmip_bio_get_symmetric_key(BIO *bio,
         return(KMIP_IO_FAILURE);
     }
     
-    kmip_set_buffer(&ctx, encoding, buffer_block_size);
+    kmip_set_buffer(&ctx, encoding, buffer_total_size);
     
     /* Decode the response message and retrieve the operation result status. */
     ResponseMessage resp_m = {0};
@@ -686,16 +617,6 @@ int kmip_bio_create_symmetric_key_with_context(KMIP *ctx, BIO *bio,
         return(KMIP_ARG_INVALID);
     }
     
-    /* Set up the initial encoding buffer. */
-    size_t buffer_blocks = 1;
-    size_t buffer_block_size = 1024;
-    size_t buffer_total_size = buffer_blocks * buffer_block_size;
-    
-    uint8 *encoding = ctx->calloc_func(ctx->state, buffer_blocks, buffer_block_size);
-    if(encoding == NULL)
-        return(KMIP_MEMORY_ALLOC_FAILED);
-    kmip_set_buffer(ctx, encoding, buffer_total_size);
-    
     /* Build the request message. */
     ProtocolVersion pv = {0};
     kmip_init_protocol_version(&pv, ctx->version);
@@ -725,42 +646,30 @@ int kmip_bio_create_symmetric_key_with_context(KMIP *ctx, BIO *bio,
     /* Add the context credential to the request message if it exists. */
     /* TODO (ph) Update this to add multiple credentials. */
     Authentication auth = {0};
-    if(ctx->credential_list != NULL)
+    /* The most recently added credential is used. */
+    if(ctx->credential_list.size > 0)
     {
-        LinkedListItem *item = ctx->credential_list->head;
-        if(item != NULL)
-        {
-            auth.credential = (Credential *)item->data;
-            rh.authentication = &auth;
-        }
+        size_t last = ctx->credential_list.size - 1;
+        auth.credential = (Credential *)kmip_vector_get(&ctx->credential_list, last);
+        rh.authentication = &auth;
     }
     
-    /* Encode the request message. Dynamically resize the encoding buffer */
-    /* if it's not big enough. Once encoding succeeds, send the request   */
-    /* message.                                                           */
-    int encode_result = kmip_encode_request_message(ctx, &rm);
-    while(encode_result == KMIP_ERROR_BUFFER_FULL)
-    {
-        kmip_reset(ctx);
-        ctx->free_func(ctx->state, encoding);
-        
-        buffer_blocks += 1;
-        buffer_total_size = buffer_blocks * buffer_block_size;
-        
-        encoding = ctx->calloc_func(ctx->state, buffer_blocks, buffer_block_size);
-        if(encoding == NULL)
-        {
-            kmip_set_buffer(ctx, NULL, 0);
-            return(KMIP_MEMORY_ALLOC_FAILED);
-        }
-        
-        kmip_set_buffer(
-            ctx,
-            encoding,
-            buffer_total_size);
-        encode_result = kmip_encode_request_message(ctx, &rm);
+    /* Compute the exact size of the request message encoding, allocate */
+    /* the encoding buffer once, and encode the request message. Once   */
+    /* encoding succeeds, send the request message.                     */
+    size_t buffer_total_size = kmip_size_request_message(ctx, &rm);
+    if(buffer_total_size == 0)
+    {
+        return(KMIP_ARG_INVALID);
     }
     
+    uint8 *encoding = ctx->calloc_func(ctx->state, 1, buffer_total_size);
+    if(encoding == NULL)
+        return(KMIP_MEMORY_ALLOC_FAILED);
+    kmip_set_buffer(ctx, encoding, buffer_total_size);
+    
+    int encode_result = kmip_encode_request_message(ctx, &rm);
+    
     if(encode_result != KMIP_OK)
     {
         kmip_free_buffer(ctx, encoding, buffer_total_size);
@@ -785,11 +694,9 @@ int kmip_bio_create_symmetric_key_with_context(KMIP *ctx, BIO *bio,
     /* Read the response message. Dynamically resize the encoding buffer  */
     /* to align with the message size advertised by the message encoding. */
     /* Reject the message if the message size is too large.               */
-    buffer_blocks = 1;
-    buffer_block_size = 8;
-    buffer_total_size = buffer_blocks * buffer_block_size;
+    buffer_total_size = 8;
     
-    encoding = ctx->calloc_func(ctx->state, buffer_blocks, buffer_block_size);
+    encoding = ctx->calloc_func(ctx->state, 1, buffer_total_size);
     if(encoding == NULL)
         return(KMIP_MEMORY_ALLOC_FAILED);
     
@@ -824,8 +731,7 @@ int kmip_bio_create_symmetric_key_with_context(KMIP *ctx, BIO *bio,
     }
     ctx->memset_func(encoding + buffer_total_size, 0, length);
     
-    buffer_block_size += length;
-    buffer_total_size = buffer_blocks * buffer_block_size;
+    buffer_total_size += length;
     
     recv = BIO_read(bio, encoding + 8, length);
     if(recv != length)
@@ -836,7 +742,7 @@ int kmip_bio_create_symmetric_key_with_context(KMIP *ctx, BIO *bio,
         return(KMIP_IO_FAILURE);
     }
     
-    kmip_set_buffer(ctx, encoding, buffer_block_size);
+    kmip_set_buffer(ctx, encoding, buffer_total_size);
     
     /* Decode the response message and retrieve the operation results. */
     ResponseMessage resp_m = {0};
@@ -903,21 +809,6 @@ int kmip_bio_get_symmetric_key_with_context(KMIP *ctx, BIO *bio,
         return(KMIP_ARG_INVALID);
     }
     
-    /* Set up the initial encoding buffer. */
-    size_t buffer_blocks = 1;
-    size_t buffer_block_size = 1024;
-    size_t buffer_total_size = buffer_blocks * buffer_block_size;
-    
-    uint8 *encoding = ctx->calloc_func(
-        ctx->state,
-        buffer_blocks,
-        buffer_block_size);
-    if(encoding == NULL)
-    {
-        return(KMIP_MEMORY_ALLOC_FAILED);
-    }
-    kmip_set_buffer(ctx, encoding, buffer_total_size);
-    
     /* Build the request message. */
     ProtocolVersion pv = {0};
     kmip_init_protocol_version(&pv, ctx->version);
@@ -950,44 +841,32 @@ int kmip_bio_get_symmetric_key_with_context(KMIP *ctx, BIO *bio,
     /* Add the context credential to the request message if it exists. */
     /* TODO (ph) Update this to add multiple credentials. */
     Authentication auth = {0};
-    if(ctx->credential_list != NULL)
+    /* The most recently added credential is used. */
+    if(ctx->credential_list.size > 0)
     {
-        LinkedListItem *item = ctx->credential_list->head;
-        if(item != NULL)
-        {
-            auth.credential = (Credential *)item->data;
-            rh.authentication = &auth;
-        }
+        size_t last = ctx->credential_list.size - 1;
+        auth.credential = (Credential *)kmip_vector_get(&ctx->credential_list, last);
+        rh.authentication = &auth;
     }
     
-    /* Encode the request message. Dynamically resize the encoding buffer */
-    /* if it's not big enough. Once encoding succeeds, send the request   */
-    /* message.                                                           */
-    int encode_result = kmip_encode_request_message(ctx, &rm);
-    while(encode_result == KMIP_ERROR_BUFFER_FULL)
-    {
-        kmip_reset(ctx);
-        ctx->free_func(ctx->state, encoding);
-        
-        buffer_blocks += 1;
-        buffer_total_size = buffer_blocks * buffer_block_size;
-        
-        encoding = ctx->calloc_func(
-            ctx->state,
-            buffer_blocks,
-            buffer_block_size);
-        if(encoding == NULL)
-        {
-            return(KMIP_MEMORY_ALLOC_FAILED);
-        }
-        
-        kmip_set_buffer(
-            ctx,
-            encoding,
-            buffer_total_size);
-        encode_result = kmip_encode_request_message(ctx, &rm);
+    /* Compute the exact size of the request message encoding, allocate */
+    /* the encoding buffer once, and encode the request message. Once   */
+    /* encoding succeeds, send the request message.                     */
+    size_t buffer_total_size = kmip_size_request_message(ctx, &rm);
+    if(buffer_total_size == 0)
+    {
+        return(KMIP_ARG_INVALID);
     }
     
+    uint8 *encoding = ctx->calloc_func(ctx->state, 1, buffer_total_size);
+    if(encoding == NULL)
+    {
+        return(KMIP_MEMORY_ALLOC_FAILED);
+    }
+    kmip_set_buffer(ctx, encoding, buffer_total_size);
+    
+    int encode_result = kmip_encode_request_message(ctx, &rm);
+    
     if(encode_result != KMIP_OK)
     {
         kmip_free_buffer(ctx, encoding, buffer_total_size);
@@ -1009,11 +888,9 @@ int kmip_bio_get_symmetric_key_with_context(KMIP *ctx, BIO *bio,
     /* Read the response message. Dynamically resize the encoding buffer  */
     /* to align with the message size advertised by the message encoding. */
     /* Reject the message if the message size is too large.               */
-    buffer_blocks = 1;
-    buffer_block_size = 8;
-    buffer_total_size = buffer_blocks * buffer_block_size;
+    buffer_total_size = 8;
     
-    encoding = ctx->calloc_func(ctx->state, buffer_blocks, buffer_block_size);
+    encoding = ctx->calloc_func(ctx->state, 1, buffer_total_size);
     if(encoding == NULL)
     {
         return(KMIP_MEMORY_ALLOC_FAILED);
@@ -1051,8 +928,7 @@ int kmip_bio_get_symmetric_key_with_context(KMIP *ctx, BIO *bio,
     }
     ctx->memset_func(encoding + buffer_total_size, 0, length);
     
-    buffer_block_size += length;
-    buffer_total_size = buffer_blocks * buffer_block_size;
+    buffer_total_size += length;
     
     recv = BIO_read(bio, encoding + 8, length);
     if(recv != length)
@@ -1062,7 +938,7 @@ int kmip_bio_get_symmetric_key_with_context(KMIP *ctx, BIO *bio,
         return(KMIP_IO_FAILURE);
     }
     
-    kmip_set_buffer(ctx, encoding, buffer_block_size);
+    kmip_set_buffer(ctx, encoding, buffer_total_size);
     
     /* Decode the response message and retrieve the operation result status. */
     ResponseMessage resp_m = {0};
@@ -1118,7 +994,17 @@ int kmip_bio_get_symmetric_key_with_context(KMIP *ctx, BIO *bio,
     KeyValue *block_value = block->key_value;
     ByteString *material = (ByteString *)block_value->key_material;
     
-    char *result_key = ctx->calloc_func(ctx->state, 1, material->size);
+    /* NOTE (ph) With a secure heap set the key is returned from it; */
+    /*      release it with kmip_free_secret. It outlives the message */
+    /*      and any arena on the context.                             */
+    char *result_key = kmip_calloc_detached(ctx, 1, material->size, KMIP_TRUE);
+    if(result_key == NULL)
+    {
+        kmip_free_response_message(ctx, &resp_m);
+        kmip_free_buffer(ctx, encoding, buffer_total_size);
+        kmip_set_buffer(ctx, NULL, 0);
+        return(KMIP_MEMORY_ALLOC_FAILED);
+    }
     *key_size = material->size;
     for(int i = 0; i < *key_size; i++)
     {
@@ -1144,19 +1030,6 @@ int kmip_bio_destroy_symmetric_key_with_context(KMIP *ctx, BIO *bio,
         return(KMIP_ARG_INVALID);
     }
     
-    /* Set up the initial encoding buffer. */
-    size_t buffer_blocks = 1;
-    size_t buffer_block_size = 1024;
-    size_t buffer_total_size = buffer_blocks * buffer_block_size;
-    
-    uint8 *encoding = ctx->calloc_func(ctx->state, buffer_blocks,
-                                       buffer_block_size);
-    if(encoding == NULL)
-    {
-        return(KMIP_MEMORY_ALLOC_FAILED);
-    }
-    kmip_set_buffer(ctx, encoding, buffer_total_size);
-    
     /* Build the request message. */
     ProtocolVersion pv = {0};
     kmip_init_protocol_version(&pv, ctx->version);
@@ -1189,43 +1062,32 @@ int kmip_bio_destroy_symmetric_key_with_context(KMIP *ctx, BIO *bio,
     /* Add the context credential to the request message if it exists. */
     /* TODO (ph) Update this to add multiple credentials. */
     Authentication auth = {0};
-    if(ctx->credential_list != NULL)
+    /* The most recently added credential is used. */
+    if(ctx->credential_list.size > 0)
     {
-        LinkedListItem *item = ctx->credential_list->head;
-        if(item != NULL)
-        {
-            auth.credential = (Credential *)item->data;
-            rh.authentication = &auth;
-        }
+        size_t last = ctx->credential_list.size - 1;
+        auth.credential = (Credential *)kmip_vector_get(&ctx->credential_list, last);
+        rh.authentication = &auth;
     }
     
-    /* Encode the request message. Dynamically resize the encoding buffer */
-    /* if it's not big enough. Once encoding succeeds, send the request   */
-    /* message.                                                           */
-    int encode_result = kmip_encode_request_message(ctx, &rm);
-    while(encode_result == KMIP_ERROR_BUFFER_FULL)
-    {
-        kmip_reset(ctx);
-        ctx->free_func(ctx->state, encoding);
-        
-        buffer_blocks += 1;
-        buffer_total_size = buffer_blocks * buffer_block_size;
-        
-        encoding = ctx->calloc_func(ctx->state, buffer_blocks,
-                                    buffer_block_size);
-        if(encoding == NULL)
-        {
-            kmip_set_buffer(ctx, NULL, 0);
-            return(KMIP_MEMORY_ALLOC_FAILED);
-        }
-        
-        kmip_set_buffer(
-            ctx,
-            encoding,
-            buffer_total_size);
-        encode_result = kmip_encode_request_message(ctx, &rm);
+    /* Compute the exact size of the request message encoding, allocate */
+    /* the encoding buffer once, and encode the request message. Once   */
+    /* encoding succeeds, send the request message.                     */
+    size_t buffer_total_size = kmip_size_request_message(ctx, &rm);
+    if(buffer_total_size == 0)
+    {
+        return(KMIP_ARG_INVALID);
     }
     
+    uint8 *encoding = ctx->calloc_func(ctx->state, 1, buffer_total_size);
+    if(encoding == NULL)
+    {
+        return(KMIP_MEMORY_ALLOC_FAILED);
+    }
+    kmip_set_buffer(ctx, encoding, buffer_total_size);
+    
+    int encode_result = kmip_encode_request_message(ctx, &rm);
+    
     if(encode_result != KMIP_OK)
     {
         kmip_free_buffer(ctx, encoding, buffer_total_size);
@@ -1250,11 +1112,9 @@ int kmip_bio_destroy_symmetric_key_with_context(KMIP *ctx, BIO *bio,
     /* Read the response message. Dynamically resize the encoding buffer  */
     /* to align with the message size advertised by the message encoding. */
     /* Reject the message if the message size is too large.               */
-    buffer_blocks = 1;
-    buffer_block_size = 8;
-    buffer_total_size = buffer_blocks * buffer_block_size;
+    buffer_total_size = 8;
     
-    encoding = ctx->calloc_func(ctx->state, buffer_blocks, buffer_block_size);
+    encoding = ctx->calloc_func(ctx->state, 1, buffer_total_size);
     if(encoding == NULL)
     {
         return(KMIP_MEMORY_ALLOC_FAILED);
@@ -1292,8 +1152,7 @@ int kmip_bio_destroy_symmetric_key_with_context(KMIP *ctx, BIO *bio,
     }
     ctx->memset_func(encoding + buffer_total_size, 0, length);
     
-    buffer_block_size += length;
-    buffer_total_size = buffer_blocks * buffer_block_size;
+    buffer_total_size += length;
     
     recv = BIO_read(bio, encoding + 8, length);
     if(recv != length)
@@ -1304,7 +1163,7 @@ int kmip_bio_destroy_symmetric_key_with_context(KMIP *ctx, BIO *bio,
         return(KMIP_IO_FAILURE);
     }
     
-    kmip_set_buffer(ctx, encoding, buffer_block_size);
+    kmip_set_buffer(ctx, encoding, buffer_total_size);
     
     /* Decode the response message and retrieve the operation result status. */
     ResponseMessage resp_m = {0};
@@ -1360,12 +1219,9 @@ int kmip_bio_send_request_encoding(KMIP *ctx, BIO *bio,
     /* Read the response message. Dynamically resize the receiving buffer */
     /* to align with the message size advertised by the message encoding. */
     /* Reject the message if the message size is too large.               */
-    size_t buffer_blocks = 1;
-    size_t buffer_block_size = 8;
-    size_t buffer_total_size = buffer_blocks * buffer_block_size;
+    size_t buffer_total_size = 8;
     
-    uint8 *encoding = ctx->calloc_func(ctx->state, buffer_blocks,
-                                       buffer_block_size);
+    uint8 *encoding = ctx->calloc_func(ctx->state, 1, buffer_total_size);
     if(encoding == NULL)
     {
         return(KMIP_MEMORY_ALLOC_FAILED);
@@ -1402,8 +1258,7 @@ int kmip_bio_send_request_encoding(KMIP *ctx, BIO *bio,
     }
     ctx->memset_func(encoding + buffer_total_size, 0, length);
     
-    buffer_block_size += length;
-    buffer_total_size = buffer_blocks * buffer_block_size;
+    buffer_total_size += length;
     
     recv = BIO_read(bio, encoding + 8, length);
     if(recv != length)
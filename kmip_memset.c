@@ -6,6 +6,10 @@
  * repository for more information.
  */
 
+/* NOTE (ph) explicit_bzero is a BSD/glibc extension that is hidden in */
+/*      strict C11 mode unless requested explicitly.                  */
+#define _DEFAULT_SOURCE
+
 #include "kmip_memset.h"
 
 #if defined __STDC_LIB_EXT1__
@@ -27,32 +31,47 @@ kmip_memset(void *ptr, int value, size_t size)
 
 #else
 
-void *
-kmip_base_memset(void *ptr, int value, size_t size)
-{
-    if(ptr != NULL)
-    {
-        unsigned char *index = (unsigned char*)ptr;
-        for(size_t i = 0; i < size; i++)
-        {
-            *index++ = (unsigned char)value;
-        }
-    }
-    
-    return(ptr);
-}
+#include <string.h>
+
+#if (defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 25))) || \
+    defined(__OpenBSD__) || defined(__FreeBSD__)
+#define KMIP_HAVE_EXPLICIT_BZERO 1
+#endif
 
+#if !defined(__GNUC__)
+/* NOTE (ph) Without a compiler barrier, calling memset through a */
+/*      volatile function pointer keeps the optimizer from proving */
+/*      the store is dead and removing it.                          */
 static void *
-(* volatile kmip_indirect_memset)(void *, int, size_t) = kmip_base_memset;
+(* volatile kmip_indirect_memset)(void *, int, size_t) = memset;
+#endif
 
 void *
 kmip_memset(void *ptr, int value, size_t size)
 {
-    if(ptr != NULL)
+    if(ptr == NULL)
     {
-        kmip_indirect_memset(ptr, value, size);
+        return(ptr);
     }
     
+#if defined(KMIP_HAVE_EXPLICIT_BZERO)
+    if(value == 0)
+    {
+        explicit_bzero(ptr, size);
+        return(ptr);
+    }
+#endif
+    
+#if defined(__GNUC__)
+    /* NOTE (ph) The libc memset stores a word or vector at a time. The */
+    /*      empty asm takes ptr as an input and clobbers memory, so the  */
+    /*      compiler must assume the stores are read and keep them.      */
+    memset(ptr, value, size);
+    __asm__ __volatile__("" : : "r"(ptr) : "memory");
+#else
+    kmip_indirect_memset(ptr, value, size);
+#endif
+    
     return(ptr);
 }
 
@@ -7,6 +7,7 @@
  */
 
 #ifndef KMIP_MEMSET_H
+#define KMIP_MEMSET_H
 
 #include <stddef.h>
 
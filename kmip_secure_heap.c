@@ -0,0 +1,207 @@
+/* Copyright (c) 2018 The Johns Hopkins University/Applied Physics Laboratory
+ * All Rights Reserved.
+ *
+ * This file is dual licensed under the terms of the Apache 2.0 License and
+ * the BSD 3-Clause License. See the LICENSE file in the root of this
+ * repository for more information.
+ */
+
+/* NOTE (ph) mmap, mlock, and madvise are POSIX/BSD extensions that are */
+/*      hidden in strict C11 mode unless requested explicitly.          */
+#define _DEFAULT_SOURCE
+#define _DARWIN_C_SOURCE
+
+#include <string.h>
+
+#include "kmip.h"
+#include "kmip_memset.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define KMIP_HAVE_SECURE_HEAP 1
+#include <sys/mman.h>
+#include <unistd.h>
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#endif
+
+/* NOTE (ph) The secure heap is one region reserved, locked into RAM,  */
+/*      and excluded from core dumps when it is created, so the cost of */
+/*      mlock is paid once instead of per allocation. Blocks are carved */
+/*      out first-fit; each starts with a KMIPSecureBlock header and    */
+/*      adjacent free blocks are merged as the heap is searched. Freed  */
+/*      blocks are wiped immediately, so new blocks are always zeroed.  */
+
+#define KMIP_SECURE_ALIGNMENT (16)
+#define KMIP_SECURE_ALIGN(A) \
+    (((A) + (KMIP_SECURE_ALIGNMENT - 1)) & ~((size_t)KMIP_SECURE_ALIGNMENT - 1))
+#define KMIP_SECURE_HEADER_SIZE KMIP_SECURE_ALIGN(sizeof(KMIPSecureBlock))
+
+int
+kmip_init_secure_heap(KMIPSecureHeap *heap, size_t size)
+{
+    if(heap == NULL || size == 0)
+    {
+        return(KMIP_ARG_INVALID);
+    }
+    
+    heap->region = NULL;
+    heap->size = 0;
+    heap->used = 0;
+    heap->peak = 0;
+    heap->dump_excluded = KMIP_FALSE;
+    
+#if defined(KMIP_HAVE_SECURE_HEAP)
+    long page_size = sysconf(_SC_PAGESIZE);
+    if(page_size <= 0)
+    {
+        page_size = 4096;
+    }
+    if(size > (size_t)-1 - (size_t)page_size)
+    {
+        return(KMIP_ARG_INVALID);
+    }
+    size = (size + (size_t)page_size - 1) & ~((size_t)page_size - 1);
+    
+    void *region = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(region == MAP_FAILED)
+    {
+        return(KMIP_MEMORY_ALLOC_FAILED);
+    }
+    
+    /* An unlocked region could be swapped out, defeating the point. */
+    if(mlock(region, size) != 0)
+    {
+        munmap(region, size);
+        return(KMIP_MEMORY_LOCK_FAILED);
+    }
+    
+#if defined(MADV_DONTDUMP)
+    heap->dump_excluded = (madvise(region, size, MADV_DONTDUMP) == 0);
+#elif defined(MADV_NOCORE)
+    heap->dump_excluded = (madvise(region, size, MADV_NOCORE) == 0);
+#endif
+    
+    heap->region = (uint8 *)region;
+    heap->size = size;
+    
+    KMIPSecureBlock *block = (KMIPSecureBlock *)heap->region;
+    block->size = size;
+    block->in_use = KMIP_FALSE;
+    
+    return(KMIP_OK);
+#else
+    return(KMIP_NOT_IMPLEMENTED);
+#endif
+}
+
+int
+kmip_secure_heap_owns(const KMIPSecureHeap *heap, const void *ptr)
+{
+    if(heap == NULL || heap->region == NULL || ptr == NULL)
+    {
+        return(KMIP_FALSE);
+    }
+    
+    return((const uint8 *)ptr >= heap->region && (const uint8 *)ptr < heap->region + heap->size);
+}
+
+void *
+kmip_secure_heap_calloc(KMIPSecureHeap *heap, size_t num, size_t size)
+{
+    if(heap == NULL || heap->region == NULL || num == 0 || size == 0)
+    {
+        return(NULL);
+    }
+    if(num > (heap->size - KMIP_SECURE_HEADER_SIZE) / size)
+    {
+        return(NULL);
+    }
+    
+    size_t needed = KMIP_SECURE_HEADER_SIZE + KMIP_SECURE_ALIGN(num * size);
+    
+    uint8 *end = heap->region + heap->size;
+    for(uint8 *index = heap->region; index < end; index += ((KMIPSecureBlock *)index)->size)
+    {
+        KMIPSecureBlock *block = (KMIPSecureBlock *)index;
+        if(block->in_use)
+        {
+            continue;
+        }
+    
+        /* Merge any free blocks that follow this one. */
+        KMIPSecureBlock *next = (KMIPSecureBlock *)(index + block->size);
+        while((uint8 *)next < end && !next->in_use)
+        {
+            block->size += next->size;
+            memset(next, 0, KMIP_SECURE_HEADER_SIZE);
+            next = (KMIPSecureBlock *)(index + block->size);
+        }
+    
+        if(block->size < needed)
+        {
+            continue;
+        }
+    
+        /* Split off the remainder if it can hold a header and data. */
+        if(block->size - needed >= 2 * KMIP_SECURE_HEADER_SIZE)
+        {
+            KMIPSecureBlock *rest = (KMIPSecureBlock *)(index + needed);
+            rest->size = block->size - needed;
+            rest->in_use = KMIP_FALSE;
+            block->size = needed;
+        }
+    
+        block->in_use = KMIP_TRUE;
+        heap->used += block->size;
+        if(heap->used > heap->peak)
+        {
+            heap->peak = heap->used;
+        }
+    
+        return(index + KMIP_SECURE_HEADER_SIZE);
+    }
+    
+    return(NULL);
+}
+
+void
+kmip_secure_heap_free(KMIPSecureHeap *heap, void *ptr)
+{
+    if(!kmip_secure_heap_owns(heap, ptr))
+    {
+        return;
+    }
+    
+    KMIPSecureBlock *block = (KMIPSecureBlock *)((uint8 *)ptr - KMIP_SECURE_HEADER_SIZE);
+    if((uint8 *)block < heap->region || !block->in_use)
+    {
+        return;
+    }
+    
+    kmip_memset(ptr, 0, block->size - KMIP_SECURE_HEADER_SIZE);
+    block->in_use = KMIP_FALSE;
+    heap->used -= block->size;
+    
+    return;
+}
+
+void
+kmip_free_secure_heap(KMIPSecureHeap *heap)
+{
+    if(heap == NULL || heap->region == NULL)
+    {
+        return;
+    }
+    
+#if defined(KMIP_HAVE_SECURE_HEAP)
+    kmip_memset(heap->region, 0, heap->size);
+    munlock(heap->region, heap->size);
+    munmap(heap->region, heap->size);
+#endif
+    
+    heap->region = NULL;
+    heap->size = 0;
+    heap->used = 0;
+    heap->dump_excluded = KMIP_FALSE;
+}
@@ -301,6 +301,80 @@ test_linked_list_enqueue(TestTracker *tracker)
     TEST_PASSED(tracker, __func__);
 }
 
+int
+test_vector_append_and_pop(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_2_0);
+
+    KMIPVector vector = {0};
+    int32 items[KMIP_VECTOR_INLINE_CAPACITY + 3] = {0};
+    size_t count = ARRAY_LENGTH(items);
+
+    if(kmip_vector_begin(&vector) != kmip_vector_end(&vector) || kmip_vector_pop(&vector) != NULL)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    for(size_t i = 0; i < count; i++)
+    {
+        if(kmip_vector_append(&ctx, &vector, &items[i]) != KMIP_OK)
+        {
+            kmip_free_vector(&ctx, &vector);
+            kmip_destroy(&ctx);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+
+        /* Items stay inline until the inline capacity is exhausted. */
+        int inline_expected = (i < KMIP_VECTOR_INLINE_CAPACITY);
+        if((vector.heap_items == NULL) != inline_expected)
+        {
+            kmip_free_vector(&ctx, &vector);
+            kmip_destroy(&ctx);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+    }
+
+    size_t index = 0;
+    void *const *end = kmip_vector_end(&vector);
+    for(void *const *item = kmip_vector_begin(&vector); item != end; item++)
+    {
+        if(*item != &items[index] || kmip_vector_get(&vector, index) != &items[index])
+        {
+            kmip_free_vector(&ctx, &vector);
+            kmip_destroy(&ctx);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+        index++;
+    }
+
+    if(index != count || vector.size != count || kmip_vector_get(&vector, count) != NULL)
+    {
+        kmip_free_vector(&ctx, &vector);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_vector_pop(&vector) != &items[count - 1] || vector.size != count - 1)
+    {
+        kmip_free_vector(&ctx, &vector);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    kmip_free_vector(&ctx, &vector);
+    kmip_destroy(&ctx);
+
+    if(vector.size != 0 || vector.heap_items != NULL)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    TEST_PASSED(tracker, __func__);
+}
+
 int
 test_buffer_full_and_resize(TestTracker *tracker)
 {
@@ -354,6 +428,90 @@ test_buffer_full_and_resize(TestTracker *tracker)
     }
 }
 
+int
+test_buffer_full_and_grow(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    uint8 expected[152] = {
+        0x42, 0x00, 0x78, 0x01, 0x00, 0x00, 0x00, 0x90, 
+        0x42, 0x00, 0x77, 0x01, 0x00, 0x00, 0x00, 0x38, 
+        0x42, 0x00, 0x69, 0x01, 0x00, 0x00, 0x00, 0x20, 
+        0x42, 0x00, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x6B, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x0D, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x48, 
+        0x42, 0x00, 0x5C, 0x05, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x79, 0x01, 0x00, 0x00, 0x00, 0x30, 
+        0x42, 0x00, 0x94, 0x07, 0x00, 0x00, 0x00, 0x24, 
+        0x34, 0x39, 0x61, 0x31, 0x63, 0x61, 0x38, 0x38, 
+        0x2D, 0x36, 0x62, 0x65, 0x61, 0x2D, 0x34, 0x66, 
+        0x62, 0x32, 0x2D, 0x62, 0x34, 0x35, 0x30, 0x2D, 
+        0x37, 0x65, 0x35, 0x38, 0x38, 0x30, 0x32, 0x63, 
+        0x33, 0x30, 0x33, 0x38, 0x00, 0x00, 0x00, 0x00
+    };
+    
+    struct kmip ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+    
+    /* Start with a buffer too small for the first nested structure so */
+    /* that the length back-patching spans several buffer moves.       */
+    int result = kmip_set_own_buffer(&ctx, 12);
+    if(result != KMIP_OK)
+    {
+        kmip_destroy(&ctx);
+        return(report_result(tracker, result, KMIP_OK, __func__));
+    }
+    
+    struct protocol_version pv = {0};
+    pv.major = 1;
+    pv.minor = 0;
+    
+    struct request_header rh = {0};
+    kmip_init_request_header(&rh);
+    
+    rh.protocol_version = &pv;
+    rh.batch_count = 1;
+    
+    struct text_string uuid = {0};
+    uuid.value = "49a1ca88-6bea-4fb2-b450-7e58802c3038";
+    uuid.size = 36;
+    
+    struct get_request_payload grp = {0};
+    grp.unique_identifier = &uuid;
+    
+    struct request_batch_item rbi = {0};
+    kmip_init_request_batch_item(&rbi);
+    rbi.operation = KMIP_OP_GET;
+    rbi.request_payload = &grp;
+    
+    struct request_message rm = {0};
+    rm.request_header = &rh;
+    rm.batch_items = &rbi;
+    rm.batch_count = 1;
+    
+    result = kmip_encode_request_message(&ctx, &rm);
+    if(result != KMIP_OK)
+    {
+        printf("FAIL - %s\n", __func__);
+        kmip_print_stack_trace(&ctx);
+        kmip_destroy(&ctx);
+        tracker->tests_failed++;
+        return(1);
+    }
+    
+    int match = (size_t)(ctx.index - ctx.buffer) == ARRAY_LENGTH(expected);
+    match = match && memcmp(ctx.buffer, expected, ARRAY_LENGTH(expected)) == 0;
+    result = report_result(tracker, match, KMIP_TRUE, __func__);
+    
+    kmip_destroy(&ctx);
+    return(result);
+}
+
 int
 test_is_tag_next(TestTracker *tracker)
 {
@@ -703,455 +861,1037 @@ test_get_num_items_next_with_non_structures(TestTracker *tracker)
 }
 
 int
-test_buffer_bytes_left(TestTracker *tracker)
+test_grow_and_trim_items(TestTracker *tracker)
 {
     TRACK_TEST(tracker);
 
-    uint8 a[1] = {0x42};
-    uint8 b[3] = {0x42, 0x00, 0x08};
-    uint8 c[5] = {0x42, 0x00, 0x53, 0x01, 0x00};
-
     KMIP ctx = {0};
-    kmip_init(&ctx, a, ARRAY_LENGTH(a), KMIP_1_0);
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
 
-    if(BUFFER_BYTES_LEFT(&ctx) != 1)
+    int32 *items = NULL;
+    size_t capacity = 0;
+    size_t count = 0;
+
+    for(int32 i = 0; i < 9; i++)
     {
-        kmip_destroy(&ctx);
-        TEST_FAILED(tracker, __func__, __LINE__);
-    }
+        int32 *grown = kmip_grow_items(&ctx, items, &capacity, count, sizeof(int32));
+        if(grown == NULL)
+        {
+            ctx.free_func(ctx.state, items);
+            kmip_destroy(&ctx);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+        items = grown;
 
-    kmip_destroy(&ctx);
-    kmip_init(&ctx, b, ARRAY_LENGTH(b), KMIP_1_0);
+        /* New slots must start zeroed, like calloc'd memory. */
+        if(items[count] != 0)
+        {
+            ctx.free_func(ctx.state, items);
+            kmip_destroy(&ctx);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+        items[count++] = i;
+    }
 
-    if(BUFFER_BYTES_LEFT(&ctx) != 3)
+    if(capacity != 16)
     {
+        ctx.free_func(ctx.state, items);
         kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    kmip_destroy(&ctx);
-    kmip_init(&ctx, c, ARRAY_LENGTH(c), KMIP_1_0);
-
-    if(BUFFER_BYTES_LEFT(&ctx) != 5)
+    items = kmip_trim_items(&ctx, items, capacity, count, sizeof(int32));
+    for(int32 i = 0; i < 9; i++)
     {
-        kmip_destroy(&ctx);
-        TEST_FAILED(tracker, __func__, __LINE__);
+        if(items[i] != i)
+        {
+            ctx.free_func(ctx.state, items);
+            kmip_destroy(&ctx);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
     }
 
+    ctx.free_func(ctx.state, items);
     kmip_destroy(&ctx);
-
     TEST_PASSED(tracker, __func__);
 }
 
 int
-test_get_num_attributes_next(TestTracker *tracker)
-{
-    TRACK_TEST(tracker);
-
-    /* Need to build an encoding with one of each type of support
-       attribute. Verify that this function returns the correct
-       count.
-
-       Need to build an encoding with bad attribute length? Handle
-       weird corner cases?
-    */
-    TEST_FAILED(tracker, __func__, __LINE__);
-}
-
-int
-test_peek_tag(TestTracker *tracker)
+test_push_error_frame(TestTracker *tracker)
 {
     TRACK_TEST(tracker);
 
-    /* Build an encoding with an arbitrary tag value. Verify that this
-       function reads and returns this tag value without changing the
-       context buffer.
-    */
-
-    uint8 underfull_encoding[1] = {0x42};
-    uint8 full_encoding[3] = {0x42, 0x00, 0x08};
-    uint8 overfull_encoding[5] = {0x42, 0x00, 0x53, 0x01, 0x00};
-
-    uint32 tag = 0;
-    uint8 *prev_buffer = NULL;
-    uint8 *prev_index = NULL;
-    size_t prev_size = 0;
     KMIP ctx = {0};
-    kmip_init(&ctx, underfull_encoding, ARRAY_LENGTH(underfull_encoding), KMIP_1_0);
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
 
-    prev_buffer = ctx.buffer;
-    prev_index = ctx.index;
-    prev_size = ctx.size;
-    tag = kmip_peek_tag(&ctx);
-    if(tag != 0 || ctx.buffer != prev_buffer || ctx.index != prev_index || ctx.size != prev_size)
+    kmip_push_error_frame(&ctx, "kmip_decode_integer", 10);
+    kmip_push_error_frame(&ctx, "kmip_decode_name", 20);
+
+#if defined(KMIP_NO_ERROR_TRACE)
+    if(ctx.error_frame_count != 0)
     {
+        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-
-    kmip_destroy(&ctx);
-    kmip_init(&ctx, full_encoding, ARRAY_LENGTH(full_encoding), KMIP_1_0);
-
-    prev_buffer = ctx.buffer;
-    prev_index = ctx.index;
-    prev_size = ctx.size;
-    tag = kmip_peek_tag(&ctx);
-    if(tag != KMIP_TAG_ATTRIBUTE || ctx.buffer != prev_buffer || ctx.index != prev_index || ctx.size != prev_size)
+#else
+    if(ctx.error_frame_count != 2 || ctx.errors[0].line != 10 || ctx.errors[1].line != 20 || strcmp(ctx.errors[1].function, "kmip_decode_name") != 0)
     {
+        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    kmip_destroy(&ctx);
-    kmip_init(&ctx, overfull_encoding, ARRAY_LENGTH(overfull_encoding), KMIP_1_0);
+    /* The trace holds at most 20 frames; later frames are dropped. */
+    for(int i = 0; i < 30; i++)
+    {
+        kmip_push_error_frame(&ctx, __func__, i);
+    }
+    if(ctx.error_frame_count != ARRAY_LENGTH(ctx.errors) || ctx.errors[19].line != 17)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+#endif
 
-    prev_buffer = ctx.buffer;
-    prev_index = ctx.index;
-    prev_size = ctx.size;
-    tag = kmip_peek_tag(&ctx);
-    if(tag != KMIP_TAG_NAME || ctx.buffer != prev_buffer || ctx.index != prev_index || ctx.size != prev_size)
+    kmip_rewind(&ctx);
+    if(ctx.error_frame_count != 0)
     {
+        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
     kmip_destroy(&ctx);
-
     TEST_PASSED(tracker, __func__);
 }
 
 int
-test_is_attribute_tag(TestTracker *tracker)
+test_arena_allocation(TestTracker *tracker)
 {
     TRACK_TEST(tracker);
 
-    if(!kmip_is_attribute_tag(KMIP_TAG_UNIQUE_IDENTIFIER))
-    {
-        TEST_FAILED(tracker, __func__, __LINE__);
-    }
-    if(!kmip_is_attribute_tag(KMIP_TAG_NAME))
+    KMIPArena arena = {0};
+    kmip_init_arena(&arena, 64);
+
+    /* Memory allocated before the arena is installed stays outside it. */
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+    uint8 *outside = ctx.calloc_func(ctx.state, 1, 16);
+
+    kmip_set_arena(&ctx, &arena);
+
+    int32 *a = ctx.calloc_func(ctx.state, 2, sizeof(int32));
+    int32 *b = ctx.calloc_func(ctx.state, 1, sizeof(int32));
+    if(a == NULL || b == NULL || a[0] != 0 || a[1] != 0 || !kmip_arena_owns(&arena, a) || kmip_arena_owns(&arena, outside))
     {
+        kmip_unset_arena(&ctx);
+        ctx.free_func(ctx.state, outside);
+        kmip_destroy(&ctx);
+        kmip_free_arena(&arena);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-    if(!kmip_is_attribute_tag(KMIP_TAG_OBJECT_TYPE))
+    a[0] = 1;
+    a[1] = 2;
+
+    /* The latest allocation grows in place; older ones move. */
+    int32 *b_grown = ctx.realloc_func(ctx.state, b, 4 * sizeof(int32));
+    int32 *a_grown = ctx.realloc_func(ctx.state, a, 4 * sizeof(int32));
+    if(b_grown != b || a_grown == a || a_grown == NULL || a_grown[0] != 1 || a_grown[1] != 2 || a_grown[2] != 0)
     {
+        kmip_unset_arena(&ctx);
+        ctx.free_func(ctx.state, outside);
+        kmip_destroy(&ctx);
+        kmip_free_arena(&arena);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-    if(!kmip_is_attribute_tag(KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM))
+
+    /* Larger requests than the chunk size get a chunk of their own. */
+    uint8 *big = ctx.calloc_func(ctx.state, 1, 1000);
+    if(big == NULL || arena.chunks == NULL || arena.chunks->next == NULL || !kmip_arena_owns(&arena, big))
     {
+        kmip_unset_arena(&ctx);
+        ctx.free_func(ctx.state, outside);
+        kmip_destroy(&ctx);
+        kmip_free_arena(&arena);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-    if(!kmip_is_attribute_tag(KMIP_TAG_CRYPTOGRAPHIC_LENGTH))
+
+    /* Arena frees are no-ops; other frees reach the backing allocator. */
+    ctx.free_func(ctx.state, a_grown);
+    ctx.free_func(ctx.state, outside);
+
+    kmip_reset_arena(&arena);
+    if(arena.chunks == NULL || arena.chunks->next != NULL || arena.chunks->used != 0 || !kmip_is_zero_buffer(big, 1000))
     {
+        kmip_unset_arena(&ctx);
+        kmip_destroy(&ctx);
+        kmip_free_arena(&arena);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-    if(!kmip_is_attribute_tag(KMIP_TAG_OPERATION_POLICY_NAME))
+
+    kmip_unset_arena(&ctx);
+    kmip_destroy(&ctx);
+    kmip_free_arena(&arena);
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_pool_allocation(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    KMIPPool pool = {0};
+    kmip_init_pool(&pool);
+
+    /* Memory allocated before the pool is installed stays outside it. */
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+    uint8 *outside = ctx.calloc_func(ctx.state, 1, 16);
+
+    kmip_set_pool(&ctx, &pool);
+
+    /* The first node of a class carves a slab; the rest come from it. */
+    TextString *a = ctx.calloc_func(ctx.state, 1, sizeof(TextString));
+    TextString *b = ctx.calloc_func(ctx.state, 1, sizeof(TextString));
+    int index = kmip_get_pool_class(&pool, a);
+    if(a == NULL || b == NULL || index == KMIP_UNSET || kmip_get_pool_class(&pool, b) != index || kmip_get_pool_class(&pool, outside) != KMIP_UNSET || pool.stats[index].misses != 1 || pool.stats[index].hits != 1)
     {
+        kmip_unset_pool(&ctx);
+        ctx.free_func(ctx.state, outside);
+        kmip_destroy(&ctx);
+        kmip_free_pool(&pool);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-    if(!kmip_is_attribute_tag(KMIP_TAG_CRYPTOGRAPHIC_USAGE_MASK))
+
+    /* Freed nodes are wiped and handed out again first. */
+    a->value = "secret";
+    a->size = 6;
+    ctx.free_func(ctx.state, a);
+    TextString *c = ctx.calloc_func(ctx.state, 1, sizeof(TextString));
+    if(c != a || c->value != NULL || c->size != 0 || pool.stats[index].frees != 1 || pool.stats[index].in_use != 2 || pool.stats[index].peak != 2)
     {
+        kmip_unset_pool(&ctx);
+        ctx.free_func(ctx.state, outside);
+        kmip_destroy(&ctx);
+        kmip_free_pool(&pool);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-    if(!kmip_is_attribute_tag(KMIP_TAG_STATE))
+
+    /* Nodes that outgrow their class move; large requests fall back. */
+    uint8 *grown = ctx.realloc_func(ctx.state, b, KMIP_POOL_MAX_SIZE);
+    uint8 *big = ctx.calloc_func(ctx.state, 1, KMIP_POOL_MAX_SIZE + 1);
+    int grown_index = kmip_get_pool_class(&pool, grown);
+    if(grown == NULL || grown == (uint8 *)b || grown_index == KMIP_UNSET || grown_index == index || big == NULL || kmip_get_pool_class(&pool, big) != KMIP_UNSET || pool.fallbacks != 1)
     {
+        kmip_unset_pool(&ctx);
+        ctx.free_func(ctx.state, outside);
+        kmip_destroy(&ctx);
+        kmip_free_pool(&pool);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_is_attribute_tag(KMIP_TAG_REQUEST_MESSAGE))
+    /* Frees of memory the pool does not own reach the backing allocator. */
+    ctx.free_func(ctx.state, big);
+    ctx.free_func(ctx.state, outside);
+    ctx.free_func(ctx.state, grown);
+    ctx.free_func(ctx.state, c);
+    if(pool.stats[index].in_use != 0 || pool.stats[grown_index].in_use != 0)
     {
+        kmip_unset_pool(&ctx);
+        kmip_destroy(&ctx);
+        kmip_free_pool(&pool);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
+    kmip_unset_pool(&ctx);
+    kmip_destroy(&ctx);
+    kmip_free_pool(&pool);
     TEST_PASSED(tracker, __func__);
 }
 
 int
-test_get_enum_string_index(TestTracker *tracker)
+test_pool_allocation_many_slabs(TestTracker *tracker)
 {
     TRACK_TEST(tracker);
-
-    if(kmip_get_enum_string_index(KMIP_TAG_ATTESTATION_TYPE) != 0)
+    
+    KMIPPool pool = {0};
+    kmip_init_pool(&pool);
+    
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+    kmip_set_pool(&ctx, &pool);
+    
+    /* Interleave slabs with fallback blocks so both share the range. */
+    size_t count = KMIP_POOL_SLAB_ITEMS * 40;
+    void *nodes[KMIP_POOL_SLAB_ITEMS * 40] = {0};
+    void *blocks[40] = {0};
+    bool32 routed = KMIP_TRUE;
+    for(size_t i = 0; i < count; i++)
     {
-        TEST_FAILED(tracker, __func__, __LINE__);
+        nodes[i] = ctx.calloc_func(ctx.state, 1, 16);
+        if(i % KMIP_POOL_SLAB_ITEMS == 0)
+        {
+            blocks[i / KMIP_POOL_SLAB_ITEMS] = ctx.calloc_func(ctx.state, 1, KMIP_POOL_MAX_SIZE + 1);
+        }
     }
-
-    if(kmip_get_enum_string_index(KMIP_TAG_BATCH_ERROR_CONTINUATION_OPTION) != 1)
+    
+    for(size_t i = 0; i < count; i++)
     {
-        TEST_FAILED(tracker, __func__, __LINE__);
+        routed = routed && nodes[i] != NULL && kmip_get_pool_class(&pool, nodes[i]) == 0;
     }
-
-    if(kmip_get_enum_string_index(KMIP_TAG_BLOCK_CIPHER_MODE) != 2)
+    for(size_t i = 0; i < ARRAY_LENGTH(blocks); i++)
     {
-        TEST_FAILED(tracker, __func__, __LINE__);
+        routed = routed && blocks[i] != NULL && kmip_get_pool_class(&pool, blocks[i]) == KMIP_UNSET;
     }
-
-    if(kmip_get_enum_string_index(KMIP_TAG_CREDENTIAL_TYPE) != 3)
+    
+    bool32 sparse = pool.page_count * 2 <= pool.page_capacity;
+    
+    for(size_t i = 0; i < count; i++)
     {
-        TEST_FAILED(tracker, __func__, __LINE__);
+        ctx.free_func(ctx.state, nodes[i]);
     }
-
-    if(kmip_get_enum_string_index(KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM) != 4)
+    for(size_t i = 0; i < ARRAY_LENGTH(blocks); i++)
     {
-        TEST_FAILED(tracker, __func__, __LINE__);
+        ctx.free_func(ctx.state, blocks[i]);
     }
-
-    if(kmip_get_enum_string_index(KMIP_TAG_CRYPTOGRAPHIC_USAGE_MASK) != 5)
+    
+    bool32 released = pool.stats[0].in_use == 0 && pool.stats[0].misses == 40 && pool.fallbacks == ARRAY_LENGTH(blocks);
+    
+    kmip_unset_pool(&ctx);
+    kmip_destroy(&ctx);
+    kmip_free_pool(&pool);
+    if(!routed || !sparse || !released || pool.pages != NULL)
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
+    
+    TEST_PASSED(tracker, __func__);
+}
 
-    if(kmip_get_enum_string_index(KMIP_TAG_DIGITAL_SIGNATURE_ALGORITHM) != 6)
-    {
-        TEST_FAILED(tracker, __func__, __LINE__);
-    }
+int
+test_secure_heap_allocation(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
 
-    if(kmip_get_enum_string_index(KMIP_TAG_ENCODING_OPTION) != 7)
+    KMIPSecureHeap heap = {0};
+    if(kmip_init_secure_heap(&heap, 1) != KMIP_OK || heap.size == 0)
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_get_enum_string_index(KMIP_TAG_HASHING_ALGORITHM) != 8)
+    uint8 *a = kmip_secure_heap_calloc(&heap, 1, 32);
+    uint8 *b = kmip_secure_heap_calloc(&heap, 4, 8);
+    if(a == NULL || b == NULL || a == b || !kmip_secure_heap_owns(&heap, a) || !kmip_secure_heap_owns(&heap, b) || !kmip_is_zero_buffer(a, 32))
     {
+        kmip_free_secure_heap(&heap);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_get_enum_string_index(KMIP_TAG_KEY_COMPRESSION_TYPE) != 9)
+    /* Freed blocks are wiped and merged back into the free space. */
+    for(size_t i = 0; i < 32; i++)
     {
-        TEST_FAILED(tracker, __func__, __LINE__);
+        a[i] = 0xAA;
+        b[i] = 0xBB;
     }
-
-    if(kmip_get_enum_string_index(KMIP_TAG_KEY_FORMAT_TYPE) != 10)
+    kmip_secure_heap_free(&heap, a);
+    kmip_secure_heap_free(&heap, b);
+    if(heap.used != 0 || !kmip_is_zero_buffer(a, 32) || !kmip_is_zero_buffer(b, 32))
     {
+        kmip_free_secure_heap(&heap);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_get_enum_string_index(KMIP_TAG_KEY_ROLE_TYPE) != 11)
+    uint8 *c = kmip_secure_heap_calloc(&heap, 1, heap.size / 2);
+    uint8 *d = kmip_secure_heap_calloc(&heap, 1, heap.size);
+    if(c != a || d != NULL || !kmip_is_zero_buffer(c, heap.size / 2))
     {
+        kmip_free_secure_heap(&heap);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_get_enum_string_index(KMIP_TAG_KEY_WRAP_TYPE) != 12)
+    kmip_free_secure_heap(&heap);
+    if(heap.region != NULL || kmip_secure_heap_owns(&heap, c))
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_get_enum_string_index(KMIP_TAG_MASK_GENERATOR) != 13)
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_decode_key_value_with_secure_heap(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    uint8 encoding[32] = {
+        0x42, 0x00, 0x45, 0x01, 0x00, 0x00, 0x00, 0x18,
+        0x42, 0x00, 0x43, 0x08, 0x00, 0x00, 0x00, 0x10,
+        0xD3, 0x51, 0x91, 0x0F, 0x1D, 0x79, 0x34, 0xD6,
+        0xE2, 0xAE, 0x17, 0x57, 0x65, 0x64, 0xE2, 0xBC
+    };
+
+    KMIPSecureHeap heap = {0};
+    if(kmip_init_secure_heap(&heap, 4096) != KMIP_OK)
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_get_enum_string_index(KMIP_TAG_NAME_TYPE) != 14)
+    KMIP ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+    ctx.secure_heap = &heap;
+
+    KeyValue observed = {0};
+    int result = kmip_decode_key_value(&ctx, KMIP_KEYFORMAT_RAW, &observed);
+    ByteString *material = (ByteString *)observed.key_material;
+    if(result != KMIP_OK || material == NULL || material->size != 16 || !kmip_secure_heap_owns(&heap, material->value) || kmip_secure_heap_owns(&heap, material) || material->value[0] != 0xD3)
     {
+        kmip_free_key_value(&ctx, KMIP_KEYFORMAT_RAW, &observed);
+        kmip_destroy(&ctx);
+        kmip_free_secure_heap(&heap);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_get_enum_string_index(KMIP_TAG_OBJECT_TYPE) != 15)
+    /* Only the key bytes live in the secure heap; freeing returns them. */
+    kmip_free_key_value(&ctx, KMIP_KEYFORMAT_RAW, &observed);
+    if(heap.used != 0 || heap.peak == 0)
     {
+        kmip_destroy(&ctx);
+        kmip_free_secure_heap(&heap);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_get_enum_string_index(KMIP_TAG_OPERATION) != 16)
+    kmip_destroy(&ctx);
+    kmip_free_secure_heap(&heap);
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_reset_arena_after_response_message_with_secure_heap(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    uint8 encoding[304] = {
+        0x42, 0x00, 0x7B, 0x01, 0x00, 0x00, 0x01, 0x28, 
+        0x42, 0x00, 0x7A, 0x01, 0x00, 0x00, 0x00, 0x48, 
+        0x42, 0x00, 0x69, 0x01, 0x00, 0x00, 0x00, 0x20, 
+        0x42, 0x00, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x6B, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x92, 0x09, 0x00, 0x00, 0x00, 0x08, 
+        0x00, 0x00, 0x00, 0x00, 0x4F, 0x9A, 0x54, 0xE7, 
+        0x42, 0x00, 0x0D, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+        0x42, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x00, 0xD0, 
+        0x42, 0x00, 0x5C, 0x05, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x7F, 0x05, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x7C, 0x01, 0x00, 0x00, 0x00, 0xA8, 
+        0x42, 0x00, 0x57, 0x05, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x94, 0x07, 0x00, 0x00, 0x00, 0x24, 
+        0x34, 0x39, 0x61, 0x31, 0x63, 0x61, 0x38, 0x38, 
+        0x2D, 0x36, 0x62, 0x65, 0x61, 0x2D, 0x34, 0x66, 
+        0x62, 0x32, 0x2D, 0x62, 0x34, 0x35, 0x30, 0x2D, 
+        0x37, 0x65, 0x35, 0x38, 0x38, 0x30, 0x32, 0x63, 
+        0x33, 0x30, 0x33, 0x38, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x8F, 0x01, 0x00, 0x00, 0x00, 0x60, 
+        0x42, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x58, 
+        0x42, 0x00, 0x42, 0x05, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x45, 0x01, 0x00, 0x00, 0x00, 0x20, 
+        0x42, 0x00, 0x43, 0x08, 0x00, 0x00, 0x00, 0x18, 
+        0x73, 0x67, 0x57, 0x80, 0x51, 0x01, 0x2A, 0x6D, 
+        0x13, 0x4A, 0x85, 0x5E, 0x25, 0xC8, 0xCD, 0x5E, 
+        0x4C, 0xA1, 0x31, 0x45, 0x57, 0x29, 0xD3, 0xC8, 
+        0x42, 0x00, 0x28, 0x05, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x2A, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00
+    };
+    
+    KMIPSecureHeap heap = {0};
+    if(kmip_init_secure_heap(&heap, 4096) != KMIP_OK)
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-
-    if(kmip_get_enum_string_index(KMIP_TAG_PADDING_METHOD) != 17)
+    
+    KMIP ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+    ctx.secure_heap = &heap;
+    
+    KMIPArena arena = {0};
+    kmip_init_arena(&arena, 256);
+    kmip_set_arena(&ctx, &arena);
+    
+    /* The first pass releases the message, the second frees it by walking. */
+    for(int pass = 0; pass < 2; pass++)
     {
-        TEST_FAILED(tracker, __func__, __LINE__);
+        kmip_rewind(&ctx);
+    
+        ResponseMessage observed = {0};
+        int result = kmip_decode_response_message(&ctx, &observed);
+        if(result != KMIP_OK || heap.used == 0 || arena.secrets == NULL)
+        {
+            kmip_reset_arena_after_response_message(&ctx, &observed);
+            kmip_unset_arena(&ctx);
+            kmip_destroy(&ctx);
+            kmip_free_arena(&arena);
+            kmip_free_secure_heap(&heap);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+    
+        if(pass == 1)
+        {
+            kmip_free_response_message(&ctx, &observed);
+            if(heap.used != 0 || arena.secrets != NULL)
+            {
+                kmip_unset_arena(&ctx);
+                kmip_destroy(&ctx);
+                kmip_free_arena(&arena);
+                kmip_free_secure_heap(&heap);
+                TEST_FAILED(tracker, __func__, __LINE__);
+            }
+        }
+    
+        /* The key bytes go back to the secure heap without a tree walk. */
+        kmip_reset_arena_after_response_message(&ctx, &observed);
+        if(heap.used != 0 || arena.secrets != NULL || arena.chunks->used != 0)
+        {
+            kmip_unset_arena(&ctx);
+            kmip_destroy(&ctx);
+            kmip_free_arena(&arena);
+            kmip_free_secure_heap(&heap);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
     }
+    
+    kmip_unset_arena(&ctx);
+    kmip_destroy(&ctx);
+    kmip_free_arena(&arena);
+    kmip_free_secure_heap(&heap);
+    TEST_PASSED(tracker, __func__);
+}
 
-    if(kmip_get_enum_string_index(KMIP_TAG_PROTECTION_STORAGE_MASK) != 18)
+int
+test_free_arena_with_secure_heap(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    uint8 encoding[32] = {
+        0x42, 0x00, 0x45, 0x01, 0x00, 0x00, 0x00, 0x18,
+        0x42, 0x00, 0x43, 0x08, 0x00, 0x00, 0x00, 0x10,
+        0xD3, 0x51, 0x91, 0x0F, 0x1D, 0x79, 0x34, 0xD6,
+        0xE2, 0xAE, 0x17, 0x57, 0x65, 0x64, 0xE2, 0xBC
+    };
+    
+    KMIPSecureHeap heap = {0};
+    if(kmip_init_secure_heap(&heap, 4096) != KMIP_OK)
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-
-    if(kmip_get_enum_string_index(KMIP_TAG_RESULT_REASON) != 19)
+    
+    KMIP ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+    ctx.secure_heap = &heap;
+    
+    KMIPArena arena = {0};
+    kmip_init_arena(&arena, 256);
+    kmip_set_arena(&ctx, &arena);
+    
+    KeyValue observed = {0};
+    int result = kmip_decode_key_value(&ctx, KMIP_KEYFORMAT_RAW, &observed);
+    if(result != KMIP_OK || heap.used == 0 || arena.secrets == NULL)
     {
+        kmip_unset_arena(&ctx);
+        kmip_destroy(&ctx);
+        kmip_free_arena(&arena);
+        kmip_free_secure_heap(&heap);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-
-    if(kmip_get_enum_string_index(KMIP_TAG_RESULT_STATUS) != 20)
+    
+    /* Tearing down without a reset still returns the key bytes. */
+    kmip_unset_arena(&ctx);
+    kmip_destroy(&ctx);
+    kmip_free_arena(&arena);
+    if(heap.used != 0 || arena.secrets != NULL || arena.chunks != NULL)
     {
+        kmip_free_secure_heap(&heap);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
+    
+    kmip_free_secure_heap(&heap);
+    TEST_PASSED(tracker, __func__);
+}
 
-    if(kmip_get_enum_string_index(KMIP_TAG_STATE) != 21)
+typedef struct parser_item_counts
+{
+    size_t items;
+    size_t structures;
+    size_t batch_items;
+    enum tag last_tag;
+} ParserItemCounts;
+
+int
+count_parser_items(void *state, const KMIPParserItem *item)
+{
+    ParserItemCounts *counts = (ParserItemCounts *)state;
+    counts->items++;
+    if(item->type == KMIP_TYPE_STRUCTURE)
     {
-        TEST_FAILED(tracker, __func__, __LINE__);
+        counts->structures++;
     }
-
-    if(kmip_get_enum_string_index(KMIP_TAG_TAG) != 22)
+    if(item->depth == 1 && item->tag == KMIP_TAG_BATCH_ITEM)
     {
-        TEST_FAILED(tracker, __func__, __LINE__);
+        counts->batch_items++;
     }
+    counts->last_tag = item->tag;
+    
+    return(KMIP_OK);
+}
 
-    if(kmip_get_enum_string_index(KMIP_TAG_TYPE) != 23)
+int
+test_parser_feed_byte_by_byte(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    uint8 encoding[152] = {
+        0x42, 0x00, 0x78, 0x01, 0x00, 0x00, 0x00, 0x90, 
+        0x42, 0x00, 0x77, 0x01, 0x00, 0x00, 0x00, 0x38, 
+        0x42, 0x00, 0x69, 0x01, 0x00, 0x00, 0x00, 0x20, 
+        0x42, 0x00, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x6B, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x0D, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x48, 
+        0x42, 0x00, 0x5C, 0x05, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x79, 0x01, 0x00, 0x00, 0x00, 0x30, 
+        0x42, 0x00, 0x94, 0x07, 0x00, 0x00, 0x00, 0x24, 
+        0x34, 0x39, 0x61, 0x31, 0x63, 0x61, 0x38, 0x38, 
+        0x2D, 0x36, 0x62, 0x65, 0x61, 0x2D, 0x34, 0x66, 
+        0x62, 0x32, 0x2D, 0x62, 0x34, 0x35, 0x30, 0x2D, 
+        0x37, 0x65, 0x35, 0x38, 0x38, 0x30, 0x32, 0x63, 
+        0x33, 0x30, 0x33, 0x38, 0x00, 0x00, 0x00, 0x00
+    };
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+
+    ParserItemCounts counts = {0};
+    KMIPParser parser = {0};
+    kmip_parser_init(&parser, &ctx);
+    parser.item_func = &count_parser_items;
+    parser.item_state = &counts;
+
+    int result = KMIP_PARSER_NEED_MORE;
+    for(size_t i = 0; i < ARRAY_LENGTH(encoding); i++)
     {
-        TEST_FAILED(tracker, __func__, __LINE__);
+        result = kmip_parser_feed(&parser, &encoding[i], 1);
+        int expected = (i + 1 < ARRAY_LENGTH(encoding)) ? KMIP_PARSER_NEED_MORE : KMIP_PARSER_COMPLETE;
+        if(result != expected || parser.consumed != 1)
+        {
+            kmip_parser_free(&parser);
+            kmip_destroy(&ctx);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
     }
 
-    if(kmip_get_enum_string_index(KMIP_TAG_WRAPPING_METHOD) != 24)
+    /* 10 items, 5 of them structures, ending with the message itself. */
+    if(counts.items != 10 || counts.structures != 5 || counts.batch_items != 1 || counts.last_tag != KMIP_TAG_REQUEST_MESSAGE)
     {
+        kmip_parser_free(&parser);
+        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_get_enum_string_index(-1) != 25)
+    /* The completed message decodes with the regular decoders. */
+    RequestMessage observed = {0};
+    kmip_set_buffer(&ctx, parser.buffer, parser.message_size);
+    result = kmip_decode_request_message(&ctx, &observed);
+    if(result != KMIP_OK || observed.batch_count != 1 || observed.batch_items[0].operation != KMIP_OP_GET)
     {
+        kmip_free_request_message(&ctx, &observed);
+        kmip_set_buffer(&ctx, NULL, 0);
+        kmip_parser_free(&parser);
+        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
+    kmip_free_request_message(&ctx, &observed);
+    kmip_set_buffer(&ctx, NULL, 0);
+    kmip_parser_free(&parser);
+    kmip_destroy(&ctx);
     TEST_PASSED(tracker, __func__);
 }
 
 int
-test_check_enum_value_protection_storage_masks(TestTracker *tracker)
+test_parser_feed_chunks(TestTracker *tracker)
 {
     TRACK_TEST(tracker);
 
-    enum kmip_version v = KMIP_2_0;
-    enum tag t = KMIP_TAG_PROTECTION_STORAGE_MASK;
+    /* A Destroy request followed by the start of the next message. */
+    uint8 encoding[128] = {
+        0x42, 0x00, 0x78, 0x01, 0x00, 0x00, 0x00, 0x70, 
+        0x42, 0x00, 0x77, 0x01, 0x00, 0x00, 0x00, 0x38, 
+        0x42, 0x00, 0x69, 0x01, 0x00, 0x00, 0x00, 0x20, 
+        0x42, 0x00, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x6B, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x0D, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x28, 
+        0x42, 0x00, 0x5C, 0x05, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x79, 0x01, 0x00, 0x00, 0x00, 0x10, 
+        0x42, 0x00, 0x94, 0x07, 0x00, 0x00, 0x00, 0x01, 
+        0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x78, 0x01, 0x00, 0x00, 0x00, 0x70
+    };
+    size_t message_size = 120;
 
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_SOFTWARE) != KMIP_OK)
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+
+    ParserItemCounts counts = {0};
+    KMIPParser parser = {0};
+    kmip_parser_init(&parser, &ctx);
+    parser.item_func = &count_parser_items;
+    parser.item_state = &counts;
+
+    /* Chunks that split headers and values at odd offsets. */
+    size_t offset = 0;
+    int result = KMIP_PARSER_NEED_MORE;
+    while(result == KMIP_PARSER_NEED_MORE && offset < ARRAY_LENGTH(encoding))
     {
-        TEST_FAILED(tracker, __func__, __LINE__);
+        size_t chunk = ARRAY_LENGTH(encoding) - offset;
+        if(chunk > 13)
+        {
+            chunk = 13;
+        }
+        result = kmip_parser_feed(&parser, encoding + offset, chunk);
+        offset += parser.consumed;
     }
 
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_HARDWARE) != KMIP_OK)
+    if(result != KMIP_PARSER_COMPLETE || offset != message_size || parser.message_size != message_size || counts.items != 10)
     {
+        kmip_parser_free(&parser);
+        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_ON_PROCESSOR) != KMIP_OK)
+    /* A completed parser takes no more bytes until it is reset. */
+    result = kmip_parser_feed(&parser, encoding + offset, ARRAY_LENGTH(encoding) - offset);
+    if(result != KMIP_PARSER_COMPLETE || parser.consumed != 0)
     {
+        kmip_parser_free(&parser);
+        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_ON_SYSTEM) != KMIP_OK)
+    kmip_parser_reset(&parser);
+    counts.items = 0;
+    result = kmip_parser_feed(&parser, encoding, ARRAY_LENGTH(encoding));
+    if(result != KMIP_PARSER_COMPLETE || parser.consumed != message_size || counts.items != 10)
     {
+        kmip_parser_free(&parser);
+        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_OFF_SYSTEM) != KMIP_OK)
+    kmip_parser_free(&parser);
+    kmip_destroy(&ctx);
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_parser_feed_malformed(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    uint8 not_structure[16] = {
+        0x42, 0x00, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00
+    };
+    uint8 overrun[24] = {
+        0x42, 0x00, 0x78, 0x01, 0x00, 0x00, 0x00, 0x10, 
+        0x42, 0x00, 0x77, 0x01, 0x00, 0x00, 0x00, 0x20, 
+        0x42, 0x00, 0x69, 0x01, 0x00, 0x00, 0x00, 0x18
+    };
+    uint8 unknown_type[24] = {
+        0x42, 0x00, 0x78, 0x01, 0x00, 0x00, 0x00, 0x10, 
+        0x42, 0x00, 0x6A, 0x0C, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00
+    };
+    uint8 too_large[8] = {
+        0x42, 0x00, 0x78, 0x01, 0x00, 0x01, 0x00, 0x00
+    };
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+
+    KMIPParser parser = {0};
+    kmip_parser_init(&parser, &ctx);
+
+    int result = kmip_parser_feed(&parser, not_structure, ARRAY_LENGTH(not_structure));
+    if(result != KMIP_TYPE_MISMATCH)
     {
+        kmip_parser_free(&parser);
+        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_HYPERVISOR) != KMIP_OK)
+    /* Errors stick until the parser is reset. */
+    result = kmip_parser_feed(&parser, not_structure, ARRAY_LENGTH(not_structure));
+    if(result != KMIP_TYPE_MISMATCH || parser.consumed != 0)
     {
+        kmip_parser_free(&parser);
+        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_OPERATING_SYSTEM) != KMIP_OK)
+    kmip_parser_reset(&parser);
+    result = kmip_parser_feed(&parser, overrun, ARRAY_LENGTH(overrun));
+    if(result != KMIP_LENGTH_MISMATCH)
     {
+        kmip_parser_free(&parser);
+        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_CONTAINER) != KMIP_OK)
+    kmip_parser_reset(&parser);
+    result = kmip_parser_feed(&parser, unknown_type, ARRAY_LENGTH(unknown_type));
+    if(result != KMIP_TYPE_MISMATCH)
     {
+        kmip_parser_free(&parser);
+        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_ON_PREMISES) != KMIP_OK)
+    kmip_parser_reset(&parser);
+    result = kmip_parser_feed(&parser, too_large, ARRAY_LENGTH(too_large));
+    if(result != KMIP_EXCEED_MAX_MESSAGE_SIZE)
     {
+        kmip_parser_free(&parser);
+        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_OFF_PREMISES) != KMIP_OK)
+    kmip_parser_free(&parser);
+    kmip_destroy(&ctx);
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_buffer_bytes_left(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    uint8 a[1] = {0x42};
+    uint8 b[3] = {0x42, 0x00, 0x08};
+    uint8 c[5] = {0x42, 0x00, 0x53, 0x01, 0x00};
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, a, ARRAY_LENGTH(a), KMIP_1_0);
+
+    if(BUFFER_BYTES_LEFT(&ctx) != 1)
     {
+        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_SELF_MANAGED) != KMIP_OK)
+    kmip_destroy(&ctx);
+    kmip_init(&ctx, b, ARRAY_LENGTH(b), KMIP_1_0);
+
+    if(BUFFER_BYTES_LEFT(&ctx) != 3)
     {
+        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_OUTSOURCED) != KMIP_OK)
+    kmip_destroy(&ctx);
+    kmip_init(&ctx, c, ARRAY_LENGTH(c), KMIP_1_0);
+
+    if(BUFFER_BYTES_LEFT(&ctx) != 5)
     {
+        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_VALIDATED) != KMIP_OK)
+    kmip_destroy(&ctx);
+
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_is_zero_buffer(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    uint8 buffer[19] = {0};
+
+    if(kmip_is_zero_buffer(buffer, ARRAY_LENGTH(buffer)) != KMIP_TRUE)
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_SAME_JURISDICTION) != KMIP_OK)
+    if(kmip_is_zero_buffer(buffer, 0) != KMIP_TRUE)
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    v = KMIP_1_4;
-
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_SOFTWARE) != KMIP_INVALID_FOR_VERSION)
+    /* Check that a stray byte is caught in both the word loop and the */
+    /* trailing byte loop.                                             */
+    buffer[5] = 0x01;
+    if(kmip_is_zero_buffer(buffer, ARRAY_LENGTH(buffer)) != KMIP_FALSE)
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_HARDWARE) != KMIP_INVALID_FOR_VERSION)
+    buffer[5] = 0x00;
+    buffer[18] = 0x80;
+    if(kmip_is_zero_buffer(buffer, ARRAY_LENGTH(buffer)) != KMIP_FALSE)
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_ON_PROCESSOR) != KMIP_INVALID_FOR_VERSION)
+    if(kmip_is_zero_buffer(buffer, 18) != KMIP_TRUE)
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_ON_SYSTEM) != KMIP_INVALID_FOR_VERSION)
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_get_num_attributes_next(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    /* Need to build an encoding with one of each type of support
+       attribute. Verify that this function returns the correct
+       count.
+
+       Need to build an encoding with bad attribute length? Handle
+       weird corner cases?
+    */
+    TEST_FAILED(tracker, __func__, __LINE__);
+}
+
+int
+test_peek_tag(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    /* Build an encoding with an arbitrary tag value. Verify that this
+       function reads and returns this tag value without changing the
+       context buffer.
+    */
+
+    uint8 underfull_encoding[1] = {0x42};
+    uint8 full_encoding[3] = {0x42, 0x00, 0x08};
+    uint8 overfull_encoding[5] = {0x42, 0x00, 0x53, 0x01, 0x00};
+
+    uint32 tag = 0;
+    uint8 *prev_buffer = NULL;
+    uint8 *prev_index = NULL;
+    size_t prev_size = 0;
+    KMIP ctx = {0};
+    kmip_init(&ctx, underfull_encoding, ARRAY_LENGTH(underfull_encoding), KMIP_1_0);
+
+    prev_buffer = ctx.buffer;
+    prev_index = ctx.index;
+    prev_size = ctx.size;
+    tag = kmip_peek_tag(&ctx);
+    if(tag != 0 || ctx.buffer != prev_buffer || ctx.index != prev_index || ctx.size != prev_size)
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_OFF_SYSTEM) != KMIP_INVALID_FOR_VERSION)
+    kmip_destroy(&ctx);
+    kmip_init(&ctx, full_encoding, ARRAY_LENGTH(full_encoding), KMIP_1_0);
+
+    prev_buffer = ctx.buffer;
+    prev_index = ctx.index;
+    prev_size = ctx.size;
+    tag = kmip_peek_tag(&ctx);
+    if(tag != KMIP_TAG_ATTRIBUTE || ctx.buffer != prev_buffer || ctx.index != prev_index || ctx.size != prev_size)
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_HYPERVISOR) != KMIP_INVALID_FOR_VERSION)
+    kmip_destroy(&ctx);
+    kmip_init(&ctx, overfull_encoding, ARRAY_LENGTH(overfull_encoding), KMIP_1_0);
+
+    prev_buffer = ctx.buffer;
+    prev_index = ctx.index;
+    prev_size = ctx.size;
+    tag = kmip_peek_tag(&ctx);
+    if(tag != KMIP_TAG_NAME || ctx.buffer != prev_buffer || ctx.index != prev_index || ctx.size != prev_size)
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_OPERATING_SYSTEM) != KMIP_INVALID_FOR_VERSION)
+    kmip_destroy(&ctx);
+
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_is_attribute_tag(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    if(!kmip_is_attribute_tag(KMIP_TAG_UNIQUE_IDENTIFIER))
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_CONTAINER) != KMIP_INVALID_FOR_VERSION)
+    if(!kmip_is_attribute_tag(KMIP_TAG_NAME))
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_ON_PREMISES) != KMIP_INVALID_FOR_VERSION)
+    if(!kmip_is_attribute_tag(KMIP_TAG_OBJECT_TYPE))
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_OFF_PREMISES) != KMIP_INVALID_FOR_VERSION)
+    if(!kmip_is_attribute_tag(KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM))
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_SELF_MANAGED) != KMIP_INVALID_FOR_VERSION)
+    if(!kmip_is_attribute_tag(KMIP_TAG_CRYPTOGRAPHIC_LENGTH))
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_OUTSOURCED) != KMIP_INVALID_FOR_VERSION)
+    if(!kmip_is_attribute_tag(KMIP_TAG_OPERATION_POLICY_NAME))
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_VALIDATED) != KMIP_INVALID_FOR_VERSION)
+    if(!kmip_is_attribute_tag(KMIP_TAG_CRYPTOGRAPHIC_USAGE_MASK))
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    if(!kmip_is_attribute_tag(KMIP_TAG_STATE))
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    if(!kmip_is_attribute_tag(KMIP_TAG_APPLICATION_SPECIFIC_INFORMATION))
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_check_enum_value(v, t, KMIP_PROTECT_SAME_JURISDICTION) != KMIP_INVALID_FOR_VERSION)
+    if(kmip_is_attribute_tag(KMIP_TAG_REQUEST_MESSAGE))
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    if(kmip_is_attribute_tag(KMIP_TAG_PUBLIC_PROTECTION_STORAGE_MASKS))
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    if(kmip_check_enum_value(v, t, -1) != KMIP_ENUM_MISMATCH)
+    /* Only the low bits of these match attribute tags. */
+    if(kmip_is_attribute_tag(0x000094) ||
+       kmip_is_attribute_tag(0x430094) ||
+       kmip_is_attribute_tag(0x42FF94))
     {
         TEST_FAILED(tracker, __func__, __LINE__);
     }
@@ -1160,279 +1900,681 @@ test_check_enum_value_protection_storage_masks(TestTracker *tracker)
 }
 
 int
-test_init_protocol_version(TestTracker *tracker)
+test_get_enum_string_index(TestTracker *tracker)
 {
     TRACK_TEST(tracker);
 
-    kmip_init_protocol_version(NULL, KMIP_1_0);
-
-    ProtocolVersion pv = {0};
-
-    if(pv.major != 0)
+    if(kmip_get_enum_string_index(KMIP_TAG_ATTESTATION_TYPE) != 0)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
-    if(pv.minor != 0)
+    }
+
+    if(kmip_get_enum_string_index(KMIP_TAG_BATCH_ERROR_CONTINUATION_OPTION) != 1)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    kmip_init_protocol_version(&pv, KMIP_1_0);
+    if(kmip_get_enum_string_index(KMIP_TAG_BLOCK_CIPHER_MODE) != 2)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    if(pv.major != 1)
+    if(kmip_get_enum_string_index(KMIP_TAG_CREDENTIAL_TYPE) != 3)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
-    if(pv.minor != 0)
+    }
+
+    if(kmip_get_enum_string_index(KMIP_TAG_CRYPTOGRAPHIC_ALGORITHM) != 4)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    kmip_init_protocol_version(&pv, KMIP_1_1);
+    if(kmip_get_enum_string_index(KMIP_TAG_CRYPTOGRAPHIC_USAGE_MASK) != 5)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    if(pv.major != 1)
+    if(kmip_get_enum_string_index(KMIP_TAG_DIGITAL_SIGNATURE_ALGORITHM) != 6)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
-    if(pv.minor != 1)
+    }
+
+    if(kmip_get_enum_string_index(KMIP_TAG_ENCODING_OPTION) != 7)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    kmip_init_protocol_version(&pv, KMIP_1_2);
+    if(kmip_get_enum_string_index(KMIP_TAG_HASHING_ALGORITHM) != 8)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    if(pv.major != 1)
+    if(kmip_get_enum_string_index(KMIP_TAG_KEY_COMPRESSION_TYPE) != 9)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
-    if(pv.minor != 2)
+    }
+
+    if(kmip_get_enum_string_index(KMIP_TAG_KEY_FORMAT_TYPE) != 10)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    kmip_init_protocol_version(&pv, KMIP_1_3);
+    if(kmip_get_enum_string_index(KMIP_TAG_KEY_ROLE_TYPE) != 11)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    if(pv.major != 1)
+    if(kmip_get_enum_string_index(KMIP_TAG_KEY_WRAP_TYPE) != 12)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
-    if(pv.minor != 3)
+    }
+
+    if(kmip_get_enum_string_index(KMIP_TAG_MASK_GENERATOR) != 13)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    kmip_init_protocol_version(&pv, KMIP_1_4);
-
-    if(pv.major != 1)
-        TEST_FAILED(tracker, __func__, __LINE__);
-    if(pv.minor != 4)
+    if(kmip_get_enum_string_index(KMIP_TAG_NAME_TYPE) != 14)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    kmip_init_protocol_version(&pv, KMIP_2_0);
-
-    if(pv.major != 2)
-        TEST_FAILED(tracker, __func__, __LINE__);
-    if(pv.minor != 0)
+    if(kmip_get_enum_string_index(KMIP_TAG_OBJECT_TYPE) != 15)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    TEST_PASSED(tracker, __func__);
-}
-
-int
-test_init_request_batch_item(TestTracker *tracker)
-{
-    TRACK_TEST(tracker);
+    if(kmip_get_enum_string_index(KMIP_TAG_OPERATION) != 16)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    kmip_init_request_batch_item(NULL);
+    if(kmip_get_enum_string_index(KMIP_TAG_PADDING_METHOD) != 17)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    RequestBatchItem rbi = {0};
+    if(kmip_get_enum_string_index(KMIP_TAG_PROTECTION_STORAGE_MASK) != 18)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    if(rbi.operation != 0)
+    if(kmip_get_enum_string_index(KMIP_TAG_RESULT_REASON) != 19)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
-    if(rbi.unique_batch_item_id != NULL)
+    }
+
+    if(kmip_get_enum_string_index(KMIP_TAG_RESULT_STATUS) != 20)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
-    if(rbi.request_payload != NULL)
+    }
+
+    if(kmip_get_enum_string_index(KMIP_TAG_STATE) != 21)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
-    if(rbi.ephemeral != 0)
+    }
+
+    if(kmip_get_enum_string_index(KMIP_TAG_TAG) != 22)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    kmip_init_request_batch_item(&rbi);
+    if(kmip_get_enum_string_index(KMIP_TAG_TYPE) != 23)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    if(rbi.operation != 0)
+    if(kmip_get_enum_string_index(KMIP_TAG_WRAPPING_METHOD) != 24)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
-    if(rbi.unique_batch_item_id != NULL)
+    }
+
+    if(kmip_get_enum_string_index(-1) != 25)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
-    if(rbi.request_payload != NULL)
+    }
+
+    /* Activation Date shares its low bits with Type but is not an enum. */
+    if(kmip_get_enum_string_index(0x420001) != 25)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
-    if(rbi.ephemeral != KMIP_UNSET)
+    }
+
+    if(kmip_get_enum_string_index(0x4300C7) != 25)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
     TEST_PASSED(tracker, __func__);
 }
 
 int
-test_print_attributes(TestTracker *tracker)
-{
-    TRACK_TEST(tracker);
-
-    /* For now this will probably be left as a placeholder for a
-       future test. Ideally the print functions would output to
-       an arbitrary buffer so that we can verify that they are
-       correctly displaying structure content and formatting.
-       Since they currently use printf directly, this may be hard
-       to do in the short term.
-    */
-    TEST_FAILED(tracker, __func__, __LINE__);
-}
-
-int
-test_free_attributes(TestTracker *tracker)
-{
-    TRACK_TEST(tracker);
-
-    /* Build a dynamically allocated Attributes structure. Free it
-       with this function. Verify that all internal pointers and
-       fields are correctly nullified.
-
-       Ideally, hook into the free function managed by the context
-       and use that hook to verify that the correct free calls are
-       made on the internal Attributes structure pointers. This
-       may require more infrastructure work than currently exists.
-    */
-    TEST_FAILED(tracker, __func__, __LINE__);
-}
-
-int
-test_compare_attributes(TestTracker *tracker)
-{
-    TRACK_TEST(tracker);
-
-    /* Build two separate identical Attributes structures. Compare
-       them with this function and confirm they match.
-
-       Build two separate different Attributes structures. Compare
-       them with this function and confirm they do not match. This
-       may require multiple rounds, changing different parts of the
-       underlying Attributes structure. It may make more sense to
-       split this into multiple test functions.
-    */
-    TEST_FAILED(tracker, __func__, __LINE__);
-}
-
-int
-test_deep_copy_int32(TestTracker *tracker)
+test_check_enum_value_protection_storage_masks(TestTracker *tracker)
 {
     TRACK_TEST(tracker);
 
-    int32 expected = 42;
-    int32 *observed = NULL;
+    enum kmip_version v = KMIP_2_0;
+    enum tag t = KMIP_TAG_PROTECTION_STORAGE_MASK;
 
-    observed = kmip_deep_copy_int32(NULL, NULL);
-    if(observed != NULL)
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_SOFTWARE) != KMIP_OK)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    KMIP ctx = {0};
-    kmip_init(&ctx, NULL, 0, KMIP_1_0);
-
-    observed = kmip_deep_copy_int32(&ctx, NULL);
-    if(observed != NULL)
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_HARDWARE) != KMIP_OK)
     {
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    observed = kmip_deep_copy_int32(&ctx, &expected);
-    if(observed == NULL)
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_ON_PROCESSOR) != KMIP_OK)
     {
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-    if(*observed != expected)
+
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_ON_SYSTEM) != KMIP_OK)
     {
-        kmip_print_integer(expected);
-        kmip_print_integer(*observed);
-        ctx.free_func(ctx.state, observed);
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    ctx.free_func(ctx.state, observed);
-    kmip_destroy(&ctx);
-
-    TEST_PASSED(tracker, __func__);
-}
-
-int
-test_deep_copy_text_string(TestTracker *tracker)
-{
-    TRACK_TEST(tracker);
-
-    TextString expected = {0};
-    expected.value = "example";
-    expected.size = 7;
-    TextString *observed = NULL;
-
-    observed = kmip_deep_copy_text_string(NULL, NULL);
-    if(observed != NULL)
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_OFF_SYSTEM) != KMIP_OK)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    KMIP ctx = {0};
-    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_HYPERVISOR) != KMIP_OK)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    observed = kmip_deep_copy_text_string(&ctx, NULL);
-    if(observed != NULL)
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_OPERATING_SYSTEM) != KMIP_OK)
     {
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    observed = kmip_deep_copy_text_string(&ctx, &expected);
-    if(observed == NULL)
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_CONTAINER) != KMIP_OK)
     {
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-    if(!kmip_compare_text_string(&expected, observed))
+
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_ON_PREMISES) != KMIP_OK)
     {
-        kmip_print_text_string(1, "Name Value", &expected);
-        kmip_print_text_string(1, "Name Value", observed);
-        kmip_free_text_string(&ctx, observed);
-        ctx.free_func(ctx.state, observed);
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    kmip_free_text_string(&ctx, observed);
-    ctx.free_func(ctx.state, observed);
-    kmip_destroy(&ctx);
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_OFF_PREMISES) != KMIP_OK)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    TEST_PASSED(tracker, __func__);
-}
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_SELF_MANAGED) != KMIP_OK)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-int
-test_deep_copy_name(TestTracker *tracker)
-{
-    TRACK_TEST(tracker);
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_OUTSOURCED) != KMIP_OK)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    TextString value = {0};
-    value.value = "example";
-    value.size = 7;
-    Name expected = {0};
-    expected.value = &value;
-    expected.type = KMIP_NAME_UNINTERPRETED_TEXT_STRING;
-    Name *observed = NULL;
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_VALIDATED) != KMIP_OK)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    observed = kmip_deep_copy_name(NULL, NULL);
-    if(observed != NULL)
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_SAME_JURISDICTION) != KMIP_OK)
+    {
         TEST_FAILED(tracker, __func__, __LINE__);
+    }
 
-    KMIP ctx = {0};
-    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+    v = KMIP_1_4;
 
-    observed = kmip_deep_copy_name(&ctx, NULL);
-    if(observed != NULL)
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_SOFTWARE) != KMIP_INVALID_FOR_VERSION)
     {
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    observed = kmip_deep_copy_name(&ctx, &expected);
-    if(observed == NULL)
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_HARDWARE) != KMIP_INVALID_FOR_VERSION)
     {
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-    if(!kmip_compare_name(&expected, observed))
+
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_ON_PROCESSOR) != KMIP_INVALID_FOR_VERSION)
     {
-        kmip_print_name(1, &expected);
-        kmip_print_name(1, observed);
-        kmip_free_name(&ctx, observed);
-        ctx.free_func(ctx.state, observed);
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    kmip_free_name(&ctx, observed);
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_ON_SYSTEM) != KMIP_INVALID_FOR_VERSION)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_OFF_SYSTEM) != KMIP_INVALID_FOR_VERSION)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_HYPERVISOR) != KMIP_INVALID_FOR_VERSION)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_OPERATING_SYSTEM) != KMIP_INVALID_FOR_VERSION)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_CONTAINER) != KMIP_INVALID_FOR_VERSION)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_ON_PREMISES) != KMIP_INVALID_FOR_VERSION)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_OFF_PREMISES) != KMIP_INVALID_FOR_VERSION)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_SELF_MANAGED) != KMIP_INVALID_FOR_VERSION)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_OUTSOURCED) != KMIP_INVALID_FOR_VERSION)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_VALIDATED) != KMIP_INVALID_FOR_VERSION)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(v, t, KMIP_PROTECT_SAME_JURISDICTION) != KMIP_INVALID_FOR_VERSION)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(v, t, -1) != KMIP_ENUM_MISMATCH)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_check_enum_value_cryptographic_usage_mask(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    enum tag t = KMIP_TAG_CRYPTOGRAPHIC_USAGE_MASK;
+
+    if(kmip_check_enum_value(KMIP_1_0, t, KMIP_CRYPTOMASK_ENCRYPT) != KMIP_OK)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(KMIP_1_4, t, KMIP_CRYPTOMASK_AUTHENTICATE) != KMIP_INVALID_FOR_VERSION)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(KMIP_2_0, t, KMIP_CRYPTOMASK_FPE_DECRYPT) != KMIP_OK)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    /* Each value is checked as a single bit, not as a combined mask. */
+    if(kmip_check_enum_value(KMIP_2_0, t, KMIP_CRYPTOMASK_ENCRYPT | KMIP_CRYPTOMASK_DECRYPT) != KMIP_ENUM_MISMATCH)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(KMIP_2_0, t, 0) != KMIP_ENUM_MISMATCH)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(KMIP_2_0, t, 0x01000000) != KMIP_ENUM_MISMATCH)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_check_enum_value_version_ranges(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    if(kmip_check_enum_value(KMIP_1_3, KMIP_TAG_BLOCK_CIPHER_MODE, KMIP_BLOCK_AEAD) != KMIP_INVALID_FOR_VERSION)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(KMIP_1_4, KMIP_TAG_BLOCK_CIPHER_MODE, KMIP_BLOCK_AEAD) != KMIP_OK)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(KMIP_1_0, KMIP_TAG_BLOCK_CIPHER_MODE, KMIP_BLOCK_AEAD + 1) != KMIP_ENUM_MISMATCH)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(KMIP_1_0, KMIP_TAG_BLOCK_CIPHER_MODE, -1) != KMIP_ENUM_MISMATCH)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(KMIP_1_0, KMIP_TAG_RESULT_STATUS, KMIP_STATUS_SUCCESS) != KMIP_OK)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(KMIP_1_0, KMIP_TAG_RESULT_REASON, KMIP_REASON_GENERAL_FAILURE) != KMIP_OK)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    /* Operation values are sparse; the gaps must not validate. */
+    if(kmip_check_enum_value(KMIP_1_0, KMIP_TAG_OPERATION, KMIP_OP_GET - 1) != KMIP_ENUM_MISMATCH)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(KMIP_1_0, KMIP_TAG_TAG, 0x12345678) != KMIP_OK)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_check_enum_value(KMIP_1_0, KMIP_TAG_NAME, 1) != KMIP_ENUM_UNSUPPORTED)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_init_protocol_version(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    kmip_init_protocol_version(NULL, KMIP_1_0);
+
+    ProtocolVersion pv = {0};
+
+    if(pv.major != 0)
+        TEST_FAILED(tracker, __func__, __LINE__);
+    if(pv.minor != 0)
+        TEST_FAILED(tracker, __func__, __LINE__);
+
+    kmip_init_protocol_version(&pv, KMIP_1_0);
+
+    if(pv.major != 1)
+        TEST_FAILED(tracker, __func__, __LINE__);
+    if(pv.minor != 0)
+        TEST_FAILED(tracker, __func__, __LINE__);
+
+    kmip_init_protocol_version(&pv, KMIP_1_1);
+
+    if(pv.major != 1)
+        TEST_FAILED(tracker, __func__, __LINE__);
+    if(pv.minor != 1)
+        TEST_FAILED(tracker, __func__, __LINE__);
+
+    kmip_init_protocol_version(&pv, KMIP_1_2);
+
+    if(pv.major != 1)
+        TEST_FAILED(tracker, __func__, __LINE__);
+    if(pv.minor != 2)
+        TEST_FAILED(tracker, __func__, __LINE__);
+
+    kmip_init_protocol_version(&pv, KMIP_1_3);
+
+    if(pv.major != 1)
+        TEST_FAILED(tracker, __func__, __LINE__);
+    if(pv.minor != 3)
+        TEST_FAILED(tracker, __func__, __LINE__);
+
+    kmip_init_protocol_version(&pv, KMIP_1_4);
+
+    if(pv.major != 1)
+        TEST_FAILED(tracker, __func__, __LINE__);
+    if(pv.minor != 4)
+        TEST_FAILED(tracker, __func__, __LINE__);
+
+    kmip_init_protocol_version(&pv, KMIP_2_0);
+
+    if(pv.major != 2)
+        TEST_FAILED(tracker, __func__, __LINE__);
+    if(pv.minor != 0)
+        TEST_FAILED(tracker, __func__, __LINE__);
+
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_init_request_batch_item(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    kmip_init_request_batch_item(NULL);
+
+    RequestBatchItem rbi = {0};
+
+    if(rbi.operation != 0)
+        TEST_FAILED(tracker, __func__, __LINE__);
+    if(rbi.unique_batch_item_id != NULL)
+        TEST_FAILED(tracker, __func__, __LINE__);
+    if(rbi.request_payload != NULL)
+        TEST_FAILED(tracker, __func__, __LINE__);
+    if(rbi.ephemeral != 0)
+        TEST_FAILED(tracker, __func__, __LINE__);
+
+    kmip_init_request_batch_item(&rbi);
+
+    if(rbi.operation != 0)
+        TEST_FAILED(tracker, __func__, __LINE__);
+    if(rbi.unique_batch_item_id != NULL)
+        TEST_FAILED(tracker, __func__, __LINE__);
+    if(rbi.request_payload != NULL)
+        TEST_FAILED(tracker, __func__, __LINE__);
+    if(rbi.ephemeral != KMIP_UNSET)
+        TEST_FAILED(tracker, __func__, __LINE__);
+
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_print_attributes(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    /* For now this will probably be left as a placeholder for a
+       future test. Ideally the print functions would output to
+       an arbitrary buffer so that we can verify that they are
+       correctly displaying structure content and formatting.
+       Since they currently use printf directly, this may be hard
+       to do in the short term.
+    */
+    TEST_FAILED(tracker, __func__, __LINE__);
+}
+
+int
+test_free_attributes(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    /* Build a dynamically allocated Attributes structure. Free it
+       with this function. Verify that all internal pointers and
+       fields are correctly nullified.
+
+       Ideally, hook into the free function managed by the context
+       and use that hook to verify that the correct free calls are
+       made on the internal Attributes structure pointers. This
+       may require more infrastructure work than currently exists.
+    */
+    TEST_FAILED(tracker, __func__, __LINE__);
+}
+
+int
+test_compare_attributes(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    /* Build two separate identical Attributes structures. Compare
+       them with this function and confirm they match.
+
+       Build two separate different Attributes structures. Compare
+       them with this function and confirm they do not match. This
+       may require multiple rounds, changing different parts of the
+       underlying Attributes structure. It may make more sense to
+       split this into multiple test functions.
+    */
+    TEST_FAILED(tracker, __func__, __LINE__);
+}
+
+int
+test_deep_copy_int32(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    int32 expected = 42;
+    int32 *observed = NULL;
+
+    observed = kmip_deep_copy_int32(NULL, NULL);
+    if(observed != NULL)
+        TEST_FAILED(tracker, __func__, __LINE__);
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+
+    observed = kmip_deep_copy_int32(&ctx, NULL);
+    if(observed != NULL)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    observed = kmip_deep_copy_int32(&ctx, &expected);
+    if(observed == NULL)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    if(*observed != expected)
+    {
+        kmip_print_integer(expected);
+        kmip_print_integer(*observed);
+        ctx.free_func(ctx.state, observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    ctx.free_func(ctx.state, observed);
+    kmip_destroy(&ctx);
+
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_deep_copy_text_string(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    TextString expected = {0};
+    expected.value = "example";
+    expected.size = 7;
+    TextString *observed = NULL;
+
+    observed = kmip_deep_copy_text_string(NULL, NULL);
+    if(observed != NULL)
+        TEST_FAILED(tracker, __func__, __LINE__);
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+
+    observed = kmip_deep_copy_text_string(&ctx, NULL);
+    if(observed != NULL)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    observed = kmip_deep_copy_text_string(&ctx, &expected);
+    if(observed == NULL)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    if(!kmip_compare_text_string(&expected, observed))
+    {
+        kmip_print_text_string(1, "Name Value", &expected);
+        kmip_print_text_string(1, "Name Value", observed);
+        kmip_free_text_string(&ctx, observed);
+        ctx.free_func(ctx.state, observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    kmip_free_text_string(&ctx, observed);
+    ctx.free_func(ctx.state, observed);
+    kmip_destroy(&ctx);
+
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_deep_copy_name(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    TextString value = {0};
+    value.value = "example";
+    value.size = 7;
+    Name expected = {0};
+    expected.value = &value;
+    expected.type = KMIP_NAME_UNINTERPRETED_TEXT_STRING;
+    Name *observed = NULL;
+
+    observed = kmip_deep_copy_name(NULL, NULL);
+    if(observed != NULL)
+        TEST_FAILED(tracker, __func__, __LINE__);
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+
+    observed = kmip_deep_copy_name(&ctx, NULL);
+    if(observed != NULL)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    observed = kmip_deep_copy_name(&ctx, &expected);
+    if(observed == NULL)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    if(!kmip_compare_name(&expected, observed))
+    {
+        kmip_print_name(1, &expected);
+        kmip_print_name(1, observed);
+        kmip_free_name(&ctx, observed);
+        ctx.free_func(ctx.state, observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    kmip_free_name(&ctx, observed);
     ctx.free_func(ctx.state, observed);
     kmip_destroy(&ctx);
 
@@ -1462,7 +2604,160 @@ test_deep_copy_attribute(TestTracker *tracker)
         TEST_FAILED(tracker, __func__, __LINE__);
     }
 
-    /* Test deep copying an "empty" attribute. */
+    /* Test deep copying an "empty" attribute. */
+    observed = kmip_deep_copy_attribute(&ctx, &expected);
+    if(observed == NULL)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    if(!kmip_compare_attribute(&expected, observed))
+    {
+        kmip_print_attribute(1, &expected);
+        kmip_print_attribute(1, observed);
+        kmip_free_attribute(&ctx, observed);
+        ctx.free_func(ctx.state, observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    kmip_free_attribute(&ctx, observed);
+    ctx.free_func(ctx.state, observed);
+
+    /* Test deep copying a Unique Identifier attribute. */
+    TextString uuid = {0};
+    uuid.value = "49a1ca88-6bea-4fb2-b450-7e58802c3038";
+    uuid.size = 36;
+    expected.type = KMIP_ATTR_UNIQUE_IDENTIFIER;
+    expected.value = &uuid;
+
+    observed = kmip_deep_copy_attribute(&ctx, &expected);
+    if(observed == NULL)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    if(!kmip_compare_attribute(&expected, observed))
+    {
+        kmip_print_attribute(1, &expected);
+        kmip_print_attribute(1, observed);
+        kmip_free_attribute(&ctx, observed);
+        ctx.free_func(ctx.state, observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    kmip_free_attribute(&ctx, observed);
+    ctx.free_func(ctx.state, observed);
+
+    /* Test deep copying an Operation Policy Name attribute. */
+    TextString policy = {0};
+    policy.value = "default";
+    policy.size = 7;
+    expected.type = KMIP_ATTR_OPERATION_POLICY_NAME;
+    expected.value = &policy;
+
+    observed = kmip_deep_copy_attribute(&ctx, &expected);
+    if(observed == NULL)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    if(!kmip_compare_attribute(&expected, observed))
+    {
+        kmip_print_attribute(1, &expected);
+        kmip_print_attribute(1, observed);
+        kmip_free_attribute(&ctx, observed);
+        ctx.free_func(ctx.state, observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    kmip_free_attribute(&ctx, observed);
+    ctx.free_func(ctx.state, observed);
+
+    /* Test deep copying a Name attribute. */
+    TextString name_value = {0};
+    name_value.value = "example";
+    name_value.size = 7;
+    Name name = {0};
+    name.value = &name_value;
+    name.type = KMIP_NAME_UNINTERPRETED_TEXT_STRING;
+    expected.type = KMIP_ATTR_NAME;
+    expected.value = &name;
+
+    observed = kmip_deep_copy_attribute(&ctx, &expected);
+    if(observed == NULL)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    if(!kmip_compare_attribute(&expected, observed))
+    {
+        kmip_print_attribute(1, &expected);
+        kmip_print_attribute(1, observed);
+        kmip_free_attribute(&ctx, observed);
+        ctx.free_func(ctx.state, observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    kmip_free_attribute(&ctx, observed);
+    ctx.free_func(ctx.state, observed);
+
+    /* Test deep copying an Object Type attribute. */
+    enum object_type object_type = KMIP_OBJTYPE_SYMMETRIC_KEY;
+    expected.type = KMIP_ATTR_OBJECT_TYPE;
+    expected.value = &object_type;
+
+    observed = kmip_deep_copy_attribute(&ctx, &expected);
+    if(observed == NULL)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    if(!kmip_compare_attribute(&expected, observed))
+    {
+        kmip_print_attribute(1, &expected);
+        kmip_print_attribute(1, observed);
+        kmip_free_attribute(&ctx, observed);
+        ctx.free_func(ctx.state, observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    kmip_free_attribute(&ctx, observed);
+    ctx.free_func(ctx.state, observed);
+
+    /* Test deep copying a Cryptographic Algorithm attribute. */
+    enum cryptographic_algorithm cryptographic_algorithm = KMIP_CRYPTOALG_AES;
+    expected.type = KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM;
+    expected.value = &cryptographic_algorithm;
+
+    observed = kmip_deep_copy_attribute(&ctx, &expected);
+    if(observed == NULL)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    if(!kmip_compare_attribute(&expected, observed))
+    {
+        kmip_print_attribute(1, &expected);
+        kmip_print_attribute(1, observed);
+        kmip_free_attribute(&ctx, observed);
+        ctx.free_func(ctx.state, observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    kmip_free_attribute(&ctx, observed);
+    ctx.free_func(ctx.state, observed);
+
+    /* Test deep copying a Cryptographic Length attribute. */
+    int32 cryptographic_length = 256;
+    expected.type = KMIP_ATTR_CRYPTOGRAPHIC_LENGTH;
+    expected.value = &cryptographic_length;
+
     observed = kmip_deep_copy_attribute(&ctx, &expected);
     if(observed == NULL)
     {
@@ -1482,12 +2777,10 @@ test_deep_copy_attribute(TestTracker *tracker)
     kmip_free_attribute(&ctx, observed);
     ctx.free_func(ctx.state, observed);
 
-    /* Test deep copying a Unique Identifier attribute. */
-    TextString uuid = {0};
-    uuid.value = "49a1ca88-6bea-4fb2-b450-7e58802c3038";
-    uuid.size = 36;
-    expected.type = KMIP_ATTR_UNIQUE_IDENTIFIER;
-    expected.value = &uuid;
+    /* Test deep copying a Cryptographic Usage Mask attribute. */
+    int32 cryptographic_usage_mask = KMIP_CRYPTOMASK_ENCRYPT | KMIP_CRYPTOMASK_DECRYPT;
+    expected.type = KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK;
+    expected.value = &cryptographic_usage_mask;
 
     observed = kmip_deep_copy_attribute(&ctx, &expected);
     if(observed == NULL)
@@ -1508,12 +2801,10 @@ test_deep_copy_attribute(TestTracker *tracker)
     kmip_free_attribute(&ctx, observed);
     ctx.free_func(ctx.state, observed);
 
-    /* Test deep copying an Operation Policy Name attribute. */
-    TextString policy = {0};
-    policy.value = "default";
-    policy.size = 7;
-    expected.type = KMIP_ATTR_OPERATION_POLICY_NAME;
-    expected.value = &policy;
+    /* Test deep copying a State attribute. */
+    enum state state = KMIP_STATE_ACTIVE;
+    expected.type = KMIP_ATTR_STATE;
+    expected.value = &state;
 
     observed = kmip_deep_copy_attribute(&ctx, &expected);
     if(observed == NULL)
@@ -1533,157 +2824,557 @@ test_deep_copy_attribute(TestTracker *tracker)
 
     kmip_free_attribute(&ctx, observed);
     ctx.free_func(ctx.state, observed);
+    kmip_destroy(&ctx);
 
-    /* Test deep copying a Name attribute. */
-    TextString name_value = {0};
-    name_value.value = "example";
-    name_value.size = 7;
-    Name name = {0};
-    name.value = &name_value;
-    name.type = KMIP_NAME_UNINTERPRETED_TEXT_STRING;
-    expected.type = KMIP_ATTR_NAME;
-    expected.value = &name;
+    TEST_PASSED(tracker, __func__);
+}
 
-    observed = kmip_deep_copy_attribute(&ctx, &expected);
+int
+test_clone_flat_symmetric_key(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+    
+    if(kmip_clone_flat_symmetric_key(NULL, NULL) != NULL || kmip_clone_flat_symmetric_key(&ctx, NULL) != NULL)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    uint8 key_bytes[16] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F
+    };
+    ByteString key_string = {key_bytes, ARRAY_LENGTH(key_bytes), KMIP_FALSE};
+    TransparentSymmetricKey transparent = {&key_string};
+    
+    TextString name_value = {"example", 7, KMIP_FALSE, KMIP_FALSE};
+    Name name = {&name_value, KMIP_NAME_UNINTERPRETED_TEXT_STRING};
+    int32 length = 128;
+    uint64 activation_date = 1335514341;
+    TextString application_namespace = {"ssl", 3, KMIP_FALSE, KMIP_FALSE};
+    TextString application_data = {"www.example.com", 15, KMIP_FALSE, KMIP_FALSE};
+    ApplicationSpecificInformation information = {&application_namespace, &application_data};
+    
+    Attribute attributes[4] = {0};
+    for(size_t i = 0; i < ARRAY_LENGTH(attributes); i++)
+    {
+        kmip_init_attribute(&attributes[i]);
+    }
+    attributes[0].type = KMIP_ATTR_NAME;
+    attributes[0].value = &name;
+    attributes[1].type = KMIP_ATTR_CRYPTOGRAPHIC_LENGTH;
+    attributes[1].value = &length;
+    attributes[2].type = KMIP_ATTR_ACTIVATION_DATE;
+    attributes[2].value = &activation_date;
+    attributes[3].type = KMIP_ATTR_APPLICATION_SPECIFIC_INFORMATION;
+    attributes[3].value = &information;
+    
+    KeyValue key_value = {0};
+    key_value.key_material = &transparent;
+    key_value.attributes = attributes;
+    key_value.attribute_count = ARRAY_LENGTH(attributes);
+    
+    uint8 iv[8] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    ByteString iv_string = {iv, ARRAY_LENGTH(iv), KMIP_FALSE};
+    TextString wrapping_key_id = {"100182d5-72b8-47aa-8383-4d97d512e98a", 36, KMIP_FALSE, KMIP_FALSE};
+    EncryptionKeyInformation encryption_key_info = {&wrapping_key_id, NULL};
+    KeyWrappingData wrapping_data = {0};
+    kmip_init_schema(&kmip_key_wrapping_data_schema, &wrapping_data);
+    wrapping_data.wrapping_method = KMIP_WRAP_ENCRYPT;
+    wrapping_data.encryption_key_info = &encryption_key_info;
+    wrapping_data.iv_counter_nonce = &iv_string;
+    
+    KeyBlock key_block = {0};
+    kmip_init_key_block(&key_block);
+    key_block.key_format_type = KMIP_KEYFORMAT_TRANS_SYMMETRIC_KEY;
+    key_block.key_value = &key_value;
+    key_block.key_value_type = KMIP_TYPE_STRUCTURE;
+    key_block.cryptographic_algorithm = KMIP_CRYPTOALG_AES;
+    key_block.cryptographic_length = 128;
+    key_block.key_wrapping_data = &wrapping_data;
+    
+    SymmetricKey expected = {&key_block};
+    
+    SymmetricKey *observed = kmip_clone_flat_symmetric_key(&ctx, &expected);
     if(observed == NULL)
     {
         kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-    if(!kmip_compare_attribute(&expected, observed))
+    
+    /* Every node must sit inside the clone, past the caller's tree. */
+    uint8 *low = (uint8 *)observed;
+    uint8 *high = low + kmip_get_flat_clone_size(observed);
+    KeyValue *copied_value = observed->key_block->key_value;
+    TransparentSymmetricKey *copied_material = copied_value->key_material;
+    Name *copied_name = copied_value->attributes[0].value;
+    uint8 *nodes[6] = {
+        (uint8 *)observed->key_block,
+        (uint8 *)copied_value->attributes,
+        copied_material->key->value,
+        (uint8 *)copied_name->value->value,
+        (uint8 *)observed->key_block->key_wrapping_data->encryption_key_info->unique_identifier,
+        observed->key_block->key_wrapping_data->iv_counter_nonce->value
+    };
+    for(size_t i = 0; i < ARRAY_LENGTH(nodes); i++)
+    {
+        if(nodes[i] <= low || nodes[i] >= high)
+        {
+            kmip_free_flat_clone(&ctx, observed);
+            kmip_destroy(&ctx);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+    }
+    
+    if(!kmip_compare_symmetric_key(&expected, observed) || copied_value->attribute_count != ARRAY_LENGTH(attributes) || !copied_name->value->inlined)
+    {
+        kmip_print_symmetric_key(1, &expected);
+        kmip_print_symmetric_key(1, observed);
+        kmip_free_flat_clone(&ctx, observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    kmip_free_flat_clone(&ctx, observed);
+    
+    /* Key material the library cannot walk is refused outright. */
+    key_block.key_format_type = KMIP_KEYFORMAT_TRANS_RSA_PUBLIC_KEY;
+    observed = kmip_clone_flat_symmetric_key(&ctx, &expected);
+    if(observed != NULL)
+    {
+        kmip_free_flat_clone(&ctx, observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    kmip_destroy(&ctx);
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_clone_flat_get_response_payload(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    uint8 encoding[176] = {
+        0x42, 0x00, 0x7C, 0x01, 0x00, 0x00, 0x00, 0xA8,
+        0x42, 0x00, 0x57, 0x05, 0x00, 0x00, 0x00, 0x04,
+        0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+        0x42, 0x00, 0x94, 0x07, 0x00, 0x00, 0x00, 0x24,
+        0x34, 0x39, 0x61, 0x31, 0x63, 0x61, 0x38, 0x38,
+        0x2D, 0x36, 0x62, 0x65, 0x61, 0x2D, 0x34, 0x66,
+        0x62, 0x32, 0x2D, 0x62, 0x34, 0x35, 0x30, 0x2D,
+        0x37, 0x65, 0x35, 0x38, 0x38, 0x30, 0x32, 0x63,
+        0x33, 0x30, 0x33, 0x38, 0x00, 0x00, 0x00, 0x00,
+        0x42, 0x00, 0x8F, 0x01, 0x00, 0x00, 0x00, 0x60,
+        0x42, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x58,
+        0x42, 0x00, 0x42, 0x05, 0x00, 0x00, 0x00, 0x04,
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+        0x42, 0x00, 0x45, 0x01, 0x00, 0x00, 0x00, 0x20,
+        0x42, 0x00, 0x43, 0x08, 0x00, 0x00, 0x00, 0x18,
+        0x73, 0x67, 0x57, 0x80, 0x51, 0x01, 0x2A, 0x6D,
+        0x13, 0x4A, 0x85, 0x5E, 0x25, 0xC8, 0xCD, 0x5E,
+        0x4C, 0xA1, 0x31, 0x45, 0x57, 0x29, 0xD3, 0xC8,
+        0x42, 0x00, 0x28, 0x05, 0x00, 0x00, 0x00, 0x04,
+        0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+        0x42, 0x00, 0x2A, 0x02, 0x00, 0x00, 0x00, 0x04,
+        0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00
+    };
+    
+    KMIPSecureHeap heap = {0};
+    if(kmip_init_secure_heap(&heap, 4096) != KMIP_OK)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    KMIP ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+    ctx.borrow_strings = KMIP_TRUE;
+    ctx.secure_heap = &heap;
+    
+    GetResponsePayload decoded = {0};
+    int result = kmip_decode_get_response_payload(&ctx, &decoded);
+    if(result != KMIP_OK)
+    {
+        kmip_free_get_response_payload(&ctx, &decoded);
+        kmip_destroy(&ctx);
+        kmip_free_secure_heap(&heap);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    GetResponsePayload *observed = kmip_clone_flat_get_response_payload(&ctx, &decoded);
+    
+    /* The clone must outlive both the decoded payload and its buffer. */
+    kmip_free_get_response_payload(&ctx, &decoded);
+    memset(encoding, 0, ARRAY_LENGTH(encoding));
+    
+    TextString uuid = {"49a1ca88-6bea-4fb2-b450-7e58802c3038", 36, KMIP_FALSE, KMIP_FALSE};
+    uint8 value[24] = {
+        0x73, 0x67, 0x57, 0x80, 0x51, 0x01, 0x2A, 0x6D,
+        0x13, 0x4A, 0x85, 0x5E, 0x25, 0xC8, 0xCD, 0x5E,
+        0x4C, 0xA1, 0x31, 0x45, 0x57, 0x29, 0xD3, 0xC8
+    };
+    ByteString v = {value, ARRAY_LENGTH(value), KMIP_FALSE};
+    KeyValue kv = {0};
+    kv.key_material = &v;
+    KeyBlock kb = {0};
+    kb.key_format_type = KMIP_KEYFORMAT_RAW;
+    kb.key_value = &kv;
+    kb.key_value_type = KMIP_TYPE_STRUCTURE;
+    kb.cryptographic_algorithm = KMIP_CRYPTOALG_TRIPLE_DES;
+    kb.cryptographic_length = 168;
+    SymmetricKey key = {&kb};
+    GetResponsePayload expected = {KMIP_OBJTYPE_SYMMETRIC_KEY, &uuid, &key};
+    
+    if(observed == NULL || !kmip_secure_heap_owns(&heap, observed) || observed->unique_identifier->borrowed || !kmip_compare_get_response_payload(&expected, observed))
+    {
+        kmip_print_get_response_payload(1, observed);
+        kmip_free_flat_clone(&ctx, observed);
+        kmip_destroy(&ctx);
+        kmip_free_secure_heap(&heap);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    /* One free returns the whole clone to the heap. */
+    kmip_free_flat_clone(&ctx, observed);
+    if(heap.used != 0)
+    {
+        kmip_destroy(&ctx);
+        kmip_free_secure_heap(&heap);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    kmip_destroy(&ctx);
+    kmip_free_secure_heap(&heap);
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_clone_flat_get_response_payload_survives_arena_reset(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    uint8 encoding[304] = {
+        0x42, 0x00, 0x7B, 0x01, 0x00, 0x00, 0x01, 0x28, 
+        0x42, 0x00, 0x7A, 0x01, 0x00, 0x00, 0x00, 0x48, 
+        0x42, 0x00, 0x69, 0x01, 0x00, 0x00, 0x00, 0x20, 
+        0x42, 0x00, 0x6A, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x6B, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x92, 0x09, 0x00, 0x00, 0x00, 0x08, 
+        0x00, 0x00, 0x00, 0x00, 0x4F, 0x9A, 0x54, 0xE7, 
+        0x42, 0x00, 0x0D, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+        0x42, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x00, 0xD0, 
+        0x42, 0x00, 0x5C, 0x05, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x7F, 0x05, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x7C, 0x01, 0x00, 0x00, 0x00, 0xA8, 
+        0x42, 0x00, 0x57, 0x05, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x94, 0x07, 0x00, 0x00, 0x00, 0x24, 
+        0x34, 0x39, 0x61, 0x31, 0x63, 0x61, 0x38, 0x38, 
+        0x2D, 0x36, 0x62, 0x65, 0x61, 0x2D, 0x34, 0x66, 
+        0x62, 0x32, 0x2D, 0x62, 0x34, 0x35, 0x30, 0x2D, 
+        0x37, 0x65, 0x35, 0x38, 0x38, 0x30, 0x32, 0x63, 
+        0x33, 0x30, 0x33, 0x38, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x8F, 0x01, 0x00, 0x00, 0x00, 0x60, 
+        0x42, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x58, 
+        0x42, 0x00, 0x42, 0x05, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x45, 0x01, 0x00, 0x00, 0x00, 0x20, 
+        0x42, 0x00, 0x43, 0x08, 0x00, 0x00, 0x00, 0x18, 
+        0x73, 0x67, 0x57, 0x80, 0x51, 0x01, 0x2A, 0x6D, 
+        0x13, 0x4A, 0x85, 0x5E, 0x25, 0xC8, 0xCD, 0x5E, 
+        0x4C, 0xA1, 0x31, 0x45, 0x57, 0x29, 0xD3, 0xC8, 
+        0x42, 0x00, 0x28, 0x05, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x2A, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00
+    };
+    
+    uint8 value[24] = {
+        0x73, 0x67, 0x57, 0x80, 0x51, 0x01, 0x2A, 0x6D,
+        0x13, 0x4A, 0x85, 0x5E, 0x25, 0xC8, 0xCD, 0x5E,
+        0x4C, 0xA1, 0x31, 0x45, 0x57, 0x29, 0xD3, 0xC8
+    };
+    
+    KMIPSecureHeap heap = {0};
+    if(kmip_init_secure_heap(&heap, 4096) != KMIP_OK)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    KMIP ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+    
+    KMIPArena arena = {0};
+    kmip_init_arena(&arena, 256);
+    kmip_set_arena(&ctx, &arena);
+    
+    /* The first pass clones into the secure heap, the second into the */
+    /* allocator under the arena. Neither clone may be reset with it.  */
+    for(int pass = 0; pass < 2; pass++)
+    {
+        ctx.secure_heap = (pass == 0) ? &heap : NULL;
+        kmip_rewind(&ctx);
+    
+        ResponseMessage decoded = {0};
+        int result = kmip_decode_response_message(&ctx, &decoded);
+        GetResponsePayload *observed = NULL;
+        if(result == KMIP_OK && decoded.batch_count == 1)
+        {
+            observed = kmip_clone_flat_get_response_payload(&ctx, decoded.batch_items[0].response_payload);
+        }
+        kmip_reset_arena_after_response_message(&ctx, &decoded);
+    
+        if(observed == NULL || kmip_arena_owns(&arena, observed) || (pass == 0 && heap.used == 0))
+        {
+            kmip_free_flat_clone(&ctx, observed);
+            kmip_unset_arena(&ctx);
+            kmip_destroy(&ctx);
+            kmip_free_arena(&arena);
+            kmip_free_secure_heap(&heap);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+    
+        SymmetricKey *key = observed->object;
+        ByteString *material = ((KeyValue *)key->key_block->key_value)->key_material;
+        if(observed->unique_identifier->size != 36 || material->size != ARRAY_LENGTH(value) || memcmp(material->value, value, ARRAY_LENGTH(value)) != 0)
+        {
+            kmip_free_flat_clone(&ctx, observed);
+            kmip_unset_arena(&ctx);
+            kmip_destroy(&ctx);
+            kmip_free_arena(&arena);
+            kmip_free_secure_heap(&heap);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+    
+        /* The clone is still freed through the context with the arena set. */
+        kmip_free_flat_clone(&ctx, observed);
+        if(heap.used != 0)
+        {
+            kmip_unset_arena(&ctx);
+            kmip_destroy(&ctx);
+            kmip_free_arena(&arena);
+            kmip_free_secure_heap(&heap);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+    }
+    
+    kmip_unset_arena(&ctx);
+    kmip_destroy(&ctx);
+    kmip_free_arena(&arena);
+    kmip_free_secure_heap(&heap);
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_set_hash_seed(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    uint8 bytes[4] = {0x01, 0x02, 0x03, 0x04};
+    ByteString value = {bytes, ARRAY_LENGTH(bytes), KMIP_FALSE};
+    
+    uint64 seed = kmip_get_hash_seed();
+    uint64 hash = kmip_hash_byte_string(&value);
+    if(seed == 0 || kmip_get_hash_seed() != seed)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    kmip_set_hash_seed(seed + 1);
+    bool32 reseeded = kmip_get_hash_seed() == seed + 1 && kmip_hash_byte_string(&value) != hash;
+    
+    /* Restore the seed so hashes taken elsewhere stay comparable. */
+    kmip_set_hash_seed(seed);
+    if(!reseeded || kmip_hash_byte_string(&value) != hash)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_hash_cryptographic_parameters(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    CryptographicParameters a = {0};
+    CryptographicParameters b = {0};
+    kmip_init_cryptographic_parameters(&a);
+    kmip_init_cryptographic_parameters(&b);
+    
+    if(kmip_hash_cryptographic_parameters(NULL) != kmip_hash_cryptographic_parameters(NULL) || kmip_hash_cryptographic_parameters(&a) != kmip_hash_cryptographic_parameters(&b))
     {
-        kmip_print_attribute(1, &expected);
-        kmip_print_attribute(1, observed);
-        kmip_free_attribute(&ctx, observed);
-        ctx.free_func(ctx.state, observed);
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-
-    kmip_free_attribute(&ctx, observed);
-    ctx.free_func(ctx.state, observed);
-
-    /* Test deep copying an Object Type attribute. */
-    enum object_type object_type = KMIP_OBJTYPE_SYMMETRIC_KEY;
-    expected.type = KMIP_ATTR_OBJECT_TYPE;
-    expected.value = &object_type;
-
-    observed = kmip_deep_copy_attribute(&ctx, &expected);
-    if(observed == NULL)
+    
+    uint8 nonce_a[4] = {0x01, 0x02, 0x03, 0x04};
+    uint8 nonce_b[4] = {0x01, 0x02, 0x03, 0x04};
+    ByteString iv_a = {nonce_a, ARRAY_LENGTH(nonce_a), KMIP_FALSE};
+    ByteString iv_b = {nonce_b, ARRAY_LENGTH(nonce_b), KMIP_FALSE};
+    a.block_cipher_mode = KMIP_BLOCK_CBC;
+    a.p_source = &iv_a;
+    b.block_cipher_mode = KMIP_BLOCK_CBC;
+    b.p_source = &iv_b;
+    
+    if(!kmip_compare_cryptographic_parameters(&a, &b) || kmip_hash_cryptographic_parameters(&a) != kmip_hash_cryptographic_parameters(&b))
     {
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-    if(!kmip_compare_attribute(&expected, observed))
+    
+    nonce_b[3] = 0x05;
+    if(kmip_compare_cryptographic_parameters(&a, &b) || kmip_hash_cryptographic_parameters(&a) == kmip_hash_cryptographic_parameters(&b))
     {
-        kmip_print_attribute(1, &expected);
-        kmip_print_attribute(1, observed);
-        kmip_free_attribute(&ctx, observed);
-        ctx.free_func(ctx.state, observed);
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
+    
+    TEST_PASSED(tracker, __func__);
+}
 
-    kmip_free_attribute(&ctx, observed);
-    ctx.free_func(ctx.state, observed);
-
-    /* Test deep copying a Cryptographic Algorithm attribute. */
-    enum cryptographic_algorithm cryptographic_algorithm = KMIP_CRYPTOALG_AES;
-    expected.type = KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM;
-    expected.value = &cryptographic_algorithm;
-
-    observed = kmip_deep_copy_attribute(&ctx, &expected);
-    if(observed == NULL)
+int
+test_hash_template_attribute(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    /* Two copies of the same template, sharing no memory. */
+    char name_chars[2][8] = {"example", "example"};
+    TextString name_values[2] = {{0}};
+    Name names[2] = {{0}};
+    int32 lengths[2] = {256, 256};
+    int32 algorithms[2] = {KMIP_CRYPTOALG_AES, KMIP_CRYPTOALG_AES};
+    Attribute attributes[2][2] = {{{0}}};
+    TemplateAttribute templates[2] = {{0}};
+    for(size_t i = 0; i < 2; i++)
+    {
+        name_values[i].value = name_chars[i];
+        name_values[i].size = 7;
+        names[i].value = &name_values[i];
+        names[i].type = KMIP_NAME_UNINTERPRETED_TEXT_STRING;
+    
+        kmip_init_attribute(&attributes[i][0]);
+        attributes[i][0].type = KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM;
+        attributes[i][0].value = &algorithms[i];
+        kmip_init_attribute(&attributes[i][1]);
+        attributes[i][1].type = KMIP_ATTR_CRYPTOGRAPHIC_LENGTH;
+        attributes[i][1].value = &lengths[i];
+    
+        templates[i].names = &names[i];
+        templates[i].name_count = 1;
+        templates[i].attributes = attributes[i];
+        templates[i].attribute_count = 2;
+    }
+    
+    if(!kmip_compare_template_attribute(&templates[0], &templates[1]) || kmip_hash_template_attribute(&templates[0]) != kmip_hash_template_attribute(&templates[1]))
     {
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-    if(!kmip_compare_attribute(&expected, observed))
+    
+    if(kmip_hash_attribute(&attributes[0][0]) == kmip_hash_attribute(&attributes[0][1]))
     {
-        kmip_print_attribute(1, &expected);
-        kmip_print_attribute(1, observed);
-        kmip_free_attribute(&ctx, observed);
-        ctx.free_func(ctx.state, observed);
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-
-    kmip_free_attribute(&ctx, observed);
-    ctx.free_func(ctx.state, observed);
-
-    /* Test deep copying a Cryptographic Length attribute. */
-    int32 cryptographic_length = 256;
-    expected.type = KMIP_ATTR_CRYPTOGRAPHIC_LENGTH;
-    expected.value = &cryptographic_length;
-
-    observed = kmip_deep_copy_attribute(&ctx, &expected);
-    if(observed == NULL)
+    
+    lengths[1] = 128;
+    if(kmip_compare_template_attribute(&templates[0], &templates[1]) || kmip_hash_template_attribute(&templates[0]) == kmip_hash_template_attribute(&templates[1]))
     {
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-    if(!kmip_compare_attribute(&expected, observed))
+    
+    lengths[1] = 256;
+    name_chars[1][0] = 'E';
+    if(kmip_compare_template_attribute(&templates[0], &templates[1]) || kmip_hash_template_attribute(&templates[0]) == kmip_hash_template_attribute(&templates[1]))
     {
-        kmip_print_attribute(1, &expected);
-        kmip_print_attribute(1, observed);
-        kmip_free_attribute(&ctx, observed);
-        ctx.free_func(ctx.state, observed);
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
+    
+    TEST_PASSED(tracker, __func__);
+}
 
-    kmip_free_attribute(&ctx, observed);
-    ctx.free_func(ctx.state, observed);
-
-    /* Test deep copying a Cryptographic Usage Mask attribute. */
-    int32 cryptographic_usage_mask = KMIP_CRYPTOMASK_ENCRYPT | KMIP_CRYPTOMASK_DECRYPT;
-    expected.type = KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK;
-    expected.value = &cryptographic_usage_mask;
-
-    observed = kmip_deep_copy_attribute(&ctx, &expected);
-    if(observed == NULL)
+int
+test_hash_request_message(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    /* Two copies of the same Create request, sharing no memory. */
+    TextString usernames[2] = {{"Fred", 4, KMIP_FALSE, KMIP_FALSE}, {"Fred", 4, KMIP_FALSE, KMIP_FALSE}};
+    TextString passwords[2] = {{"password1", 9, KMIP_FALSE, KMIP_FALSE}, {"password1", 9, KMIP_FALSE, KMIP_FALSE}};
+    UsernamePasswordCredential values[2] = {{0}};
+    Credential credentials[2] = {{0}};
+    Authentication authentications[2] = {{0}};
+    ProtocolVersion versions[2] = {{0}};
+    RequestHeader headers[2] = {{0}};
+    int32 lengths[2] = {128, 128};
+    Attribute attributes[2] = {{0}};
+    TemplateAttribute templates[2] = {{0}};
+    CreateRequestPayload payloads[2] = {{0}};
+    RequestBatchItem items[2] = {{0}};
+    RequestMessage messages[2] = {{0}};
+    for(size_t i = 0; i < 2; i++)
+    {
+        values[i].username = &usernames[i];
+        values[i].password = &passwords[i];
+        credentials[i].credential_type = KMIP_CRED_USERNAME_AND_PASSWORD;
+        credentials[i].credential_value = &values[i];
+        authentications[i].credential = &credentials[i];
+    
+        kmip_init_protocol_version(&versions[i], KMIP_1_0);
+        kmip_init_request_header(&headers[i]);
+        headers[i].protocol_version = &versions[i];
+        headers[i].authentication = &authentications[i];
+        headers[i].batch_count = 1;
+    
+        kmip_init_attribute(&attributes[i]);
+        attributes[i].type = KMIP_ATTR_CRYPTOGRAPHIC_LENGTH;
+        attributes[i].value = &lengths[i];
+        templates[i].attributes = &attributes[i];
+        templates[i].attribute_count = 1;
+        payloads[i].object_type = KMIP_OBJTYPE_SYMMETRIC_KEY;
+        payloads[i].template_attribute = &templates[i];
+    
+        kmip_init_request_batch_item(&items[i]);
+        items[i].operation = KMIP_OP_CREATE;
+        items[i].request_payload = &payloads[i];
+    
+        messages[i].request_header = &headers[i];
+        messages[i].batch_items = &items[i];
+        messages[i].batch_count = 1;
+    }
+    
+    if(!kmip_compare_request_message(&messages[0], &messages[1]) || kmip_hash_request_message(&messages[0]) != kmip_hash_request_message(&messages[1]))
     {
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-    if(!kmip_compare_attribute(&expected, observed))
+    
+    /* A change anywhere in the tree changes the hash. */
+    headers[1].time_stamp = 1335514341;
+    if(kmip_compare_request_message(&messages[0], &messages[1]) || kmip_hash_request_message(&messages[0]) == kmip_hash_request_message(&messages[1]))
     {
-        kmip_print_attribute(1, &expected);
-        kmip_print_attribute(1, observed);
-        kmip_free_attribute(&ctx, observed);
-        ctx.free_func(ctx.state, observed);
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-
-    kmip_free_attribute(&ctx, observed);
-    ctx.free_func(ctx.state, observed);
-
-    /* Test deep copying a State attribute. */
-    enum state state = KMIP_STATE_ACTIVE;
-    expected.type = KMIP_ATTR_STATE;
-    expected.value = &state;
-
-    observed = kmip_deep_copy_attribute(&ctx, &expected);
-    if(observed == NULL)
+    
+    headers[1].time_stamp = headers[0].time_stamp;
+    lengths[1] = 256;
+    if(kmip_compare_request_message(&messages[0], &messages[1]) || kmip_hash_request_message(&messages[0]) == kmip_hash_request_message(&messages[1]))
     {
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-    if(!kmip_compare_attribute(&expected, observed))
+    
+    lengths[1] = lengths[0];
+    passwords[1].size = 8;
+    if(kmip_compare_request_message(&messages[0], &messages[1]) || kmip_hash_request_message(&messages[0]) == kmip_hash_request_message(&messages[1]))
     {
-        kmip_print_attribute(1, &expected);
-        kmip_print_attribute(1, observed);
-        kmip_free_attribute(&ctx, observed);
-        ctx.free_func(ctx.state, observed);
-        kmip_destroy(&ctx);
         TEST_FAILED(tracker, __func__, __LINE__);
     }
-
-    kmip_free_attribute(&ctx, observed);
-    ctx.free_func(ctx.state, observed);
-    kmip_destroy(&ctx);
-
+    
     TEST_PASSED(tracker, __func__);
 }
 
@@ -2107,20 +3798,176 @@ test_encode_date_time(TestTracker *tracker)
         0x00, 0x00, 0x00, 0x00, 0x47, 0xDA, 0x67, 0xF8
     };
     
-    uint8 observed[16] = {0};
+    uint8 observed[16] = {0};
+    struct kmip ctx = {0};
+    kmip_init(&ctx, observed, ARRAY_LENGTH(observed), KMIP_1_0);
+    
+    int result = kmip_encode_date_time(&ctx, KMIP_TAG_DEFAULT, 1205495800);
+    result = report_encoding_test_result(
+        tracker,
+        &ctx,
+        expected,
+        observed,
+        result,
+        __func__);
+    kmip_destroy(&ctx);
+    return(result);
+}
+
+int
+test_decode_text_string_borrowed(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    uint8 encoding[24] = {
+        0x42, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0B,
+        0x48, 0x65, 0x6C, 0x6C, 0x6F, 0x20, 0x57, 0x6F,
+        0x72, 0x6C, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    
+    struct kmip ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+    ctx.borrow_strings = KMIP_TRUE;
+
+    struct text_string expected = {0};
+    expected.value = "Hello World";
+    expected.size = 11;
+    struct text_string observed = {0};
+    
+    int result = kmip_decode_text_string(&ctx, KMIP_TAG_DEFAULT, &observed);
+    int comparison = kmip_compare_text_string(&expected, &observed);
+    comparison = comparison && observed.borrowed == KMIP_TRUE;
+    comparison = comparison && (uint8 *)observed.value == &encoding[8];
+    result = report_decoding_test_result(
+        tracker,
+        &ctx,
+        comparison,
+        result,
+        __func__);
+    kmip_free_text_string(&ctx, &observed);
+    kmip_destroy(&ctx);
+    return(result);
+}
+
+int
+test_decode_new_text_string_inline(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    uint8 encoding[24] = {
+        0x42, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0B,
+        0x48, 0x65, 0x6C, 0x6C, 0x6F, 0x20, 0x57, 0x6F,
+        0x72, 0x6C, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    
+    /* A value one byte longer than the inline capacity. */
+    uint8 long_encoding[8 + KMIP_TEXT_STRING_INLINE_CAPACITY + 8] = {0};
+    long_encoding[0] = 0x42;
+    long_encoding[3] = 0x07;
+    long_encoding[7] = KMIP_TEXT_STRING_INLINE_CAPACITY + 1;
+    for(size_t i = 0; i <= KMIP_TEXT_STRING_INLINE_CAPACITY; i++)
+    {
+        long_encoding[8 + i] = 'A';
+    }
+    
+    struct kmip ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+
+    struct text_string expected = {0};
+    expected.value = "Hello World";
+    expected.size = 11;
+    struct text_string *observed = NULL;
+    
+    int result = kmip_decode_new_text_string(&ctx, KMIP_TAG_DEFAULT, &observed, "TextString");
+    int comparison = kmip_compare_text_string(&expected, observed);
+    comparison = comparison && observed->inlined == KMIP_TRUE;
+    comparison = comparison && observed->value == (char *)(observed + 1);
+    
+    struct text_string *copy = kmip_deep_copy_text_string(&ctx, observed);
+    comparison = comparison && kmip_compare_text_string(observed, copy);
+    comparison = comparison && copy->inlined == KMIP_TRUE;
+    kmip_free_text_string(&ctx, copy);
+    ctx.free_func(ctx.state, copy);
+    kmip_free_text_string(&ctx, observed);
+    ctx.free_func(ctx.state, observed);
+    observed = NULL;
+    
+    if(result == KMIP_OK && comparison)
+    {
+        kmip_set_buffer(&ctx, long_encoding, ARRAY_LENGTH(long_encoding));
+        result = kmip_decode_new_text_string(&ctx, KMIP_TAG_DEFAULT, &observed, "TextString");
+        comparison = observed != NULL && observed->inlined == KMIP_FALSE;
+        comparison = comparison && observed->size == KMIP_TEXT_STRING_INLINE_CAPACITY + 1;
+        comparison = comparison && observed->value[KMIP_TEXT_STRING_INLINE_CAPACITY] == 'A';
+        kmip_free_text_string(&ctx, observed);
+        ctx.free_func(ctx.state, observed);
+    }
+    
+    result = report_decoding_test_result(
+        tracker,
+        &ctx,
+        comparison,
+        result,
+        __func__);
+    kmip_destroy(&ctx);
+    return(result);
+}
+
+int
+test_decode_byte_string_borrowed(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    uint8 encoding[16] = {
+        0x42, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03,
+        0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    
+    struct kmip ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+    ctx.borrow_strings = KMIP_TRUE;
+
+    uint8 str[3] = {0x01, 0x02, 0x03};
+    
+    struct byte_string expected = {0};
+    expected.value = str;
+    expected.size = 3;
+    struct byte_string observed = {0};
+    
+    int result = kmip_decode_byte_string(&ctx, KMIP_TAG_DEFAULT, &observed);
+    int comparison = kmip_compare_byte_string(&expected, &observed);
+    comparison = comparison && observed.borrowed == KMIP_TRUE;
+    comparison = comparison && observed.value == &encoding[8];
+    result = report_decoding_test_result(
+        tracker,
+        &ctx,
+        comparison,
+        result,
+        __func__);
+    kmip_free_byte_string(&ctx, &observed);
+    kmip_destroy(&ctx);
+    return(result);
+}
+
+int
+test_decode_byte_string_padding_mismatch(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    uint8 encoding[16] = {
+        0x42, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03,
+        0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00
+    };
+    
     struct kmip ctx = {0};
-    kmip_init(&ctx, observed, ARRAY_LENGTH(observed), KMIP_1_0);
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+
+    struct byte_string observed = {0};
     
-    int result = kmip_encode_date_time(&ctx, KMIP_TAG_DEFAULT, 1205495800);
-    result = report_encoding_test_result(
-        tracker,
-        &ctx,
-        expected,
-        observed,
-        result,
-        __func__);
+    int result = kmip_decode_byte_string(&ctx, KMIP_TAG_DEFAULT, &observed);
+    kmip_free_byte_string(&ctx, &observed);
     kmip_destroy(&ctx);
-    return(result);
+    return(report_result(tracker, result, KMIP_PADDING_MISMATCH, __func__));
 }
 
 int
@@ -2317,20 +4164,12 @@ test_encode_protection_storage_masks(TestTracker *tracker)
     KMIP ctx = {0};
     kmip_init(&ctx, observed, ARRAY_LENGTH(observed), KMIP_2_0);
 
-    LinkedList list = {0};
-    LinkedListItem item_1 = {0};
     int32 mask_1 = 0x3FFF;
-    item_1.data = &mask_1;
-
-    LinkedListItem item_2 = {0};
     int32 mask_2 = 0x0003;
-    item_2.data = &mask_2;
-
-    kmip_linked_list_enqueue(&list, &item_1);
-    kmip_linked_list_enqueue(&list, &item_2);
 
     ProtectionStorageMasks psm = {0};
-    psm.masks = &list;
+    kmip_vector_append(&ctx, &psm.masks, &mask_1);
+    kmip_vector_append(&ctx, &psm.masks, &mask_2);
 
     int result = kmip_encode_protection_storage_masks(&ctx, &psm);
     result = report_encoding_test_result(tracker, &ctx, expected, observed, result, __func__);
@@ -2377,20 +4216,12 @@ test_decode_protection_storage_masks(TestTracker *tracker)
     KMIP ctx = {0};
     kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_2_0);
 
-    LinkedList list = {0};
-    LinkedListItem item_1 = {0};
     int32 mask_1 = 0x3FFF;
-    item_1.data = &mask_1;
-
-    LinkedListItem item_2 = {0};
     int32 mask_2 = 0x0003;
-    item_2.data = &mask_2;
-
-    kmip_linked_list_enqueue(&list, &item_1);
-    kmip_linked_list_enqueue(&list, &item_2);
 
     ProtectionStorageMasks expected = {0};
-    expected.masks = &list;
+    kmip_vector_append(&ctx, &expected.masks, &mask_1);
+    kmip_vector_append(&ctx, &expected.masks, &mask_2);
 
     ProtectionStorageMasks observed = {0};
     int result = kmip_decode_protection_storage_masks(&ctx, &observed);
@@ -3275,6 +5106,124 @@ test_decode_attribute_state(TestTracker *tracker)
     return(result);
 }
 
+int
+test_encode_attribute_activation_date(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    uint8 expected[48] = {
+        0x42, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x28,
+        0x42, 0x00, 0x0A, 0x07, 0x00, 0x00, 0x00, 0x0F,
+        0x41, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69,
+        0x6F, 0x6E, 0x20, 0x44, 0x61, 0x74, 0x65, 0x00,
+        0x42, 0x00, 0x0B, 0x09, 0x00, 0x00, 0x00, 0x08,
+        0x00, 0x00, 0x00, 0x00, 0x47, 0xDA, 0x67, 0xF8
+    };
+    
+    uint8 observed[48] = {0};
+    struct kmip ctx = {0};
+    kmip_init(&ctx, observed, ARRAY_LENGTH(observed), KMIP_1_0);
+    
+    uint64 d = 1205495800;
+    struct attribute attr = {0};
+    kmip_init_attribute(&attr);
+    
+    attr.type = KMIP_ATTR_ACTIVATION_DATE;
+    attr.value = &d;
+    
+    int result = kmip_encode_attribute(&ctx, &attr);
+    result = report_encoding_test_result(
+        tracker,
+        &ctx,
+        expected,
+        observed,
+        result,
+        __func__);
+    kmip_destroy(&ctx);
+    return(result);
+}
+
+int
+test_decode_attribute_activation_date(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    uint8 encoding[48] = {
+        0x42, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x28,
+        0x42, 0x00, 0x0A, 0x07, 0x00, 0x00, 0x00, 0x0F,
+        0x41, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x69,
+        0x6F, 0x6E, 0x20, 0x44, 0x61, 0x74, 0x65, 0x00,
+        0x42, 0x00, 0x0B, 0x09, 0x00, 0x00, 0x00, 0x08,
+        0x00, 0x00, 0x00, 0x00, 0x47, 0xDA, 0x67, 0xF8
+    };
+    
+    struct kmip ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+    
+    uint64 d = 1205495800;
+    struct attribute expected = {0};
+    kmip_init_attribute(&expected);
+    expected.type = KMIP_ATTR_ACTIVATION_DATE;
+    expected.value = &d;
+    struct attribute observed = {0};
+    kmip_init_attribute(&observed);
+    
+    int result = kmip_decode_attribute(&ctx, &observed);
+    result = report_decoding_test_result(
+        tracker,
+        &ctx,
+        kmip_compare_attribute(&expected, &observed),
+        result,
+        __func__);
+    kmip_free_attribute(&ctx, &observed);
+    kmip_destroy(&ctx);
+    return(result);
+}
+
+int
+test_attribute_name_round_trip(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    uint8 encoding[48] = {0};
+    
+    struct kmip ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_4);
+    
+    for(int i = KMIP_ATTR_UNIQUE_IDENTIFIER; i <= KMIP_ATTR_NEVER_EXTRACTABLE; i++)
+    {
+        enum attribute_type observed = KMIP_UNSET;
+        
+        kmip_rewind(&ctx);
+        int result = kmip_encode_attribute_name(&ctx, i);
+        if(result != KMIP_OK ||
+           (size_t)(ctx.index - ctx.buffer) != kmip_size_attribute_name(&ctx, i))
+        {
+            kmip_destroy(&ctx);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+        
+        kmip_rewind(&ctx);
+        result = kmip_decode_attribute_name(&ctx, &observed);
+        if(result != KMIP_OK || (int)observed != i)
+        {
+            kmip_destroy(&ctx);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+    }
+    
+    if(kmip_get_attribute_type("Unknown Attribute", 17) != KMIP_UNSET ||
+       kmip_get_attribute_type("Always Sensitivx", 16) != KMIP_UNSET ||
+       kmip_get_attribute_name(KMIP_ATTR_NEVER_EXTRACTABLE + 1, NULL) != NULL)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    kmip_destroy(&ctx);
+    TEST_PASSED(tracker, __func__);
+}
+
 int
 test_encode_protocol_version(TestTracker *tracker)
 {
@@ -5651,26 +7600,15 @@ test_encode_create_request_payload_kmip_2_0(TestTracker *tracker)
     a[2].value = &mask;
     
     Attributes attributes = {0};
-    LinkedList list = {0};
-    LinkedListItem item_1, item_2, item_3 = {0};
-    item_1.data = &a[0];
-    item_2.data = &a[1];
-    item_3.data = &a[2];
-    kmip_linked_list_enqueue(&list, &item_1);
-    kmip_linked_list_enqueue(&list, &item_2);
-    kmip_linked_list_enqueue(&list, &item_3);
-    attributes.attribute_list = &list;
+    kmip_vector_append(&ctx, &attributes.attribute_list, &a[0]);
+    kmip_vector_append(&ctx, &attributes.attribute_list, &a[1]);
+    kmip_vector_append(&ctx, &attributes.attribute_list, &a[2]);
 
     ProtectionStorageMasks psm = {0};
-    LinkedList masks = {0};
-    LinkedListItem mask_1, mask_2 = {0};
     int32 m1 = KMIP_PROTECT_SOFTWARE | KMIP_PROTECT_ON_SYSTEM;
     int32 m2 = KMIP_PROTECT_OFF_SYSTEM | KMIP_PROTECT_OFF_PREMISES;
-    mask_1.data = &m1;
-    mask_2.data = &m2;
-    kmip_linked_list_enqueue(&masks, &mask_1);
-    kmip_linked_list_enqueue(&masks, &mask_2);
-    psm.masks = &masks;
+    kmip_vector_append(&ctx, &psm.masks, &m1);
+    kmip_vector_append(&ctx, &psm.masks, &m2);
 
     CreateRequestPayload payload = {0};
     payload.object_type = KMIP_OBJTYPE_SYMMETRIC_KEY;
@@ -5686,7 +7624,279 @@ test_encode_create_request_payload_kmip_2_0(TestTracker *tracker)
         result,
         __func__);
     kmip_destroy(&ctx);
-    return(result);
+    return(result);
+}
+
+int
+test_encode_create_request_payload_with_fragment(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    Attribute a[3] = {0};
+    for(int i = 0; i < 3; i++)
+    {
+        kmip_init_attribute(&a[i]);
+    }
+    
+    enum cryptographic_algorithm algorithm = KMIP_CRYPTOALG_AES;
+    a[0].type = KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM;
+    a[0].value = &algorithm;
+    
+    int32 length = 256;
+    a[1].type = KMIP_ATTR_CRYPTOGRAPHIC_LENGTH;
+    a[1].value = &length;
+    
+    int32 mask = KMIP_CRYPTOMASK_ENCRYPT | KMIP_CRYPTOMASK_DECRYPT;
+    a[2].type = KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK;
+    a[2].value = &mask;
+    
+    TemplateAttribute ta = {0};
+    ta.attributes = a;
+    ta.attribute_count = ARRAY_LENGTH(a);
+    
+    /* The fragment-only template carries no attributes of its own. */
+    KMIPFragment fragment = {0};
+    TemplateAttribute pre_encoded = {0};
+    pre_encoded.fragment = &fragment;
+    
+    CreateRequestPayload crp = {0};
+    crp.object_type = KMIP_OBJTYPE_SYMMETRIC_KEY;
+    
+    enum kmip_version versions[2] = {KMIP_1_0, KMIP_2_0};
+    for(size_t v = 0; v < ARRAY_LENGTH(versions); v++)
+    {
+        uint8 expected[256] = {0};
+        uint8 observed[256] = {0};
+        KMIP ctx = {0};
+        kmip_init(&ctx, expected, ARRAY_LENGTH(expected), versions[v]);
+    
+        crp.template_attribute = &ta;
+        int result = kmip_encode_create_request_payload(&ctx, &crp);
+        size_t expected_size = ctx.index - ctx.buffer;
+    
+        kmip_free_fragment(&ctx, &fragment);
+        if(result == KMIP_OK)
+        {
+            result = kmip_build_template_attribute_fragment(&ctx, &ta, &fragment);
+        }
+    
+        kmip_set_buffer(&ctx, observed, ARRAY_LENGTH(observed));
+        crp.template_attribute = &pre_encoded;
+        if(result == KMIP_OK)
+        {
+            result = kmip_encode_create_request_payload(&ctx, &crp);
+        }
+    
+        if(result != KMIP_OK || (size_t)(ctx.index - ctx.buffer) != expected_size || memcmp(expected, observed, expected_size) != 0 || kmip_size_create_request_payload(&ctx, &crp) != expected_size)
+        {
+            kmip_print_stack_trace(&ctx);
+            kmip_free_fragment(&ctx, &fragment);
+            kmip_destroy(&ctx);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+    
+        kmip_destroy(&ctx);
+    }
+    
+    /* A fragment only splices into messages of the version it was built for. */
+    KMIP ctx = {0};
+    uint8 observed[256] = {0};
+    kmip_init(&ctx, observed, ARRAY_LENGTH(observed), KMIP_1_4);
+    int result = kmip_encode_template_attribute_as_attributes(&ctx, &pre_encoded);
+    if(result != KMIP_INVALID_FOR_VERSION)
+    {
+        kmip_free_fragment(&ctx, &fragment);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    result = kmip_encode_template_attribute(&ctx, &pre_encoded);
+    kmip_free_fragment(&ctx, &fragment);
+    kmip_destroy(&ctx);
+    if(result != KMIP_TAG_MISMATCH || fragment.encoding != NULL)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_encode_authentication_with_fragment(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    TextString username = {"Fred", 4, KMIP_FALSE, KMIP_FALSE};
+    TextString password = {"password1", 9, KMIP_FALSE, KMIP_FALSE};
+    UsernamePasswordCredential upc = {&username, &password};
+    Credential credential = {KMIP_CRED_USERNAME_AND_PASSWORD, &upc};
+    Authentication auth = {0};
+    auth.credential = &credential;
+    
+    uint8 expected[128] = {0};
+    uint8 observed[128] = {0};
+    KMIP ctx = {0};
+    kmip_init(&ctx, expected, ARRAY_LENGTH(expected), KMIP_1_0);
+    
+    int result = kmip_encode_authentication(&ctx, &auth);
+    size_t expected_size = ctx.index - ctx.buffer;
+    
+    KMIPFragment fragment = {0};
+    if(result == KMIP_OK)
+    {
+        result = kmip_build_authentication_fragment(&ctx, &auth, &fragment);
+    }
+    
+    if(result != KMIP_OK || fragment.size != expected_size || fragment.tag != KMIP_TAG_AUTHENTICATION || !fragment.sensitive || ctx.buffer != expected)
+    {
+        kmip_free_fragment(&ctx, &fragment);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    Authentication pre_encoded = {0};
+    pre_encoded.fragment = &fragment;
+    kmip_set_buffer(&ctx, observed, ARRAY_LENGTH(observed));
+    result = kmip_encode_authentication(&ctx, &pre_encoded);
+    
+    if(result != KMIP_OK || (size_t)(ctx.index - ctx.buffer) != expected_size || memcmp(expected, observed, expected_size) != 0 || kmip_size_authentication(&ctx, &pre_encoded) != expected_size)
+    {
+        kmip_free_fragment(&ctx, &fragment);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    kmip_free_fragment(&ctx, &fragment);
+    kmip_destroy(&ctx);
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_build_template_attribute_fragment_survives_arena_reset(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    Attribute a[2] = {0};
+    for(size_t i = 0; i < ARRAY_LENGTH(a); i++)
+    {
+        kmip_init_attribute(&a[i]);
+    }
+    
+    enum cryptographic_algorithm algorithm = KMIP_CRYPTOALG_AES;
+    a[0].type = KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM;
+    a[0].value = &algorithm;
+    
+    int32 length = 256;
+    a[1].type = KMIP_ATTR_CRYPTOGRAPHIC_LENGTH;
+    a[1].value = &length;
+    
+    TemplateAttribute ta = {0};
+    ta.attributes = a;
+    ta.attribute_count = ARRAY_LENGTH(a);
+    
+    uint8 expected[128] = {0};
+    KMIP ctx = {0};
+    kmip_init(&ctx, expected, ARRAY_LENGTH(expected), KMIP_1_0);
+    int result = kmip_encode_template_attribute(&ctx, &ta);
+    size_t expected_size = ctx.index - ctx.buffer;
+    
+    KMIPArena arena = {0};
+    kmip_init_arena(&arena, 256);
+    kmip_set_arena(&ctx, &arena);
+    
+    /* The fragment comes from the allocator beneath the arena. */
+    KMIPFragment fragment = {0};
+    if(result == KMIP_OK)
+    {
+        result = kmip_build_template_attribute_fragment(&ctx, &ta, &fragment);
+    }
+    kmip_reset_arena(&arena);
+    
+    if(result != KMIP_OK || kmip_arena_owns(&arena, fragment.encoding) || fragment.size != expected_size || memcmp(fragment.encoding, expected, expected_size) != 0)
+    {
+        kmip_free_fragment(&ctx, &fragment);
+        kmip_unset_arena(&ctx);
+        kmip_destroy(&ctx);
+        kmip_free_arena(&arena);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    kmip_free_fragment(&ctx, &fragment);
+    kmip_unset_arena(&ctx);
+    kmip_destroy(&ctx);
+    kmip_free_arena(&arena);
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_build_authentication_fragment_survives_arena_reset(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    TextString username = {"Fred", 4, KMIP_FALSE, KMIP_FALSE};
+    TextString password = {"password1", 9, KMIP_FALSE, KMIP_FALSE};
+    UsernamePasswordCredential upc = {&username, &password};
+    Credential credential = {KMIP_CRED_USERNAME_AND_PASSWORD, &upc};
+    Authentication auth = {0};
+    auth.credential = &credential;
+    
+    uint8 expected[128] = {0};
+    KMIP ctx = {0};
+    kmip_init(&ctx, expected, ARRAY_LENGTH(expected), KMIP_1_0);
+    int result = kmip_encode_authentication(&ctx, &auth);
+    size_t expected_size = ctx.index - ctx.buffer;
+    
+    KMIPSecureHeap heap = {0};
+    if(result != KMIP_OK || kmip_init_secure_heap(&heap, 4096) != KMIP_OK)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    ctx.secure_heap = &heap;
+    
+    KMIPArena arena = {0};
+    kmip_init_arena(&arena, 256);
+    kmip_set_arena(&ctx, &arena);
+    
+    /* Credentials go to the secure heap but are not the arena's secrets. */
+    KMIPFragment fragment = {0};
+    result = kmip_build_authentication_fragment(&ctx, &auth, &fragment);
+    if(result != KMIP_OK || !kmip_secure_heap_owns(&heap, fragment.encoding) || arena.secrets != NULL)
+    {
+        kmip_free_fragment(&ctx, &fragment);
+        kmip_unset_arena(&ctx);
+        kmip_destroy(&ctx);
+        kmip_free_arena(&arena);
+        kmip_free_secure_heap(&heap);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    kmip_reset_arena(&arena);
+    if(heap.used == 0 || fragment.size != expected_size || memcmp(fragment.encoding, expected, expected_size) != 0)
+    {
+        kmip_free_fragment(&ctx, &fragment);
+        kmip_unset_arena(&ctx);
+        kmip_destroy(&ctx);
+        kmip_free_arena(&arena);
+        kmip_free_secure_heap(&heap);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    kmip_free_fragment(&ctx, &fragment);
+    if(heap.used != 0)
+    {
+        kmip_unset_arena(&ctx);
+        kmip_destroy(&ctx);
+        kmip_free_arena(&arena);
+        kmip_free_secure_heap(&heap);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    kmip_unset_arena(&ctx);
+    kmip_destroy(&ctx);
+    kmip_free_arena(&arena);
+    kmip_free_secure_heap(&heap);
+    TEST_PASSED(tracker, __func__);
 }
 
 int
@@ -5821,26 +8031,15 @@ test_decode_create_request_payload_kmip_2_0(TestTracker *tracker)
     a[2].value = &mask;
     
     Attributes attributes = {0};
-    LinkedList list = {0};
-    LinkedListItem item_1, item_2, item_3 = {0};
-    item_1.data = &a[0];
-    item_2.data = &a[1];
-    item_3.data = &a[2];
-    kmip_linked_list_enqueue(&list, &item_1);
-    kmip_linked_list_enqueue(&list, &item_2);
-    kmip_linked_list_enqueue(&list, &item_3);
-    attributes.attribute_list = &list;
+    kmip_vector_append(&ctx, &attributes.attribute_list, &a[0]);
+    kmip_vector_append(&ctx, &attributes.attribute_list, &a[1]);
+    kmip_vector_append(&ctx, &attributes.attribute_list, &a[2]);
 
     ProtectionStorageMasks psm = {0};
-    LinkedList masks = {0};
-    LinkedListItem mask_1, mask_2 = {0};
     int32 m1 = KMIP_PROTECT_SOFTWARE | KMIP_PROTECT_ON_SYSTEM;
     int32 m2 = KMIP_PROTECT_OFF_SYSTEM | KMIP_PROTECT_OFF_PREMISES;
-    mask_1.data = &m1;
-    mask_2.data = &m2;
-    kmip_linked_list_enqueue(&masks, &mask_1);
-    kmip_linked_list_enqueue(&masks, &mask_2);
-    psm.masks = &masks;
+    kmip_vector_append(&ctx, &psm.masks, &m1);
+    kmip_vector_append(&ctx, &psm.masks, &m2);
 
     CreateRequestPayload expected = {0};
     expected.object_type = KMIP_OBJTYPE_SYMMETRIC_KEY;
@@ -6645,6 +8844,60 @@ test_decode_username_password_credential(TestTracker *tracker)
     return(result);
 }
 
+size_t wiped_byte_count = 0;
+
+void *
+count_wiped_bytes(void *ptr, int value, size_t size)
+{
+    wiped_byte_count += size;
+    return(memset(ptr, value, size));
+}
+
+int
+test_free_username_password_credential_wipes_password(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    uint8 encoding[48] = {
+        0x42, 0x00, 0x25, 0x01, 0x00, 0x00, 0x00, 0x28, 
+        0x42, 0x00, 0x99, 0x07, 0x00, 0x00, 0x00, 0x04, 
+        0x46, 0x72, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0xA1, 0x07, 0x00, 0x00, 0x00, 0x09, 
+        0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 
+        0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    
+    struct kmip ctx = {0};
+    ctx.memset_func = &count_wiped_bytes;
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+    
+    struct username_password_credential observed = {0};
+    int result = kmip_decode_username_password_credential(&ctx, &observed);
+    if(result != KMIP_OK)
+    {
+        kmip_free_username_password_credential(&ctx, &observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    /* Only the password is sensitive; the username is released as is. */
+    wiped_byte_count = 0;
+    kmip_free_username_password_credential(&ctx, &observed);
+#if defined(KMIP_WIPE_ALL)
+    size_t expected = 4 + 9;
+#else
+    size_t expected = 9;
+#endif
+    if(wiped_byte_count != expected || observed.username != NULL || observed.password != NULL)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    kmip_destroy(&ctx);
+    TEST_PASSED(tracker, __func__);
+}
+
 int
 test_encode_credential_username_password_credential(TestTracker *tracker)
 {
@@ -6722,127 +8975,475 @@ test_decode_credential_username_password_credential(TestTracker *tracker)
     upc.username = &username;
     upc.password = &password;
     
-    struct credential expected = {0};
-    expected.credential_type = KMIP_CRED_USERNAME_AND_PASSWORD;
-    expected.credential_value = &upc;
-
-    struct credential observed = {0};
+    struct credential expected = {0};
+    expected.credential_type = KMIP_CRED_USERNAME_AND_PASSWORD;
+    expected.credential_value = &upc;
+
+    struct credential observed = {0};
+    
+    int result = kmip_decode_credential(&ctx, &observed);
+    result = report_decoding_test_result(
+        tracker,
+        &ctx,
+        kmip_compare_credential(&expected, &observed),
+        result,
+        __func__);
+    kmip_free_credential(&ctx, &observed);
+    kmip_destroy(&ctx);
+    return(result);
+}
+
+int
+test_encode_authentication_username_password_credential(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    uint8 expected[80] = {
+        0x42, 0x00, 0x0C, 0x01, 0x00, 0x00, 0x00, 0x48, 
+        0x42, 0x00, 0x23, 0x01, 0x00, 0x00, 0x00, 0x40, 
+        0x42, 0x00, 0x24, 0x05, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x25, 0x01, 0x00, 0x00, 0x00, 0x28, 
+        0x42, 0x00, 0x99, 0x07, 0x00, 0x00, 0x00, 0x04, 
+        0x46, 0x72, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0xA1, 0x07, 0x00, 0x00, 0x00, 0x09, 
+        0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 
+        0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    
+    uint8 observed[80] = {0};
+    struct kmip ctx = {0};
+    kmip_init(&ctx, observed, ARRAY_LENGTH(observed), KMIP_1_0);
+    
+    struct text_string username = {0};
+    username.value = "Fred";
+    username.size = 4;
+    struct text_string password = {0};
+    password.value = "password1";
+    password.size = 9;
+    
+    struct username_password_credential upc = {0};
+    upc.username = &username;
+    upc.password = &password;
+    
+    struct credential c = {0};
+    c.credential_type = KMIP_CRED_USERNAME_AND_PASSWORD;
+    c.credential_value = &upc;
+    
+    struct authentication a = {0};
+    a.credential = &c;
+    
+    int result = kmip_encode_authentication(&ctx, &a);
+    result = report_encoding_test_result(
+        tracker,
+        &ctx,
+        expected,
+        observed,
+        result,
+        __func__);
+    kmip_destroy(&ctx);
+    return(result);
+}
+
+int
+test_decode_authentication_username_password_credential(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    uint8 encoding[80] = {
+        0x42, 0x00, 0x0C, 0x01, 0x00, 0x00, 0x00, 0x48, 
+        0x42, 0x00, 0x23, 0x01, 0x00, 0x00, 0x00, 0x40, 
+        0x42, 0x00, 0x24, 0x05, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x25, 0x01, 0x00, 0x00, 0x00, 0x28, 
+        0x42, 0x00, 0x99, 0x07, 0x00, 0x00, 0x00, 0x04, 
+        0x46, 0x72, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0xA1, 0x07, 0x00, 0x00, 0x00, 0x09, 
+        0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 
+        0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    
+    struct kmip ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+    
+    struct text_string username = {0};
+    username.value = "Fred";
+    username.size = 4;
+    struct text_string password = {0};
+    password.value = "password1";
+    password.size = 9;
+    
+    struct username_password_credential upc = {0};
+    upc.username = &username;
+    upc.password = &password;
+    
+    struct credential c = {0};
+    c.credential_type = KMIP_CRED_USERNAME_AND_PASSWORD;
+    c.credential_value = &upc;
+    
+    struct authentication expected = {0};
+    expected.credential = &c;
+    
+    struct authentication observed = {0};
+    
+    int result = kmip_decode_authentication(&ctx, &observed);
+    result = report_decoding_test_result(
+        tracker,
+        &ctx,
+        kmip_compare_authentication(&expected, &observed),
+        result,
+        __func__);
+    kmip_free_authentication(&ctx, &observed);
+    kmip_destroy(&ctx);
+    return(result);
+}
+
+int
+test_compare_template_attribute_with_fragment(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    enum cryptographic_algorithm algorithms[3] = {KMIP_CRYPTOALG_AES, KMIP_CRYPTOALG_RSA, KMIP_CRYPTOALG_AES};
+    Attribute attributes[3] = {{0}};
+    TemplateAttribute templates[3] = {{0}};
+    KMIPFragment fragments[3] = {{0}};
+    TemplateAttribute pre_encoded[3] = {{0}};
+    
+    uint8 buffer[64] = {0};
+    KMIP ctx = {0};
+    kmip_init(&ctx, buffer, ARRAY_LENGTH(buffer), KMIP_1_0);
+    
+    int result = KMIP_OK;
+    for(size_t i = 0; i < ARRAY_LENGTH(templates) && result == KMIP_OK; i++)
+    {
+        kmip_init_attribute(&attributes[i]);
+        attributes[i].type = KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM;
+        attributes[i].value = &algorithms[i];
+        templates[i].attributes = &attributes[i];
+        templates[i].attribute_count = 1;
+    
+        result = kmip_build_template_attribute_fragment(&ctx, &templates[i], &fragments[i]);
+        pre_encoded[i].fragment = &fragments[i];
+    }
+    
+    /* Otherwise empty templates differ only in their fragments. */
+    bool32 different = kmip_compare_template_attribute(&pre_encoded[0], &pre_encoded[1]) || kmip_hash_template_attribute(&pre_encoded[0]) == kmip_hash_template_attribute(&pre_encoded[1]);
+    bool32 same = kmip_compare_template_attribute(&pre_encoded[0], &pre_encoded[2]) && kmip_hash_template_attribute(&pre_encoded[0]) == kmip_hash_template_attribute(&pre_encoded[2]);
+    bool32 expanded = kmip_compare_template_attribute(&pre_encoded[0], &templates[0]);
+    
+    for(size_t i = 0; i < ARRAY_LENGTH(fragments); i++)
+    {
+        kmip_free_fragment(&ctx, &fragments[i]);
+    }
+    kmip_destroy(&ctx);
+    
+    if(result != KMIP_OK || different || !same || expanded)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_compare_authentication_with_fragment(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    TextString username = {"Fred", 4, KMIP_FALSE, KMIP_FALSE};
+    TextString passwords[2] = {{"password1", 9, KMIP_FALSE, KMIP_FALSE}, {"password2", 9, KMIP_FALSE, KMIP_FALSE}};
+    UsernamePasswordCredential values[2] = {{&username, &passwords[0]}, {&username, &passwords[1]}};
+    Credential credentials[2] = {{KMIP_CRED_USERNAME_AND_PASSWORD, &values[0]}, {KMIP_CRED_USERNAME_AND_PASSWORD, &values[1]}};
+    Authentication authentications[2] = {{0}};
+    KMIPFragment fragments[2] = {{0}};
+    Authentication pre_encoded[2] = {{0}};
+    
+    uint8 buffer[64] = {0};
+    KMIP ctx = {0};
+    kmip_init(&ctx, buffer, ARRAY_LENGTH(buffer), KMIP_1_0);
+    
+    int result = KMIP_OK;
+    for(size_t i = 0; i < ARRAY_LENGTH(authentications) && result == KMIP_OK; i++)
+    {
+        authentications[i].credential = &credentials[i];
+        result = kmip_build_authentication_fragment(&ctx, &authentications[i], &fragments[i]);
+        pre_encoded[i].fragment = &fragments[i];
+    }
+    
+    bool32 different = kmip_compare_authentication(&pre_encoded[0], &pre_encoded[1]) || kmip_hash_authentication(&pre_encoded[0]) == kmip_hash_authentication(&pre_encoded[1]);
+    
+    for(size_t i = 0; i < ARRAY_LENGTH(fragments); i++)
+    {
+        kmip_free_fragment(&ctx, &fragments[i]);
+    }
+    kmip_destroy(&ctx);
+    
+    if(result != KMIP_OK || different)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_patch_request_template(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    TextString username = {"Fred", 4, KMIP_FALSE, KMIP_FALSE};
+    TextString password = {"password1", 9, KMIP_FALSE, KMIP_FALSE};
+    UsernamePasswordCredential upc = {&username, &password};
+    Credential credential = {KMIP_CRED_USERNAME_AND_PASSWORD, &upc};
+    Authentication auth = {0};
+    auth.credential = &credential;
+    
+    ProtocolVersion pv = {0};
+    kmip_init_protocol_version(&pv, KMIP_1_0);
+    RequestHeader rh = {0};
+    kmip_init_request_header(&rh);
+    rh.protocol_version = &pv;
+    rh.authentication = &auth;
+    rh.time_stamp = 1335514341;
+    rh.batch_count = 1;
+    
+    TextString uuid = {"49a1ca88-6bea-4fb2-b450-7e58802c3038", 36, KMIP_FALSE, KMIP_FALSE};
+    GetRequestPayload grp = {0};
+    grp.unique_identifier = &uuid;
+    
+    uint8 id[4] = {0x00, 0x00, 0x00, 0x01};
+    ByteString batch_id = {id, ARRAY_LENGTH(id), KMIP_FALSE};
+    RequestBatchItem rbi = {0};
+    kmip_init_request_batch_item(&rbi);
+    rbi.operation = KMIP_OP_GET;
+    rbi.unique_batch_item_id = &batch_id;
+    rbi.request_payload = &grp;
+    
+    RequestMessage rm = {0};
+    rm.request_header = &rh;
+    rm.batch_items = &rbi;
+    rm.batch_count = 1;
+    
+    uint8 expected[512] = {0};
+    KMIP ctx = {0};
+    kmip_init(&ctx, expected, ARRAY_LENGTH(expected), KMIP_1_0);
+    
+    KMIPRequestTemplate template = {0};
+    int result = kmip_init_request_template(&ctx, &template, &rm);
+    if(result != KMIP_OK || ctx.buffer != expected || ctx.index != expected)
+    {
+        kmip_free_request_template(&ctx, &template);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    /* Shrink, grow past the original capacity and grow within padding. */
+    char *uuids[3] = {"1", "0123456789abcdef0123456789abcdef0123456789", "0123456789abcdef0123456789abcdef01234567890"};
+    uint8 ids[3][6] = {{0x07}, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06}, {0xFF, 0xFE}};
+    size_t id_sizes[3] = {1, 6, 2};
+    for(size_t i = 0; i < ARRAY_LENGTH(uuids); i++)
+    {
+        uuid.value = uuids[i];
+        uuid.size = strlen(uuids[i]);
+        batch_id.value = ids[i];
+        batch_id.size = id_sizes[i];
+        rh.time_stamp += i + 1;
+    
+        result = kmip_set_template_unique_identifier(&ctx, &template, &uuid);
+        if(result == KMIP_OK)
+        {
+            result = kmip_set_template_time_stamp(&ctx, &template, rh.time_stamp);
+        }
+        if(result == KMIP_OK)
+        {
+            result = kmip_set_template_batch_item_id(&ctx, &template, &batch_id);
+        }
+    
+        kmip_reset(&ctx);
+        if(result == KMIP_OK)
+        {
+            result = kmip_encode_request_message(&ctx, &rm);
+        }
+    
+        size_t expected_size = ctx.index - ctx.buffer;
+        if(result != KMIP_OK || template.size != expected_size || memcmp(expected, template.encoding, expected_size) != 0)
+        {
+            kmip_print_stack_trace(&ctx);
+            kmip_free_request_template(&ctx, &template);
+            kmip_destroy(&ctx);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+    }
     
-    int result = kmip_decode_credential(&ctx, &observed);
-    result = report_decoding_test_result(
-        tracker,
-        &ctx,
-        kmip_compare_credential(&expected, &observed),
-        result,
-        __func__);
-    kmip_free_credential(&ctx, &observed);
+    /* The patched template still decodes to the current message. */
+    RequestMessage decoded = {0};
+    kmip_set_buffer(&ctx, template.encoding, template.size);
+    result = kmip_decode_request_message(&ctx, &decoded);
+    bool32 same = (result == KMIP_OK) && kmip_compare_request_message(&rm, &decoded);
+    kmip_free_request_message(&ctx, &decoded);
+    kmip_free_request_template(&ctx, &template);
     kmip_destroy(&ctx);
-    return(result);
+    if(!same || template.encoding != NULL)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    TEST_PASSED(tracker, __func__);
 }
 
 int
-test_encode_authentication_username_password_credential(TestTracker *tracker)
+test_patch_request_template_survives_arena_reset(TestTracker *tracker)
 {
     TRACK_TEST(tracker);
-
-    uint8 expected[80] = {
-        0x42, 0x00, 0x0C, 0x01, 0x00, 0x00, 0x00, 0x48, 
-        0x42, 0x00, 0x23, 0x01, 0x00, 0x00, 0x00, 0x40, 
-        0x42, 0x00, 0x24, 0x05, 0x00, 0x00, 0x00, 0x04, 
-        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-        0x42, 0x00, 0x25, 0x01, 0x00, 0x00, 0x00, 0x28, 
-        0x42, 0x00, 0x99, 0x07, 0x00, 0x00, 0x00, 0x04, 
-        0x46, 0x72, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 
-        0x42, 0x00, 0xA1, 0x07, 0x00, 0x00, 0x00, 0x09, 
-        0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 
-        0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    };
     
-    uint8 observed[80] = {0};
-    struct kmip ctx = {0};
-    kmip_init(&ctx, observed, ARRAY_LENGTH(observed), KMIP_1_0);
+    TextString username = {"Fred", 4, KMIP_FALSE, KMIP_FALSE};
+    TextString password = {"password1", 9, KMIP_FALSE, KMIP_FALSE};
+    UsernamePasswordCredential upc = {&username, &password};
+    Credential credential = {KMIP_CRED_USERNAME_AND_PASSWORD, &upc};
+    Authentication auth = {0};
+    auth.credential = &credential;
     
-    struct text_string username = {0};
-    username.value = "Fred";
-    username.size = 4;
-    struct text_string password = {0};
-    password.value = "password1";
-    password.size = 9;
+    ProtocolVersion pv = {0};
+    kmip_init_protocol_version(&pv, KMIP_1_0);
+    RequestHeader rh = {0};
+    kmip_init_request_header(&rh);
+    rh.protocol_version = &pv;
+    rh.authentication = &auth;
+    rh.batch_count = 1;
     
-    struct username_password_credential upc = {0};
-    upc.username = &username;
-    upc.password = &password;
+    TextString uuid = {"1", 1, KMIP_FALSE, KMIP_FALSE};
+    GetRequestPayload grp = {0};
+    grp.unique_identifier = &uuid;
     
-    struct credential c = {0};
-    c.credential_type = KMIP_CRED_USERNAME_AND_PASSWORD;
-    c.credential_value = &upc;
+    RequestBatchItem rbi = {0};
+    kmip_init_request_batch_item(&rbi);
+    rbi.operation = KMIP_OP_GET;
+    rbi.request_payload = &grp;
     
-    struct authentication a = {0};
-    a.credential = &c;
+    RequestMessage rm = {0};
+    rm.request_header = &rh;
+    rm.batch_items = &rbi;
+    rm.batch_count = 1;
     
-    int result = kmip_encode_authentication(&ctx, &a);
-    result = report_encoding_test_result(
-        tracker,
-        &ctx,
-        expected,
-        observed,
-        result,
-        __func__);
+    KMIPSecureHeap heap = {0};
+    if(kmip_init_secure_heap(&heap, 4096) != KMIP_OK)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    uint8 expected[512] = {0};
+    KMIP ctx = {0};
+    kmip_init(&ctx, expected, ARRAY_LENGTH(expected), KMIP_1_0);
+    
+    KMIPArena arena = {0};
+    kmip_init_arena(&arena, 256);
+    kmip_set_arena(&ctx, &arena);
+    
+    /* The first pass keeps the credentials in the secure heap, the */
+    /* second in the allocator beneath the arena.                   */
+    for(int pass = 0; pass < 2; pass++)
+    {
+        ctx.secure_heap = (pass == 0) ? &heap : NULL;
+        uuid.value = "1";
+        uuid.size = 1;
+    
+        KMIPRequestTemplate template = {0};
+        int result = kmip_init_request_template(&ctx, &template, &rm);
+        kmip_reset_arena(&arena);
+    
+        /* Growing past the capacity moves the template to a new block. */
+        uuid.value = "49a1ca88-6bea-4fb2-b450-7e58802c3038";
+        uuid.size = 36;
+        if(result == KMIP_OK)
+        {
+            result = kmip_set_template_unique_identifier(&ctx, &template, &uuid);
+        }
+        kmip_reset_arena(&arena);
+    
+        kmip_reset(&ctx);
+        if(result == KMIP_OK)
+        {
+            result = kmip_encode_request_message(&ctx, &rm);
+        }
+    
+        size_t expected_size = ctx.index - ctx.buffer;
+        bool32 placed = (pass == 0) ? kmip_secure_heap_owns(&heap, template.encoding) : !kmip_arena_owns(&arena, template.encoding);
+        if(result != KMIP_OK || !template.sensitive || !placed || template.size != expected_size || memcmp(expected, template.encoding, expected_size) != 0)
+        {
+            kmip_free_request_template(&ctx, &template);
+            kmip_unset_arena(&ctx);
+            kmip_destroy(&ctx);
+            kmip_free_arena(&arena);
+            kmip_free_secure_heap(&heap);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+    
+        kmip_free_request_template(&ctx, &template);
+        if(heap.used != 0)
+        {
+            kmip_unset_arena(&ctx);
+            kmip_destroy(&ctx);
+            kmip_free_arena(&arena);
+            kmip_free_secure_heap(&heap);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+    }
+    
+    kmip_unset_arena(&ctx);
     kmip_destroy(&ctx);
-    return(result);
+    kmip_free_arena(&arena);
+    kmip_free_secure_heap(&heap);
+    TEST_PASSED(tracker, __func__);
 }
 
 int
-test_decode_authentication_username_password_credential(TestTracker *tracker)
+test_patch_request_template_missing_slot(TestTracker *tracker)
 {
     TRACK_TEST(tracker);
-
-    uint8 encoding[80] = {
-        0x42, 0x00, 0x0C, 0x01, 0x00, 0x00, 0x00, 0x48, 
-        0x42, 0x00, 0x23, 0x01, 0x00, 0x00, 0x00, 0x40, 
-        0x42, 0x00, 0x24, 0x05, 0x00, 0x00, 0x00, 0x04, 
-        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-        0x42, 0x00, 0x25, 0x01, 0x00, 0x00, 0x00, 0x28, 
-        0x42, 0x00, 0x99, 0x07, 0x00, 0x00, 0x00, 0x04, 
-        0x46, 0x72, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 
-        0x42, 0x00, 0xA1, 0x07, 0x00, 0x00, 0x00, 0x09, 
-        0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 
-        0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-    };
     
-    struct kmip ctx = {0};
-    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+    ProtocolVersion pv = {0};
+    kmip_init_protocol_version(&pv, KMIP_1_0);
+    RequestHeader rh = {0};
+    kmip_init_request_header(&rh);
+    rh.protocol_version = &pv;
+    rh.batch_count = 1;
     
-    struct text_string username = {0};
-    username.value = "Fred";
-    username.size = 4;
-    struct text_string password = {0};
-    password.value = "password1";
-    password.size = 9;
+    TextString uuid = {"1", 1, KMIP_FALSE, KMIP_FALSE};
+    DestroyRequestPayload drp = {0};
+    drp.unique_identifier = &uuid;
     
-    struct username_password_credential upc = {0};
-    upc.username = &username;
-    upc.password = &password;
+    RequestBatchItem rbi = {0};
+    kmip_init_request_batch_item(&rbi);
+    rbi.operation = KMIP_OP_DESTROY;
+    rbi.request_payload = &drp;
     
-    struct credential c = {0};
-    c.credential_type = KMIP_CRED_USERNAME_AND_PASSWORD;
-    c.credential_value = &upc;
+    RequestMessage rm = {0};
+    rm.request_header = &rh;
+    rm.batch_items = &rbi;
+    rm.batch_count = 1;
     
-    struct authentication expected = {0};
-    expected.credential = &c;
+    uint8 buffer[256] = {0};
+    KMIP ctx = {0};
+    kmip_init(&ctx, buffer, ARRAY_LENGTH(buffer), KMIP_1_0);
     
-    struct authentication observed = {0};
+    /* Neither a time stamp nor a batch item id was encoded. */
+    KMIPRequestTemplate template = {0};
+    int result = kmip_init_request_template(&ctx, &template, &rm);
+    size_t size = template.size;
+    if(result == KMIP_OK)
+    {
+        result = kmip_set_template_time_stamp(&ctx, &template, 1335514341);
+    }
     
-    int result = kmip_decode_authentication(&ctx, &observed);
-    result = report_decoding_test_result(
-        tracker,
-        &ctx,
-        kmip_compare_authentication(&expected, &observed),
-        result,
-        __func__);
-    kmip_free_authentication(&ctx, &observed);
+    bool32 slots = template.slots[KMIP_TEMPLATE_SLOT_UNIQUE_IDENTIFIER].present && !template.slots[KMIP_TEMPLATE_SLOT_UNIQUE_BATCH_ITEM_ID].present;
+    kmip_free_request_template(&ctx, &template);
     kmip_destroy(&ctx);
-    return(result);
+    if(result != KMIP_INVALID_FIELD || !slots || size == 0)
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    TEST_PASSED(tracker, __func__);
 }
 
 int
@@ -7720,10 +10321,275 @@ test_encode_response_message_get(TestTracker *tracker)
     result = report_encoding_test_result(
         tracker,
         &ctx,
-        expected,
-        observed,
+        expected,
+        observed,
+        result,
+        __func__);
+    kmip_destroy(&ctx);
+    return(result);
+}
+
+int
+test_decode_response_message_many_batch_items(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    /* Enough batch items to grow the decoded array more than once. */
+    ProtocolVersion pv = {0};
+    kmip_init_protocol_version(&pv, KMIP_1_0);
+
+    ResponseHeader rh = {0};
+    kmip_init_response_header(&rh);
+    rh.protocol_version = &pv;
+    rh.time_stamp = 1335514343;
+    rh.batch_count = 9;
+
+    TextString uuid = {0};
+    uuid.value = "1";
+    uuid.size = 1;
+
+    DestroyResponsePayload drp = {0};
+    drp.unique_identifier = &uuid;
+
+    ResponseBatchItem rbi[9] = {{0}};
+    for(size_t i = 0; i < ARRAY_LENGTH(rbi); i++)
+    {
+        rbi[i].operation = KMIP_OP_DESTROY;
+        rbi[i].result_status = KMIP_STATUS_SUCCESS;
+        rbi[i].response_payload = &drp;
+    }
+
+    ResponseMessage expected = {0};
+    expected.response_header = &rh;
+    expected.batch_items = rbi;
+    expected.batch_count = ARRAY_LENGTH(rbi);
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+
+    int result = kmip_set_own_buffer(&ctx, 64);
+    if(result == KMIP_OK)
+    {
+        result = kmip_encode_response_message(&ctx, &expected);
+    }
+    if(result != KMIP_OK)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    kmip_rewind(&ctx);
+
+    ResponseMessage observed = {0};
+    result = kmip_decode_response_message(&ctx, &observed);
+    result = report_decoding_test_result(
+        tracker,
+        &ctx,
+        kmip_compare_response_message(&expected, &observed),
+        result,
+        __func__);
+    kmip_free_response_message(&ctx, &observed);
+    kmip_destroy(&ctx);
+    return(result);
+}
+
+int
+test_decode_response_message_with_arena(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    ProtocolVersion pv = {0};
+    kmip_init_protocol_version(&pv, KMIP_1_0);
+
+    ResponseHeader rh = {0};
+    kmip_init_response_header(&rh);
+    rh.protocol_version = &pv;
+    rh.time_stamp = 1335514343;
+    rh.batch_count = 9;
+
+    TextString uuid = {0};
+    uuid.value = "1";
+    uuid.size = 1;
+
+    DestroyResponsePayload drp = {0};
+    drp.unique_identifier = &uuid;
+
+    ResponseBatchItem rbi[9] = {{0}};
+    for(size_t i = 0; i < ARRAY_LENGTH(rbi); i++)
+    {
+        rbi[i].operation = KMIP_OP_DESTROY;
+        rbi[i].result_status = KMIP_STATUS_SUCCESS;
+        rbi[i].response_payload = &drp;
+    }
+
+    ResponseMessage expected = {0};
+    expected.response_header = &rh;
+    expected.batch_items = rbi;
+    expected.batch_count = ARRAY_LENGTH(rbi);
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+
+    int result = kmip_set_own_buffer(&ctx, 64);
+    if(result == KMIP_OK)
+    {
+        result = kmip_encode_response_message(&ctx, &expected);
+    }
+    if(result != KMIP_OK)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    KMIPArena arena = {0};
+    kmip_init_arena(&arena, 256);
+    kmip_set_arena(&ctx, &arena);
+
+    /* Decode twice; the second pass reuses the wiped arena chunk. */
+    for(int pass = 0; pass < 2; pass++)
+    {
+        kmip_rewind(&ctx);
+
+        ResponseMessage observed = {0};
+        result = kmip_decode_response_message(&ctx, &observed);
+        if(result != KMIP_OK ||
+           !kmip_compare_response_message(&expected, &observed) ||
+           !kmip_arena_owns(&arena, observed.batch_items) ||
+           !kmip_arena_owns(&arena, observed.batch_items[8].response_payload))
+        {
+            kmip_reset_arena_after_response_message(&ctx, &observed);
+            kmip_unset_arena(&ctx);
+            kmip_destroy(&ctx);
+            kmip_free_arena(&arena);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+
+        kmip_reset_arena_after_response_message(&ctx, &observed);
+        if(observed.batch_items != NULL || arena.chunks->used != 0 || arena.chunks->next != NULL)
+        {
+            kmip_unset_arena(&ctx);
+            kmip_destroy(&ctx);
+            kmip_free_arena(&arena);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+    }
+
+    /* The context's own buffer was allocated outside the arena. */
+    kmip_unset_arena(&ctx);
+    kmip_destroy(&ctx);
+    kmip_free_arena(&arena);
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_decode_response_message_lazy_payloads(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    ProtocolVersion pv = {0};
+    kmip_init_protocol_version(&pv, KMIP_1_0);
+
+    ResponseHeader rh = {0};
+    kmip_init_response_header(&rh);
+    rh.protocol_version = &pv;
+    rh.time_stamp = 1335514343;
+    rh.batch_count = 3;
+
+    TextString uuids[3] = {{0}};
+    DestroyResponsePayload drp[3] = {{0}};
+    ResponseBatchItem rbi[3] = {{0}};
+    for(size_t i = 0; i < ARRAY_LENGTH(rbi); i++)
+    {
+        uuids[i].value = (i == 0) ? "1" : (i == 1) ? "2" : "3";
+        uuids[i].size = 1;
+        drp[i].unique_identifier = &uuids[i];
+        rbi[i].operation = KMIP_OP_DESTROY;
+        rbi[i].result_status = KMIP_STATUS_SUCCESS;
+        rbi[i].response_payload = &drp[i];
+    }
+
+    ResponseMessage expected = {0};
+    expected.response_header = &rh;
+    expected.batch_items = rbi;
+    expected.batch_count = ARRAY_LENGTH(rbi);
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+
+    int result = kmip_set_own_buffer(&ctx, 256);
+    if(result == KMIP_OK)
+    {
+        result = kmip_encode_response_message(&ctx, &expected);
+    }
+    if(result != KMIP_OK)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    kmip_rewind(&ctx);
+    ctx.lazy_payloads = KMIP_TRUE;
+
+    ResponseMessage observed = {0};
+    result = kmip_decode_response_message(&ctx, &observed);
+    if(result != KMIP_OK || observed.batch_count != 3)
+    {
+        kmip_free_response_message(&ctx, &observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    /* Status fields are decoded, payloads are left pending. */
+    for(size_t i = 0; i < observed.batch_count; i++)
+    {
+        ResponseBatchItem *item = &observed.batch_items[i];
+        if(item->result_status != KMIP_STATUS_SUCCESS || item->response_payload != NULL || item->payload_size == 0)
+        {
+            kmip_free_response_message(&ctx, &observed);
+            kmip_destroy(&ctx);
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+    }
+
+    void *payload = NULL;
+    result = kmip_response_item_payload(&ctx, &observed, 1, &payload);
+    if(result != KMIP_OK || !kmip_compare_destroy_response_payload(&drp[1], payload) || observed.batch_items[0].response_payload != NULL)
+    {
+        kmip_free_response_message(&ctx, &observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    /* A payload is decoded only once. */
+    void *again = NULL;
+    result = kmip_response_item_payload(&ctx, &observed, 1, &again);
+    if(result != KMIP_OK || again != payload)
+    {
+        kmip_free_response_message(&ctx, &observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    result = kmip_response_item_payload(&ctx, &observed, 3, &again);
+    if(result != KMIP_ARG_INVALID)
+    {
+        kmip_free_response_message(&ctx, &observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    result = kmip_response_item_payload(&ctx, &observed, 0, &payload);
+    if(result == KMIP_OK)
+    {
+        result = kmip_response_item_payload(&ctx, &observed, 2, &payload);
+    }
+    result = report_decoding_test_result(
+        tracker,
+        &ctx,
+        kmip_compare_response_message(&expected, &observed),
         result,
         __func__);
+    kmip_free_response_message(&ctx, &observed);
     kmip_destroy(&ctx);
     return(result);
 }
@@ -7866,29 +10732,21 @@ test_encode_attributes(TestTracker *tracker)
     struct kmip ctx = {0};
     kmip_init(&ctx, observed, ARRAY_LENGTH(observed), KMIP_2_0);
 
-    LinkedList attribute_list = {0};
-
-    LinkedListItem item_1 = {0};
     Attribute attr_1 = {0};
     kmip_init_attribute(&attr_1);
     enum cryptographic_algorithm algorithm = KMIP_CRYPTOALG_AES;
     attr_1.type = KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM;
     attr_1.value = &algorithm;
-    item_1.data = &attr_1;
 
-    LinkedListItem item_2 = {0};
     Attribute attr_2 = {0};
     kmip_init_attribute(&attr_2);
     int32 length = 128;
     attr_2.type = KMIP_ATTR_CRYPTOGRAPHIC_LENGTH;
     attr_2.value = &length;
-    item_2.data = &attr_2;
-
-    kmip_linked_list_enqueue(&attribute_list, &item_1);
-    kmip_linked_list_enqueue(&attribute_list, &item_2);
 
     Attributes attributes = {0};
-    attributes.attribute_list = &attribute_list;
+    kmip_vector_append(&ctx, &attributes.attribute_list, &attr_1);
+    kmip_vector_append(&ctx, &attributes.attribute_list, &attr_2);
 
     int result = kmip_encode_attributes(&ctx, &attributes);
     result = report_encoding_test_result(tracker, &ctx, expected, observed, result, __func__);
@@ -8299,29 +11157,21 @@ test_decode_attributes(TestTracker *tracker)
     KMIP ctx = {0};
     kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_2_0);
 
-    LinkedList attribute_list = {0};
-
-    LinkedListItem item_1 = {0};
     Attribute attr_1 = {0};
     kmip_init_attribute(&attr_1);
     enum cryptographic_algorithm algorithm = KMIP_CRYPTOALG_AES;
     attr_1.type = KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM;
     attr_1.value = &algorithm;
-    item_1.data = &attr_1;
 
-    LinkedListItem item_2 = {0};
     Attribute attr_2 = {0};
     kmip_init_attribute(&attr_2);
     int32 length = 128;
     attr_2.type = KMIP_ATTR_CRYPTOGRAPHIC_LENGTH;
     attr_2.value = &length;
-    item_2.data = &attr_2;
-
-    kmip_linked_list_enqueue(&attribute_list, &item_1);
-    kmip_linked_list_enqueue(&attribute_list, &item_2);
 
     Attributes expected = {0};
-    expected.attribute_list = &attribute_list;
+    kmip_vector_append(&ctx, &expected.attribute_list, &attr_1);
+    kmip_vector_append(&ctx, &expected.attribute_list, &attr_2);
 
     Attributes observed = {0};
     int result = kmip_decode_attributes(&ctx, &observed);
@@ -8339,6 +11189,82 @@ test_decode_attributes(TestTracker *tracker)
     return(result);
 }
 
+int
+test_find_attribute(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    /* This encoding matches the following set of values:
+    *  Attributes
+    *      Cryptographic Algorithm - AES
+    *      Cryptographic Length - 128
+    */
+    uint8 encoding[40] = {
+        0x42, 0x01, 0x25, 0x01, 0x00, 0x00, 0x00, 0x20,
+        0x42, 0x00, 0x28, 0x05, 0x00, 0x00, 0x00, 0x04,
+        0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+        0x42, 0x00, 0x2A, 0x02, 0x00, 0x00, 0x00, 0x04,
+        0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00
+    };
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_2_0);
+
+    Attributes observed = {0};
+    int result = kmip_decode_attributes(&ctx, &observed);
+    if(result != KMIP_OK || observed.index.count != 2)
+    {
+        kmip_free_attributes(&ctx, &observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    const Attribute *length = kmip_find_attribute(&observed, KMIP_ATTR_CRYPTOGRAPHIC_LENGTH, 0);
+    if(length == NULL || *(int32 *)length->value != 128)
+    {
+        kmip_free_attributes(&ctx, &observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(kmip_find_attribute(&observed, KMIP_ATTR_CRYPTOGRAPHIC_LENGTH, 1) != NULL ||
+       kmip_find_attribute(&observed, KMIP_ATTR_STATE, 0) != NULL)
+    {
+        kmip_free_attributes(&ctx, &observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    /* An attribute added after decoding is still found. */
+    Attribute *state = ctx.calloc_func(ctx.state, 1, sizeof(Attribute));
+    int32 *state_value = ctx.calloc_func(ctx.state, 1, sizeof(int32));
+    if(state == NULL || state_value == NULL)
+    {
+        ctx.free_func(ctx.state, state);
+        ctx.free_func(ctx.state, state_value);
+        kmip_free_attributes(&ctx, &observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    *state_value = KMIP_STATE_ACTIVE;
+    state->type = KMIP_ATTR_STATE;
+    state->index = KMIP_UNSET;
+    state->value = state_value;
+    kmip_vector_append(&ctx, &observed.attribute_list, state);
+
+    if(kmip_find_attribute(&observed, KMIP_ATTR_STATE, 0) != state)
+    {
+        kmip_free_attributes(&ctx, &observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    kmip_free_attributes(&ctx, &observed);
+    kmip_destroy(&ctx);
+
+    TEST_PASSED(tracker, __func__);
+}
+
 int
 test_decode_attributes_with_invalid_kmip_version(TestTracker *tracker)
 {
@@ -8973,13 +11899,290 @@ test_decode_template_attribute(TestTracker *tracker)
         __func__);
     kmip_free_template_attribute(&ctx, &observed);
     kmip_destroy(&ctx);
-    return(result);
+    return(result);
+}
+
+int
+test_find_template_attribute(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    Attribute a[4] = {0};
+    for(int i = 0; i < 4; i++)
+    {
+        kmip_init_attribute(&a[i]);
+    }
+
+    Name name_1 = {0};
+    a[0].type = KMIP_ATTR_NAME;
+    a[0].value = &name_1;
+
+    int32 length = 128;
+    a[1].type = KMIP_ATTR_CRYPTOGRAPHIC_LENGTH;
+    a[1].value = &length;
+
+    Name name_2 = {0};
+    a[2].type = KMIP_ATTR_NAME;
+    a[2].value = &name_2;
+
+    enum state state = KMIP_STATE_ACTIVE;
+    a[3].type = KMIP_ATTR_STATE;
+    a[3].value = &state;
+
+    TemplateAttribute value = {0};
+    value.attributes = a;
+    value.attribute_count = ARRAY_LENGTH(a);
+
+    /* Lookups on an unindexed collection fall back to a linear scan. */
+    for(int indexed = 0; indexed < 2; indexed++)
+    {
+        if(indexed)
+        {
+            kmip_index_template_attribute(&value);
+            if(value.index.count != ARRAY_LENGTH(a))
+            {
+                TEST_FAILED(tracker, __func__, __LINE__);
+            }
+        }
+
+        if(kmip_find_template_attribute(&value, KMIP_ATTR_CRYPTOGRAPHIC_LENGTH, 0) != &a[1])
+        {
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+        if(kmip_find_template_attribute(&value, KMIP_ATTR_STATE, 0) != &a[3])
+        {
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+        if(kmip_find_template_attribute(&value, KMIP_ATTR_NAME, 0) != &a[0] ||
+           kmip_find_template_attribute(&value, KMIP_ATTR_NAME, 1) != &a[2] ||
+           kmip_find_template_attribute(&value, KMIP_ATTR_NAME, 2) != NULL)
+        {
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+        if(kmip_find_template_attribute(&value, KMIP_ATTR_OBJECT_TYPE, 0) != NULL)
+        {
+            TEST_FAILED(tracker, __func__, __LINE__);
+        }
+    }
+
+    /* Swapping two attributes of different types without reindexing   */
+    /* leaves the other type at each indexed position, which is caught. */
+    Attribute swapped = a[1];
+    a[1] = a[3];
+    a[3] = swapped;
+    if(kmip_find_template_attribute(&value, KMIP_ATTR_CRYPTOGRAPHIC_LENGTH, 0) != &a[3] ||
+       kmip_find_template_attribute(&value, KMIP_ATTR_STATE, 0) != &a[1])
+    {
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    TEST_PASSED(tracker, __func__);
+}
+
+/*
+The following tests cover features added in KMIP 1.1.
+*/
+
+int
+test_decode_template_attribute_skip_unknown(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    /* A custom attribute, a Digest (structured value, unsupported), a  */
+    /* Cryptographic Length, and a trailing extension item.             */
+    uint8 encoding[168] = {
+        0x42, 0x00, 0x91, 0x01, 0x00, 0x00, 0x00, 0xA0, 
+        0x42, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x20, 
+        0x42, 0x00, 0x0A, 0x07, 0x00, 0x00, 0x00, 0x08, 
+        0x78, 0x2D, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 
+        0x42, 0x00, 0x0B, 0x07, 0x00, 0x00, 0x00, 0x03, 
+        0x61, 0x62, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x28, 
+        0x42, 0x00, 0x0A, 0x07, 0x00, 0x00, 0x00, 0x06, 
+        0x44, 0x69, 0x67, 0x65, 0x73, 0x74, 0x00, 0x00, 
+        0x42, 0x00, 0x0B, 0x01, 0x00, 0x00, 0x00, 0x10, 
+        0x42, 0x00, 0x38, 0x05, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x30, 
+        0x42, 0x00, 0x0A, 0x07, 0x00, 0x00, 0x00, 0x14, 
+        0x43, 0x72, 0x79, 0x70, 0x74, 0x6F, 0x67, 0x72, 
+        0x61, 0x70, 0x68, 0x69, 0x63, 0x20, 0x4C, 0x65, 
+        0x6E, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x0B, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+        0x54, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x02, 
+        0x68, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+
+    TemplateAttribute observed = {0};
+    int result = kmip_decode_template_attribute(&ctx, &observed);
+    kmip_free_template_attribute(&ctx, &observed);
+    if(result != KMIP_ERROR_ATTR_UNSUPPORTED)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    kmip_rewind(&ctx);
+    ctx.skip_unknown = KMIP_TRUE;
+
+    result = kmip_decode_template_attribute(&ctx, &observed);
+    if(result != KMIP_OK ||
+       observed.attribute_count != 1 ||
+       observed.attributes[0].type != KMIP_ATTR_CRYPTOGRAPHIC_LENGTH ||
+       *(int32 *)observed.attributes[0].value != 128 ||
+       ctx.index != ctx.buffer + ctx.size)
+    {
+        kmip_free_template_attribute(&ctx, &observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(ctx.skipped_count != 3 ||
+       ctx.skipped_items[0].tag != KMIP_TAG_ATTRIBUTE ||
+       ctx.skipped_items[0].offset != 8 ||
+       ctx.skipped_items[0].size != 40 ||
+       ctx.skipped_items[1].offset != 48 ||
+       ctx.skipped_items[1].size != 48 ||
+       ctx.skipped_items[2].tag != 0x540001 ||
+       ctx.skipped_items[2].type != KMIP_TYPE_TEXT_STRING ||
+       ctx.skipped_items[2].offset != 152 ||
+       ctx.skipped_items[2].size != 16)
+    {
+        kmip_free_template_attribute(&ctx, &observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    kmip_free_template_attribute(&ctx, &observed);
+    kmip_destroy(&ctx);
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_decode_template_attribute_skip_unknown_between_runs(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    /* A Name, an extension item, then two Cryptographic Lengths. */
+    uint8 encoding[176] = {
+        0x42, 0x00, 0x91, 0x01, 0x00, 0x00, 0x00, 0xA8, 
+        0x42, 0x00, 0x53, 0x01, 0x00, 0x00, 0x00, 0x20, 
+        0x42, 0x00, 0x55, 0x07, 0x00, 0x00, 0x00, 0x03, 
+        0x61, 0x62, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x54, 0x05, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+        0x54, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 0x02, 
+        0x68, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x30, 
+        0x42, 0x00, 0x0A, 0x07, 0x00, 0x00, 0x00, 0x14, 
+        0x43, 0x72, 0x79, 0x70, 0x74, 0x6F, 0x67, 0x72, 
+        0x61, 0x70, 0x68, 0x69, 0x63, 0x20, 0x4C, 0x65, 
+        0x6E, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x0B, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00, 0x30, 
+        0x42, 0x00, 0x0A, 0x07, 0x00, 0x00, 0x00, 0x14, 
+        0x43, 0x72, 0x79, 0x70, 0x74, 0x6F, 0x67, 0x72, 
+        0x61, 0x70, 0x68, 0x69, 0x63, 0x20, 0x4C, 0x65, 
+        0x6E, 0x67, 0x74, 0x68, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x0B, 0x02, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    
+    KMIP ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+    ctx.skip_unknown = KMIP_TRUE;
+    
+    TemplateAttribute observed = {0};
+    int result = kmip_decode_template_attribute(&ctx, &observed);
+    if(result != KMIP_OK ||
+       observed.name_count != 1 ||
+       observed.attribute_count != 2 ||
+       *(int32 *)observed.attributes[0].value != 128 ||
+       *(int32 *)observed.attributes[1].value != 256 ||
+       kmip_find_template_attribute(&observed, KMIP_ATTR_CRYPTOGRAPHIC_LENGTH, 1) != &observed.attributes[1] ||
+       ctx.skipped_count != 1 ||
+       ctx.skipped_items[0].offset != 48 ||
+       ctx.index != ctx.buffer + ctx.size)
+    {
+        kmip_free_template_attribute(&ctx, &observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+    
+    kmip_free_template_attribute(&ctx, &observed);
+    kmip_destroy(&ctx);
+    TEST_PASSED(tracker, __func__);
+}
+
+int
+test_decode_response_batch_item_skip_unknown(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    /* A Locate batch item with a payload and a Message Extension. */
+    uint8 encoding[88] = {
+        0x42, 0x00, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x50, 
+        0x42, 0x00, 0x5C, 0x05, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x7F, 0x05, 0x00, 0x00, 0x00, 0x04, 
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x7C, 0x01, 0x00, 0x00, 0x00, 0x10, 
+        0x42, 0x00, 0x94, 0x07, 0x00, 0x00, 0x00, 0x01, 
+        0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+        0x42, 0x00, 0x51, 0x01, 0x00, 0x00, 0x00, 0x10, 
+        0x42, 0x00, 0x9D, 0x07, 0x00, 0x00, 0x00, 0x01, 
+        0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+
+    KMIP ctx = {0};
+    kmip_init(&ctx, encoding, ARRAY_LENGTH(encoding), KMIP_1_0);
+
+    ResponseBatchItem observed = {0};
+    int result = kmip_decode_response_batch_item(&ctx, &observed);
+    kmip_free_response_batch_item(&ctx, &observed);
+    if(result == KMIP_OK)
+    {
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    kmip_rewind(&ctx);
+    ctx.skip_unknown = KMIP_TRUE;
+
+    result = kmip_decode_response_batch_item(&ctx, &observed);
+    if(result != KMIP_OK ||
+       observed.operation != 0x08 ||
+       observed.result_status != KMIP_STATUS_SUCCESS ||
+       observed.response_payload != NULL ||
+       ctx.index != ctx.buffer + ctx.size)
+    {
+        kmip_free_response_batch_item(&ctx, &observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    if(ctx.skipped_count != 2 ||
+       ctx.skipped_items[0].tag != KMIP_TAG_RESPONSE_PAYLOAD ||
+       ctx.skipped_items[0].offset != 40 ||
+       ctx.skipped_items[0].size != 24 ||
+       ctx.skipped_items[1].offset != 64 ||
+       ctx.skipped_items[1].size != 24)
+    {
+        kmip_free_response_batch_item(&ctx, &observed);
+        kmip_destroy(&ctx);
+        TEST_FAILED(tracker, __func__, __LINE__);
+    }
+
+    kmip_free_response_batch_item(&ctx, &observed);
+    kmip_destroy(&ctx);
+    TEST_PASSED(tracker, __func__);
 }
 
-/*
-The following tests cover features added in KMIP 1.1.
-*/
-
 int
 test_encode_device_credential(TestTracker *tracker)
 {
@@ -9343,6 +12546,28 @@ test_encode_nonce(TestTracker *tracker)
     return(result);
 }
 
+int
+test_encode_nonce_missing_nonce_value(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+
+    uint8 observed[40] = {0};
+    struct kmip ctx = {0};
+    kmip_init(&ctx, observed, ARRAY_LENGTH(observed), KMIP_1_2);
+    
+    uint8 id[4] = {0x01, 0x02, 0x03, 0x04};
+    struct byte_string ni = {0};
+    ni.value = id;
+    ni.size = ARRAY_LENGTH(id);
+    
+    struct nonce n = {0};
+    n.nonce_id = &ni;
+    
+    int result = kmip_encode_nonce(&ctx, &n);
+    kmip_destroy(&ctx);
+    return(report_result(tracker, result, KMIP_INVALID_FIELD, __func__));
+}
+
 int
 test_decode_nonce(TestTracker *tracker)
 {
@@ -11235,6 +14460,225 @@ test_kmip_1_1_test_suite_3_1_3_2_b(TestTracker *tracker)
     return(result);
 }
 
+int
+test_size_template_attribute(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    struct kmip ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+    
+    struct text_string v = {0};
+    v.value = "Template1";
+    v.size = 9;
+    
+    struct name n = {0};
+    n.value = &v;
+    n.type = KMIP_NAME_UNINTERPRETED_TEXT_STRING;
+    
+    struct attribute a[4] = {0};
+    for(int i = 0; i < 4; i++)
+    {
+        kmip_init_attribute(&a[i]);
+    }
+    
+    enum cryptographic_algorithm algorithm = KMIP_CRYPTOALG_AES;
+    a[0].type = KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM;
+    a[0].value = &algorithm;
+    
+    int32 length = 128;
+    a[1].type = KMIP_ATTR_CRYPTOGRAPHIC_LENGTH;
+    a[1].value = &length;
+    
+    int32 mask = KMIP_CRYPTOMASK_ENCRYPT | KMIP_CRYPTOMASK_DECRYPT;
+    a[2].type = KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK;
+    a[2].value = &mask;
+    
+    struct text_string value = {0};
+    value.value = "Key1";
+    value.size = 4;
+    
+    struct name name = {0};
+    name.value = &value;
+    name.type = KMIP_NAME_UNINTERPRETED_TEXT_STRING;
+    a[3].type = KMIP_ATTR_NAME;
+    a[3].value = &name;
+    
+    struct template_attribute ta = {0};
+    ta.names = &n;
+    ta.name_count = 1;
+    ta.attributes = a;
+    ta.attribute_count = ARRAY_LENGTH(a);
+    
+    /* The encoding of this template attribute is 288 bytes long; see */
+    /* test_encode_template_attribute.                                */
+    size_t size = kmip_size_template_attribute(&ctx, &ta);
+    int result = report_result(tracker, size == 288, KMIP_TRUE, __func__);
+    kmip_destroy(&ctx);
+    return(result);
+}
+
+int
+test_size_request_message_get(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    struct kmip ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+    
+    struct protocol_version pv = {0};
+    pv.major = 1;
+    pv.minor = 0;
+    
+    struct request_header rh = {0};
+    kmip_init_request_header(&rh);
+    
+    rh.protocol_version = &pv;
+    rh.batch_count = 1;
+    
+    struct text_string uuid = {0};
+    uuid.value = "49a1ca88-6bea-4fb2-b450-7e58802c3038";
+    uuid.size = 36;
+    
+    struct get_request_payload grp = {0};
+    grp.unique_identifier = &uuid;
+    
+    struct request_batch_item rbi = {0};
+    kmip_init_request_batch_item(&rbi);
+    rbi.operation = KMIP_OP_GET;
+    rbi.request_payload = &grp;
+    
+    struct request_message rm = {0};
+    rm.request_header = &rh;
+    rm.batch_items = &rbi;
+    rm.batch_count = 1;
+    
+    /* The encoding of this request message is 152 bytes long; see */
+    /* test_encode_request_message_get.                            */
+    size_t size = kmip_size_request_message(&ctx, &rm);
+    int result = report_result(tracker, size == 152, KMIP_TRUE, __func__);
+    kmip_destroy(&ctx);
+    return(result);
+}
+
+int
+test_size_response_message_get(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    struct kmip ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_1_0);
+    
+    struct protocol_version pv = {0};
+    pv.major = 1;
+    pv.minor = 0;
+    
+    struct response_header rh = {0};
+    kmip_init_response_header(&rh);
+    
+    rh.protocol_version = &pv;
+    rh.time_stamp = 1335514343;
+    rh.batch_count = 1;
+    
+    struct text_string uuid = {0};
+    uuid.value = "49a1ca88-6bea-4fb2-b450-7e58802c3038";
+    uuid.size = 36;
+    
+    uint8 value[24] = {
+        0x73, 0x67, 0x57, 0x80, 0x51, 0x01, 0x2A, 0x6D, 
+        0x13, 0x4A, 0x85, 0x5E, 0x25, 0xC8, 0xCD, 0x5E, 
+        0x4C, 0xA1, 0x31, 0x45, 0x57, 0x29, 0xD3, 0xC8
+    };
+    
+    struct byte_string v = {0};
+    v.value = value;
+    v.size = ARRAY_LENGTH(value);
+    
+    struct key_value kv = {0};
+    kv.key_material = &v;
+    
+    struct key_block kb = {0};
+    kb.key_format_type = KMIP_KEYFORMAT_RAW;
+    kb.key_value = &kv;
+    kb.cryptographic_algorithm = KMIP_CRYPTOALG_TRIPLE_DES;
+    kb.cryptographic_length = 168;
+    
+    struct symmetric_key key = {0};
+    key.key_block = &kb;
+    
+    struct get_response_payload grp = {0};
+    grp.object_type = KMIP_OBJTYPE_SYMMETRIC_KEY;
+    grp.unique_identifier = &uuid;
+    grp.object = &key;
+    
+    struct response_batch_item rbi = {0};
+    rbi.operation = KMIP_OP_GET;
+    rbi.result_status = KMIP_STATUS_SUCCESS;
+    rbi.response_payload = &grp;
+    
+    struct response_message rm = {0};
+    rm.response_header = &rh;
+    rm.batch_items = &rbi;
+    rm.batch_count = 1;
+    
+    /* The encoding of this response message is 304 bytes long; see */
+    /* test_encode_response_message_get.                            */
+    size_t size = kmip_size_response_message(&ctx, &rm);
+    int result = report_result(tracker, size == 304, KMIP_TRUE, __func__);
+    kmip_destroy(&ctx);
+    return(result);
+}
+
+int
+test_size_create_request_payload_kmip_2_0(TestTracker *tracker)
+{
+    TRACK_TEST(tracker);
+    
+    struct kmip ctx = {0};
+    kmip_init(&ctx, NULL, 0, KMIP_2_0);
+    
+    Attribute a[3] = {0};
+    for(int i = 0; i < 3; i++)
+    {
+        kmip_init_attribute(&a[i]);
+    }
+    
+    enum cryptographic_algorithm algorithm = KMIP_CRYPTOALG_AES;
+    a[0].type = KMIP_ATTR_CRYPTOGRAPHIC_ALGORITHM;
+    a[0].value = &algorithm;
+    
+    int32 length = 128;
+    a[1].type = KMIP_ATTR_CRYPTOGRAPHIC_LENGTH;
+    a[1].value = &length;
+    
+    int32 mask = KMIP_CRYPTOMASK_ENCRYPT | KMIP_CRYPTOMASK_DECRYPT;
+    a[2].type = KMIP_ATTR_CRYPTOGRAPHIC_USAGE_MASK;
+    a[2].value = &mask;
+    
+    Attributes attributes = {0};
+    kmip_vector_append(&ctx, &attributes.attribute_list, &a[0]);
+    kmip_vector_append(&ctx, &attributes.attribute_list, &a[1]);
+    kmip_vector_append(&ctx, &attributes.attribute_list, &a[2]);
+    
+    ProtectionStorageMasks psm = {0};
+    int32 m1 = KMIP_PROTECT_SOFTWARE | KMIP_PROTECT_ON_SYSTEM;
+    int32 m2 = KMIP_PROTECT_OFF_SYSTEM | KMIP_PROTECT_OFF_PREMISES;
+    kmip_vector_append(&ctx, &psm.masks, &m1);
+    kmip_vector_append(&ctx, &psm.masks, &m2);
+    
+    CreateRequestPayload payload = {0};
+    payload.object_type = KMIP_OBJTYPE_SYMMETRIC_KEY;
+    payload.attributes = &attributes;
+    payload.protection_storage_masks = &psm;
+    
+    /* The encoding of this request payload is 120 bytes long; see */
+    /* test_encode_create_request_payload_kmip_2_0.                */
+    size_t size = kmip_size_create_request_payload(&ctx, &payload);
+    int result = report_result(tracker, size == 120, KMIP_TRUE, __func__);
+    kmip_destroy(&ctx);
+    return(result);
+}
+
 /* Test Harness */
 
 int
@@ -11250,27 +14694,48 @@ run_tests(void)
     test_linked_list_pop(&tracker);
     test_linked_list_push(&tracker);
     test_linked_list_enqueue(&tracker);
+    test_vector_append_and_pop(&tracker);
     test_buffer_bytes_left(&tracker);
+    test_is_zero_buffer(&tracker);
     test_peek_tag(&tracker);
     test_is_attribute_tag(&tracker);
     test_get_enum_string_index(&tracker);
     test_check_enum_value_protection_storage_masks(&tracker);
+    test_check_enum_value_cryptographic_usage_mask(&tracker);
+    test_check_enum_value_version_ranges(&tracker);
     test_init_protocol_version(&tracker);
     test_init_request_batch_item(&tracker);
     test_deep_copy_int32(&tracker);
     test_deep_copy_text_string(&tracker);
     test_deep_copy_name(&tracker);
     test_deep_copy_attribute(&tracker);
+    test_clone_flat_symmetric_key(&tracker);
+    test_clone_flat_get_response_payload(&tracker);
+    test_clone_flat_get_response_payload_survives_arena_reset(&tracker);
+    test_set_hash_seed(&tracker);
+    test_hash_cryptographic_parameters(&tracker);
+    test_hash_template_attribute(&tracker);
+    test_hash_request_message(&tracker);
 
     printf("\nKMIP 1.0 Feature Tests\n");
     printf("----------------------\n");
     test_buffer_full_and_resize(&tracker);
+    test_buffer_full_and_grow(&tracker);
     test_is_tag_next(&tracker);
     test_get_num_items_next(&tracker);
     test_get_num_items_next_with_partial_item(&tracker);
     test_get_num_items_next_with_mismatch_item(&tracker);
     test_get_num_items_next_with_no_matches(&tracker);
     test_get_num_items_next_with_non_structures(&tracker);
+    test_grow_and_trim_items(&tracker);
+    test_push_error_frame(&tracker);
+    test_arena_allocation(&tracker);
+    test_pool_allocation(&tracker);
+    test_pool_allocation_many_slabs(&tracker);
+    test_secure_heap_allocation(&tracker);
+    test_parser_feed_byte_by_byte(&tracker);
+    test_parser_feed_chunks(&tracker);
+    test_parser_feed_malformed(&tracker);
     
     printf("\n");
     test_decode_int8_be(&tracker);
@@ -11282,6 +14747,10 @@ run_tests(void)
     test_decode_bool(&tracker);
     test_decode_text_string(&tracker);
     test_decode_byte_string(&tracker);
+    test_decode_text_string_borrowed(&tracker);
+    test_decode_new_text_string_inline(&tracker);
+    test_decode_byte_string_borrowed(&tracker);
+    test_decode_byte_string_padding_mismatch(&tracker);
     test_decode_date_time(&tracker);
     test_decode_interval(&tracker);
     test_decode_name(&tracker);
@@ -11295,11 +14764,20 @@ run_tests(void)
     test_decode_attribute_operation_policy_name(&tracker);
     test_decode_attribute_cryptographic_usage_mask(&tracker);
     test_decode_attribute_state(&tracker);
+    test_decode_attribute_activation_date(&tracker);
+    test_attribute_name_round_trip(&tracker);
     test_decode_template_attribute(&tracker);
+    test_decode_template_attribute_skip_unknown(&tracker);
+    test_decode_template_attribute_skip_unknown_between_runs(&tracker);
+    test_find_template_attribute(&tracker);
+    test_decode_response_batch_item_skip_unknown(&tracker);
     test_decode_protocol_version(&tracker);
     test_decode_key_material_byte_string(&tracker);
     test_decode_key_material_transparent_symmetric_key(&tracker);
     test_decode_key_value(&tracker);
+    test_decode_key_value_with_secure_heap(&tracker);
+    test_reset_arena_after_response_message_with_secure_heap(&tracker);
+    test_free_arena_with_secure_heap(&tracker);
     test_decode_key_value_with_attributes(&tracker);
     test_decode_cryptographic_parameters(&tracker);
     test_decode_encryption_key_information(&tracker);
@@ -11320,6 +14798,7 @@ run_tests(void)
     test_decode_destroy_response_payload(&tracker);
     test_decode_response_batch_item_get_payload(&tracker);
     test_decode_username_password_credential(&tracker);
+    test_free_username_password_credential_wipes_password(&tracker);
     test_decode_credential_username_password_credential(&tracker);
     test_decode_authentication_username_password_credential(&tracker);
     test_decode_request_header(&tracker);
@@ -11327,6 +14806,9 @@ run_tests(void)
     test_decode_request_batch_item_get_payload(&tracker);
     test_decode_request_message_get(&tracker);
     test_decode_response_message_get(&tracker);
+    test_decode_response_message_many_batch_items(&tracker);
+    test_decode_response_message_lazy_payloads(&tracker);
+    test_decode_response_message_with_arena(&tracker);
     
     printf("\n");
     test_encode_integer(&tracker);
@@ -11348,6 +14830,7 @@ run_tests(void)
     test_encode_attribute_operation_policy_name(&tracker);
     test_encode_attribute_cryptographic_usage_mask(&tracker);
     test_encode_attribute_state(&tracker);
+    test_encode_attribute_activation_date(&tracker);
     test_encode_protocol_version(&tracker);
     test_encode_cryptographic_parameters(&tracker);
     test_encode_encryption_key_information(&tracker);
@@ -11375,6 +14858,14 @@ run_tests(void)
     test_encode_username_password_credential(&tracker);
     test_encode_credential_username_password_credential(&tracker);
     test_encode_authentication_username_password_credential(&tracker);
+    test_encode_authentication_with_fragment(&tracker);
+    test_build_template_attribute_fragment_survives_arena_reset(&tracker);
+    test_build_authentication_fragment_survives_arena_reset(&tracker);
+    test_compare_template_attribute_with_fragment(&tracker);
+    test_compare_authentication_with_fragment(&tracker);
+    test_patch_request_template(&tracker);
+    test_patch_request_template_survives_arena_reset(&tracker);
+    test_patch_request_template_missing_slot(&tracker);
     test_encode_request_header(&tracker);
     test_encode_response_header(&tracker);
     test_encode_request_batch_item_get_payload(&tracker);
@@ -11383,6 +14874,11 @@ run_tests(void)
     test_encode_response_message_get(&tracker);
     test_encode_template_attribute(&tracker);
     
+    printf("\n");
+    test_size_template_attribute(&tracker);
+    test_size_request_message_get(&tracker);
+    test_size_response_message_get(&tracker);
+    
     printf("\nKMIP 1.1 Feature Tests\n");
     printf("----------------------\n");
     test_decode_device_credential(&tracker);
@@ -11411,6 +14907,7 @@ run_tests(void)
     
     printf("\n");
     test_encode_nonce(&tracker);
+    test_encode_nonce_missing_nonce_value(&tracker);
     test_encode_attestation_credential(&tracker);
     test_encode_request_header_with_attestation_details(&tracker);
     test_encode_response_header_with_attestation_details(&tracker);
@@ -11431,6 +14928,7 @@ run_tests(void)
     printf("----------------------\n");
     test_decode_protection_storage_masks(&tracker);
     test_decode_attributes(&tracker);
+    test_find_attribute(&tracker);
     test_decode_attributes_with_invalid_kmip_version(&tracker);
     test_decode_attribute_v2_application_specific_information(&tracker);
     test_decode_attribute_v2_application_specific_information_invalid_encoding(&tracker);
@@ -11461,9 +14959,13 @@ run_tests(void)
     test_encode_attribute_v2_state(&tracker);
     test_encode_attribute_v2_unsupported_attribute(&tracker);
     test_encode_create_request_payload_kmip_2_0(&tracker);
+    test_encode_create_request_payload_with_fragment(&tracker);
     test_encode_request_batch_item_get_payload_kmip_2_0(&tracker);
     test_encode_response_header_kmip_2_0(&tracker);
 
+    printf("\n");
+    test_size_create_request_payload_kmip_2_0(&tracker);
+
     printf("\nSummary\n");
     printf("================\n");
     printf("Total tests: %u\n", tracker.test_count);